@@ -40,6 +40,7 @@
 
 
 #include "3dface.h"
+#include "util.h"
 
 
 /*!
@@ -53,7 +54,7 @@
 Dxf3dface *
 dxf_3dface_new ()
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         Dxf3dface *face = NULL;
@@ -62,9 +63,9 @@ dxf_3dface_new ()
         size = sizeof (Dxf3dface);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((face = malloc (size)) == NULL)
+        if ((face = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 face = NULL;
@@ -72,8 +73,9 @@ dxf_3dface_new ()
         else
         {
                 memset (face, 0, size);
+                face->header.type = DFACE;
         }
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (face);
@@ -94,27 +96,27 @@ dxf_3dface_init
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 face = dxf_3dface_new ();
         }
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_3dface_set_id_code (face, 0);
-        dxf_3dface_set_linetype (face, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_3dface_set_layer (face, strdup (DXF_DEFAULT_LAYER));
+        dxf_3dface_set_linetype (face, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_3dface_set_layer (face, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_3dface_set_p0 (face, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_3dface_get_p0 (face));
         dxf_3dface_set_x0 (face, 0.0);
@@ -146,16 +148,16 @@ dxf_3dface_init
         dxf_3dface_set_shadow_mode (face, 0);
         dxf_3dface_set_binary_graphics_data (face, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_3dface_get_binary_graphics_data (face));
-        dxf_3dface_set_dictionary_owner_soft (face, strdup (""));
-        dxf_3dface_set_material (face, strdup (""));
-        dxf_3dface_set_dictionary_owner_hard (face, strdup (""));
+        dxf_3dface_set_dictionary_owner_soft (face, dxf_strdup (""));
+        dxf_3dface_set_material (face, dxf_strdup (""));
+        dxf_3dface_set_dictionary_owner_hard (face, dxf_strdup (""));
         dxf_3dface_set_lineweight (face, 0);
-        dxf_3dface_set_plot_style_name (face, strdup (""));
+        dxf_3dface_set_plot_style_name (face, dxf_strdup (""));
         dxf_3dface_set_color_value (face, 0);
-        dxf_3dface_set_color_name (face, strdup (""));
+        dxf_3dface_set_color_name (face, dxf_strdup (""));
         dxf_3dface_set_transparency (face, 0);
         dxf_3dface_set_next (face, NULL);
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (face);
@@ -182,40 +184,40 @@ dxf_3dface_read
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int i_binary_graphics_data = 0;
+        DxfBinaryGraphicsData *binary_graphics_data = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 face = dxf_3dface_new ();
                 face = dxf_3dface_init (face);
         }
+        binary_graphics_data = (DxfBinaryGraphicsData *) face->binary_graphics_data;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -231,13 +233,13 @@ dxf_3dface_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->linetype);
+                        dxf_read_string (fp, &face->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->layer);
+                        dxf_read_string (fp, &face->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -388,7 +390,7 @@ dxf_3dface_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && (strcmp (temp_string, "AcDbFace") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -411,31 +413,35 @@ dxf_3dface_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
+                        if (i_binary_graphics_data > 0)
+                        {
+                                binary_graphics_data->next = (struct DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+                                binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
+                        }
+                        i_binary_graphics_data++;
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) face->binary_graphics_data->next);
-                        face->binary_graphics_data = (DxfBinaryGraphicsData *) face->binary_graphics_data->next;
+                        dxf_read_string (fp, &binary_graphics_data->data_line);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->dictionary_owner_soft);
+                        dxf_read_string (fp, &face->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->material);
+                        dxf_read_string (fp, &face->material);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->dictionary_owner_hard);
+                        dxf_read_string (fp, &face->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -449,7 +455,7 @@ dxf_3dface_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->plot_style_name);
+                        dxf_read_string (fp, &face->plot_style_name);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -462,7 +468,7 @@ dxf_3dface_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->color_name);
+                        dxf_read_string (fp, &face->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -480,22 +486,26 @@ dxf_3dface_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (face->linetype, "") == 0)
         {
-                face->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                face->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (face->layer, "") == 0)
         {
-                face->layer = strdup (DXF_DEFAULT_LAYER);
+                face->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -518,50 +528,50 @@ dxf_3dface_write
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("3DFACE");
+        char *dxf_entity_name = dxf_strdup ("3DFACE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((strcmp (dxf_3dface_get_layer (face), "") == 0)
           || (dxf_3dface_get_layer (face) == NULL))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_3dface_get_id_code (face));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                dxf_3dface_set_layer (face, strdup (DXF_DEFAULT_LAYER));
+                dxf_3dface_set_layer (face, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         if (dxf_3dface_get_linetype (face) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_3dface_get_id_code (face));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
-                dxf_3dface_set_linetype (face, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_3dface_set_linetype (face, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -623,16 +633,16 @@ dxf_3dface_write
           && DXF_FLATLAND
           && (dxf_3dface_get_elevation (face) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_3dface_get_elevation (face));
+                dxf_write_real (fp, 38, dxf_3dface_get_elevation (face));
         }
         if ((fp->acad_version_number <= AutoCAD_13)
           && (dxf_3dface_get_thickness (face) != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_3dface_get_thickness (face));
+                dxf_write_real (fp, 39, dxf_3dface_get_thickness (face));
         }
         if (dxf_3dface_get_linetype_scale (face) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_3dface_get_linetype_scale (face));
+                dxf_write_real (fp, 48, dxf_3dface_get_linetype_scale (face));
         }
         if (dxf_3dface_get_visibility (face) != 0)
         {
@@ -672,22 +682,22 @@ dxf_3dface_write
         {
                 fprintf (fp->fp, "100\nAcDbFace\n");
         }
-        fprintf (fp->fp, " 10\n%f\n", dxf_3dface_get_x0 (face));
-        fprintf (fp->fp, " 20\n%f\n", dxf_3dface_get_y0 (face));
-        fprintf (fp->fp, " 30\n%f\n", dxf_3dface_get_z0 (face));
-        fprintf (fp->fp, " 11\n%f\n", dxf_3dface_get_x1 (face));
-        fprintf (fp->fp, " 21\n%f\n", dxf_3dface_get_y1 (face));
-        fprintf (fp->fp, " 31\n%f\n", dxf_3dface_get_z1 (face));
-        fprintf (fp->fp, " 12\n%f\n", dxf_3dface_get_x2 (face));
-        fprintf (fp->fp, " 22\n%f\n", dxf_3dface_get_y2 (face));
-        fprintf (fp->fp, " 32\n%f\n", dxf_3dface_get_z2 (face));
-        fprintf (fp->fp, " 13\n%f\n", dxf_3dface_get_x3 (face));
-        fprintf (fp->fp, " 23\n%f\n", dxf_3dface_get_y3 (face));
-        fprintf (fp->fp, " 33\n%f\n", dxf_3dface_get_z3 (face));
+        dxf_write_real (fp, 10, dxf_3dface_get_x0 (face));
+        dxf_write_real (fp, 20, dxf_3dface_get_y0 (face));
+        dxf_write_real (fp, 30, dxf_3dface_get_z0 (face));
+        dxf_write_real (fp, 11, dxf_3dface_get_x1 (face));
+        dxf_write_real (fp, 21, dxf_3dface_get_y1 (face));
+        dxf_write_real (fp, 31, dxf_3dface_get_z1 (face));
+        dxf_write_real (fp, 12, dxf_3dface_get_x2 (face));
+        dxf_write_real (fp, 22, dxf_3dface_get_y2 (face));
+        dxf_write_real (fp, 32, dxf_3dface_get_z2 (face));
+        dxf_write_real (fp, 13, dxf_3dface_get_x3 (face));
+        dxf_write_real (fp, 23, dxf_3dface_get_y3 (face));
+        dxf_write_real (fp, 33, dxf_3dface_get_z3 (face));
         fprintf (fp->fp, " 70\n%d\n", dxf_3dface_get_flag (face));
         /* Clean up. */
-        free (dxf_entity_name);
-#ifdef DEBUG
+        dxf_free (dxf_entity_name);
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (EXIT_SUCCESS);
@@ -709,38 +719,38 @@ dxf_3dface_free
                  * \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (face);
         }
-        free (dxf_3dface_get_linetype (face));
-        free (dxf_3dface_get_layer (face));
+        dxf_free (dxf_3dface_get_linetype (face));
+        dxf_free (dxf_3dface_get_layer (face));
         dxf_binary_graphics_data_free_chain (dxf_3dface_get_binary_graphics_data (face));
-        free (dxf_3dface_get_dictionary_owner_soft (face));
-        free (dxf_3dface_get_material (face));
-        free (dxf_3dface_get_dictionary_owner_hard (face));
-        free (dxf_3dface_get_plot_style_name (face));
-        free (dxf_3dface_get_color_name (face));
+        dxf_free (dxf_3dface_get_dictionary_owner_soft (face));
+        dxf_free (dxf_3dface_get_material (face));
+        dxf_free (dxf_3dface_get_dictionary_owner_hard (face));
+        dxf_free (dxf_3dface_get_plot_style_name (face));
+        dxf_free (dxf_3dface_get_color_name (face));
         dxf_point_free (dxf_3dface_get_p0 (face));
         dxf_point_free (dxf_3dface_get_p1 (face));
         dxf_point_free (dxf_3dface_get_p2 (face));
         dxf_point_free (dxf_3dface_get_p3 (face));
-        free (face);
+        dxf_free (face);
         face = NULL;
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (face);
@@ -758,18 +768,19 @@ dxf_3dface_free_chain
                 /*!< a pointer to the chain of DXF \c 3DFACE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (faces == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (faces != NULL)
         {
                 struct Dxf3dface *iter = faces->next;
+                faces->next = NULL;
                 dxf_3dface_free (faces);
                 faces = (Dxf3dface *) iter;
         }
@@ -797,14 +808,14 @@ dxf_3dface_get_id_code
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -838,14 +849,14 @@ dxf_3dface_set_id_code
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -876,14 +887,14 @@ dxf_3dface_get_linetype
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -891,7 +902,7 @@ dxf_3dface_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->linetype));
+        return (dxf_strdup (face->linetype));
 }
 
 
@@ -919,19 +930,19 @@ dxf_3dface_set_linetype
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        face->linetype = strdup (linetype);
+        face->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -958,14 +969,14 @@ dxf_3dface_get_layer
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -973,7 +984,7 @@ dxf_3dface_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->layer));
+        return (dxf_strdup (face->layer));
 }
 
 
@@ -1000,19 +1011,19 @@ dxf_3dface_set_layer
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        face->layer = strdup (layer);
+        face->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1038,7 +1049,7 @@ dxf_3dface_get_elevation
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1071,7 +1082,7 @@ dxf_3dface_set_elevation
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1102,14 +1113,14 @@ dxf_3dface_get_thickness
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1141,14 +1152,14 @@ dxf_3dface_set_thickness
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1178,14 +1189,14 @@ dxf_3dface_get_linetype_scale
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1217,14 +1228,14 @@ dxf_3dface_set_linetype_scale
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1254,21 +1265,21 @@ dxf_3dface_get_visibility
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1301,21 +1312,21 @@ dxf_3dface_set_visibility
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1346,14 +1357,14 @@ dxf_3dface_get_color
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1385,14 +1396,14 @@ dxf_3dface_set_color
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1422,20 +1433,20 @@ dxf_3dface_get_paperspace
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (face->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found.\n")),
                   __FUNCTION__);
         }
@@ -1467,21 +1478,21 @@ dxf_3dface_set_paperspace
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1514,20 +1525,20 @@ dxf_3dface_get_graphics_data_size
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (face->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found.\n")),
                   __FUNCTION__);
         }
@@ -1560,21 +1571,21 @@ dxf_3dface_set_graphics_data_size
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1605,21 +1616,21 @@ dxf_3dface_get_shadow_mode
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1652,21 +1663,21 @@ dxf_3dface_set_shadow_mode
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1700,14 +1711,14 @@ dxf_3dface_get_binary_graphics_data
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1739,14 +1750,14 @@ dxf_3dface_set_binary_graphics_data
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1780,14 +1791,14 @@ dxf_3dface_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1795,7 +1806,7 @@ dxf_3dface_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->dictionary_owner_soft));
+        return (dxf_strdup (face->dictionary_owner_soft));
 }
 
 
@@ -1819,19 +1830,19 @@ dxf_3dface_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        face->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        face->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1860,14 +1871,14 @@ dxf_3dface_get_material
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1875,7 +1886,7 @@ dxf_3dface_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->material));
+        return (dxf_strdup (face->material));
 }
 
 
@@ -1901,19 +1912,19 @@ dxf_3dface_set_material
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        face->material = strdup (material);
+        face->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1942,14 +1953,14 @@ dxf_3dface_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1957,7 +1968,7 @@ dxf_3dface_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->dictionary_owner_hard));
+        return (dxf_strdup (face->dictionary_owner_hard));
 }
 
 
@@ -1984,19 +1995,19 @@ dxf_3dface_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        face->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        face->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2023,7 +2034,7 @@ dxf_3dface_get_lineweight
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2056,7 +2067,7 @@ dxf_3dface_set_lineweight
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2088,14 +2099,14 @@ dxf_3dface_get_plot_style_name
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2103,7 +2114,7 @@ dxf_3dface_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->plot_style_name));
+        return (dxf_strdup (face->plot_style_name));
 }
 
 
@@ -2129,19 +2140,19 @@ dxf_3dface_set_plot_style_name
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        face->plot_style_name = strdup (plot_style_name);
+        face->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2168,7 +2179,7 @@ dxf_3dface_get_color_value
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2201,7 +2212,7 @@ dxf_3dface_set_color_value
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2233,14 +2244,14 @@ dxf_3dface_get_color_name
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2248,7 +2259,7 @@ dxf_3dface_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (face->color_name));
+        return (dxf_strdup (face->color_name));
 }
 
 
@@ -2274,19 +2285,19 @@ dxf_3dface_set_color_name
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        face->color_name = strdup (color_name);
+        face->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2313,7 +2324,7 @@ dxf_3dface_get_transparency
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2346,7 +2357,7 @@ dxf_3dface_set_transparency
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2371,20 +2382,20 @@ dxf_3dface_get_p0
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2411,20 +2422,20 @@ dxf_3dface_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2450,21 +2461,21 @@ dxf_3dface_get_x0
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2493,20 +2504,20 @@ dxf_3dface_set_x0
                  * \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2532,21 +2543,21 @@ dxf_3dface_get_y0
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2575,20 +2586,20 @@ dxf_3dface_set_y0
                  * \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2614,21 +2625,21 @@ dxf_3dface_get_z0
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2657,20 +2668,20 @@ dxf_3dface_set_z0
                  * \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2695,20 +2706,20 @@ dxf_3dface_get_p1
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2735,20 +2746,20 @@ dxf_3dface_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2774,21 +2785,21 @@ dxf_3dface_get_x1
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2817,20 +2828,20 @@ dxf_3dface_set_x1
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2856,21 +2867,21 @@ dxf_3dface_get_y1
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2899,20 +2910,20 @@ dxf_3dface_set_y1
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2938,21 +2949,21 @@ dxf_3dface_get_z1
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2981,20 +2992,20 @@ dxf_3dface_set_z1
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3019,20 +3030,20 @@ dxf_3dface_get_p2
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3059,20 +3070,20 @@ dxf_3dface_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3098,21 +3109,21 @@ dxf_3dface_get_x2
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3141,20 +3152,20 @@ dxf_3dface_set_x2
                  * a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3180,21 +3191,21 @@ dxf_3dface_get_y2
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3223,20 +3234,20 @@ dxf_3dface_set_y2
                  * a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3262,21 +3273,21 @@ dxf_3dface_get_z2
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3305,20 +3316,20 @@ dxf_3dface_set_z2
                  * a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3343,20 +3354,20 @@ dxf_3dface_get_p3
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3383,20 +3394,20 @@ dxf_3dface_set_p3
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3422,21 +3433,21 @@ dxf_3dface_get_x3
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3465,20 +3476,20 @@ dxf_3dface_set_x3
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3504,21 +3515,21 @@ dxf_3dface_get_y3
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3547,20 +3558,20 @@ dxf_3dface_set_y3
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3586,21 +3597,21 @@ dxf_3dface_get_z3
                 /*!< a pointer to a DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3629,20 +3640,20 @@ dxf_3dface_set_z3
                  * DXF \c 3DFACE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3673,21 +3684,21 @@ dxf_3dface_get_flag
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (face->flag > 15)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3720,14 +3731,14 @@ dxf_3dface_set_flag
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3759,7 +3770,7 @@ dxf_3dface_is_first_edge_invisible
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3790,7 +3801,7 @@ dxf_3dface_is_second_edge_invisible
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3821,7 +3832,7 @@ dxf_3dface_is_third_edge_invisible
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3852,7 +3863,7 @@ dxf_3dface_is_fourth_edge_invisible
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3899,7 +3910,7 @@ dxf_3dface_create_from_points
                  */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         Dxf3dface *face = NULL;
@@ -3914,20 +3925,20 @@ dxf_3dface_create_from_points
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () to many NULL pointers were passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () passed id_code is smaller than 0.\n")),
                 __FUNCTION__);
         }
         if ((inheritance < 0) || (inheritance > 4))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an illegal inherit value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3935,7 +3946,7 @@ dxf_3dface_create_from_points
         face = dxf_3dface_init (face);
         if (face == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -3968,11 +3979,11 @@ dxf_3dface_create_from_points
                         }
                         if (p0->linetype != NULL)
                         {
-                                face->linetype = strdup (p0->linetype);
+                                face->linetype = dxf_strdup (p0->linetype);
                         }
                         if (p0->layer != NULL)
                         {
-                                face->layer = strdup (p0->layer);
+                                face->layer = dxf_strdup (p0->layer);
                         }
                         face->thickness = p0->thickness;
                         face->linetype_scale = p0->linetype_scale;
@@ -3981,11 +3992,11 @@ dxf_3dface_create_from_points
                         face->paperspace = p0->paperspace;
                         if (p0->dictionary_owner_soft != NULL)
                         {
-                                face->dictionary_owner_soft = strdup (p0->dictionary_owner_soft);
+                                face->dictionary_owner_soft = dxf_strdup (p0->dictionary_owner_soft);
                         }
                         if (p0->dictionary_owner_hard != NULL)
                         {
-                                face->dictionary_owner_hard = strdup (p0->dictionary_owner_hard);
+                                face->dictionary_owner_hard = dxf_strdup (p0->dictionary_owner_hard);
                         }
                         break;
                 case 2:
@@ -3995,11 +4006,11 @@ dxf_3dface_create_from_points
                         }
                         if (p1->linetype != NULL)
                         {
-                                face->linetype = strdup (p1->linetype);
+                                face->linetype = dxf_strdup (p1->linetype);
                         }
                         if (p1->layer != NULL)
                         {
-                                face->layer = strdup (p1->layer);
+                                face->layer = dxf_strdup (p1->layer);
                         }
                         face->thickness = p1->thickness;
                         face->linetype_scale = p1->linetype_scale;
@@ -4008,11 +4019,11 @@ dxf_3dface_create_from_points
                         face->paperspace = p1->paperspace;
                         if (p1->dictionary_owner_soft != NULL)
                         {
-                                face->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
+                                face->dictionary_owner_soft = dxf_strdup (p1->dictionary_owner_soft);
                         }
                         if (p1->dictionary_owner_hard != NULL)
                         {
-                                face->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
+                                face->dictionary_owner_hard = dxf_strdup (p1->dictionary_owner_hard);
                         }
                         break;
                 case 3:
@@ -4022,11 +4033,11 @@ dxf_3dface_create_from_points
                         }
                         if (p2->linetype != NULL)
                         {
-                                face->linetype = strdup (p2->linetype);
+                                face->linetype = dxf_strdup (p2->linetype);
                         }
                         if (p2->layer != NULL)
                         {
-                                face->layer = strdup (p2->layer);
+                                face->layer = dxf_strdup (p2->layer);
                         }
                         face->thickness = p2->thickness;
                         face->linetype_scale = p2->linetype_scale;
@@ -4035,11 +4046,11 @@ dxf_3dface_create_from_points
                         face->paperspace = p2->paperspace;
                         if (p2->dictionary_owner_soft != NULL)
                         {
-                                face->dictionary_owner_soft = strdup (p2->dictionary_owner_soft);
+                                face->dictionary_owner_soft = dxf_strdup (p2->dictionary_owner_soft);
                         }
                         if (p2->dictionary_owner_hard != NULL)
                         {
-                                face->dictionary_owner_hard = strdup (p2->dictionary_owner_hard);
+                                face->dictionary_owner_hard = dxf_strdup (p2->dictionary_owner_hard);
                         }
                         break;
                 case 4:
@@ -4049,11 +4060,11 @@ dxf_3dface_create_from_points
                         }
                         if (p3->linetype != NULL)
                         {
-                                face->linetype = strdup (p3->linetype);
+                                face->linetype = dxf_strdup (p3->linetype);
                         }
                         if (p3->layer != NULL)
                         {
-                                face->layer = strdup (p3->layer);
+                                face->layer = dxf_strdup (p3->layer);
                         }
                         face->thickness = p3->thickness;
                         face->linetype_scale = p3->linetype_scale;
@@ -4062,18 +4073,18 @@ dxf_3dface_create_from_points
                         face->paperspace = p3->paperspace;
                         if (p3->dictionary_owner_soft != NULL)
                         {
-                                face->dictionary_owner_soft = strdup (p3->dictionary_owner_soft);
+                                face->dictionary_owner_soft = dxf_strdup (p3->dictionary_owner_soft);
                         }
                         if (p3->dictionary_owner_hard != NULL)
                         {
-                                face->dictionary_owner_hard = strdup (p3->dictionary_owner_hard);
+                                face->dictionary_owner_hard = dxf_strdup (p3->dictionary_owner_hard);
                         }
                         break;
                 default:
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s (): unknown inheritance option passed.\n")),
                           __FUNCTION__);
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                           (_("\tResolving to default.\n")));
                         break;
         }
@@ -4105,14 +4116,14 @@ dxf_3dface_get_next
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4146,14 +4157,14 @@ dxf_3dface_set_next
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4187,14 +4198,14 @@ dxf_3dface_get_last
         /* Do some basic checks. */
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (face->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((Dxf3dface *) face);
@@ -42,6 +42,7 @@
 
 
 #include "3dline.h"
+#include "util.h"
 
 
 /*!
@@ -64,9 +65,9 @@ dxf_3dline_new ()
         size = sizeof (Dxf3dline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 line = NULL;
@@ -102,21 +103,21 @@ dxf_3dline_init
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_3dline_new ();
         }
         if (line == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_3dline_set_id_code (line, 0);
-        dxf_3dline_set_linetype (line, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_3dline_set_layer (line, strdup (DXF_DEFAULT_LAYER));
+        dxf_3dline_set_linetype (line, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_3dline_set_layer (line, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_3dline_set_p0 (line, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_3dline_get_p0 (line));
         dxf_3dline_set_x0 (line, 0.0);
@@ -140,13 +141,13 @@ dxf_3dline_init
         dxf_3dline_set_shadow_mode (line, 0);
         dxf_3dline_set_binary_graphics_data (line, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_3dline_get_binary_graphics_data (line));
-        dxf_3dline_set_dictionary_owner_soft (line, strdup (""));
-        dxf_3dline_set_material (line, strdup (""));
-        dxf_3dline_set_dictionary_owner_hard (line, strdup (""));
+        dxf_3dline_set_dictionary_owner_soft (line, dxf_strdup (""));
+        dxf_3dline_set_material (line, dxf_strdup (""));
+        dxf_3dline_set_dictionary_owner_hard (line, dxf_strdup (""));
         dxf_3dline_set_lineweight (line, 0);
-        dxf_3dline_set_plot_style_name (line, strdup (""));
+        dxf_3dline_set_plot_style_name (line, dxf_strdup (""));
         dxf_3dline_set_color_value (line, 0);
-        dxf_3dline_set_color_name (line, strdup (""));
+        dxf_3dline_set_color_name (line, dxf_strdup (""));
         dxf_3dline_set_transparency (line, 0);
         dxf_3dline_set_next (line, NULL);
 #if DEBUG
@@ -179,38 +180,37 @@ dxf_3dline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int i_binary_graphics_data = 0;
+        DxfBinaryGraphicsData *binary_graphics_data = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_3dline_new ();
                 line = dxf_3dline_init (line);
         }
+        binary_graphics_data = (DxfBinaryGraphicsData *) line->binary_graphics_data;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -225,13 +225,13 @@ dxf_3dline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->linetype);
+                        dxf_read_string (fp, &line->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->layer);
+                        dxf_read_string (fp, &line->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -333,7 +333,7 @@ dxf_3dline_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbLine") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -377,31 +377,35 @@ dxf_3dline_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
+                        if (i_binary_graphics_data > 0)
+                        {
+                                binary_graphics_data->next = (struct DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+                                binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
+                        }
+                        i_binary_graphics_data++;
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) line->binary_graphics_data->next);
-                        line->binary_graphics_data = (DxfBinaryGraphicsData *) line->binary_graphics_data->next;
+                        dxf_read_string (fp, &binary_graphics_data->data_line);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->dictionary_owner_soft);
+                        dxf_read_string (fp, &line->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->material);
+                        dxf_read_string (fp, &line->material);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->dictionary_owner_hard);
+                        dxf_read_string (fp, &line->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -415,7 +419,7 @@ dxf_3dline_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->plot_style_name);
+                        dxf_read_string (fp, &line->plot_style_name);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -428,7 +432,7 @@ dxf_3dline_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->color_name);
+                        dxf_read_string (fp, &line->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -446,22 +450,26 @@ dxf_3dline_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (line->linetype, "") == 0)
         {
-                line->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                line->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (line->layer, "") == 0)
         {
-                line->layer = strdup (DXF_DEFAULT_LAYER);
+                line->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -491,63 +499,63 @@ dxf_3dline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("3DLINE");
+        char *dxf_entity_name = dxf_strdup ("3DLINE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((dxf_3dline_get_x0 (line) == dxf_3dline_get_x1 (line))
                 && (dxf_3dline_get_y0 (line) == dxf_3dline_get_y1 (line))
                 && (dxf_3dline_get_z0 (line) == dxf_3dline_get_z1 (line)))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_3dline_get_id_code (line));
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((strcmp (dxf_3dline_get_layer (line), "") == 0)
           || (dxf_3dline_get_layer (line) == NULL))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_3dline_get_id_code (line));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
                 dxf_3dline_set_layer (line, DXF_DEFAULT_LAYER);
         }
         if (dxf_3dline_get_linetype (line) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_3dline_get_id_code (line));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
                 dxf_3dline_set_linetype (line, DXF_DEFAULT_LINETYPE);
         }
         if (fp->acad_version_number > AutoCAD_11)
         {
-                dxf_entity_name = strdup ("LINE");
+                dxf_entity_name = dxf_strdup ("LINE");
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -597,7 +605,7 @@ dxf_3dline_write
           && DXF_FLATLAND
           && (dxf_3dline_get_elevation (line) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_3dline_get_elevation (line));
+                dxf_write_real (fp, 38, dxf_3dline_get_elevation (line));
         }
         if ((fp->acad_version_number >= AutoCAD_2008)
           && (strcmp (dxf_3dline_get_material (line), "") != 0))
@@ -615,7 +623,7 @@ dxf_3dline_write
         if ((dxf_3dline_get_linetype_scale (line) != 1.0)
           && (fp->acad_version_number >= AutoCAD_13))
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_3dline_get_linetype_scale (line));
+                dxf_write_real (fp, 48, dxf_3dline_get_linetype_scale (line));
         }
         if ((dxf_3dline_get_visibility (line) != 0)
           && (fp->acad_version_number >= AutoCAD_13))
@@ -657,25 +665,25 @@ dxf_3dline_write
         }
         if (dxf_3dline_get_thickness (line) != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_3dline_get_thickness (line));
+                dxf_write_real (fp, 39, dxf_3dline_get_thickness (line));
         }
-        fprintf (fp->fp, " 10\n%f\n", dxf_3dline_get_x0 (line));
-        fprintf (fp->fp, " 20\n%f\n", dxf_3dline_get_y0 (line));
-        fprintf (fp->fp, " 30\n%f\n", dxf_3dline_get_z0 (line));
-        fprintf (fp->fp, " 11\n%f\n", dxf_3dline_get_x1 (line));
-        fprintf (fp->fp, " 21\n%f\n", dxf_3dline_get_y1 (line));
-        fprintf (fp->fp, " 31\n%f\n", dxf_3dline_get_z1 (line));
+        dxf_write_real (fp, 10, dxf_3dline_get_x0 (line));
+        dxf_write_real (fp, 20, dxf_3dline_get_y0 (line));
+        dxf_write_real (fp, 30, dxf_3dline_get_z0 (line));
+        dxf_write_real (fp, 11, dxf_3dline_get_x1 (line));
+        dxf_write_real (fp, 21, dxf_3dline_get_y1 (line));
+        dxf_write_real (fp, 31, dxf_3dline_get_z1 (line));
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (dxf_3dline_get_extr_x0 (line) != 0.0)
                 && (dxf_3dline_get_extr_y0 (line) != 0.0)
                 && (dxf_3dline_get_extr_z0 (line) != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", dxf_3dline_get_extr_x0 (line));
-                fprintf (fp->fp, "220\n%f\n", dxf_3dline_get_extr_y0 (line));
-                fprintf (fp->fp, "230\n%f\n", dxf_3dline_get_extr_z0 (line));
+                dxf_write_real (fp, 210, dxf_3dline_get_extr_x0 (line));
+                dxf_write_real (fp, 220, dxf_3dline_get_extr_y0 (line));
+                dxf_write_real (fp, 230, dxf_3dline_get_extr_z0 (line));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -703,22 +711,22 @@ dxf_3dline_free
 #endif
         if (line->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_3dline_get_linetype (line));
-        free (dxf_3dline_get_layer (line));
+        dxf_free (dxf_3dline_get_linetype (line));
+        dxf_free (dxf_3dline_get_layer (line));
         dxf_binary_graphics_data_free_chain (dxf_3dline_get_binary_graphics_data (line));
-        free (dxf_3dline_get_dictionary_owner_soft (line));
-        free (dxf_3dline_get_material (line));
-        free (dxf_3dline_get_dictionary_owner_hard (line));
-        free (dxf_3dline_get_plot_style_name (line));
-        free (dxf_3dline_get_color_name (line));
+        dxf_free (dxf_3dline_get_dictionary_owner_soft (line));
+        dxf_free (dxf_3dline_get_material (line));
+        dxf_free (dxf_3dline_get_dictionary_owner_hard (line));
+        dxf_free (dxf_3dline_get_plot_style_name (line));
+        dxf_free (dxf_3dline_get_color_name (line));
         dxf_point_free (dxf_3dline_get_p0 (line));
         dxf_point_free (dxf_3dline_get_p1 (line));
-        free (line);
+        dxf_free (line);
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -738,12 +746,12 @@ dxf_3dline_free_chain
                 /*!< a pointer to the chain of DXF 3DLINE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (lines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
@@ -777,14 +785,14 @@ dxf_3dline_get_id_code
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -816,14 +824,14 @@ dxf_3dline_set_id_code
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -854,14 +862,14 @@ dxf_3dline_get_linetype
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -869,7 +877,7 @@ dxf_3dline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->linetype));
+        return (dxf_strdup (line->linetype));
 }
 
 
@@ -891,19 +899,19 @@ dxf_3dline_set_linetype
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->linetype = strdup (linetype);
+        line->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -929,14 +937,14 @@ dxf_3dline_get_layer
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -944,7 +952,7 @@ dxf_3dline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->layer));
+        return (dxf_strdup (line->layer));
 }
 
 
@@ -966,19 +974,19 @@ dxf_3dline_set_layer
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->layer = strdup (layer);
+        line->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1004,7 +1012,7 @@ dxf_3dline_get_elevation
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1034,7 +1042,7 @@ dxf_3dline_set_elevation
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1065,14 +1073,14 @@ dxf_3dline_get_thickness
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1102,14 +1110,14 @@ dxf_3dline_set_thickness
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1143,14 +1151,14 @@ dxf_3dline_get_linetype_scale
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1183,14 +1191,14 @@ dxf_3dline_set_linetype_scale
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1224,21 +1232,21 @@ dxf_3dline_get_visibility
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1271,21 +1279,21 @@ dxf_3dline_set_visibility
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1316,14 +1324,14 @@ dxf_3dline_get_color
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1352,14 +1360,14 @@ dxf_3dline_set_color
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1389,20 +1397,20 @@ dxf_3dline_get_paperspace
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (line->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found.\n")),
                   __FUNCTION__);
         }
@@ -1434,21 +1442,21 @@ dxf_3dline_set_paperspace
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1481,20 +1489,20 @@ dxf_3dline_get_graphics_data_size
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (line->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found.\n")),
                   __FUNCTION__);
         }
@@ -1528,21 +1536,21 @@ dxf_3dline_set_graphics_data_size
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a zero value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1574,21 +1582,21 @@ dxf_3dline_get_shadow_mode
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1621,21 +1629,21 @@ dxf_3dline_set_shadow_mode
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1669,14 +1677,14 @@ dxf_3dline_get_binary_graphics_data
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1711,14 +1719,14 @@ dxf_3dline_set_binary_graphics_data
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1752,14 +1760,14 @@ dxf_3dline_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1767,7 +1775,7 @@ dxf_3dline_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_soft));
+        return (dxf_strdup (line->dictionary_owner_soft));
 }
 
 
@@ -1791,19 +1799,19 @@ dxf_3dline_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        line->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1832,14 +1840,14 @@ dxf_3dline_get_material
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1847,7 +1855,7 @@ dxf_3dline_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->material));
+        return (dxf_strdup (line->material));
 }
 
 
@@ -1873,19 +1881,19 @@ dxf_3dline_set_material
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->material = strdup (material);
+        line->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1914,14 +1922,14 @@ dxf_3dline_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1929,7 +1937,7 @@ dxf_3dline_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_hard));
+        return (dxf_strdup (line->dictionary_owner_hard));
 }
 
 
@@ -1953,19 +1961,19 @@ dxf_3dline_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        line->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1992,7 +2000,7 @@ dxf_3dline_get_lineweight
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2025,7 +2033,7 @@ dxf_3dline_set_lineweight
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2057,14 +2065,14 @@ dxf_3dline_get_plot_style_name
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2072,7 +2080,7 @@ dxf_3dline_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->plot_style_name));
+        return (dxf_strdup (line->plot_style_name));
 }
 
 
@@ -2098,19 +2106,19 @@ dxf_3dline_set_plot_style_name
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->plot_style_name = strdup (plot_style_name);
+        line->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2137,7 +2145,7 @@ dxf_3dline_get_color_value
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2170,7 +2178,7 @@ dxf_3dline_set_color_value
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2202,14 +2210,14 @@ dxf_3dline_get_color_name
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2217,7 +2225,7 @@ dxf_3dline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->color_name));
+        return (dxf_strdup (line->color_name));
 }
 
 
@@ -2243,19 +2251,19 @@ dxf_3dline_set_color_name
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->color_name = strdup (color_name);
+        line->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2282,7 +2290,7 @@ dxf_3dline_get_transparency
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2315,7 +2323,7 @@ dxf_3dline_set_transparency
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2340,20 +2348,20 @@ dxf_3dline_get_p0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2379,20 +2387,20 @@ dxf_3dline_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2417,21 +2425,21 @@ dxf_3dline_get_x0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2458,20 +2466,20 @@ dxf_3dline_set_x0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2496,21 +2504,21 @@ dxf_3dline_get_y0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2537,20 +2545,20 @@ dxf_3dline_set_y0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2575,21 +2583,21 @@ dxf_3dline_get_z0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2616,20 +2624,20 @@ dxf_3dline_set_z0
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2654,20 +2662,20 @@ dxf_3dline_get_p1
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2676,7 +2684,7 @@ dxf_3dline_get_p1
           && (line->p0->y0 == line->p1->y0)
           && (line->p0->z0 == line->p1->z0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a 3DLINE with points with identical coordinates were passed.\n")),
                   __FUNCTION__);
         }
@@ -2701,20 +2709,20 @@ dxf_3dline_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2739,21 +2747,21 @@ dxf_3dline_get_x1
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2780,20 +2788,20 @@ dxf_3dline_set_x1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2818,21 +2826,21 @@ dxf_3dline_get_y1
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2859,20 +2867,20 @@ dxf_3dline_set_y1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2897,21 +2905,21 @@ dxf_3dline_get_z1
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2938,20 +2946,20 @@ dxf_3dline_set_z1
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2977,14 +2985,14 @@ dxf_3dline_get_extr_x0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3013,13 +3021,13 @@ dxf_3dline_set_extr_x0
                  * \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3045,14 +3053,14 @@ dxf_3dline_get_extr_y0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3081,13 +3089,13 @@ dxf_3dline_set_extr_y0
                  * \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3113,14 +3121,14 @@ dxf_3dline_get_extr_z0
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3149,13 +3157,13 @@ dxf_3dline_set_extr_z0
                  * \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3183,7 +3191,7 @@ dxf_3dline_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3191,7 +3199,7 @@ dxf_3dline_get_extrusion_vector_as_point
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3200,7 +3208,7 @@ dxf_3dline_get_extrusion_vector_as_point
           && (line->p0->y0 == line->p1->y0)
           && (line->p0->z0 == line->p1->z0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a 3DLINE with points with identical coordinates were passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3208,7 +3216,7 @@ dxf_3dline_get_extrusion_vector_as_point
         point = dxf_point_init (point);
         if (point == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -3242,14 +3250,14 @@ dxf_3dline_set_extrusion_vector_from_point
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3286,7 +3294,7 @@ dxf_3dline_set_extrusion_vector
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3325,7 +3333,7 @@ dxf_3dline_get_mid_point
                  */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3333,7 +3341,7 @@ dxf_3dline_get_mid_point
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3342,7 +3350,7 @@ dxf_3dline_get_mid_point
           && (line->p0->y0 == line->p1->y0)
           && (line->p0->z0 == line->p1->z0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a 3DLINE with points with identical coordinates were passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3350,14 +3358,14 @@ dxf_3dline_get_mid_point
         point = dxf_point_init (point);
         if (point == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         if (id_code < 0)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                 __FUNCTION__);
         }
@@ -3373,11 +3381,11 @@ dxf_3dline_get_mid_point
                 case 1:
                         if (line->linetype != NULL)
                         {
-                                point->linetype = strdup (line->linetype);
+                                point->linetype = dxf_strdup (line->linetype);
                         }
                         if (line->layer != NULL)
                         {
-                                point->layer = strdup (line->layer);
+                                point->layer = dxf_strdup (line->layer);
                         }
                         point->thickness = line->thickness;
                         point->linetype_scale = line->linetype_scale;
@@ -3386,18 +3394,18 @@ dxf_3dline_get_mid_point
                         point->paperspace = line->paperspace;
                         if (line->dictionary_owner_soft != NULL)
                         {
-                                point->dictionary_owner_soft = strdup (line->dictionary_owner_soft);
+                                point->dictionary_owner_soft = dxf_strdup (line->dictionary_owner_soft);
                         }
                         if (line->dictionary_owner_hard != NULL)
                         {
-                                point->dictionary_owner_hard = strdup (line->dictionary_owner_hard);
+                                point->dictionary_owner_hard = dxf_strdup (line->dictionary_owner_hard);
                         }
                         break;
                 default:
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s (): unknown inheritance option passed.\n")),
                           __FUNCTION__);
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                           (_("\tResolving to default.\n")));
                         break;
         }
@@ -3421,13 +3429,13 @@ dxf_3dline_get_length
                 /*!< a pointer to a DXF \c 3DLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (0.0);
@@ -3436,7 +3444,7 @@ dxf_3dline_get_length
           && (line->p0->y0 == line->p1->y0)
           && (line->p0->z0 == line->p1->z0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () endpoints with identical coordinates were passed.\n")),
                   __FUNCTION__);
                 return (0.0);
@@ -3491,21 +3499,21 @@ dxf_3dline_create_from_points
         /* Do some basic checks. */
         if ((p0 == NULL) || (p1 == NULL))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if ((p0->x0 == p1->x0) && (p0->y0 == p1->y0) && (p0->z0 == p1->z0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () points with identical coordinates were passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if ((inheritance < 0) || (inheritance > 2))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an illegal inherit value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3513,14 +3521,14 @@ dxf_3dline_create_from_points
         line = dxf_3dline_init (line);
         if (line == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         if (id_code < 0)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                 __FUNCTION__);
         }
@@ -3552,11 +3560,11 @@ dxf_3dline_create_from_points
                         line->paperspace = p0->paperspace;
                         if (p0->dictionary_owner_soft != NULL)
                         {
-                                line->dictionary_owner_soft = strdup (p0->dictionary_owner_soft);
+                                line->dictionary_owner_soft = dxf_strdup (p0->dictionary_owner_soft);
                         }
                         if (p0->dictionary_owner_hard != NULL)
                         {
-                                line->dictionary_owner_hard = strdup (p0->dictionary_owner_hard);
+                                line->dictionary_owner_hard = dxf_strdup (p0->dictionary_owner_hard);
                         }
                         break;
                 case 2:
@@ -3575,18 +3583,18 @@ dxf_3dline_create_from_points
                         line->paperspace = p1->paperspace;
                         if (p1->dictionary_owner_soft != NULL)
                         {
-                                line->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
+                                line->dictionary_owner_soft = dxf_strdup (p1->dictionary_owner_soft);
                         }
                         if (p1->dictionary_owner_hard != NULL)
                         {
-                                line->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
+                                line->dictionary_owner_hard = dxf_strdup (p1->dictionary_owner_hard);
                         }
                         break;
                 default:
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s (): unknown inheritance option passed.\n")),
                           __FUNCTION__);
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                           (_("\tResolving to default.\n")));
                         break;
         }
@@ -3618,14 +3626,14 @@ dxf_3dline_get_next
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3656,14 +3664,14 @@ dxf_3dline_set_next
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3697,14 +3705,14 @@ dxf_3dline_get_last
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((Dxf3dline *) line);
@@ -49,6 +49,7 @@
 
 
 #include "3dsolid.h"
+#include "util.h"
 
 
 /*!
@@ -68,9 +69,9 @@ dxf_3dsolid_new ()
         size = sizeof (Dxf3dsolid);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((solid = malloc (size)) == NULL)
+        if ((solid = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -78,6 +79,7 @@ dxf_3dsolid_new ()
         else
         {
                 memset (solid, 0, size);
+                solid->header.type = DSOLID;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -106,21 +108,21 @@ dxf_3dsolid_init
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 solid = dxf_3dsolid_new ();
         }
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_3dsolid_set_id_code (solid, 0);
-        dxf_3dsolid_set_linetype (solid, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_3dsolid_set_layer (solid, strdup (DXF_DEFAULT_LAYER));
+        dxf_3dsolid_set_linetype (solid, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_3dsolid_set_layer (solid, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_3dsolid_set_elevation (solid, 0.0);
         dxf_3dsolid_set_thickness (solid, 0.0);
         dxf_3dsolid_set_linetype_scale (solid, DXF_DEFAULT_LINETYPE_SCALE);
@@ -131,18 +133,18 @@ dxf_3dsolid_init
         dxf_3dsolid_set_shadow_mode (solid, 0);
         dxf_3dsolid_set_binary_graphics_data (solid, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_3dsolid_get_binary_graphics_data (solid));
-        dxf_3dsolid_set_dictionary_owner_soft (solid, strdup (""));
-        dxf_3dsolid_set_material (solid, strdup (""));
-        dxf_3dsolid_set_dictionary_owner_hard (solid, strdup (""));
+        dxf_3dsolid_set_dictionary_owner_soft (solid, dxf_strdup (""));
+        dxf_3dsolid_set_material (solid, dxf_strdup (""));
+        dxf_3dsolid_set_dictionary_owner_hard (solid, dxf_strdup (""));
         dxf_3dsolid_set_lineweight (solid, 0);
-        dxf_3dsolid_set_plot_style_name (solid, strdup (""));
+        dxf_3dsolid_set_plot_style_name (solid, dxf_strdup (""));
         dxf_3dsolid_set_color_value (solid, 0);
-        dxf_3dsolid_set_color_name (solid, strdup (""));
+        dxf_3dsolid_set_color_name (solid, dxf_strdup (""));
         dxf_3dsolid_set_transparency (solid, 0);
         dxf_3dsolid_set_proprietary_data (solid, (DxfProprietaryData *) dxf_proprietary_data_init (solid->proprietary_data));
         dxf_3dsolid_set_additional_proprietary_data (solid, (DxfProprietaryData *) dxf_proprietary_data_init (solid->additional_proprietary_data));
         dxf_3dsolid_set_modeler_format_version_number (solid, 1);
-        dxf_3dsolid_set_history (solid, strdup (""));
+        dxf_3dsolid_set_history (solid, dxf_strdup (""));
         dxf_3dsolid_set_next (solid, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -174,73 +176,90 @@ dxf_3dsolid_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
+        DxfProprietaryData *proprietary_data = NULL;
+        DxfProprietaryData *additional_proprietary_data = NULL;
+        DxfBinaryGraphicsData *binary_graphics_data = NULL;
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 solid = dxf_3dsolid_new ();
                 solid = dxf_3dsolid_init (solid);
         }
+        if (solid->proprietary_data == NULL)
+        {
+                solid->proprietary_data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+        }
+        if (solid->additional_proprietary_data == NULL)
+        {
+                solid->additional_proprietary_data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+        }
+        proprietary_data = solid->proprietary_data;
+        additional_proprietary_data = solid->additional_proprietary_data;
         i = 1;
-        solid->proprietary_data->order = 0;
-        solid->additional_proprietary_data->order = 0;
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (DSOLID, fp);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
+                else if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing proprietary
                          * data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->proprietary_data->line);
-                        solid->proprietary_data->order = i;
-                        i++;
-                        dxf_proprietary_data_init ((DxfProprietaryData *) solid->proprietary_data->next);
-                        solid->proprietary_data = (DxfProprietaryData *) solid->proprietary_data->next;
+                        if (fp->lazy_proprietary_data)
+                        {
+                                dxf_proprietary_data_range_skip (fp, &solid->proprietary_data_range, 1);
+                        }
+                        else
+                        {
+                                proprietary_data = dxf_proprietary_data_read_line (fp, proprietary_data, i);
+                                i++;
+                        }
                 }
-                else if (strcmp (temp_string, "  3") == 0)
+                else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing additional
                          * proprietary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->additional_proprietary_data->line);
-                        solid->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_proprietary_data_init ((DxfProprietaryData *) solid->additional_proprietary_data->next);
-                        solid->additional_proprietary_data = (DxfProprietaryData *) solid->additional_proprietary_data->next;
+                        if (fp->lazy_proprietary_data)
+                        {
+                                dxf_proprietary_data_range_skip (fp, &solid->proprietary_data_range, 3);
+                        }
+                        else
+                        {
+                                additional_proprietary_data = dxf_proprietary_data_read_line (fp, additional_proprietary_data, i);
+                                i++;
+                        }
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -252,13 +271,13 @@ dxf_3dsolid_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->linetype);
+                        dxf_read_string (fp, &solid->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->layer);
+                        dxf_read_string (fp, &solid->layer);
                 }
                 else if (strcmp (temp_string, "38") == 0)
                 {
@@ -324,7 +343,7 @@ dxf_3dsolid_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -337,7 +356,7 @@ dxf_3dsolid_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDb3dSolid") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -359,39 +378,51 @@ dxf_3dsolid_read
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
-                         * graphics data. */
+                         * graphics data, append it to the chain. */
+                        if (binary_graphics_data == NULL)
+                        {
+                                if (solid->binary_graphics_data == NULL)
+                                {
+                                        solid->binary_graphics_data = dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+                                }
+                                binary_graphics_data = solid->binary_graphics_data;
+                        }
+                        else
+                        {
+                                binary_graphics_data->next = (struct DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+                                binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
+                        }
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) solid->binary_graphics_data->next);
-                        solid->binary_graphics_data = (DxfBinaryGraphicsData *) solid->binary_graphics_data->next;
+                        dxf_read_string (fp, &binary_graphics_data->data_line);
+                        binary_graphics_data->length = strlen (binary_graphics_data->data_line);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->dictionary_owner_soft);
+                        dxf_read_string (fp, &solid->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->material);
+                        dxf_read_string (fp, &solid->material);
                 }
                 else if (strcmp (temp_string, "350") == 0)
                 {
                         /* Now follows a string containing a handle to a
                          * history object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->history);
+                        dxf_read_string (fp, &solid->history);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->dictionary_owner_hard);
+                        dxf_read_string (fp, &solid->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -405,7 +436,7 @@ dxf_3dsolid_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->plot_style_name);
+                        dxf_read_string (fp, &solid->plot_style_name);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -418,7 +449,7 @@ dxf_3dsolid_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->color_name);
+                        dxf_read_string (fp, &solid->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -436,22 +467,27 @@ dxf_3dsolid_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (solid->linetype, "") == 0)
         {
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_string_assign (&solid->linetype, DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (solid->layer, "") == 0)
         {
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_string_assign (&solid->layer, DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
+        DXF_TRACING_ENTITY_END (DSOLID, fp, trace_offset);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -477,58 +513,54 @@ dxf_3dsolid_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("3DSOLID");
-        DxfProprietaryData *iter = NULL;
-        DxfProprietaryData *additional_iter = NULL;
-        int i;
+        char *dxf_entity_name = dxf_strdup ("3DSOLID");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_3dsolid_get_id_code (solid));
         }
         if (strcmp (dxf_3dsolid_get_linetype (solid), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_3dsolid_get_id_code (solid));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_3dsolid_set_linetype (solid, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_3dsolid_set_linetype (solid, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_3dsolid_get_layer (solid), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_3dsolid_get_id_code (solid));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                dxf_3dsolid_set_layer (solid, (strdup (DXF_DEFAULT_LAYER)));
+                dxf_3dsolid_set_layer (solid, (dxf_strdup (DXF_DEFAULT_LAYER)));
         }
         /* Start writing output. */
-        i = 1;
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
         if (dxf_3dsolid_get_id_code (solid) != -1)
         {
@@ -588,15 +620,15 @@ dxf_3dsolid_write
           && DXF_FLATLAND
           && (dxf_3dsolid_get_elevation (solid) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_3dsolid_get_elevation (solid));
+                dxf_write_real (fp, 38, dxf_3dsolid_get_elevation (solid));
         }
         if (dxf_3dsolid_get_thickness (solid) != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_3dsolid_get_thickness (solid));
+                dxf_write_real (fp, 39, dxf_3dsolid_get_thickness (solid));
         }
         if (dxf_3dsolid_get_linetype_scale (solid) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_3dsolid_get_linetype_scale (solid));
+                dxf_write_real (fp, 48, dxf_3dsolid_get_linetype_scale (solid));
         }
         if (dxf_3dsolid_get_visibility (solid) != 0)
         {
@@ -639,29 +671,15 @@ dxf_3dsolid_write
         {
                 fprintf (fp->fp, " 70\n%d\n", dxf_3dsolid_get_modeler_format_version_number (solid));
         }
-        iter = (DxfProprietaryData *) dxf_3dsolid_get_proprietary_data (solid);
-        additional_iter = (DxfProprietaryData *) dxf_3dsolid_get_additional_proprietary_data (solid);
-        while ((iter != NULL) || (additional_iter != NULL))
-        {
-                if (iter->order == i)
-                {
-                        fprintf (fp->fp, "  1\n%s\n", dxf_proprietary_data_get_line (iter));
-                        iter = (DxfProprietaryData *) dxf_proprietary_data_get_next (iter);
-                        i++;
-                }
-                if (additional_iter->order == i)
-                {
-                        fprintf (fp->fp, "  3\n%s\n", dxf_proprietary_data_get_line (additional_iter));
-                        additional_iter = (DxfProprietaryData *) dxf_proprietary_data_get_next (additional_iter);
-                        i++;
-                }
-        }
+        dxf_proprietary_data_write_chains (fp,
+          dxf_3dsolid_get_proprietary_data (solid),
+          dxf_3dsolid_get_additional_proprietary_data (solid));
         if (fp->acad_version_number >= AutoCAD_2008)
         {
                 fprintf (fp->fp, "350\n%s\n", dxf_3dsolid_get_history (solid));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -690,23 +708,29 @@ dxf_3dsolid_free
         /* Do some basic checks. */
         if (solid->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_3dsolid_get_linetype (solid));
-        free (dxf_3dsolid_get_layer (solid));
+        dxf_free (dxf_3dsolid_get_linetype (solid));
+        dxf_free (dxf_3dsolid_get_layer (solid));
         dxf_binary_graphics_data_free_chain (dxf_3dsolid_get_binary_graphics_data (solid));
-        free (dxf_3dsolid_get_dictionary_owner_soft (solid));
-        free (dxf_3dsolid_get_material (solid));
-        free (dxf_3dsolid_get_dictionary_owner_hard (solid));
-        free (dxf_3dsolid_get_plot_style_name (solid));
-        free (dxf_3dsolid_get_color_name (solid));
-        dxf_proprietary_data_free_chain (dxf_3dsolid_get_proprietary_data (solid));
-        dxf_proprietary_data_free_chain (dxf_3dsolid_get_additional_proprietary_data (solid));
-        free (dxf_3dsolid_get_history (solid));
-        free (solid);
+        dxf_free (dxf_3dsolid_get_dictionary_owner_soft (solid));
+        dxf_free (dxf_3dsolid_get_material (solid));
+        dxf_free (dxf_3dsolid_get_dictionary_owner_hard (solid));
+        dxf_free (dxf_3dsolid_get_plot_style_name (solid));
+        dxf_free (dxf_3dsolid_get_color_name (solid));
+        /* Do not use the getters here, they would load proprietary
+         * data which is only located. */
+        dxf_proprietary_data_free_chain (solid->proprietary_data);
+        dxf_proprietary_data_free_chain (solid->additional_proprietary_data);
+        if (solid->proprietary_data_range != NULL)
+        {
+                dxf_proprietary_data_range_free (solid->proprietary_data_range);
+        }
+        dxf_free (dxf_3dsolid_get_history (solid));
+        dxf_free (solid);
         solid = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -726,18 +750,19 @@ dxf_3dsolid_free_chain
                 /*!< a pointer to the chain of DXF \c 3DSOLID entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (solids == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (solids != NULL)
         {
                 struct Dxf3dsolid *iter = solids->next;
+                solids->next = NULL;
                 dxf_3dsolid_free (solids);
                 solids = (Dxf3dsolid *) iter;
         }
@@ -765,14 +790,14 @@ dxf_3dsolid_get_id_code
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -804,14 +829,14 @@ dxf_3dsolid_set_id_code
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -842,14 +867,14 @@ dxf_3dsolid_get_linetype
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -857,7 +882,7 @@ dxf_3dsolid_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->linetype));
+        return (dxf_strdup (solid->linetype));
 }
 
 
@@ -879,19 +904,19 @@ dxf_3dsolid_set_linetype
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->linetype = strdup (linetype);
+        solid->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -917,14 +942,14 @@ dxf_3dsolid_get_layer
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -932,7 +957,7 @@ dxf_3dsolid_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->layer));
+        return (dxf_strdup (solid->layer));
 }
 
 
@@ -954,19 +979,19 @@ dxf_3dsolid_set_layer
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->layer = strdup (layer);
+        solid->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -992,7 +1017,7 @@ dxf_3dsolid_get_elevation
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1022,7 +1047,7 @@ dxf_3dsolid_set_elevation
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1053,14 +1078,14 @@ dxf_3dsolid_get_thickness
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1090,14 +1115,14 @@ dxf_3dsolid_set_thickness
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1128,14 +1153,14 @@ dxf_3dsolid_get_linetype_scale
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1165,14 +1190,14 @@ dxf_3dsolid_set_linetype_scale
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1203,21 +1228,21 @@ dxf_3dsolid_get_visibility
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1247,21 +1272,21 @@ dxf_3dsolid_set_visibility
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1292,14 +1317,14 @@ dxf_3dsolid_get_color
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1328,14 +1353,14 @@ dxf_3dsolid_set_color
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negativevalue was passed.\n")),
                   __FUNCTION__);
         }
@@ -1365,20 +1390,20 @@ dxf_3dsolid_get_paperspace
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (solid->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found.\n")),
                   __FUNCTION__);
         }
@@ -1407,21 +1432,21 @@ dxf_3dsolid_set_paperspace
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1453,20 +1478,20 @@ dxf_3dsolid_get_graphics_data_size
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (solid->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found.\n")),
                   __FUNCTION__);
         }
@@ -1499,21 +1524,21 @@ dxf_3dsolid_set_graphics_data_size
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a zero value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1545,21 +1570,21 @@ dxf_3dsolid_get_shadow_mode
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1592,21 +1617,21 @@ dxf_3dsolid_set_shadow_mode
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1640,14 +1665,14 @@ dxf_3dsolid_get_binary_graphics_data
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1682,14 +1707,14 @@ dxf_3dsolid_set_binary_graphics_data
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1723,14 +1748,14 @@ dxf_3dsolid_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1738,7 +1763,7 @@ dxf_3dsolid_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->dictionary_owner_soft));
+        return (dxf_strdup (solid->dictionary_owner_soft));
 }
 
 
@@ -1762,19 +1787,19 @@ dxf_3dsolid_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        solid->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1804,14 +1829,14 @@ dxf_3dsolid_get_material
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1819,7 +1844,7 @@ dxf_3dsolid_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->material));
+        return (dxf_strdup (solid->material));
 }
 
 
@@ -1845,19 +1870,19 @@ dxf_3dsolid_set_material
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->material = strdup (material);
+        solid->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1886,14 +1911,14 @@ dxf_3dsolid_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1901,7 +1926,7 @@ dxf_3dsolid_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->dictionary_owner_hard));
+        return (dxf_strdup (solid->dictionary_owner_hard));
 }
 
 
@@ -1925,19 +1950,19 @@ dxf_3dsolid_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        solid->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1964,7 +1989,7 @@ dxf_3dsolid_get_lineweight
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1997,7 +2022,7 @@ dxf_3dsolid_set_lineweight
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2029,14 +2054,14 @@ dxf_3dsolid_get_plot_style_name
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2044,7 +2069,7 @@ dxf_3dsolid_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->plot_style_name));
+        return (dxf_strdup (solid->plot_style_name));
 }
 
 
@@ -2070,19 +2095,19 @@ dxf_3dsolid_set_plot_style_name
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->plot_style_name = strdup (plot_style_name);
+        solid->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2109,7 +2134,7 @@ dxf_3dsolid_get_color_value
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2142,7 +2167,7 @@ dxf_3dsolid_set_color_value
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2174,14 +2199,14 @@ dxf_3dsolid_get_color_name
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2189,7 +2214,7 @@ dxf_3dsolid_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->color_name));
+        return (dxf_strdup (solid->color_name));
 }
 
 
@@ -2215,19 +2240,19 @@ dxf_3dsolid_set_color_name
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->color_name = strdup (color_name);
+        solid->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2254,7 +2279,7 @@ dxf_3dsolid_get_transparency
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2287,7 +2312,7 @@ dxf_3dsolid_set_transparency
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2300,6 +2325,30 @@ dxf_3dsolid_set_transparency
 }
 
 
+/*!
+ * \brief Load the proprietary data of a DXF \c 3DSOLID entity from the
+ * file it was read from, when only its location was recorded.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_3dsolid_load_proprietary_data
+(
+        Dxf3dsolid *solid
+                /*!< a pointer to a DXF \c 3DSOLID entity. */
+)
+{
+        int status;
+
+        status = dxf_proprietary_data_range_load (solid->proprietary_data_range,
+          &solid->proprietary_data, &solid->additional_proprietary_data);
+        dxf_proprietary_data_range_free (solid->proprietary_data_range);
+        solid->proprietary_data_range = NULL;
+        return (status);
+}
+
+
 /*!
  * \brief Get the pointer to the \c proprietary_data from a DXF 
  * \c 3DSOLID entity.
@@ -2321,14 +2370,18 @@ dxf_3dsolid_get_proprietary_data
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        if (solid->proprietary_data_range != NULL)
+        {
+                dxf_3dsolid_load_proprietary_data (solid);
+        }
         if (solid->proprietary_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2358,18 +2411,22 @@ dxf_3dsolid_set_proprietary_data
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (proprietary_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        if (solid->proprietary_data_range != NULL)
+        {
+                dxf_3dsolid_load_proprietary_data (solid);
+        }
         solid->proprietary_data = proprietary_data;
 #if DEBUG
         DXF_DEBUG_END
@@ -2399,14 +2456,18 @@ dxf_3dsolid_get_additional_proprietary_data
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        if (solid->proprietary_data_range != NULL)
+        {
+                dxf_3dsolid_load_proprietary_data (solid);
+        }
         if (solid->additional_proprietary_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2437,18 +2498,22 @@ dxf_3dsolid_set_additional_proprietary_data
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (additional_proprietary_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        if (solid->proprietary_data_range != NULL)
+        {
+                dxf_3dsolid_load_proprietary_data (solid);
+        }
         solid->additional_proprietary_data = additional_proprietary_data;
 #if DEBUG
         DXF_DEBUG_END
@@ -2476,20 +2541,20 @@ dxf_3dsolid_get_modeler_format_version_number
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (solid->modeler_format_version_number < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (solid->modeler_format_version_number > DXF_MODELER_FORMAT_CURRENT_VERSION)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found.\n")),
                   __FUNCTION__);
         }
@@ -2520,21 +2585,21 @@ dxf_3dsolid_set_modeler_format_version_number
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (modeler_format_version_number < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (modeler_format_version_number > DXF_MODELER_FORMAT_CURRENT_VERSION)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2567,14 +2632,14 @@ dxf_3dsolid_get_history
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid->history ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2582,7 +2647,7 @@ dxf_3dsolid_get_history
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (solid->history));
+        return (dxf_strdup (solid->history));
 }
 
 
@@ -2604,19 +2669,19 @@ dxf_3dsolid_set_history
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (history == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        solid->history = strdup (history);
+        solid->history = dxf_strdup (history);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2645,14 +2710,14 @@ dxf_3dsolid_get_next
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2683,14 +2748,14 @@ dxf_3dsolid_set_next
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2724,14 +2789,14 @@ dxf_3dsolid_get_last
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((Dxf3dsolid *) solid);
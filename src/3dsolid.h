@@ -61,6 +61,9 @@ extern "C" {
 typedef struct
 dxf_3dsolid_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -195,6 +198,10 @@ dxf_3dsolid_struct
                  * group 1 string is greater than 255 characters
                  * (optional).\n
                  * Group code = 3. */
+        DxfProprietaryDataRange *proprietary_data_range;
+                /*!< Location of the proprietary data in the file it was
+                 * read from, when only the location was recorded.\n
+                 * \c NULL when the proprietary data is loaded. */
         int modeler_format_version_number;
                 /*!< Modeler format version number (currently = 1).\n
                  * Group code = 70. */
@@ -53,6 +53,7 @@
 
 
 #include "acad_proxy_entity.h"
+#include "util.h"
 
 
 /*!
@@ -75,9 +76,9 @@ dxf_acad_proxy_entity_new ()
         size = sizeof (DxfAcadProxyEntity);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((acad_proxy_entity = malloc (size)) == NULL)
+        if ((acad_proxy_entity = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfAcadProxyEntity struct.\n")),
                   __FUNCTION__);
                 acad_proxy_entity = NULL;
@@ -85,6 +86,7 @@ dxf_acad_proxy_entity_new ()
         else
         {
                 memset (acad_proxy_entity, 0, size);
+                acad_proxy_entity->header.type = ACADPROXYENTITY;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -113,21 +115,21 @@ dxf_acad_proxy_entity_init
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 acad_proxy_entity = dxf_acad_proxy_entity_new ();
         }
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfAcadProxyEntity struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_acad_proxy_entity_set_id_code (acad_proxy_entity, 0);
-        dxf_acad_proxy_entity_set_linetype (acad_proxy_entity, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_acad_proxy_entity_set_layer (acad_proxy_entity, strdup (DXF_DEFAULT_LAYER));
+        dxf_acad_proxy_entity_set_linetype (acad_proxy_entity, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_acad_proxy_entity_set_layer (acad_proxy_entity, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_acad_proxy_entity_set_elevation (acad_proxy_entity, 0.0);
         dxf_acad_proxy_entity_set_thickness (acad_proxy_entity, 0.0);
         dxf_acad_proxy_entity_set_linetype_scale (acad_proxy_entity, DXF_DEFAULT_LINETYPE_SCALE);
@@ -135,13 +137,13 @@ dxf_acad_proxy_entity_init
         dxf_acad_proxy_entity_set_color (acad_proxy_entity, DXF_COLOR_BYLAYER);
         dxf_acad_proxy_entity_set_paperspace (acad_proxy_entity, DXF_PAPERSPACE);
         dxf_acad_proxy_entity_set_shadow_mode (acad_proxy_entity, 0);
-        dxf_acad_proxy_entity_set_dictionary_owner_soft (acad_proxy_entity, strdup (""));
-        dxf_acad_proxy_entity_set_material (acad_proxy_entity, strdup (""));
-        dxf_acad_proxy_entity_set_dictionary_owner_hard (acad_proxy_entity, strdup (""));
+        dxf_acad_proxy_entity_set_dictionary_owner_soft (acad_proxy_entity, dxf_strdup (""));
+        dxf_acad_proxy_entity_set_material (acad_proxy_entity, dxf_strdup (""));
+        dxf_acad_proxy_entity_set_dictionary_owner_hard (acad_proxy_entity, dxf_strdup (""));
         dxf_acad_proxy_entity_set_lineweight (acad_proxy_entity, 0);
-        dxf_acad_proxy_entity_set_plot_style_name (acad_proxy_entity, strdup (""));
+        dxf_acad_proxy_entity_set_plot_style_name (acad_proxy_entity, dxf_strdup (""));
         dxf_acad_proxy_entity_set_color_value (acad_proxy_entity, 0);
-        dxf_acad_proxy_entity_set_color_name (acad_proxy_entity, strdup (""));
+        dxf_acad_proxy_entity_set_color_name (acad_proxy_entity, dxf_strdup (""));
         dxf_acad_proxy_entity_set_transparency (acad_proxy_entity, 0);
         dxf_acad_proxy_entity_set_original_custom_object_data_format (acad_proxy_entity, 1);
         dxf_acad_proxy_entity_set_proxy_entity_class_id (acad_proxy_entity, DXF_DEFAULT_PROXY_ENTITY_ID);
@@ -153,8 +155,10 @@ dxf_acad_proxy_entity_init
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_acad_proxy_entity_get_binary_graphics_data (acad_proxy_entity));
         dxf_acad_proxy_entity_set_binary_entity_data (acad_proxy_entity, (DxfBinaryEntityData *) dxf_binary_entity_data_new ());
         dxf_binary_entity_data_init (dxf_acad_proxy_entity_get_binary_entity_data (acad_proxy_entity));
+        acad_proxy_entity->graphics_data = dxf_binary_data_new ();
+        acad_proxy_entity->entity_data = dxf_binary_data_new ();
         dxf_acad_proxy_entity_set_object_id (acad_proxy_entity, (DxfObjectId *) dxf_object_id_new ());
-        dxf_object_id_set_data (dxf_acad_proxy_entity_get_object_id (acad_proxy_entity), strdup (""));
+        dxf_object_id_set_data (dxf_acad_proxy_entity_get_object_id (acad_proxy_entity), dxf_strdup (""));
         dxf_acad_proxy_entity_set_next (acad_proxy_entity, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -187,46 +191,57 @@ dxf_acad_proxy_entity_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i; /* flags whether group code 330, 340, 350 or 360 has been
                 * parsed for a first time. */
+        DxfBinaryData *binary_data = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (!acad_proxy_entity)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 acad_proxy_entity = dxf_acad_proxy_entity_new ();
                 acad_proxy_entity = dxf_acad_proxy_entity_init (acad_proxy_entity);
         }
+        if (acad_proxy_entity->graphics_data == NULL)
+        {
+                acad_proxy_entity->graphics_data = dxf_binary_data_new ();
+        }
+        if (acad_proxy_entity->entity_data == NULL)
+        {
+                acad_proxy_entity->entity_data = dxf_binary_data_new ();
+        }
+        dxf_binary_data_clear (acad_proxy_entity->graphics_data);
+        dxf_binary_data_clear (acad_proxy_entity->entity_data);
+        /* Binary chunks belong to the graphics data until the entity
+         * data size is found. */
+        binary_data = acad_proxy_entity->graphics_data;
         i = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -242,14 +257,14 @@ dxf_acad_proxy_entity_read
                         /* Now follows a string containing the linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", acad_proxy_entity->linetype);
+                        dxf_read_string (fp, &acad_proxy_entity->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing the layer
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", acad_proxy_entity->layer);
+                        dxf_read_string (fp, &acad_proxy_entity->layer);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                   && DXF_FLATLAND
@@ -298,7 +313,7 @@ dxf_acad_proxy_entity_read
                         fscanf (fp->fp, "%d\n", &acad_proxy_entity->original_custom_object_data_format);
                         if (acad_proxy_entity->original_custom_object_data_format != 1)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () found a bad original custom object data format value in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -311,7 +326,7 @@ dxf_acad_proxy_entity_read
                         fscanf (fp->fp, "%d\n", &acad_proxy_entity->proxy_entity_class_id);
                         if (acad_proxy_entity->proxy_entity_class_id != DXF_DEFAULT_PROXY_ENTITY_ID)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad proxy entity class ID in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -324,7 +339,7 @@ dxf_acad_proxy_entity_read
                         fscanf (fp->fp, "%d\n", &acad_proxy_entity->application_entity_class_id);
                         if (acad_proxy_entity->application_entity_class_id < 500)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad value in application entity class ID in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -341,7 +356,8 @@ dxf_acad_proxy_entity_read
                         /* Now follows a string containing the entity
                          * data size value (bits). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &acad_proxy_entity->graphics_data_size);
+                        fscanf (fp->fp, "%d\n", &acad_proxy_entity->entity_data_size);
+                        binary_data = acad_proxy_entity->entity_data;
                 }
                 else if ((fp->acad_version_number >= AutoCAD_2000)
                   && (strcmp (temp_string, "95") == 0))
@@ -362,7 +378,7 @@ dxf_acad_proxy_entity_read
                           && ((strcmp (temp_string, "AcDbZombieEntity") != 0))
                           && ((strcmp (temp_string, "AcDbProxyEntity") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -377,18 +393,17 @@ dxf_acad_proxy_entity_read
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
-                         * graphics data. */
+                         * graphics data or binary entity data, decode
+                         * it. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", acad_proxy_entity->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) acad_proxy_entity->binary_graphics_data->next);
-                        acad_proxy_entity->binary_graphics_data = (DxfBinaryGraphicsData *) acad_proxy_entity->binary_graphics_data->next;
+                        dxf_binary_data_read (fp, binary_data);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", acad_proxy_entity->dictionary_owner_soft);
+                        dxf_read_string (fp, &acad_proxy_entity->dictionary_owner_soft);
                         i++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -401,7 +416,7 @@ dxf_acad_proxy_entity_read
                                 dxf_object_id_set_group_code (acad_proxy_entity->object_id, atoi (temp_string));
                                 /* Now follows a string containing an object id line of data. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, "%s\n", acad_proxy_entity->object_id->data);
+                                dxf_read_string (fp, &acad_proxy_entity->object_id->data);
                         }
                         else /* For following object_id's. */
                         {
@@ -410,7 +425,7 @@ dxf_acad_proxy_entity_read
                                 dxf_object_id_set_group_code (iter, atoi (temp_string));
                                 /* Now follows a string containing an object id line of data. */
                                 (fp->line_number)++;
-                                fscanf (fp->fp, "%s\n", iter->data);
+                                dxf_read_string (fp, &iter->data);
                         }
                         i++;
                 }
@@ -419,14 +434,14 @@ dxf_acad_proxy_entity_read
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", acad_proxy_entity->material);
+                        dxf_read_string (fp, &acad_proxy_entity->material);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", acad_proxy_entity->dictionary_owner_hard);
+                        dxf_read_string (fp, &acad_proxy_entity->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -440,7 +455,7 @@ dxf_acad_proxy_entity_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", acad_proxy_entity->plot_style_name);
+                        dxf_read_string (fp, &acad_proxy_entity->plot_style_name);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -453,7 +468,7 @@ dxf_acad_proxy_entity_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", acad_proxy_entity->color_name);
+                        dxf_read_string (fp, &acad_proxy_entity->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -471,15 +486,19 @@ dxf_acad_proxy_entity_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
-        fprintf (stderr,
+        dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
           (_("Information from %s() read %d object_id's from %s.\n")),
           __FUNCTION__, i, fp->filename);
         DXF_DEBUG_END
@@ -507,70 +526,71 @@ dxf_acad_proxy_entity_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = NULL;
+        DxfObjectId *object_id_iter = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
                 if (fp->follow_strict_version_rules)
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () illegal DXF version for this entity.\n")),
                           __FUNCTION__);
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                           (_("\t entity %s with ID code %d is omitted from output.\n")),
                           dxf_entity_name, dxf_acad_proxy_entity_get_id_code (acad_proxy_entity));
                         return (EXIT_FAILURE);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () illegal DXF version for this entity.\n")),
                           __FUNCTION__);
                 }
         }
         if (fp->acad_version_number <= AutoCAD_13)
         {
-                dxf_entity_name = strdup ("ACAD_ZOMBIE_ENTITY");
+                dxf_entity_name = dxf_strdup ("ACAD_ZOMBIE_ENTITY");
         }
         else if (fp->acad_version_number >= AutoCAD_14)
         {
-                dxf_entity_name = strdup ("ACAD_PROXY_ENTITY");
+                dxf_entity_name = dxf_strdup ("ACAD_PROXY_ENTITY");
         }
         if ((strcmp (dxf_acad_proxy_entity_get_layer (acad_proxy_entity), "") == 0)
           || (dxf_acad_proxy_entity_get_layer (acad_proxy_entity) == NULL))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_acad_proxy_entity_get_id_code (acad_proxy_entity));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
                 dxf_acad_proxy_entity_set_layer (acad_proxy_entity, DXF_DEFAULT_LAYER);
         }
         if (dxf_acad_proxy_entity_get_linetype (acad_proxy_entity) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () invalid linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_acad_proxy_entity_get_id_code (acad_proxy_entity));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s linetype is set to %s\n")),
                   dxf_entity_name, DXF_DEFAULT_LINETYPE);
                 dxf_acad_proxy_entity_set_linetype (acad_proxy_entity, DXF_DEFAULT_LINETYPE);
@@ -635,14 +655,14 @@ dxf_acad_proxy_entity_write
           && DXF_FLATLAND
           && (dxf_acad_proxy_entity_get_elevation (acad_proxy_entity) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_acad_proxy_entity_get_elevation (acad_proxy_entity));
+                dxf_write_real (fp, 38, dxf_acad_proxy_entity_get_elevation (acad_proxy_entity));
         }
         if ((fp->acad_version_number <= AutoCAD_13)
           && (dxf_acad_proxy_entity_get_thickness (acad_proxy_entity) != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_acad_proxy_entity_get_thickness (acad_proxy_entity));
+                dxf_write_real (fp, 39, dxf_acad_proxy_entity_get_thickness (acad_proxy_entity));
         }
-        fprintf (fp->fp, " 48\n%f\n", dxf_acad_proxy_entity_get_linetype_scale (acad_proxy_entity));
+        dxf_write_real (fp, 48, dxf_acad_proxy_entity_get_linetype_scale (acad_proxy_entity));
         fprintf (fp->fp, " 60\n%d\n", dxf_acad_proxy_entity_get_visibility (acad_proxy_entity));
         if (fp->acad_version_number >= AutoCAD_2004)
         {
@@ -676,31 +696,47 @@ dxf_acad_proxy_entity_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", dxf_acad_proxy_entity_get_graphics_data_size (acad_proxy_entity));
 #endif
-                if (dxf_acad_proxy_entity_get_binary_graphics_data (acad_proxy_entity) != NULL)
+                if ((acad_proxy_entity->graphics_data != NULL)
+                  && (acad_proxy_entity->graphics_data->number_of_bytes > 0))
+                {
+                        dxf_binary_data_write (fp, acad_proxy_entity->graphics_data);
+                }
+                else if (dxf_acad_proxy_entity_get_binary_graphics_data (acad_proxy_entity) != NULL)
                 {
                         DxfBinaryGraphicsData *iter;
                         iter = dxf_acad_proxy_entity_get_binary_graphics_data (acad_proxy_entity);
                         while (iter != NULL)
                         {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
+                                /* Skip the empty line of a new entity. */
+                                if ((iter->data_line != NULL)
+                                  && (strcmp (iter->data_line, "") != 0))
+                                {
+                                        fprintf (fp->fp, "310\n%s\n", iter->data_line);
+                                }
+                                iter = (DxfBinaryGraphicsData *) iter->next;
                         }
                 }
         }
         fprintf (fp->fp, " 93\n%d\n", dxf_acad_proxy_entity_get_entity_data_size (acad_proxy_entity));
-        if (dxf_object_id_get_data (dxf_acad_proxy_entity_get_object_id (acad_proxy_entity)) != NULL)
+        if ((acad_proxy_entity->entity_data != NULL)
+          && (acad_proxy_entity->entity_data->number_of_bytes > 0))
         {
-                DxfObjectId *object_id_iter;
-                object_id_iter = dxf_acad_proxy_entity_get_object_id (acad_proxy_entity);
-                        while (object_id_iter != NULL)
-                        {
-                                fprintf (fp->fp, "%d\n%s\n",
-                                        dxf_object_id_get_group_code (dxf_acad_proxy_entity_get_object_id (acad_proxy_entity)),
-                                        dxf_object_id_get_data (dxf_acad_proxy_entity_get_object_id (acad_proxy_entity)));
-                                object_id_iter = (DxfObjectId *) dxf_object_id_get_next (object_id_iter);
-                        }
+                dxf_binary_data_write (fp, acad_proxy_entity->entity_data);
         }
-        fprintf (fp->fp, " 94\n  0\n");
+        object_id_iter = dxf_acad_proxy_entity_get_object_id (acad_proxy_entity);
+        while (object_id_iter != NULL)
+        {
+                /* Skip the empty object id of a new entity. */
+                if ((object_id_iter->data != NULL)
+                  && (strcmp (object_id_iter->data, "") != 0))
+                {
+                        fprintf (fp->fp, "%d\n%s\n",
+                          object_id_iter->group_code,
+                          object_id_iter->data);
+                }
+                object_id_iter = (DxfObjectId *) object_id_iter->next;
+        }
+        fprintf (fp->fp, " 94\n0\n");
         if (fp->acad_version_number >= AutoCAD_2000)
         {
                 fprintf (fp->fp, " 95\n%ld\n", dxf_acad_proxy_entity_get_object_drawing_format (acad_proxy_entity));
@@ -710,7 +746,7 @@ dxf_acad_proxy_entity_write
                 fprintf (fp->fp, " 70\n%d\n", dxf_acad_proxy_entity_get_original_custom_object_data_format (acad_proxy_entity));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -736,28 +772,39 @@ dxf_acad_proxy_entity_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
 
         if (acad_proxy_entity->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfAcadProxyEntity was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_acad_proxy_entity_get_linetype (acad_proxy_entity));
-        free (dxf_acad_proxy_entity_get_layer (acad_proxy_entity));
-        free (dxf_acad_proxy_entity_get_dictionary_owner_soft (acad_proxy_entity));
-        free (dxf_acad_proxy_entity_get_material (acad_proxy_entity));
-        free (dxf_acad_proxy_entity_get_dictionary_owner_hard (acad_proxy_entity));
-        free (dxf_acad_proxy_entity_get_plot_style_name (acad_proxy_entity));
-        free (dxf_acad_proxy_entity_get_color_name (acad_proxy_entity));
+        dxf_free (dxf_acad_proxy_entity_get_linetype (acad_proxy_entity));
+        dxf_free (dxf_acad_proxy_entity_get_layer (acad_proxy_entity));
+        dxf_free (dxf_acad_proxy_entity_get_dictionary_owner_soft (acad_proxy_entity));
+        dxf_free (dxf_acad_proxy_entity_get_material (acad_proxy_entity));
+        dxf_free (dxf_acad_proxy_entity_get_dictionary_owner_hard (acad_proxy_entity));
+        dxf_free (dxf_acad_proxy_entity_get_plot_style_name (acad_proxy_entity));
+        dxf_free (dxf_acad_proxy_entity_get_color_name (acad_proxy_entity));
         dxf_binary_graphics_data_free_chain (dxf_acad_proxy_entity_get_binary_graphics_data (acad_proxy_entity));
-        for (i = 0; i < DXF_MAX_PARAM; i++)
+        if (acad_proxy_entity->graphics_data != NULL)
+        {
+                dxf_binary_data_free (acad_proxy_entity->graphics_data);
+        }
+        if (acad_proxy_entity->entity_data != NULL)
         {
-                free (acad_proxy_entity->object_id);
+                dxf_binary_data_free (acad_proxy_entity->entity_data);
         }
-        free (acad_proxy_entity);
+        if (acad_proxy_entity->binary_entity_data != NULL)
+        {
+                dxf_binary_entity_data_free_chain (acad_proxy_entity->binary_entity_data);
+        }
+        if (acad_proxy_entity->object_id != NULL)
+        {
+                dxf_object_id_free_chain (acad_proxy_entity->object_id);
+        }
+        dxf_free (acad_proxy_entity);
         acad_proxy_entity = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -777,18 +824,19 @@ dxf_acad_proxy_entity_free_chain
                 /*!< a pointer to the chain of DXF ACAD_PROXY_ENTITY entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (acad_proxy_entities == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (acad_proxy_entities != NULL)
         {
                 struct DxfAcadProxyEntity *iter = acad_proxy_entities->next;
+                acad_proxy_entities->next = NULL;
                 dxf_acad_proxy_entity_free (acad_proxy_entities);
                 acad_proxy_entities = (DxfAcadProxyEntity *) iter;
         }
@@ -816,14 +864,14 @@ dxf_acad_proxy_entity_get_id_code
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -855,14 +903,14 @@ dxf_acad_proxy_entity_set_id_code
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id_code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -893,14 +941,14 @@ dxf_acad_proxy_entity_get_linetype
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -908,7 +956,7 @@ dxf_acad_proxy_entity_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->linetype));
+        return (dxf_strdup (acad_proxy_entity->linetype));
 }
 
 
@@ -930,19 +978,19 @@ dxf_acad_proxy_entity_set_linetype
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->linetype = strdup (linetype);
+        acad_proxy_entity->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -968,14 +1016,14 @@ dxf_acad_proxy_entity_get_layer
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -983,7 +1031,7 @@ dxf_acad_proxy_entity_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->layer));
+        return (dxf_strdup (acad_proxy_entity->layer));
 }
 
 
@@ -1005,19 +1053,19 @@ dxf_acad_proxy_entity_set_layer
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->layer = strdup (layer);
+        acad_proxy_entity->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1043,7 +1091,7 @@ dxf_acad_proxy_entity_get_elevation
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1076,7 +1124,7 @@ dxf_acad_proxy_entity_set_elevation
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1107,14 +1155,14 @@ dxf_acad_proxy_entity_get_thickness
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
         }
@@ -1146,14 +1194,14 @@ dxf_acad_proxy_entity_set_thickness
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1183,14 +1231,14 @@ dxf_acad_proxy_entity_get_linetype_scale
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1220,14 +1268,14 @@ dxf_acad_proxy_entity_set_linetype_scale
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative linetype scale value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1258,21 +1306,21 @@ dxf_acad_proxy_entity_get_visibility
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1302,21 +1350,21 @@ dxf_acad_proxy_entity_set_visibility
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1347,14 +1395,14 @@ dxf_acad_proxy_entity_get_color
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1383,17 +1431,17 @@ dxf_acad_proxy_entity_set_color
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         acad_proxy_entity->color = color;
@@ -1423,20 +1471,20 @@ dxf_acad_proxy_entity_get_paperspace
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (acad_proxy_entity->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1465,21 +1513,21 @@ dxf_acad_proxy_entity_set_paperspace
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1511,21 +1559,21 @@ dxf_acad_proxy_entity_get_shadow_mode
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1558,21 +1606,21 @@ dxf_acad_proxy_entity_set_shadow_mode
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1606,14 +1654,14 @@ dxf_acad_proxy_entity_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1621,7 +1669,7 @@ dxf_acad_proxy_entity_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->dictionary_owner_soft));
+        return (dxf_strdup (acad_proxy_entity->dictionary_owner_soft));
 }
 
 
@@ -1645,19 +1693,19 @@ dxf_acad_proxy_entity_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        acad_proxy_entity->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1686,14 +1734,14 @@ dxf_acad_proxy_entity_get_material
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the material member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1701,7 +1749,7 @@ dxf_acad_proxy_entity_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->material));
+        return (dxf_strdup (acad_proxy_entity->material));
 }
 
 
@@ -1728,19 +1776,19 @@ dxf_acad_proxy_entity_set_material
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->material = strdup (material);
+        acad_proxy_entity->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1769,14 +1817,14 @@ dxf_acad_proxy_entity_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1784,7 +1832,7 @@ dxf_acad_proxy_entity_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->dictionary_owner_hard));
+        return (dxf_strdup (acad_proxy_entity->dictionary_owner_hard));
 }
 
 
@@ -1808,19 +1856,19 @@ dxf_acad_proxy_entity_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        acad_proxy_entity->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1847,7 +1895,7 @@ dxf_acad_proxy_entity_get_lineweight
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1880,7 +1928,7 @@ dxf_acad_proxy_entity_set_lineweight
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1913,14 +1961,14 @@ dxf_acad_proxy_entity_get_plot_style_name
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1928,7 +1976,7 @@ dxf_acad_proxy_entity_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->plot_style_name));
+        return (dxf_strdup (acad_proxy_entity->plot_style_name));
 }
 
 
@@ -1954,19 +2002,19 @@ dxf_acad_proxy_entity_set_plot_style_name
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->plot_style_name = strdup (plot_style_name);
+        acad_proxy_entity->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1993,7 +2041,7 @@ dxf_acad_proxy_entity_get_color_value
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2026,7 +2074,7 @@ dxf_acad_proxy_entity_set_color_value
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2058,14 +2106,14 @@ dxf_acad_proxy_entity_get_color_name
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2073,7 +2121,7 @@ dxf_acad_proxy_entity_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (acad_proxy_entity->color_name));
+        return (dxf_strdup (acad_proxy_entity->color_name));
 }
 
 
@@ -2099,19 +2147,19 @@ dxf_acad_proxy_entity_set_color_name
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        acad_proxy_entity->color_name = strdup (color_name);
+        acad_proxy_entity->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2138,7 +2186,7 @@ dxf_acad_proxy_entity_get_transparency
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2171,7 +2219,7 @@ dxf_acad_proxy_entity_set_transparency
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2203,20 +2251,20 @@ dxf_acad_proxy_entity_get_original_custom_object_data_format
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->original_custom_object_data_format < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the original_custom_object_data_format member.\n")),
                   __FUNCTION__);
         }
         if (acad_proxy_entity->original_custom_object_data_format > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the original_custom_object_data_format member.\n")),
                   __FUNCTION__);
         }
@@ -2246,21 +2294,21 @@ dxf_acad_proxy_entity_set_original_custom_object_data_format
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (original_custom_object_data_format < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative original custom object data format value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (original_custom_object_data_format > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range original custom object data format value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2292,14 +2340,14 @@ dxf_acad_proxy_entity_get_proxy_entity_class_id
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->proxy_entity_class_id != 498)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an invalid value was found in the proxy_entity_class_id member.\n")),
                   __FUNCTION__);
         }
@@ -2330,14 +2378,14 @@ dxf_acad_proxy_entity_set_proxy_entity_class_id
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (proxy_entity_class_id != 498)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2369,14 +2417,14 @@ dxf_acad_proxy_entity_get_application_entity_class_id
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->application_entity_class_id < 500)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an invalid value was found in the proxy_entity_class_id member.\n")),
                   __FUNCTION__);
         }
@@ -2407,14 +2455,14 @@ dxf_acad_proxy_entity_set_application_entity_class_id
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (application_entity_class_id < 500)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2446,14 +2494,14 @@ dxf_acad_proxy_entity_get_graphics_data_size
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid graphics data size value was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2485,14 +2533,14 @@ dxf_acad_proxy_entity_set_graphics_data_size
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid graphics data size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2524,14 +2572,14 @@ dxf_acad_proxy_entity_get_entity_data_size
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->entity_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid entity data size value was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2563,14 +2611,14 @@ dxf_acad_proxy_entity_set_entity_data_size
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (entity_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid graphics data size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2602,14 +2650,14 @@ dxf_acad_proxy_entity_get_object_drawing_format
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (acad_proxy_entity->object_drawing_format < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid object drawing format value was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2641,7 +2689,7 @@ dxf_acad_proxy_entity_set_object_drawing_format
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2675,14 +2723,14 @@ dxf_acad_proxy_entity_get_binary_graphics_data
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2714,14 +2762,14 @@ dxf_acad_proxy_entity_set_binary_graphics_data
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2755,14 +2803,14 @@ dxf_acad_proxy_entity_get_binary_entity_data
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->binary_entity_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_entity_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2794,14 +2842,14 @@ dxf_acad_proxy_entity_set_binary_entity_data
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2835,14 +2883,14 @@ dxf_acad_proxy_entity_get_object_id
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->object_id ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the object_id member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2874,14 +2922,14 @@ dxf_acad_proxy_entity_set_object_id
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2915,14 +2963,14 @@ dxf_acad_proxy_entity_get_next
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2953,14 +3001,14 @@ dxf_acad_proxy_entity_set_next
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2994,14 +3042,14 @@ dxf_acad_proxy_entity_get_last
         /* Do some basic checks. */
         if (acad_proxy_entity == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_proxy_entity->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfAcadProxyEntity *) acad_proxy_entity);
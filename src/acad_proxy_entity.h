@@ -53,6 +53,7 @@
 #include "global.h"
 #include "binary_entity_data.h"
 #include "binary_graphics_data.h"
+#include "binary_data.h"
 #include "object_id.h"
 
 
@@ -68,6 +69,9 @@ extern "C" {
 typedef struct
 dxf_acad_proxy_entity_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -224,6 +228,18 @@ dxf_acad_proxy_entity_struct
                  * (optional).\n
                  * Group code = 310.\n
                  * \since Introduced in version R14. */
+        DxfBinaryData *graphics_data;
+                /*!< Proxy entity graphics data, decoded from the lines
+                 * following group code 92 (or 160).\n
+                 * Takes the place of \c binary_graphics_data when
+                 * reading.\n
+                 * Group code = 310. */
+        DxfBinaryData *entity_data;
+                /*!< Binary entity data, decoded from the lines
+                 * following group code 93.\n
+                 * Takes the place of \c binary_entity_data when
+                 * reading.\n
+                 * Group code = 310. */
         DxfObjectId *object_id;
                 /*!< An object ID (multiple entries can appear).\n
                  * Group code = 330 or 340 or 350 or 360. */
@@ -0,0 +1,600 @@
+/*!
+ * \file allocator.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for pluggable libDXF memory allocators.
+ *
+ * All memory of libDXF is allocated and freed with \c dxf_malloc (),
+ * \c dxf_calloc (), \c dxf_realloc (), \c dxf_free () and
+ * \c dxf_strdup ().\n
+ * These use the allocator activated in the calling thread with
+ * \c dxf_allocator_activate (), or else the process wide allocator set
+ * with \c dxf_set_allocator (), which defaults to the C library.\n
+ * \n
+ * A \c DxfDrawing remembers the allocator that was active when it was
+ * created and activates it again while it is freed, so the memory of a
+ * drawing can be isolated and accounted per job by activating an
+ * allocator while the drawing is built.\n
+ * \n
+ * Memory has to be freed with the allocator it was allocated with:
+ * only change the process wide allocator while no memory of libDXF is
+ * allocated.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "allocator.h"
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+
+static void *
+dxf_allocator_system_malloc (void *context, size_t size)
+{
+        (void) context;
+        return (malloc (size));
+}
+
+
+static void *
+dxf_allocator_system_realloc (void *context, void *ptr, size_t size)
+{
+        (void) context;
+        return (realloc (ptr, size));
+}
+
+
+static void
+dxf_allocator_system_free (void *context, void *ptr)
+{
+        (void) context;
+        free (ptr);
+}
+
+
+static char *
+dxf_allocator_system_strdup (void *context, const char *s)
+{
+        (void) context;
+        return (strdup (s));
+}
+
+
+#ifdef __GLIBC__
+static size_t
+dxf_allocator_system_usable_size (void *context, void *ptr)
+{
+        (void) context;
+        return (malloc_usable_size (ptr));
+}
+#else
+#define dxf_allocator_system_usable_size NULL
+#endif
+
+
+/*! \brief The C library allocator. */
+static const DxfAllocator dxf_allocator_system =
+{
+        dxf_allocator_system_malloc,
+        dxf_allocator_system_realloc,
+        dxf_allocator_system_free,
+        dxf_allocator_system_strdup,
+        NULL,
+        dxf_allocator_system_usable_size
+};
+
+/*!
+ * \brief Number of blocks allocated with the process wide allocator
+ * and not yet freed, counted per thread.
+ *
+ * A block freed by another thread than the one allocating it makes
+ * the count of either thread off, their sum stays right.
+ */
+typedef struct
+dxf_allocator_blocks_struct
+{
+        int64_t number_of_blocks;
+                /*!< Number of blocks allocated minus the number of
+                 * blocks freed by the thread. */
+        struct dxf_allocator_blocks_struct *next;
+                /*!< Pointer to the counter of the next thread. */
+} DxfAllocatorBlocks;
+
+
+static void *dxf_allocator_global_malloc (void *context, size_t size);
+static void *dxf_allocator_global_realloc (void *context, void *ptr, size_t size);
+static void dxf_allocator_global_free (void *context, void *ptr);
+static char *dxf_allocator_global_strdup (void *context, const char *s);
+static size_t dxf_allocator_global_usable_size (void *context, void *ptr);
+
+
+/*! \brief The allocator set with \c dxf_set_allocator (). */
+static DxfAllocator dxf_allocator_user =
+{
+        dxf_allocator_system_malloc,
+        dxf_allocator_system_realloc,
+        dxf_allocator_system_free,
+        dxf_allocator_system_strdup,
+        NULL,
+        dxf_allocator_system_usable_size
+};
+
+/*! \brief The process wide allocator, counting the blocks of
+ * \c dxf_allocator_user in use. */
+static DxfAllocator dxf_allocator_global =
+{
+        dxf_allocator_global_malloc,
+        dxf_allocator_global_realloc,
+        dxf_allocator_global_free,
+        dxf_allocator_global_strdup,
+        NULL,
+#ifdef __GLIBC__
+        dxf_allocator_global_usable_size
+#else
+        NULL
+#endif
+};
+
+/*! \brief Counters of all threads that allocated anything. */
+static DxfAllocatorBlocks *dxf_allocator_blocks = NULL;
+
+/*! \brief Blocks counted by threads without a counter of their own. */
+static int64_t dxf_allocator_blocks_shared = 0;
+
+/*! \brief Counter of the calling thread. */
+static __thread DxfAllocatorBlocks *dxf_allocator_blocks_self = NULL;
+
+/*! \brief The allocator activated in the calling thread, or \c NULL. */
+static __thread DxfAllocator *dxf_allocator_active = NULL;
+
+
+/*!
+ * \brief Get the allocator in use by the calling thread.
+ */
+#define DXF_ALLOCATOR_CURRENT \
+        ((dxf_allocator_active != NULL) ? dxf_allocator_active : &dxf_allocator_global)
+
+
+/*!
+ * \brief Add to the number of blocks of the process wide allocator in
+ * use.
+ */
+static void
+dxf_allocator_count
+(
+        int64_t n
+                /*!< number of blocks allocated, negative for freed
+                 * blocks. */
+)
+{
+        DxfAllocatorBlocks *self = dxf_allocator_blocks_self;
+        DxfAllocatorBlocks *head;
+
+        if (self == NULL)
+        {
+                /* Not allocated with the allocator being counted. */
+                self = calloc (1, sizeof (DxfAllocatorBlocks));
+                if (self == NULL)
+                {
+                        __atomic_add_fetch (&dxf_allocator_blocks_shared, n, __ATOMIC_RELAXED);
+                        return;
+                }
+                /* Lock free prepend to the list of counters. */
+                head = __atomic_load_n (&dxf_allocator_blocks, __ATOMIC_ACQUIRE);
+                do
+                {
+                        self->next = head;
+                }
+                while (!__atomic_compare_exchange_n (&dxf_allocator_blocks, &head,
+                  self, 1, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+                dxf_allocator_blocks_self = self;
+        }
+        __atomic_store_n (&self->number_of_blocks,
+          self->number_of_blocks + n, __ATOMIC_RELAXED);
+}
+
+
+/*!
+ * \brief Get the number of blocks of the process wide allocator in
+ * use.
+ *
+ * \return the number of blocks.
+ */
+static int64_t
+dxf_allocator_get_number_of_blocks ()
+{
+        DxfAllocatorBlocks *iter;
+        int64_t sum;
+
+        sum = __atomic_load_n (&dxf_allocator_blocks_shared, __ATOMIC_RELAXED);
+        for (iter = __atomic_load_n (&dxf_allocator_blocks, __ATOMIC_ACQUIRE);
+          iter != NULL;
+          iter = iter->next)
+        {
+                sum += __atomic_load_n (&iter->number_of_blocks, __ATOMIC_RELAXED);
+        }
+        return (sum);
+}
+
+
+static void *
+dxf_allocator_global_malloc (void *context, size_t size)
+{
+        void *ptr;
+
+        (void) context;
+        ptr = dxf_allocator_user.malloc (dxf_allocator_user.context, size);
+        if (ptr != NULL)
+        {
+                dxf_allocator_count (1);
+        }
+        return (ptr);
+}
+
+
+static void *
+dxf_allocator_global_realloc (void *context, void *ptr, size_t size)
+{
+        void *new_ptr;
+
+        (void) context;
+        new_ptr = dxf_allocator_user.realloc (dxf_allocator_user.context, ptr, size);
+        if ((ptr == NULL) && (new_ptr != NULL))
+        {
+                dxf_allocator_count (1);
+        }
+        return (new_ptr);
+}
+
+
+static void
+dxf_allocator_global_free (void *context, void *ptr)
+{
+        (void) context;
+        if (ptr != NULL)
+        {
+                dxf_allocator_user.free (dxf_allocator_user.context, ptr);
+                dxf_allocator_count (-1);
+        }
+}
+
+
+static char *
+dxf_allocator_global_strdup (void *context, const char *s)
+{
+        char *duplicate;
+        size_t size;
+
+        (void) context;
+        if (dxf_allocator_user.strdup != NULL)
+        {
+                duplicate = dxf_allocator_user.strdup (dxf_allocator_user.context, s);
+        }
+        else
+        {
+                size = strlen (s) + 1;
+                duplicate = dxf_allocator_user.malloc (dxf_allocator_user.context, size);
+                if (duplicate != NULL)
+                {
+                        memcpy (duplicate, s, size);
+                }
+        }
+        if (duplicate != NULL)
+        {
+                dxf_allocator_count (1);
+        }
+        return (duplicate);
+}
+
+
+static size_t
+dxf_allocator_global_usable_size (void *context, void *ptr)
+{
+        (void) context;
+        return (dxf_allocator_user.usable_size (dxf_allocator_user.context, ptr));
+}
+
+
+/*!
+ * \brief Set the process wide allocator.
+ *
+ * The allocator can only be replaced while no memory allocated with
+ * the process wide allocator is in use, so set it before libDXF
+ * allocates anything.\n
+ * The pages of the default pools count as memory in use until they are
+ * freed with \c dxf_pool_trim ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_set_allocator
+(
+        const DxfAllocator *allocator
+                /*!< a pointer to the allocator, it is copied, or
+                 * \c NULL for the C library allocator. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (allocator == NULL)
+        {
+                allocator = &dxf_allocator_system;
+        }
+        if ((allocator->malloc == NULL)
+          || (allocator->realloc == NULL)
+          || (allocator->free == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an incomplete allocator was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_allocator_get_number_of_blocks () != 0)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () memory of the process wide allocator is still in use.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_allocator_user = *allocator;
+        dxf_allocator_global.usable_size = (allocator->usable_size != NULL)
+          ? dxf_allocator_global_usable_size
+          : NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the process wide allocator.
+ *
+ * \return a pointer to the allocator.
+ */
+const DxfAllocator *
+dxf_get_allocator ()
+{
+        return (&dxf_allocator_global);
+}
+
+
+/*!
+ * \brief Activate an allocator in the calling thread, it takes
+ * precedence over the process wide allocator.
+ *
+ * \return the previously activated allocator, to be activated again
+ * when done, or \c NULL.
+ */
+DxfAllocator *
+dxf_allocator_activate
+(
+        DxfAllocator *allocator
+                /*!< a pointer to the allocator, it is not copied, or
+                 * \c NULL for the process wide allocator. */
+)
+{
+        DxfAllocator *previous = dxf_allocator_active;
+
+        if ((allocator != NULL)
+          && ((allocator->malloc == NULL)
+          || (allocator->realloc == NULL)
+          || (allocator->free == NULL)))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an incomplete allocator was passed.\n")),
+                  __FUNCTION__);
+                return (previous);
+        }
+        dxf_allocator_active = allocator;
+        return (previous);
+}
+
+
+/*!
+ * \brief Get the allocator activated in the calling thread.
+ *
+ * \return a pointer to the allocator, or \c NULL when the process wide
+ * allocator is used.
+ */
+DxfAllocator *
+dxf_allocator_get_active ()
+{
+        return (dxf_allocator_active);
+}
+
+
+/*!
+ * \brief Test whether the calling thread allocates with the C library
+ * allocator.
+ *
+ * Other allocators are not known to be thread safe, and an allocator
+ * activated in the calling thread is not active in other threads, work
+ * is then done on the calling thread only.
+ *
+ * \return \c TRUE when no allocator is activated in the calling thread
+ * and the process wide allocator is the C library allocator, or
+ * \c FALSE.
+ */
+int
+dxf_allocator_is_system ()
+{
+        if ((dxf_allocator_active == NULL)
+          && (dxf_allocator_user.malloc == dxf_allocator_system.malloc)
+          && (dxf_allocator_user.realloc == dxf_allocator_system.realloc)
+          && (dxf_allocator_user.free == dxf_allocator_system.free))
+        {
+                return (TRUE);
+        }
+        return (FALSE);
+}
+
+
+/*!
+ * \brief Allocate memory.
+ *
+ * \return a pointer to the memory, or \c NULL.
+ */
+void *
+dxf_malloc
+(
+        size_t size
+                /*!< number of bytes. */
+)
+{
+        DxfAllocator *allocator = DXF_ALLOCATOR_CURRENT;
+
+        return (allocator->malloc (allocator->context, size));
+}
+
+
+/*!
+ * \brief Allocate memory filled with zeros.
+ *
+ * \return a pointer to the memory, or \c NULL.
+ */
+void *
+dxf_calloc
+(
+        size_t number,
+                /*!< number of members. */
+        size_t size
+                /*!< size of a member in bytes. */
+)
+{
+        DxfAllocator *allocator = DXF_ALLOCATOR_CURRENT;
+        void *ptr;
+
+        if ((size != 0) && (number > SIZE_MAX / size))
+        {
+                return (NULL);
+        }
+        ptr = allocator->malloc (allocator->context, number * size);
+        if (ptr != NULL)
+        {
+                memset (ptr, 0, number * size);
+        }
+        return (ptr);
+}
+
+
+/*!
+ * \brief Resize memory.
+ *
+ * \return a pointer to the memory, or \c NULL.
+ */
+void *
+dxf_realloc
+(
+        void *ptr,
+                /*!< a pointer to the memory, or \c NULL. */
+        size_t size
+                /*!< number of bytes. */
+)
+{
+        DxfAllocator *allocator = DXF_ALLOCATOR_CURRENT;
+
+        return (allocator->realloc (allocator->context, ptr, size));
+}
+
+
+/*!
+ * \brief Free memory.
+ */
+void
+dxf_free
+(
+        void *ptr
+                /*!< a pointer to the memory, or \c NULL. */
+)
+{
+        DxfAllocator *allocator = DXF_ALLOCATOR_CURRENT;
+
+        if (ptr != NULL)
+        {
+                allocator->free (allocator->context, ptr);
+        }
+}
+
+
+/*!
+ * \brief Duplicate a string.
+ *
+ * \return a pointer to the duplicate, or \c NULL.
+ */
+char *
+dxf_strdup
+(
+        const char *s
+                /*!< the string. */
+)
+{
+        DxfAllocator *allocator = DXF_ALLOCATOR_CURRENT;
+        char *duplicate;
+        size_t size;
+
+        if (allocator->strdup != NULL)
+        {
+                return (allocator->strdup (allocator->context, s));
+        }
+        size = strlen (s) + 1;
+        duplicate = allocator->malloc (allocator->context, size);
+        if (duplicate != NULL)
+        {
+                memcpy (duplicate, s, size);
+        }
+        return (duplicate);
+}
+
+
+/*!
+ * \brief Get the number of usable bytes of memory.
+ *
+ * \return the number of bytes, or 0 when not known.
+ */
+size_t
+dxf_usable_size
+(
+        void *ptr
+                /*!< a pointer to the memory, or \c NULL. */
+)
+{
+        DxfAllocator *allocator = DXF_ALLOCATOR_CURRENT;
+
+        if ((ptr == NULL) || (allocator->usable_size == NULL))
+        {
+                return (0);
+        }
+        return (allocator->usable_size (allocator->context, ptr));
+}
+
+
+/* EOF */
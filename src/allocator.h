@@ -0,0 +1,95 @@
+/*!
+ * \file allocator.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for pluggable libDXF memory allocators.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_ALLOCATOR_H
+#define LIBDXF_SRC_ALLOCATOR_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Memory allocator used for all allocations of libDXF.
+ *
+ * The functions have the semantics of their C library counterparts,
+ * \c context is passed unchanged as the first argument.
+ */
+typedef struct
+dxf_allocator_struct
+{
+        void *(*malloc) (void *context, size_t size);
+                /*!< Allocate \c size bytes. */
+        void *(*realloc) (void *context, void *ptr, size_t size);
+                /*!< Resize the memory at \c ptr to \c size bytes. */
+        void (*free) (void *context, void *ptr);
+                /*!< Free the memory at \c ptr. */
+        char *(*strdup) (void *context, const char *s);
+                /*!< Duplicate the string \c s, or \c NULL to implement
+                 * it with \c malloc. */
+        void *context;
+                /*!< User context, for example an arena. */
+        size_t (*usable_size) (void *context, void *ptr);
+                /*!< Number of usable bytes at \c ptr, or \c NULL when
+                 * not known, strings are then only reused up to their
+                 * current length. */
+} DxfAllocator;
+
+
+int dxf_set_allocator (const DxfAllocator *allocator);
+const DxfAllocator *dxf_get_allocator ();
+DxfAllocator *dxf_allocator_activate (DxfAllocator *allocator);
+DxfAllocator *dxf_allocator_get_active ();
+int dxf_allocator_is_system ();
+void *dxf_malloc (size_t size);
+void *dxf_calloc (size_t number, size_t size);
+void *dxf_realloc (void *ptr, size_t size);
+void dxf_free (void *ptr);
+char *dxf_strdup (const char *s);
+size_t dxf_usable_size (void *ptr);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_ALLOCATOR_H */
+
+
+/* EOF */
@@ -57,6 +57,7 @@
 
 
 #include "appid.h"
+#include "util.h"
 
 
 /*!
@@ -76,9 +77,9 @@ dxf_appid_new ()
         size = sizeof (DxfAppid);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((appid = malloc (size)) == NULL)
+        if ((appid = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 appid = NULL;
@@ -114,23 +115,23 @@ dxf_appid_init
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 appid = dxf_appid_new ();
         }
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_appid_set_id_code (appid, 0);
-        dxf_appid_set_application_name (appid, strdup (""));
+        dxf_appid_set_application_name (appid, dxf_strdup (""));
         dxf_appid_set_flag (appid, 0);
-        dxf_appid_set_dictionary_owner_soft (appid, strdup (""));
-        dxf_appid_set_dictionary_owner_hard (appid, strdup (""));
+        dxf_appid_set_dictionary_owner_soft (appid, dxf_strdup (""));
+        dxf_appid_set_dictionary_owner_hard (appid, dxf_strdup (""));
         dxf_appid_set_next (appid, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -163,38 +164,34 @@ dxf_appid_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 appid = dxf_appid_new ();
                 appid = dxf_appid_init (appid);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -209,7 +206,7 @@ dxf_appid_read
                         /* Now follows a string containing an application
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", appid->application_name);
+                        dxf_read_string (fp, &appid->application_name);
                 }
                 else if (strcmp (temp_string, "70") == 0)
                 {
@@ -223,14 +220,14 @@ dxf_appid_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", appid->dictionary_owner_soft);
+                        dxf_read_string (fp, &appid->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", appid->dictionary_owner_hard);
+                        dxf_read_string (fp, &appid->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -241,13 +238,17 @@ dxf_appid_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -271,43 +272,43 @@ dxf_appid_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("APPID");
+        char *dxf_entity_name = dxf_strdup ("APPID");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((dxf_appid_get_application_name (appid) == NULL)
           || (strcmp (dxf_appid_get_application_name (appid), "") == 0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s empty string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_appid_get_id_code (appid));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_12)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
@@ -349,7 +350,7 @@ dxf_appid_write
         fprintf (fp->fp, "  2\n%s\n", dxf_appid_get_application_name (appid));
         fprintf (fp->fp, " 70\n%d\n", dxf_appid_get_flag (appid));
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -376,15 +377,15 @@ dxf_appid_free
 #endif
         if (appid->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (appid->application_name);
-        free (appid->dictionary_owner_soft);
-        free (appid->dictionary_owner_hard);
-        free (appid);
+        dxf_free (appid->application_name);
+        dxf_free (appid->dictionary_owner_soft);
+        dxf_free (appid->dictionary_owner_hard);
+        dxf_free (appid);
         appid = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -405,18 +406,19 @@ dxf_appid_free_chain
                  * entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (appids == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (appids != NULL)
         {
                 struct DxfAppid *iter = appids->next;
+                appids->next = NULL;
                 dxf_appid_free (appids);
                 appids = (DxfAppid *) iter;
         }
@@ -444,7 +446,7 @@ dxf_appid_get_id_code
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -476,7 +478,7 @@ dxf_appid_set_id_code
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -508,7 +510,7 @@ dxf_appid_get_application_name
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -516,7 +518,7 @@ dxf_appid_get_application_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->application_name));
+        return (dxf_strdup (appid->application_name));
 }
 
 
@@ -548,19 +550,19 @@ dxf_appid_set_application_name
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () the string name contained a NULL pointer.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->application_name = strdup (name);
+        appid->application_name = dxf_strdup (name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -586,7 +588,7 @@ dxf_appid_get_flag
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -616,7 +618,7 @@ dxf_appid_set_flag
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -649,7 +651,7 @@ dxf_appid_is_no_save_xdata
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -680,7 +682,7 @@ dxf_appid_is_xreferenced
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -713,7 +715,7 @@ dxf_appid_is_xresolved
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -746,7 +748,7 @@ dxf_appid_is_referenced
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -779,14 +781,14 @@ dxf_appid_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (appid->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -794,7 +796,7 @@ dxf_appid_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->dictionary_owner_soft));
+        return (dxf_strdup (appid->dictionary_owner_soft));
 }
 
 
@@ -818,19 +820,19 @@ dxf_appid_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        appid->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -859,14 +861,14 @@ dxf_appid_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (appid->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -874,7 +876,7 @@ dxf_appid_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (appid->dictionary_owner_hard));
+        return (dxf_strdup (appid->dictionary_owner_hard));
 }
 
 
@@ -898,19 +900,19 @@ dxf_appid_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        appid->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        appid->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -939,14 +941,14 @@ dxf_appid_get_next
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (appid->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -977,14 +979,14 @@ dxf_appid_set_next
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1018,14 +1020,14 @@ dxf_appid_get_last
         /* Do some basic checks. */
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (appid->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfAppid *) appid);
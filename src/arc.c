@@ -40,6 +40,7 @@
 
 
 #include "arc.h"
+#include "util.h"
 
 
 /*!
@@ -62,9 +63,9 @@ dxf_arc_new ()
         size = sizeof (DxfArc);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((arc = malloc (size)) == NULL)
+        if ((arc = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 arc = NULL;
@@ -72,6 +73,8 @@ dxf_arc_new ()
         else
         {
                 memset (arc, 0, size);
+                arc->header.type = ARC;
+                DXF_TRACING_COUNT (ARC, DXF_TRACING_ALLOCATIONS, 1);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -100,21 +103,21 @@ dxf_arc_init
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 arc = dxf_arc_new ();
         }
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_arc_set_id_code (arc, 0);
-        dxf_arc_set_linetype (arc, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_arc_set_layer (arc, strdup (DXF_DEFAULT_LAYER));
+        dxf_arc_set_linetype (arc, DXF_DEFAULT_LINETYPE);
+        dxf_arc_set_layer (arc, DXF_DEFAULT_LAYER);
         dxf_arc_set_elevation (arc, 0.0);
         dxf_arc_set_thickness (arc, 0.0);
         dxf_arc_set_linetype_scale (arc, DXF_DEFAULT_LINETYPE_SCALE);
@@ -125,13 +128,13 @@ dxf_arc_init
         dxf_arc_set_shadow_mode (arc, 0);
         dxf_arc_set_binary_graphics_data (arc, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_arc_get_binary_graphics_data (arc));
-        dxf_arc_set_dictionary_owner_soft (arc, strdup (""));
-        dxf_arc_set_material (arc, strdup (""));
-        dxf_arc_set_dictionary_owner_hard (arc, strdup (""));
+        dxf_arc_set_dictionary_owner_soft (arc, "");
+        dxf_arc_set_material (arc, "");
+        dxf_arc_set_dictionary_owner_hard (arc, "");
         dxf_arc_set_lineweight (arc, 0);
-        dxf_arc_set_plot_style_name (arc, strdup (""));
+        dxf_arc_set_plot_style_name (arc, "");
         dxf_arc_set_color_value (arc, 0);
-        dxf_arc_set_color_name (arc, strdup (""));
+        dxf_arc_set_color_name (arc, "");
         dxf_arc_set_transparency (arc, 0);
         dxf_arc_set_p0 (arc, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_arc_get_p0 (arc));
@@ -152,6 +155,71 @@ dxf_arc_init
 }
 
 
+/*!
+ * \brief Reset a DXF \c ARC entity to the values set by
+ * \c dxf_arc_init (), reusing its allocated members.
+ *
+ * The center point \c p0 stays allocated.\n
+ * The link to the next entity is kept.
+ *
+ * \return a pointer to the DXF \c ARC entity, or a newly allocated
+ * and initialized one when \c NULL was passed.
+ */
+DxfArc *
+dxf_arc_reset
+(
+        DxfArc *arc
+                /*!< a pointer to the DXF \c ARC entity, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (arc == NULL)
+        {
+                return (dxf_arc_init (dxf_arc_new ()));
+        }
+        arc->id_code = 0;
+        dxf_string_assign (&arc->linetype, DXF_DEFAULT_LINETYPE);
+        dxf_string_assign (&arc->layer, DXF_DEFAULT_LAYER);
+        arc->elevation = 0.0;
+        arc->thickness = 0.0;
+        arc->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
+        arc->visibility = DXF_DEFAULT_VISIBILITY;
+        arc->color = DXF_COLOR_BYLAYER;
+        arc->paperspace = DXF_MODELSPACE;
+        arc->graphics_data_size = 0;
+        arc->shadow_mode = 0;
+        if (arc->binary_graphics_data == NULL)
+        {
+                arc->binary_graphics_data = dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+        }
+        else
+        {
+                dxf_binary_graphics_data_reset (arc->binary_graphics_data);
+        }
+        dxf_string_assign (&arc->dictionary_owner_soft, "");
+        dxf_string_assign (&arc->material, "");
+        dxf_string_assign (&arc->dictionary_owner_hard, "");
+        arc->lineweight = 0;
+        dxf_string_assign (&arc->plot_style_name, "");
+        arc->color_value = 0;
+        dxf_string_assign (&arc->color_name, "");
+        arc->transparency = 0;
+        arc->p0 = dxf_point_reset (arc->p0);
+        arc->radius = 0.0;
+        arc->start_angle = 0.0;
+        arc->end_angle = 0.0;
+        arc->extr_x0 = 0.0;
+        arc->extr_y0 = 0.0;
+        arc->extr_z0 = 1.0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (arc);
+}
+
+
 /*!
  * \brief Read data from a DXF file into a DXF \c ARC entity.
  *
@@ -175,38 +243,36 @@ dxf_arc_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 arc = dxf_arc_new ();
                 arc = dxf_arc_init (arc);
         }
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (ARC, fp);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -221,13 +287,13 @@ dxf_arc_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", arc->linetype);
+                        dxf_read_string (fp, &arc->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", arc->layer);
+                        dxf_read_string (fp, &arc->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -322,9 +388,10 @@ dxf_arc_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%s\n", temp_string);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbCircle") != 0)))
+                        && (strcmp (temp_string, "AcDbCircle") != 0)
+                        && (strcmp (temp_string, "AcDbArc") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -355,14 +422,14 @@ dxf_arc_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", arc->dictionary_owner_soft);
+                        dxf_read_string (fp, &arc->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", arc->dictionary_owner_hard);
+                        dxf_read_string (fp, &arc->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -373,22 +440,27 @@ dxf_arc_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (arc->linetype, "") == 0)
         {
-                arc->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_string_assign (&arc->linetype, DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (arc->layer, "") == 0)
         {
-                arc->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_string_assign (&arc->layer, DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
+        DXF_TRACING_ENTITY_END (ARC, fp, trace_offset);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -414,104 +486,104 @@ dxf_arc_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ARC");
+        char *dxf_entity_name = dxf_strdup ("ARC");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_arc_get_start_angle (arc) == dxf_arc_get_end_angle (arc))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start angle and end angle are identical for the %s entity with id-code: %x.\n")),
                     __FUNCTION__, dxf_entity_name, dxf_arc_get_id_code (arc));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tskipping %s entity.\n")), dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_arc_get_start_angle (arc)> 360.0)
         {
-                fprintf (stderr, "Error in dxf_arc_write () start angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR, "Error in dxf_arc_write () start angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
                         dxf_entity_name, dxf_arc_get_id_code (arc));
-                fprintf (stderr, "\tskipping %s entity.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_arc_get_start_angle (arc) < 0.0)
         {
-                fprintf (stderr, "Error in dxf_arc_write () start angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR, "Error in dxf_arc_write () start angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
                         dxf_entity_name, dxf_arc_get_id_code (arc));
-                fprintf (stderr, "\tskipping %s entity.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_arc_get_end_angle (arc) > 360.0)
         {
-                fprintf (stderr, "Error in dxf_arc_write () end angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR, "Error in dxf_arc_write () end angle is greater than 360 degrees for the %s entity with id-code: %x.\n",
                         dxf_entity_name, dxf_arc_get_id_code (arc));
-                fprintf (stderr, "\tskipping %s entity.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_arc_get_end_angle (arc) < 0.0)
         {
-                fprintf (stderr, "Error in dxf_arc_write () end angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR, "Error in dxf_arc_write () end angle is lesser than 0 degrees for the %s entity with id-code: %x.\n",
                         dxf_entity_name, dxf_arc_get_id_code (arc));
-                fprintf (stderr, "\tskipping %s entity.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_arc_get_radius (arc) == 0.0)
         {
-                fprintf (stderr, "Error in dxf_arc_write () radius value equals 0.0 for the %s entity with id-code: %x.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR, "Error in dxf_arc_write () radius value equals 0.0 for the %s entity with id-code: %x.\n",
                         dxf_entity_name, dxf_arc_get_id_code (arc));
-                fprintf (stderr, "\tskipping %s entity.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_arc_get_linetype (arc), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_arc_get_id_code (arc));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_arc_set_linetype (arc, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_arc_set_linetype (arc, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_arc_get_layer (arc), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_arc_get_id_code (arc));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
                 dxf_arc_set_layer (arc, DXF_DEFAULT_LAYER);
@@ -563,7 +635,7 @@ dxf_arc_write
           && DXF_FLATLAND
           && (dxf_arc_get_elevation (arc) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_arc_get_elevation (arc));
+                dxf_write_real (fp, 38, dxf_arc_get_elevation (arc));
         }
         if (dxf_arc_get_color (arc) != DXF_COLOR_BYLAYER)
         {
@@ -571,7 +643,7 @@ dxf_arc_write
         }
         if (dxf_arc_get_linetype_scale (arc) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_arc_get_linetype_scale (arc));
+                dxf_write_real (fp, 48, dxf_arc_get_linetype_scale (arc));
         }
         if (dxf_arc_get_visibility (arc) != 0)
         {
@@ -583,29 +655,29 @@ dxf_arc_write
         }
         if (dxf_arc_get_thickness (arc) != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_arc_get_thickness (arc));
+                dxf_write_real (fp, 39, dxf_arc_get_thickness (arc));
         }
-        fprintf (fp->fp, " 10\n%f\n", dxf_arc_get_x0 (arc));
-        fprintf (fp->fp, " 20\n%f\n", dxf_arc_get_y0 (arc));
-        fprintf (fp->fp, " 30\n%f\n", dxf_arc_get_z0 (arc));
-        fprintf (fp->fp, " 40\n%f\n", dxf_arc_get_radius (arc));
+        dxf_write_real (fp, 10, dxf_arc_get_x0 (arc));
+        dxf_write_real (fp, 20, dxf_arc_get_y0 (arc));
+        dxf_write_real (fp, 30, dxf_arc_get_z0 (arc));
+        dxf_write_real (fp, 40, dxf_arc_get_radius (arc));
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbArc\n");
         }
-        fprintf (fp->fp, " 50\n%f\n", dxf_arc_get_start_angle (arc));
-        fprintf (fp->fp, " 51\n%f\n", dxf_arc_get_end_angle (arc));
+        dxf_write_real (fp, 50, dxf_arc_get_start_angle (arc));
+        dxf_write_real (fp, 51, dxf_arc_get_end_angle (arc));
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (dxf_arc_get_extr_x0 (arc) != 0.0)
                 && (dxf_arc_get_extr_y0 (arc) != 0.0)
                 && (dxf_arc_get_extr_z0 (arc) != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", dxf_arc_get_extr_x0 (arc));
-                fprintf (fp->fp, "220\n%f\n", dxf_arc_get_extr_y0 (arc));
-                fprintf (fp->fp, "230\n%f\n", dxf_arc_get_extr_z0 (arc));
+                dxf_write_real (fp, 210, dxf_arc_get_extr_x0 (arc));
+                dxf_write_real (fp, 220, dxf_arc_get_extr_y0 (arc));
+                dxf_write_real (fp, 230, dxf_arc_get_extr_z0 (arc));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -633,20 +705,21 @@ dxf_arc_free
 #endif
         if (arc->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (arc->linetype);
-        free (arc->layer);
-        free (arc->dictionary_owner_soft);
-        free (arc->material);
-        free (arc->dictionary_owner_hard);
-        free (arc->plot_style_name);
-        free (arc->color_name);
+        dxf_free (arc->linetype);
+        dxf_free (arc->layer);
+        dxf_binary_graphics_data_free_chain (arc->binary_graphics_data);
+        dxf_free (arc->dictionary_owner_soft);
+        dxf_free (arc->material);
+        dxf_free (arc->dictionary_owner_hard);
+        dxf_free (arc->plot_style_name);
+        dxf_free (arc->color_name);
         dxf_point_free (arc->p0);
-        free (arc);
+        dxf_free (arc);
         arc = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -666,18 +739,19 @@ dxf_arc_free_chain
                 /*!< a pointer to the chain of DXF \c ARC entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (arcs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (arcs != NULL)
         {
                 struct DxfArc *iter = arcs->next;
+                arcs->next = NULL;
                 dxf_arc_free (arcs);
                 arcs = (DxfArc *) iter;
         }
@@ -705,14 +779,14 @@ dxf_arc_get_id_code
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -744,14 +818,14 @@ dxf_arc_set_id_code
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -782,14 +856,14 @@ dxf_arc_get_linetype
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -797,7 +871,7 @@ dxf_arc_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->linetype));
+        return (dxf_strdup (arc->linetype));
 }
 
 
@@ -819,19 +893,20 @@ dxf_arc_set_linetype
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->linetype = strdup (linetype);
+        arc->linetype = dxf_strdup (linetype);
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -857,14 +932,14 @@ dxf_arc_get_layer
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -872,7 +947,7 @@ dxf_arc_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->layer));
+        return (dxf_strdup (arc->layer));
 }
 
 
@@ -894,19 +969,20 @@ dxf_arc_set_layer
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->layer = strdup (layer);
+        arc->layer = dxf_strdup (layer);
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -932,7 +1008,7 @@ dxf_arc_get_elevation
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -962,12 +1038,13 @@ dxf_arc_set_elevation
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->elevation = elevation;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -993,14 +1070,14 @@ dxf_arc_get_thickness
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1030,19 +1107,20 @@ dxf_arc_set_thickness
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->thickness = thickness;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1068,14 +1146,14 @@ dxf_arc_get_linetype_scale
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1105,19 +1183,20 @@ dxf_arc_set_linetype_scale
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->linetype_scale = linetype_scale;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1143,21 +1222,21 @@ dxf_arc_get_visibility
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1187,26 +1266,27 @@ dxf_arc_set_visibility
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->visibility = visibility;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1232,14 +1312,14 @@ dxf_arc_get_color
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1268,18 +1348,19 @@ dxf_arc_set_color
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
         arc->color = color;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1305,20 +1386,20 @@ dxf_arc_get_paperspace
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (arc->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found.\n")),
                   __FUNCTION__);
         }
@@ -1347,26 +1428,27 @@ dxf_arc_set_paperspace
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->paperspace = paperspace;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1393,20 +1475,20 @@ dxf_arc_get_graphics_data_size
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (arc->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found.\n")),
                   __FUNCTION__);
         }
@@ -1439,25 +1521,26 @@ dxf_arc_set_graphics_data_size
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
         arc->graphics_data_size = graphics_data_size;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1484,21 +1567,21 @@ dxf_arc_get_shadow_mode
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1531,26 +1614,27 @@ dxf_arc_set_shadow_mode
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->shadow_mode = shadow_mode;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1579,14 +1663,14 @@ dxf_arc_get_binary_graphics_data
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1618,19 +1702,20 @@ dxf_arc_set_binary_graphics_data
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1659,14 +1744,14 @@ dxf_arc_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1674,7 +1759,7 @@ dxf_arc_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->dictionary_owner_soft));
+        return (dxf_strdup (arc->dictionary_owner_soft));
 }
 
 
@@ -1698,19 +1783,20 @@ dxf_arc_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        arc->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1739,14 +1825,14 @@ dxf_arc_get_material
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1754,7 +1840,7 @@ dxf_arc_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->material));
+        return (dxf_strdup (arc->material));
 }
 
 
@@ -1780,19 +1866,20 @@ dxf_arc_set_material
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->material = strdup (material);
+        arc->material = dxf_strdup (material);
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1821,14 +1908,14 @@ dxf_arc_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1836,7 +1923,7 @@ dxf_arc_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->dictionary_owner_hard));
+        return (dxf_strdup (arc->dictionary_owner_hard));
 }
 
 
@@ -1860,19 +1947,20 @@ dxf_arc_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        arc->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1899,7 +1987,7 @@ dxf_arc_get_lineweight
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1932,12 +2020,13 @@ dxf_arc_set_lineweight
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->lineweight = lineweight;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1964,14 +2053,14 @@ dxf_arc_get_plot_style_name
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1979,7 +2068,7 @@ dxf_arc_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->plot_style_name));
+        return (dxf_strdup (arc->plot_style_name));
 }
 
 
@@ -2005,19 +2094,20 @@ dxf_arc_set_plot_style_name
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->plot_style_name = strdup (plot_style_name);
+        arc->plot_style_name = dxf_strdup (plot_style_name);
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2044,7 +2134,7 @@ dxf_arc_get_color_value
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2077,12 +2167,13 @@ dxf_arc_set_color_value
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->color_value = color_value;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2109,14 +2200,14 @@ dxf_arc_get_color_name
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2124,7 +2215,7 @@ dxf_arc_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (arc->color_name));
+        return (dxf_strdup (arc->color_name));
 }
 
 
@@ -2150,19 +2241,20 @@ dxf_arc_set_color_name
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        arc->color_name = strdup (color_name);
+        arc->color_name = dxf_strdup (color_name);
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2189,7 +2281,7 @@ dxf_arc_get_transparency
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2222,12 +2314,13 @@ dxf_arc_set_transparency
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->transparency = transparency;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2247,20 +2340,20 @@ dxf_arc_get_p0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2286,25 +2379,26 @@ dxf_arc_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->p0 = p0;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2325,21 +2419,21 @@ dxf_arc_get_x0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2368,25 +2462,26 @@ dxf_arc_set_x0
                  * \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->p0->x0 = x0;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2407,21 +2502,21 @@ dxf_arc_get_y0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2450,25 +2545,26 @@ dxf_arc_set_y0
                  * \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->p0->y0 = y0;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2489,21 +2585,21 @@ dxf_arc_get_z0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2532,25 +2628,26 @@ dxf_arc_set_z0
                  * \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->p0->z0 = z0;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2576,21 +2673,21 @@ dxf_arc_get_radius
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->radius < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->radius == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2620,26 +2717,27 @@ dxf_arc_set_radius
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (radius < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (radius == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->radius = radius;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2665,7 +2763,7 @@ dxf_arc_get_start_angle
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2695,12 +2793,13 @@ dxf_arc_set_start_angle
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->start_angle = start_angle;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2726,7 +2825,7 @@ dxf_arc_get_end_angle
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2756,12 +2855,13 @@ dxf_arc_set_end_angle
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->end_angle = end_angle;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2781,28 +2881,28 @@ dxf_arc_get_length
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->radius == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a radius of 0.0 was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->radius < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a radius smaller than 0.0 was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2829,7 +2929,7 @@ dxf_arc_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -2837,7 +2937,7 @@ dxf_arc_get_extrusion_vector_as_point
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2845,7 +2945,7 @@ dxf_arc_get_extrusion_vector_as_point
         point = dxf_point_init (point);
         if (point == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -2873,14 +2973,14 @@ dxf_arc_get_extr_x0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2909,18 +3009,19 @@ dxf_arc_set_extr_x0
                  * DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->extr_x0 = extr_x0;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2941,14 +3042,14 @@ dxf_arc_get_extr_y0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2977,18 +3078,19 @@ dxf_arc_set_extr_y0
                  * DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->extr_y0 = extr_y0;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3009,14 +3111,14 @@ dxf_arc_get_extr_z0
                 /*!< a pointer to a DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3045,18 +3147,19 @@ dxf_arc_set_extr_z0
                  * DXF \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         arc->extr_z0 = extr_z0;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3083,14 +3186,14 @@ dxf_arc_set_extrusion_vector_from_point
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3098,6 +3201,7 @@ dxf_arc_set_extrusion_vector_from_point
         arc->extr_x0 = (double) point->x0;
         arc->extr_y0 = (double) point->y0;
         arc->extr_z0 = (double) point->z0;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3127,7 +3231,7 @@ dxf_arc_set_extrusion_vector
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3135,6 +3239,7 @@ dxf_arc_set_extrusion_vector
         arc->extr_x0 = extr_x0;
         arc->extr_y0 = extr_y0;
         arc->extr_z0 = extr_z0;
+        arc->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3163,14 +3268,14 @@ dxf_arc_get_next
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3201,14 +3306,14 @@ dxf_arc_set_next
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3242,14 +3347,14 @@ dxf_arc_get_last
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfArc *) arc);
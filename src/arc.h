@@ -59,6 +59,9 @@ extern "C" {
 typedef struct
 dxf_arc_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -216,6 +219,7 @@ dxf_arc_struct
 
 DxfArc *dxf_arc_new ();
 DxfArc *dxf_arc_init (DxfArc *arc);
+DxfArc *dxf_arc_reset (DxfArc *arc);
 DxfArc *dxf_arc_read (DxfFile *fp, DxfArc *arc);
 int dxf_arc_write (DxfFile *fp, DxfArc *arc);
 int dxf_arc_free (DxfArc *arc);
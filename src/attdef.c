@@ -40,6 +40,7 @@
 
 
 #include "attdef.h"
+#include "util.h"
 
 
 /*!
@@ -59,9 +60,9 @@ dxf_attdef_new ()
         size = sizeof (DxfAttdef);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((attdef = malloc (size)) == NULL)
+        if ((attdef = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 attdef = NULL;
@@ -69,6 +70,7 @@ dxf_attdef_new ()
         else
         {
                 memset (attdef, 0, size);
+                attdef->header.type = ATTDEF;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -96,21 +98,21 @@ dxf_attdef_init
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 attdef = dxf_attdef_new ();
         }
         if (attdef == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_attdef_set_id_code (attdef, 0);
-        dxf_attdef_set_linetype (attdef, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_attdef_set_layer (attdef, strdup (DXF_DEFAULT_LAYER));
+        dxf_attdef_set_linetype (attdef, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_attdef_set_layer (attdef, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_attdef_set_elevation (attdef, 0.0);
         dxf_attdef_set_thickness (attdef, 0.0);
         dxf_attdef_set_linetype_scale (attdef, DXF_DEFAULT_LINETYPE_SCALE);
@@ -121,18 +123,18 @@ dxf_attdef_init
         dxf_attdef_set_shadow_mode (attdef, 0);
         dxf_attdef_set_binary_graphics_data (attdef, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_attdef_get_binary_graphics_data (attdef));
-        dxf_attdef_set_dictionary_owner_soft (attdef, strdup (""));
-        dxf_attdef_set_material (attdef, strdup (""));
-        dxf_attdef_set_dictionary_owner_hard (attdef, strdup (""));
+        dxf_attdef_set_dictionary_owner_soft (attdef, dxf_strdup (""));
+        dxf_attdef_set_material (attdef, dxf_strdup (""));
+        dxf_attdef_set_dictionary_owner_hard (attdef, dxf_strdup (""));
         dxf_attdef_set_lineweight (attdef, 0);
-        dxf_attdef_set_plot_style_name (attdef, strdup (""));
+        dxf_attdef_set_plot_style_name (attdef, dxf_strdup (""));
         dxf_attdef_set_color_value (attdef, 0);
-        dxf_attdef_set_color_name (attdef, strdup (""));
+        dxf_attdef_set_color_name (attdef, dxf_strdup (""));
         dxf_attdef_set_transparency (attdef, 0);
-        dxf_attdef_set_default_value (attdef, strdup (""));
-        dxf_attdef_set_tag_value (attdef, strdup (""));
-        dxf_attdef_set_prompt_value (attdef, strdup (""));
-        dxf_attdef_set_text_style (attdef, strdup (DXF_DEFAULT_TEXTSTYLE));
+        dxf_attdef_set_default_value (attdef, dxf_strdup (""));
+        dxf_attdef_set_tag_value (attdef, dxf_strdup (""));
+        dxf_attdef_set_prompt_value (attdef, dxf_strdup (""));
+        dxf_attdef_set_text_style (attdef, dxf_strdup (DXF_DEFAULT_TEXTSTYLE));
         dxf_attdef_set_p0 (attdef, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_attdef_get_p0 (attdef));
         dxf_attdef_set_x0 (attdef, 0.0);
@@ -186,38 +188,34 @@ dxf_attdef_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 attdef = dxf_attdef_new ();
                 attdef = dxf_attdef_init (attdef);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -225,20 +223,20 @@ dxf_attdef_read
                         /* Now follows a string containing the attribute
                          * default value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->default_value);
+                        dxf_read_string (fp, &attdef->default_value);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a tag value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->tag_value);
+                        dxf_read_string (fp, &attdef->tag_value);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a prompt
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->prompt_value);
+                        dxf_read_string (fp, &attdef->prompt_value);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -252,19 +250,19 @@ dxf_attdef_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->linetype);
+                        dxf_read_string (fp, &attdef->linetype);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
                         /* Now follows a string containing a text style. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->text_style);
+                        dxf_read_string (fp, &attdef->text_style);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->layer);
+                        dxf_read_string (fp, &attdef->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -432,7 +430,7 @@ dxf_attdef_read
                         && (strcmp (temp_string, "AcDbText") != 0)
                         && (strcmp (temp_string, "AcDbAttributeDefinition") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -463,14 +461,14 @@ dxf_attdef_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->dictionary_owner_soft);
+                        dxf_read_string (fp, &attdef->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attdef->dictionary_owner_hard);
+                        dxf_read_string (fp, &attdef->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -481,22 +479,26 @@ dxf_attdef_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_attdef_get_linetype (attdef), "") == 0)
         {
-                dxf_attdef_set_linetype (attdef, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_attdef_set_linetype (attdef, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_attdef_get_layer (attdef), "") == 0)
         {
-                dxf_attdef_set_layer (attdef, strdup (DXF_DEFAULT_LAYER));
+                dxf_attdef_set_layer (attdef, dxf_strdup (DXF_DEFAULT_LAYER));
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -519,82 +521,82 @@ dxf_attdef_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ATTDEF");
+        char *dxf_entity_name = dxf_strdup ("ATTDEF");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_attdef_get_tag_value (attdef), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () default tag value string is empty for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attdef_get_id_code (attdef));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_attdef_get_text_style (attdef), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () text style string is empty for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attdef_get_id_code (attdef));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tdefault text style STANDARD applied to %s entity.\n")),
                   dxf_entity_name);
-                dxf_attdef_set_text_style (attdef, strdup (DXF_DEFAULT_TEXTSTYLE));
+                dxf_attdef_set_text_style (attdef, dxf_strdup (DXF_DEFAULT_TEXTSTYLE));
         }
         if (strcmp (dxf_attdef_get_linetype (attdef), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attdef_get_id_code (attdef));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_attdef_set_linetype (attdef, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_attdef_set_linetype (attdef, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_attdef_get_layer (attdef), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attdef_get_id_code (attdef));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                dxf_attdef_set_layer (attdef, strdup (DXF_DEFAULT_LAYER));
+                dxf_attdef_set_layer (attdef, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         if (dxf_attdef_get_height (attdef) == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attdef_get_id_code (attdef));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tdefault height of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
                 dxf_attdef_set_height (attdef, 1.0);
         }
         if (dxf_attdef_get_rel_x_scale (attdef) == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attdef_get_id_code (attdef));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
                 dxf_attdef_set_rel_x_scale (attdef, 1.0);
@@ -648,7 +650,7 @@ dxf_attdef_write
         }
         if (dxf_attdef_get_linetype_scale (attdef) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_attdef_get_linetype_scale (attdef));
+                dxf_write_real (fp, 48, dxf_attdef_get_linetype_scale (attdef));
         }
         if (dxf_attdef_get_visibility (attdef) != 0)
         {
@@ -660,12 +662,12 @@ dxf_attdef_write
         }
         if (dxf_attdef_get_thickness (attdef) != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_attdef_get_thickness (attdef));
+                dxf_write_real (fp, 39, dxf_attdef_get_thickness (attdef));
         }
-        fprintf (fp->fp, " 10\n%f\n", dxf_attdef_get_x0 (attdef));
-        fprintf (fp->fp, " 20\n%f\n", dxf_attdef_get_y0 (attdef));
-        fprintf (fp->fp, " 30\n%f\n", dxf_attdef_get_z0 (attdef));
-        fprintf (fp->fp, " 40\n%f\n", dxf_attdef_get_height (attdef));
+        dxf_write_real (fp, 10, dxf_attdef_get_x0 (attdef));
+        dxf_write_real (fp, 20, dxf_attdef_get_y0 (attdef));
+        dxf_write_real (fp, 30, dxf_attdef_get_z0 (attdef));
+        dxf_write_real (fp, 40, dxf_attdef_get_height (attdef));
         fprintf (fp->fp, "  1\n%s\n", dxf_attdef_get_default_value (attdef));
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -680,15 +682,15 @@ dxf_attdef_write
         }
         if (dxf_attdef_get_rot_angle (attdef) != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", dxf_attdef_get_rot_angle (attdef));
+                dxf_write_real (fp, 50, dxf_attdef_get_rot_angle (attdef));
         }
         if (dxf_attdef_get_rel_x_scale (attdef) != 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", dxf_attdef_get_rel_x_scale (attdef));
+                dxf_write_real (fp, 41, dxf_attdef_get_rel_x_scale (attdef));
         }
         if (dxf_attdef_get_obl_angle (attdef) != 0.0)
         {
-                fprintf (fp->fp, " 51\n%f\n", dxf_attdef_get_obl_angle (attdef));
+                dxf_write_real (fp, 51, dxf_attdef_get_obl_angle (attdef));
         }
         if (strcmp (dxf_attdef_get_text_style (attdef), "STANDARD") != 0)
         {
@@ -712,10 +714,10 @@ dxf_attdef_write
                         && (dxf_attdef_get_y0 (attdef) == dxf_attdef_get_y1 (attdef))
                         && (dxf_attdef_get_z0 (attdef) == dxf_attdef_get_z1 (attdef)))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x.\n")),
                           __FUNCTION__, dxf_entity_name, dxf_attdef_get_id_code (attdef));
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                           (_("\tdefault justification applied to %s entity.\n")),
                           dxf_entity_name);
                         dxf_attdef_set_hor_align (attdef, 0);
@@ -723,19 +725,19 @@ dxf_attdef_write
                 }
                 else
                 {
-                        fprintf (fp->fp, " 11\n%f\n", dxf_attdef_get_x1 (attdef));
-                        fprintf (fp->fp, " 21\n%f\n", dxf_attdef_get_y1 (attdef));
-                        fprintf (fp->fp, " 31\n%f\n", dxf_attdef_get_z1 (attdef));
+                        dxf_write_real (fp, 11, dxf_attdef_get_x1 (attdef));
+                        dxf_write_real (fp, 21, dxf_attdef_get_y1 (attdef));
+                        dxf_write_real (fp, 31, dxf_attdef_get_z1 (attdef));
                 }
         }
         if (fp->acad_version_number >= AutoCAD_12)
         {
-                fprintf (fp->fp, "210\n%f\n", dxf_attdef_get_extr_x0 (attdef));
-                fprintf (fp->fp, "220\n%f\n", dxf_attdef_get_extr_y0 (attdef));
-                fprintf (fp->fp, "230\n%f\n", dxf_attdef_get_extr_z0 (attdef));
+                dxf_write_real (fp, 210, dxf_attdef_get_extr_x0 (attdef));
+                dxf_write_real (fp, 220, dxf_attdef_get_extr_y0 (attdef));
+                dxf_write_real (fp, 230, dxf_attdef_get_extr_z0 (attdef));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -762,20 +764,20 @@ dxf_attdef_free
 #endif
         if (attdef->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (attdef->linetype);
-        free (attdef->layer);
-        free (attdef->default_value);
-        free (attdef->tag_value);
-        free (attdef->prompt_value);
-        free (attdef->text_style);
-        free (attdef->dictionary_owner_soft);
-        free (attdef->dictionary_owner_hard);
-        free (attdef);
+        dxf_free (attdef->linetype);
+        dxf_free (attdef->layer);
+        dxf_free (attdef->default_value);
+        dxf_free (attdef->tag_value);
+        dxf_free (attdef->prompt_value);
+        dxf_free (attdef->text_style);
+        dxf_free (attdef->dictionary_owner_soft);
+        dxf_free (attdef->dictionary_owner_hard);
+        dxf_free (attdef);
         attdef = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -795,18 +797,19 @@ dxf_attdef_free_chain
                 /*!< pointer to the chain of DXF \c ATTDEF entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (attdefs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (attdefs != NULL)
         {
                 struct DxfAttdef *iter = attdefs->next;
+                attdefs->next = NULL;
                 dxf_attdef_free (attdefs);
                 attdefs = (DxfAttdef *) iter;
         }
@@ -834,14 +837,14 @@ dxf_attdef_get_id_code
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -873,14 +876,14 @@ dxf_attdef_set_id_code
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -911,14 +914,14 @@ dxf_attdef_get_linetype
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -926,7 +929,7 @@ dxf_attdef_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->linetype));
+        return (dxf_strdup (attdef->linetype));
 }
 
 
@@ -948,19 +951,19 @@ dxf_attdef_set_linetype
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->linetype = strdup (linetype);
+        attdef->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -986,14 +989,14 @@ dxf_attdef_get_layer
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1001,7 +1004,7 @@ dxf_attdef_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->layer));
+        return (dxf_strdup (attdef->layer));
 }
 
 
@@ -1023,19 +1026,19 @@ dxf_attdef_set_layer
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->layer = strdup (layer);
+        attdef->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1061,7 +1064,7 @@ dxf_attdef_get_elevation
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1091,7 +1094,7 @@ dxf_attdef_set_elevation
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1122,14 +1125,14 @@ dxf_attdef_get_thickness
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1159,14 +1162,14 @@ dxf_attdef_set_thickness
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1197,14 +1200,14 @@ dxf_attdef_get_linetype_scale
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1234,14 +1237,14 @@ dxf_attdef_set_linetype_scale
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1272,21 +1275,21 @@ dxf_attdef_get_visibility
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1316,21 +1319,21 @@ dxf_attdef_set_visibility
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1361,14 +1364,14 @@ dxf_attdef_get_color
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1397,14 +1400,14 @@ dxf_attdef_set_color
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1434,20 +1437,20 @@ dxf_attdef_get_paperspace
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (attdef->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found.\n")),
                   __FUNCTION__);
         }
@@ -1476,21 +1479,21 @@ dxf_attdef_set_paperspace
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1523,20 +1526,20 @@ dxf_attdef_get_graphics_data_size
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (attdef->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found.\n")),
                   __FUNCTION__);
         }
@@ -1570,21 +1573,21 @@ dxf_attdef_set_graphics_data_size
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1615,21 +1618,21 @@ dxf_attdef_get_shadow_mode
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1662,21 +1665,21 @@ dxf_attdef_set_shadow_mode
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1710,14 +1713,14 @@ dxf_attdef_get_binary_graphics_data
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1749,14 +1752,14 @@ dxf_attdef_set_binary_graphics_data
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1790,14 +1793,14 @@ dxf_attdef_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1805,7 +1808,7 @@ dxf_attdef_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->dictionary_owner_soft));
+        return (dxf_strdup (attdef->dictionary_owner_soft));
 }
 
 
@@ -1829,19 +1832,19 @@ dxf_attdef_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        attdef->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1870,14 +1873,14 @@ dxf_attdef_get_material
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1885,7 +1888,7 @@ dxf_attdef_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->material));
+        return (dxf_strdup (attdef->material));
 }
 
 
@@ -1911,19 +1914,19 @@ dxf_attdef_set_material
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->material = strdup (material);
+        attdef->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1952,14 +1955,14 @@ dxf_attdef_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1967,7 +1970,7 @@ dxf_attdef_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->dictionary_owner_hard));
+        return (dxf_strdup (attdef->dictionary_owner_hard));
 }
 
 
@@ -1991,19 +1994,19 @@ dxf_attdef_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        attdef->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2030,7 +2033,7 @@ dxf_attdef_get_lineweight
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2063,7 +2066,7 @@ dxf_attdef_set_lineweight
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2095,14 +2098,14 @@ dxf_attdef_get_plot_style_name
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2110,7 +2113,7 @@ dxf_attdef_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->plot_style_name));
+        return (dxf_strdup (attdef->plot_style_name));
 }
 
 
@@ -2136,19 +2139,19 @@ dxf_attdef_set_plot_style_name
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->plot_style_name = strdup (plot_style_name);
+        attdef->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2175,7 +2178,7 @@ dxf_attdef_get_color_value
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2208,7 +2211,7 @@ dxf_attdef_set_color_value
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2240,14 +2243,14 @@ dxf_attdef_get_color_name
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2255,7 +2258,7 @@ dxf_attdef_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->color_name));
+        return (dxf_strdup (attdef->color_name));
 }
 
 
@@ -2281,19 +2284,19 @@ dxf_attdef_set_color_name
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->color_name = strdup (color_name);
+        attdef->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2320,7 +2323,7 @@ dxf_attdef_get_transparency
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2353,7 +2356,7 @@ dxf_attdef_set_transparency
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2386,14 +2389,14 @@ dxf_attdef_get_default_value
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->default_value ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2401,7 +2404,7 @@ dxf_attdef_get_default_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->default_value));
+        return (dxf_strdup (attdef->default_value));
 }
 
 
@@ -2424,19 +2427,19 @@ dxf_attdef_set_default_value
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (default_value == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->default_value = strdup (default_value);
+        attdef->default_value = dxf_strdup (default_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2464,14 +2467,14 @@ dxf_attdef_get_tag_value
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->tag_value ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2479,7 +2482,7 @@ dxf_attdef_get_tag_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->tag_value));
+        return (dxf_strdup (attdef->tag_value));
 }
 
 
@@ -2502,19 +2505,19 @@ dxf_attdef_set_tag_value
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (tag_value == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->tag_value = strdup (tag_value);
+        attdef->tag_value = dxf_strdup (tag_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2542,14 +2545,14 @@ dxf_attdef_get_prompt_value
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->prompt_value ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2557,7 +2560,7 @@ dxf_attdef_get_prompt_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->prompt_value));
+        return (dxf_strdup (attdef->prompt_value));
 }
 
 
@@ -2580,19 +2583,19 @@ dxf_attdef_set_prompt_value
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (prompt_value == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->prompt_value = strdup (prompt_value);
+        attdef->prompt_value = dxf_strdup (prompt_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2620,14 +2623,14 @@ dxf_attdef_get_text_style
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->text_style ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2635,7 +2638,7 @@ dxf_attdef_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attdef->text_style));
+        return (dxf_strdup (attdef->text_style));
 }
 
 
@@ -2658,19 +2661,19 @@ dxf_attdef_set_text_style
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (text_style == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attdef->text_style = strdup (text_style);
+        attdef->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2690,20 +2693,20 @@ dxf_attdef_get_p0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2730,20 +2733,20 @@ dxf_attdef_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2769,21 +2772,21 @@ dxf_attdef_get_x0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2812,20 +2815,20 @@ dxf_attdef_set_x0
                  * DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2851,21 +2854,21 @@ dxf_attdef_get_y0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2894,20 +2897,20 @@ dxf_attdef_set_y0
                  * DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2933,21 +2936,21 @@ dxf_attdef_get_z0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2976,20 +2979,20 @@ dxf_attdef_set_z0
                  * DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3014,20 +3017,20 @@ dxf_attdef_get_p1
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3054,20 +3057,20 @@ dxf_attdef_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3093,21 +3096,21 @@ dxf_attdef_get_x1
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3136,20 +3139,20 @@ dxf_attdef_set_x1
                  * a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3175,21 +3178,21 @@ dxf_attdef_get_y1
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3218,20 +3221,20 @@ dxf_attdef_set_y1
                  * \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3257,21 +3260,21 @@ dxf_attdef_get_z1
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3300,20 +3303,20 @@ dxf_attdef_set_z1
                  * a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3344,14 +3347,14 @@ dxf_attdef_get_height
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->height < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3381,14 +3384,14 @@ dxf_attdef_set_height
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (height < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3419,14 +3422,14 @@ dxf_attdef_get_rel_x_scale
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->height < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3456,7 +3459,7 @@ dxf_attdef_set_rel_x_scale
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3487,7 +3490,7 @@ dxf_attdef_get_rot_angle
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3518,7 +3521,7 @@ dxf_attdef_set_rot_angle
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3550,7 +3553,7 @@ dxf_attdef_get_obl_angle
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3581,7 +3584,7 @@ dxf_attdef_set_obl_angle
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3613,21 +3616,21 @@ dxf_attdef_get_attr_flags
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->attr_flags < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->attr_flags > 8)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3657,21 +3660,21 @@ dxf_attdef_set_attr_flags
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attr_flags < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attr_flags > 8)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3703,7 +3706,7 @@ dxf_attdef_is_invisible
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3734,7 +3737,7 @@ dxf_attdef_is_constant
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3765,7 +3768,7 @@ dxf_attdef_is_verification_required
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3797,7 +3800,7 @@ dxf_attdef_is_preset
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3827,21 +3830,21 @@ dxf_attdef_get_text_flags
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->text_flags < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->text_flags > 4)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3871,21 +3874,21 @@ dxf_attdef_set_text_flags
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (text_flags < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (text_flags > 4)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3916,21 +3919,21 @@ dxf_attdef_get_hor_align
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->hor_align < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->hor_align > 5)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3960,21 +3963,21 @@ dxf_attdef_set_hor_align
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hor_align < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hor_align > 5)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4007,14 +4010,14 @@ dxf_attdef_get_field_length
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->field_length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4046,14 +4049,14 @@ dxf_attdef_set_field_length
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (field_length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4084,21 +4087,21 @@ dxf_attdef_get_vert_align
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->vert_align < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attdef->vert_align > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4128,21 +4131,21 @@ dxf_attdef_set_vert_align
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (vert_align < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (vert_align > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4168,14 +4171,14 @@ dxf_attdef_get_extr_x0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4203,13 +4206,13 @@ dxf_attdef_set_extr_x0
                 /*!< the X-value of the extrusion vector of the entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4235,14 +4238,14 @@ dxf_attdef_get_extr_y0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4271,13 +4274,13 @@ dxf_attdef_set_extr_y0
                  * \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4303,14 +4306,14 @@ dxf_attdef_get_extr_z0
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4339,13 +4342,13 @@ dxf_attdef_set_extr_z0
                  * \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4373,7 +4376,7 @@ dxf_attdef_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c ATTDEF entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -4381,7 +4384,7 @@ dxf_attdef_get_extrusion_vector_as_point
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4389,7 +4392,7 @@ dxf_attdef_get_extrusion_vector_as_point
         point = dxf_point_init (point);
         if (point == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -4423,14 +4426,14 @@ dxf_attdef_set_extrusion_vector_from_point
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4467,7 +4470,7 @@ dxf_attdef_set_extrusion_vector
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4503,14 +4506,14 @@ dxf_attdef_get_next
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4541,14 +4544,14 @@ dxf_attdef_set_next
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4582,14 +4585,14 @@ dxf_attdef_get_last
         /* Do some basic checks. */
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attdef->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfAttdef *) attdef);
@@ -60,6 +60,9 @@ extern "C" {
 typedef struct
 dxf_attdef_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -40,6 +40,7 @@
 
 
 #include "attrib.h"
+#include "util.h"
 
 
 /*!
@@ -59,9 +60,9 @@ dxf_attrib_new ()
         size = sizeof (DxfAttrib);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((attrib = malloc (size)) == NULL)
+        if ((attrib = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfAttrib struct.\n")),
                   __FUNCTION__);
                 attrib = NULL;
@@ -69,6 +70,7 @@ dxf_attrib_new ()
         else
         {
                 memset (attrib, 0, size);
+                attrib->header.type = ATTRIB;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -97,22 +99,22 @@ dxf_attrib_init
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 attrib = dxf_attrib_new ();
         }
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfAttrib struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_attrib_set_id_code (attrib, 0);
-        dxf_attrib_set_linetype (attrib, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_attrib_set_text_style (attrib, strdup (DXF_DEFAULT_TEXTSTYLE));
-        dxf_attrib_set_layer (attrib, strdup (DXF_DEFAULT_LAYER));
+        dxf_attrib_set_linetype (attrib, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_attrib_set_text_style (attrib, dxf_strdup (DXF_DEFAULT_TEXTSTYLE));
+        dxf_attrib_set_layer (attrib, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_attrib_set_elevation (attrib, 0.0);
         dxf_attrib_set_thickness (attrib, 0.0);
         dxf_attrib_set_linetype_scale (attrib, DXF_DEFAULT_LINETYPE_SCALE);
@@ -123,16 +125,16 @@ dxf_attrib_init
         dxf_attrib_set_shadow_mode (attrib, 0);
         dxf_attrib_set_binary_graphics_data (attrib, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_attrib_get_binary_graphics_data (attrib));
-        dxf_attrib_set_dictionary_owner_soft (attrib, strdup(""));
-        dxf_attrib_set_material (attrib, strdup (""));
-        dxf_attrib_set_dictionary_owner_hard (attrib, strdup(""));
+        dxf_attrib_set_dictionary_owner_soft (attrib, dxf_strdup(""));
+        dxf_attrib_set_material (attrib, dxf_strdup (""));
+        dxf_attrib_set_dictionary_owner_hard (attrib, dxf_strdup(""));
         dxf_attrib_set_lineweight (attrib, 0);
-        dxf_attrib_set_plot_style_name (attrib, strdup (""));
+        dxf_attrib_set_plot_style_name (attrib, dxf_strdup (""));
         dxf_attrib_set_color_value (attrib, 0);
-        dxf_attrib_set_color_name (attrib, strdup (""));
+        dxf_attrib_set_color_name (attrib, dxf_strdup (""));
         dxf_attrib_set_transparency (attrib, 0);
-        dxf_attrib_set_default_value (attrib, strdup (""));
-        dxf_attrib_set_tag_value (attrib, strdup (""));
+        dxf_attrib_set_default_value (attrib, dxf_strdup (""));
+        dxf_attrib_set_tag_value (attrib, dxf_strdup (""));
         dxf_attrib_set_p0 (attrib, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_attrib_get_p0 (attrib));
         dxf_attrib_set_x0 (attrib, 0.0);
@@ -187,38 +189,34 @@ dxf_attrib_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 attrib = dxf_attrib_new ();
                 attrib = dxf_attrib_init (attrib);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -226,13 +224,13 @@ dxf_attrib_read
                         /* Now follows a string containing the attribute
                          * value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->default_value);
+                        dxf_read_string (fp, &attrib->default_value);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a tag value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->tag_value);
+                        dxf_read_string (fp, &attrib->tag_value);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -246,19 +244,19 @@ dxf_attrib_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->linetype);
+                        dxf_read_string (fp, &attrib->linetype);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
                         /* Now follows a string containing a text style. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->text_style);
+                        dxf_read_string (fp, &attrib->text_style);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->layer);
+                        dxf_read_string (fp, &attrib->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -426,7 +424,7 @@ dxf_attrib_read
                         && (strcmp (temp_string, "AcDbText") != 0)
                         && (strcmp (temp_string, "AcDbAttribute") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -457,14 +455,14 @@ dxf_attrib_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->dictionary_owner_soft);
+                        dxf_read_string (fp, &attrib->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", attrib->dictionary_owner_hard);
+                        dxf_read_string (fp, &attrib->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -475,26 +473,30 @@ dxf_attrib_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_attrib_get_linetype (attrib), "") == 0)
         {
-                dxf_attrib_set_linetype (attrib, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_string_assign (&attrib->linetype, DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (dxf_attrib_get_layer (attrib), "") == 0)
         {
-                dxf_attrib_set_layer (attrib, strdup (DXF_DEFAULT_LAYER));
+                dxf_string_assign (&attrib->layer, DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (attrib);
 }
 
 
@@ -513,91 +515,91 @@ dxf_attrib_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ATTRIB");
+        char *dxf_entity_name = dxf_strdup ("ATTRIB");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_attrib_get_default_value (attrib), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () default value string is empty for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attrib_get_id_code (attrib));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_attrib_get_tag_value (attrib), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () tag value string is empty for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attrib_get_id_code (attrib));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_attrib_get_text_style (attrib), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () text style string is empty for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attrib_get_id_code (attrib));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tdefault text style STANDARD applied to %s entity.\n")),
                   dxf_entity_name);
-                dxf_attrib_set_text_style (attrib, strdup (DXF_DEFAULT_TEXTSTYLE));
+                dxf_attrib_set_text_style (attrib, dxf_strdup (DXF_DEFAULT_TEXTSTYLE));
         }
         if (strcmp (dxf_attrib_get_linetype (attrib), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attrib_get_id_code (attrib));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_attrib_set_linetype (attrib, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_attrib_set_linetype (attrib, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_attrib_get_layer (attrib), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attrib_get_id_code (attrib));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to the default layer.\n")),
                   dxf_entity_name);
-                dxf_attrib_set_layer (attrib, strdup (DXF_DEFAULT_LAYER));
+                dxf_attrib_set_layer (attrib, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         if (dxf_attrib_get_height (attrib) == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attrib_get_id_code (attrib));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tdefault height of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
                 dxf_attrib_set_height (attrib, 1.0);
         }
         if (dxf_attrib_get_rel_x_scale (attrib) == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_attrib_get_id_code (attrib));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tdefault relative X-scale of 1.0 applied to %s entity.\n")),
                   dxf_entity_name);
                 dxf_attrib_set_rel_x_scale (attrib, 1.0);
@@ -651,7 +653,7 @@ dxf_attrib_write
         }
         if (dxf_attrib_get_linetype_scale (attrib) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_attrib_get_linetype_scale (attrib));
+                dxf_write_real (fp, 48, dxf_attrib_get_linetype_scale (attrib));
         }
         if (dxf_attrib_get_visibility (attrib) != 0)
         {
@@ -665,16 +667,16 @@ dxf_attrib_write
           && DXF_FLATLAND
           && (dxf_attrib_get_elevation (attrib) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_attrib_get_elevation (attrib));
+                dxf_write_real (fp, 38, dxf_attrib_get_elevation (attrib));
         }
         if (dxf_attrib_get_thickness (attrib) != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_attrib_get_thickness (attrib));
+                dxf_write_real (fp, 39, dxf_attrib_get_thickness (attrib));
         }
-        fprintf (fp->fp, " 10\n%f\n", dxf_attrib_get_x0 (attrib));
-        fprintf (fp->fp, " 20\n%f\n", dxf_attrib_get_y0 (attrib));
-        fprintf (fp->fp, " 30\n%f\n", dxf_attrib_get_z0 (attrib));
-        fprintf (fp->fp, " 40\n%f\n", dxf_attrib_get_height (attrib));
+        dxf_write_real (fp, 10, dxf_attrib_get_x0 (attrib));
+        dxf_write_real (fp, 20, dxf_attrib_get_y0 (attrib));
+        dxf_write_real (fp, 30, dxf_attrib_get_z0 (attrib));
+        dxf_write_real (fp, 40, dxf_attrib_get_height (attrib));
         fprintf (fp->fp, "  1\n%s\n", dxf_attrib_get_default_value (attrib));
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -688,15 +690,15 @@ dxf_attrib_write
         }
         if (dxf_attrib_get_rot_angle (attrib) != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", dxf_attrib_get_rot_angle (attrib));
+                dxf_write_real (fp, 50, dxf_attrib_get_rot_angle (attrib));
         }
         if (dxf_attrib_get_rel_x_scale (attrib)!= 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", dxf_attrib_get_rel_x_scale (attrib));
+                dxf_write_real (fp, 41, dxf_attrib_get_rel_x_scale (attrib));
         }
         if (dxf_attrib_get_obl_angle (attrib) != 0.0)
         {
-                fprintf (fp->fp, " 51\n%f\n", dxf_attrib_get_obl_angle (attrib));
+                dxf_write_real (fp, 51, dxf_attrib_get_obl_angle (attrib));
         }
         if (strcmp (dxf_attrib_get_text_style (attrib), "STANDARD") != 0)
         {
@@ -720,10 +722,10 @@ dxf_attrib_write
                         && (dxf_attrib_get_y0 (attrib) == dxf_attrib_get_y0 (attrib))
                         && (dxf_attrib_get_z0 (attrib) == dxf_attrib_get_z0 (attrib)))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x.\n")),
                           __FUNCTION__, dxf_entity_name, dxf_attrib_get_id_code (attrib));
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                           (_("    default justification applied to %s entity\n")),
                           dxf_entity_name);
                         dxf_attrib_set_hor_align (attrib, 0);
@@ -731,9 +733,9 @@ dxf_attrib_write
                 }
                 else
                 {
-                        fprintf (fp->fp, " 11\n%f\n", dxf_attrib_get_x1 (attrib));
-                        fprintf (fp->fp, " 21\n%f\n", dxf_attrib_get_y1 (attrib));
-                        fprintf (fp->fp, " 31\n%f\n", dxf_attrib_get_z1 (attrib));
+                        dxf_write_real (fp, 11, dxf_attrib_get_x1 (attrib));
+                        dxf_write_real (fp, 21, dxf_attrib_get_y1 (attrib));
+                        dxf_write_real (fp, 31, dxf_attrib_get_z1 (attrib));
                 }
         }
         if ((fp->acad_version_number >= AutoCAD_12)
@@ -741,12 +743,12 @@ dxf_attrib_write
                 && (dxf_attrib_get_extr_y0 (attrib) != 0.0)
                 && (dxf_attrib_get_extr_z0 (attrib) != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", dxf_attrib_get_extr_x0 (attrib));
-                fprintf (fp->fp, "220\n%f\n", dxf_attrib_get_extr_y0 (attrib));
-                fprintf (fp->fp, "230\n%f\n", dxf_attrib_get_extr_z0 (attrib));
+                dxf_write_real (fp, 210, dxf_attrib_get_extr_x0 (attrib));
+                dxf_write_real (fp, 220, dxf_attrib_get_extr_y0 (attrib));
+                dxf_write_real (fp, 230, dxf_attrib_get_extr_z0 (attrib));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -773,25 +775,25 @@ dxf_attrib_free
 #endif
         if (attrib->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfAttrib was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (attrib->linetype);
-        free (attrib->layer);
-        free (attrib->default_value);
-        free (attrib->tag_value);
-        free (attrib->text_style);
+        dxf_free (attrib->linetype);
+        dxf_free (attrib->layer);
+        dxf_free (attrib->default_value);
+        dxf_free (attrib->tag_value);
+        dxf_free (attrib->text_style);
         dxf_binary_graphics_data_free_chain (attrib->binary_graphics_data);
-        free (attrib->dictionary_owner_soft);
-        free (attrib->material);
-        free (attrib->dictionary_owner_hard);
-        free (attrib->plot_style_name);
-        free (attrib->color_name);
+        dxf_free (attrib->dictionary_owner_soft);
+        dxf_free (attrib->material);
+        dxf_free (attrib->dictionary_owner_hard);
+        dxf_free (attrib->plot_style_name);
+        dxf_free (attrib->color_name);
         dxf_point_free (attrib->p0);
         dxf_point_free (attrib->p1);
-        free (attrib);
+        dxf_free (attrib);
         attrib = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -811,18 +813,19 @@ dxf_attrib_free_chain
                 /*!< pointer to the chain of DXF ATTRIB entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (attribs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (attribs != NULL)
         {
                 struct DxfAttrib *iter = attribs->next;
+                attribs->next = NULL;
                 dxf_attrib_free (attribs);
                 attribs = (DxfAttrib *) iter;
         }
@@ -850,14 +853,14 @@ dxf_attrib_get_id_code
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -889,14 +892,14 @@ dxf_attrib_set_id_code
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -927,14 +930,14 @@ dxf_attrib_get_linetype
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -942,7 +945,7 @@ dxf_attrib_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->linetype));
+        return (dxf_strdup (attrib->linetype));
 }
 
 
@@ -964,19 +967,19 @@ dxf_attrib_set_linetype
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->linetype = strdup (linetype);
+        attrib->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1002,14 +1005,14 @@ dxf_attrib_get_layer
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1017,7 +1020,7 @@ dxf_attrib_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->layer));
+        return (dxf_strdup (attrib->layer));
 }
 
 
@@ -1039,19 +1042,19 @@ dxf_attrib_set_layer
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->layer = strdup (layer);
+        attrib->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1077,7 +1080,7 @@ dxf_attrib_get_elevation
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1107,7 +1110,7 @@ dxf_attrib_set_elevation
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1138,14 +1141,14 @@ dxf_attrib_get_thickness
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1175,14 +1178,14 @@ dxf_attrib_set_thickness
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1213,14 +1216,14 @@ dxf_attrib_get_linetype_scale
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1250,14 +1253,14 @@ dxf_attrib_set_linetype_scale
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative linetype scale value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1288,21 +1291,21 @@ dxf_attrib_get_visibility
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1332,21 +1335,21 @@ dxf_attrib_set_visibility
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1377,14 +1380,14 @@ dxf_attrib_get_color
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1413,17 +1416,17 @@ dxf_attrib_set_color
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         attrib->color = color;
@@ -1452,20 +1455,20 @@ dxf_attrib_get_paperspace
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (attrib->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1494,21 +1497,21 @@ dxf_attrib_set_paperspace
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1541,20 +1544,20 @@ dxf_attrib_get_graphics_data_size
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
         if (attrib->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
@@ -1588,21 +1591,21 @@ dxf_attrib_set_graphics_data_size
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1633,21 +1636,21 @@ dxf_attrib_get_shadow_mode
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1680,21 +1683,21 @@ dxf_attrib_set_shadow_mode
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1728,14 +1731,14 @@ dxf_attrib_get_binary_graphics_data
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1767,14 +1770,14 @@ dxf_attrib_set_binary_graphics_data
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1808,14 +1811,14 @@ dxf_attrib_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1823,7 +1826,7 @@ dxf_attrib_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->dictionary_owner_soft));
+        return (dxf_strdup (attrib->dictionary_owner_soft));
 }
 
 
@@ -1847,19 +1850,19 @@ dxf_attrib_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        attrib->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1888,14 +1891,14 @@ dxf_attrib_get_material
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the material member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1903,7 +1906,7 @@ dxf_attrib_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->material));
+        return (dxf_strdup (attrib->material));
 }
 
 
@@ -1929,19 +1932,19 @@ dxf_attrib_set_material
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->material = strdup (material);
+        attrib->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1970,14 +1973,14 @@ dxf_attrib_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1985,7 +1988,7 @@ dxf_attrib_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->dictionary_owner_hard));
+        return (dxf_strdup (attrib->dictionary_owner_hard));
 }
 
 
@@ -2009,19 +2012,19 @@ dxf_attrib_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        attrib->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2048,7 +2051,7 @@ dxf_attrib_get_lineweight
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2081,7 +2084,7 @@ dxf_attrib_set_lineweight
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2113,14 +2116,14 @@ dxf_attrib_get_plot_style_name
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2128,7 +2131,7 @@ dxf_attrib_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->plot_style_name));
+        return (dxf_strdup (attrib->plot_style_name));
 }
 
 
@@ -2154,19 +2157,19 @@ dxf_attrib_set_plot_style_name
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->plot_style_name = strdup (plot_style_name);
+        attrib->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2193,7 +2196,7 @@ dxf_attrib_get_color_value
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2226,7 +2229,7 @@ dxf_attrib_set_color_value
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2258,14 +2261,14 @@ dxf_attrib_get_color_name
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2273,7 +2276,7 @@ dxf_attrib_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->color_name));
+        return (dxf_strdup (attrib->color_name));
 }
 
 
@@ -2299,19 +2302,19 @@ dxf_attrib_set_color_name
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->color_name = strdup (color_name);
+        attrib->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2338,7 +2341,7 @@ dxf_attrib_get_transparency
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2371,7 +2374,7 @@ dxf_attrib_set_transparency
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2404,14 +2407,14 @@ dxf_attrib_get_default_value
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->default_value ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the default_value member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2419,7 +2422,7 @@ dxf_attrib_get_default_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->default_value));
+        return (dxf_strdup (attrib->default_value));
 }
 
 
@@ -2442,19 +2445,19 @@ dxf_attrib_set_default_value
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (default_value == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->default_value = strdup (default_value);
+        attrib->default_value = dxf_strdup (default_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2482,14 +2485,14 @@ dxf_attrib_get_tag_value
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->tag_value ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the tag_value member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2497,7 +2500,7 @@ dxf_attrib_get_tag_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->tag_value));
+        return (dxf_strdup (attrib->tag_value));
 }
 
 
@@ -2520,19 +2523,19 @@ dxf_attrib_set_tag_value
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (tag_value == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->tag_value = strdup (tag_value);
+        attrib->tag_value = dxf_strdup (tag_value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2560,14 +2563,14 @@ dxf_attrib_get_text_style
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->text_style ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the tag_value member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2575,7 +2578,7 @@ dxf_attrib_get_text_style
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (attrib->text_style));
+        return (dxf_strdup (attrib->text_style));
 }
 
 
@@ -2598,19 +2601,19 @@ dxf_attrib_set_text_style
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (text_style == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        attrib->text_style = strdup (text_style);
+        attrib->text_style = dxf_strdup (text_style);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2630,20 +2633,20 @@ dxf_attrib_get_p0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->p0 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -2669,20 +2672,20 @@ dxf_attrib_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2708,21 +2711,21 @@ dxf_attrib_get_x0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2751,20 +2754,20 @@ dxf_attrib_set_x0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2790,21 +2793,21 @@ dxf_attrib_get_y0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2833,20 +2836,20 @@ dxf_attrib_set_y0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2872,21 +2875,21 @@ dxf_attrib_get_z0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2915,20 +2918,20 @@ dxf_attrib_set_z0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2953,20 +2956,20 @@ dxf_attrib_get_p1
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->p1 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -2992,20 +2995,20 @@ dxf_attrib_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3031,21 +3034,21 @@ dxf_attrib_get_x1
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3073,20 +3076,20 @@ dxf_attrib_set_x1
                 /*!< the X-value \c x1 of a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3112,21 +3115,21 @@ dxf_attrib_get_y1
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3154,20 +3157,20 @@ dxf_attrib_set_y1
                 /*!< the Y-value \c y1 of a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3193,21 +3196,21 @@ dxf_attrib_get_z1
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3235,20 +3238,20 @@ dxf_attrib_set_z1
                 /*!< the Z-value \c z1 of a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3279,14 +3282,14 @@ dxf_attrib_get_height
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->height < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the height member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3316,14 +3319,14 @@ dxf_attrib_set_height
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (height < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative height value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3354,14 +3357,14 @@ dxf_attrib_get_rel_x_scale
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->height < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the rel_x_scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3391,7 +3394,7 @@ dxf_attrib_set_rel_x_scale
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3422,7 +3425,7 @@ dxf_attrib_get_rot_angle
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3453,7 +3456,7 @@ dxf_attrib_set_rot_angle
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3485,7 +3488,7 @@ dxf_attrib_get_obl_angle
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3516,7 +3519,7 @@ dxf_attrib_set_obl_angle
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3548,21 +3551,21 @@ dxf_attrib_get_attr_flags
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->attr_flags < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the attr_flags member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->attr_flags > 8)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found in the attr_flags member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3592,21 +3595,21 @@ dxf_attrib_set_attr_flags
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attr_flags < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value in attribute flags was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attr_flags > 8)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a invalid value in attribute flags was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3638,7 +3641,7 @@ dxf_attrib_is_invisible
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3669,7 +3672,7 @@ dxf_attrib_is_constant
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3700,7 +3703,7 @@ dxf_attrib_is_verification_required
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3731,7 +3734,7 @@ dxf_attrib_is_preset
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3761,21 +3764,21 @@ dxf_attrib_get_text_flags
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->text_flags < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the text flags member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->text_flags > 4)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found in the text flags member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3805,21 +3808,21 @@ dxf_attrib_set_text_flags
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (text_flags < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value in text flags was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (text_flags > 4)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a invalid value in text flags was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3850,21 +3853,21 @@ dxf_attrib_get_hor_align
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->hor_align < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the hor_align member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->hor_align > 5)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found in the hor_align member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3894,21 +3897,21 @@ dxf_attrib_set_hor_align
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hor_align < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value in horizontal alignment was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hor_align > 5)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value in horizontal alignment was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3941,14 +3944,14 @@ dxf_attrib_get_field_length
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->field_length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the field_length member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3980,14 +3983,14 @@ dxf_attrib_set_field_length
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (field_length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value in field length was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4018,21 +4021,21 @@ dxf_attrib_get_vert_align
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->vert_align < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the vert_align member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (attrib->vert_align > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found in the vert_align member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4062,21 +4065,21 @@ dxf_attrib_set_vert_align
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (vert_align < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value in vertical alignment was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (vert_align > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value in vertical alignment was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4102,14 +4105,14 @@ dxf_attrib_get_extr_x0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4138,13 +4141,13 @@ dxf_attrib_set_extr_x0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4170,14 +4173,14 @@ dxf_attrib_get_extr_y0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4206,13 +4209,13 @@ dxf_attrib_set_extr_y0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4238,14 +4241,14 @@ dxf_attrib_get_extr_z0
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4274,13 +4277,13 @@ dxf_attrib_set_extr_z0
                  * \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4308,7 +4311,7 @@ dxf_attrib_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c ATTRIB entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -4316,7 +4319,7 @@ dxf_attrib_get_extrusion_vector_as_point
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4324,7 +4327,7 @@ dxf_attrib_get_extrusion_vector_as_point
         point = dxf_point_init (point);
         if (point == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -4358,14 +4361,14 @@ dxf_attrib_set_extrusion_vector_from_point
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4402,7 +4405,7 @@ dxf_attrib_set_extrusion_vector
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4438,14 +4441,14 @@ dxf_attrib_get_next
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4476,14 +4479,14 @@ dxf_attrib_set_next
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4517,14 +4520,14 @@ dxf_attrib_get_last
         /* Do some basic checks. */
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attrib->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfAttrib *) attrib);
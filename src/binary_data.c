@@ -0,0 +1,679 @@
+/*!
+ * \file binary_data.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF binary data decoded from consecutive
+ * binary chunk groups (group code 310).
+ *
+ * A chain of hexadecimal lines takes more than twice the memory of the
+ * data it holds, one allocation per line included.\n
+ * A \c DxfBinaryData decodes the lines while they are read and appends
+ * the bytes to one growing block, the text is only kept on request.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "binary_data.h"
+#include "hex.h"
+
+
+#define DXF_BINARY_DATA_CHUNK 512
+        /*!< \brief Number of characters of a group value decoded at
+         * once while reading, has to be even. */
+
+
+/*!
+ * \brief Allocate memory for binary data.
+ *
+ * \return a pointer to the binary data, or \c NULL when an error
+ * occurred.
+ */
+DxfBinaryData *
+dxf_binary_data_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBinaryData *data = NULL;
+        size_t size;
+
+        size = sizeof (DxfBinaryData);
+        if ((data = dxf_malloc (size)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfBinaryData struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (data, 0, size);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (data);
+}
+
+
+/*!
+ * \brief Free the allocated memory for binary data.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_data_free
+(
+        DxfBinaryData *data
+                /*!< a pointer to the binary data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (data->bytes);
+        dxf_free (data->text);
+        dxf_free (data);
+        data = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all bytes and text from binary data, the memory is kept
+ * for reuse.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_data_clear
+(
+        DxfBinaryData *data
+                /*!< a pointer to the binary data. */
+)
+{
+        if (data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        data->number_of_bytes = 0;
+        data->text_length = 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make room for more bytes.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_binary_data_reserve
+(
+        DxfBinaryData *data,
+                /*!< a pointer to the binary data. */
+        size_t size
+                /*!< number of bytes to be added. */
+)
+{
+        unsigned char *bytes;
+        size_t capacity;
+
+        if (data->number_of_bytes + size <= data->capacity)
+        {
+                return (EXIT_SUCCESS);
+        }
+        capacity = (data->capacity == 0) ? 1024 : 2 * data->capacity;
+        if (capacity < data->number_of_bytes + size)
+        {
+                capacity = data->number_of_bytes + size;
+        }
+        bytes = dxf_realloc (data->bytes, capacity);
+        if (bytes == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        data->bytes = bytes;
+        data->capacity = capacity;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append characters to the kept text.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_binary_data_append_text
+(
+        DxfBinaryData *data,
+                /*!< a pointer to the binary data. */
+        const char *text,
+                /*!< the characters. */
+        size_t length
+                /*!< number of characters. */
+)
+{
+        char *new_text;
+        size_t capacity;
+
+        if (data->text_length + length > data->text_capacity)
+        {
+                capacity = (data->text_capacity == 0) ? 2048 : 2 * data->text_capacity;
+                if (capacity < data->text_length + length)
+                {
+                        capacity = data->text_length + length;
+                }
+                new_text = dxf_realloc (data->text, capacity);
+                if (new_text == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                data->text = new_text;
+                data->text_capacity = capacity;
+        }
+        memcpy (data->text + data->text_length, text, length);
+        data->text_length += length;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Decode a part of a group value and append the bytes, and the
+ * text when \c keep_text is set.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_binary_data_decode
+(
+        DxfBinaryData *data,
+                /*!< a pointer to the binary data. */
+        const char *text,
+                /*!< the hexadecimal text. */
+        size_t length,
+                /*!< number of characters, even. */
+        int keep_text
+                /*!< keep the text. */
+)
+{
+        if (dxf_binary_data_reserve (data, length / 2) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_hex_decode (text, length, data->bytes + data->number_of_bytes) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (keep_text
+          && (dxf_binary_data_append_text (data, text, length) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        data->number_of_bytes += length / 2;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append bytes to binary data.
+ *
+ * The kept text no longer matches the bytes and is dropped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_data_append_bytes
+(
+        DxfBinaryData *data,
+                /*!< a pointer to the binary data. */
+        const unsigned char *bytes,
+                /*!< the bytes to append. */
+        size_t size
+                /*!< number of bytes. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((data == NULL) || ((size > 0) && (bytes == NULL)))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_binary_data_reserve (data, size) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        memcpy (data->bytes + data->number_of_bytes, bytes, size);
+        data->number_of_bytes += size;
+        data->text_length = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append the hexadecimal text of one binary chunk group to
+ * binary data.
+ *
+ * The text is kept as a line of its own when \c keep_text is set and
+ * all earlier data was appended with its text.\n
+ * Nothing is appended when an error occurred.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the text
+ * is not valid hexadecimal data or an error occurred.
+ */
+int
+dxf_binary_data_append_hex
+(
+        DxfBinaryData *data,
+                /*!< a pointer to the binary data. */
+        const char *text,
+                /*!< the hexadecimal text. */
+        size_t length,
+                /*!< number of characters in \c text. */
+        int keep_text
+                /*!< keep the text for writing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t text_length;
+
+        /* Do some basic checks. */
+        if ((data == NULL) || ((length > 0) && (text == NULL)))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        keep_text = keep_text
+          && ((data->text_length > 0) || (data->number_of_bytes == 0));
+        text_length = data->text_length;
+        if ((dxf_binary_data_decode (data, text, length, keep_text) == EXIT_FAILURE)
+          || (keep_text
+          && (dxf_binary_data_append_text (data, "\n", 1) == EXIT_FAILURE)))
+        {
+                data->text_length = text_length;
+                return (EXIT_FAILURE);
+        }
+        if (!keep_text)
+        {
+                data->text_length = 0;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read the value of a binary chunk group from a file and append
+ * it to binary data.
+ *
+ * The last line read from file contained the group code 310, the
+ * remainder of that line is skipped.\n
+ * The value is decoded in parts while it is read, so its length is not
+ * limited.\n
+ * The text is kept when the \c keep_binary_text member of \c fp is set.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the value
+ * is not valid hexadecimal data or an error occurred, nothing is
+ * appended then.
+ */
+int
+dxf_binary_data_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfBinaryData *data
+                /*!< a pointer to the binary data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char buffer[DXF_BINARY_DATA_CHUNK];
+        size_t length = 0;
+        size_t number_of_bytes;
+        size_t text_length;
+        int keep_text;
+        int status = EXIT_SUCCESS;
+        int c;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (data == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        keep_text = fp->keep_binary_text
+          && ((data->text_length > 0) || (data->number_of_bytes == 0));
+        number_of_bytes = data->number_of_bytes;
+        text_length = data->text_length;
+        /* Skip the remainder of the group code line. */
+        while (((c = getc (fp->fp)) != EOF) && (c != '\n'))
+        {
+        }
+        while (((c = getc (fp->fp)) != EOF) && (c != '\n'))
+        {
+                if (length == DXF_BINARY_DATA_CHUNK)
+                {
+                        if ((status == EXIT_SUCCESS)
+                          && (dxf_binary_data_decode (data, buffer, length, keep_text) == EXIT_FAILURE))
+                        {
+                                status = EXIT_FAILURE;
+                        }
+                        length = 0;
+                }
+                buffer[length++] = (char) c;
+        }
+        if (ferror (fp->fp))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                status = EXIT_FAILURE;
+        }
+        if ((length > 0) && (buffer[length - 1] == '\r'))
+        {
+                length--;
+        }
+        if ((status == EXIT_FAILURE)
+          || (dxf_binary_data_decode (data, buffer, length, keep_text) == EXIT_FAILURE)
+          || (keep_text
+          && (dxf_binary_data_append_text (data, "\n", 1) == EXIT_FAILURE)))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () invalid binary data found while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                data->number_of_bytes = number_of_bytes;
+                data->text_length = text_length;
+                return (EXIT_FAILURE);
+        }
+        if (!keep_text)
+        {
+                data->text_length = 0;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write binary data to a file as binary chunk groups.
+ *
+ * Kept text is written with its original line breaks, otherwise the
+ * bytes are encoded with \c DXF_BINARY_DATA_BYTES_PER_LINE bytes per
+ * group.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_data_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfBinaryData *data
+                /*!< a pointer to the binary data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char line[2 * DXF_BINARY_DATA_BYTES_PER_LINE + 1];
+        const char *start;
+        const char *end;
+        size_t i;
+        size_t size;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (data == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (data->text_length > 0)
+        {
+                start = data->text;
+                end = data->text + data->text_length;
+                while (start < end)
+                {
+                        size = (const char *) memchr (start, '\n', end - start) - start;
+                        fprintf (fp->fp, "310\n%.*s\n", (int) size, start);
+                        start += size + 1;
+                }
+        }
+        else
+        {
+                for (i = 0; i < data->number_of_bytes; i += size)
+                {
+                        size = data->number_of_bytes - i;
+                        if (size > DXF_BINARY_DATA_BYTES_PER_LINE)
+                        {
+                                size = DXF_BINARY_DATA_BYTES_PER_LINE;
+                        }
+                        dxf_hex_encode (data->bytes + i, size, line);
+                        line[2 * size] = '\0';
+                        fprintf (fp->fp, "310\n%s\n", line);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append the lines of a chain of binary graphics data to binary
+ * data.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a line is
+ * not valid hexadecimal data or an error occurred.
+ */
+int
+dxf_binary_data_append_graphics_data
+(
+        DxfBinaryData *data,
+                /*!< a pointer to the binary data. */
+        DxfBinaryGraphicsData *graphics_data
+                /*!< the first link of the chain. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        while (graphics_data != NULL)
+        {
+                if ((graphics_data->data_line != NULL)
+                  && (dxf_binary_data_append_hex (data, graphics_data->data_line, strlen (graphics_data->data_line), FALSE) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+                graphics_data = (DxfBinaryGraphicsData *) graphics_data->next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append the lines of a chain of binary entity data to binary
+ * data.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a line is
+ * not valid hexadecimal data or an error occurred.
+ */
+int
+dxf_binary_data_append_entity_data
+(
+        DxfBinaryData *data,
+                /*!< a pointer to the binary data. */
+        DxfBinaryEntityData *entity_data
+                /*!< the first link of the chain. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        while (entity_data != NULL)
+        {
+                if ((entity_data->data_line != NULL)
+                  && (dxf_binary_data_append_hex (data, entity_data->data_line, strlen (entity_data->data_line), FALSE) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+                entity_data = (DxfBinaryEntityData *) entity_data->next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of decoded bytes of binary data.
+ *
+ * \return the number of bytes, 0 when an error occurred.
+ */
+size_t
+dxf_binary_data_get_number_of_bytes
+(
+        DxfBinaryData *data
+                /*!< a pointer to the binary data. */
+)
+{
+        if (data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (data->number_of_bytes);
+}
+
+
+/*!
+ * \brief Get the decoded bytes of binary data.
+ *
+ * \return a pointer to the bytes, or \c NULL when no bytes were decoded
+ * or an error occurred.
+ */
+const unsigned char *
+dxf_binary_data_get_bytes
+(
+        DxfBinaryData *data
+                /*!< a pointer to the binary data. */
+)
+{
+        if (data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return ((data->number_of_bytes > 0) ? data->bytes : NULL);
+}
+
+
+/* EOF */
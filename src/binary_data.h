@@ -0,0 +1,104 @@
+/*!
+ * \file binary_data.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF binary data decoded from consecutive
+ * binary chunk groups (group code 310).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_BINARY_DATA_H
+#define LIBDXF_SRC_BINARY_DATA_H
+
+
+#include "global.h"
+#include "binary_entity_data.h"
+#include "binary_graphics_data.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_BINARY_DATA_BYTES_PER_LINE 127
+        /*!< \brief Number of bytes written per binary chunk group,
+         * 254 hexadecimal digits. */
+
+
+/*!
+ * \brief Binary data of consecutive binary chunk groups, decoded into
+ * one contiguous block of bytes.
+ *
+ * The hexadecimal text is only kept when the \c keep_binary_text
+ * member of the \c DxfFile is set while reading, so the data can be
+ * written back with the original line breaks.
+ */
+typedef struct
+dxf_binary_data_struct
+{
+        unsigned char *bytes;
+                /*!< The decoded bytes. */
+        size_t number_of_bytes;
+                /*!< Number of decoded bytes. */
+        size_t capacity;
+                /*!< Number of bytes allocated. */
+        char *text;
+                /*!< The hexadecimal text of the groups, every line
+                 * followed by a newline, or \c NULL. */
+        size_t text_length;
+                /*!< Number of characters in \c text, 0 when the text
+                 * was not kept. */
+        size_t text_capacity;
+                /*!< Number of characters allocated for \c text. */
+} DxfBinaryData;
+
+
+DxfBinaryData *dxf_binary_data_new ();
+int dxf_binary_data_free (DxfBinaryData *data);
+int dxf_binary_data_clear (DxfBinaryData *data);
+int dxf_binary_data_append_bytes (DxfBinaryData *data, const unsigned char *bytes, size_t size);
+int dxf_binary_data_append_hex (DxfBinaryData *data, const char *text, size_t length, int keep_text);
+int dxf_binary_data_read (DxfFile *fp, DxfBinaryData *data);
+int dxf_binary_data_write (DxfFile *fp, DxfBinaryData *data);
+int dxf_binary_data_append_graphics_data (DxfBinaryData *data, DxfBinaryGraphicsData *graphics_data);
+int dxf_binary_data_append_entity_data (DxfBinaryData *data, DxfBinaryEntityData *entity_data);
+size_t dxf_binary_data_get_number_of_bytes (DxfBinaryData *data);
+const unsigned char *dxf_binary_data_get_bytes (DxfBinaryData *data);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_BINARY_DATA_H */
+
+
+/* EOF */
@@ -52,9 +52,9 @@ dxf_binary_entity_data_new ()
         size = sizeof (DxfBinaryEntityData);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
+        if ((data = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfBinaryEntityData struct.\n")),
                   __FUNCTION__);
                 data = NULL;
@@ -90,19 +90,19 @@ dxf_binary_entity_data_init
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 data = dxf_binary_entity_data_new ();
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfBinaryEntityData struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dxf_binary_entity_data_set_data_line (data, strdup (""));
+        dxf_binary_entity_data_set_data_line (data, dxf_strdup (""));
         dxf_binary_entity_data_set_next (data, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -132,7 +132,7 @@ dxf_binary_entity_data_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -167,20 +167,20 @@ dxf_binary_entity_data_free
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfBinaryEntityData was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (data->data_line);
-        free (data);
+        dxf_free (data->data_line);
+        dxf_free (data);
         data = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -201,19 +201,20 @@ dxf_binary_entity_data_free_chain
                  * entity data objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (data != NULL)
         {
                 struct DxfBinaryEntityData *iter = data->next;
+                data->next = NULL;
                 dxf_binary_entity_data_free (data);
                 data = (DxfBinaryEntityData *) iter;
         }
@@ -241,14 +242,14 @@ dxf_binary_entity_data_get_data_line
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data->data_line ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the data_line member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -256,7 +257,7 @@ dxf_binary_entity_data_get_data_line
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (data->data_line));
+        return (dxf_strdup (data->data_line));
 }
 
 
@@ -278,19 +279,19 @@ dxf_binary_entity_data_set_data_line
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data_line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        data->data_line = strdup (data_line);
+        data->data_line = dxf_strdup (data_line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -316,14 +317,14 @@ dxf_binary_entity_data_get_length
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the length member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -356,14 +357,14 @@ dxf_binary_entity_data_set_length
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative length value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -397,14 +398,14 @@ dxf_binary_entity_data_get_next
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -436,14 +437,14 @@ dxf_binary_entity_data_set_next
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -477,14 +478,14 @@ dxf_binary_entity_data_get_last
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfBinaryEntityData *) data);
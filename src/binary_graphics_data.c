@@ -33,6 +33,7 @@
 
 
 #include "binary_graphics_data.h"
+#include "util.h"
 
 
 /*!
@@ -52,9 +53,9 @@ dxf_binary_graphics_data_new ()
         size = sizeof (DxfBinaryGraphicsData);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
+        if ((data = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfBinaryGraphicsData struct.\n")),
                   __FUNCTION__);
                 data = NULL;
@@ -90,21 +91,60 @@ dxf_binary_graphics_data_init
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 data = dxf_binary_graphics_data_new ();
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfBinaryGraphicsData struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dxf_binary_graphics_data_set_data_line (data, strdup (""));
+        dxf_binary_graphics_data_set_data_line (data, "");
         dxf_binary_graphics_data_set_length (data, 0);
-        dxf_binary_graphics_data_set_next (data, NULL);
+        data->next = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (data);
+}
+
+
+/*!
+ * \brief Reset a chain of binary graphics data objects to a single,
+ * empty object, reusing the data line of the first object.
+ *
+ * \return a pointer to the binary graphics data object, or \c NULL
+ * when a \c NULL pointer was passed.
+ */
+DxfBinaryGraphicsData *
+dxf_binary_graphics_data_reset
+(
+        DxfBinaryGraphicsData *data
+                /*!< a pointer to the binary graphics data object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (data->next != NULL)
+        {
+                dxf_binary_graphics_data_free_chain ((DxfBinaryGraphicsData *) data->next);
+                data->next = NULL;
+        }
+        dxf_string_assign (&data->data_line, "");
+        data->length = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -133,7 +173,7 @@ dxf_binary_graphics_data_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -168,20 +208,20 @@ dxf_binary_graphics_data_free
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfBinaryGraphicsData was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (data->data_line);
-        free (data);
+        dxf_free (data->data_line);
+        dxf_free (data);
         data = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -202,19 +242,20 @@ dxf_binary_graphics_data_free_chain
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (data != NULL)
         {
                 struct DxfBinaryGraphicsData *iter = data->next;
+                data->next = NULL;
                 dxf_binary_graphics_data_free (data);
                 data = (DxfBinaryGraphicsData *) iter;
         }
@@ -242,14 +283,14 @@ dxf_binary_graphics_data_get_data_line
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data->data_line ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the data_line member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -257,7 +298,7 @@ dxf_binary_graphics_data_get_data_line
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (data->data_line));
+        return (dxf_strdup (data->data_line));
 }
 
 
@@ -279,19 +320,19 @@ dxf_binary_graphics_data_set_data_line
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data_line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        data->data_line = strdup (data_line);
+        data->data_line = dxf_strdup (data_line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -317,14 +358,14 @@ dxf_binary_graphics_data_get_length
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the length member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -357,14 +398,14 @@ dxf_binary_graphics_data_set_length
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative length value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -398,14 +439,14 @@ dxf_binary_graphics_data_get_next
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -437,14 +478,14 @@ dxf_binary_graphics_data_set_next
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -478,14 +519,14 @@ dxf_binary_graphics_data_get_last
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfBinaryGraphicsData *) data);
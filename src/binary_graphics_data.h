@@ -70,6 +70,11 @@ dxf_binary_graphics_data_init
 (
         DxfBinaryGraphicsData *data
 );
+DxfBinaryGraphicsData *
+dxf_binary_graphics_data_reset
+(
+        DxfBinaryGraphicsData *data
+);
 int
 dxf_binary_graphics_data_write
 (
@@ -42,6 +42,9 @@
 
 
 #include "block.h"
+#include "section.h"
+#include "endsec.h"
+#include "util.h"
 
 
 /*!
@@ -62,9 +65,9 @@ dxf_block_new ()
         size = sizeof (DxfBlock);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((block = malloc (size)) == NULL)
+        if ((block = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfBlock struct.\n")),
                   __FUNCTION__);
                 block = NULL;
@@ -100,24 +103,24 @@ dxf_block_init
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 block = dxf_block_new ();
         }
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfBlock struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dxf_block_set_xref_name (block, strdup (""));
-        dxf_block_set_block_name (block, strdup (""));
-        dxf_block_set_block_name_additional (block, strdup (""));
-        dxf_block_set_description (block, strdup (""));
+        dxf_block_set_xref_name (block, dxf_strdup (""));
+        dxf_block_set_block_name (block, dxf_strdup (""));
+        dxf_block_set_block_name_additional (block, dxf_strdup (""));
+        dxf_block_set_description (block, dxf_strdup (""));
         dxf_block_set_id_code (block, 0);
-        dxf_block_set_layer (block, strdup (DXF_DEFAULT_LAYER));
+        dxf_block_set_layer (block, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_block_set_p0 (block, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_block_get_p0 (block));
         dxf_block_set_x0 (block, 0.0);
@@ -127,8 +130,8 @@ dxf_block_init
         dxf_block_set_extr_x0 (block, 0.0);
         dxf_block_set_extr_y0 (block, 0.0);
         dxf_block_set_extr_z0 (block, 1.0);
-        dxf_block_set_dictionary_owner_soft (block, strdup (""));
-        dxf_block_set_endblk (block, (struct DxfEndblk *) dxf_endblk_new ());
+        dxf_block_set_dictionary_owner_soft (block, dxf_strdup (""));
+        dxf_block_set_endblk (block, (struct DxfEndblk *) dxf_endblk_init (dxf_endblk_new ()));
         dxf_block_set_next (block, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -166,59 +169,55 @@ dxf_block_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 block = dxf_block_new ();
                 block = dxf_block_init (block);
         }
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a external
                          * reference name. */
-                        fscanf (fp->fp, "%s\n", block->xref_name);
+                        dxf_read_string (fp, &block->xref_name);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a block name. */
-                        fscanf (fp->fp, "%s\n", block->block_name);
+                        dxf_read_string (fp, &block->block_name);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a block name. */
-                        fscanf (fp->fp, "%s\n", block->block_name_additional);
+                        dxf_read_string (fp, &block->block_name_additional);
                 }
                 else if (strcmp (temp_string, "4") == 0)
                 {
                         /* Now follows a string containing a description. */
-                        fscanf (fp->fp, "%s\n", block->description);
+                        dxf_read_string (fp, &block->description);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -229,7 +228,7 @@ dxf_block_read
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        fscanf (fp->fp, "%s\n", block->layer);
+                        dxf_read_string (fp, &block->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -275,7 +274,7 @@ dxf_block_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbBlockBegin") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -302,7 +301,7 @@ dxf_block_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner object. */
-                        fscanf (fp->fp, "%s\n", block->dictionary_owner_soft);
+                        dxf_read_string (fp, &block->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -312,10 +311,16 @@ dxf_block_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         /*!
@@ -324,23 +329,22 @@ dxf_block_read
          */
         if (strcmp (dxf_block_get_block_name (block), "") == 0)
         {
-                sprintf (block->block_name, "%i", block->id_code);
+                snprintf (temp_string, DXF_MAX_STRING_LENGTH, "%i", block->id_code);
+                dxf_string_assign (&block->block_name, temp_string);
         }
         if (strcmp (dxf_block_get_layer (block), "") == 0)
         {
-                dxf_block_set_layer (block, strdup (DXF_DEFAULT_LAYER));
+                dxf_string_assign (&block->layer, DXF_DEFAULT_LAYER);
         }
         if (dxf_block_get_block_type (block) == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal block type value found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tblock type value is reset to 1.\n")));
                 dxf_block_set_block_type (block, 1);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -366,90 +370,90 @@ dxf_block_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("BLOCK");
+        char *dxf_entity_name = dxf_strdup ("BLOCK");
         DxfEndblk *endblk = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_block_get_block_name (block) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty block name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_block_get_id_code (block));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_block_get_endblk (block) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () NULL pointer to endblk was passed or the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_block_get_id_code (block));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (((dxf_block_get_xref_name (block) == NULL)
           || (strcmp (dxf_block_get_xref_name (block) , "") == 0))
-          && ((dxf_block_get_block_type (block) != 4)
-          || (dxf_block_get_block_type (block) != 32)))
+          && ((dxf_block_get_block_type (block) & 4)
+          || (dxf_block_get_block_type (block) & 32)))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty xref path name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_block_get_id_code (block));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_block_get_description (block) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () NULL pointer to description string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_block_get_id_code (block));
-                dxf_block_set_description (block, strdup (""));
+                dxf_block_set_description (block, dxf_strdup (""));
         }
         if (strcmp (dxf_block_get_layer (block), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_block_get_id_code (block));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0.\n")),
                   dxf_entity_name);
-                dxf_block_set_layer (block, strdup (DXF_DEFAULT_LAYER));
+                dxf_block_set_layer (block, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         if (dxf_block_get_dictionary_owner_soft (block) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () NULL pointer to soft owner object string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_block_get_id_code (block));
-                dxf_block_set_dictionary_owner_soft (block, strdup (""));
+                dxf_block_set_dictionary_owner_soft (block, dxf_strdup (""));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -484,16 +488,16 @@ dxf_block_write
         }
         fprintf (fp->fp, "  2\n%s\n", dxf_block_get_block_name (block));
         fprintf (fp->fp, " 70\n%d\n", dxf_block_get_block_type (block));
-        fprintf (fp->fp, " 10\n%f\n", dxf_block_get_x0 (block));
-        fprintf (fp->fp, " 20\n%f\n", dxf_block_get_y0 (block));
-        fprintf (fp->fp, " 30\n%f\n", dxf_block_get_z0 (block));
+        dxf_write_real (fp, 10, dxf_block_get_x0 (block));
+        dxf_write_real (fp, 20, dxf_block_get_y0 (block));
+        dxf_write_real (fp, 30, dxf_block_get_z0 (block));
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "  3\n%s\n", dxf_block_get_block_name (block));
         }
         if ((fp->acad_version_number >= AutoCAD_13)
-        && ((dxf_block_get_block_type (block) && 4)
-        || (dxf_block_get_block_type (block) && 32)))
+        && ((dxf_block_get_block_type (block) & 4)
+        || (dxf_block_get_block_type (block) & 32)))
         {
                 fprintf (fp->fp, "  1\n%s\n", dxf_block_get_xref_name (block));
         }
@@ -505,7 +509,7 @@ dxf_block_write
         endblk = (DxfEndblk *) dxf_block_get_endblk (block);
         dxf_endblk_write (fp, endblk);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -516,7 +520,11 @@ dxf_block_write
 /*!
  * \brief Write DXF output to a file for a list of block definitions.
  *
- * Appears only in the \c BLOCKS section.\n
+ * Writes the complete \c BLOCKS section, block definitions without a
+ * name are placeholders and are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
 dxf_block_write_table
@@ -530,16 +538,38 @@ dxf_block_write_table
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfBlock *iter = NULL;
+        int failures = 0;
+
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-
-        /*! \todo Add code here. */
+        dxf_section_write (fp, "BLOCKS");
+        for (iter = blocks_list; iter != NULL; iter = (DxfBlock *) iter->next)
+        {
+                if ((iter->block_name == NULL)
+                  || (strcmp (iter->block_name, "") == 0))
+                {
+                        continue;
+                }
+                if (dxf_block_write (fp, iter) != EXIT_SUCCESS)
+                {
+                        failures++;
+                }
+        }
+        dxf_endsec_write (fp);
+        if (failures > 0)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () %d block definitions could not be written.\n")),
+                  __FUNCTION__, failures);
+                return (EXIT_FAILURE);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -567,18 +597,18 @@ dxf_block_free
 #endif
         if (block->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfBlock was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (block->xref_name);
-        free (block->block_name);
-        free (block->block_name_additional);
-        free (block->description);
-        free (block->layer);
-        free (block->dictionary_owner_soft);
-        free (block);
+        dxf_free (block->xref_name);
+        dxf_free (block->block_name);
+        dxf_free (block->block_name_additional);
+        dxf_free (block->description);
+        dxf_free (block->layer);
+        dxf_free (block->dictionary_owner_soft);
+        dxf_free (block);
         block = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -598,18 +628,19 @@ dxf_block_free_chain
                 /*!< pointer to the chain of DXF \c BLOCK entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (blocks == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (blocks != NULL)
         {
                 struct DxfBlock *iter = blocks->next;
+                blocks->next = NULL;
                 dxf_block_free (blocks);
                 blocks = (DxfBlock *) iter;
         }
@@ -639,14 +670,14 @@ dxf_block_get_xref_name
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->xref_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the xref_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -654,7 +685,7 @@ dxf_block_get_xref_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->xref_name));
+        return (dxf_strdup (block->xref_name));
 }
 
 
@@ -677,19 +708,19 @@ dxf_block_set_xref_name
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (xref_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        block->xref_name = strdup (xref_name);
+        block->xref_name = dxf_strdup (xref_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -717,14 +748,14 @@ dxf_block_get_block_name
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->block_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the block_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -732,7 +763,7 @@ dxf_block_get_block_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->block_name));
+        return (dxf_strdup (block->block_name));
 }
 
 
@@ -755,19 +786,19 @@ dxf_block_set_block_name
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        block->block_name = strdup (block_name);
+        block->block_name = dxf_strdup (block_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -795,14 +826,14 @@ dxf_block_get_block_name_additional
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->block_name_additional ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the block_name_additional member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -810,7 +841,7 @@ dxf_block_get_block_name_additional
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->block_name_additional));
+        return (dxf_strdup (block->block_name_additional));
 }
 
 
@@ -833,19 +864,19 @@ dxf_block_set_block_name_additional
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block_name_additional == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        block->block_name_additional = strdup (block_name_additional);
+        block->block_name_additional = dxf_strdup (block_name_additional);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -873,14 +904,14 @@ dxf_block_get_description
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->description ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the description member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -888,7 +919,7 @@ dxf_block_get_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->description));
+        return (dxf_strdup (block->description));
 }
 
 
@@ -911,19 +942,19 @@ dxf_block_set_description
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (description == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        block->description = strdup (description);
+        block->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -949,14 +980,14 @@ dxf_block_get_id_code
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (block->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -988,14 +1019,14 @@ dxf_block_set_id_code
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1026,14 +1057,14 @@ dxf_block_get_layer
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1041,7 +1072,7 @@ dxf_block_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->layer));
+        return (dxf_strdup (block->layer));
 }
 
 
@@ -1063,19 +1094,19 @@ dxf_block_set_layer
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        block->layer = strdup (layer);
+        block->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1095,20 +1126,20 @@ dxf_block_get_p0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1134,20 +1165,20 @@ dxf_block_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1173,21 +1204,21 @@ dxf_block_get_x0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (block->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1216,20 +1247,20 @@ dxf_block_set_x0
                  * \c ARC entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1255,21 +1286,21 @@ dxf_block_get_y0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (block->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1298,20 +1329,20 @@ dxf_block_set_y0
                  * \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1337,21 +1368,21 @@ dxf_block_get_z0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (block->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1380,20 +1411,20 @@ dxf_block_set_z0
                  * \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1424,14 +1455,14 @@ dxf_block_get_block_type
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (block->block_type < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the block_type member.\n")),
                   __FUNCTION__);
         }
@@ -1460,14 +1491,14 @@ dxf_block_set_block_type
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block_type < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative block type value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1499,7 +1530,7 @@ dxf_block_is_anonymous
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1530,7 +1561,7 @@ dxf_block_has_attributes
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1561,7 +1592,7 @@ dxf_block_is_xreferenced
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1592,7 +1623,7 @@ dxf_block_is_xdependent
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1624,7 +1655,7 @@ dxf_block_is_xresolved
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1655,7 +1686,7 @@ dxf_block_is_referenced
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1680,14 +1711,14 @@ dxf_block_get_extr_x0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1716,13 +1747,13 @@ dxf_block_set_extr_x0
                  * DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1748,14 +1779,14 @@ dxf_block_get_extr_y0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1784,13 +1815,13 @@ dxf_block_set_extr_y0
                  * DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1816,14 +1847,14 @@ dxf_block_get_extr_z0
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1852,13 +1883,13 @@ dxf_block_set_extr_z0
                  * DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1886,7 +1917,7 @@ dxf_block_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c BLOCK entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -1894,7 +1925,7 @@ dxf_block_get_extrusion_vector_as_point
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1902,7 +1933,7 @@ dxf_block_get_extrusion_vector_as_point
         point = dxf_point_init (point);
         if (point == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -1939,7 +1970,7 @@ dxf_block_set_extrusion_vector
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1975,14 +2006,14 @@ dxf_block_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1990,7 +2021,7 @@ dxf_block_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block->dictionary_owner_soft));
+        return (dxf_strdup (block->dictionary_owner_soft));
 }
 
 
@@ -2014,19 +2045,19 @@ dxf_block_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        block->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        block->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2055,14 +2086,14 @@ dxf_block_get_endblk
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->endblk ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the endblk member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2094,14 +2125,14 @@ dxf_block_set_endblk
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2135,14 +2166,14 @@ dxf_block_get_next
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2173,14 +2204,14 @@ dxf_block_set_next
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2214,14 +2245,14 @@ dxf_block_get_last
         /* Do some basic checks. */
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfBlock *) block);
@@ -42,6 +42,7 @@
 
 
 #include "block_record.h"
+#include "util.h"
 
 
 /*!
@@ -61,9 +62,9 @@ dxf_block_record_new ()
         size = sizeof (DxfBlockRecord);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((block_record = malloc (size)) == NULL)
+        if ((block_record = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfBlockRecord struct.\n")),
                   __FUNCTION__);
                 block_record = NULL;
@@ -99,23 +100,23 @@ dxf_block_record_init
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 block_record = dxf_block_record_new ();
         }
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfBlockRecord struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_block_record_set_id_code (block_record, 0);
-        dxf_block_record_set_block_name (block_record, strdup (""));
+        dxf_block_record_set_block_name (block_record, dxf_strdup (""));
         dxf_block_record_set_flag (block_record, 0);
-        dxf_block_record_set_dictionary_owner_soft (block_record, strdup (""));
-        dxf_block_record_set_dictionary_owner_hard (block_record, strdup (""));
+        dxf_block_record_set_dictionary_owner_soft (block_record, dxf_strdup (""));
+        dxf_block_record_set_dictionary_owner_hard (block_record, dxf_strdup (""));
         dxf_block_record_set_next (block_record, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -148,38 +149,34 @@ dxf_block_record_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 block_record = dxf_block_record_new ();
                 block_record = dxf_block_record_init (block_record);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -194,7 +191,7 @@ dxf_block_record_read
                         /* Now follows a string containing an application
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", block_record->block_name);
+                        dxf_read_string (fp, &block_record->block_name);
                 }
                 else if (strcmp (temp_string, "70") == 0)
                 {
@@ -208,14 +205,14 @@ dxf_block_record_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", block_record->dictionary_owner_soft);
+                        dxf_read_string (fp, &block_record->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", block_record->dictionary_owner_hard);
+                        dxf_read_string (fp, &block_record->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -226,13 +223,17 @@ dxf_block_record_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -256,47 +257,47 @@ dxf_block_record_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("BLOCK_RECORD");
+        char *dxf_entity_name = dxf_strdup ("BLOCK_RECORD");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((dxf_block_record_get_block_name (block_record) == NULL)
           || (strcmp (dxf_block_record_get_block_name (block_record), "") == 0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s empty block name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_block_record_get_id_code (block_record));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -332,12 +333,12 @@ dxf_block_record_write
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbSymbolTableRecord\n");
-                fprintf (fp->fp, "100\nAcDbRegAppTableRecord\n");
+                fprintf (fp->fp, "100\nAcDbBlockTableRecord\n");
         }
         fprintf (fp->fp, "  2\n%s\n", dxf_block_record_get_block_name (block_record));
         fprintf (fp->fp, " 70\n%d\n", dxf_block_record_get_flag (block_record));
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -364,15 +365,15 @@ dxf_block_record_free
 #endif
         if (block_record->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfBlockRecord was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (block_record->block_name);
-        free (block_record->dictionary_owner_soft);
-        free (block_record->dictionary_owner_hard);
-        free (block_record);
+        dxf_free (block_record->block_name);
+        dxf_free (block_record->dictionary_owner_soft);
+        dxf_free (block_record->dictionary_owner_hard);
+        dxf_free (block_record);
         block_record = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -392,12 +393,12 @@ dxf_block_record_free_chain
                 /*!< pointer to the chain of DXF \c BLOCK_RECORD entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (block_records == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
@@ -432,14 +433,14 @@ dxf_block_record_get_id_code
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (block_record->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -472,14 +473,14 @@ dxf_block_record_set_id_code
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -512,14 +513,14 @@ dxf_block_record_get_block_name
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block_record->block_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the block_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -527,7 +528,7 @@ dxf_block_record_get_block_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->block_name));
+        return (dxf_strdup (block_record->block_name));
 }
 
 
@@ -552,19 +553,19 @@ dxf_block_record_set_block_name
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->block_name= strdup (block_name);
+        block_record->block_name= dxf_strdup (block_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -592,21 +593,21 @@ dxf_block_record_get_flag
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (block_record->flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the flag member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (block_record->flag > 64)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the flag member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -640,21 +641,21 @@ dxf_block_record_set_flag
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative flag value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (flag > 64)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range flag value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -688,7 +689,7 @@ dxf_block_record_is_xreferenced
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -722,7 +723,7 @@ dxf_block_record_is_xresolved
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -756,7 +757,7 @@ dxf_block_record_is_referenced
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -790,14 +791,14 @@ dxf_block_record_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block_record->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -805,7 +806,7 @@ dxf_block_record_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->dictionary_owner_soft));
+        return (dxf_strdup (block_record->dictionary_owner_soft));
 }
 
 
@@ -830,19 +831,19 @@ dxf_block_record_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        block_record->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -872,14 +873,14 @@ dxf_block_record_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block_record->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -887,7 +888,7 @@ dxf_block_record_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (block_record->dictionary_owner_hard));
+        return (dxf_strdup (block_record->dictionary_owner_hard));
 }
 
 
@@ -912,19 +913,19 @@ dxf_block_record_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        block_record->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        block_record->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -954,14 +955,14 @@ dxf_block_record_get_next
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block_record->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -993,14 +994,14 @@ dxf_block_record_set_next
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1035,14 +1036,14 @@ dxf_block_record_get_last
         /* Do some basic checks. */
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block_record->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfBlockRecord *) block_record);
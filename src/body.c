@@ -42,6 +42,7 @@
 
 
 #include "body.h"
+#include "util.h"
 
 
 /*!
@@ -61,9 +62,9 @@ dxf_body_new ()
         size = sizeof (DxfBody);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((body = malloc (size)) == NULL)
+        if ((body = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfBody struct.\n")),
                   __FUNCTION__);
                 body = NULL;
@@ -71,6 +72,7 @@ dxf_body_new ()
         else
         {
                 memset (body, 0, size);
+                body->header.type = BODY;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -99,21 +101,21 @@ dxf_body_init
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 body = dxf_body_new ();
         }
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfBody struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_body_set_id_code (body, 0);
-        dxf_body_set_linetype (body, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_body_set_layer (body, strdup (DXF_DEFAULT_LAYER));
+        dxf_body_set_linetype (body, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_body_set_layer (body, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_body_set_elevation (body, 0.0);
         dxf_body_set_thickness (body, 0.0);
         dxf_body_set_linetype_scale (body, DXF_DEFAULT_LINETYPE_SCALE);
@@ -124,16 +126,16 @@ dxf_body_init
         dxf_body_set_shadow_mode (body, 0);
         dxf_body_set_binary_graphics_data (body, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (body->binary_graphics_data));
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_body_get_binary_graphics_data (body));
-        dxf_body_set_dictionary_owner_soft (body, strdup (""));
-        dxf_body_set_material (body, strdup (""));
-        dxf_body_set_dictionary_owner_hard (body, strdup (""));
+        dxf_body_set_dictionary_owner_soft (body, dxf_strdup (""));
+        dxf_body_set_material (body, dxf_strdup (""));
+        dxf_body_set_dictionary_owner_hard (body, dxf_strdup (""));
         dxf_body_set_lineweight (body, 0);
-        dxf_body_set_plot_style_name (body, strdup (""));
+        dxf_body_set_plot_style_name (body, dxf_strdup (""));
         dxf_body_set_color_value (body, 0);
-        dxf_body_set_color_name (body, strdup (""));
+        dxf_body_set_color_name (body, dxf_strdup (""));
         dxf_body_set_transparency (body, 0);
         dxf_body_set_proprietary_data (body, (DxfProprietaryData *) dxf_proprietary_data_init (body->proprietary_data));
-        dxf_body_set_proprietary_data (body, (DxfProprietaryData *) dxf_proprietary_data_init (body->additional_proprietary_data));
+        dxf_body_set_additional_proprietary_data (body, (DxfProprietaryData *) dxf_proprietary_data_init (body->additional_proprietary_data));
         dxf_body_set_modeler_format_version_number (body, 1);
         dxf_body_set_next (body, NULL);
 #if DEBUG
@@ -166,22 +168,23 @@ dxf_body_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
+        DxfProprietaryData *proprietary_data = NULL;
+        DxfProprietaryData *additional_proprietary_data = NULL;
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 body = dxf_body_new ();
@@ -189,48 +192,65 @@ dxf_body_read
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        i = 0;
+        if (body->proprietary_data == NULL)
+        {
+                body->proprietary_data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+        }
+        if (body->additional_proprietary_data == NULL)
+        {
+                body->additional_proprietary_data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+        }
+        proprietary_data = body->proprietary_data;
+        additional_proprietary_data = body->additional_proprietary_data;
+        i = 1;
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (BODY, fp);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
+                else if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing proprietary
                          * data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", body->proprietary_data->line);
-                        body->proprietary_data->order = i;
-                        i++;
-                        dxf_proprietary_data_init ((DxfProprietaryData *) body->proprietary_data->next);
-                        body->proprietary_data = (DxfProprietaryData *) body->proprietary_data->next;
+                        if (fp->lazy_proprietary_data)
+                        {
+                                dxf_proprietary_data_range_skip (fp, &body->proprietary_data_range, 1);
+                        }
+                        else
+                        {
+                                proprietary_data = dxf_proprietary_data_read_line (fp, proprietary_data, i);
+                                i++;
+                        }
                 }
-                else if (strcmp (temp_string, "  3") == 0)
+                else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing additional
                          * proprietary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", body->additional_proprietary_data->line);
-                        body->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_proprietary_data_init ((DxfProprietaryData *) body->additional_proprietary_data->next);
-                        body->additional_proprietary_data = (DxfProprietaryData *) body->additional_proprietary_data->next;
+                        if (fp->lazy_proprietary_data)
+                        {
+                                dxf_proprietary_data_range_skip (fp, &body->proprietary_data_range, 3);
+                        }
+                        else
+                        {
+                                additional_proprietary_data = dxf_proprietary_data_read_line (fp, additional_proprietary_data, i);
+                                i++;
+                        }
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -242,13 +262,13 @@ dxf_body_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", body->linetype);
+                        dxf_read_string (fp, &body->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", body->layer);
+                        dxf_read_string (fp, &body->layer);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                   && DXF_FLATLAND
@@ -297,7 +317,7 @@ dxf_body_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
                         {
-                                fprintf (stderr, "Warning in dxf_body_read () found a bad subclass marker in: %s in line: %d.\n",
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING, "Warning in dxf_body_read () found a bad subclass marker in: %s in line: %d.\n",
                                         fp->filename, fp->line_number);
                         }
                 }
@@ -306,14 +326,14 @@ dxf_body_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", body->dictionary_owner_soft);
+                        dxf_read_string (fp, &body->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", body->dictionary_owner_hard);
+                        dxf_read_string (fp, &body->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -324,31 +344,36 @@ dxf_body_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (body->linetype, "") == 0)
         {
-                body->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_string_assign (&body->linetype, DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (body->layer, "") == 0)
         {
-                body->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_string_assign (&body->layer, DXF_DEFAULT_LAYER);
         }
         if (body->modeler_format_version_number == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning: in %s () illegal modeler format version number found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tmodeler format version number is reset to 1.\n")));
                 body->modeler_format_version_number = 1;
         }
-        /* Clean up. */
-        free (temp_string);
+        DXF_TRACING_ENTITY_END (BODY, fp, trace_offset);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -374,58 +399,54 @@ dxf_body_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("BODY");
-        DxfProprietaryData *iter = NULL;
-        DxfProprietaryData *additional_iter = NULL;
-        int i;
+        char *dxf_entity_name = dxf_strdup ("BODY");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_body_get_id_code (body));
         }
         if (strcmp (dxf_body_get_linetype (body), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_body_get_id_code (body));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_body_set_linetype (body, strdup (DXF_DEFAULT_LAYER));
+                dxf_body_set_linetype (body, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         if (strcmp (dxf_body_get_layer (body), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_body_get_id_code (body));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                dxf_body_set_layer (body, strdup (DXF_DEFAULT_LAYER));
+                dxf_body_set_layer (body, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         /* Start writing output. */
-        i = 1;
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
         if (dxf_body_get_id_code (body) != -1)
         {
@@ -472,15 +493,15 @@ dxf_body_write
           && DXF_FLATLAND
           && (dxf_body_get_elevation (body) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_body_get_elevation (body));
+                dxf_write_real (fp, 38, dxf_body_get_elevation (body));
         }
         if (dxf_body_get_thickness (body) != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_body_get_thickness (body));
+                dxf_write_real (fp, 39, dxf_body_get_thickness (body));
         }
         if (dxf_body_get_linetype_scale (body) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_body_get_linetype_scale (body));
+                dxf_write_real (fp, 48, dxf_body_get_linetype_scale (body));
         }
         if (dxf_body_get_visibility (body) != 0)
         {
@@ -498,25 +519,11 @@ dxf_body_write
         {
                 fprintf (fp->fp, " 70\n%d\n", dxf_body_get_modeler_format_version_number (body));
         }
-        iter = (DxfProprietaryData *) dxf_body_get_proprietary_data (body);
-        additional_iter = (DxfProprietaryData *) dxf_body_get_additional_proprietary_data (body);
-        while ((iter != NULL) || (additional_iter != NULL))
-        {
-                if (iter->order == i)
-                {
-                        fprintf (fp->fp, "  1\n%s\n", dxf_proprietary_data_get_line (iter));
-                        iter = (DxfProprietaryData *) dxf_proprietary_data_get_next (iter);
-                        i++;
-                }
-                if (additional_iter->order == i)
-                {
-                        fprintf (fp->fp, "  3\n%s\n", dxf_proprietary_data_get_line (additional_iter));
-                        additional_iter = (DxfProprietaryData *) dxf_proprietary_data_get_next (additional_iter);
-                        i++;
-                }
-        }
+        dxf_proprietary_data_write_chains (fp,
+          dxf_body_get_proprietary_data (body),
+          dxf_body_get_additional_proprietary_data (body));
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -545,18 +552,22 @@ dxf_body_free
         /* Do some basic checks. */
         if (body->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfBody was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (body->linetype);
-        free (body->layer);
+        dxf_free (body->linetype);
+        dxf_free (body->layer);
         dxf_proprietary_data_free_chain (body->proprietary_data);
         dxf_proprietary_data_free_chain (body->additional_proprietary_data);
-        free (body->dictionary_owner_soft);
-        free (body->dictionary_owner_hard);
-        free (body);
+        if (body->proprietary_data_range != NULL)
+        {
+                dxf_proprietary_data_range_free (body->proprietary_data_range);
+        }
+        dxf_free (body->dictionary_owner_soft);
+        dxf_free (body->dictionary_owner_hard);
+        dxf_free (body);
         body = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -576,18 +587,19 @@ dxf_body_free_chain
                 /*!< pointer to the chain of DXF \c BODY entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (bodies == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (bodies != NULL)
         {
                 struct DxfBody *iter = bodies->next;
+                bodies->next = NULL;
                 dxf_body_free (bodies);
                 bodies = (DxfBody *) iter;
         }
@@ -615,14 +627,14 @@ dxf_body_get_id_code
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -654,14 +666,14 @@ dxf_body_set_id_code
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -692,14 +704,14 @@ dxf_body_get_linetype
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (body->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -707,7 +719,7 @@ dxf_body_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->linetype));
+        return (dxf_strdup (body->linetype));
 }
 
 
@@ -729,19 +741,19 @@ dxf_body_set_linetype
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        body->linetype = strdup (linetype);
+        body->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -767,14 +779,14 @@ dxf_body_get_layer
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (body->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -782,7 +794,7 @@ dxf_body_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->layer));
+        return (dxf_strdup (body->layer));
 }
 
 
@@ -804,19 +816,19 @@ dxf_body_set_layer
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        body->layer = strdup (layer);
+        body->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -842,7 +854,7 @@ dxf_body_get_elevation
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -872,7 +884,7 @@ dxf_body_set_elevation
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -903,14 +915,14 @@ dxf_body_get_thickness
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -940,14 +952,14 @@ dxf_body_set_thickness
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -978,14 +990,14 @@ dxf_body_get_linetype_scale
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1015,14 +1027,14 @@ dxf_body_set_linetype_scale
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative linetype scale value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1053,21 +1065,21 @@ dxf_body_get_visibility
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1097,21 +1109,21 @@ dxf_body_set_visibility
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1142,14 +1154,14 @@ dxf_body_get_color
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1178,17 +1190,17 @@ dxf_body_set_color
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         body->color = color;
@@ -1217,20 +1229,20 @@ dxf_body_get_paperspace
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (body->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1259,21 +1271,21 @@ dxf_body_set_paperspace
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1305,20 +1317,20 @@ dxf_body_get_graphics_data_size
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
         if (body->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
@@ -1351,21 +1363,21 @@ dxf_body_set_graphics_data_size
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1397,21 +1409,21 @@ dxf_body_get_shadow_mode
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1444,21 +1456,21 @@ dxf_body_set_shadow_mode
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1492,14 +1504,14 @@ dxf_body_get_binary_graphics_data
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (body->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1534,14 +1546,14 @@ dxf_body_set_binary_graphics_data
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1575,14 +1587,14 @@ dxf_body_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (body->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1590,7 +1602,7 @@ dxf_body_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->dictionary_owner_soft));
+        return (dxf_strdup (body->dictionary_owner_soft));
 }
 
 
@@ -1614,19 +1626,19 @@ dxf_body_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        body->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        body->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1656,14 +1668,14 @@ dxf_body_get_material
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (body->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the material member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1671,7 +1683,7 @@ dxf_body_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->material));
+        return (dxf_strdup (body->material));
 }
 
 
@@ -1697,19 +1709,19 @@ dxf_body_set_material
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        body->material = strdup (material);
+        body->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1738,14 +1750,14 @@ dxf_body_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (body->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1753,7 +1765,7 @@ dxf_body_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->dictionary_owner_hard));
+        return (dxf_strdup (body->dictionary_owner_hard));
 }
 
 
@@ -1777,19 +1789,19 @@ dxf_body_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        body->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        body->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1816,7 +1828,7 @@ dxf_body_get_lineweight
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1849,7 +1861,7 @@ dxf_body_set_lineweight
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1881,14 +1893,14 @@ dxf_body_get_plot_style_name
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (body->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1896,7 +1908,7 @@ dxf_body_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->plot_style_name));
+        return (dxf_strdup (body->plot_style_name));
 }
 
 
@@ -1922,19 +1934,19 @@ dxf_body_set_plot_style_name
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        body->plot_style_name = strdup (plot_style_name);
+        body->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1961,7 +1973,7 @@ dxf_body_get_color_value
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1994,7 +2006,7 @@ dxf_body_set_color_value
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2026,14 +2038,14 @@ dxf_body_get_color_name
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (body->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2041,7 +2053,7 @@ dxf_body_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (body->color_name));
+        return (dxf_strdup (body->color_name));
 }
 
 
@@ -2067,19 +2079,19 @@ dxf_body_set_color_name
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        body->color_name = strdup (color_name);
+        body->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2106,7 +2118,7 @@ dxf_body_get_transparency
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2139,7 +2151,7 @@ dxf_body_set_transparency
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2152,6 +2164,30 @@ dxf_body_set_transparency
 }
 
 
+/*!
+ * \brief Load the proprietary data of a DXF \c BODY entity from the
+ * file it was read from, when only its location was recorded.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_body_load_proprietary_data
+(
+        DxfBody *body
+                /*!< a pointer to a DXF \c BODY entity. */
+)
+{
+        int status;
+
+        status = dxf_proprietary_data_range_load (body->proprietary_data_range,
+          &body->proprietary_data, &body->additional_proprietary_data);
+        dxf_proprietary_data_range_free (body->proprietary_data_range);
+        body->proprietary_data_range = NULL;
+        return (status);
+}
+
+
 /*!
  * \brief Get the pointer to the \c proprietary_data from a DXF \c BODY
  * entity.
@@ -2173,14 +2209,18 @@ dxf_body_get_proprietary_data
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        if (body->proprietary_data_range != NULL)
+        {
+                dxf_body_load_proprietary_data (body);
+        }
         if (body->proprietary_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the proprietary_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2211,18 +2251,22 @@ dxf_body_set_proprietary_data
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (proprietary_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        if (body->proprietary_data_range != NULL)
+        {
+                dxf_body_load_proprietary_data (body);
+        }
         body->proprietary_data = proprietary_data;
 #if DEBUG
         DXF_DEBUG_END
@@ -2251,14 +2295,18 @@ dxf_body_get_additional_proprietary_data
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        if (body->proprietary_data_range != NULL)
+        {
+                dxf_body_load_proprietary_data (body);
+        }
         if (body->additional_proprietary_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2290,18 +2338,22 @@ dxf_body_set_additional_proprietary_data
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (additional_proprietary_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        if (body->proprietary_data_range != NULL)
+        {
+                dxf_body_load_proprietary_data (body);
+        }
         body->additional_proprietary_data = additional_proprietary_data;
 #if DEBUG
         DXF_DEBUG_END
@@ -2328,14 +2380,14 @@ dxf_body_get_modeler_format_version_number
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (body->modeler_format_version_number != 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found in the modeler_format_version_number member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2365,14 +2417,14 @@ dxf_body_set_modeler_format_version_number
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (modeler_format_version_number != 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid modeler format version number value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2406,14 +2458,14 @@ dxf_body_get_next
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (body->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2444,14 +2496,14 @@ dxf_body_set_next
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2485,14 +2537,14 @@ dxf_body_get_last
         /* Do some basic checks. */
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (body->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfBody *) body);
@@ -0,0 +1,1989 @@
+/*!
+ * \file cache.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a libDXF native binary cache of a drawing.
+ *
+ * Layout of a cache file:
+ * <ol>
+ * <li>a \c DxfCacheHeader at offset 0,</li>
+ * <li>the columns of all entity tables, each column 8 byte aligned,</li>
+ * <li>the \c NUL terminated interned strings,</li>
+ * <li>the string offset table,</li>
+ * <li>the DXF text of the entities which are not stored column
+ * wise.</li>
+ * </ol>
+ * Every reference is a byte offset from the start of the file, so the
+ * file can be mapped at any address.\n
+ * The header records the size, modification time and a content hash of
+ * the source DXF file.
+ * A cache is rejected when the size differs, the content hash is only
+ * compared when the modification time differs.\n
+ * A cache file is written to a temporary file which is renamed when
+ * complete, a reader never sees a partly written cache.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <sys/mman.h>
+#include "cache.h"
+#include "entities.h"
+#include "entity_vtable.h"
+#include "file.h"
+#include "header.h"
+#include "paged_entities.h"
+#include "util.h"
+
+
+#define DXF_CACHE_FNV1A_OFFSET_BASIS 0xcbf29ce484222325ULL
+        /*!< \brief FNV-1a 64 bit offset basis. */
+
+#define DXF_CACHE_FNV1A_PRIME 0x100000001b3ULL
+        /*!< \brief FNV-1a 64 bit prime. */
+
+#define DXF_CACHE_NUMBER_OF_DOUBLE_COLUMNS (DXF_CACHE_MAX_COLUMNS - DXF_CACHE_COLUMN_X0)
+        /*!< \brief The maximum number of entity specific columns. */
+
+
+/*!
+ * \brief Interned strings while writing a cache file.
+ */
+typedef struct
+dxf_cache_string_table_struct
+{
+        char **strings;
+                /*!< Interned strings in order of insertion. */
+        uint32_t number_of_strings;
+                /*!< Number of interned strings. */
+        uint32_t capacity;
+                /*!< Allocated number of entries in \c strings. */
+        uint32_t *slots;
+                /*!< Open addressing hash table, holds index + 1 of a
+                 * string, 0 for an empty slot. */
+        uint32_t number_of_slots;
+                /*!< Number of slots, always a power of 2. */
+} DxfCacheStringTable;
+
+
+/*!
+ * \brief Columns of one table while writing a cache file.
+ */
+typedef struct
+dxf_cache_columns_struct
+{
+        uint64_t number_of_rows;
+                /*!< Number of rows. */
+        int number_of_double_columns;
+                /*!< Number of entity specific columns. */
+        int32_t *id_code;
+        uint32_t *layer;
+        uint32_t *linetype;
+        int32_t *color;
+        int32_t *order;
+        double *value[DXF_CACHE_NUMBER_OF_DOUBLE_COLUMNS];
+} DxfCacheColumns;
+
+
+/*!
+ * \brief State while filling the columns of the cache tables.
+ */
+typedef struct
+dxf_cache_fill_struct
+{
+        DxfCacheColumns *columns;
+                /*!< array of \c DXF_CACHE_NUMBER_OF_TABLES columns. */
+        DxfCacheStringTable *strings;
+                /*!< string table. */
+        uint64_t number_of_entities;
+                /*!< Number of entities stored so far, the order of the
+                 * next entity. */
+        DxfEntities *entities;
+                /*!< entities of the drawing, or \c NULL. */
+        size_t number_filled;
+                /*!< Number of \c entities stored so far. */
+        void **prototype;
+                /*!< a new entity for each table stored column wise. */
+        void **other;
+                /*!< entities in \c DXF_CACHE_TABLE_OTHER, in order. */
+        DxfEntities *paged_other;
+                /*!< entities created from the paged storage for
+                 * \c other. */
+        int result;
+                /*!< \c EXIT_FAILURE when an error occurred. */
+} DxfCacheFill;
+
+
+/*!
+ * \brief Entity type of each table stored column wise.
+ */
+static const DxfEntityType dxf_cache_entity_type[DXF_CACHE_TABLE_OTHER] =
+{
+        POINT,
+        LINE,
+        CIRCLE,
+        ARC
+};
+
+
+/*!
+ * \brief Number of columns of each table.
+ */
+static const uint32_t dxf_cache_number_of_columns[DXF_CACHE_NUMBER_OF_TABLES] =
+{
+        DXF_CACHE_COLUMN_X0 + 3,
+        DXF_CACHE_COLUMN_X0 + 6,
+        DXF_CACHE_COLUMN_X0 + 4,
+        DXF_CACHE_COLUMN_X0 + 6,
+        DXF_CACHE_COLUMN_X0
+};
+
+
+static uint64_t
+dxf_cache_fnv1a
+(
+        uint64_t hash,
+                /*!< hash value so far. */
+        const void *data,
+                /*!< data to add to the hash. */
+        size_t size
+                /*!< size of \c data in bytes. */
+)
+{
+        const unsigned char *p = data;
+        size_t i;
+
+        for (i = 0; i < size; i++)
+        {
+                hash ^= p[i];
+                hash *= DXF_CACHE_FNV1A_PRIME;
+        }
+        return (hash);
+}
+
+
+/*!
+ * \brief Compute the FNV-1a 64 bit hash of the contents of a file.
+ *
+ * \return the hash value, or 0 when the file could not be read.
+ */
+uint64_t
+dxf_cache_hash_file
+(
+        const char *filename
+                /*!< filename of the file to hash. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        FILE *fp;
+        unsigned char buffer[65536];
+        size_t n;
+        uint64_t hash = DXF_CACHE_FNV1A_OFFSET_BASIS;
+
+        /* Do some basic checks. */
+        if (filename == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        fp = fopen (filename, "rb");
+        if (fp == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not open file: %s for reading.\n")),
+                  __FUNCTION__, filename);
+                return (0);
+        }
+        while ((n = fread (buffer, 1, sizeof (buffer), fp)) > 0)
+        {
+                hash = dxf_cache_fnv1a (hash, buffer, n);
+        }
+        if (ferror (fp))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () while reading from: %s.\n")),
+                  __FUNCTION__, filename);
+                hash = 0;
+        }
+        fclose (fp);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (hash);
+}
+
+
+/*!
+ * \brief Intern a string, return the index of the string in the string
+ * table.
+ *
+ * A \c NULL pointer is interned as an empty string.
+ *
+ * \return the index of the string, or \c UINT32_MAX when no memory
+ * could be allocated.
+ */
+static uint32_t
+dxf_cache_intern
+(
+        DxfCacheStringTable *table,
+                /*!< string table. */
+        const char *string
+                /*!< string to intern. */
+)
+{
+        uint64_t hash;
+        uint32_t slot;
+        uint32_t i;
+
+        if (string == NULL)
+        {
+                string = "";
+        }
+        /* Keep the hash table at most half full. */
+        if ((table->number_of_strings + 1) * 2 > table->number_of_slots)
+        {
+                uint32_t number_of_slots = (table->number_of_slots == 0) ? 256 : table->number_of_slots * 2;
+                uint32_t *slots = dxf_calloc (number_of_slots, sizeof (uint32_t));
+
+                if (slots == NULL)
+                {
+                        return (UINT32_MAX);
+                }
+                for (i = 0; i < table->number_of_strings; i++)
+                {
+                        hash = dxf_cache_fnv1a (DXF_CACHE_FNV1A_OFFSET_BASIS,
+                          table->strings[i], strlen (table->strings[i]));
+                        slot = (uint32_t) hash & (number_of_slots - 1);
+                        while (slots[slot] != 0)
+                        {
+                                slot = (slot + 1) & (number_of_slots - 1);
+                        }
+                        slots[slot] = i + 1;
+                }
+                dxf_free (table->slots);
+                table->slots = slots;
+                table->number_of_slots = number_of_slots;
+        }
+        hash = dxf_cache_fnv1a (DXF_CACHE_FNV1A_OFFSET_BASIS, string, strlen (string));
+        slot = (uint32_t) hash & (table->number_of_slots - 1);
+        while (table->slots[slot] != 0)
+        {
+                if (strcmp (table->strings[table->slots[slot] - 1], string) == 0)
+                {
+                        return (table->slots[slot] - 1);
+                }
+                slot = (slot + 1) & (table->number_of_slots - 1);
+        }
+        if (table->number_of_strings == table->capacity)
+        {
+                uint32_t capacity = (table->capacity == 0) ? 64 : table->capacity * 2;
+                char **strings = dxf_realloc (table->strings, capacity * sizeof (char *));
+
+                if (strings == NULL)
+                {
+                        return (UINT32_MAX);
+                }
+                table->strings = strings;
+                table->capacity = capacity;
+        }
+        table->strings[table->number_of_strings] = dxf_strdup (string);
+        if (table->strings[table->number_of_strings] == NULL)
+        {
+                return (UINT32_MAX);
+        }
+        table->slots[slot] = table->number_of_strings + 1;
+        return (table->number_of_strings++);
+}
+
+
+/*!
+ * \brief Allocate the columns of a table while writing a cache file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_cache_columns_alloc
+(
+        DxfCacheColumns *columns,
+                /*!< columns of the table. */
+        uint64_t number_of_rows,
+                /*!< number of rows in the table. */
+        int number_of_double_columns
+                /*!< number of entity specific columns. */
+)
+{
+        size_t n = (number_of_rows == 0) ? 1 : (size_t) number_of_rows;
+        int i;
+
+        memset (columns, 0, sizeof (DxfCacheColumns));
+        columns->number_of_double_columns = number_of_double_columns;
+        columns->id_code = dxf_malloc (n * sizeof (int32_t));
+        columns->layer = dxf_malloc (n * sizeof (uint32_t));
+        columns->linetype = dxf_malloc (n * sizeof (uint32_t));
+        columns->color = dxf_malloc (n * sizeof (int32_t));
+        columns->order = dxf_malloc (n * sizeof (int32_t));
+        if ((columns->id_code == NULL)
+          || (columns->layer == NULL)
+          || (columns->linetype == NULL)
+          || (columns->color == NULL)
+          || (columns->order == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_of_double_columns; i++)
+        {
+                columns->value[i] = dxf_malloc (n * sizeof (double));
+                if (columns->value[i] == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the columns of a table.
+ */
+static void
+dxf_cache_columns_free
+(
+        DxfCacheColumns *columns
+                /*!< columns of the table. */
+)
+{
+        int i;
+
+        dxf_free (columns->id_code);
+        dxf_free (columns->layer);
+        dxf_free (columns->linetype);
+        dxf_free (columns->color);
+        dxf_free (columns->order);
+        for (i = 0; i < DXF_CACHE_NUMBER_OF_DOUBLE_COLUMNS; i++)
+        {
+                dxf_free (columns->value[i]);
+        }
+        memset (columns, 0, sizeof (DxfCacheColumns));
+}
+
+
+/*!
+ * \brief Append a row to the columns of a table.
+ *
+ * Only the values of the entity specific columns of the table are
+ * used.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_cache_columns_append
+(
+        DxfCacheColumns *columns,
+                /*!< columns of the table. */
+        DxfCacheStringTable *strings,
+                /*!< string table. */
+        const DxfPagedEntity *entity,
+                /*!< the members of the entity. */
+        uint64_t order
+                /*!< position of the entity in the drawing. */
+)
+{
+        uint64_t row = columns->number_of_rows;
+        int i;
+
+        if (order > INT32_MAX)
+        {
+                return (EXIT_FAILURE);
+        }
+        columns->id_code[row] = entity->id_code;
+        columns->layer[row] = dxf_cache_intern (strings, entity->layer);
+        columns->linetype[row] = dxf_cache_intern (strings, entity->linetype);
+        columns->color[row] = entity->color;
+        columns->order[row] = (int32_t) order;
+        if ((columns->layer[row] == UINT32_MAX)
+          || (columns->linetype[row] == UINT32_MAX))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < columns->number_of_double_columns; i++)
+        {
+                columns->value[i][row] = entity->value[i];
+        }
+        columns->number_of_rows++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a block of data to a cache file at an 8 byte aligned
+ * offset.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_cache_write_block
+(
+        FILE *fp,
+                /*!< cache file. */
+        const void *data,
+                /*!< data to write. */
+        size_t size,
+                /*!< size of \c data in bytes. */
+        uint64_t *offset
+                /*!< returns the offset of the block in the file. */
+)
+{
+        static const char padding[8] = {0};
+        long position;
+
+        position = ftell (fp);
+        if (position < 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((position % 8) != 0)
+        {
+                if (fwrite (padding, 1, 8 - (position % 8), fp) != (size_t) (8 - (position % 8)))
+                {
+                        return (EXIT_FAILURE);
+                }
+                position += 8 - (position % 8);
+        }
+        *offset = (uint64_t) position;
+        if ((size > 0) && (fwrite (data, 1, size, fp) != size))
+        {
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append the columns of a table to a cache file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_cache_write_columns
+(
+        FILE *fp,
+                /*!< cache file. */
+        DxfCacheColumns *columns,
+                /*!< columns of the table. */
+        DxfCacheTable *table
+                /*!< returns the on disk description of the table. */
+)
+{
+        size_t n = (size_t) columns->number_of_rows;
+        int i;
+
+        memset (table, 0, sizeof (DxfCacheTable));
+        table->number_of_rows = columns->number_of_rows;
+        table->number_of_columns = DXF_CACHE_COLUMN_X0 + columns->number_of_double_columns;
+        if ((dxf_cache_write_block (fp, columns->id_code, n * sizeof (int32_t), &table->column_offset[DXF_CACHE_COLUMN_ID_CODE]) != EXIT_SUCCESS)
+          || (dxf_cache_write_block (fp, columns->layer, n * sizeof (uint32_t), &table->column_offset[DXF_CACHE_COLUMN_LAYER]) != EXIT_SUCCESS)
+          || (dxf_cache_write_block (fp, columns->linetype, n * sizeof (uint32_t), &table->column_offset[DXF_CACHE_COLUMN_LINETYPE]) != EXIT_SUCCESS)
+          || (dxf_cache_write_block (fp, columns->color, n * sizeof (int32_t), &table->column_offset[DXF_CACHE_COLUMN_COLOR]) != EXIT_SUCCESS)
+          || (dxf_cache_write_block (fp, columns->order, n * sizeof (int32_t), &table->column_offset[DXF_CACHE_COLUMN_ORDER]) != EXIT_SUCCESS))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < columns->number_of_double_columns; i++)
+        {
+                if (dxf_cache_write_block (fp, columns->value[i], n * sizeof (double), &table->column_offset[DXF_CACHE_COLUMN_X0 + i]) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the table of an entity type stored column wise.
+ *
+ * \return the table, or \c DXF_CACHE_TABLE_OTHER for the other entity
+ * types.
+ */
+static DxfCacheTableType
+dxf_cache_get_table
+(
+        DxfEntityType type
+                /*!< entity type. */
+)
+{
+        DxfCacheTableType table;
+
+        for (table = 0; table < DXF_CACHE_TABLE_OTHER; table++)
+        {
+                if (dxf_cache_entity_type[table] == type)
+                {
+                        break;
+                }
+        }
+        return (table);
+}
+
+
+/*!
+ * \brief Get the members of an entity which are stored in the columns
+ * of its table.
+ *
+ * An entity which is not plain (see \c dxf_paged_entities_is_plain ())
+ * belongs in \c DXF_CACHE_TABLE_OTHER, only its common members are
+ * stored, its linetype is not.
+ *
+ * \return the table of the entity.
+ */
+static DxfCacheTableType
+dxf_cache_get_members
+(
+        void *entity,
+                /*!< a pointer to a DXF entity. */
+        void **prototype,
+                /*!< a new entity for each table stored column wise. */
+        DxfPagedEntity *members
+                /*!< returns the members of the entity. */
+)
+{
+        DxfCacheTableType table;
+
+        memset (members, 0, sizeof (DxfPagedEntity));
+        members->type = dxf_entity_get_type (entity);
+        table = dxf_cache_get_table (members->type);
+        if ((table != DXF_CACHE_TABLE_OTHER)
+          && (!dxf_paged_entities_is_plain (entity, prototype[table])))
+        {
+                table = DXF_CACHE_TABLE_OTHER;
+        }
+        switch (table)
+        {
+                case DXF_CACHE_TABLE_POINT:
+                        members->linetype = ((DxfPoint *) entity)->linetype;
+                        members->value[0] = ((DxfPoint *) entity)->x0;
+                        members->value[1] = ((DxfPoint *) entity)->y0;
+                        members->value[2] = ((DxfPoint *) entity)->z0;
+                        break;
+                case DXF_CACHE_TABLE_LINE:
+                        members->linetype = ((DxfLine *) entity)->linetype;
+                        members->value[0] = ((DxfLine *) entity)->p0->x0;
+                        members->value[1] = ((DxfLine *) entity)->p0->y0;
+                        members->value[2] = ((DxfLine *) entity)->p0->z0;
+                        members->value[3] = ((DxfLine *) entity)->p1->x0;
+                        members->value[4] = ((DxfLine *) entity)->p1->y0;
+                        members->value[5] = ((DxfLine *) entity)->p1->z0;
+                        break;
+                case DXF_CACHE_TABLE_CIRCLE:
+                        members->linetype = ((DxfCircle *) entity)->linetype;
+                        members->value[0] = ((DxfCircle *) entity)->p0->x0;
+                        members->value[1] = ((DxfCircle *) entity)->p0->y0;
+                        members->value[2] = ((DxfCircle *) entity)->p0->z0;
+                        members->value[3] = ((DxfCircle *) entity)->radius;
+                        break;
+                case DXF_CACHE_TABLE_ARC:
+                        members->linetype = ((DxfArc *) entity)->linetype;
+                        members->value[0] = ((DxfArc *) entity)->p0->x0;
+                        members->value[1] = ((DxfArc *) entity)->p0->y0;
+                        members->value[2] = ((DxfArc *) entity)->p0->z0;
+                        members->value[3] = ((DxfArc *) entity)->radius;
+                        members->value[4] = ((DxfArc *) entity)->start_angle;
+                        members->value[5] = ((DxfArc *) entity)->end_angle;
+                        break;
+                default:
+                        break;
+        }
+        members->id_code = dxf_entity_get_id_code (entity);
+        members->layer = dxf_entity_get_layer (entity);
+        members->color = dxf_entity_get_color (entity);
+        return (table);
+}
+
+
+/*!
+ * \brief Count an entity from a paged storage in its table.
+ *
+ * \return 0 to continue the iteration.
+ */
+static int
+dxf_cache_count_paged
+(
+        const DxfPagedEntity *entity,
+                /*!< decoded entity. */
+        void *data
+                /*!< array of \c DXF_CACHE_NUMBER_OF_TABLES row counts. */
+)
+{
+        ((uint64_t *) data)[dxf_cache_get_table (entity->type)]++;
+        return (0);
+}
+
+
+/*!
+ * \brief Append the entities of a drawing which precede an entity of
+ * the paged storage in file order to the columns of their tables.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_cache_fill_resident
+(
+        DxfCacheFill *fill,
+                /*!< the fill state. */
+        uint64_t sequence
+                /*!< sequence of the entity of the paged storage. */
+)
+{
+        DxfPagedEntity members;
+        void *entity;
+        size_t last;
+        int table;
+
+        last = dxf_entities_get_number_of_entities (fill->entities);
+        if (sequence < (uint64_t) last)
+        {
+                last = (size_t) sequence;
+        }
+        for (; fill->number_filled < last; fill->number_filled++)
+        {
+                entity = dxf_entities_get_entity (fill->entities, fill->number_filled);
+                if ((dxf_entity_get_flags (entity) & DXF_ENTITY_FLAG_ERASED) != 0)
+                {
+                        continue;
+                }
+                table = dxf_cache_get_members (entity, fill->prototype, &members);
+                if (table == DXF_CACHE_TABLE_OTHER)
+                {
+                        fill->other[fill->columns[table].number_of_rows] = entity;
+                }
+                if (dxf_cache_columns_append (&fill->columns[table], fill->strings, &members, fill->number_of_entities) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+                fill->number_of_entities++;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append an entity from a paged storage to the columns of its
+ * table, after the entities of the drawing which precede it.
+ *
+ * Paged entities of a type which is not stored column wise are created
+ * in \c paged_other, and kept as DXF text.
+ *
+ * \return 0 to continue the iteration, 1 to stop it.
+ */
+static int
+dxf_cache_fill_paged
+(
+        const DxfPagedEntity *entity,
+                /*!< decoded entity. */
+        void *data
+                /*!< the \c DxfCacheFill. */
+)
+{
+        DxfCacheFill *fill = data;
+        DxfCacheTableType table = dxf_cache_get_table (entity->type);
+        DxfPagedEntity members;
+        void *other;
+
+        if (dxf_cache_fill_resident (fill, entity->sequence) != EXIT_SUCCESS)
+        {
+                fill->result = EXIT_FAILURE;
+                return (1);
+        }
+        /* Entities in a paged storage are always plain. */
+        members = *entity;
+        if (table == DXF_CACHE_TABLE_OTHER)
+        {
+                other = dxf_paged_entities_new_entity (entity);
+                if ((other == NULL)
+                  || (dxf_entities_append (fill->paged_other, other) != EXIT_SUCCESS))
+                {
+                        if (other != NULL)
+                        {
+                                dxf_entity_free (other);
+                        }
+                        fill->result = EXIT_FAILURE;
+                        return (1);
+                }
+                fill->other[fill->columns[table].number_of_rows] = other;
+                /* Only the common members are stored. */
+                memset (members.value, 0, sizeof (members.value));
+                members.linetype = NULL;
+        }
+        if (dxf_cache_columns_append (&fill->columns[table], fill->strings, &members, fill->number_of_entities) != EXIT_SUCCESS)
+        {
+                fill->result = EXIT_FAILURE;
+                return (1);
+        }
+        fill->number_of_entities++;
+        return (0);
+}
+
+
+/*!
+ * \brief Fill the columns of all cache tables from the entities in a
+ * drawing.
+ *
+ * The entities are stored in the order they are written by
+ * \c dxf_file_save (): the entities of the drawing which are not erased
+ * in file order, merged with the entities in the paged storage of the
+ * drawing (see \c dxf_paged_entities_write ()).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_cache_fill_columns
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfCacheColumns *columns,
+                /*!< array of \c DXF_CACHE_NUMBER_OF_TABLES columns. */
+        DxfCacheStringTable *strings,
+                /*!< string table. */
+        void ***other,
+                /*!< returns the entities in \c DXF_CACHE_TABLE_OTHER,
+                 * in order, the caller frees the array. */
+        DxfEntities *paged_other,
+                /*!< receives the entities in \c DXF_CACHE_TABLE_OTHER
+                 * created from the paged storage, the caller frees
+                 * them after \c other. */
+        uint64_t *number_of_entities
+                /*!< returns the number of entities in all tables. */
+)
+{
+        DxfEntities *entities = (DxfEntities *) drawing->entities_list;
+        DxfPagedEntities *paged = (DxfPagedEntities *) drawing->paged_entities;
+        DxfPagedEntity members;
+        DxfCacheFill fill;
+        void *prototype[DXF_CACHE_TABLE_OTHER];
+        void *entity;
+        uint64_t number_of_rows[DXF_CACHE_NUMBER_OF_TABLES] = {0};
+        size_t n;
+        size_t i;
+        int table;
+        int result = EXIT_FAILURE;
+
+        *other = NULL;
+        *number_of_entities = 0;
+        for (table = 0; table < DXF_CACHE_TABLE_OTHER; table++)
+        {
+                prototype[table] = dxf_entity_init (dxf_entity_new (dxf_cache_entity_type[table]));
+        }
+        for (table = 0; table < DXF_CACHE_TABLE_OTHER; table++)
+        {
+                if (prototype[table] == NULL)
+                {
+                        goto cleanup;
+                }
+        }
+        n = (entities != NULL) ? dxf_entities_get_number_of_entities (entities) : 0;
+        /* First pass: count the rows of every table. */
+        for (i = 0; i < n; i++)
+        {
+                entity = dxf_entities_get_entity (entities, i);
+                if ((dxf_entity_get_flags (entity) & DXF_ENTITY_FLAG_ERASED) == 0)
+                {
+                        number_of_rows[dxf_cache_get_members (entity, prototype, &members)]++;
+                }
+        }
+        if ((paged != NULL)
+          && (dxf_paged_entities_foreach (paged, dxf_cache_count_paged, number_of_rows) != EXIT_SUCCESS))
+        {
+                goto cleanup;
+        }
+        for (table = 0; table < DXF_CACHE_NUMBER_OF_TABLES; table++)
+        {
+                if (dxf_cache_columns_alloc (&columns[table], number_of_rows[table],
+                  dxf_cache_number_of_columns[table] - DXF_CACHE_COLUMN_X0) != EXIT_SUCCESS)
+                {
+                        goto cleanup;
+                }
+        }
+        *other = dxf_malloc ((number_of_rows[DXF_CACHE_TABLE_OTHER] + 1) * sizeof (void *));
+        if (*other == NULL)
+        {
+                goto cleanup;
+        }
+        /* Second pass: fill the columns in file order. */
+        memset (&fill, 0, sizeof (DxfCacheFill));
+        fill.columns = columns;
+        fill.strings = strings;
+        fill.entities = entities;
+        fill.prototype = prototype;
+        fill.other = *other;
+        fill.paged_other = paged_other;
+        fill.result = EXIT_SUCCESS;
+        if ((paged != NULL)
+          && ((dxf_paged_entities_foreach (paged, dxf_cache_fill_paged, &fill) != EXIT_SUCCESS)
+          || (fill.result != EXIT_SUCCESS)))
+        {
+                goto cleanup;
+        }
+        /* The entities of the drawing which follow the last entity of
+         * the paged storage. */
+        if (dxf_cache_fill_resident (&fill, DXF_PAGED_ENTITIES_AFTER_RESIDENT) != EXIT_SUCCESS)
+        {
+                goto cleanup;
+        }
+        *number_of_entities = fill.number_of_entities;
+        result = EXIT_SUCCESS;
+cleanup:
+        for (table = 0; table < DXF_CACHE_TABLE_OTHER; table++)
+        {
+                if (prototype[table] != NULL)
+                {
+                        dxf_entity_free (prototype[table]);
+                }
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Save the entities of a libDXF drawing to a native binary cache
+ * file.
+ *
+ * Plain \c POINT, \c LINE, \c CIRCLE and \c ARC entities (see
+ * \c dxf_paged_entities_is_plain ()) are stored column wise, layer and
+ * linetype names are interned.
+ * Entities of all other types are kept as DXF text, the common members
+ * are also stored in the columns of \c DXF_CACHE_TABLE_OTHER.\n
+ * When \c source_filename is not \c NULL the size, modification time
+ * and content hash of the source DXF file are recorded for cache
+ * invalidation.\n
+ * The cache is written to a temporary file in the same directory, which
+ * replaces \c cache_filename when it is complete.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_save_cache
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        const char *cache_filename,
+                /*!< filename of the cache file to write. */
+        const char *source_filename
+                /*!< filename of the source DXF file, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        FILE *fp = NULL;
+        DxfFile entities_fp;
+        DxfCacheHeader header;
+        DxfCacheColumns columns[DXF_CACHE_NUMBER_OF_TABLES];
+        DxfCacheStringTable strings;
+        uint64_t *string_offsets = NULL;
+        void **other = NULL;
+        DxfEntities *paged_other = NULL;
+        char *temp_filename = NULL;
+        struct stat source_stat;
+        uint64_t i;
+        int fd;
+        int result = EXIT_FAILURE;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (cache_filename == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&header, 0, sizeof (DxfCacheHeader));
+        memset (columns, 0, sizeof (columns));
+        memset (&strings, 0, sizeof (DxfCacheStringTable));
+        memcpy (header.magic, DXF_CACHE_MAGIC, sizeof (header.magic));
+        header.version = DXF_CACHE_VERSION;
+        header.byte_order = DXF_CACHE_BYTE_ORDER_MARK;
+        header.acad_version_number = ((drawing->header != NULL) && (((DxfHeader *) drawing->header)->AcadVer != NULL))
+          ? dxf_header_acad_version_from_string (((DxfHeader *) drawing->header)->AcadVer)
+          : AutoCAD_2000;
+        if (source_filename != NULL)
+        {
+                if (stat (source_filename, &source_stat) != 0)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not stat file: %s.\n")),
+                          __FUNCTION__, source_filename);
+                        return (EXIT_FAILURE);
+                }
+                header.source_size = (uint64_t) source_stat.st_size;
+                header.source_mtime = (int64_t) source_stat.st_mtim.tv_sec;
+                header.source_mtime_nsec = (int64_t) source_stat.st_mtim.tv_nsec;
+                header.source_hash = dxf_cache_hash_file (source_filename);
+        }
+        paged_other = dxf_entities_new ();
+        if ((paged_other == NULL)
+          || (dxf_cache_fill_columns (drawing, columns, &strings, &other, paged_other, &header.number_of_entities) != EXIT_SUCCESS))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the cache columns.\n")),
+                  __FUNCTION__);
+                goto cleanup;
+        }
+        temp_filename = dxf_malloc (strlen (cache_filename) + 8);
+        if (temp_filename == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                goto cleanup;
+        }
+        sprintf (temp_filename, "%s.XXXXXX", cache_filename);
+        fd = mkstemp (temp_filename);
+        if (fd >= 0)
+        {
+                fp = fdopen (fd, "wb");
+                if (fp == NULL)
+                {
+                        close (fd);
+                        unlink (temp_filename);
+                }
+        }
+        if (fp == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not open file: %s for writing.\n")),
+                  __FUNCTION__, temp_filename);
+                goto cleanup;
+        }
+        /* Reserve room for the header, it is rewritten when all offsets
+         * are known. */
+        if (fwrite (&header, sizeof (DxfCacheHeader), 1, fp) != 1)
+        {
+                goto write_error;
+        }
+        for (i = 0; i < DXF_CACHE_NUMBER_OF_TABLES; i++)
+        {
+                if (dxf_cache_write_columns (fp, &columns[i], &header.table[i]) != EXIT_SUCCESS)
+                {
+                        goto write_error;
+                }
+        }
+        string_offsets = dxf_malloc ((strings.number_of_strings + 1) * sizeof (uint64_t));
+        if (string_offsets == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                goto cleanup;
+        }
+        for (i = 0; i < strings.number_of_strings; i++)
+        {
+                string_offsets[i] = (uint64_t) ftell (fp);
+                if (fwrite (strings.strings[i], strlen (strings.strings[i]) + 1, 1, fp) != 1)
+                {
+                        goto write_error;
+                }
+        }
+        header.number_of_strings = strings.number_of_strings;
+        if (dxf_cache_write_block (fp, string_offsets, strings.number_of_strings * sizeof (uint64_t), &header.string_offset_table) != EXIT_SUCCESS)
+        {
+                goto write_error;
+        }
+        /* The other entities are written in full, as DXF text. */
+        memset (&entities_fp, 0, sizeof (DxfFile));
+        entities_fp.fp = fp;
+        entities_fp.filename = temp_filename;
+        entities_fp.acad_version_number = header.acad_version_number;
+        entities_fp.exact_reals = TRUE;
+        header.entities_offset = (uint64_t) ftell (fp);
+        for (i = 0; i < columns[DXF_CACHE_TABLE_OTHER].number_of_rows; i++)
+        {
+                if (dxf_entity_write (&entities_fp, other[i]) != EXIT_SUCCESS)
+                {
+                        goto write_error;
+                }
+        }
+        if (fprintf (fp, "  0\nENDSEC\n") < 0)
+        {
+                goto write_error;
+        }
+        header.file_size = (uint64_t) ftell (fp);
+        header.entities_size = header.file_size - header.entities_offset;
+        if ((fseek (fp, 0L, SEEK_SET) != 0)
+          || (fwrite (&header, sizeof (DxfCacheHeader), 1, fp) != 1))
+        {
+                goto write_error;
+        }
+        result = EXIT_SUCCESS;
+        goto cleanup;
+write_error:
+        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+          (_("Error in %s () while writing to: %s.\n")),
+          __FUNCTION__, temp_filename);
+cleanup:
+        if ((fp != NULL) && (fclose (fp) != 0))
+        {
+                result = EXIT_FAILURE;
+        }
+        if ((result == EXIT_SUCCESS)
+          && (rename (temp_filename, cache_filename) != 0))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not rename file: %s to: %s.\n")),
+                  __FUNCTION__, temp_filename, cache_filename);
+                result = EXIT_FAILURE;
+        }
+        if ((result != EXIT_SUCCESS) && (fp != NULL))
+        {
+                /* Never leave a partly written cache behind. */
+                unlink (temp_filename);
+        }
+        for (i = 0; i < DXF_CACHE_NUMBER_OF_TABLES; i++)
+        {
+                dxf_cache_columns_free (&columns[i]);
+        }
+        for (i = 0; i < strings.number_of_strings; i++)
+        {
+                dxf_free (strings.strings[i]);
+        }
+        dxf_free (strings.strings);
+        dxf_free (strings.slots);
+        dxf_free (string_offsets);
+        dxf_free (other);
+        if (paged_other != NULL)
+        {
+                dxf_entities_free (paged_other);
+        }
+        dxf_free (temp_filename);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Test if the source DXF file still matches the size,
+ * modification time and content hash recorded in a cache header.
+ *
+ * A source with another size changed, a source with the same size and
+ * modification time did not.
+ * Only when the modification time differs (the source was touched,
+ * copied or rewritten) the (expensive) content hash is computed.
+ *
+ * \return \c TRUE when the cache is up to date, \c FALSE otherwise.
+ */
+static int
+dxf_cache_source_matches
+(
+        const DxfCacheHeader *header,
+                /*!< cache header. */
+        const char *source_filename
+                /*!< filename of the source DXF file. */
+)
+{
+        struct stat source_stat;
+
+        if (stat (source_filename, &source_stat) != 0)
+        {
+                return (FALSE);
+        }
+        if (header->source_size != (uint64_t) source_stat.st_size)
+        {
+                return (FALSE);
+        }
+        if ((header->source_mtime == (int64_t) source_stat.st_mtim.tv_sec)
+          && (header->source_mtime_nsec == (int64_t) source_stat.st_mtim.tv_nsec))
+        {
+                return (TRUE);
+        }
+        return (header->source_hash == dxf_cache_hash_file (source_filename));
+}
+
+
+/*!
+ * \brief Test the structural integrity of a mapped cache file.
+ *
+ * \return \c TRUE when all offsets are within the mapping, \c FALSE
+ * otherwise.
+ */
+static int
+dxf_cache_check_layout
+(
+        DxfCache *cache
+                /*!< mapped cache file. */
+)
+{
+        const DxfCacheHeader *header = cache->header;
+        const uint64_t *string_offsets;
+        uint64_t number_of_rows = 0;
+        uint64_t i;
+        uint32_t j;
+
+        if ((memcmp (header->magic, DXF_CACHE_MAGIC, sizeof (header->magic)) != 0)
+          || (header->version != DXF_CACHE_VERSION)
+          || (header->byte_order != DXF_CACHE_BYTE_ORDER_MARK)
+          || (header->file_size != (uint64_t) cache->size))
+        {
+                return (FALSE);
+        }
+        for (i = 0; i < DXF_CACHE_NUMBER_OF_TABLES; i++)
+        {
+                const DxfCacheTable *table = &header->table[i];
+
+                if ((table->number_of_columns != dxf_cache_number_of_columns[i])
+                  || (table->number_of_rows > cache->size / sizeof (int32_t)))
+                {
+                        return (FALSE);
+                }
+                number_of_rows += table->number_of_rows;
+                for (j = 0; j < table->number_of_columns; j++)
+                {
+                        uint64_t width = (j < DXF_CACHE_COLUMN_X0) ? 4 : sizeof (double);
+
+                        if (((table->column_offset[j] % 8) != 0)
+                          || (table->column_offset[j] > cache->size)
+                          || (table->number_of_rows * width > cache->size - table->column_offset[j]))
+                        {
+                                return (FALSE);
+                        }
+                }
+        }
+        if (((header->string_offset_table % 8) != 0)
+          || (header->string_offset_table > cache->size)
+          || ((uint64_t) header->number_of_strings * sizeof (uint64_t) > cache->size - header->string_offset_table))
+        {
+                return (FALSE);
+        }
+        string_offsets = (const uint64_t *) (cache->base + header->string_offset_table);
+        for (i = 0; i < header->number_of_strings; i++)
+        {
+                if ((string_offsets[i] >= header->string_offset_table)
+                  || (memchr (cache->base + string_offsets[i], '\0', header->string_offset_table - string_offsets[i]) == NULL))
+                {
+                        return (FALSE);
+                }
+        }
+        if ((number_of_rows != header->number_of_entities)
+          || (header->entities_offset > cache->size)
+          || (header->entities_size != cache->size - header->entities_offset))
+        {
+                return (FALSE);
+        }
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Open a native binary cache file read-only, for queries on its
+ * columns.
+ *
+ * The cache file is memory mapped, no data is copied.\n
+ * When \c source_filename is not \c NULL the cache is rejected if the
+ * source DXF file changed since the cache was written.
+ *
+ * \return a pointer to the opened cache, or \c NULL when the cache
+ * could not be opened, is corrupt or is out of date.
+ */
+DxfCache *
+dxf_cache_open
+(
+        const char *cache_filename,
+                /*!< filename of the cache file. */
+        const char *source_filename
+                /*!< filename of the source DXF file, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfCache *cache = NULL;
+        struct stat cache_stat;
+        void *base;
+
+        /* Do some basic checks. */
+        if (cache_filename == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        cache = dxf_malloc (sizeof (DxfCache));
+        if (cache == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfCache struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (cache, 0, sizeof (DxfCache));
+        cache->fd = open (cache_filename, O_RDONLY);
+        if (cache->fd < 0)
+        {
+                dxf_free (cache);
+                return (NULL);
+        }
+        if ((fstat (cache->fd, &cache_stat) != 0)
+          || (cache_stat.st_size < (off_t) sizeof (DxfCacheHeader)))
+        {
+                close (cache->fd);
+                dxf_free (cache);
+                return (NULL);
+        }
+        cache->size = (size_t) cache_stat.st_size;
+        base = mmap (NULL, cache->size, PROT_READ, MAP_SHARED, cache->fd, 0);
+        if (base == MAP_FAILED)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not map file: %s.\n")),
+                  __FUNCTION__, cache_filename);
+                close (cache->fd);
+                dxf_free (cache);
+                return (NULL);
+        }
+        cache->base = base;
+        cache->header = (const DxfCacheHeader *) base;
+        if (!dxf_cache_check_layout (cache))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () ignoring corrupt or incompatible cache file: %s.\n")),
+                  __FUNCTION__, cache_filename);
+                dxf_cache_close (cache);
+                return (NULL);
+        }
+        if ((source_filename != NULL)
+          && (!dxf_cache_source_matches (cache->header, source_filename)))
+        {
+                dxf_cache_close (cache);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (cache);
+}
+
+
+/*!
+ * \brief Get a value from an integer column of a mapped cache file.
+ */
+static int32_t
+dxf_cache_get_int
+(
+        DxfCache *cache,
+                /*!< mapped cache file. */
+        DxfCacheTableType table,
+                /*!< cache table. */
+        DxfCacheColumnType column,
+                /*!< integer column. */
+        uint64_t row
+                /*!< row number. */
+)
+{
+        return (((const int32_t *) (cache->base + cache->header->table[table].column_offset[column]))[row]);
+}
+
+
+/*!
+ * \brief Get a value from a geometry column of a mapped cache file.
+ */
+static double
+dxf_cache_get_double
+(
+        DxfCache *cache,
+                /*!< mapped cache file. */
+        DxfCacheTableType table,
+                /*!< cache table. */
+        DxfCacheColumnType column,
+                /*!< geometry column. */
+        uint64_t row
+                /*!< row number. */
+)
+{
+        return (((const double *) (cache->base + cache->header->table[table].column_offset[column]))[row]);
+}
+
+
+/*!
+ * \brief Copy an interned string from a string column of a mapped cache
+ * file.
+ *
+ * \return a copy of the string, or \c NULL when the index is out of
+ * range or no memory could be allocated.
+ */
+static char *
+dxf_cache_dup_string
+(
+        DxfCache *cache,
+                /*!< mapped cache file. */
+        DxfCacheTableType table,
+                /*!< cache table. */
+        DxfCacheColumnType column,
+                /*!< string column. */
+        uint64_t row
+                /*!< row number. */
+)
+{
+        const uint32_t index = ((const uint32_t *) (cache->base + cache->header->table[table].column_offset[column]))[row];
+
+        if (index >= cache->header->number_of_strings)
+        {
+                return (NULL);
+        }
+        return (dxf_strdup (dxf_cache_get_string (cache, index)));
+}
+
+
+/*!
+ * \brief Put an entity at its position in the drawing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * position is out of range or taken (a corrupt cache).
+ */
+static int
+dxf_cache_place_entity
+(
+        DxfCache *cache,
+                /*!< mapped cache file. */
+        DxfCacheTableType table,
+                /*!< cache table. */
+        uint64_t row,
+                /*!< row number. */
+        void **entities,
+                /*!< entities of the drawing, in order. */
+        void *entity
+                /*!< the entity in \c row. */
+)
+{
+        int32_t order = dxf_cache_get_int (cache, table, DXF_CACHE_COLUMN_ORDER, row);
+
+        if ((entity == NULL)
+          || (order < 0)
+          || ((uint64_t) order >= cache->header->number_of_entities)
+          || (entities[order] != NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        entities[order] = entity;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make an entity from a row of a table stored column wise.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred.
+ */
+static void *
+dxf_cache_new_entity
+(
+        DxfCache *cache,
+                /*!< mapped cache file. */
+        DxfCacheTableType table,
+                /*!< cache table, not \c DXF_CACHE_TABLE_OTHER. */
+        uint64_t row
+                /*!< row number. */
+)
+{
+        DxfPoint *point;
+        DxfLine *line;
+        DxfCircle *circle;
+        DxfArc *arc;
+        void *entity;
+        char *layer;
+        char *linetype;
+        int id_code = dxf_cache_get_int (cache, table, DXF_CACHE_COLUMN_ID_CODE, row);
+        int color = dxf_cache_get_int (cache, table, DXF_CACHE_COLUMN_COLOR, row);
+
+        entity = dxf_entity_init (dxf_entity_new (dxf_cache_entity_type[table]));
+        layer = dxf_cache_dup_string (cache, table, DXF_CACHE_COLUMN_LAYER, row);
+        linetype = dxf_cache_dup_string (cache, table, DXF_CACHE_COLUMN_LINETYPE, row);
+        if ((entity == NULL) || (layer == NULL) || (linetype == NULL))
+        {
+                if (entity != NULL)
+                {
+                        dxf_entity_free (entity);
+                }
+                dxf_free (layer);
+                dxf_free (linetype);
+                return (NULL);
+        }
+        switch (table)
+        {
+                case DXF_CACHE_TABLE_POINT:
+                        point = entity;
+                        point->id_code = id_code;
+                        point->color = color;
+                        dxf_free (point->layer);
+                        dxf_free (point->linetype);
+                        point->layer = layer;
+                        point->linetype = linetype;
+                        point->x0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_X0, row);
+                        point->y0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_Y0, row);
+                        point->z0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_Z0, row);
+                        break;
+                case DXF_CACHE_TABLE_LINE:
+                        line = entity;
+                        line->id_code = id_code;
+                        line->color = color;
+                        dxf_free (line->layer);
+                        dxf_free (line->linetype);
+                        line->layer = layer;
+                        line->linetype = linetype;
+                        line->p0->x0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_X0, row);
+                        line->p0->y0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_Y0, row);
+                        line->p0->z0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_Z0, row);
+                        line->p1->x0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_X1, row);
+                        line->p1->y0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_Y1, row);
+                        line->p1->z0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_Z1, row);
+                        break;
+                case DXF_CACHE_TABLE_CIRCLE:
+                        circle = entity;
+                        circle->id_code = id_code;
+                        circle->color = color;
+                        dxf_free (circle->layer);
+                        dxf_free (circle->linetype);
+                        circle->layer = layer;
+                        circle->linetype = linetype;
+                        circle->p0->x0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_X0, row);
+                        circle->p0->y0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_Y0, row);
+                        circle->p0->z0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_Z0, row);
+                        circle->radius = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_RADIUS, row);
+                        break;
+                case DXF_CACHE_TABLE_ARC:
+                        arc = entity;
+                        arc->id_code = id_code;
+                        arc->color = color;
+                        dxf_free (arc->layer);
+                        dxf_free (arc->linetype);
+                        arc->layer = layer;
+                        arc->linetype = linetype;
+                        arc->p0->x0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_X0, row);
+                        arc->p0->y0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_Y0, row);
+                        arc->p0->z0 = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_Z0, row);
+                        arc->radius = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_RADIUS, row);
+                        arc->start_angle = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_START_ANGLE, row);
+                        arc->end_angle = dxf_cache_get_double (cache, table, DXF_CACHE_COLUMN_END_ANGLE, row);
+                        break;
+                default:
+                        dxf_entity_free (entity);
+                        dxf_free (layer);
+                        dxf_free (linetype);
+                        return (NULL);
+        }
+        return (entity);
+}
+
+
+/*!
+ * \brief Read the entities kept as DXF text in a cache file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_cache_read_entities
+(
+        DxfCache *cache,
+                /*!< mapped cache file. */
+        const char *cache_filename,
+                /*!< filename of the cache file. */
+        void **entities
+                /*!< entities of the drawing, in order. */
+)
+{
+        char value[DXF_MAX_STRING_LENGTH];
+        DxfFile *fp;
+        void *entity;
+        uint64_t row;
+        int result = EXIT_FAILURE;
+
+        fp = dxf_read_init (cache_filename);
+        if (fp == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fp->acad_version_number = cache->header->acad_version_number;
+        /* The readers read up to the name of the next entity. */
+        if ((fseeko (fp->fp, (off_t) cache->header->entities_offset, SEEK_SET) != 0)
+          || (fscanf (fp->fp, " %[^\n]", value) != 1)
+          || (strcmp (value, "0") != 0)
+          || (fscanf (fp->fp, " %[^\n]%*[\n]", value) != 1))
+        {
+                goto cleanup;
+        }
+        for (row = 0; row < cache->header->table[DXF_CACHE_TABLE_OTHER].number_of_rows; row++)
+        {
+                if (strcmp (value, "ENDSEC") == 0)
+                {
+                        goto cleanup;
+                }
+                entity = dxf_file_read_entity (fp, value);
+                if (dxf_cache_place_entity (cache, DXF_CACHE_TABLE_OTHER, row, entities, entity) != EXIT_SUCCESS)
+                {
+                        if (entity != NULL)
+                        {
+                                dxf_entity_free (entity);
+                        }
+                        goto cleanup;
+                }
+                if (fscanf (fp->fp, " %[^\n]%*[\n]", value) != 1)
+                {
+                        goto cleanup;
+                }
+        }
+        if (strcmp (value, "ENDSEC") == 0)
+        {
+                result = EXIT_SUCCESS;
+        }
+cleanup:
+        dxf_read_close (fp);
+        return (result);
+}
+
+
+/*!
+ * \brief Open a native binary cache file as a libDXF drawing.
+ *
+ * The entities are made from the columns of the cache and read from
+ * the DXF text in the cache, in the order they were saved.
+ * The drawing is initialized for the AutoCAD version of the source
+ * drawing, the other data of the source drawing is not cached.\n
+ * When \c source_filename is not \c NULL the cache is rejected if the
+ * source DXF file changed since the cache was written.\n
+ * Raw entities refer to the cache file, which has to stay unchanged
+ * while the drawing refers to it, see raw_data.c.
+ *
+ * \return a pointer to the drawing, or \c NULL when the cache could not
+ * be opened, is corrupt or is out of date.
+ */
+DxfDrawing *
+dxf_drawing_open_cache
+(
+        const char *cache_filename,
+                /*!< filename of the cache file. */
+        const char *source_filename
+                /*!< filename of the source DXF file, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfCache *cache;
+        DxfDrawing *drawing;
+        void **entities;
+        uint64_t number_of_entities;
+        uint64_t row;
+        uint64_t i;
+        int table;
+        int result = EXIT_FAILURE;
+
+        cache = dxf_cache_open (cache_filename, source_filename);
+        if (cache == NULL)
+        {
+                return (NULL);
+        }
+        number_of_entities = cache->header->number_of_entities;
+        entities = dxf_calloc ((size_t) number_of_entities + 1, sizeof (void *));
+        drawing = dxf_drawing_init (dxf_drawing_new (), cache->header->acad_version_number);
+        if ((entities == NULL)
+          || (drawing == NULL)
+          || (drawing->entities_list == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                goto cleanup;
+        }
+        for (table = 0; table < DXF_CACHE_TABLE_OTHER; table++)
+        {
+                for (row = 0; row < cache->header->table[table].number_of_rows; row++)
+                {
+                        void *entity = dxf_cache_new_entity (cache, table, row);
+
+                        if (dxf_cache_place_entity (cache, table, row, entities, entity) != EXIT_SUCCESS)
+                        {
+                                if (entity != NULL)
+                                {
+                                        dxf_entity_free (entity);
+                                }
+                                goto corrupt;
+                        }
+                }
+        }
+        if ((cache->header->table[DXF_CACHE_TABLE_OTHER].number_of_rows > 0)
+          && (dxf_cache_read_entities (cache, cache_filename, entities) != EXIT_SUCCESS))
+        {
+                goto corrupt;
+        }
+        for (i = 0; i < number_of_entities; i++)
+        {
+                if (entities[i] == NULL)
+                {
+                        goto corrupt;
+                }
+        }
+        for (i = 0; i < number_of_entities; i++)
+        {
+                if (dxf_entities_append ((DxfEntities *) drawing->entities_list, entities[i]) != EXIT_SUCCESS)
+                {
+                        goto cleanup;
+                }
+                entities[i] = NULL;
+        }
+        result = EXIT_SUCCESS;
+        goto cleanup;
+corrupt:
+        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
+          (_("Warning in %s () ignoring corrupt cache file: %s.\n")),
+          __FUNCTION__, cache_filename);
+cleanup:
+        if (entities != NULL)
+        {
+                for (i = 0; i < number_of_entities; i++)
+                {
+                        if (entities[i] != NULL)
+                        {
+                                dxf_entity_free (entities[i]);
+                        }
+                }
+                dxf_free (entities);
+        }
+        if ((result != EXIT_SUCCESS) && (drawing != NULL))
+        {
+                dxf_drawing_free (drawing);
+                drawing = NULL;
+        }
+        dxf_cache_close (cache);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
+/*!
+ * \brief Close a cache file and release the mapping.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_cache_close
+(
+        DxfCache *cache
+                /*!< a pointer to an opened cache. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (cache == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (cache->base != NULL)
+        {
+                munmap ((void *) cache->base, cache->size);
+        }
+        close (cache->fd);
+        dxf_free (cache);
+        cache = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test if a cache file exists, is intact and matches the source
+ * DXF file.
+ *
+ * \return \c TRUE when the cache can be used, \c FALSE otherwise.
+ */
+int
+dxf_cache_is_valid
+(
+        const char *cache_filename,
+                /*!< filename of the cache file. */
+        const char *source_filename
+                /*!< filename of the source DXF file. */
+)
+{
+        DxfCache *cache;
+
+        cache = dxf_cache_open (cache_filename, source_filename);
+        if (cache == NULL)
+        {
+                return (FALSE);
+        }
+        dxf_cache_close (cache);
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Get the number of rows (entities) in a cache table.
+ *
+ * \return the number of rows, 0 when an error occurred.
+ */
+uint64_t
+dxf_cache_get_number_of_rows
+(
+        DxfCache *cache,
+                /*!< a pointer to an opened cache. */
+        DxfCacheTableType table
+                /*!< cache table. */
+)
+{
+        /* Do some basic checks. */
+        if (cache == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        if ((table < 0) || (table >= DXF_CACHE_NUMBER_OF_TABLES))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an invalid table was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (cache->header->table[table].number_of_rows);
+}
+
+
+/*!
+ * \brief Get a pointer to the start of a column in the mapping.
+ *
+ * \return a pointer into the mapping, \c NULL when the column does not
+ * exist.
+ */
+static const void *
+dxf_cache_get_column
+(
+        DxfCache *cache,
+                /*!< a pointer to an opened cache. */
+        DxfCacheTableType table,
+                /*!< cache table. */
+        DxfCacheColumnType column
+                /*!< column in the table. */
+)
+{
+        /* Do some basic checks. */
+        if (cache == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((table < 0)
+          || (table >= DXF_CACHE_NUMBER_OF_TABLES)
+          || (column < 0)
+          || ((uint32_t) column >= cache->header->table[table].number_of_columns))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an invalid table or column was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return (cache->base + cache->header->table[table].column_offset[column]);
+}
+
+
+/*!
+ * \brief Get the \c id_code, \c color or \c order column of a cache
+ * table.
+ *
+ * \return a pointer to \c number_of_rows values inside the mapping, or
+ * \c NULL when an error occurred.
+ */
+const int32_t *
+dxf_cache_get_int_column
+(
+        DxfCache *cache,
+                /*!< a pointer to an opened cache. */
+        DxfCacheTableType table,
+                /*!< cache table. */
+        DxfCacheColumnType column
+                /*!< \c DXF_CACHE_COLUMN_ID_CODE,
+                 * \c DXF_CACHE_COLUMN_COLOR or
+                 * \c DXF_CACHE_COLUMN_ORDER. */
+)
+{
+        if ((column != DXF_CACHE_COLUMN_ID_CODE)
+          && (column != DXF_CACHE_COLUMN_COLOR)
+          && (column != DXF_CACHE_COLUMN_ORDER))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () column %d is not an integer column.\n")),
+                  __FUNCTION__, column);
+                return (NULL);
+        }
+        return ((const int32_t *) dxf_cache_get_column (cache, table, column));
+}
+
+
+/*!
+ * \brief Get the \c layer or \c linetype column (string table indices)
+ * of a cache table.
+ *
+ * \return a pointer to \c number_of_rows values inside the mapping, or
+ * \c NULL when an error occurred.
+ */
+const uint32_t *
+dxf_cache_get_string_column
+(
+        DxfCache *cache,
+                /*!< a pointer to an opened cache. */
+        DxfCacheTableType table,
+                /*!< cache table. */
+        DxfCacheColumnType column
+                /*!< either \c DXF_CACHE_COLUMN_LAYER or
+                 * \c DXF_CACHE_COLUMN_LINETYPE. */
+)
+{
+        if ((column != DXF_CACHE_COLUMN_LAYER)
+          && (column != DXF_CACHE_COLUMN_LINETYPE))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () column %d is not a string column.\n")),
+                  __FUNCTION__, column);
+                return (NULL);
+        }
+        return ((const uint32_t *) dxf_cache_get_column (cache, table, column));
+}
+
+
+/*!
+ * \brief Get an entity specific (geometry) column of a cache table.
+ *
+ * \return a pointer to \c number_of_rows values inside the mapping, or
+ * \c NULL when an error occurred.
+ */
+const double *
+dxf_cache_get_double_column
+(
+        DxfCache *cache,
+                /*!< a pointer to an opened cache. */
+        DxfCacheTableType table,
+                /*!< cache table. */
+        DxfCacheColumnType column
+                /*!< \c DXF_CACHE_COLUMN_X0 or higher. */
+)
+{
+        if (column < DXF_CACHE_COLUMN_X0)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () column %d is not a geometry column.\n")),
+                  __FUNCTION__, column);
+                return (NULL);
+        }
+        return ((const double *) dxf_cache_get_column (cache, table, column));
+}
+
+
+/*!
+ * \brief Get the number of interned strings in a cache.
+ *
+ * \return the number of strings, 0 when an error occurred.
+ */
+uint32_t
+dxf_cache_get_number_of_strings
+(
+        DxfCache *cache
+                /*!< a pointer to an opened cache. */
+)
+{
+        /* Do some basic checks. */
+        if (cache == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (cache->header->number_of_strings);
+}
+
+
+/*!
+ * \brief Get an interned string from a cache.
+ *
+ * \return a pointer to a \c NUL terminated string inside the mapping,
+ * or \c NULL when an error occurred.
+ */
+const char *
+dxf_cache_get_string
+(
+        DxfCache *cache,
+                /*!< a pointer to an opened cache. */
+        uint32_t index
+                /*!< index in the string table. */
+)
+{
+        const uint64_t *string_offsets;
+
+        /* Do some basic checks. */
+        if (cache == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (index >= cache->header->number_of_strings)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () string index %u is out of range.\n")),
+                  __FUNCTION__, index);
+                return (NULL);
+        }
+        string_offsets = (const uint64_t *) (cache->base + cache->header->string_offset_table);
+        return (cache->base + string_offsets[index]);
+}
+
+
+/* EOF */
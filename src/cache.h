@@ -0,0 +1,253 @@
+/*!
+ * \file cache.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for a libDXF native binary cache of a drawing.
+ *
+ * The cache is a compact, memory-mappable snapshot of the entities in a
+ * libDXF drawing.\n
+ * All references inside a cache file are byte offsets relative to the
+ * start of the file (position independent), strings are interned in a
+ * single string table and entity data is stored column wise (one
+ * contiguous array per member).\n
+ * A cache file can thus be \c mmap 'd and queried read-only without
+ * any deserialization.\n
+ * Entities which do not fit a column wise table are kept as DXF text,
+ * \c dxf_drawing_open_cache () reads the cache back into a drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_CACHE_H
+#define LIBDXF_SRC_CACHE_H
+
+
+#include "global.h"
+#include "drawing.h"
+#include "arc.h"
+#include "circle.h"
+#include "line.h"
+#include "point.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_CACHE_MAGIC "LIBDXFC"
+        /*!< \brief Magic string at the start of every cache file
+         * (including the terminating \c NUL character). */
+
+#define DXF_CACHE_VERSION 2
+        /*!< \brief Version of the cache file layout.
+         *
+         * Increment this whenever the layout changes, caches with
+         * another version number are rejected. */
+
+#define DXF_CACHE_BYTE_ORDER_MARK 0x01020304
+        /*!< \brief Byte order mark, caches written on a machine with
+         * another byte order are rejected. */
+
+#define DXF_CACHE_MAX_COLUMNS 16
+        /*!< \brief The maximum number of columns in a cache table. */
+
+
+/*!
+ * \brief Cache tables, one table for each entity type stored column
+ * wise, and one table for all other entities.
+ */
+typedef enum
+dxf_cache_table_type
+{
+        DXF_CACHE_TABLE_POINT = 0,
+        DXF_CACHE_TABLE_LINE,
+        DXF_CACHE_TABLE_CIRCLE,
+        DXF_CACHE_TABLE_ARC,
+        DXF_CACHE_TABLE_OTHER,
+                /*!< Entities of any type which are not stored column
+                 * wise (see \c dxf_paged_entities_is_plain ()), only
+                 * the common columns are stored, the entity itself is
+                 * kept as DXF text.\n
+                 * The linetype column of this table holds empty
+                 * strings. */
+        DXF_CACHE_NUMBER_OF_TABLES
+} DxfCacheTableType;
+
+
+/*!
+ * \brief Columns common to all cache tables.
+ *
+ * Column \c DXF_CACHE_COLUMN_ID_CODE, \c DXF_CACHE_COLUMN_COLOR and
+ * \c DXF_CACHE_COLUMN_ORDER are arrays of \c int32_t, column
+ * \c DXF_CACHE_COLUMN_LAYER and
+ * \c DXF_CACHE_COLUMN_LINETYPE are arrays of \c uint32_t indices into
+ * the string table.\n
+ * All following (entity specific) columns are arrays of \c double.
+ */
+typedef enum
+dxf_cache_column_type
+{
+        DXF_CACHE_COLUMN_ID_CODE = 0,
+        DXF_CACHE_COLUMN_LAYER,
+        DXF_CACHE_COLUMN_LINETYPE,
+        DXF_CACHE_COLUMN_COLOR,
+        DXF_CACHE_COLUMN_ORDER,
+                /*!< Position of the entity in the drawing, from 0 up to
+                 * the number of entities in the cache. */
+        DXF_CACHE_COLUMN_X0,
+                /*!< First entity specific column, for all tables the
+                 * X-value of the base point. */
+        DXF_CACHE_COLUMN_Y0,
+        DXF_CACHE_COLUMN_Z0,
+        DXF_CACHE_COLUMN_X1,
+                /*!< \c LINE: X-value of the end point.\n
+                 * \c CIRCLE and \c ARC: radius. */
+        DXF_CACHE_COLUMN_Y1,
+                /*!< \c LINE: Y-value of the end point.\n
+                 * \c ARC: start angle. */
+        DXF_CACHE_COLUMN_Z1
+                /*!< \c LINE: Z-value of the end point.\n
+                 * \c ARC: end angle. */
+} DxfCacheColumnType;
+
+
+/*!
+ * \brief Column aliases for the \c CIRCLE and \c ARC tables.
+ */
+#define DXF_CACHE_COLUMN_RADIUS DXF_CACHE_COLUMN_X1
+#define DXF_CACHE_COLUMN_START_ANGLE DXF_CACHE_COLUMN_Y1
+#define DXF_CACHE_COLUMN_END_ANGLE DXF_CACHE_COLUMN_Z1
+
+
+/*!
+ * \brief On disk description of a cache table.
+ */
+typedef struct
+dxf_cache_table_struct
+{
+        uint64_t number_of_rows;
+                /*!< Number of cached entities in the table. */
+        uint32_t number_of_columns;
+                /*!< Number of valid entries in \c column_offset. */
+        uint32_t reserved;
+                /*!< Padding, always 0. */
+        uint64_t column_offset[DXF_CACHE_MAX_COLUMNS];
+                /*!< Byte offset of each column relative to the start
+                 * of the cache file, every column is 8 byte aligned. */
+} DxfCacheTable;
+
+
+/*!
+ * \brief On disk header of a cache file.
+ *
+ * The header is located at offset 0 of the cache file.
+ */
+typedef struct
+dxf_cache_header_struct
+{
+        char magic[8];
+                /*!< Magic string \c DXF_CACHE_MAGIC. */
+        uint32_t version;
+                /*!< Cache layout version \c DXF_CACHE_VERSION. */
+        uint32_t byte_order;
+                /*!< Byte order mark \c DXF_CACHE_BYTE_ORDER_MARK. */
+        uint64_t file_size;
+                /*!< Size of the cache file in bytes. */
+        uint64_t source_size;
+                /*!< Size of the source DXF file in bytes. */
+        int64_t source_mtime;
+                /*!< Modification time of the source DXF file
+                 * (seconds). */
+        int64_t source_mtime_nsec;
+                /*!< Modification time of the source DXF file
+                 * (nanoseconds). */
+        uint64_t source_hash;
+                /*!< FNV-1a 64 bit hash of the contents of the source
+                 * DXF file. */
+        int32_t acad_version_number;
+                /*!< AutoCAD version number of the source drawing. */
+        uint32_t number_of_strings;
+                /*!< Number of interned strings. */
+        uint64_t string_offset_table;
+                /*!< Byte offset of an array of \c number_of_strings
+                 * \c uint64_t offsets, each pointing to a \c NUL
+                 * terminated string. */
+        uint64_t number_of_entities;
+                /*!< Number of entities in all tables. */
+        uint64_t entities_offset;
+                /*!< Byte offset of the DXF text of the entities in
+                 * \c DXF_CACHE_TABLE_OTHER, in order, followed by an
+                 * \c ENDSEC marker. */
+        uint64_t entities_size;
+                /*!< Size of the DXF text in bytes. */
+        DxfCacheTable table[DXF_CACHE_NUMBER_OF_TABLES];
+                /*!< Entity tables. */
+} DxfCacheHeader;
+
+
+/*!
+ * \brief A read-only, memory-mapped cache file.
+ */
+typedef struct
+dxf_cache_struct
+{
+        int fd;
+                /*!< File descriptor of the cache file. */
+        size_t size;
+                /*!< Size of the mapping in bytes. */
+        const char *base;
+                /*!< Start of the mapping. */
+        const DxfCacheHeader *header;
+                /*!< The cache header (equal to \c base). */
+} DxfCache;
+
+
+int dxf_drawing_save_cache (DxfDrawing *drawing, const char *cache_filename, const char *source_filename);
+DxfDrawing *dxf_drawing_open_cache (const char *cache_filename, const char *source_filename);
+DxfCache *dxf_cache_open (const char *cache_filename, const char *source_filename);
+int dxf_cache_close (DxfCache *cache);
+int dxf_cache_is_valid (const char *cache_filename, const char *source_filename);
+uint64_t dxf_cache_hash_file (const char *filename);
+uint64_t dxf_cache_get_number_of_rows (DxfCache *cache, DxfCacheTableType table);
+const int32_t *dxf_cache_get_int_column (DxfCache *cache, DxfCacheTableType table, DxfCacheColumnType column);
+const uint32_t *dxf_cache_get_string_column (DxfCache *cache, DxfCacheTableType table, DxfCacheColumnType column);
+const double *dxf_cache_get_double_column (DxfCache *cache, DxfCacheTableType table, DxfCacheColumnType column);
+uint32_t dxf_cache_get_number_of_strings (DxfCache *cache);
+const char *dxf_cache_get_string (DxfCache *cache, uint32_t index);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_CACHE_H */
+
+
+/* EOF */
@@ -42,6 +42,7 @@
 
 
 #include "circle.h"
+#include "util.h"
 
 
 /*!
@@ -61,9 +62,9 @@ dxf_circle_new ()
         size = sizeof (DxfCircle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((circle = malloc (size)) == NULL)
+        if ((circle = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfCircle struct.\n")),
                   __FUNCTION__);
                 circle = NULL;
@@ -71,6 +72,8 @@ dxf_circle_new ()
         else
         {
                 memset (circle, 0, size);
+                circle->header.type = CIRCLE;
+                DXF_TRACING_COUNT (CIRCLE, DXF_TRACING_ALLOCATIONS, 1);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -99,21 +102,21 @@ dxf_circle_init
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 circle = dxf_circle_new ();
         }
         if (circle == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfCircle struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_circle_set_id_code (circle, 0);
-        dxf_circle_set_linetype (circle, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_circle_set_layer (circle, strdup (DXF_DEFAULT_LAYER));
+        dxf_circle_set_linetype (circle, DXF_DEFAULT_LINETYPE);
+        dxf_circle_set_layer (circle, DXF_DEFAULT_LAYER);
         dxf_circle_set_elevation (circle, 0.0);
         dxf_circle_set_thickness (circle, 0.0);
         dxf_circle_set_linetype_scale (circle, DXF_DEFAULT_LINETYPE_SCALE);
@@ -124,13 +127,13 @@ dxf_circle_init
         dxf_circle_set_shadow_mode (circle, 0);
         dxf_circle_set_binary_graphics_data (circle, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
         dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_circle_get_binary_graphics_data (circle));
-        dxf_circle_set_dictionary_owner_soft (circle, strdup (""));
-        dxf_circle_set_material (circle, strdup (""));
-        dxf_circle_set_dictionary_owner_hard (circle, strdup (""));
+        dxf_circle_set_dictionary_owner_soft (circle, "");
+        dxf_circle_set_material (circle, "");
+        dxf_circle_set_dictionary_owner_hard (circle, "");
         dxf_circle_set_lineweight (circle, 0);
-        dxf_circle_set_plot_style_name (circle, strdup (""));
+        dxf_circle_set_plot_style_name (circle, "");
         dxf_circle_set_color_value (circle, 0);
-        dxf_circle_set_color_name (circle, strdup (""));
+        dxf_circle_set_color_name (circle, "");
         dxf_circle_set_transparency (circle, 0);
         dxf_circle_set_p0 (circle, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_circle_get_p0 (circle));
@@ -146,6 +149,69 @@ dxf_circle_init
 }
 
 
+/*!
+ * \brief Reset a DXF \c CIRCLE entity to the values set by
+ * \c dxf_circle_init (), reusing its allocated members.
+ *
+ * The center point \c p0 stays allocated.\n
+ * The link to the next entity is kept.
+ *
+ * \return a pointer to the DXF \c CIRCLE entity, or a newly allocated
+ * and initialized one when \c NULL was passed.
+ */
+DxfCircle *
+dxf_circle_reset
+(
+        DxfCircle *circle
+                /*!< a pointer to the DXF \c CIRCLE entity, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (circle == NULL)
+        {
+                return (dxf_circle_init (dxf_circle_new ()));
+        }
+        circle->id_code = 0;
+        dxf_string_assign (&circle->linetype, DXF_DEFAULT_LINETYPE);
+        dxf_string_assign (&circle->layer, DXF_DEFAULT_LAYER);
+        circle->elevation = 0.0;
+        circle->thickness = 0.0;
+        circle->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
+        circle->visibility = DXF_DEFAULT_VISIBILITY;
+        circle->color = DXF_COLOR_BYLAYER;
+        circle->paperspace = DXF_MODELSPACE;
+        circle->graphics_data_size = 0;
+        circle->shadow_mode = 0;
+        if (circle->binary_graphics_data == NULL)
+        {
+                circle->binary_graphics_data = dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+        }
+        else
+        {
+                dxf_binary_graphics_data_reset (circle->binary_graphics_data);
+        }
+        dxf_string_assign (&circle->dictionary_owner_soft, "");
+        dxf_string_assign (&circle->material, "");
+        dxf_string_assign (&circle->dictionary_owner_hard, "");
+        circle->lineweight = 0;
+        dxf_string_assign (&circle->plot_style_name, "");
+        circle->color_value = 0;
+        dxf_string_assign (&circle->color_name, "");
+        circle->transparency = 0;
+        circle->p0 = dxf_point_reset (circle->p0);
+        circle->radius = 0.0;
+        circle->extr_x0 = 0.0;
+        circle->extr_y0 = 0.0;
+        circle->extr_z0 = 0.0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (circle);
+}
+
+
 /*!
  * \brief Read data from a DXF file into a DXF \c CIRCLE entity.
  *
@@ -169,38 +235,36 @@ dxf_circle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 circle = dxf_circle_new ();
                 circle = dxf_circle_init (circle);
         }
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (CIRCLE, fp);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -215,13 +279,13 @@ dxf_circle_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", circle->linetype);
+                        dxf_read_string (fp, &circle->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", circle->layer);
+                        dxf_read_string (fp, &circle->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -305,7 +369,7 @@ dxf_circle_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && (strcmp (temp_string, "AcDbCircle") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -336,14 +400,14 @@ dxf_circle_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", circle->dictionary_owner_soft);
+                        dxf_read_string (fp, &circle->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", circle->dictionary_owner_hard);
+                        dxf_read_string (fp, &circle->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -354,22 +418,27 @@ dxf_circle_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (dxf_circle_get_linetype (circle), "") == 0)
+        if (strcmp (circle->linetype, "") == 0)
         {
-                dxf_circle_set_linetype (circle, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_string_assign (&circle->linetype, DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (dxf_circle_get_layer (circle), "") == 0)
+        if (strcmp (circle->layer, "") == 0)
         {
-                dxf_circle_set_layer (circle, strdup (DXF_DEFAULT_LAYER));
+                dxf_string_assign (&circle->layer, DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
+        DXF_TRACING_ENTITY_END (CIRCLE, fp, trace_offset);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -392,55 +461,55 @@ dxf_circle_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("CIRCLE");
+        char *dxf_entity_name = dxf_strdup ("CIRCLE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_circle_get_radius (circle) == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () radius value equals 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_circle_get_id_code (circle));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_circle_get_linetype (circle), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_circle_get_id_code (circle));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_circle_set_linetype (circle, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_circle_set_linetype (circle, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_circle_get_layer (circle), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_circle_get_id_code (circle));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name );
-                dxf_circle_set_layer (circle, strdup (DXF_DEFAULT_LAYER));
+                dxf_circle_set_layer (circle, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -491,7 +560,7 @@ dxf_circle_write
         }
         if (dxf_circle_get_linetype_scale (circle) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_circle_get_linetype_scale (circle));
+                dxf_write_real (fp, 48, dxf_circle_get_linetype_scale (circle));
         }
         if (dxf_circle_get_visibility (circle) != 0)
         {
@@ -505,27 +574,27 @@ dxf_circle_write
           && DXF_FLATLAND
           && (dxf_circle_get_elevation (circle) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_circle_get_elevation (circle));
+                dxf_write_real (fp, 38, dxf_circle_get_elevation (circle));
         }
         if (dxf_circle_get_thickness (circle) != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_circle_get_thickness (circle));
+                dxf_write_real (fp, 39, dxf_circle_get_thickness (circle));
         }
-        fprintf (fp->fp, " 10\n%f\n", dxf_circle_get_x0 (circle));
-        fprintf (fp->fp, " 20\n%f\n", dxf_circle_get_y0 (circle));
-        fprintf (fp->fp, " 30\n%f\n", dxf_circle_get_z0 (circle));
-        fprintf (fp->fp, " 40\n%f\n", dxf_circle_get_radius (circle));
+        dxf_write_real (fp, 10, dxf_circle_get_x0 (circle));
+        dxf_write_real (fp, 20, dxf_circle_get_y0 (circle));
+        dxf_write_real (fp, 30, dxf_circle_get_z0 (circle));
+        dxf_write_real (fp, 40, dxf_circle_get_radius (circle));
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (circle->extr_x0 != 0.0)
                 && (circle->extr_y0 != 0.0)
                 && (circle->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", circle->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", circle->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", circle->extr_z0);
+                dxf_write_real (fp, 210, circle->extr_x0);
+                dxf_write_real (fp, 220, circle->extr_y0);
+                dxf_write_real (fp, 230, circle->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -553,16 +622,21 @@ dxf_circle_free
 #endif
         if (circle->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("ERROR in %s () pointer to next DxfCircle was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (circle->linetype);
-        free (circle->layer);
-        free (circle->dictionary_owner_soft);
-        free (circle->dictionary_owner_hard);
-        free (circle);
+        dxf_free (circle->linetype);
+        dxf_free (circle->layer);
+        dxf_binary_graphics_data_free_chain (circle->binary_graphics_data);
+        dxf_free (circle->dictionary_owner_soft);
+        dxf_free (circle->material);
+        dxf_free (circle->dictionary_owner_hard);
+        dxf_free (circle->plot_style_name);
+        dxf_free (circle->color_name);
+        dxf_point_free (circle->p0);
+        dxf_free (circle);
         circle = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -582,18 +656,19 @@ dxf_circle_free_chain
                 /*!< pointer to the chain of DXF \c CIRCLE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (circles == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (circles != NULL)
         {
                 struct DxfCircle *iter = circles->next;
+                circles->next = NULL;
                 dxf_circle_free (circles);
                 circles = (DxfCircle *) iter;
         }
@@ -621,14 +696,14 @@ dxf_circle_get_id_code
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -660,14 +735,14 @@ dxf_circle_set_id_code
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -698,14 +773,14 @@ dxf_circle_get_linetype
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -713,7 +788,7 @@ dxf_circle_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->linetype));
+        return (dxf_strdup (circle->linetype));
 }
 
 
@@ -735,19 +810,20 @@ dxf_circle_set_linetype
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->linetype = strdup (linetype);
+        circle->linetype = dxf_strdup (linetype);
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -773,14 +849,14 @@ dxf_circle_get_layer
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -788,7 +864,7 @@ dxf_circle_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->layer));
+        return (dxf_strdup (circle->layer));
 }
 
 
@@ -810,19 +886,20 @@ dxf_circle_set_layer
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->layer = strdup (layer);
+        circle->layer = dxf_strdup (layer);
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -848,7 +925,7 @@ dxf_circle_get_elevation
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -878,12 +955,13 @@ dxf_circle_set_elevation
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->elevation = elevation;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -909,14 +987,14 @@ dxf_circle_get_thickness
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -946,19 +1024,20 @@ dxf_circle_set_thickness
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->thickness = thickness;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -984,14 +1063,14 @@ dxf_circle_get_linetype_scale
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1021,19 +1100,20 @@ dxf_circle_set_linetype_scale
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative linetype scale value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->linetype_scale = linetype_scale;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1059,21 +1139,21 @@ dxf_circle_get_visibility
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1103,26 +1183,27 @@ dxf_circle_set_visibility
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->visibility = visibility;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1148,14 +1229,14 @@ dxf_circle_get_color
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1184,20 +1265,21 @@ dxf_circle_set_color
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         circle->color = color;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1223,20 +1305,20 @@ dxf_circle_get_paperspace
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (circle->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1265,26 +1347,27 @@ dxf_circle_set_paperspace
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->paperspace = paperspace;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1312,20 +1395,20 @@ dxf_circle_get_graphics_data_size
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
         if (circle->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
@@ -1358,26 +1441,27 @@ dxf_circle_set_graphics_data_size
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->graphics_data_size = graphics_data_size;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1404,21 +1488,21 @@ dxf_circle_get_shadow_mode
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1451,26 +1535,27 @@ dxf_circle_set_shadow_mode
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->shadow_mode = shadow_mode;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1499,14 +1584,14 @@ dxf_circle_get_binary_graphics_data
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1541,19 +1626,20 @@ dxf_circle_set_binary_graphics_data
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1582,14 +1668,14 @@ dxf_circle_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1597,7 +1683,7 @@ dxf_circle_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->dictionary_owner_soft));
+        return (dxf_strdup (circle->dictionary_owner_soft));
 }
 
 
@@ -1621,19 +1707,20 @@ dxf_circle_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        circle->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1663,14 +1750,14 @@ dxf_circle_get_material
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the material member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1678,7 +1765,7 @@ dxf_circle_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->material));
+        return (dxf_strdup (circle->material));
 }
 
 
@@ -1704,19 +1791,20 @@ dxf_circle_set_material
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->material = strdup (material);
+        circle->material = dxf_strdup (material);
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1745,14 +1833,14 @@ dxf_circle_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1760,7 +1848,7 @@ dxf_circle_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->dictionary_owner_hard));
+        return (dxf_strdup (circle->dictionary_owner_hard));
 }
 
 
@@ -1784,19 +1872,20 @@ dxf_circle_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        circle->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1823,7 +1912,7 @@ dxf_circle_get_lineweight
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1856,12 +1945,13 @@ dxf_circle_set_lineweight
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->lineweight = lineweight;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1888,14 +1978,14 @@ dxf_circle_get_plot_style_name
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1903,7 +1993,7 @@ dxf_circle_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->plot_style_name));
+        return (dxf_strdup (circle->plot_style_name));
 }
 
 
@@ -1929,19 +2019,20 @@ dxf_circle_set_plot_style_name
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->plot_style_name = strdup (plot_style_name);
+        circle->plot_style_name = dxf_strdup (plot_style_name);
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1968,7 +2059,7 @@ dxf_circle_get_color_value
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2001,12 +2092,13 @@ dxf_circle_set_color_value
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->color_value = color_value;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2033,14 +2125,14 @@ dxf_circle_get_color_name
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2048,7 +2140,7 @@ dxf_circle_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (circle->color_name));
+        return (dxf_strdup (circle->color_name));
 }
 
 
@@ -2074,19 +2166,20 @@ dxf_circle_set_color_name
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        circle->color_name = strdup (color_name);
+        circle->color_name = dxf_strdup (color_name);
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2113,7 +2206,7 @@ dxf_circle_get_transparency
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2146,12 +2239,13 @@ dxf_circle_set_transparency
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->transparency = transparency;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2171,20 +2265,20 @@ dxf_circle_get_p0
                 /*!< a pointer to a DXF \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2210,25 +2304,26 @@ dxf_circle_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->p0 = (DxfPoint *) point;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2249,21 +2344,21 @@ dxf_circle_get_x0
                 /*!< a pointer to a DXF \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2292,25 +2387,26 @@ dxf_circle_set_x0
                  * \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->p0->x0 = x0;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2331,21 +2427,21 @@ dxf_circle_get_y0
                 /*!< a pointer to a DXF \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2374,25 +2470,26 @@ dxf_circle_set_y0
                  * \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->p0->y0 = y0;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2413,21 +2510,21 @@ dxf_circle_get_z0
                 /*!< a pointer to a DXF \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2456,25 +2553,26 @@ dxf_circle_set_z0
                  * \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->p0->z0 = z0;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2500,21 +2598,21 @@ dxf_circle_get_radius
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->radius < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the radius member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->radius == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was found in the radius member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2544,26 +2642,27 @@ dxf_circle_set_radius
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (radius < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative radius value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (radius == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->radius = radius;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2586,7 +2685,7 @@ dxf_circle_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c CIRCLE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -2594,7 +2693,7 @@ dxf_circle_get_extrusion_vector_as_point
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2602,7 +2701,7 @@ dxf_circle_get_extrusion_vector_as_point
         point = dxf_point_init (point);
         if (point == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -2639,7 +2738,7 @@ dxf_circle_set_extrusion_vector
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2647,6 +2746,7 @@ dxf_circle_set_extrusion_vector
         circle->extr_x0 = extr_x0;
         circle->extr_y0 = extr_y0;
         circle->extr_z0 = extr_z0;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2672,7 +2772,7 @@ dxf_circle_get_extr_x0
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2702,12 +2802,13 @@ dxf_circle_set_extr_x0
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->extr_x0 = extr_x0;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2733,7 +2834,7 @@ dxf_circle_get_extr_y0
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2763,12 +2864,13 @@ dxf_circle_set_extr_y0
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->extr_y0 = extr_y0;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2794,7 +2896,7 @@ dxf_circle_get_extr_z0
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2824,12 +2926,13 @@ dxf_circle_set_extr_z0
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         circle->extr_z0 = extr_z0;
+        circle->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2855,21 +2958,21 @@ dxf_circle_get_area
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->radius < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the radius member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->radius == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was found in the radius member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2899,21 +3002,21 @@ dxf_circle_get_circumference
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->radius < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the radius member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->radius == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was found in the radius member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2953,21 +3056,21 @@ dxf_circle_test_point_in_circle
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->radius < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the radius member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (circle->radius == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was found in the radius member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3012,14 +3115,14 @@ dxf_circle_get_next
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3050,14 +3153,14 @@ dxf_circle_set_next
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3091,14 +3194,14 @@ dxf_circle_get_last
         /* Do some basic checks. */
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (circle->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfCircle *) circle);
@@ -62,6 +62,9 @@ extern "C" {
 typedef struct
 dxf_circle_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -213,6 +216,7 @@ dxf_circle_struct
 
 DxfCircle *dxf_circle_new ();
 DxfCircle *dxf_circle_init (DxfCircle *circle);
+DxfCircle *dxf_circle_reset (DxfCircle *circle);
 DxfCircle *dxf_circle_read (DxfFile *fp, DxfCircle *circle);
 int dxf_circle_write (DxfFile *fp, DxfCircle *circle);
 int dxf_circle_free (DxfCircle *circle);
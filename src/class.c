@@ -44,6 +44,7 @@
 
 
 #include "class.h"
+#include "util.h"
 
 
 /*!
@@ -63,9 +64,9 @@ dxf_class_new ()
         size = sizeof (DxfClass);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((class = malloc (size)) == NULL)
+        if ((class = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfClass struct.\n")),
                   __FUNCTION__);
                 class = NULL;
@@ -101,22 +102,22 @@ dxf_class_init
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 class = dxf_class_new ();
         }
         if (class == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfClass struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        dxf_class_set_record_type (class, strdup (""));
-        dxf_class_set_record_name (class, strdup (""));
-        dxf_class_set_class_name (class, strdup (""));
-        dxf_class_set_app_name (class, strdup (""));
+        dxf_class_set_record_type (class, dxf_strdup (""));
+        dxf_class_set_record_name (class, dxf_strdup (""));
+        dxf_class_set_class_name (class, dxf_strdup (""));
+        dxf_class_set_app_name (class, dxf_strdup (""));
         dxf_class_set_proxy_cap_flag (class, 0);
         dxf_class_set_was_a_proxy_flag (class, 0);
         dxf_class_set_is_an_entity_flag (class, 0);
@@ -151,38 +152,34 @@ dxf_class_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 class = dxf_class_new ();
                 class = dxf_class_init (class);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "0") == 0)
@@ -195,28 +192,28 @@ dxf_class_read
                          * read. See the while condition above.
                          */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", class->record_type);
+                        dxf_read_string (fp, &class->record_type);
                 }
                 else if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a record
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", class->record_name);
+                        dxf_read_string (fp, &class->record_name);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a class name.
                          */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", class->class_name);
+                        dxf_read_string (fp, &class->class_name);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing the
                          * application name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", class->app_name);
+                        dxf_read_string (fp, &class->app_name);
                 }
                 else if (strcmp (temp_string, "90") == 0)
                 {
@@ -248,15 +245,21 @@ dxf_class_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_class_get_record_type (class), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty record type string after reading from: %s before line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
@@ -264,20 +267,18 @@ dxf_class_read
         }
         if (strcmp (dxf_class_get_record_name (class), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty record name string after reading from: %s before line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
         }
         if (strcmp (dxf_class_get_class_name (class), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty class name string after reading from: %s before line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -303,66 +304,66 @@ dxf_class_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("CLASS");
+        char *dxf_entity_name = dxf_strdup ("CLASS");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (!dxf_class_get_record_type (class)
                 || (strcmp (dxf_class_get_record_type (class), "") == 0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty record type string for the %s entity\n")),
                   __FUNCTION__, dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (!dxf_class_get_class_name (class)
                 || (strcmp (dxf_class_get_class_name (class), "") == 0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty class name string for the %s entity\n")),
                   __FUNCTION__, dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (!dxf_class_get_record_name (class))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty record name string for the %s entity\n")),
                   __FUNCTION__, dxf_entity_name);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\trecord_name of %s entity is reset to \"\"")),
                   dxf_entity_name );
-                dxf_class_set_record_name (class, strdup (""));
+                dxf_class_set_record_name (class, dxf_strdup (""));
         }
         if (!dxf_class_get_app_name (class))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty app name string for the %s entity\n")),
                   __FUNCTION__, dxf_entity_name);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tapp_name of %s entity is reset to \"\"")),
                   dxf_entity_name );
-                dxf_class_set_app_name (class, strdup (""));
+                dxf_class_set_app_name (class, dxf_strdup (""));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -376,7 +377,7 @@ dxf_class_write
         fprintf (fp->fp, "280\n%d\n", dxf_class_get_was_a_proxy_flag (class));
         fprintf (fp->fp, "281\n%d\n", dxf_class_get_is_an_entity_flag (class));
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -403,7 +404,7 @@ dxf_class_write_endclass
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -437,16 +438,16 @@ dxf_class_free
 #endif
         if (class->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfClass was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (class->record_type);
-        free (class->record_name);
-        free (class->class_name);
-        free (class->app_name);
-        free (class);
+        dxf_free (class->record_type);
+        dxf_free (class->record_name);
+        dxf_free (class->class_name);
+        dxf_free (class->app_name);
+        dxf_free (class);
         class = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -466,18 +467,19 @@ dxf_class_free_chain
                 /*!< pointer to the chain of DXF \c CLASS classes. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (classes == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (classes != NULL)
         {
                 struct DxfClass *iter = classes->next;
+                classes->next = NULL;
                 dxf_class_free (classes);
                 classes = (DxfClass *) iter;
         }
@@ -507,19 +509,19 @@ dxf_class_get_record_type
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class->record_type ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the record type member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->record_type);
+        result = dxf_strdup (class->record_type);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -545,19 +547,19 @@ dxf_class_set_record_type
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (record_type == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        class->record_type = strdup (record_type);
+        class->record_type = dxf_strdup (record_type);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -585,19 +587,19 @@ dxf_class_get_record_name
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class->record_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the record name member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->record_name);
+        result = dxf_strdup (class->record_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -623,19 +625,19 @@ dxf_class_set_record_name
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (record_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        class->record_name = strdup (record_name);
+        class->record_name = dxf_strdup (record_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -663,19 +665,19 @@ dxf_class_get_class_name
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class->class_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the class name member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->class_name);
+        result = dxf_strdup (class->class_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -701,19 +703,19 @@ dxf_class_set_class_name
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        class->class_name = strdup (class_name);
+        class->class_name = dxf_strdup (class_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -741,19 +743,19 @@ dxf_class_get_app_name
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class->app_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the class name member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (class->app_name);
+        result = dxf_strdup (class->app_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -780,19 +782,19 @@ dxf_class_set_app_name
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (app_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        class->app_name = strdup (app_name);
+        class->app_name = dxf_strdup (app_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -820,14 +822,14 @@ dxf_class_get_proxy_cap_flag
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (class->proxy_cap_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the proxy_cap_flag member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -858,14 +860,14 @@ dxf_class_set_proxy_cap_flag
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (proxy_cap_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative proxy_cap_flag value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -901,7 +903,7 @@ dxf_class_is_editable
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -937,7 +939,7 @@ dxf_class_erase_allowed
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -973,7 +975,7 @@ dxf_class_transform_allowed
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1009,7 +1011,7 @@ dxf_class_color_change_allowed
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1045,7 +1047,7 @@ dxf_class_layer_change_allowed
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1081,7 +1083,7 @@ dxf_class_linetype_change_allowed
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1117,7 +1119,7 @@ dxf_class_linetype_scale_change_allowed
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1153,7 +1155,7 @@ dxf_class_visibility_change_allowed
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1188,7 +1190,7 @@ dxf_class_cloning_allowed
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1224,7 +1226,7 @@ dxf_class_lineweight_change_allowed
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1260,7 +1262,7 @@ dxf_class_plot_style_name_change_allowed
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1296,7 +1298,7 @@ dxf_class_is_R13_format_proxy
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1329,21 +1331,21 @@ dxf_class_get_was_a_proxy_flag
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (class->was_a_proxy_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the was_a_proxy_flag member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (class->was_a_proxy_flag > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found in the was_a_proxy_flag member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1374,21 +1376,21 @@ dxf_class_set_was_a_proxy_flag
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (was_a_proxy_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative was_a_proxy_flag value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (was_a_proxy_flag > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid was_a_proxy_flag value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1421,21 +1423,21 @@ dxf_class_get_is_an_entity_flag
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (class->is_an_entity_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the is_an_entity_flag member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (class->is_an_entity_flag > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found in the is_an_entity_flag member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1466,21 +1468,21 @@ dxf_class_set_is_an_entity_flag
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (is_an_entity_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative is_an_entity_flag value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (is_an_entity_flag > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid is_an_entity_flag value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1516,14 +1518,14 @@ dxf_class_get_next
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1555,14 +1557,14 @@ dxf_class_set_next
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1596,14 +1598,14 @@ dxf_class_get_last
         /* Do some basic checks. */
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfClass *) class);
@@ -52,9 +52,9 @@ dxf_RGB_color_new ()
         size = sizeof (DxfRGBColor);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((RGB_color = malloc (size)) == NULL)
+        if ((RGB_color = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfRGBCcolor struct.\n")),
                   __FUNCTION__);
                 RGB_color = NULL;
@@ -98,7 +98,7 @@ dxf_RGB_color_set
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error red color value in %s () out of range.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -109,7 +109,7 @@ dxf_RGB_color_set
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error green color value in %s () out of range.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -120,7 +120,7 @@ dxf_RGB_color_set
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error blue color value in %s () out of range.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -129,12 +129,12 @@ dxf_RGB_color_set
         name = dxf_RGB_color_get_name (triplet);
         if (name != NULL)
         {
-                RGB_color->name = strdup (name);
-                free (name);
+                RGB_color->name = dxf_strdup (name);
+                dxf_free (name);
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error name value in %s () contains a NULL pointer.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -167,9 +167,9 @@ dxf_ACI_init
         size = sizeof (DxfRGBColor);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ACI = malloc (size * DXF_COLOR_INDEX_MAX_NUMBER_OF_COLORS)) == NULL)
+        if ((ACI = dxf_malloc (size * DXF_COLOR_INDEX_MAX_NUMBER_OF_COLORS)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfRGBCcolor array.\n")),
                   __FUNCTION__);
                 ACI = NULL;
@@ -466,7 +466,7 @@ dxf_RGB_to_triplet
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error red color value in %s () out of range.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -477,7 +477,7 @@ dxf_RGB_to_triplet
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error green color value in %s () out of range.\n")),
                   __FUNCTION__);
                 return (-2);
@@ -488,7 +488,7 @@ dxf_RGB_to_triplet
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error blue color value in %s () out of range.\n")),
                   __FUNCTION__);
                 return (-3);
@@ -529,1672 +529,1672 @@ dxf_RGB_color_get_name
         {
                 case 0xF0F8FF :
                 {
-                        RGB_color_name = strdup ("Alice blue");
+                        RGB_color_name = dxf_strdup ("Alice blue");
                         return (RGB_color_name);
                 }
 /*
                 case 0xE32636 :
                 {
-                        RGB_color_name = strdup ("Alizarin");
+                        RGB_color_name = dxf_strdup ("Alizarin");
                         return (RGB_color_name);
                 }
 */
                 case 0xE52B50 :
                 {
-                        RGB_color_name = strdup ("Amaranth");
+                        RGB_color_name = dxf_strdup ("Amaranth");
                         return (RGB_color_name);
                 }
                 case 0xF19CBB :
                 {
-                        RGB_color_name = strdup ("Amaranth Pink");
+                        RGB_color_name = dxf_strdup ("Amaranth Pink");
                         return (RGB_color_name);
                 }
                 case 0xFFBF00 :
                 {
-                        RGB_color_name = strdup ("Amber");
+                        RGB_color_name = dxf_strdup ("Amber");
                         return (RGB_color_name);
                 }
                 case 0x9966CC :
                 {
-                        RGB_color_name = strdup ("Amethyst");
+                        RGB_color_name = dxf_strdup ("Amethyst");
                         return (RGB_color_name);
                 }
                 case 0xFBCEB1 :
                 {
-                        RGB_color_name = strdup ("Apricot");
+                        RGB_color_name = dxf_strdup ("Apricot");
                         return (RGB_color_name);
                 }
 /*
                 case 0x00FFFF :
                 {
-                        RGB_color_name = strdup ("Aqua");
+                        RGB_color_name = dxf_strdup ("Aqua");
                         return (RGB_color_name);
                 }
 */
                 case 0x7FFFD4 :
                 {
-                        RGB_color_name = strdup ("Aquamarine");
+                        RGB_color_name = dxf_strdup ("Aquamarine");
                         return (RGB_color_name);
                 }
                 case 0x4B5320 :
                 {
-                        RGB_color_name = strdup ("Aemy green");
+                        RGB_color_name = dxf_strdup ("Aemy green");
                         return (RGB_color_name);
                 }
                 case 0x7BA05B :
                 {
-                        RGB_color_name = strdup ("Asparagus");
+                        RGB_color_name = dxf_strdup ("Asparagus");
                         return (RGB_color_name);
                 }
 /*
                 case 0xFF9966 :
                 {
-                        RGB_color_name = strdup ("Atomic tangerine");
+                        RGB_color_name = dxf_strdup ("Atomic tangerine");
                         return (RGB_color_name);
                 }
 */
                 case 0x6D351A :
                 {
-                        RGB_color_name = strdup ("Auburn");
+                        RGB_color_name = dxf_strdup ("Auburn");
                         return (RGB_color_name);
                 }
                 case 0x007FFF :
                 {
-                        RGB_color_name = strdup ("Azure (color wheel)");
+                        RGB_color_name = dxf_strdup ("Azure (color wheel)");
                         return (RGB_color_name);
                 }
                 case 0xF0FFFF :
                 {
-                        RGB_color_name = strdup ("Azure (web)");
+                        RGB_color_name = dxf_strdup ("Azure (web)");
                         return (RGB_color_name);
                 }
                 case 0xE0FFFF :
                 {
-                        RGB_color_name = strdup ("Baby blue");
+                        RGB_color_name = dxf_strdup ("Baby blue");
                         return (RGB_color_name);
                 }
                 case 0xF5F5DC :
                 {
-                        RGB_color_name = strdup ("Beige");
+                        RGB_color_name = dxf_strdup ("Beige");
                         return (RGB_color_name);
                 }
                 case 0x3D2B1F :
                 {
-                        RGB_color_name = strdup ("Bistre");
+                        RGB_color_name = dxf_strdup ("Bistre");
                         return (RGB_color_name);
                 }
                 case 0x000000 :
                 {
-                        RGB_color_name = strdup ("Black");
+                        RGB_color_name = dxf_strdup ("Black");
                         return (RGB_color_name);
                 }
                 case 0x0000FF :
                 {
-                        RGB_color_name = strdup ("Blue");
+                        RGB_color_name = dxf_strdup ("Blue");
                         return (RGB_color_name);
                 }
                 case 0x333399 :
                 {
-                        RGB_color_name = strdup ("Blue (pigment)");
+                        RGB_color_name = dxf_strdup ("Blue (pigment)");
                         return (RGB_color_name);
                 }
                 case 0x0247FE :
                 {
-                        RGB_color_name = strdup ("Blue (RYB)");
+                        RGB_color_name = dxf_strdup ("Blue (RYB)");
                         return (RGB_color_name);
                 }
                 case 0x00DDDD :
                 {
-                        RGB_color_name = strdup ("Blue-green");
+                        RGB_color_name = dxf_strdup ("Blue-green");
                         return (RGB_color_name);
                 }
                 case 0x8A2BE2 :
                 {
-                        RGB_color_name = strdup ("Blue-violet");
+                        RGB_color_name = dxf_strdup ("Blue-violet");
                         return (RGB_color_name);
                 }
                 case 0x0095B6 :
                 {
-                        RGB_color_name = strdup ("Bondi blue");
+                        RGB_color_name = dxf_strdup ("Bondi blue");
                         return (RGB_color_name);
                 }
                 case 0xB5A642 :
                 {
-                        RGB_color_name = strdup ("Brass");
+                        RGB_color_name = dxf_strdup ("Brass");
                         return (RGB_color_name);
                 }
                 case 0x66FF00 :
                 {
-                        RGB_color_name = strdup ("Bright green");
+                        RGB_color_name = dxf_strdup ("Bright green");
                         return (RGB_color_name);
                 }
 /*
                 case 0xFF007F :
                 {
-                        RGB_color_name = strdup ("Bright pink");
+                        RGB_color_name = dxf_strdup ("Bright pink");
                         return (RGB_color_name);
                 }
 */
                 case 0x08E8DE :
                 {
-                        RGB_color_name = strdup ("Bright turquoise");
+                        RGB_color_name = dxf_strdup ("Bright turquoise");
                         return (RGB_color_name);
                 }
                 case 0xFF55A3 :
                 {
-                        RGB_color_name = strdup ("Brilliant rose");
+                        RGB_color_name = dxf_strdup ("Brilliant rose");
                         return (RGB_color_name);
                 }
                 case 0xFB607F :
                 {
-                        RGB_color_name = strdup ("Brink pink");
+                        RGB_color_name = dxf_strdup ("Brink pink");
                         return (RGB_color_name);
                 }
                 case 0xCD7F32 :
                 {
-                        RGB_color_name = strdup ("Bronze");
+                        RGB_color_name = dxf_strdup ("Bronze");
                         return (RGB_color_name);
                 }
                 case 0x964B00 :
                 {
-                        RGB_color_name = strdup ("Brown");
+                        RGB_color_name = dxf_strdup ("Brown");
                         return (RGB_color_name);
                 }
                 case 0xF0DC82 :
                 {
-                        RGB_color_name = strdup ("Buff");
+                        RGB_color_name = dxf_strdup ("Buff");
                         return (RGB_color_name);
                 }
                 case 0x900020 :
                 {
-                        RGB_color_name = strdup ("Burgundy");
+                        RGB_color_name = dxf_strdup ("Burgundy");
                         return (RGB_color_name);
                 }
                 case 0xCC5500 :
                 {
-                        RGB_color_name = strdup ("Burnt orange");
+                        RGB_color_name = dxf_strdup ("Burnt orange");
                         return (RGB_color_name);
                 }
                 case 0xE97451 :
                 {
-                        RGB_color_name = strdup ("Burnt sienna");
+                        RGB_color_name = dxf_strdup ("Burnt sienna");
                         return (RGB_color_name);
                 }
                 case 0x8A3324 :
                 {
-                        RGB_color_name = strdup ("Burnt umber");
+                        RGB_color_name = dxf_strdup ("Burnt umber");
                         return (RGB_color_name);
                 }
                 case 0x78866B :
                 {
-                        RGB_color_name = strdup ("Camouflage green");
+                        RGB_color_name = dxf_strdup ("Camouflage green");
                         return (RGB_color_name);
                 }
                 case 0x592720 :
                 {
-                        RGB_color_name = strdup ("Caput mortuum");
+                        RGB_color_name = dxf_strdup ("Caput mortuum");
                         return (RGB_color_name);
                 }
                 case 0xC41E3A :
                 {
-                        RGB_color_name = strdup ("Cardinal");
+                        RGB_color_name = dxf_strdup ("Cardinal");
                         return (RGB_color_name);
                 }
                 case 0x960018 :
                 {
-                        RGB_color_name = strdup ("Carmine");
+                        RGB_color_name = dxf_strdup ("Carmine");
                         return (RGB_color_name);
                 }
                 case 0xEB4C42 :
                 {
-                        RGB_color_name = strdup ("Carmine Pink");
+                        RGB_color_name = dxf_strdup ("Carmine Pink");
                         return (RGB_color_name);
                 }
                 case 0xFFA6C9 :
                 {
-                        RGB_color_name = strdup ("Carnation pink");
+                        RGB_color_name = dxf_strdup ("Carnation pink");
                         return (RGB_color_name);
                 }
                 case 0x99BADD :
                 {
-                        RGB_color_name = strdup ("Carolina blue");
+                        RGB_color_name = dxf_strdup ("Carolina blue");
                         return (RGB_color_name);
                 }
                 case 0xED9121 :
                 {
-                        RGB_color_name = strdup ("Carrot orange");
+                        RGB_color_name = dxf_strdup ("Carrot orange");
                         return (RGB_color_name);
                 }
                 case 0xACE1AF :
                 {
-                        RGB_color_name = strdup ("Celadon");
+                        RGB_color_name = dxf_strdup ("Celadon");
                         return (RGB_color_name);
                 }
                 case 0xDE3163 :
                 {
-                        RGB_color_name = strdup ("Cerise");
+                        RGB_color_name = dxf_strdup ("Cerise");
                         return (RGB_color_name);
                 }
                 case 0xEC3B83 :
                 {
-                        RGB_color_name = strdup ("Cerise Pink");
+                        RGB_color_name = dxf_strdup ("Cerise Pink");
                         return (RGB_color_name);
                 }
                 case 0x007BA7 :
                 {
-                        RGB_color_name = strdup ("Cerulean");
+                        RGB_color_name = dxf_strdup ("Cerulean");
                         return (RGB_color_name);
                 }
                 case 0x2A52BE :
                 {
-                        RGB_color_name = strdup ("Cerulean blue");
+                        RGB_color_name = dxf_strdup ("Cerulean blue");
                         return (RGB_color_name);
                 }
                 case 0xF7E7CE :
                 {
-                        RGB_color_name = strdup ("Champagne");
+                        RGB_color_name = dxf_strdup ("Champagne");
                         return (RGB_color_name);
                 }
                 case 0x464646 :
                 {
-                        RGB_color_name = strdup ("Charcoal");
+                        RGB_color_name = dxf_strdup ("Charcoal");
                         return (RGB_color_name);
                 }
                 case 0xDFFF00 :
                 {
-                        RGB_color_name = strdup ("Chartreuse (traditional)");
+                        RGB_color_name = dxf_strdup ("Chartreuse (traditional)");
                         return (RGB_color_name);
                 }
                 case 0x7FFF00 :
                 {
-                        RGB_color_name = strdup ("Chartreuse (web)");
+                        RGB_color_name = dxf_strdup ("Chartreuse (web)");
                         return (RGB_color_name);
                 }
                 case 0xFFB7C5 :
                 {
-                        RGB_color_name = strdup ("Cherry blossom pink");
+                        RGB_color_name = dxf_strdup ("Cherry blossom pink");
                         return (RGB_color_name);
                 }
                 case 0xCD5C5C :
                 {
-                        RGB_color_name = strdup ("Chestnut");
+                        RGB_color_name = dxf_strdup ("Chestnut");
                         return (RGB_color_name);
                 }
                 case 0x7B3F00 :
                 {
-                        RGB_color_name = strdup ("Chocolate");
+                        RGB_color_name = dxf_strdup ("Chocolate");
                         return (RGB_color_name);
                 }
 /*
                 case 0xE34234 :
                 {
-                        RGB_color_name = strdup ("Cinnabar");
+                        RGB_color_name = dxf_strdup ("Cinnabar");
                         return (RGB_color_name);
                 }
 */
                 case 0xD2691E :
                 {
-                        RGB_color_name = strdup ("Cinnamon");
+                        RGB_color_name = dxf_strdup ("Cinnamon");
                         return (RGB_color_name);
                 }
                 case 0x0047AB :
                 {
-                        RGB_color_name = strdup ("Cobalt");
+                        RGB_color_name = dxf_strdup ("Cobalt");
                         return (RGB_color_name);
                 }
                 case 0x9BDDFF :
                 {
-                        RGB_color_name = strdup ("Columbia blue");
+                        RGB_color_name = dxf_strdup ("Columbia blue");
                         return (RGB_color_name);
                 }
                 case 0xB87333 :
                 {
-                        RGB_color_name = strdup ("Copper");
+                        RGB_color_name = dxf_strdup ("Copper");
                         return (RGB_color_name);
                 }
                 case 0x996666 :
                 {
-                        RGB_color_name = strdup ("Copper rose");
+                        RGB_color_name = dxf_strdup ("Copper rose");
                         return (RGB_color_name);
                 }
                 case 0xFF7F50 :
                 {
-                        RGB_color_name = strdup ("Coral");
+                        RGB_color_name = dxf_strdup ("Coral");
                         return (RGB_color_name);
                 }
                 case 0xF88379 :
                 {
-                        RGB_color_name = strdup ("Coral pink");
+                        RGB_color_name = dxf_strdup ("Coral pink");
                         return (RGB_color_name);
                 }
                 case 0xFF4040 :
                 {
-                        RGB_color_name = strdup ("Coral red");
+                        RGB_color_name = dxf_strdup ("Coral red");
                         return (RGB_color_name);
                 }
                 case 0xFBEC5D :
                 {
-                        RGB_color_name = strdup ("Corn");
+                        RGB_color_name = dxf_strdup ("Corn");
                         return (RGB_color_name);
                 }
                 case 0x6495ED :
                 {
-                        RGB_color_name = strdup ("Cornflower blue");
+                        RGB_color_name = dxf_strdup ("Cornflower blue");
                         return (RGB_color_name);
                 }
                 case 0xFFF8E7 :
                 {
-                        RGB_color_name = strdup ("Cosmic latte");
+                        RGB_color_name = dxf_strdup ("Cosmic latte");
                         return (RGB_color_name);
                 }
                 case 0xFFFDD0 :
                 {
-                        RGB_color_name = strdup ("Cream");
+                        RGB_color_name = dxf_strdup ("Cream");
                         return (RGB_color_name);
                 }
                 case 0xDC143C :
                 {
-                        RGB_color_name = strdup ("Crimson");
+                        RGB_color_name = dxf_strdup ("Crimson");
                         return (RGB_color_name);
                 }
                 case 0x00FFFF :
                 {
-                        RGB_color_name = strdup ("Cyan");
+                        RGB_color_name = dxf_strdup ("Cyan");
                         return (RGB_color_name);
                 }
                 case 0x00B7EB :
                 {
-                        RGB_color_name = strdup ("Cyan (process)");
+                        RGB_color_name = dxf_strdup ("Cyan (process)");
                         return (RGB_color_name);
                 }
                 case 0x00008B :
                 {
-                        RGB_color_name = strdup ("Dark blue");
+                        RGB_color_name = dxf_strdup ("Dark blue");
                         return (RGB_color_name);
                 }
                 case 0x654321 :
                 {
-                        RGB_color_name = strdup ("Dark brown");
+                        RGB_color_name = dxf_strdup ("Dark brown");
                         return (RGB_color_name);
                 }
                 case 0x08457E :
                 {
-                        RGB_color_name = strdup ("Dark cerulean");
+                        RGB_color_name = dxf_strdup ("Dark cerulean");
                         return (RGB_color_name);
                 }
                 case 0x986960 :
                 {
-                        RGB_color_name = strdup ("Dark chestnut");
+                        RGB_color_name = dxf_strdup ("Dark chestnut");
                         return (RGB_color_name);
                 }
                 case 0xCD5B45 :
                 {
-                        RGB_color_name = strdup ("Dark coral");
+                        RGB_color_name = dxf_strdup ("Dark coral");
                         return (RGB_color_name);
                 }
                 case 0xB8860B :
                 {
-                        RGB_color_name = strdup ("Dark goldenrod");
+                        RGB_color_name = dxf_strdup ("Dark goldenrod");
                         return (RGB_color_name);
                 }
                 case 0x013220 :
                 {
-                        RGB_color_name = strdup ("Dark green");
+                        RGB_color_name = dxf_strdup ("Dark green");
                         return (RGB_color_name);
                 }
                 case 0xBDB76B :
                 {
-                        RGB_color_name = strdup ("Dark khaki");
+                        RGB_color_name = dxf_strdup ("Dark khaki");
                         return (RGB_color_name);
                 }
                 case 0x8B008B :
                 {
-                        RGB_color_name = strdup ("Dark magenta");
+                        RGB_color_name = dxf_strdup ("Dark magenta");
                         return (RGB_color_name);
                 }
                 case 0x03C03C :
                 {
-                        RGB_color_name = strdup ("Dark pastel green");
+                        RGB_color_name = dxf_strdup ("Dark pastel green");
                         return (RGB_color_name);
                 }
                 case 0xE75480 :
                 {
-                        RGB_color_name = strdup ("Dark pink");
+                        RGB_color_name = dxf_strdup ("Dark pink");
                         return (RGB_color_name);
                 }
                 case 0x560319 :
                 {
-                        RGB_color_name = strdup ("Dark scarlet");
+                        RGB_color_name = dxf_strdup ("Dark scarlet");
                         return (RGB_color_name);
                 }
                 case 0xE9967A :
                 {
-                        RGB_color_name = strdup ("Dark salmon");
+                        RGB_color_name = dxf_strdup ("Dark salmon");
                         return (RGB_color_name);
                 }
                 case 0x2F4F4F :
                 {
-                        RGB_color_name = strdup ("Dark slate gray");
+                        RGB_color_name = dxf_strdup ("Dark slate gray");
                         return (RGB_color_name);
                 }
                 case 0x177245 :
                 {
-                        RGB_color_name = strdup ("Dark spring green");
+                        RGB_color_name = dxf_strdup ("Dark spring green");
                         return (RGB_color_name);
                 }
                 case 0x918151 :
                 {
-                        RGB_color_name = strdup ("Dark tan");
+                        RGB_color_name = dxf_strdup ("Dark tan");
                         return (RGB_color_name);
                 }
                 case 0x00CED1 :
                 {
-                        RGB_color_name = strdup ("Dark turquoise");
+                        RGB_color_name = dxf_strdup ("Dark turquoise");
                         return (RGB_color_name);
                 }
                 case 0x9400D3 :
                 {
-                        RGB_color_name = strdup ("Dark violet");
+                        RGB_color_name = dxf_strdup ("Dark violet");
                         return (RGB_color_name);
                 }
                 case 0xEF3038 :
                 {
-                        RGB_color_name = strdup ("Deep Carmine Pink");
+                        RGB_color_name = dxf_strdup ("Deep Carmine Pink");
                         return (RGB_color_name);
                 }
                 case 0xDA3287 :
                 {
-                        RGB_color_name = strdup ("Deep cerise");
+                        RGB_color_name = dxf_strdup ("Deep cerise");
                         return (RGB_color_name);
                 }
                 case 0xB94E48 :
                 {
-                        RGB_color_name = strdup ("Deep chestnut");
+                        RGB_color_name = dxf_strdup ("Deep chestnut");
                         return (RGB_color_name);
                 }
                 case 0xC154C1 :
                 {
-                        RGB_color_name = strdup ("Deep fuchsia");
+                        RGB_color_name = dxf_strdup ("Deep fuchsia");
                         return (RGB_color_name);
                 }
                 case 0x9955BB :
                 {
-                        RGB_color_name = strdup ("Deep lilac");
+                        RGB_color_name = dxf_strdup ("Deep lilac");
                         return (RGB_color_name);
                 }
                 case 0xCD00CC :
                 {
-                        RGB_color_name = strdup ("Deep magenta");
+                        RGB_color_name = dxf_strdup ("Deep magenta");
                         return (RGB_color_name);
                 }
                 case 0xFFCBA4 :
                 {
-                        RGB_color_name = strdup ("Deep peach");
+                        RGB_color_name = dxf_strdup ("Deep peach");
                         return (RGB_color_name);
                 }
                 case 0xFF1493 :
                 {
-                        RGB_color_name = strdup ("Deep pink");
+                        RGB_color_name = dxf_strdup ("Deep pink");
                         return (RGB_color_name);
                 }
                 case 0x1560BD :
                 {
-                        RGB_color_name = strdup ("Denim");
+                        RGB_color_name = dxf_strdup ("Denim");
                         return (RGB_color_name);
                 }
                 case 0x1E90FF :
                 {
-                        RGB_color_name = strdup ("Dodger blue");
+                        RGB_color_name = dxf_strdup ("Dodger blue");
                         return (RGB_color_name);
                 }
                 case 0xC2B280 :
                 {
-                        RGB_color_name = strdup ("Ecru");
+                        RGB_color_name = dxf_strdup ("Ecru");
                         return (RGB_color_name);
                 }
                 case 0x1034A6 :
                 {
-                        RGB_color_name = strdup ("Egyptian blue");
+                        RGB_color_name = dxf_strdup ("Egyptian blue");
                         return (RGB_color_name);
                 }
                 case 0x7DF9FF :
                 {
-                        RGB_color_name = strdup ("Electric blue");
+                        RGB_color_name = dxf_strdup ("Electric blue");
                         return (RGB_color_name);
                 }
 /*
                 case 0x00FF00 :
                 {
-                        RGB_color_name = strdup ("Electric green (X11 green)");
+                        RGB_color_name = dxf_strdup ("Electric green (X11 green)");
                         return (RGB_color_name);
                 }
 */
                 case 0x6600FF :
                 {
-                        RGB_color_name = strdup ("Electric indigo");
+                        RGB_color_name = dxf_strdup ("Electric indigo");
                         return (RGB_color_name);
                 }
                 case 0xCCFF00 :
                 {
-                        RGB_color_name = strdup ("Electric lime");
+                        RGB_color_name = dxf_strdup ("Electric lime");
                         return (RGB_color_name);
                 }
                 case 0xBF00FF :
                 {
-                        RGB_color_name = strdup ("Electric purple");
+                        RGB_color_name = dxf_strdup ("Electric purple");
                         return (RGB_color_name);
                 }
                 case 0x50C878 :
                 {
-                        RGB_color_name = strdup ("Emerald");
+                        RGB_color_name = dxf_strdup ("Emerald");
                         return (RGB_color_name);
                 }
                 case 0x614051 :
                 {
-                        RGB_color_name = strdup ("Eggplant");
+                        RGB_color_name = dxf_strdup ("Eggplant");
                         return (RGB_color_name);
                 }
                 case 0x801818 :
                 {
-                        RGB_color_name = strdup ("Falu red");
+                        RGB_color_name = dxf_strdup ("Falu red");
                         return (RGB_color_name);
                 }
                 case 0x4F7942 :
                 {
-                        RGB_color_name = strdup ("Fern green");
+                        RGB_color_name = dxf_strdup ("Fern green");
                         return (RGB_color_name);
                 }
                 case 0xB22222 :
                 {
-                        RGB_color_name = strdup ("Firebrick");
+                        RGB_color_name = dxf_strdup ("Firebrick");
                         return (RGB_color_name);
                 }
                 case 0xEEDC82 :
                 {
-                        RGB_color_name = strdup ("Flax");
+                        RGB_color_name = dxf_strdup ("Flax");
                         return (RGB_color_name);
                 }
                 case 0x228B22 :
                 {
-                        RGB_color_name = strdup ("Forrest green");
+                        RGB_color_name = dxf_strdup ("Forrest green");
                         return (RGB_color_name);
                 }
                 case 0xF64A8A :
                 {
-                        RGB_color_name = strdup ("French Rose");
+                        RGB_color_name = dxf_strdup ("French Rose");
                         return (RGB_color_name);
                 }
 /*
                 case 0xFF00FF :
                 {
-                        RGB_color_name = strdup ("Fuchsia");
+                        RGB_color_name = dxf_strdup ("Fuchsia");
                         return (RGB_color_name);
                 }
 */
                 case 0xFF77FF :
                 {
-                        RGB_color_name = strdup ("Fuchsia Pink");
+                        RGB_color_name = dxf_strdup ("Fuchsia Pink");
                         return (RGB_color_name);
                 }
                 case 0xE49B0F :
                 {
-                        RGB_color_name = strdup ("Gamboge");
+                        RGB_color_name = dxf_strdup ("Gamboge");
                         return (RGB_color_name);
                 }
                 case 0xD4AF37 :
                 {
-                        RGB_color_name = strdup ("Gold (metallic)");
+                        RGB_color_name = dxf_strdup ("Gold (metallic)");
                         return (RGB_color_name);
                 }
                 case 0xFFD700 :
                 {
-                        RGB_color_name = strdup ("Gold (web) (Golden)");
+                        RGB_color_name = dxf_strdup ("Gold (web) (Golden)");
                         return (RGB_color_name);
                 }
                 case 0x996515 :
                 {
-                        RGB_color_name = strdup ("Golden brown");
+                        RGB_color_name = dxf_strdup ("Golden brown");
                         return (RGB_color_name);
                 }
                 case 0xFFDF00 :
                 {
-                        RGB_color_name = strdup ("Golden yellow");
+                        RGB_color_name = dxf_strdup ("Golden yellow");
                         return (RGB_color_name);
                 }
                 case 0xDAA520 :
                 {
-                        RGB_color_name = strdup ("Goldenrod");
+                        RGB_color_name = dxf_strdup ("Goldenrod");
                         return (RGB_color_name);
                 }
                 case 0x465945 :
                 {
-                        RGB_color_name = strdup ("Gray-asparagus");
+                        RGB_color_name = dxf_strdup ("Gray-asparagus");
                         return (RGB_color_name);
                 }
                 case 0x00FF00 :
                 {
-                        RGB_color_name = strdup ("Green (color wheel) (X11 green)");
+                        RGB_color_name = dxf_strdup ("Green (color wheel) (X11 green)");
                         return (RGB_color_name);
                 }
 /*
                 case 0x008000 :
                 {
-                        RGB_color_name = strdup ("Green (HTML/CSS green)");
+                        RGB_color_name = dxf_strdup ("Green (HTML/CSS green)");
                         return (RGB_color_name);
                 }
 */
                 case 0x00A550 :
                 {
-                        RGB_color_name = strdup ("Green (pigment)");
+                        RGB_color_name = dxf_strdup ("Green (pigment)");
                         return (RGB_color_name);
                 }
                 case 0x66B032 :
                 {
-                        RGB_color_name = strdup ("Green (RYB)");
+                        RGB_color_name = dxf_strdup ("Green (RYB)");
                         return (RGB_color_name);
                 }
                 case 0xADFF2F :
                 {
-                        RGB_color_name = strdup ("Green-yellow");
+                        RGB_color_name = dxf_strdup ("Green-yellow");
                         return (RGB_color_name);
                 }
                 case 0x808080 :
                 {
-                        RGB_color_name = strdup ("Gray");
+                        RGB_color_name = dxf_strdup ("Gray");
                         return (RGB_color_name);
                 }
                 case 0x5218FA :
                 {
-                        RGB_color_name = strdup ("Han Purple");
+                        RGB_color_name = dxf_strdup ("Han Purple");
                         return (RGB_color_name);
                 }
                 case 0x3FFF00 :
                 {
-                        RGB_color_name = strdup ("Harlequin");
+                        RGB_color_name = dxf_strdup ("Harlequin");
                         return (RGB_color_name);
                 }
                 case 0xDF73FF :
                 {
-                        RGB_color_name = strdup ("Heliotrope");
+                        RGB_color_name = dxf_strdup ("Heliotrope");
                         return (RGB_color_name);
                 }
                 case 0xF400A1 :
                 {
-                        RGB_color_name = strdup ("Hollywood Cerise");
+                        RGB_color_name = dxf_strdup ("Hollywood Cerise");
                         return (RGB_color_name);
                 }
                 case 0xFF00CC :
                 {
-                        RGB_color_name = strdup ("Hot Magenta");
+                        RGB_color_name = dxf_strdup ("Hot Magenta");
                         return (RGB_color_name);
                 }
                 case 0xFF69B4 :
                 {
-                        RGB_color_name = strdup ("Hot Pink");
+                        RGB_color_name = dxf_strdup ("Hot Pink");
                         return (RGB_color_name);
                 }
                 case 0x00416A :
                 {
-                        RGB_color_name = strdup ("Indigo (dye)");
+                        RGB_color_name = dxf_strdup ("Indigo (dye)");
                         return (RGB_color_name);
                 }
                 case 0x4B0082 :
                 {
-                        RGB_color_name = strdup ("Indigo (web)");
+                        RGB_color_name = dxf_strdup ("Indigo (web)");
                         return (RGB_color_name);
                 }
                 case 0x002FA7 :
                 {
-                        RGB_color_name = strdup ("International Klein Blue");
+                        RGB_color_name = dxf_strdup ("International Klein Blue");
                         return (RGB_color_name);
                 }
                 case 0xFF4F00 :
                 {
-                        RGB_color_name = strdup ("International orange");
+                        RGB_color_name = dxf_strdup ("International orange");
                         return (RGB_color_name);
                 }
                 case 0x009000 :
                 {
-                        RGB_color_name = strdup ("Islamic green");
+                        RGB_color_name = dxf_strdup ("Islamic green");
                         return (RGB_color_name);
                 }
                 case 0xFFFFF0 :
                 {
-                        RGB_color_name = strdup ("Ivory");
+                        RGB_color_name = dxf_strdup ("Ivory");
                         return (RGB_color_name);
                 }
                 case 0x00A86B :
                 {
-                        RGB_color_name = strdup ("Jade");
+                        RGB_color_name = dxf_strdup ("Jade");
                         return (RGB_color_name);
                 }
                 case 0x4CBB17 :
                 {
-                        RGB_color_name = strdup ("Kelly green");
+                        RGB_color_name = dxf_strdup ("Kelly green");
                         return (RGB_color_name);
                 }
                 case 0xC3B091 :
                 {
-                        RGB_color_name = strdup ("Khaki");
+                        RGB_color_name = dxf_strdup ("Khaki");
                         return (RGB_color_name);
                 }
                 case 0xF0E68C :
                 {
-                        RGB_color_name = strdup ("Khaki (X11) (Light khaki)");
+                        RGB_color_name = dxf_strdup ("Khaki (X11) (Light khaki)");
                         return (RGB_color_name);
                 }
                 case 0xB57EDC :
                 {
-                        RGB_color_name = strdup ("Lavender (floral)");
+                        RGB_color_name = dxf_strdup ("Lavender (floral)");
                         return (RGB_color_name);
                 }
                 case 0xE6E6FA :
                 {
-                        RGB_color_name = strdup ("Lavender (web)");
+                        RGB_color_name = dxf_strdup ("Lavender (web)");
                         return (RGB_color_name);
                 }
                 case 0xCCCCFF :
                 {
-                        RGB_color_name = strdup ("Lavender blue");
+                        RGB_color_name = dxf_strdup ("Lavender blue");
                         return (RGB_color_name);
                 }
                 case 0xFFF0F5 :
                 {
-                        RGB_color_name = strdup ("Lavender blush");
+                        RGB_color_name = dxf_strdup ("Lavender blush");
                         return (RGB_color_name);
                 }
                 case 0xC4C3D0 :
                 {
-                        RGB_color_name = strdup ("Lavender gray");
+                        RGB_color_name = dxf_strdup ("Lavender gray");
                         return (RGB_color_name);
                 }
                 case 0xEE82EE :
                 {
-                        RGB_color_name = strdup ("Lavender magenta");
+                        RGB_color_name = dxf_strdup ("Lavender magenta");
                         return (RGB_color_name);
                 }
                 case 0xFBAED2 :
                 {
-                        RGB_color_name = strdup ("Lavender pink");
+                        RGB_color_name = dxf_strdup ("Lavender pink");
                         return (RGB_color_name);
                 }
                 case 0x967BB6 :
                 {
-                        RGB_color_name = strdup ("Lavender purple");
+                        RGB_color_name = dxf_strdup ("Lavender purple");
                         return (RGB_color_name);
                 }
                 case 0xFBA0E3 :
                 {
-                        RGB_color_name = strdup ("Lavender rose");
+                        RGB_color_name = dxf_strdup ("Lavender rose");
                         return (RGB_color_name);
                 }
                 case 0x7CFC00 :
                 {
-                        RGB_color_name = strdup ("Lawn green");
+                        RGB_color_name = dxf_strdup ("Lawn green");
                         return (RGB_color_name);
                 }
                 case 0xFDE910 :
                 {
-                        RGB_color_name = strdup ("Lemon");
+                        RGB_color_name = dxf_strdup ("Lemon");
                         return (RGB_color_name);
                 }
                 case 0xFFFACD :
                 {
-                        RGB_color_name = strdup ("Lemon chifton");
+                        RGB_color_name = dxf_strdup ("Lemon chifton");
                         return (RGB_color_name);
                 }
                 case 0xADD8E6 :
                 {
-                        RGB_color_name = strdup ("Light blue");
+                        RGB_color_name = dxf_strdup ("Light blue");
                         return (RGB_color_name);
                 }
                 case 0xFFB6C1 :
                 {
-                        RGB_color_name = strdup ("Light pink");
+                        RGB_color_name = dxf_strdup ("Light pink");
                         return (RGB_color_name);
                 }
                 case 0xC8A2C8 :
                 {
-                        RGB_color_name = strdup ("Lilac");
+                        RGB_color_name = dxf_strdup ("Lilac");
                         return (RGB_color_name);
                 }
                 case 0xBFFF00 :
                 {
-                        RGB_color_name = strdup ("Lime (color wheel)");
+                        RGB_color_name = dxf_strdup ("Lime (color wheel)");
                         return (RGB_color_name);
                 }
 /*
                 case 0x00FF00 :
                 {
-                        RGB_color_name = strdup ("Lime (web) (X11 green)");
+                        RGB_color_name = dxf_strdup ("Lime (web) (X11 green)");
                         return (RGB_color_name);
                 }
 */
                 case 0x32CD32 :
                 {
-                        RGB_color_name = strdup ("Lime green");
+                        RGB_color_name = dxf_strdup ("Lime green");
                         return (RGB_color_name);
                 }
                 case 0xFAF0E6 :
                 {
-                        RGB_color_name = strdup ("Linen");
+                        RGB_color_name = dxf_strdup ("Linen");
                         return (RGB_color_name);
                 }
                 case 0xFF00FF :
                 {
-                        RGB_color_name = strdup ("Magenta");
+                        RGB_color_name = dxf_strdup ("Magenta");
                         return (RGB_color_name);
                 }
                 case 0xCA1F7B :
                 {
-                        RGB_color_name = strdup ("Magenta (dye)");
+                        RGB_color_name = dxf_strdup ("Magenta (dye)");
                         return (RGB_color_name);
                 }
                 case 0xFF0090 :
                 {
-                        RGB_color_name = strdup ("Magenta (process)");
+                        RGB_color_name = dxf_strdup ("Magenta (process)");
                         return (RGB_color_name);
                 }
                 case 0xAAF0D1 :
                 {
-                        RGB_color_name = strdup ("Magic mint");
+                        RGB_color_name = dxf_strdup ("Magic mint");
                         return (RGB_color_name);
                 }
                 case 0xF8F4FF :
                 {
-                        RGB_color_name = strdup ("Magnolia");
+                        RGB_color_name = dxf_strdup ("Magnolia");
                         return (RGB_color_name);
                 }
                 case 0x0BDA51 :
                 {
-                        RGB_color_name = strdup ("Malachite");
+                        RGB_color_name = dxf_strdup ("Malachite");
                         return (RGB_color_name);
                 }
                 case 0x800000 :
                 {
-                        RGB_color_name = strdup ("Maroon (HTML/CSS)");
+                        RGB_color_name = dxf_strdup ("Maroon (HTML/CSS)");
                         return (RGB_color_name);
                 }
                 case 0xB03060 :
                 {
-                        RGB_color_name = strdup ("Maroon (X11)");
+                        RGB_color_name = dxf_strdup ("Maroon (X11)");
                         return (RGB_color_name);
                 }
                 case 0x73C2FB :
                 {
-                        RGB_color_name = strdup ("Maya blue");
+                        RGB_color_name = dxf_strdup ("Maya blue");
                         return (RGB_color_name);
                 }
                 case 0xE0B0FF :
                 {
-                        RGB_color_name = strdup ("Mauve");
+                        RGB_color_name = dxf_strdup ("Mauve");
                         return (RGB_color_name);
                 }
                 case 0x915F6D :
                 {
-                        RGB_color_name = strdup ("Mauve Taupe");
+                        RGB_color_name = dxf_strdup ("Mauve Taupe");
                         return (RGB_color_name);
                 }
                 case 0x0000CD :
                 {
-                        RGB_color_name = strdup ("Medium blue");
+                        RGB_color_name = dxf_strdup ("Medium blue");
                         return (RGB_color_name);
                 }
 /*
                 case 0xAF4035 :
                 {
-                        RGB_color_name = strdup ("Medium carmine");
+                        RGB_color_name = dxf_strdup ("Medium carmine");
                         return (RGB_color_name);
                 }
 */
                 case 0xCC99CC :
                 {
-                        RGB_color_name = strdup ("Medium lavender magenta");
+                        RGB_color_name = dxf_strdup ("Medium lavender magenta");
                         return (RGB_color_name);
                 }
                 case 0x9370DB :
                 {
-                        RGB_color_name = strdup ("Medium purple");
+                        RGB_color_name = dxf_strdup ("Medium purple");
                         return (RGB_color_name);
                 }
                 case 0x00FA9A :
                 {
-                        RGB_color_name = strdup ("Medium spring green");
+                        RGB_color_name = dxf_strdup ("Medium spring green");
                         return (RGB_color_name);
                 }
                 case 0x191970 :
                 {
-                        RGB_color_name = strdup ("Midnight Blue");
+                        RGB_color_name = dxf_strdup ("Midnight Blue");
                         return (RGB_color_name);
                 }
                 case 0x004953 :
                 {
-                        RGB_color_name = strdup ("Midnight Green (Eagle Green)");
+                        RGB_color_name = dxf_strdup ("Midnight Green (Eagle Green)");
                         return (RGB_color_name);
                 }
                 case 0x98FF98 :
                 {
-                        RGB_color_name = strdup ("Mint green");
+                        RGB_color_name = dxf_strdup ("Mint green");
                         return (RGB_color_name);
                 }
                 case 0xFFE4E1 :
                 {
-                        RGB_color_name = strdup ("Misty rose");
+                        RGB_color_name = dxf_strdup ("Misty rose");
                         return (RGB_color_name);
                 }
                 case 0xADDFAD :
                 {
-                        RGB_color_name = strdup ("Moss green");
+                        RGB_color_name = dxf_strdup ("Moss green");
                         return (RGB_color_name);
                 }
                 case 0x997A8D :
                 {
-                        RGB_color_name = strdup ("Mountbatten pink");
+                        RGB_color_name = dxf_strdup ("Mountbatten pink");
                         return (RGB_color_name);
                 }
                 case 0xFFDB58 :
                 {
-                        RGB_color_name = strdup ("Mustard");
+                        RGB_color_name = dxf_strdup ("Mustard");
                         return (RGB_color_name);
                 }
                 case 0x21421E :
                 {
-                        RGB_color_name = strdup ("Myrtle");
+                        RGB_color_name = dxf_strdup ("Myrtle");
                         return (RGB_color_name);
                 }
                 case 0x006633 :
                 {
-                        RGB_color_name = strdup ("MSU Green");
+                        RGB_color_name = dxf_strdup ("MSU Green");
                         return (RGB_color_name);
                 }
                 case 0xFFDEAD :
                 {
-                        RGB_color_name = strdup ("Navajo white");
+                        RGB_color_name = dxf_strdup ("Navajo white");
                         return (RGB_color_name);
                 }
                 case 0x000080 :
                 {
-                        RGB_color_name = strdup ("Navy Blue");
+                        RGB_color_name = dxf_strdup ("Navy Blue");
                         return (RGB_color_name);
                 }
                 case 0xCC7722 :
                 {
-                        RGB_color_name = strdup ("Ochre");
+                        RGB_color_name = dxf_strdup ("Ochre");
                         return (RGB_color_name);
                 }
                 case 0x008000 :
                 {
-                        RGB_color_name = strdup ("Office green");
+                        RGB_color_name = dxf_strdup ("Office green");
                         return (RGB_color_name);
                 }
                 case 0xCFB53B :
                 {
-                        RGB_color_name = strdup ("Old Gold");
+                        RGB_color_name = dxf_strdup ("Old Gold");
                         return (RGB_color_name);
                 }
                 case 0xFDF5E6 :
                 {
-                        RGB_color_name = strdup ("Old Lace");
+                        RGB_color_name = dxf_strdup ("Old Lace");
                         return (RGB_color_name);
                 }
                 case 0x796878 :
                 {
-                        RGB_color_name = strdup ("Old Lavender");
+                        RGB_color_name = dxf_strdup ("Old Lavender");
                         return (RGB_color_name);
                 }
                 case 0xC08081 :
                 {
-                        RGB_color_name = strdup ("Old Rose");
+                        RGB_color_name = dxf_strdup ("Old Rose");
                         return (RGB_color_name);
                 }
                 case 0x808000 :
                 {
-                        RGB_color_name = strdup ("Olive");
+                        RGB_color_name = dxf_strdup ("Olive");
                         return (RGB_color_name);
                 }
                 case 0x6B8E23 :
                 {
-                        RGB_color_name = strdup ("Olive Drab");
+                        RGB_color_name = dxf_strdup ("Olive Drab");
                         return (RGB_color_name);
                 }
                 case 0x9AB973 :
                 {
-                        RGB_color_name = strdup ("Olivine");
+                        RGB_color_name = dxf_strdup ("Olivine");
                         return (RGB_color_name);
                 }
                 case 0xFF7F00 :
                 {
-                        RGB_color_name = strdup ("Orange (color wheel)");
+                        RGB_color_name = dxf_strdup ("Orange (color wheel)");
                         return (RGB_color_name);
                 }
                 case 0xFB9902 :
                 {
-                        RGB_color_name = strdup ("Orange (RYB)");
+                        RGB_color_name = dxf_strdup ("Orange (RYB)");
                         return (RGB_color_name);
                 }
                 case 0xFFA500 :
                 {
-                        RGB_color_name = strdup ("Orange (web)");
+                        RGB_color_name = dxf_strdup ("Orange (web)");
                         return (RGB_color_name);
                 }
                 case 0xFFA000 :
                 {
-                        RGB_color_name = strdup ("Orange Peel");
+                        RGB_color_name = dxf_strdup ("Orange Peel");
                         return (RGB_color_name);
                 }
                 case 0xFF4500 :
                 {
-                        RGB_color_name = strdup ("Orange-Red");
+                        RGB_color_name = dxf_strdup ("Orange-Red");
                         return (RGB_color_name);
                 }
                 case 0xDA70D6 :
                 {
-                        RGB_color_name = strdup ("Orchid");
+                        RGB_color_name = dxf_strdup ("Orchid");
                         return (RGB_color_name);
                 }
                 case 0xAFEEEE :
                 {
-                        RGB_color_name = strdup ("Pale blue");
+                        RGB_color_name = dxf_strdup ("Pale blue");
                         return (RGB_color_name);
                 }
                 case 0x987654 :
                 {
-                        RGB_color_name = strdup ("Pale brown");
+                        RGB_color_name = dxf_strdup ("Pale brown");
                         return (RGB_color_name);
                 }
                 case 0xAF4035 :
                 {
-                        RGB_color_name = strdup ("Pale carmine");
+                        RGB_color_name = dxf_strdup ("Pale carmine");
                         return (RGB_color_name);
                 }
                 case 0xDDADAF :
                 {
-                        RGB_color_name = strdup ("Pale chestnut");
+                        RGB_color_name = dxf_strdup ("Pale chestnut");
                         return (RGB_color_name);
                 }
                 case 0xABCDEF :
                 {
-                        RGB_color_name = strdup ("Pale cornflower blue");
+                        RGB_color_name = dxf_strdup ("Pale cornflower blue");
                         return (RGB_color_name);
                 }
                 case 0xF984E5 :
                 {
-                        RGB_color_name = strdup ("Pale magenta");
+                        RGB_color_name = dxf_strdup ("Pale magenta");
                         return (RGB_color_name);
                 }
                 case 0xFADADD :
                 {
-                        RGB_color_name = strdup ("Pale pink");
+                        RGB_color_name = dxf_strdup ("Pale pink");
                         return (RGB_color_name);
                 }
                 case 0xDB7093 :
                 {
-                        RGB_color_name = strdup ("Pale red-violet");
+                        RGB_color_name = dxf_strdup ("Pale red-violet");
                         return (RGB_color_name);
                 }
                 case 0xBC987E :
                 {
-                        RGB_color_name = strdup ("Pale taupe");
+                        RGB_color_name = dxf_strdup ("Pale taupe");
                         return (RGB_color_name);
                 }
                 case 0xFFEFD5 :
                 {
-                        RGB_color_name = strdup ("Papaya whip");
+                        RGB_color_name = dxf_strdup ("Papaya whip");
                         return (RGB_color_name);
                 }
                 case 0x77DD77 :
                 {
-                        RGB_color_name = strdup ("Pastel green");
+                        RGB_color_name = dxf_strdup ("Pastel green");
                         return (RGB_color_name);
                 }
                 case 0xFFD1DC :
                 {
-                        RGB_color_name = strdup ("Pastel pink");
+                        RGB_color_name = dxf_strdup ("Pastel pink");
                         return (RGB_color_name);
                 }
                 case 0x40404F :
                 {
-                        RGB_color_name = strdup ("Payne's grey");
+                        RGB_color_name = dxf_strdup ("Payne's grey");
                         return (RGB_color_name);
                 }
                 case 0xFFE5B4 :
                 {
-                        RGB_color_name = strdup ("Peach");
+                        RGB_color_name = dxf_strdup ("Peach");
                         return (RGB_color_name);
                 }
                 case 0xFFCC99 :
                 {
-                        RGB_color_name = strdup ("Peach-orange");
+                        RGB_color_name = dxf_strdup ("Peach-orange");
                         return (RGB_color_name);
                 }
                 case 0xFADFAD :
                 {
-                        RGB_color_name = strdup ("Peach-yellow");
+                        RGB_color_name = dxf_strdup ("Peach-yellow");
                         return (RGB_color_name);
                 }
                 case 0xD1E231 :
                 {
-                        RGB_color_name = strdup ("Pear");
+                        RGB_color_name = dxf_strdup ("Pear");
                         return (RGB_color_name);
                 }
 /*
                 case 0xCCCCFF :
                 {
-                        RGB_color_name = strdup ("Periwinkle");
+                        RGB_color_name = dxf_strdup ("Periwinkle");
                         return (RGB_color_name);
                 }
 */
                 case 0x1C39BB :
                 {
-                        RGB_color_name = strdup ("Persian blue");
+                        RGB_color_name = dxf_strdup ("Persian blue");
                         return (RGB_color_name);
                 }
                 case 0x00A693 :
                 {
-                        RGB_color_name = strdup ("Persian green");
+                        RGB_color_name = dxf_strdup ("Persian green");
                         return (RGB_color_name);
                 }
                 case 0x32127A :
                 {
-                        RGB_color_name = strdup ("Persian indigo");
+                        RGB_color_name = dxf_strdup ("Persian indigo");
                         return (RGB_color_name);
                 }
                 case 0xD99058 :
                 {
-                        RGB_color_name = strdup ("Persian orange");
+                        RGB_color_name = dxf_strdup ("Persian orange");
                         return (RGB_color_name);
                 }
                 case 0xCC3333 :
                 {
-                        RGB_color_name = strdup ("Persian red");
+                        RGB_color_name = dxf_strdup ("Persian red");
                         return (RGB_color_name);
                 }
                 case 0xF77FBE :
                 {
-                        RGB_color_name = strdup ("Persian pink");
+                        RGB_color_name = dxf_strdup ("Persian pink");
                         return (RGB_color_name);
                 }
                 case 0xFE28A2 :
                 {
-                        RGB_color_name = strdup ("Persian rose");
+                        RGB_color_name = dxf_strdup ("Persian rose");
                         return (RGB_color_name);
                 }
                 case 0xEC5800 :
                 {
-                        RGB_color_name = strdup ("Persimmon");
+                        RGB_color_name = dxf_strdup ("Persimmon");
                         return (RGB_color_name);
                 }
                 case 0x01796F :
                 {
-                        RGB_color_name = strdup ("Pine green");
+                        RGB_color_name = dxf_strdup ("Pine green");
                         return (RGB_color_name);
                 }
                 case 0xFFC0CB :
                 {
-                        RGB_color_name = strdup ("Pink");
+                        RGB_color_name = dxf_strdup ("Pink");
                         return (RGB_color_name);
                 }
                 case 0xFF9966 :
                 {
-                        RGB_color_name = strdup ("Pink-orange");
+                        RGB_color_name = dxf_strdup ("Pink-orange");
                         return (RGB_color_name);
                 }
                 case 0xE5E4E2 :
                 {
-                        RGB_color_name = strdup ("Platinum");
+                        RGB_color_name = dxf_strdup ("Platinum");
                         return (RGB_color_name);
                 }
 /*
                 case 0xCC99CC :
                 {
-                        RGB_color_name = strdup ("Plum (web)");
+                        RGB_color_name = dxf_strdup ("Plum (web)");
                         return (RGB_color_name);
                 }
 */
                 case 0xFF5A36 :
                 {
-                        RGB_color_name = strdup ("Portland Orange");
+                        RGB_color_name = dxf_strdup ("Portland Orange");
                         return (RGB_color_name);
                 }
 /*
                 case 0xB0E0E6 :
                 {
-                        RGB_color_name = strdup ("Powder blue (web)");
+                        RGB_color_name = dxf_strdup ("Powder blue (web)");
                         return (RGB_color_name);
                 }
 */
                 case 0xCC8899 :
                 {
-                        RGB_color_name = strdup ("Puce");
+                        RGB_color_name = dxf_strdup ("Puce");
                         return (RGB_color_name);
                 }
                 case 0x003153 :
                 {
-                        RGB_color_name = strdup ("Prusian blue");
+                        RGB_color_name = dxf_strdup ("Prusian blue");
                         return (RGB_color_name);
                 }
                 case 0xDD00FF :
                 {
-                        RGB_color_name = strdup ("Psychedelic purple");
+                        RGB_color_name = dxf_strdup ("Psychedelic purple");
                         return (RGB_color_name);
                 }
                 case 0xFF7518 :
                 {
-                        RGB_color_name = strdup ("Pumpkin");
+                        RGB_color_name = dxf_strdup ("Pumpkin");
                         return (RGB_color_name);
                 }
                 case 0x7F007F :
                 {
-                        RGB_color_name = strdup ("Purple (HTML/CSS)");
+                        RGB_color_name = dxf_strdup ("Purple (HTML/CSS)");
                         return (RGB_color_name);
                 }
                 case 0xA020F0 :
                 {
-                        RGB_color_name = strdup ("Purple (X11)");
+                        RGB_color_name = dxf_strdup ("Purple (X11)");
                         return (RGB_color_name);
                 }
                 case 0x50404D :
                 {
-                        RGB_color_name = strdup ("Purple Taupe");
+                        RGB_color_name = dxf_strdup ("Purple Taupe");
                         return (RGB_color_name);
                 }
                 case 0xE30B5C :
                 {
-                        RGB_color_name = strdup ("Raspberry");
+                        RGB_color_name = dxf_strdup ("Raspberry");
                         return (RGB_color_name);
                 }
                 case 0x734A12 :
                 {
-                        RGB_color_name = strdup ("Raw umber");
+                        RGB_color_name = dxf_strdup ("Raw umber");
                         return (RGB_color_name);
                 }
                 case 0xE3256B :
                 {
-                        RGB_color_name = strdup ("Razzmatazz");
+                        RGB_color_name = dxf_strdup ("Razzmatazz");
                         return (RGB_color_name);
                 }
                 case 0xFF0000 :
                 {
-                        RGB_color_name = strdup ("Red");
+                        RGB_color_name = dxf_strdup ("Red");
                         return (RGB_color_name);
                 }
                 case 0xED1C24 :
                 {
-                        RGB_color_name = strdup ("Red (pigment)");
+                        RGB_color_name = dxf_strdup ("Red (pigment)");
                         return (RGB_color_name);
                 }
                 case 0xFE2712 :
                 {
-                        RGB_color_name = strdup ("Red (RYB)");
+                        RGB_color_name = dxf_strdup ("Red (RYB)");
                         return (RGB_color_name);
                 }
                 case 0xC71585 :
                 {
-                        RGB_color_name = strdup ("Red-violet");
+                        RGB_color_name = dxf_strdup ("Red-violet");
                         return (RGB_color_name);
                 }
                 case 0xD70040 :
                 {
-                        RGB_color_name = strdup ("Rich carmine");
+                        RGB_color_name = dxf_strdup ("Rich carmine");
                         return (RGB_color_name);
                 }
                 case 0x00CCCC :
                 {
-                        RGB_color_name = strdup ("Robin egg blue");
+                        RGB_color_name = dxf_strdup ("Robin egg blue");
                         return (RGB_color_name);
                 }
                 case 0xFF007F :
                 {
-                        RGB_color_name = strdup ("Rose");
+                        RGB_color_name = dxf_strdup ("Rose");
                         return (RGB_color_name);
                 }
                 case 0xE32636 :
                 {
-                        RGB_color_name = strdup ("Rose Madder");
+                        RGB_color_name = dxf_strdup ("Rose Madder");
                         return (RGB_color_name);
                 }
                 case 0xFF66CC :
                 {
-                        RGB_color_name = strdup ("Rose pink");
+                        RGB_color_name = dxf_strdup ("Rose pink");
                         return (RGB_color_name);
                 }
                 case 0xAA98A9 :
                 {
-                        RGB_color_name = strdup ("Rose quartz");
+                        RGB_color_name = dxf_strdup ("Rose quartz");
                         return (RGB_color_name);
                 }
                 case 0x905D5D :
                 {
-                        RGB_color_name = strdup ("Rose Taupe");
+                        RGB_color_name = dxf_strdup ("Rose Taupe");
                         return (RGB_color_name);
                 }
                 case 0x4169E1 :
                 {
-                        RGB_color_name = strdup ("Royal blue");
+                        RGB_color_name = dxf_strdup ("Royal blue");
                         return (RGB_color_name);
                 }
                 case 0x6B3FA0 :
                 {
-                        RGB_color_name = strdup ("Royal purple");
+                        RGB_color_name = dxf_strdup ("Royal purple");
                         return (RGB_color_name);
                 }
                 case 0xE0115F :
                 {
-                        RGB_color_name = strdup ("Ruby");
+                        RGB_color_name = dxf_strdup ("Ruby");
                         return (RGB_color_name);
                 }
                 case 0x80461B :
                 {
-                        RGB_color_name = strdup ("Russet");
+                        RGB_color_name = dxf_strdup ("Russet");
                         return (RGB_color_name);
                 }
                 case 0xB7410E :
                 {
-                        RGB_color_name = strdup ("Rust");
+                        RGB_color_name = dxf_strdup ("Rust");
                         return (RGB_color_name);
                 }
                 case 0xFF6600 :
                 {
-                        RGB_color_name = strdup ("Safety orange (blaze orange)");
+                        RGB_color_name = dxf_strdup ("Safety orange (blaze orange)");
                         return (RGB_color_name);
                 }
                 case 0xF4C430 :
                 {
-                        RGB_color_name = strdup ("Saffron");
+                        RGB_color_name = dxf_strdup ("Saffron");
                         return (RGB_color_name);
                 }
                 case 0xFF8C69 :
                 {
-                        RGB_color_name = strdup ("Salmon");
+                        RGB_color_name = dxf_strdup ("Salmon");
                         return (RGB_color_name);
                 }
                 case 0xFF91A4 :
                 {
-                        RGB_color_name = strdup ("Salmon pink");
+                        RGB_color_name = dxf_strdup ("Salmon pink");
                         return (RGB_color_name);
                 }
                 case 0xF4A460 :
                 {
-                        RGB_color_name = strdup ("Sandy brown");
+                        RGB_color_name = dxf_strdup ("Sandy brown");
                         return (RGB_color_name);
                 }
                 case 0x92000A :
                 {
-                        RGB_color_name = strdup ("Sangria");
+                        RGB_color_name = dxf_strdup ("Sangria");
                         return (RGB_color_name);
                 }
                 case 0x082567 :
                 {
-                        RGB_color_name = strdup ("Sapphire");
+                        RGB_color_name = dxf_strdup ("Sapphire");
                         return (RGB_color_name);
                 }
                 case 0xFF2400 :
                 {
-                        RGB_color_name = strdup ("Scarlet");
+                        RGB_color_name = dxf_strdup ("Scarlet");
                         return (RGB_color_name);
                 }
                 case 0xFFD800 :
                 {
-                        RGB_color_name = strdup ("School bus yellow");
+                        RGB_color_name = dxf_strdup ("School bus yellow");
                         return (RGB_color_name);
                 }
                 case 0x2E8B57 :
                 {
-                        RGB_color_name = strdup ("Sea green");
+                        RGB_color_name = dxf_strdup ("Sea green");
                         return (RGB_color_name);
                 }
                 case 0x321414 :
                 {
-                        RGB_color_name = strdup ("Seal brown");
+                        RGB_color_name = dxf_strdup ("Seal brown");
                         return (RGB_color_name);
                 }
                 case 0xFFF5EE :
                 {
-                        RGB_color_name = strdup ("Seashell");
+                        RGB_color_name = dxf_strdup ("Seashell");
                         return (RGB_color_name);
                 }
                 case 0xFFBA00 :
                 {
-                        RGB_color_name = strdup ("Selective yellow");
+                        RGB_color_name = dxf_strdup ("Selective yellow");
                         return (RGB_color_name);
                 }
                 case 0x704214 :
                 {
-                        RGB_color_name = strdup ("Sepia");
+                        RGB_color_name = dxf_strdup ("Sepia");
                         return (RGB_color_name);
                 }
                 case 0x009E60 :
                 {
-                        RGB_color_name = strdup ("Shamrock green");
+                        RGB_color_name = dxf_strdup ("Shamrock green");
                         return (RGB_color_name);
                 }
                 case 0xFC0FC0 :
                 {
-                        RGB_color_name = strdup ("Shocking pink");
+                        RGB_color_name = dxf_strdup ("Shocking pink");
                         return (RGB_color_name);
                 }
                 case 0xA0522D :
                 {
-                        RGB_color_name = strdup ("Sienna");
+                        RGB_color_name = dxf_strdup ("Sienna");
                         return (RGB_color_name);
                 }
                 case 0xC0C0C0 :
                 {
-                        RGB_color_name = strdup ("Silver");
+                        RGB_color_name = dxf_strdup ("Silver");
                         return (RGB_color_name);
                 }
                 case 0x87CEEB :
                 {
-                        RGB_color_name = strdup ("Sky Blue");
+                        RGB_color_name = dxf_strdup ("Sky Blue");
                         return (RGB_color_name);
                 }
                 case 0x708090 :
                 {
-                        RGB_color_name = strdup ("Slate grey");
+                        RGB_color_name = dxf_strdup ("Slate grey");
                         return (RGB_color_name);
                 }
                 case 0x003399 :
                 {
-                        RGB_color_name = strdup ("Smalt (Dark powder blue)");
+                        RGB_color_name = dxf_strdup ("Smalt (Dark powder blue)");
                         return (RGB_color_name);
                 }
                 case 0xA7FC00 :
                 {
-                        RGB_color_name = strdup ("Spring bud");
+                        RGB_color_name = dxf_strdup ("Spring bud");
                         return (RGB_color_name);
                 }
                 case 0x00FF7F :
                 {
-                        RGB_color_name = strdup ("Spring green");
+                        RGB_color_name = dxf_strdup ("Spring green");
                         return (RGB_color_name);
                 }
                 case 0x4682B4 :
                 {
-                        RGB_color_name = strdup ("Steel blue");
+                        RGB_color_name = dxf_strdup ("Steel blue");
                         return (RGB_color_name);
                 }
                 case 0xD2B48C :
                 {
-                        RGB_color_name = strdup ("Tan");
+                        RGB_color_name = dxf_strdup ("Tan");
                         return (RGB_color_name);
                 }
                 case 0xF28500 :
                 {
-                        RGB_color_name = strdup ("Tangerine");
+                        RGB_color_name = dxf_strdup ("Tangerine");
                         return (RGB_color_name);
                 }
                 case 0xFFCC00 :
                 {
-                        RGB_color_name = strdup ("Tangerine yellow");
+                        RGB_color_name = dxf_strdup ("Tangerine yellow");
                         return (RGB_color_name);
                 }
                 case 0x483C32 :
                 {
-                        RGB_color_name = strdup ("Taupe");
+                        RGB_color_name = dxf_strdup ("Taupe");
                         return (RGB_color_name);
                 }
                 case 0x8B8589 :
                 {
-                        RGB_color_name = strdup ("Taupe gray");
+                        RGB_color_name = dxf_strdup ("Taupe gray");
                         return (RGB_color_name);
                 }
                 case 0xD0F0C0 :
                 {
-                        RGB_color_name = strdup ("Tea green");
+                        RGB_color_name = dxf_strdup ("Tea green");
                         return (RGB_color_name);
                 }
 /*
                 case 0xF88379 :
                 {
-                        RGB_color_name = strdup ("Tea rose (orange)");
+                        RGB_color_name = dxf_strdup ("Tea rose (orange)");
                         return (RGB_color_name);
                 }
 */
                 case 0xF4C2C2 :
                 {
-                        RGB_color_name = strdup ("Tea rose (rose)");
+                        RGB_color_name = dxf_strdup ("Tea rose (rose)");
                         return (RGB_color_name);
                 }
                 case 0x008080 :
                 {
-                        RGB_color_name = strdup ("Teal");
+                        RGB_color_name = dxf_strdup ("Teal");
                         return (RGB_color_name);
                 }
                 case 0xCD5700 :
                 {
-                        RGB_color_name = strdup ("Tenné (Tawny)");
+                        RGB_color_name = dxf_strdup ("Tenné (Tawny)");
                         return (RGB_color_name);
                 }
                 case 0xE2725B :
                 {
-                        RGB_color_name = strdup ("Terra cotta");
+                        RGB_color_name = dxf_strdup ("Terra cotta");
                         return (RGB_color_name);
                 }
                 case 0xD8BFD8 :
                 {
-                        RGB_color_name = strdup ("Thistle");
+                        RGB_color_name = dxf_strdup ("Thistle");
                         return (RGB_color_name);
                 }
                 case 0xDE6FA1 :
                 {
-                        RGB_color_name = strdup ("Thullian pink");
+                        RGB_color_name = dxf_strdup ("Thullian pink");
                         return (RGB_color_name);
                 }
                 case 0xFF6347 :
                 {
-                        RGB_color_name = strdup ("Tomato");
+                        RGB_color_name = dxf_strdup ("Tomato");
                         return (RGB_color_name);
                 }
                 case 0x30D5C8 :
                 {
-                        RGB_color_name = strdup ("Turquoise");
+                        RGB_color_name = dxf_strdup ("Turquoise");
                         return (RGB_color_name);
                 }
                 case 0x66023C :
                 {
-                        RGB_color_name = strdup ("Tyrian Purple");
+                        RGB_color_name = dxf_strdup ("Tyrian Purple");
                         return (RGB_color_name);
                 }
                 case 0x120A8F :
                 {
-                        RGB_color_name = strdup ("Ultramarine");
+                        RGB_color_name = dxf_strdup ("Ultramarine");
                         return (RGB_color_name);
                 }
                 case 0xFF6FFF :
                 {
-                        RGB_color_name = strdup ("Ultra pink");
+                        RGB_color_name = dxf_strdup ("Ultra pink");
                         return (RGB_color_name);
                 }
                 case 0x5B92E5 :
                 {
-                        RGB_color_name = strdup ("United Nations blue");
+                        RGB_color_name = dxf_strdup ("United Nations blue");
                         return (RGB_color_name);
                 }
                 case 0xAE2029 :
                 {
-                        RGB_color_name = strdup ("Upsdell red");
+                        RGB_color_name = dxf_strdup ("Upsdell red");
                         return (RGB_color_name);
                 }
                 case 0xC5B358 :
                 {
-                        RGB_color_name = strdup ("Vegas Gold");
+                        RGB_color_name = dxf_strdup ("Vegas Gold");
                         return (RGB_color_name);
                 }
                 case 0xC80815 :
                 {
-                        RGB_color_name = strdup ("Venetian red");
+                        RGB_color_name = dxf_strdup ("Venetian red");
                         return (RGB_color_name);
                 }
                 case 0xE34234 :
                 {
-                        RGB_color_name = strdup ("Vermilion");
+                        RGB_color_name = dxf_strdup ("Vermilion");
                         return (RGB_color_name);
                 }
                 case 0x8B00FF :
                 {
-                        RGB_color_name = strdup ("Violet");
+                        RGB_color_name = dxf_strdup ("Violet");
                         return (RGB_color_name);
                 }
 /*
                 case 0xEE82EE :
                 {
-                        RGB_color_name = strdup ("Violet (web)");
+                        RGB_color_name = dxf_strdup ("Violet (web)");
                         return (RGB_color_name);
                 }
 */
                 case 0x8601AF :
                 {
-                        RGB_color_name = strdup ("Violet (RYB)");
+                        RGB_color_name = dxf_strdup ("Violet (RYB)");
                         return (RGB_color_name);
                 }
                 case 0x40826D :
                 {
-                        RGB_color_name = strdup ("Viridian");
+                        RGB_color_name = dxf_strdup ("Viridian");
                         return (RGB_color_name);
                 }
                 case 0xF5DEB3 :
                 {
-                        RGB_color_name = strdup ("Wheat");
+                        RGB_color_name = dxf_strdup ("Wheat");
                         return (RGB_color_name);
                 }
                 case 0xFFFFFF :
                 {
-                        RGB_color_name = strdup ("White");
+                        RGB_color_name = dxf_strdup ("White");
                         return (RGB_color_name);
                 }
                 case 0xC9A0DC :
                 {
-                        RGB_color_name = strdup ("Wisteria");
+                        RGB_color_name = dxf_strdup ("Wisteria");
                         return (RGB_color_name);
                 }
                 case 0x738678 :
                 {
-                        RGB_color_name = strdup ("Xanadu");
+                        RGB_color_name = dxf_strdup ("Xanadu");
                         return (RGB_color_name);
                 }
                 case 0x0F4D92 :
                 {
-                        RGB_color_name = strdup ("Yale Blue");
+                        RGB_color_name = dxf_strdup ("Yale Blue");
                         return (RGB_color_name);
                 }
                 case 0xFFFF00 :
                 {
-                        RGB_color_name = strdup ("Yellow");
+                        RGB_color_name = dxf_strdup ("Yellow");
                         return (RGB_color_name);
                 }
                 case 0xFFEF00 :
                 {
-                        RGB_color_name = strdup ("Yellow (process)");
+                        RGB_color_name = dxf_strdup ("Yellow (process)");
                         return (RGB_color_name);
                 }
                 case 0xFEFE33 :
                 {
-                        RGB_color_name = strdup ("Yellow (RYB)");
+                        RGB_color_name = dxf_strdup ("Yellow (RYB)");
                         return (RGB_color_name);
                 }
                 case 0x9ACD32 :
                 {
-                        RGB_color_name = strdup ("Yellow-green");
+                        RGB_color_name = dxf_strdup ("Yellow-green");
                         return (RGB_color_name);
                 }
                 default:
@@ -2223,28 +2223,28 @@ dxf_RGB_color_free
                  * RGB Color. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (RGB_color == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
         if (RGB_color->name == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer to a DxfRGBColor name was passed.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (RGB_color->name);
-        free (RGB_color);
+        dxf_free (RGB_color->name);
+        dxf_free (RGB_color);
         RGB_color = NULL;
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (EXIT_SUCCESS);
@@ -2268,18 +2268,19 @@ dxf_RGB_color_free_chain
                 /*!< a pointer to the chain of DXF \c COLOR entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (colors == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (colors != NULL)
         {
                 struct DxfRGBColor *iter = colors->next;
+                colors->next = NULL;
                 dxf_RGB_color_free (colors);
                 colors = (DxfRGBColor *) iter;
         }
@@ -50,7 +50,7 @@
 DxfComment *
 dxf_comment_new ()
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfComment *comment = NULL;
@@ -59,9 +59,9 @@ dxf_comment_new ()
         size = sizeof (DxfComment);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((comment = malloc (size)) == NULL)
+        if ((comment = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfComment struct.\n")),
                   __FUNCTION__);
                 comment = NULL;
@@ -70,7 +70,7 @@ dxf_comment_new ()
         {
                 memset (comment, 0, size);
         }
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (comment);
@@ -91,28 +91,28 @@ dxf_comment_init
                 /*!< a pointer to the DXF \c COMMENT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (comment == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 comment = dxf_comment_new ();
         }
         if (comment == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfComment struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_comment_set_id_code (comment, 0);
-        dxf_comment_set_value (comment, strdup (""));
+        dxf_comment_set_value (comment, dxf_strdup (""));
         dxf_comment_set_next (comment, NULL);
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (comment);
@@ -150,7 +150,7 @@ dxf_comment_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -184,20 +184,20 @@ dxf_comment_free
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (comment->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfComment was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_comment_get_value (comment));
-        free (comment);
+        dxf_free (dxf_comment_get_value (comment));
+        dxf_free (comment);
         comment = NULL;
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (EXIT_SUCCESS);
@@ -215,18 +215,19 @@ dxf_comment_free_chain
                 /*!< a pointer to the chain of DXF \c COMMENT entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (comments == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (comments != NULL)
         {
                 struct DxfComment *iter = comments->next;
+                comments->next = NULL;
                 dxf_comment_free (comments);
                 comments = (DxfComment *) iter;
         }
@@ -254,14 +255,14 @@ dxf_comment_get_id_code
         /* Do some basic checks. */
         if (comment == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (comment->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -293,14 +294,14 @@ dxf_comment_set_id_code
         /* Do some basic checks. */
         if (comment == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -323,19 +324,19 @@ dxf_comment_get_value
                 /*!< a pointer to the chain of DXF \c COMMENT entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (comment == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
               return (NULL);
         }
         if (comment->value == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -359,24 +360,24 @@ dxf_comment_set_value
                 /*!< the comment value (string) to be set.*/
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (comment == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
               return (NULL);
         }
         if (value != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        comment->value = strdup (value);
+        comment->value = dxf_strdup (value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -405,14 +406,14 @@ dxf_comment_get_next
         /* Do some basic checks. */
         if (comment == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (comment->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -443,14 +444,14 @@ dxf_comment_set_next
         /* Do some basic checks. */
         if (comment == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -484,14 +485,14 @@ dxf_comment_get_last
         /* Do some basic checks. */
         if (comment == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (comment->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfComment *) comment);
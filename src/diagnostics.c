@@ -0,0 +1,915 @@
+/*!
+ * \file diagnostics.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF diagnostics (errors, warnings and
+ * informational messages).
+ *
+ * All diagnostics of the library are emitted with \c dxf_diagnostic ().
+ * A diagnostic goes to the collector attached to the \c DxfFile it
+ * relates to, or else to the default collector of the calling thread.
+ * Without a collector the diagnostic is printed to \c stderr.\n
+ * \n
+ * A collector in \c DXF_DIAGNOSTICS_SILENT mode only counts
+ * diagnostics per severity: the message is not formatted, so a silent
+ * collector makes diagnostics essentially free.\n
+ * In the other modes diagnostics are aggregated per kind (the format
+ * string), only the first \c rate_limit diagnostics of a kind are
+ * reported (kept, passed to the callback and optionally printed), the
+ * remainder is only counted.\n
+ * A collector in \c DXF_DIAGNOSTICS_DEFER mode keeps every diagnostic
+ * until it is replayed with \c dxf_diagnostics_replay (), this is how
+ * work spread over several threads reports its diagnostics in order.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "diagnostics.h"
+
+
+/*! \brief Default collector of the calling thread. */
+static __thread DxfDiagnostics *dxf_diagnostics_default = NULL;
+
+
+/*!
+ * \brief Find the kind for a format string, add it when not found.
+ *
+ * \return the index of the kind, or -1 when no memory could be
+ * allocated.
+ */
+static int
+dxf_diagnostics_find_kind
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the collector. */
+        const char *format,
+                /*!< format string. */
+        DxfDiagnosticSeverity severity
+                /*!< severity. */
+)
+{
+        DxfDiagnosticKind *kinds;
+        int *table;
+        int size;
+        int slot;
+        int i;
+
+        if (diagnostics->kind_table_size > 0)
+        {
+                slot = (int) (((uintptr_t) format >> 3) & (diagnostics->kind_table_size - 1));
+                while (diagnostics->kind_table[slot] != 0)
+                {
+                        i = diagnostics->kind_table[slot] - 1;
+                        if (diagnostics->kinds[i].format == format)
+                        {
+                                return (i);
+                        }
+                        slot = (slot + 1) & (diagnostics->kind_table_size - 1);
+                }
+        }
+        /* Not found, grow the hash table at a load of 1/2. */
+        if (2 * (diagnostics->number_of_kinds + 1) > diagnostics->kind_table_size)
+        {
+                size = (diagnostics->kind_table_size == 0) ? 64 : 2 * diagnostics->kind_table_size;
+                table = dxf_calloc (size, sizeof (int));
+                kinds = dxf_realloc (diagnostics->kinds, (size / 2) * sizeof (DxfDiagnosticKind));
+                if ((table == NULL) || (kinds == NULL))
+                {
+                        dxf_free (table);
+                        if (kinds != NULL)
+                        {
+                                diagnostics->kinds = kinds;
+                        }
+                        return (-1);
+                }
+                diagnostics->kinds = kinds;
+                for (i = 0; i < diagnostics->number_of_kinds; i++)
+                {
+                        slot = (int) (((uintptr_t) kinds[i].format >> 3) & (size - 1));
+                        while (table[slot] != 0)
+                        {
+                                slot = (slot + 1) & (size - 1);
+                        }
+                        table[slot] = i + 1;
+                }
+                dxf_free (diagnostics->kind_table);
+                diagnostics->kind_table = table;
+                diagnostics->kind_table_size = size;
+        }
+        i = diagnostics->number_of_kinds++;
+        memset (&diagnostics->kinds[i], 0, sizeof (DxfDiagnosticKind));
+        diagnostics->kinds[i].format = format;
+        diagnostics->kinds[i].severity = severity;
+        slot = (int) (((uintptr_t) format >> 3) & (diagnostics->kind_table_size - 1));
+        while (diagnostics->kind_table[slot] != 0)
+        {
+                slot = (slot + 1) & (diagnostics->kind_table_size - 1);
+        }
+        diagnostics->kind_table[slot] = i + 1;
+        return (i);
+}
+
+
+/*!
+ * \brief Allocate memory for a DXF diagnostics collector.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfDiagnostics *
+dxf_diagnostics_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDiagnostics *diagnostics = NULL;
+
+        diagnostics = dxf_calloc (1, sizeof (DxfDiagnostics));
+        if (diagnostics == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diagnostics);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a DXF
+ * diagnostics collector.
+ *
+ * The collector is in \c DXF_DIAGNOSTICS_COLLECT mode, reports all
+ * severities with the default rate limit and prints to \c stderr in
+ * \c DXF_DIAGNOSTICS_PRINT mode.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfDiagnostics *
+dxf_diagnostics_init
+(
+        DxfDiagnostics *diagnostics
+                /*!< a pointer to the DXF diagnostics collector. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (diagnostics == NULL)
+        {
+                diagnostics = dxf_diagnostics_new ();
+        }
+        if (diagnostics == NULL)
+        {
+                return (NULL);
+        }
+        diagnostics->mode = DXF_DIAGNOSTICS_COLLECT;
+        diagnostics->min_severity = DXF_DIAGNOSTIC_INFO;
+        memset (diagnostics->count, 0, sizeof (diagnostics->count));
+        diagnostics->rate_limit = DXF_DIAGNOSTICS_DEFAULT_RATE_LIMIT;
+        diagnostics->kinds = NULL;
+        diagnostics->number_of_kinds = 0;
+        diagnostics->kind_table = NULL;
+        diagnostics->kind_table_size = 0;
+        diagnostics->records = NULL;
+        diagnostics->number_of_records = 0;
+        diagnostics->max_records = DXF_DIAGNOSTICS_DEFAULT_MAX_RECORDS;
+        diagnostics->callback = NULL;
+        diagnostics->callback_data = NULL;
+        diagnostics->stream = stderr;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diagnostics);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF diagnostics collector and
+ * all its data fields.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostics_free
+(
+        DxfDiagnostics *diagnostics
+                /*!< a pointer to the DXF diagnostics collector. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (diagnostics == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_diagnostics_default == diagnostics)
+        {
+                dxf_diagnostics_default = NULL;
+        }
+        dxf_diagnostics_clear (diagnostics);
+        dxf_free (diagnostics);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Forget all counted, aggregated and kept diagnostics.
+ *
+ * The settings of the collector are kept.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostics_clear
+(
+        DxfDiagnostics *diagnostics
+                /*!< a pointer to the DXF diagnostics collector. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        if (diagnostics == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < diagnostics->number_of_kinds; i++)
+        {
+                dxf_free (diagnostics->kinds[i].first_message);
+        }
+        for (i = 0; i < diagnostics->number_of_records; i++)
+        {
+                dxf_free (diagnostics->records[i].message);
+        }
+        dxf_free (diagnostics->kinds);
+        dxf_free (diagnostics->kind_table);
+        dxf_free (diagnostics->records);
+        memset (diagnostics->count, 0, sizeof (diagnostics->count));
+        diagnostics->kinds = NULL;
+        diagnostics->number_of_kinds = 0;
+        diagnostics->kind_table = NULL;
+        diagnostics->kind_table_size = 0;
+        diagnostics->records = NULL;
+        diagnostics->number_of_records = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the mode of a DXF diagnostics collector.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostics_set_mode
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the DXF diagnostics collector. */
+        DxfDiagnosticsMode mode
+                /*!< mode. */
+)
+{
+        if (diagnostics == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((mode < DXF_DIAGNOSTICS_SILENT) || (mode > DXF_DIAGNOSTICS_DEFER))
+        {
+                return (EXIT_FAILURE);
+        }
+        diagnostics->mode = mode;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the minimum severity of reported diagnostics.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostics_set_min_severity
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the DXF diagnostics collector. */
+        DxfDiagnosticSeverity min_severity
+                /*!< minimum severity. */
+)
+{
+        if (diagnostics == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((min_severity < DXF_DIAGNOSTIC_INFO)
+          || (min_severity >= DXF_DIAGNOSTIC_NUMBER_OF_SEVERITIES))
+        {
+                return (EXIT_FAILURE);
+        }
+        diagnostics->min_severity = min_severity;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the number of diagnostics of a kind that are reported.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostics_set_rate_limit
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the DXF diagnostics collector. */
+        uint64_t rate_limit
+                /*!< number of diagnostics, 0 for no limit. */
+)
+{
+        if (diagnostics == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        diagnostics->rate_limit = rate_limit;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the maximum number of reported diagnostics that are kept.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostics_set_max_records
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the DXF diagnostics collector. */
+        int max_records
+                /*!< maximum number of diagnostics. */
+)
+{
+        if ((diagnostics == NULL) || (max_records < 0))
+        {
+                return (EXIT_FAILURE);
+        }
+        diagnostics->max_records = max_records;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the callback invoked for every reported diagnostic.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostics_set_callback
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the DXF diagnostics collector. */
+        DxfDiagnosticCallback callback,
+                /*!< callback, or \c NULL. */
+        void *data
+                /*!< user data passed to the callback. */
+)
+{
+        if (diagnostics == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        diagnostics->callback = callback;
+        diagnostics->callback_data = data;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the stream reported diagnostics are printed to in
+ * \c DXF_DIAGNOSTICS_PRINT mode.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostics_set_stream
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the DXF diagnostics collector. */
+        FILE *stream
+                /*!< stream. */
+)
+{
+        if ((diagnostics == NULL) || (stream == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        diagnostics->stream = stream;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of diagnostics of a severity.
+ *
+ * \return the number of diagnostics.
+ */
+uint64_t
+dxf_diagnostics_get_count
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the DXF diagnostics collector. */
+        DxfDiagnosticSeverity severity
+                /*!< severity. */
+)
+{
+        if ((diagnostics == NULL) || (severity < DXF_DIAGNOSTIC_INFO)
+          || (severity >= DXF_DIAGNOSTIC_NUMBER_OF_SEVERITIES))
+        {
+                return (0);
+        }
+        return (diagnostics->count[severity]);
+}
+
+
+/*!
+ * \brief Get the number of kinds of diagnostics aggregated.
+ *
+ * \return the number of kinds.
+ */
+int
+dxf_diagnostics_get_number_of_kinds
+(
+        DxfDiagnostics *diagnostics
+                /*!< a pointer to the DXF diagnostics collector. */
+)
+{
+        if (diagnostics == NULL)
+        {
+                return (0);
+        }
+        return (diagnostics->number_of_kinds);
+}
+
+
+/*!
+ * \brief Get an aggregated kind of diagnostics.
+ *
+ * \return a pointer to the kind, or \c NULL for an invalid index.
+ */
+DxfDiagnosticKind *
+dxf_diagnostics_get_kind
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the DXF diagnostics collector. */
+        int index
+                /*!< index of the kind. */
+)
+{
+        if ((diagnostics == NULL) || (index < 0)
+          || (index >= diagnostics->number_of_kinds))
+        {
+                return (NULL);
+        }
+        return (&diagnostics->kinds[index]);
+}
+
+
+/*!
+ * \brief Get the number of reported diagnostics kept.
+ *
+ * \return the number of diagnostics.
+ */
+int
+dxf_diagnostics_get_number_of_records
+(
+        DxfDiagnostics *diagnostics
+                /*!< a pointer to the DXF diagnostics collector. */
+)
+{
+        if (diagnostics == NULL)
+        {
+                return (0);
+        }
+        return (diagnostics->number_of_records);
+}
+
+
+/*!
+ * \brief Get a reported diagnostic.
+ *
+ * \return a pointer to the diagnostic, or \c NULL for an invalid index.
+ */
+DxfDiagnostic *
+dxf_diagnostics_get_record
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the DXF diagnostics collector. */
+        int index
+                /*!< index of the diagnostic. */
+)
+{
+        if ((diagnostics == NULL) || (index < 0)
+          || (index >= diagnostics->number_of_records))
+        {
+                return (NULL);
+        }
+        return (&diagnostics->records[index]);
+}
+
+
+/*!
+ * \brief Write the aggregated diagnostics, one line per kind with the
+ * number of diagnostics, the number of suppressed diagnostics, the line
+ * number and the message of the first diagnostic.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostics_write_summary
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the DXF diagnostics collector. */
+        FILE *stream
+                /*!< stream to write to. */
+)
+{
+        static const char *severity_names[DXF_DIAGNOSTIC_NUMBER_OF_SEVERITIES] =
+        {
+                "info",
+                "warning",
+                "error"
+        };
+        DxfDiagnosticKind *kind;
+        int i;
+
+        if ((diagnostics == NULL) || (stream == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        fprintf (stream, "%" PRIu64 " errors, %" PRIu64 " warnings, %" PRIu64 " informational messages.\n",
+          diagnostics->count[DXF_DIAGNOSTIC_ERROR],
+          diagnostics->count[DXF_DIAGNOSTIC_WARNING],
+          diagnostics->count[DXF_DIAGNOSTIC_INFO]);
+        for (i = 0; i < diagnostics->number_of_kinds; i++)
+        {
+                kind = &diagnostics->kinds[i];
+                fprintf (stream, "%s: %" PRIu64 " times (%" PRIu64 " suppressed), first in line %d: %s\n",
+                  severity_names[kind->severity], kind->count,
+                  kind->suppressed, kind->first_line_number,
+                  (kind->first_message != NULL) ? kind->first_message : kind->format);
+        }
+        return (ferror (stream) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the default collector of the calling thread.
+ *
+ * The default collector receives the diagnostics which are not related
+ * to a \c DxfFile with a collector attached.
+ *
+ * \return \c EXIT_SUCCESS.
+ */
+int
+dxf_diagnostics_set_default
+(
+        DxfDiagnostics *diagnostics
+                /*!< a pointer to the DXF diagnostics collector, or
+                 * \c NULL to print to \c stderr. */
+)
+{
+        dxf_diagnostics_default = diagnostics;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the default collector of the calling thread.
+ *
+ * \return a pointer to the collector, or \c NULL.
+ */
+DxfDiagnostics *
+dxf_diagnostics_get_default ()
+{
+        return (dxf_diagnostics_default);
+}
+
+
+/*!
+ * \brief Keep a copy of a reported diagnostic in the records of a
+ * collector.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_diagnostics_keep
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the collector. */
+        const DxfDiagnostic *diagnostic
+                /*!< the diagnostic, the message is copied. */
+)
+{
+        DxfDiagnostic *record;
+
+        if ((diagnostics->number_of_records & (diagnostics->number_of_records - 1)) == 0)
+        {
+                /* Grow the records to the next power of 2. */
+                record = dxf_realloc (diagnostics->records,
+                  (diagnostics->number_of_records ? 2 * diagnostics->number_of_records : 1)
+                  * sizeof (DxfDiagnostic));
+                if (record == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                diagnostics->records = record;
+        }
+        record = &diagnostics->records[diagnostics->number_of_records];
+        *record = *diagnostic;
+        record->message = dxf_strdup (diagnostic->message);
+        if (record->message == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        diagnostics->number_of_records++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Report a diagnostic to a collector.
+ *
+ * The message is either formatted from \c ap, only when it is
+ * reported, or was formatted before and passed in \c text.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_diagnostics_report
+(
+        DxfDiagnostics *diagnostics,
+                /*!< a pointer to the collector. */
+        DxfFile *fp,
+                /*!< DXF file pointer the diagnostic relates to, or
+                 * \c NULL. */
+        DxfDiagnosticSeverity severity,
+                /*!< severity. */
+        const char *format,
+                /*!< printf () like format string. */
+        int line_number,
+                /*!< line number in the DXF file, or 0. */
+        const char *text,
+                /*!< formatted message, or \c NULL to format it from
+                 * \c ap. */
+        va_list *ap
+                /*!< arguments of \c format when \c text is \c NULL. */
+)
+{
+        DxfDiagnosticKind *kind;
+        DxfDiagnostic diagnostic;
+        char message[DXF_MAX_STRING_LENGTH];
+        size_t length;
+        int index;
+
+        if ((severity < DXF_DIAGNOSTIC_INFO)
+          || (severity >= DXF_DIAGNOSTIC_NUMBER_OF_SEVERITIES))
+        {
+                severity = DXF_DIAGNOSTIC_ERROR;
+        }
+        diagnostics->count[severity]++;
+        if ((diagnostics->mode == DXF_DIAGNOSTICS_SILENT)
+          || ((diagnostics->mode != DXF_DIAGNOSTICS_DEFER)
+          && (severity < diagnostics->min_severity)))
+        {
+                return (EXIT_SUCCESS);
+        }
+        index = dxf_diagnostics_find_kind (diagnostics, format, severity);
+        if (index < 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        kind = &diagnostics->kinds[index];
+        kind->count++;
+        if ((diagnostics->mode != DXF_DIAGNOSTICS_DEFER)
+          && (diagnostics->rate_limit != 0)
+          && (kind->count > diagnostics->rate_limit))
+        {
+                kind->suppressed++;
+                return (EXIT_SUCCESS);
+        }
+        if (text != NULL)
+        {
+                snprintf (message, sizeof (message), "%s", text);
+        }
+        else
+        {
+                vsnprintf (message, sizeof (message), format, *ap);
+        }
+        diagnostic.severity = severity;
+        diagnostic.kind = index;
+        diagnostic.line_number = line_number;
+        diagnostic.message = message;
+        if (diagnostics->mode == DXF_DIAGNOSTICS_DEFER)
+        {
+                /* Keep the message as it would have been printed, it
+                 * is reported when replayed. */
+                return (dxf_diagnostics_keep (diagnostics, &diagnostic));
+        }
+        length = strlen (message);
+        while ((length > 0) && (message[length - 1] == '\n'))
+        {
+                message[--length] = '\0';
+        }
+        if (kind->count == 1)
+        {
+                kind->first_line_number = line_number;
+                kind->first_message = dxf_strdup (message);
+        }
+        if (diagnostics->mode == DXF_DIAGNOSTICS_PRINT)
+        {
+                if ((fp != NULL) && (fp->filename != NULL))
+                {
+                        fprintf (diagnostics->stream, "%s:%d: %s\n",
+                          fp->filename, line_number, message);
+                }
+                else
+                {
+                        fprintf (diagnostics->stream, "%s\n", message);
+                }
+                if ((diagnostics->rate_limit != 0) && (kind->count == diagnostics->rate_limit))
+                {
+                        fprintf (diagnostics->stream,
+                          (_("Further messages of this kind are suppressed.\n")));
+                }
+        }
+        if (diagnostics->callback != NULL)
+        {
+                diagnostics->callback (&diagnostic, diagnostics->callback_data);
+        }
+        if (diagnostics->number_of_records < diagnostics->max_records)
+        {
+                return (dxf_diagnostics_keep (diagnostics, &diagnostic));
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Emit a diagnostic.
+ *
+ * The format string identifies the kind of the diagnostic, so it has
+ * to be a string with static storage duration.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostic
+(
+        DxfFile *fp,
+                /*!< DXF file pointer the diagnostic relates to, or
+                 * \c NULL. */
+        DxfDiagnosticSeverity severity,
+                /*!< severity. */
+        const char *format,
+                /*!< printf () like format string. */
+        ...
+)
+{
+        DxfDiagnostics *diagnostics = NULL;
+        va_list ap;
+        int line_number = 0;
+        int result;
+
+        if (fp != NULL)
+        {
+                diagnostics = (DxfDiagnostics *) fp->diagnostics;
+                line_number = fp->line_number;
+        }
+        if (diagnostics == NULL)
+        {
+                diagnostics = dxf_diagnostics_default;
+        }
+        if (diagnostics == NULL)
+        {
+                va_start (ap, format);
+                vfprintf (stderr, format, ap);
+                va_end (ap);
+                return (EXIT_SUCCESS);
+        }
+        va_start (ap, format);
+        result = dxf_diagnostics_report (diagnostics, fp, severity, format,
+          line_number, NULL, &ap);
+        va_end (ap);
+        return (result);
+}
+
+
+/*!
+ * \brief Emit the diagnostics kept by a collector in
+ * \c DXF_DIAGNOSTICS_DEFER mode, in the order they were emitted.
+ *
+ * Every diagnostic is handled as if it was emitted with
+ * \c dxf_diagnostic () for \c fp at this point, so diagnostics of work
+ * done on other threads end up in the collector of \c fp in a
+ * reproducible order.\n
+ * The deferred diagnostics are kept, clear \c deferred to reuse it.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostics_replay
+(
+        DxfDiagnostics *deferred,
+                /*!< a pointer to the collector in
+                 * \c DXF_DIAGNOSTICS_DEFER mode. */
+        DxfFile *fp
+                /*!< DXF file pointer the diagnostics relate to, or
+                 * \c NULL. */
+)
+{
+        DxfDiagnostics *diagnostics = NULL;
+        DxfDiagnostic *record;
+        int result = EXIT_SUCCESS;
+        int i;
+
+        if (deferred == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (fp != NULL)
+        {
+                diagnostics = (DxfDiagnostics *) fp->diagnostics;
+        }
+        if (diagnostics == NULL)
+        {
+                diagnostics = dxf_diagnostics_default;
+        }
+        for (i = 0; i < deferred->number_of_records; i++)
+        {
+                record = &deferred->records[i];
+                if (diagnostics == NULL)
+                {
+                        fputs (record->message, stderr);
+                }
+                else if (dxf_diagnostics_report (diagnostics, fp,
+                  record->severity, deferred->kinds[record->kind].format,
+                  record->line_number, record->message, NULL) != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        return (result);
+}
+
+
+/* EOF */
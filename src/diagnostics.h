@@ -0,0 +1,224 @@
+/*!
+ * \file diagnostics.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF diagnostics (errors, warnings and
+ * informational messages).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_DIAGNOSTICS_H
+#define LIBDXF_SRC_DIAGNOSTICS_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_DIAGNOSTICS_DEFAULT_RATE_LIMIT 10
+        /*!< \brief Default number of diagnostics of a kind that are
+         * reported before further diagnostics of that kind are only
+         * counted. */
+
+#define DXF_DIAGNOSTICS_DEFAULT_MAX_RECORDS 1000
+        /*!< \brief Default maximum number of diagnostics kept. */
+
+
+/*!
+ * \brief Severity of a diagnostic.
+ */
+typedef enum
+dxf_diagnostic_severity
+{
+        DXF_DIAGNOSTIC_INFO,
+        DXF_DIAGNOSTIC_WARNING,
+        DXF_DIAGNOSTIC_ERROR,
+        DXF_DIAGNOSTIC_NUMBER_OF_SEVERITIES
+} DxfDiagnosticSeverity;
+
+
+/*!
+ * \brief What a collector does with a diagnostic.
+ */
+typedef enum
+dxf_diagnostics_mode
+{
+        DXF_DIAGNOSTICS_SILENT,
+                /*!< Only count diagnostics per severity, nothing is
+                 * formatted. */
+        DXF_DIAGNOSTICS_COLLECT,
+                /*!< Aggregate diagnostics per kind, keep the reported
+                 * ones and pass them to the callback. */
+        DXF_DIAGNOSTICS_PRINT,
+                /*!< As \c DXF_DIAGNOSTICS_COLLECT and also print the
+                 * reported diagnostics to the stream. */
+        DXF_DIAGNOSTICS_DEFER
+                /*!< Keep every diagnostic, without a limit, until it is
+                 * replayed with \c dxf_diagnostics_replay (). */
+} DxfDiagnosticsMode;
+
+
+/*!
+ * \brief A single reported diagnostic.
+ */
+typedef struct
+dxf_diagnostic_struct
+{
+        DxfDiagnosticSeverity severity;
+                /*!< Severity. */
+        int kind;
+                /*!< Index of the kind of the diagnostic in the
+                 * collector. */
+        int line_number;
+                /*!< Line number in the DXF file, or 0 when not
+                 * known. */
+        char *message;
+                /*!< Formatted message without a trailing newline. */
+} DxfDiagnostic;
+
+
+/*!
+ * \brief Aggregated diagnostics of one kind.
+ *
+ * Diagnostics are of the same kind when they are emitted with the same
+ * format string.
+ */
+typedef struct
+dxf_diagnostic_kind_struct
+{
+        const char *format;
+                /*!< Format string identifying the kind. */
+        DxfDiagnosticSeverity severity;
+                /*!< Severity. */
+        uint64_t count;
+                /*!< Number of diagnostics of this kind. */
+        uint64_t suppressed;
+                /*!< Number of diagnostics of this kind that were only
+                 * counted because of the rate limit. */
+        int first_line_number;
+                /*!< Line number of the first diagnostic of this
+                 * kind. */
+        char *first_message;
+                /*!< Formatted message of the first diagnostic of this
+                 * kind. */
+} DxfDiagnosticKind;
+
+
+/*!
+ * \brief Callback invoked for every reported diagnostic.
+ */
+typedef void (*DxfDiagnosticCallback) (const DxfDiagnostic *diagnostic, void *data);
+
+
+/*!
+ * \brief Collector of diagnostics.
+ *
+ * A collector is attached to a \c DxfFile (\c diagnostics member), or
+ * installed as the default collector for diagnostics which are not
+ * related to a file.\n
+ * Without any collector diagnostics are printed to \c stderr.\n
+ * A collector is not thread safe, use a collector per thread.
+ */
+typedef struct
+dxf_diagnostics_struct
+{
+        DxfDiagnosticsMode mode;
+                /*!< What to do with a diagnostic. */
+        DxfDiagnosticSeverity min_severity;
+                /*!< Diagnostics with a lower severity are only
+                 * counted. */
+        uint64_t count[DXF_DIAGNOSTIC_NUMBER_OF_SEVERITIES];
+                /*!< Number of diagnostics per severity. */
+        uint64_t rate_limit;
+                /*!< Number of diagnostics of a kind that are reported,
+                 * 0 for no limit. */
+        DxfDiagnosticKind *kinds;
+                /*!< Kinds in order of first appearance. */
+        int number_of_kinds;
+                /*!< Number of kinds. */
+        int *kind_table;
+                /*!< Open addressing hash table of kind index + 1,
+                 * keyed on the format string. */
+        int kind_table_size;
+                /*!< Number of slots in \c kind_table, a power of 2. */
+        DxfDiagnostic *records;
+                /*!< Reported diagnostics. */
+        int number_of_records;
+                /*!< Number of reported diagnostics kept. */
+        int max_records;
+                /*!< Maximum number of reported diagnostics kept. */
+        DxfDiagnosticCallback callback;
+                /*!< Callback invoked for every reported diagnostic, or
+                 * \c NULL. */
+        void *callback_data;
+                /*!< User data passed to the callback. */
+        FILE *stream;
+                /*!< Stream for \c DXF_DIAGNOSTICS_PRINT. */
+} DxfDiagnostics;
+
+
+DxfDiagnostics *dxf_diagnostics_new ();
+DxfDiagnostics *dxf_diagnostics_init (DxfDiagnostics *diagnostics);
+int dxf_diagnostics_free (DxfDiagnostics *diagnostics);
+int dxf_diagnostics_clear (DxfDiagnostics *diagnostics);
+int dxf_diagnostics_set_mode (DxfDiagnostics *diagnostics, DxfDiagnosticsMode mode);
+int dxf_diagnostics_set_min_severity (DxfDiagnostics *diagnostics, DxfDiagnosticSeverity min_severity);
+int dxf_diagnostics_set_rate_limit (DxfDiagnostics *diagnostics, uint64_t rate_limit);
+int dxf_diagnostics_set_max_records (DxfDiagnostics *diagnostics, int max_records);
+int dxf_diagnostics_set_callback (DxfDiagnostics *diagnostics, DxfDiagnosticCallback callback, void *data);
+int dxf_diagnostics_set_stream (DxfDiagnostics *diagnostics, FILE *stream);
+uint64_t dxf_diagnostics_get_count (DxfDiagnostics *diagnostics, DxfDiagnosticSeverity severity);
+int dxf_diagnostics_get_number_of_kinds (DxfDiagnostics *diagnostics);
+DxfDiagnosticKind *dxf_diagnostics_get_kind (DxfDiagnostics *diagnostics, int index);
+int dxf_diagnostics_get_number_of_records (DxfDiagnostics *diagnostics);
+DxfDiagnostic *dxf_diagnostics_get_record (DxfDiagnostics *diagnostics, int index);
+int dxf_diagnostics_write_summary (DxfDiagnostics *diagnostics, FILE *stream);
+int dxf_diagnostics_replay (DxfDiagnostics *deferred, DxfFile *fp);
+int dxf_diagnostics_set_default (DxfDiagnostics *diagnostics);
+DxfDiagnostics *dxf_diagnostics_get_default ();
+int dxf_diagnostic (DxfFile *fp, DxfDiagnosticSeverity severity, const char *format, ...)
+#ifdef __GNUC__
+  __attribute__ ((format (printf, 3, 4)))
+#endif
+  ;
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_DIAGNOSTICS_H */
+
+
+/* EOF */
@@ -41,6 +41,7 @@
 
 
 #include "dictionary.h"
+#include "util.h"
 
 
 /*!
@@ -51,7 +52,7 @@
 DxfDictionary *
 dxf_dictionary_new ()
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfDictionary *dictionary = NULL;
@@ -60,9 +61,9 @@ dxf_dictionary_new ()
         size = sizeof (DxfDictionary);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dictionary = malloc (size)) == NULL)
+        if ((dictionary = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfDictionary struct.\n")),
                   __FUNCTION__);
                 dictionary = NULL;
@@ -71,7 +72,7 @@ dxf_dictionary_new ()
         {
                 memset (dictionary, 0, size);
         }
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (dictionary);
@@ -98,23 +99,23 @@ dxf_dictionary_init
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dictionary = dxf_dictionary_new ();
         }
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfDictionary struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_dictionary_set_id_code (dictionary, 0);
-        dxf_dictionary_set_dictionary_owner_soft (dictionary,  strdup (""));
-        dxf_dictionary_set_dictionary_owner_hard (dictionary,  strdup (""));
-        dxf_dictionary_set_entry_name (dictionary,  strdup (""));
-        dxf_dictionary_set_entry_object_handle (dictionary,  strdup (""));
+        dxf_dictionary_set_dictionary_owner_soft (dictionary,  dxf_strdup (""));
+        dxf_dictionary_set_dictionary_owner_hard (dictionary,  dxf_strdup (""));
+        dxf_dictionary_set_entry_name (dictionary,  dxf_strdup (""));
+        dxf_dictionary_set_entry_object_handle (dictionary,  dxf_strdup (""));
         dxf_dictionary_set_next (dictionary,  NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -145,43 +146,40 @@ dxf_dictionary_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dictionary = dxf_dictionary_new ();
                 dictionary = dxf_dictionary_init (dictionary);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -190,7 +188,7 @@ dxf_dictionary_read
                         /* Now follows a string containing additional
                          * proprietary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionary->entry_name);
+                        dxf_read_string (fp, &dictionary->entry_name);
                 }
                 if (strcmp (temp_string, "5") == 0)
                 {
@@ -208,7 +206,7 @@ dxf_dictionary_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbDictionary") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -218,21 +216,21 @@ dxf_dictionary_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionary->dictionary_owner_soft);
+                        dxf_read_string (fp, &dictionary->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "350") == 0)
                 {
                         /* Now follows a string containing a handle to ae
                          * entry object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionary->entry_object_handle);
+                        dxf_read_string (fp, &dictionary->entry_object_handle);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionary->dictionary_owner_hard);
+                        dxf_read_string (fp, &dictionary->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -243,13 +241,17 @@ dxf_dictionary_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -275,39 +277,39 @@ dxf_dictionary_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DICTIONARY");
+        char *dxf_entity_name = dxf_strdup ("DICTIONARY");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_dictionary_get_entry_name (dictionary), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty entry name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionary_get_id_code (dictionary));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionary_get_id_code (dictionary));
         }
@@ -348,7 +350,7 @@ dxf_dictionary_write
         fprintf (fp->fp, "  3\n%s\n", dxf_dictionary_get_entry_name (dictionary));
         fprintf (fp->fp, "350\n%s\n", dxf_dictionary_get_entry_object_handle (dictionary));
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -377,16 +379,16 @@ dxf_dictionary_free
         /* Do some basic checks. */
         if (dictionary->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfDictionary was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_dictionary_get_dictionary_owner_soft (dictionary));
-        free (dxf_dictionary_get_dictionary_owner_hard (dictionary));
-        free (dxf_dictionary_get_entry_name (dictionary));
-        free (dxf_dictionary_get_entry_object_handle (dictionary));
-        free (dictionary);
+        dxf_free (dxf_dictionary_get_dictionary_owner_soft (dictionary));
+        dxf_free (dxf_dictionary_get_dictionary_owner_hard (dictionary));
+        dxf_free (dxf_dictionary_get_entry_name (dictionary));
+        dxf_free (dxf_dictionary_get_entry_object_handle (dictionary));
+        dxf_free (dictionary);
         dictionary = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -406,18 +408,19 @@ dxf_dictionary_free_chain
                 /*!< a pointer to the chain of DXF \c DICTIONARY objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (dictionaries == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (dictionaries != NULL)
         {
                 struct DxfDictionary *iter = dictionaries->next;
+                dictionaries->next = NULL;
                 dxf_dictionary_free (dictionaries);
                 dictionaries = (DxfDictionary *) iter;
         }
@@ -445,14 +448,14 @@ dxf_dictionary_get_id_code
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dictionary->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -484,14 +487,14 @@ dxf_dictionary_set_id_code
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -525,14 +528,14 @@ dxf_dictionary_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -540,7 +543,7 @@ dxf_dictionary_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->dictionary_owner_soft));
+        return (dxf_strdup (dictionary->dictionary_owner_soft));
 }
 
 
@@ -564,19 +567,19 @@ dxf_dictionary_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dictionary->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -605,14 +608,14 @@ dxf_dictionary_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -620,7 +623,7 @@ dxf_dictionary_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->dictionary_owner_hard));
+        return (dxf_strdup (dictionary->dictionary_owner_hard));
 }
 
 
@@ -644,19 +647,19 @@ dxf_dictionary_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dictionary->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -682,14 +685,14 @@ dxf_dictionary_get_entry_name
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary->entry_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the entry_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -697,7 +700,7 @@ dxf_dictionary_get_entry_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->entry_name));
+        return (dxf_strdup (dictionary->entry_name));
 }
 
 
@@ -719,19 +722,19 @@ dxf_dictionary_set_entry_name
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (entry_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->entry_name = strdup (entry_name);
+        dictionary->entry_name = dxf_strdup (entry_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -757,14 +760,14 @@ dxf_dictionary_get_entry_object_handle
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary->entry_object_handle ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the entry_object_handle member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -772,7 +775,7 @@ dxf_dictionary_get_entry_object_handle
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionary->entry_object_handle));
+        return (dxf_strdup (dictionary->entry_object_handle));
 }
 
 
@@ -795,19 +798,19 @@ dxf_dictionary_set_entry_object_handle
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (entry_object_handle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionary->entry_object_handle = strdup (entry_object_handle);
+        dictionary->entry_object_handle = dxf_strdup (entry_object_handle);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -836,14 +839,14 @@ dxf_dictionary_get_next
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -875,14 +878,14 @@ dxf_dictionary_set_next
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -916,14 +919,14 @@ dxf_dictionary_get_last
         /* Do some basic checks. */
         if (dictionary == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfDictionary *) dictionary);
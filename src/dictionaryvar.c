@@ -42,6 +42,7 @@
 
 
 #include "dictionaryvar.h"
+#include "util.h"
 
 
 /*!
@@ -52,7 +53,7 @@
 DxfDictionaryVar *
 dxf_dictionaryvar_new ()
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfDictionaryVar *dictionaryvar = NULL;
@@ -61,9 +62,9 @@ dxf_dictionaryvar_new ()
         size = sizeof (DxfDictionaryVar);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dictionaryvar = malloc (size)) == NULL)
+        if ((dictionaryvar = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfDictionaryVar struct.\n")),
                   __FUNCTION__);
                 dictionaryvar = NULL;
@@ -72,7 +73,7 @@ dxf_dictionaryvar_new ()
         {
                 memset (dictionaryvar, 0, size);
         }
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (dictionaryvar);
@@ -99,23 +100,23 @@ dxf_dictionaryvar_init
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dictionaryvar = dxf_dictionaryvar_new ();
         }
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfDictionaryVar struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_dictionaryvar_set_id_code (dictionaryvar, 0);
-        dxf_dictionaryvar_set_value (dictionaryvar, strdup (""));
-        dxf_dictionaryvar_set_object_schema_number (dictionaryvar, strdup (""));
-        dxf_dictionaryvar_set_dictionary_owner_soft (dictionaryvar, strdup (""));
-        dxf_dictionaryvar_set_dictionary_owner_hard (dictionaryvar, strdup (""));
+        dxf_dictionaryvar_set_value (dictionaryvar, dxf_strdup (""));
+        dxf_dictionaryvar_set_object_schema_number (dictionaryvar, dxf_strdup (""));
+        dxf_dictionaryvar_set_dictionary_owner_soft (dictionaryvar, dxf_strdup (""));
+        dxf_dictionaryvar_set_dictionary_owner_hard (dictionaryvar, dxf_strdup (""));
         dxf_dictionaryvar_set_next (dictionaryvar, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -146,43 +147,40 @@ dxf_dictionaryvar_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dictionaryvar = dxf_dictionaryvar_new ();
                 dictionaryvar = dxf_dictionaryvar_init (dictionaryvar);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -191,7 +189,7 @@ dxf_dictionaryvar_read
                         /* Now follows a string containing additional
                          * proprietary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionaryvar->value);
+                        dxf_read_string (fp, &dictionaryvar->value);
                 }
                 if (strcmp (temp_string, "5") == 0)
                 {
@@ -209,7 +207,7 @@ dxf_dictionaryvar_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "DictionaryVariables") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -219,21 +217,21 @@ dxf_dictionaryvar_read
                         /* Now follows a string containing a handle to ae
                          * entry object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionaryvar->object_schema_number);
+                        dxf_read_string (fp, &dictionaryvar->object_schema_number);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionaryvar->dictionary_owner_soft);
+                        dxf_read_string (fp, &dictionaryvar->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dictionaryvar->dictionary_owner_hard);
+                        dxf_read_string (fp, &dictionaryvar->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -244,13 +242,17 @@ dxf_dictionaryvar_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -276,42 +278,42 @@ dxf_dictionaryvar_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DICTIONARYVAR");
+        char *dxf_entity_name = dxf_strdup ("DICTIONARYVAR");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_dictionaryvar_get_value (dictionaryvar), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty value string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         if (strcmp (dxf_dictionaryvar_get_object_schema_number (dictionaryvar), "0") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty object schema number string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dictionaryvar_get_id_code (dictionaryvar));
         }
@@ -352,7 +354,7 @@ dxf_dictionaryvar_write
         fprintf (fp->fp, "280\n%s\n", dxf_dictionaryvar_get_object_schema_number (dictionaryvar));
         fprintf (fp->fp, "  1\n%s\n", dxf_dictionaryvar_get_value (dictionaryvar));
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -381,16 +383,16 @@ dxf_dictionaryvar_free
         /* Do some basic checks. */
         if (dxf_dictionaryvar_get_next (dictionaryvar) != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfDictionaryVar was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar));
-        free (dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar));
-        free (dxf_dictionaryvar_get_value (dictionaryvar));
-        free (dxf_dictionaryvar_get_object_schema_number (dictionaryvar));
-        free (dictionaryvar);
+        dxf_free (dxf_dictionaryvar_get_dictionary_owner_soft (dictionaryvar));
+        dxf_free (dxf_dictionaryvar_get_dictionary_owner_hard (dictionaryvar));
+        dxf_free (dxf_dictionaryvar_get_value (dictionaryvar));
+        dxf_free (dxf_dictionaryvar_get_object_schema_number (dictionaryvar));
+        dxf_free (dictionaryvar);
         dictionaryvar = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -410,18 +412,19 @@ dxf_dictionaryvar_free_chain
                 /*!< pointer to the chain of DXF \c DICTIONARYVAR objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (dictionaryvars == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (dictionaryvars != NULL)
         {
                 struct DxfDictionaryVar *iter = dictionaryvars->next;
+                dictionaryvars->next = NULL;
                 dxf_dictionaryvar_free (dictionaryvars);
                 dictionaryvars = (DxfDictionaryVar *) iter;
         }
@@ -449,14 +452,14 @@ dxf_dictionaryvar_get_id_code
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dictionaryvar->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -488,14 +491,14 @@ dxf_dictionaryvar_set_id_code
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -529,14 +532,14 @@ dxf_dictionaryvar_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionaryvar->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -544,7 +547,7 @@ dxf_dictionaryvar_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->dictionary_owner_soft));
+        return (dxf_strdup (dictionaryvar->dictionary_owner_soft));
 }
 
 
@@ -568,19 +571,19 @@ dxf_dictionaryvar_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dictionaryvar->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -609,14 +612,14 @@ dxf_dictionaryvar_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionaryvar->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -624,7 +627,7 @@ dxf_dictionaryvar_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->dictionary_owner_hard));
+        return (dxf_strdup (dictionaryvar->dictionary_owner_hard));
 }
 
 
@@ -648,19 +651,19 @@ dxf_dictionaryvar_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dictionaryvar->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -686,14 +689,14 @@ dxf_dictionaryvar_get_value
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionaryvar->value ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the value member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -701,7 +704,7 @@ dxf_dictionaryvar_get_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->value));
+        return (dxf_strdup (dictionaryvar->value));
 }
 
 
@@ -723,19 +726,19 @@ dxf_dictionaryvar_set_value
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (value == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->value = strdup (value);
+        dictionaryvar->value = dxf_strdup (value);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -763,14 +766,14 @@ dxf_dictionaryvar_get_object_schema_number
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionaryvar->object_schema_number ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the object_schema_number member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -778,7 +781,7 @@ dxf_dictionaryvar_get_object_schema_number
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dictionaryvar->object_schema_number));
+        return (dxf_strdup (dictionaryvar->object_schema_number));
 }
 
 
@@ -801,19 +804,19 @@ dxf_dictionaryvar_set_object_schema_number
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object_schema_number == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dictionaryvar->object_schema_number = strdup (object_schema_number);
+        dictionaryvar->object_schema_number = dxf_strdup (object_schema_number);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -842,14 +845,14 @@ dxf_dictionaryvar_get_next
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionaryvar->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -881,14 +884,14 @@ dxf_dictionaryvar_set_next
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -922,14 +925,14 @@ dxf_dictionaryvar_get_last
         /* Do some basic checks. */
         if (dictionaryvar == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionaryvar->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfDictionaryVar *) dictionaryvar);
@@ -0,0 +1,1648 @@
+/*!
+ * \file diff.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF differences between the entities of two
+ * drawings, and patches applying them.
+ *
+ * The entities of the two drawings are aligned by their handle (group
+ * code 5).\n
+ * Every entity is written to memory as it would be written to a DXF
+ * file, the groups written by the writer of an entity type describe
+ * the fields of that type.\n
+ * Real values are written with all their significant digits, so a
+ * change smaller than the six decimals of a DXF file is still found and
+ * an applied entity gets the exact values of the new drawing.\n
+ * A 64 bit hash of the written text is computed for every entity, on
+ * several threads, only entities of which the hash differs are compared
+ * group by group.\n
+ * \n
+ * A modified entity with the same groups in the same order is recorded
+ * as the new values of the changed groups, an entity of which groups
+ * were added or removed is recorded as a whole.\n
+ * The hashes of the old and new entity are part of every change, a
+ * patch is only applied to a drawing with the same old entities, and
+ * an applied entity has to be written exactly as it was in the new
+ * drawing.\n
+ * \n
+ * Only the entities of the \c ENTITIES section are compared, entities
+ * without a handle can not be aligned.\n
+ * Every added, modified or replaced entity is read back from its text
+ * while the diff is computed.\n
+ * Entities which are written together with the entities following
+ * them, like a \c POLYLINE with its \c VERTEX entities, entities of
+ * types which are not modeled and entities which are not written as
+ * they are read can only be removed by a patch, a diff adding or
+ * changing one fails.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "diff.h"
+#include "entity_vtable.h"
+#include "hash.h"
+#include "memory_writer.h"
+#include "tracing.h"
+#include <inttypes.h>
+#include <pthread.h>
+#include <unistd.h>
+
+
+#define DXF_DIFF_MIN_CAPACITY 64
+        /*!< \brief Initial number of changes of a \c DxfDiff. */
+
+#define DXF_DIFF_MAX_THREADS 64
+        /*!< \brief Maximum number of threads hashing the entities. */
+
+#define DXF_DIFF_MIN_ENTITIES_PER_THREAD 4096
+        /*!< \brief Minimum number of entities hashed by a thread. */
+
+#define DXF_DIFF_FORMAT_VERSION 2
+        /*!< \brief Version of the text format of a written patch. */
+
+
+/*!
+ * \brief Names of the operations in a written patch, indexed by
+ * \c DxfDiffOperation.
+ */
+static const char *dxf_diff_operation_names[] =
+{
+        "ADDED",
+        "REMOVED",
+        "MODIFIED",
+        "REPLACED"
+};
+
+
+/*!
+ * \brief Entity of a drawing, keyed by its handle.
+ */
+typedef struct
+dxf_diff_entry_struct
+{
+        int id_code;
+                /*!< Handle of the entity. */
+        size_t index;
+                /*!< Index of the entity in the file order vector. */
+        uint64_t hash;
+                /*!< Hash of the entity as written. */
+} DxfDiffEntry;
+
+
+/*!
+ * \brief Range of entries hashed by a thread.
+ */
+typedef struct
+dxf_diff_hash_job_struct
+{
+        DxfEntities *entities;
+                /*!< The entities container. */
+        DxfDiffEntry *entries;
+                /*!< The entries of the entities. */
+        size_t first;
+                /*!< Index of the first entry. */
+        size_t last;
+                /*!< Index after the last entry. */
+        DxfMemoryWriter writer;
+                /*!< Writer of the entities of the job. */
+        int result;
+                /*!< \c EXIT_SUCCESS, or \c EXIT_FAILURE when one or
+                 * more entities could not be written. */
+} DxfDiffHashJob;
+
+
+/*!
+ * \brief Open a memory writer writing real values with all their
+ * significant digits.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_diff_writer_open
+(
+        DxfMemoryWriter *writer,
+                /*!< the memory writer. */
+        int acad_version_number
+                /*!< AutoCAD version number. */
+)
+{
+        if (dxf_memory_writer_open (writer, acad_version_number) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        writer->file.exact_reals = 1;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write an entity into a copy of its text.
+ *
+ * \return the text, terminated by a zero, or \c NULL when an error
+ * occurred.
+ */
+static char *
+dxf_diff_format_text
+(
+        DxfMemoryWriter *writer,
+                /*!< the memory writer. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        size_t *length
+                /*!< number of characters of the text. */
+)
+{
+        char *text;
+
+        if (dxf_memory_writer_write_entity (writer, entity) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not write the entity with handle %x.\n")),
+                  __FUNCTION__, dxf_entity_get_id_code (entity));
+                return (NULL);
+        }
+        if ((text = dxf_malloc (writer->length + 1)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the text of an entity.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (text, writer->buffer, writer->length);
+        text[writer->length] = '\0';
+        *length = writer->length;
+        return (text);
+}
+
+
+/*!
+ * \brief Split text into lines, in place.
+ *
+ * The line ends are replaced by zeros.
+ *
+ * \return the lines, or \c NULL when the text does not consist of
+ * whole groups or an error occurred.
+ */
+static char **
+dxf_diff_split_lines
+(
+        char *text,
+                /*!< the text, terminated by a zero. */
+        size_t length,
+                /*!< number of characters of the text. */
+        int *number_of_lines
+                /*!< number of lines. */
+)
+{
+        char **lines;
+        char *start;
+        size_t i;
+        int n = 0;
+
+        for (i = 0; i < length; i++)
+        {
+                if (text[i] == '\n')
+                {
+                        n++;
+                }
+        }
+        if ((n < 2)
+          || ((n % 2) != 0)
+          || (text[length - 1] != '\n'))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the text of an entity does not consist of groups.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((lines = dxf_malloc (n * sizeof (char *))) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the lines of an entity.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        n = 0;
+        start = text;
+        for (i = 0; i < length; i++)
+        {
+                if (text[i] == '\n')
+                {
+                        text[i] = '\0';
+                        lines[n++] = start;
+                        start = text + i + 1;
+                }
+        }
+        *number_of_lines = n;
+        return (lines);
+}
+
+
+/*!
+ * \brief Compare entities by handle, for \c qsort () and
+ * \c bsearch ().
+ */
+static int
+dxf_diff_entry_compare
+(
+        const void *a,
+        const void *b
+)
+{
+        int id_code_a = ((const DxfDiffEntry *) a)->id_code;
+        int id_code_b = ((const DxfDiffEntry *) b)->id_code;
+
+        return ((id_code_a > id_code_b) - (id_code_a < id_code_b));
+}
+
+
+/*!
+ * \brief Collect the entities of a container with a handle, sorted by
+ * handle.
+ *
+ * Entities with \c DXF_ENTITY_FLAG_ERASED set are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a handle
+ * is used more than once or an error occurred.
+ */
+static int
+dxf_diff_collect
+(
+        DxfEntities *entities,
+                /*!< the entities container, or \c NULL. */
+        DxfDiffEntry **entries,
+                /*!< the entries, free with dxf_free (). */
+        size_t *number_of_entries,
+                /*!< number of entries. */
+        size_t *number_without_handle
+                /*!< number of entities without a handle. */
+)
+{
+        void *entity;
+        size_t i;
+        size_t n = 0;
+        int result = EXIT_SUCCESS;
+
+        *entries = NULL;
+        *number_of_entries = 0;
+        *number_without_handle = 0;
+        if ((entities == NULL) || (entities->number_of_entities == 0))
+        {
+                return (EXIT_SUCCESS);
+        }
+        *entries = dxf_malloc (entities->number_of_entities * sizeof (DxfDiffEntry));
+        if (*entries == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the entities.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < entities->number_of_entities; i++)
+        {
+                entity = entities->entities[i];
+                if (DXF_ENTITY_HEADER (entity)->flags & DXF_ENTITY_FLAG_ERASED)
+                {
+                        continue;
+                }
+                if (dxf_entity_get_id_code (entity) == 0)
+                {
+                        (*number_without_handle)++;
+                        continue;
+                }
+                (*entries)[n].id_code = dxf_entity_get_id_code (entity);
+                (*entries)[n].index = i;
+                (*entries)[n].hash = 0;
+                n++;
+        }
+        qsort (*entries, n, sizeof (DxfDiffEntry), dxf_diff_entry_compare);
+        for (i = 1; i < n; i++)
+        {
+                if ((*entries)[i].id_code == (*entries)[i - 1].id_code)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () the handle %x is used more than once.\n")),
+                          __FUNCTION__, (*entries)[i].id_code);
+                        result = EXIT_FAILURE;
+                }
+        }
+        *number_of_entries = n;
+        return (result);
+}
+
+
+/*!
+ * \brief Hash a range of entries, run on a thread of
+ * \c dxf_diff_hash ().
+ */
+static void *
+dxf_diff_run_hash_job
+(
+        void *data
+                /*!< the job. */
+)
+{
+        DxfDiffHashJob *job = (DxfDiffHashJob *) data;
+        DxfDiffEntry *entry;
+        size_t i;
+
+        job->result = EXIT_SUCCESS;
+        for (i = job->first; i < job->last; i++)
+        {
+                entry = &job->entries[i];
+                if (dxf_memory_writer_write_entity (&job->writer, job->entities->entities[entry->index]) != EXIT_SUCCESS)
+                {
+                        job->result = EXIT_FAILURE;
+                        continue;
+                }
+                entry->hash = dxf_hash64 (job->writer.buffer, job->writer.length, 0);
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Hash the entities of the entries, on several threads.
+ *
+ * The entities are written on the calling thread only when the C
+ * library allocator is not in use, or when there are few entities.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an entity
+ * could not be written or an error occurred.
+ */
+static int
+dxf_diff_hash
+(
+        DxfEntities *entities,
+                /*!< the entities container. */
+        DxfDiffEntry *entries,
+                /*!< the entries. */
+        size_t number_of_entries,
+                /*!< number of entries. */
+        int acad_version_number,
+                /*!< AutoCAD version number. */
+        int number_of_threads
+                /*!< number of threads, or 0 for the number of online
+                 * processors. */
+)
+{
+        DxfDiffHashJob jobs[DXF_DIFF_MAX_THREADS];
+        pthread_t threads[DXF_DIFF_MAX_THREADS];
+        int started[DXF_DIFF_MAX_THREADS];
+        size_t first;
+        int result = EXIT_SUCCESS;
+        int k;
+
+        if (number_of_entries == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        if (number_of_threads > DXF_DIFF_MAX_THREADS)
+        {
+                number_of_threads = DXF_DIFF_MAX_THREADS;
+        }
+        if ((size_t) number_of_threads > number_of_entries / DXF_DIFF_MIN_ENTITIES_PER_THREAD)
+        {
+                number_of_threads = (int) (number_of_entries / DXF_DIFF_MIN_ENTITIES_PER_THREAD);
+        }
+        if ((number_of_threads < 1)
+          || (!dxf_allocator_is_system ()))
+        {
+                number_of_threads = 1;
+        }
+        memset (jobs, 0, sizeof (jobs));
+        for (k = 0; k < number_of_threads; k++)
+        {
+                if (dxf_diff_writer_open (&jobs[k].writer, acad_version_number) != EXIT_SUCCESS)
+                {
+                        dxf_memory_writer_close (&jobs[k].writer);
+                        number_of_threads = k;
+                        break;
+                }
+        }
+        first = 0;
+        for (k = 0; k < number_of_threads; k++)
+        {
+                jobs[k].entities = entities;
+                jobs[k].entries = entries;
+                jobs[k].first = first;
+                jobs[k].last = first + (number_of_entries - first) / (number_of_threads - k);
+                first = jobs[k].last;
+        }
+        for (k = 1; k < number_of_threads; k++)
+        {
+                started[k] = (pthread_create (&threads[k], NULL, dxf_diff_run_hash_job, &jobs[k]) == 0);
+        }
+        if (number_of_threads > 0)
+        {
+                dxf_diff_run_hash_job (&jobs[0]);
+                result = jobs[0].result;
+        }
+        else
+        {
+                result = EXIT_FAILURE;
+        }
+        for (k = 1; k < number_of_threads; k++)
+        {
+                if (started[k])
+                {
+                        pthread_join (threads[k], NULL);
+                }
+                else
+                {
+                        dxf_diff_run_hash_job (&jobs[k]);
+                }
+                if (jobs[k].result != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        for (k = 0; k < number_of_threads; k++)
+        {
+                dxf_memory_writer_close (&jobs[k].writer);
+        }
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not write all entities.\n")),
+                  __FUNCTION__);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Append a change to a diff.
+ *
+ * \return a pointer to the zeroed change, or \c NULL when an error
+ * occurred.
+ */
+static DxfDiffChange *
+dxf_diff_append
+(
+        DxfDiff *diff,
+                /*!< the diff. */
+        DxfDiffOperation operation,
+                /*!< kind of change. */
+        int id_code
+                /*!< handle of the entity. */
+)
+{
+        DxfDiffChange *changes;
+        DxfDiffChange *change;
+        size_t capacity;
+
+        if (diff->number_of_changes == diff->capacity)
+        {
+                capacity = (diff->capacity == 0)
+                  ? DXF_DIFF_MIN_CAPACITY
+                  : 2 * diff->capacity;
+                changes = dxf_realloc (diff->changes, capacity * sizeof (DxfDiffChange));
+                if (changes == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for the changes.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                diff->changes = changes;
+                diff->capacity = capacity;
+        }
+        change = &diff->changes[diff->number_of_changes++];
+        memset (change, 0, sizeof (DxfDiffChange));
+        change->operation = operation;
+        change->id_code = id_code;
+        return (change);
+}
+
+
+/*!
+ * \brief Count the groups of which the value differs, between two
+ * entities with the same groups in the same order.
+ *
+ * \return the number of groups, or -1 when the groups differ.
+ */
+static int
+dxf_diff_count_values
+(
+        char **old_lines,
+                /*!< the lines of the old entity. */
+        int old_number_of_lines,
+                /*!< number of lines of the old entity. */
+        char **new_lines,
+                /*!< the lines of the new entity. */
+        int new_number_of_lines
+                /*!< number of lines of the new entity. */
+)
+{
+        int n = 0;
+        int k;
+
+        if ((old_number_of_lines != new_number_of_lines)
+          || (strcmp (old_lines[1], new_lines[1]) != 0))
+        {
+                return (-1);
+        }
+        for (k = 0; k < new_number_of_lines; k += 2)
+        {
+                if (strcmp (old_lines[k], new_lines[k]) != 0)
+                {
+                        return (-1);
+                }
+                if (strcmp (old_lines[k + 1], new_lines[k + 1]) != 0)
+                {
+                        n++;
+                }
+        }
+        return (n);
+}
+
+
+/*!
+ * \brief Record the changed groups of an entity.
+ *
+ * Entities with the same groups in the same order are recorded as
+ * modified, with the new values of the changed groups, other entities
+ * as replaced.\n
+ * The change takes ownership of \c new_text.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_diff_compare
+(
+        DxfDiffChange *change,
+                /*!< the change. */
+        char *old_text,
+                /*!< the text of the old entity, it is split in place. */
+        size_t old_length,
+                /*!< number of characters of \c old_text. */
+        char *new_text,
+                /*!< the text of the new entity. */
+        size_t new_length
+                /*!< number of characters of \c new_text. */
+)
+{
+        DxfDiffGroup *group;
+        char *new_copy;
+        char **old_lines = NULL;
+        char **new_lines = NULL;
+        int old_number_of_lines = 0;
+        int new_number_of_lines = 0;
+        int n = -1;
+        int k;
+
+        change->operation = DXF_DIFF_REPLACED;
+        change->text = new_text;
+        change->text_length = new_length;
+        if ((new_copy = dxf_malloc (new_length + 1)) != NULL)
+        {
+                memcpy (new_copy, new_text, new_length + 1);
+                old_lines = dxf_diff_split_lines (old_text, old_length, &old_number_of_lines);
+                new_lines = dxf_diff_split_lines (new_copy, new_length, &new_number_of_lines);
+        }
+        if ((old_lines == NULL) || (new_lines == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not compare the entity with handle %x.\n")),
+                  __FUNCTION__, change->id_code);
+                dxf_free (old_lines);
+                dxf_free (new_lines);
+                dxf_free (new_copy);
+                return (EXIT_FAILURE);
+        }
+        n = dxf_diff_count_values (old_lines, old_number_of_lines,
+          new_lines, new_number_of_lines);
+        if ((n > 0)
+          && ((change->groups = dxf_malloc (n * sizeof (DxfDiffGroup))) != NULL))
+        {
+                for (k = 0; k < new_number_of_lines; k += 2)
+                {
+                        if (strcmp (old_lines[k + 1], new_lines[k + 1]) != 0)
+                        {
+                                group = &change->groups[change->number_of_groups++];
+                                group->index = k / 2;
+                                group->group_code = atoi (new_lines[k]);
+                                group->value = dxf_strdup (new_lines[k + 1]);
+                        }
+                }
+                change->operation = DXF_DIFF_MODIFIED;
+                change->text = NULL;
+                change->text_length = 0;
+                dxf_free (new_text);
+        }
+        dxf_free (old_lines);
+        dxf_free (new_lines);
+        dxf_free (new_copy);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read an entity from the lines of its text.
+ *
+ * The entity has to be written exactly as the lines, its text hashes to
+ * \c hash.
+ *
+ * \return a pointer to the entity, or \c NULL when the entity can not
+ * be read from the lines or an error occurred.
+ */
+static void *
+dxf_diff_read_entity
+(
+        DxfMemoryWriter *writer,
+                /*!< the memory writer of the AutoCAD version of the diff. */
+        char **lines,
+                /*!< the lines of the text of the entity. */
+        int number_of_lines,
+                /*!< number of lines. */
+        int id_code,
+                /*!< handle of the entity. */
+        uint64_t hash
+                /*!< hash of the text of the entity. */
+)
+{
+        const DxfEntityVtable *vtable;
+        DxfEntityType type;
+        DxfFile file;
+        FILE *stream;
+        char *buffer = NULL;
+        size_t size = 0;
+        void *entity;
+        int k;
+
+        type = dxf_tracing_entity_type (lines[1]);
+        vtable = dxf_entity_get_vtable (type);
+        if ((atoi (lines[0]) != 0)
+          || (type == UNKNOWN_ENTITY)
+          || (vtable == NULL)
+          || (vtable->read == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the %s entity with handle %x can not be read from a patch.\n")),
+                  __FUNCTION__, lines[1], id_code);
+                return (NULL);
+        }
+        for (k = 2; k < number_of_lines; k += 2)
+        {
+                if (atoi (lines[k]) == 0)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () the %s entity with handle %x is written with the entities following it, it can not be read from a patch.\n")),
+                          __FUNCTION__, lines[1], id_code);
+                        return (NULL);
+                }
+        }
+        /* The reader starts after the name of the entity and stops at
+         * the next 0 group. */
+        if ((stream = open_memstream (&buffer, &size)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the text of an entity.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (k = 2; k < number_of_lines; k++)
+        {
+                fprintf (stream, "%s\n", lines[k]);
+        }
+        fprintf (stream, "  0\nENDSEC\n");
+        fclose (stream);
+        memset (&file, 0, sizeof (DxfFile));
+        file.filename = (char *) "";
+        file.acad_version_number = writer->file.acad_version_number;
+        file.fp = fmemopen (buffer, size, "r");
+        entity = vtable->init (vtable->create ());
+        if ((file.fp == NULL) || (entity == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the %s entity with handle %x.\n")),
+                  __FUNCTION__, lines[1], id_code);
+                if (file.fp != NULL)
+                {
+                        fclose (file.fp);
+                }
+                if (entity != NULL)
+                {
+                        vtable->free (entity);
+                }
+                free (buffer);
+                return (NULL);
+        }
+        if (vtable->read (&file, entity) == NULL)
+        {
+                /* The readers close the file on a read error. */
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not read the %s entity with handle %x from a patch.\n")),
+                  __FUNCTION__, lines[1], id_code);
+                vtable->free (entity);
+                free (buffer);
+                return (NULL);
+        }
+        fclose (file.fp);
+        free (buffer);
+        if ((dxf_memory_writer_write_entity (writer, entity) != EXIT_SUCCESS)
+          || (dxf_hash64 (writer->buffer, writer->length, 0) != hash))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the %s entity with handle %x is not written as it was read from a patch.\n")),
+                  __FUNCTION__, lines[1], id_code);
+                vtable->free (entity);
+                return (NULL);
+        }
+        return (entity);
+}
+
+
+/*!
+ * \brief Make the entity of a change, to add to a drawing or to replace
+ * an entity of a drawing.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred.
+ */
+static void *
+dxf_diff_make_entity
+(
+        DxfMemoryWriter *writer,
+                /*!< the memory writer of the AutoCAD version of the diff. */
+        DxfDiffChange *change,
+                /*!< the change. */
+        void *old_entity
+                /*!< the entity of the drawing with the handle of the
+                 * change, or \c NULL. */
+)
+{
+        DxfDiffGroup *group;
+        char *text;
+        char **lines;
+        size_t length;
+        int number_of_lines;
+        void *entity = NULL;
+        int k;
+
+        if (change->operation == DXF_DIFF_MODIFIED)
+        {
+                text = dxf_diff_format_text (writer, old_entity, &length);
+        }
+        else
+        {
+                length = change->text_length;
+                if ((text = dxf_malloc (length + 1)) != NULL)
+                {
+                        memcpy (text, change->text, length);
+                        text[length] = '\0';
+                }
+        }
+        if (text == NULL)
+        {
+                return (NULL);
+        }
+        if ((lines = dxf_diff_split_lines (text, length, &number_of_lines)) == NULL)
+        {
+                dxf_free (text);
+                return (NULL);
+        }
+        for (k = 0; k < change->number_of_groups; k++)
+        {
+                group = &change->groups[k];
+                if ((group->index <= 0)
+                  || (2 * group->index >= number_of_lines)
+                  || (atoi (lines[2 * group->index]) != group->group_code))
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () group %d of the entity with handle %x does not match the patch.\n")),
+                          __FUNCTION__, group->index, change->id_code);
+                        break;
+                }
+                lines[2 * group->index + 1] = group->value;
+        }
+        if (k == change->number_of_groups)
+        {
+                entity = dxf_diff_read_entity (writer, lines, number_of_lines,
+                  change->id_code, change->new_hash);
+        }
+        dxf_free (lines);
+        dxf_free (text);
+        return (entity);
+}
+
+
+/*!
+ * \brief Check that the entity of a change can be made from the
+ * change, as \c dxf_diff_apply () makes it.
+ *
+ * \return \c EXIT_SUCCESS when the entity can be made, or
+ * \c EXIT_FAILURE when it can not be read back or an error occurred.
+ */
+static int
+dxf_diff_check_change
+(
+        DxfMemoryWriter *writer,
+                /*!< the memory writer of the AutoCAD version of the diff. */
+        DxfDiffChange *change,
+                /*!< the change. */
+        void *old_entity
+                /*!< the entity of the old drawing with the handle of
+                 * the change, or \c NULL. */
+)
+{
+        void *entity;
+
+        entity = dxf_diff_make_entity (writer, change, old_entity);
+        if (entity == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the entity with handle %x can not be read back, a patch would not apply.\n")),
+                  __FUNCTION__, change->id_code);
+                return (EXIT_FAILURE);
+        }
+        dxf_entity_free (entity);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfDiff.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return a pointer to the diff, or \c NULL when an error occurred.
+ */
+DxfDiff *
+dxf_diff_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDiff *diff = NULL;
+        size_t size;
+
+        size = sizeof (DxfDiff);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((diff = dxf_malloc (size)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfDiff struct.\n")),
+                  __FUNCTION__);
+                diff = NULL;
+        }
+        else
+        {
+                memset (diff, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diff);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfDiff and all its changes.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diff_free
+(
+        DxfDiff *diff
+                /*!< a pointer to the diff. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDiffChange *change;
+        size_t i;
+        int k;
+
+        /* Do some basic checks. */
+        if (diff == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < diff->number_of_changes; i++)
+        {
+                change = &diff->changes[i];
+                dxf_free (change->text);
+                for (k = 0; k < change->number_of_groups; k++)
+                {
+                        dxf_free (change->groups[k].value);
+                }
+                dxf_free (change->groups);
+        }
+        dxf_free (diff->changes);
+        dxf_free (diff);
+        diff = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the differences between the entities of two drawings.
+ *
+ * The entities are aligned by handle and written as for a DXF file of
+ * \c acad_version_number, on \c number_of_threads threads.\n
+ * Every entity with a handle in both drawings of which the text differs
+ * is modified or replaced, entities with a handle in one drawing only
+ * are removed or added.\n
+ * Entities with \c DXF_ENTITY_FLAG_ERASED set are not compared.
+ *
+ * \return a pointer to the diff, with the changes in increasing order
+ * of handle, or \c NULL when an entity has no handle, a handle is used
+ * more than once, an added or changed entity can not be read back or
+ * an error occurred.
+ */
+DxfDiff *
+dxf_diff_drawings
+(
+        DxfDrawing *old_drawing,
+                /*!< a pointer to the old drawing. */
+        DxfDrawing *new_drawing,
+                /*!< a pointer to the new drawing. */
+        int acad_version_number,
+                /*!< AutoCAD version number the entities are written
+                 * for. */
+        int number_of_threads
+                /*!< number of threads hashing the entities, or 0 for
+                 * the number of online processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntities *old_entities;
+        DxfEntities *new_entities;
+        DxfDiffEntry *old_entries = NULL;
+        DxfDiffEntry *new_entries = NULL;
+        size_t number_of_old_entries = 0;
+        size_t number_of_new_entries = 0;
+        size_t old_without_handle = 0;
+        size_t new_without_handle = 0;
+        DxfMemoryWriter writer;
+        DxfDiffChange *change;
+        DxfDiff *diff = NULL;
+        char *old_text;
+        char *new_text;
+        size_t old_length;
+        size_t new_length;
+        size_t i = 0;
+        size_t j = 0;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((old_drawing == NULL) || (new_drawing == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (&writer, 0, sizeof (DxfMemoryWriter));
+        old_entities = (DxfEntities *) old_drawing->entities_list;
+        new_entities = (DxfEntities *) new_drawing->entities_list;
+        result |= dxf_diff_collect (old_entities, &old_entries,
+          &number_of_old_entries, &old_without_handle);
+        result |= dxf_diff_collect (new_entities, &new_entries,
+          &number_of_new_entries, &new_without_handle);
+        if ((old_without_handle > 0) || (new_without_handle > 0))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () %lu entities without a handle can not be aligned.\n")),
+                  __FUNCTION__, (unsigned long) (old_without_handle + new_without_handle));
+                result = EXIT_FAILURE;
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                result |= dxf_diff_hash (old_entities, old_entries,
+                  number_of_old_entries, acad_version_number, number_of_threads);
+                result |= dxf_diff_hash (new_entities, new_entries,
+                  number_of_new_entries, acad_version_number, number_of_threads);
+        }
+        if ((result == EXIT_SUCCESS)
+          && ((diff = dxf_diff_new ()) != NULL)
+          && (dxf_diff_writer_open (&writer, acad_version_number) == EXIT_SUCCESS))
+        {
+                diff->acad_version_number = acad_version_number;
+                while ((result == EXIT_SUCCESS)
+                  && ((i < number_of_old_entries) || (j < number_of_new_entries)))
+                {
+                        if ((j == number_of_new_entries)
+                          || ((i < number_of_old_entries)
+                          && (old_entries[i].id_code < new_entries[j].id_code)))
+                        {
+                                change = dxf_diff_append (diff, DXF_DIFF_REMOVED, old_entries[i].id_code);
+                                if (change == NULL)
+                                {
+                                        result = EXIT_FAILURE;
+                                        break;
+                                }
+                                change->old_hash = old_entries[i].hash;
+                                i++;
+                        }
+                        else if ((i == number_of_old_entries)
+                          || (new_entries[j].id_code < old_entries[i].id_code))
+                        {
+                                change = dxf_diff_append (diff, DXF_DIFF_ADDED, new_entries[j].id_code);
+                                if (change == NULL)
+                                {
+                                        result = EXIT_FAILURE;
+                                        break;
+                                }
+                                change->new_hash = new_entries[j].hash;
+                                change->text = dxf_diff_format_text (&writer,
+                                  new_entities->entities[new_entries[j].index],
+                                  &change->text_length);
+                                if ((change->text == NULL)
+                                  || (dxf_diff_check_change (&writer, change, NULL) != EXIT_SUCCESS))
+                                {
+                                        result = EXIT_FAILURE;
+                                }
+                                j++;
+                        }
+                        else
+                        {
+                                if (old_entries[i].hash != new_entries[j].hash)
+                                {
+                                        change = dxf_diff_append (diff, DXF_DIFF_REPLACED, new_entries[j].id_code);
+                                        old_text = dxf_diff_format_text (&writer,
+                                          old_entities->entities[old_entries[i].index], &old_length);
+                                        new_text = dxf_diff_format_text (&writer,
+                                          new_entities->entities[new_entries[j].index], &new_length);
+                                        if ((change == NULL)
+                                          || (old_text == NULL)
+                                          || (new_text == NULL))
+                                        {
+                                                dxf_free (old_text);
+                                                dxf_free (new_text);
+                                                result = EXIT_FAILURE;
+                                                break;
+                                        }
+                                        change->old_hash = old_entries[i].hash;
+                                        change->new_hash = new_entries[j].hash;
+                                        result = dxf_diff_compare (change, old_text,
+                                          old_length, new_text, new_length);
+                                        dxf_free (old_text);
+                                        if (result == EXIT_SUCCESS)
+                                        {
+                                                result = dxf_diff_check_change (&writer, change,
+                                                  old_entities->entities[old_entries[i].index]);
+                                        }
+                                }
+                                i++;
+                                j++;
+                        }
+                }
+        }
+        else
+        {
+                result = EXIT_FAILURE;
+        }
+        dxf_memory_writer_close (&writer);
+        dxf_free (old_entries);
+        dxf_free (new_entries);
+        if ((result != EXIT_SUCCESS) && (diff != NULL))
+        {
+                dxf_diff_free (diff);
+                diff = NULL;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diff);
+}
+
+
+/*!
+ * \brief Apply a diff to the entities of a drawing.
+ *
+ * Every removed, modified or replaced entity has to be in the drawing
+ * as it was in the old drawing of the diff, and an added entity can not
+ * have the handle of an entity of the drawing.\n
+ * Nothing is changed when one of the changes can not be applied.\n
+ * Modified and replaced entities keep their position in the file
+ * order, added entities are appended in order of handle.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diff_apply
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing. */
+        DxfDiff *diff
+                /*!< a pointer to the diff. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfAllocator *previous;
+        DxfEntities *entities;
+        DxfDiffEntry *entries = NULL;
+        DxfDiffEntry key;
+        DxfDiffEntry *entry;
+        DxfDiffChange *change;
+        DxfMemoryWriter writer;
+        size_t number_of_entries = 0;
+        size_t without_handle = 0;
+        size_t number_of_entities = 0;
+        size_t *change_of = NULL;
+        void **replacements = NULL;
+        void **vector;
+        void *entity;
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((drawing == NULL) || (diff == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (diff->number_of_changes == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        memset (&writer, 0, sizeof (DxfMemoryWriter));
+        previous = dxf_allocator_activate ((DxfAllocator *) drawing->allocator);
+        if (drawing->entities_list == NULL)
+        {
+                drawing->entities_list = (struct DxfEntities *) dxf_entities_new ();
+        }
+        entities = (DxfEntities *) drawing->entities_list;
+        if ((entities == NULL)
+          || (dxf_diff_writer_open (&writer, diff->acad_version_number) != EXIT_SUCCESS))
+        {
+                dxf_memory_writer_close (&writer);
+                dxf_allocator_activate (previous);
+                return (EXIT_FAILURE);
+        }
+        result |= dxf_diff_collect (entities, &entries, &number_of_entries, &without_handle);
+        replacements = dxf_malloc (diff->number_of_changes * sizeof (void *));
+        change_of = dxf_malloc ((entities->number_of_entities + 1) * sizeof (size_t));
+        if ((replacements == NULL) || (change_of == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the changes.\n")),
+                  __FUNCTION__);
+                result = EXIT_FAILURE;
+        }
+        else
+        {
+                memset (replacements, 0, diff->number_of_changes * sizeof (void *));
+                for (i = 0; i < entities->number_of_entities; i++)
+                {
+                        change_of[i] = diff->number_of_changes;
+                }
+        }
+        /* Make the new entities before anything is changed. */
+        for (i = 0; (result == EXIT_SUCCESS) && (i < diff->number_of_changes); i++)
+        {
+                change = &diff->changes[i];
+                key.id_code = change->id_code;
+                entry = bsearch (&key, entries, number_of_entries,
+                  sizeof (DxfDiffEntry), dxf_diff_entry_compare);
+                entity = (entry != NULL) ? entities->entities[entry->index] : NULL;
+                if ((change->operation == DXF_DIFF_ADDED) && (entity != NULL))
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () the added entity with handle %x is already in the drawing.\n")),
+                          __FUNCTION__, change->id_code);
+                        result = EXIT_FAILURE;
+                        break;
+                }
+                if (change->operation != DXF_DIFF_ADDED)
+                {
+                        if (entity == NULL)
+                        {
+                                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                                  (_("Error in %s () the entity with handle %x is not in the drawing.\n")),
+                                  __FUNCTION__, change->id_code);
+                                result = EXIT_FAILURE;
+                                break;
+                        }
+                        if ((dxf_memory_writer_write_entity (&writer, entity) != EXIT_SUCCESS)
+                          || (dxf_hash64 (writer.buffer, writer.length, 0) != change->old_hash))
+                        {
+                                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                                  (_("Error in %s () the entity with handle %x differs from the old entity of the patch.\n")),
+                                  __FUNCTION__, change->id_code);
+                                result = EXIT_FAILURE;
+                                break;
+                        }
+                        change_of[entry->index] = i;
+                }
+                if (change->operation != DXF_DIFF_REMOVED)
+                {
+                        replacements[i] = dxf_diff_make_entity (&writer, change, entity);
+                        if (replacements[i] == NULL)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                vector = dxf_entities_detach (entities, &number_of_entities);
+                for (i = 0; i < number_of_entities; i++)
+                {
+                        if (change_of[i] == diff->number_of_changes)
+                        {
+                                result |= dxf_entities_append (entities, vector[i]);
+                                continue;
+                        }
+                        if (replacements[change_of[i]] != NULL)
+                        {
+                                result |= dxf_entities_append (entities, replacements[change_of[i]]);
+                                replacements[change_of[i]] = NULL;
+                        }
+                        dxf_entity_free (vector[i]);
+                }
+                for (i = 0; i < diff->number_of_changes; i++)
+                {
+                        if (replacements[i] != NULL)
+                        {
+                                result |= dxf_entities_append (entities, replacements[i]);
+                                replacements[i] = NULL;
+                        }
+                }
+                dxf_free (vector);
+        }
+        else
+        {
+                for (i = 0; (replacements != NULL) && (i < diff->number_of_changes); i++)
+                {
+                        if (replacements[i] != NULL)
+                        {
+                                dxf_entity_free (replacements[i]);
+                        }
+                }
+        }
+        dxf_memory_writer_close (&writer);
+        dxf_free (entries);
+        dxf_free (change_of);
+        dxf_free (replacements);
+        dxf_allocator_activate (previous);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Write a diff to a stream, as a patch.
+ *
+ * The patch is text, starting with a line \c DXFDIFF and ending with a
+ * line \c ENDDIFF, the added and replaced entities are included as they
+ * are written to a DXF file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diff_write
+(
+        FILE *file,
+                /*!< the output stream. */
+        DxfDiff *diff
+                /*!< a pointer to the diff. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDiffChange *change;
+        size_t i;
+        int k;
+
+        /* Do some basic checks. */
+        if ((file == NULL) || (diff == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fprintf (file, "DXFDIFF\n%d\n%d\n%lu\n", DXF_DIFF_FORMAT_VERSION,
+          diff->acad_version_number, (unsigned long) diff->number_of_changes);
+        for (i = 0; i < diff->number_of_changes; i++)
+        {
+                change = &diff->changes[i];
+                fprintf (file, "%s\n%X\n%016" PRIX64 "\n%016" PRIX64 "\n",
+                  dxf_diff_operation_names[change->operation], change->id_code,
+                  change->old_hash, change->new_hash);
+                if (change->operation == DXF_DIFF_MODIFIED)
+                {
+                        fprintf (file, "%d\n", change->number_of_groups);
+                        for (k = 0; k < change->number_of_groups; k++)
+                        {
+                                fprintf (file, "%d\n%d\n%s\n",
+                                  change->groups[k].index,
+                                  change->groups[k].group_code,
+                                  change->groups[k].value);
+                        }
+                }
+                else if (change->operation != DXF_DIFF_REMOVED)
+                {
+                        fprintf (file, "%lu\n", (unsigned long) change->text_length);
+                        fwrite (change->text, 1, change->text_length, file);
+                }
+        }
+        fprintf (file, "ENDDIFF\n");
+        if (ferror (file))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not write the patch.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a line of a patch, without its line end.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE at the end of
+ * the stream.
+ */
+static int
+dxf_diff_read_line
+(
+        FILE *file,
+                /*!< the input stream. */
+        char **line,
+                /*!< the buffer of the line, allocated by
+                 * \c getline (). */
+        size_t *size
+                /*!< size of the buffer. */
+)
+{
+        ssize_t length;
+
+        if ((length = getline (line, size, file)) <= 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((*line)[length - 1] == '\n')
+        {
+                (*line)[length - 1] = '\0';
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a change of a patch.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the patch
+ * is not valid or an error occurred.
+ */
+static int
+dxf_diff_read_change
+(
+        FILE *file,
+                /*!< the input stream. */
+        DxfDiff *diff,
+                /*!< the diff. */
+        char **line,
+                /*!< the buffer of the line. */
+        size_t *size
+                /*!< size of the buffer. */
+)
+{
+        DxfDiffChange *change;
+        DxfDiffGroup *group;
+        int operation;
+        unsigned long length;
+        int number_of_groups;
+        int k;
+
+        if (dxf_diff_read_line (file, line, size) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (operation = DXF_DIFF_ADDED; operation <= DXF_DIFF_REPLACED; operation++)
+        {
+                if (strcmp (*line, dxf_diff_operation_names[operation]) == 0)
+                {
+                        break;
+                }
+        }
+        if ((operation > DXF_DIFF_REPLACED)
+          || ((change = dxf_diff_append (diff, (DxfDiffOperation) operation, 0)) == NULL)
+          || (dxf_diff_read_line (file, line, size) != EXIT_SUCCESS)
+          || (sscanf (*line, "%X", &change->id_code) != 1)
+          || (dxf_diff_read_line (file, line, size) != EXIT_SUCCESS)
+          || (sscanf (*line, "%" SCNx64, &change->old_hash) != 1)
+          || (dxf_diff_read_line (file, line, size) != EXIT_SUCCESS)
+          || (sscanf (*line, "%" SCNx64, &change->new_hash) != 1))
+        {
+                return (EXIT_FAILURE);
+        }
+        if (change->operation == DXF_DIFF_MODIFIED)
+        {
+                if ((dxf_diff_read_line (file, line, size) != EXIT_SUCCESS)
+                  || (sscanf (*line, "%d", &number_of_groups) != 1)
+                  || (number_of_groups < 0)
+                  || ((change->groups = dxf_malloc ((number_of_groups + 1) * sizeof (DxfDiffGroup))) == NULL))
+                {
+                        return (EXIT_FAILURE);
+                }
+                for (k = 0; k < number_of_groups; k++)
+                {
+                        group = &change->groups[k];
+                        if ((dxf_diff_read_line (file, line, size) != EXIT_SUCCESS)
+                          || (sscanf (*line, "%d", &group->index) != 1)
+                          || (dxf_diff_read_line (file, line, size) != EXIT_SUCCESS)
+                          || (sscanf (*line, "%d", &group->group_code) != 1)
+                          || (dxf_diff_read_line (file, line, size) != EXIT_SUCCESS))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        group->value = dxf_strdup (*line);
+                        change->number_of_groups++;
+                }
+        }
+        else if (change->operation != DXF_DIFF_REMOVED)
+        {
+                if ((dxf_diff_read_line (file, line, size) != EXIT_SUCCESS)
+                  || (sscanf (*line, "%lu", &length) != 1)
+                  || ((change->text = dxf_malloc (length + 1)) == NULL)
+                  || (fread (change->text, 1, length, file) != length))
+                {
+                        return (EXIT_FAILURE);
+                }
+                change->text[length] = '\0';
+                change->text_length = (size_t) length;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a patch written by dxf_diff_write () from a stream.
+ *
+ * \return a pointer to the diff, or \c NULL when the patch is not valid
+ * or an error occurred.
+ */
+DxfDiff *
+dxf_diff_read
+(
+        FILE *file
+                /*!< the input stream. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDiff *diff;
+        char *line = NULL;
+        size_t size = 0;
+        unsigned long number_of_changes = 0;
+        unsigned long i;
+        int version = 0;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (file == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((diff = dxf_diff_new ()) == NULL)
+        {
+                return (NULL);
+        }
+        if ((dxf_diff_read_line (file, &line, &size) != EXIT_SUCCESS)
+          || (strcmp (line, "DXFDIFF") != 0)
+          || (dxf_diff_read_line (file, &line, &size) != EXIT_SUCCESS)
+          || (sscanf (line, "%d", &version) != 1)
+          || (version != DXF_DIFF_FORMAT_VERSION)
+          || (dxf_diff_read_line (file, &line, &size) != EXIT_SUCCESS)
+          || (sscanf (line, "%d", &diff->acad_version_number) != 1)
+          || (dxf_diff_read_line (file, &line, &size) != EXIT_SUCCESS)
+          || (sscanf (line, "%lu", &number_of_changes) != 1))
+        {
+                result = EXIT_FAILURE;
+        }
+        for (i = 0; (result == EXIT_SUCCESS) && (i < number_of_changes); i++)
+        {
+                result = dxf_diff_read_change (file, diff, &line, &size);
+        }
+        if ((result == EXIT_SUCCESS)
+          && ((dxf_diff_read_line (file, &line, &size) != EXIT_SUCCESS)
+          || (strcmp (line, "ENDDIFF") != 0)))
+        {
+                result = EXIT_FAILURE;
+        }
+        /* The line was allocated by getline () with malloc (). */
+        free (line);
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the patch is not valid after %lu changes.\n")),
+                  __FUNCTION__, (unsigned long) diff->number_of_changes);
+                dxf_diff_free (diff);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diff);
+}
+
+
+/*!
+ * \brief Get the number of changes of a diff.
+ *
+ * \return the number of changes.
+ */
+size_t
+dxf_diff_get_number_of_changes
+(
+        DxfDiff *diff
+                /*!< a pointer to the diff. */
+)
+{
+        if (diff == NULL)
+        {
+                return (0);
+        }
+        return (diff->number_of_changes);
+}
+
+
+/*!
+ * \brief Get a change of a diff.
+ *
+ * \return a pointer to the change, or \c NULL when the index is out of
+ * range.
+ */
+DxfDiffChange *
+dxf_diff_get_change
+(
+        DxfDiff *diff,
+                /*!< a pointer to the diff. */
+        size_t index
+                /*!< index of the change. */
+)
+{
+        if ((diff == NULL) || (index >= diff->number_of_changes))
+        {
+                return (NULL);
+        }
+        return (&diff->changes[index]);
+}
+
+
+/* EOF */
@@ -0,0 +1,148 @@
+/*!
+ * \file diff.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF differences between the entities of two
+ * drawings, and patches applying them.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_DIFF_H
+#define LIBDXF_SRC_DIFF_H
+
+
+#include "global.h"
+#include "drawing.h"
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Kind of change of an entity.
+ */
+typedef enum
+dxf_diff_operation
+{
+        DXF_DIFF_ADDED,
+                /*!< The entity is only in the new drawing. */
+        DXF_DIFF_REMOVED,
+                /*!< The entity is only in the old drawing. */
+        DXF_DIFF_MODIFIED,
+                /*!< The values of some groups of the entity changed. */
+        DXF_DIFF_REPLACED
+                /*!< The groups of the entity changed, the entity is
+                 * replaced as a whole. */
+} DxfDiffOperation;
+
+
+/*!
+ * \brief New value of a group of a modified entity.
+ */
+typedef struct
+dxf_diff_group_struct
+{
+        int index;
+                /*!< Index of the group in the entity as it is written,
+                 * the name of the entity is group 0. */
+        int group_code;
+                /*!< Group code of the group. */
+        char *value;
+                /*!< New value of the group. */
+} DxfDiffGroup;
+
+
+/*!
+ * \brief Change of an entity, keyed by its handle.
+ */
+typedef struct
+dxf_diff_change_struct
+{
+        DxfDiffOperation operation;
+                /*!< Kind of change. */
+        int id_code;
+                /*!< Handle of the entity (group code 5). */
+        uint64_t old_hash;
+                /*!< Hash of the entity as written from the old drawing,
+                 * 0 for an added entity. */
+        uint64_t new_hash;
+                /*!< Hash of the entity as written from the new drawing,
+                 * 0 for a removed entity. */
+        char *text;
+                /*!< The entity as written from the new drawing, for an
+                 * added or replaced entity, otherwise \c NULL. */
+        size_t text_length;
+                /*!< Number of characters in \c text. */
+        DxfDiffGroup *groups;
+                /*!< Changed groups of a modified entity, in increasing
+                 * order of index, otherwise \c NULL. */
+        int number_of_groups;
+                /*!< Number of changed groups. */
+} DxfDiffChange;
+
+
+/*!
+ * \brief Differences between the entities of two drawings.
+ */
+typedef struct
+dxf_diff_struct
+{
+        int acad_version_number;
+                /*!< AutoCAD version the entities were written for. */
+        DxfDiffChange *changes;
+                /*!< The changes, in increasing order of handle. */
+        size_t number_of_changes;
+                /*!< Number of changes. */
+        size_t capacity;
+                /*!< Number of allocated changes. */
+} DxfDiff;
+
+
+DxfDiff *dxf_diff_new ();
+int dxf_diff_free (DxfDiff *diff);
+DxfDiff *dxf_diff_drawings (DxfDrawing *old_drawing, DxfDrawing *new_drawing, int acad_version_number, int number_of_threads);
+int dxf_diff_apply (DxfDrawing *drawing, DxfDiff *diff);
+int dxf_diff_write (FILE *file, DxfDiff *diff);
+DxfDiff *dxf_diff_read (FILE *file);
+size_t dxf_diff_get_number_of_changes (DxfDiff *diff);
+DxfDiffChange *dxf_diff_get_change (DxfDiff *diff, size_t index);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_DIFF_H */
+
+
+/* EOF */
@@ -41,6 +41,7 @@
 
 
 #include "dimension.h"
+#include "util.h"
 
 
 /*!
@@ -63,9 +64,9 @@ dxf_dimension_new ()
         size = sizeof (DxfDimension);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dimension = malloc (size)) == NULL)
+        if ((dimension = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfDimension struct.\n")),
                   __FUNCTION__);
                 dimension = NULL;
@@ -73,6 +74,7 @@ dxf_dimension_new ()
         else
         {
                 memset (dimension, 0, size);
+                dimension->header.type = DIMENSION;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -102,32 +104,39 @@ dxf_dimension_init
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dimension = dxf_dimension_new ();
         }
         if (dimension == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfDimension struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_dimension_set_id_code (dimension, 0);
-        dxf_dimension_set_linetype (dimension, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_dimension_set_layer (dimension, strdup (DXF_DEFAULT_LAYER));
+        dxf_dimension_set_linetype (dimension, dxf_strdup (DXF_DEFAULT_LINETYPE));
+        dxf_dimension_set_layer (dimension, dxf_strdup (DXF_DEFAULT_LAYER));
         dxf_dimension_set_elevation (dimension, 0.0);
         dxf_dimension_set_thickness (dimension, 0.0);
         dxf_dimension_set_linetype_scale (dimension, DXF_DEFAULT_LINETYPE_SCALE);
         dxf_dimension_set_visibility (dimension, DXF_DEFAULT_VISIBILITY);
         dxf_dimension_set_color (dimension, DXF_COLOR_BYLAYER);
         dxf_dimension_set_paperspace (dimension, DXF_PAPERSPACE);
-        dxf_dimension_set_dictionary_owner_soft (dimension, strdup (""));
-        dxf_dimension_set_dictionary_owner_hard (dimension, strdup (""));
-        dxf_dimension_set_dim_text (dimension, strdup (""));
-        dxf_dimension_set_dimblock_name (dimension, strdup (""));
-        dxf_dimension_set_dimstyle_name (dimension, strdup (""));
+        dxf_dimension_set_dictionary_owner_soft (dimension, dxf_strdup (""));
+        dxf_dimension_set_dictionary_owner_hard (dimension, dxf_strdup (""));
+        dxf_dimension_set_dim_text (dimension, dxf_strdup (""));
+        dxf_dimension_set_dimblock_name (dimension, dxf_strdup (""));
+        dxf_dimension_set_dimstyle_name (dimension, dxf_strdup (""));
+        dimension->p0 = dxf_point_init (dxf_point_new ());
+        dimension->p1 = dxf_point_init (dxf_point_new ());
+        dimension->p2 = dxf_point_init (dxf_point_new ());
+        dimension->p3 = dxf_point_init (dxf_point_new ());
+        dimension->p4 = dxf_point_init (dxf_point_new ());
+        dimension->p5 = dxf_point_init (dxf_point_new ());
+        dimension->p6 = dxf_point_init (dxf_point_new ());
         dxf_dimension_set_x0 (dimension, 0.0);
         dxf_dimension_set_y0 (dimension, 0.0);
         dxf_dimension_set_z0 (dimension, 0.0);
@@ -193,38 +202,34 @@ dxf_dimension_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dimension = dxf_dimension_new ();
                 dimension = dxf_dimension_init (dimension);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -232,23 +237,23 @@ dxf_dimension_read
                         /* Now follows a string containing a dimension
                          * text string. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->dim_text);
+                        dxf_read_string (fp, &dimension->dim_text);
                 }
-                if (strcmp (temp_string, "2") == 0)
+                else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a dimension
                          * block name string. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->dimblock_name);
+                        dxf_read_string (fp, &dimension->dimblock_name);
                 }
-                if (strcmp (temp_string, "3") == 0)
+                else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a dimension
                          * style name string. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->dimstyle_name);
+                        dxf_read_string (fp, &dimension->dimstyle_name);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -260,13 +265,13 @@ dxf_dimension_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->linetype);
+                        dxf_read_string (fp, &dimension->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->layer);
+                        dxf_read_string (fp, &dimension->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -562,7 +567,7 @@ dxf_dimension_read
                           && (strcmp (temp_string, "AcDbRadialDimension") != 0)
                           && (strcmp (temp_string, "AcDbOrdinateDimension") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -593,14 +598,14 @@ dxf_dimension_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->dictionary_owner_soft);
+                        dxf_read_string (fp, &dimension->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimension->dictionary_owner_hard);
+                        dxf_read_string (fp, &dimension->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -611,22 +616,26 @@ dxf_dimension_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_dimension_get_linetype (dimension), "") == 0)
         {
-                dxf_dimension_set_linetype (dimension, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_dimension_set_linetype (dimension, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_dimension_get_layer (dimension), "") == 0)
         {
-                dxf_dimension_set_layer (dimension, strdup (DXF_DEFAULT_LAYER));
+                dxf_dimension_set_layer (dimension, dxf_strdup (DXF_DEFAULT_LAYER));
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -653,46 +662,46 @@ dxf_dimension_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DIMENSION");
+        char *dxf_entity_name = dxf_strdup ("DIMENSION");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((dxf_dimension_get_flag (dimension) > 6)
           || (dxf_dimension_get_flag (dimension) < 0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range flag value was detected.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_dimension_get_layer (dimension), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_dimension_get_id_code (dimension));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                dxf_dimension_set_layer (dimension, strdup (DXF_DEFAULT_LAYER));
+                dxf_dimension_set_layer (dimension, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -743,7 +752,7 @@ dxf_dimension_write
         }
         if (dxf_dimension_get_linetype_scale (dimension) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_dimension_get_linetype_scale (dimension));
+                dxf_write_real (fp, 48, dxf_dimension_get_linetype_scale (dimension));
         }
         if (dxf_dimension_get_visibility (dimension) != 0)
         {
@@ -754,26 +763,26 @@ dxf_dimension_write
                 fprintf (fp->fp, "100\nAcDbDimension\n");
         }
         fprintf (fp->fp, "  2\n%s\n", dxf_dimension_get_dimblock_name (dimension));
-        fprintf (fp->fp, " 10\n%f\n", dxf_dimension_get_x0 (dimension));
-        fprintf (fp->fp, " 20\n%f\n", dxf_dimension_get_y0 (dimension));
-        fprintf (fp->fp, " 30\n%f\n", dxf_dimension_get_z0 (dimension));
-        fprintf (fp->fp, " 11\n%f\n", dxf_dimension_get_x1 (dimension));
-        fprintf (fp->fp, " 21\n%f\n", dxf_dimension_get_y1 (dimension));
-        fprintf (fp->fp, " 31\n%f\n", dxf_dimension_get_z1 (dimension));
+        dxf_write_real (fp, 10, dxf_dimension_get_x0 (dimension));
+        dxf_write_real (fp, 20, dxf_dimension_get_y0 (dimension));
+        dxf_write_real (fp, 30, dxf_dimension_get_z0 (dimension));
+        dxf_write_real (fp, 11, dxf_dimension_get_x1 (dimension));
+        dxf_write_real (fp, 21, dxf_dimension_get_y1 (dimension));
+        dxf_write_real (fp, 31, dxf_dimension_get_z1 (dimension));
         fprintf (fp->fp, " 70\n%d\n", dxf_dimension_get_flag (dimension));
         if (fp->acad_version_number >= AutoCAD_2000)
         {
                 fprintf (fp->fp, " 71\n%d\n", dxf_dimension_get_attachment_point (dimension));
                 fprintf (fp->fp, " 72\n%d\n", dxf_dimension_get_text_line_spacing (dimension));
-                fprintf (fp->fp, " 41\n%f\n", dxf_dimension_get_text_line_spacing_factor (dimension));
-                fprintf (fp->fp, " 42\n%f\n", dxf_dimension_get_actual_measurement (dimension));
+                dxf_write_real (fp, 41, dxf_dimension_get_text_line_spacing_factor (dimension));
+                dxf_write_real (fp, 42, dxf_dimension_get_actual_measurement (dimension));
         }
         fprintf (fp->fp, "  1\n%s\n", dxf_dimension_get_dim_text (dimension));
-        fprintf (fp->fp, " 53\n%f\n", dxf_dimension_get_text_angle (dimension));
-        fprintf (fp->fp, " 51\n%f\n", dxf_dimension_get_hor_dir (dimension));
-        fprintf (fp->fp, "210\n%fn", dxf_dimension_get_extr_x0 (dimension));
-        fprintf (fp->fp, "220\n%fn", dxf_dimension_get_extr_y0 (dimension));
-        fprintf (fp->fp, "230\n%fn", dxf_dimension_get_extr_z0 (dimension));
+        dxf_write_real (fp, 53, dxf_dimension_get_text_angle (dimension));
+        dxf_write_real (fp, 51, dxf_dimension_get_hor_dir (dimension));
+        dxf_write_real (fp, 210, dxf_dimension_get_extr_x0 (dimension));
+        dxf_write_real (fp, 220, dxf_dimension_get_extr_y0 (dimension));
+        dxf_write_real (fp, 230, dxf_dimension_get_extr_z0 (dimension));
         fprintf (fp->fp, "  3\n%s\n", dxf_dimension_get_dimstyle_name (dimension));
         /* Rotated, horizontal, or vertical dimension. */
         if (dxf_dimension_get_flag (dimension) == 0)
@@ -782,17 +791,17 @@ dxf_dimension_write
                 {
                         fprintf (fp->fp, "100\nAcDbAlignedDimension\n");
                 }
-                fprintf (fp->fp, " 12\n%f\n", dxf_dimension_get_x2 (dimension));
-                fprintf (fp->fp, " 22\n%f\n", dxf_dimension_get_y2 (dimension));
-                fprintf (fp->fp, " 32\n%f\n", dxf_dimension_get_z2 (dimension));
-                fprintf (fp->fp, " 13\n%f\n", dxf_dimension_get_x3 (dimension));
-                fprintf (fp->fp, " 23\n%f\n", dxf_dimension_get_y3 (dimension));
-                fprintf (fp->fp, " 33\n%f\n", dxf_dimension_get_z3 (dimension));
-                fprintf (fp->fp, " 14\n%f\n", dxf_dimension_get_x4 (dimension));
-                fprintf (fp->fp, " 24\n%f\n", dxf_dimension_get_y4 (dimension));
-                fprintf (fp->fp, " 34\n%f\n", dxf_dimension_get_z4 (dimension));
-                fprintf (fp->fp, " 50\n%f\n", dxf_dimension_get_angle (dimension));
-                fprintf (fp->fp, " 52\n%f\n", dxf_dimension_get_obl_angle (dimension));
+                dxf_write_real (fp, 12, dxf_dimension_get_x2 (dimension));
+                dxf_write_real (fp, 22, dxf_dimension_get_y2 (dimension));
+                dxf_write_real (fp, 32, dxf_dimension_get_z2 (dimension));
+                dxf_write_real (fp, 13, dxf_dimension_get_x3 (dimension));
+                dxf_write_real (fp, 23, dxf_dimension_get_y3 (dimension));
+                dxf_write_real (fp, 33, dxf_dimension_get_z3 (dimension));
+                dxf_write_real (fp, 14, dxf_dimension_get_x4 (dimension));
+                dxf_write_real (fp, 24, dxf_dimension_get_y4 (dimension));
+                dxf_write_real (fp, 34, dxf_dimension_get_z4 (dimension));
+                dxf_write_real (fp, 50, dxf_dimension_get_angle (dimension));
+                dxf_write_real (fp, 52, dxf_dimension_get_obl_angle (dimension));
                 if (fp->acad_version_number >= AutoCAD_13)
                 {
                         fprintf (fp->fp, "100\nAcDbRotatedDimension\n");
@@ -805,16 +814,16 @@ dxf_dimension_write
                 {
                         fprintf (fp->fp, "100\nAcDbAlignedDimension\n");
                 }
-                fprintf (fp->fp, " 12\n%f\n", dxf_dimension_get_x2 (dimension));
-                fprintf (fp->fp, " 22\n%f\n", dxf_dimension_get_y2 (dimension));
-                fprintf (fp->fp, " 32\n%f\n", dxf_dimension_get_z2 (dimension));
-                fprintf (fp->fp, " 13\n%f\n", dxf_dimension_get_x3 (dimension));
-                fprintf (fp->fp, " 23\n%f\n", dxf_dimension_get_y3 (dimension));
-                fprintf (fp->fp, " 33\n%f\n", dxf_dimension_get_z3 (dimension));
-                fprintf (fp->fp, " 14\n%f\n", dxf_dimension_get_x4 (dimension));
-                fprintf (fp->fp, " 24\n%f\n", dxf_dimension_get_y4 (dimension));
-                fprintf (fp->fp, " 34\n%f\n", dxf_dimension_get_z4 (dimension));
-                fprintf (fp->fp, " 50\n%f\n", dxf_dimension_get_angle (dimension));
+                dxf_write_real (fp, 12, dxf_dimension_get_x2 (dimension));
+                dxf_write_real (fp, 22, dxf_dimension_get_y2 (dimension));
+                dxf_write_real (fp, 32, dxf_dimension_get_z2 (dimension));
+                dxf_write_real (fp, 13, dxf_dimension_get_x3 (dimension));
+                dxf_write_real (fp, 23, dxf_dimension_get_y3 (dimension));
+                dxf_write_real (fp, 33, dxf_dimension_get_z3 (dimension));
+                dxf_write_real (fp, 14, dxf_dimension_get_x4 (dimension));
+                dxf_write_real (fp, 24, dxf_dimension_get_y4 (dimension));
+                dxf_write_real (fp, 34, dxf_dimension_get_z4 (dimension));
+                dxf_write_real (fp, 50, dxf_dimension_get_angle (dimension));
         }
         /* Angular dimension. */
         else if (dxf_dimension_get_flag (dimension) == 2)
@@ -823,18 +832,18 @@ dxf_dimension_write
                 {
                         fprintf (fp->fp, "100\nAcDb3PointAngularDimension\n");
                 }
-                fprintf (fp->fp, " 13\n%f\n", dxf_dimension_get_x3 (dimension));
-                fprintf (fp->fp, " 23\n%f\n", dxf_dimension_get_y3 (dimension));
-                fprintf (fp->fp, " 33\n%f\n", dxf_dimension_get_z3 (dimension));
-                fprintf (fp->fp, " 14\n%f\n", dxf_dimension_get_x4 (dimension));
-                fprintf (fp->fp, " 24\n%f\n", dxf_dimension_get_y4 (dimension));
-                fprintf (fp->fp, " 34\n%f\n", dxf_dimension_get_z4 (dimension));
-                fprintf (fp->fp, " 15\n%f\n", dxf_dimension_get_x5 (dimension));
-                fprintf (fp->fp, " 25\n%f\n", dxf_dimension_get_y5 (dimension));
-                fprintf (fp->fp, " 35\n%f\n", dxf_dimension_get_z5 (dimension));
-                fprintf (fp->fp, " 16\n%f\n", dxf_dimension_get_x6 (dimension));
-                fprintf (fp->fp, " 26\n%f\n", dxf_dimension_get_y6 (dimension));
-                fprintf (fp->fp, " 36\n%f\n", dxf_dimension_get_z6 (dimension));
+                dxf_write_real (fp, 13, dxf_dimension_get_x3 (dimension));
+                dxf_write_real (fp, 23, dxf_dimension_get_y3 (dimension));
+                dxf_write_real (fp, 33, dxf_dimension_get_z3 (dimension));
+                dxf_write_real (fp, 14, dxf_dimension_get_x4 (dimension));
+                dxf_write_real (fp, 24, dxf_dimension_get_y4 (dimension));
+                dxf_write_real (fp, 34, dxf_dimension_get_z4 (dimension));
+                dxf_write_real (fp, 15, dxf_dimension_get_x5 (dimension));
+                dxf_write_real (fp, 25, dxf_dimension_get_y5 (dimension));
+                dxf_write_real (fp, 35, dxf_dimension_get_z5 (dimension));
+                dxf_write_real (fp, 16, dxf_dimension_get_x6 (dimension));
+                dxf_write_real (fp, 26, dxf_dimension_get_y6 (dimension));
+                dxf_write_real (fp, 36, dxf_dimension_get_z6 (dimension));
         }
         /* Diameter dimension. */
         else if (dxf_dimension_get_flag (dimension) == 3)
@@ -843,10 +852,10 @@ dxf_dimension_write
                 {
                         fprintf (fp->fp, "100\nAcDbDiametricDimension\n");
                 }
-                fprintf (fp->fp, " 15\n%f\n", dxf_dimension_get_x5 (dimension));
-                fprintf (fp->fp, " 25\n%f\n", dxf_dimension_get_y5 (dimension));
-                fprintf (fp->fp, " 35\n%f\n", dxf_dimension_get_z5 (dimension));
-                fprintf (fp->fp, " 40\n%f\n", dxf_dimension_get_leader_length (dimension));
+                dxf_write_real (fp, 15, dxf_dimension_get_x5 (dimension));
+                dxf_write_real (fp, 25, dxf_dimension_get_y5 (dimension));
+                dxf_write_real (fp, 35, dxf_dimension_get_z5 (dimension));
+                dxf_write_real (fp, 40, dxf_dimension_get_leader_length (dimension));
         }
         /* Radius dimension. */
         else if (dxf_dimension_get_flag (dimension) == 4)
@@ -855,10 +864,10 @@ dxf_dimension_write
                 {
                         fprintf (fp->fp, "100\nAcDbRadialDimension\n");
                 }
-                fprintf (fp->fp, " 15\n%f\n", dxf_dimension_get_x5 (dimension));
-                fprintf (fp->fp, " 25\n%f\n", dxf_dimension_get_y5 (dimension));
-                fprintf (fp->fp, " 35\n%f\n", dxf_dimension_get_z5 (dimension));
-                fprintf (fp->fp, " 40\n%f\n", dxf_dimension_get_leader_length (dimension));
+                dxf_write_real (fp, 15, dxf_dimension_get_x5 (dimension));
+                dxf_write_real (fp, 25, dxf_dimension_get_y5 (dimension));
+                dxf_write_real (fp, 35, dxf_dimension_get_z5 (dimension));
+                dxf_write_real (fp, 40, dxf_dimension_get_leader_length (dimension));
         }
         /* Angular 3-point dimension. */
         else if (dxf_dimension_get_flag (dimension) == 5)
@@ -867,18 +876,18 @@ dxf_dimension_write
                 {
                         fprintf (fp->fp, "100\nAcDb3PointAngularDimension\n");
                 }
-                fprintf (fp->fp, " 13\n%f\n", dxf_dimension_get_x3 (dimension));
-                fprintf (fp->fp, " 23\n%f\n", dxf_dimension_get_y3 (dimension));
-                fprintf (fp->fp, " 33\n%f\n", dxf_dimension_get_z3 (dimension));
-                fprintf (fp->fp, " 14\n%f\n", dxf_dimension_get_x4 (dimension));
-                fprintf (fp->fp, " 24\n%f\n", dxf_dimension_get_y4 (dimension));
-                fprintf (fp->fp, " 34\n%f\n", dxf_dimension_get_z4 (dimension));
-                fprintf (fp->fp, " 15\n%f\n", dxf_dimension_get_x5 (dimension));
-                fprintf (fp->fp, " 25\n%f\n", dxf_dimension_get_y5 (dimension));
-                fprintf (fp->fp, " 35\n%f\n", dxf_dimension_get_z5 (dimension));
-                fprintf (fp->fp, " 16\n%f\n", dxf_dimension_get_x6 (dimension));
-                fprintf (fp->fp, " 26\n%f\n", dxf_dimension_get_y6 (dimension));
-                fprintf (fp->fp, " 36\n%f\n", dxf_dimension_get_z6 (dimension));
+                dxf_write_real (fp, 13, dxf_dimension_get_x3 (dimension));
+                dxf_write_real (fp, 23, dxf_dimension_get_y3 (dimension));
+                dxf_write_real (fp, 33, dxf_dimension_get_z3 (dimension));
+                dxf_write_real (fp, 14, dxf_dimension_get_x4 (dimension));
+                dxf_write_real (fp, 24, dxf_dimension_get_y4 (dimension));
+                dxf_write_real (fp, 34, dxf_dimension_get_z4 (dimension));
+                dxf_write_real (fp, 15, dxf_dimension_get_x5 (dimension));
+                dxf_write_real (fp, 25, dxf_dimension_get_y5 (dimension));
+                dxf_write_real (fp, 35, dxf_dimension_get_z5 (dimension));
+                dxf_write_real (fp, 16, dxf_dimension_get_x6 (dimension));
+                dxf_write_real (fp, 26, dxf_dimension_get_y6 (dimension));
+                dxf_write_real (fp, 36, dxf_dimension_get_z6 (dimension));
         }
         /* Ordinate dimension. */
         else if (dxf_dimension_get_flag (dimension) == 6)
@@ -887,19 +896,19 @@ dxf_dimension_write
                 {
                         fprintf (fp->fp, "100\nAcDbOrdinateDimension\n");
                 }
-                fprintf (fp->fp, " 13\n%f\n", dxf_dimension_get_x3 (dimension));
-                fprintf (fp->fp, " 23\n%f\n", dxf_dimension_get_y3 (dimension));
-                fprintf (fp->fp, " 33\n%f\n", dxf_dimension_get_z3 (dimension));
-                fprintf (fp->fp, " 14\n%f\n", dxf_dimension_get_x4 (dimension));
-                fprintf (fp->fp, " 24\n%f\n", dxf_dimension_get_y4 (dimension));
-                fprintf (fp->fp, " 34\n%f\n", dxf_dimension_get_z4 (dimension));
+                dxf_write_real (fp, 13, dxf_dimension_get_x3 (dimension));
+                dxf_write_real (fp, 23, dxf_dimension_get_y3 (dimension));
+                dxf_write_real (fp, 33, dxf_dimension_get_z3 (dimension));
+                dxf_write_real (fp, 14, dxf_dimension_get_x4 (dimension));
+                dxf_write_real (fp, 24, dxf_dimension_get_y4 (dimension));
+                dxf_write_real (fp, 34, dxf_dimension_get_z4 (dimension));
         }
         if (dxf_dimension_get_thickness (dimension) != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_dimension_get_thickness (dimension));
+                dxf_write_real (fp, 39, dxf_dimension_get_thickness (dimension));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -927,19 +936,26 @@ dxf_dimension_free
 #endif
         if (dimension->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfDimension was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dimension->linetype);
-        free (dimension->layer);
-        free (dimension->dim_text);
-        free (dimension->dimblock_name);
-        free (dimension->dimstyle_name);
-        free (dimension->dictionary_owner_soft);
-        free (dimension->dictionary_owner_hard);
-        free (dimension);
+        dxf_free (dimension->linetype);
+        dxf_free (dimension->layer);
+        dxf_free (dimension->dim_text);
+        dxf_free (dimension->dimblock_name);
+        dxf_free (dimension->dimstyle_name);
+        dxf_free (dimension->dictionary_owner_soft);
+        dxf_free (dimension->dictionary_owner_hard);
+        dxf_point_free (dimension->p0);
+        dxf_point_free (dimension->p1);
+        dxf_point_free (dimension->p2);
+        dxf_point_free (dimension->p3);
+        dxf_point_free (dimension->p4);
+        dxf_point_free (dimension->p5);
+        dxf_point_free (dimension->p6);
+        dxf_free (dimension);
         dimension = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -959,12 +975,12 @@ dxf_dimension_free_chain
                 /*!< pointer to the chain of DXF \c DIMENSION entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (dimensions == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return;
@@ -999,14 +1015,14 @@ dxf_dimension_get_id_code
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (DXF_ERROR);
         }
         if (dimension->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (DXF_ERROR);
@@ -1041,14 +1057,14 @@ dxf_dimension_set_id_code
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1079,14 +1095,14 @@ dxf_dimension_get_linetype
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1094,7 +1110,7 @@ dxf_dimension_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->linetype));
+        return (dxf_strdup (dimension->linetype));
 }
 
 
@@ -1119,19 +1135,19 @@ dxf_dimension_set_linetype
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->linetype = strdup (linetype);
+        dimension->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1157,14 +1173,14 @@ dxf_dimension_get_layer
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1172,7 +1188,7 @@ dxf_dimension_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->layer));
+        return (dxf_strdup (dimension->layer));
 }
 
 
@@ -1197,19 +1213,19 @@ dxf_dimension_set_layer
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->layer = strdup (layer);
+        dimension->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1235,7 +1251,7 @@ dxf_dimension_get_elevation
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1268,7 +1284,7 @@ dxf_dimension_set_elevation
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1299,14 +1315,14 @@ dxf_dimension_get_thickness
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1339,14 +1355,14 @@ dxf_dimension_set_thickness
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1377,14 +1393,14 @@ dxf_dimension_get_linetype_scale
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1417,14 +1433,14 @@ dxf_dimension_set_linetype_scale
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative linetype scale value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1455,21 +1471,21 @@ dxf_dimension_get_visibility
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1502,21 +1518,21 @@ dxf_dimension_set_visibility
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1547,14 +1563,14 @@ dxf_dimension_get_color
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1586,17 +1602,17 @@ dxf_dimension_set_color
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         dimension->color = color;
@@ -1626,20 +1642,20 @@ dxf_dimension_get_paperspace
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (dimension->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1671,21 +1687,21 @@ dxf_dimension_set_paperspace
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1718,20 +1734,20 @@ dxf_dimension_get_graphics_data_size
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
         if (dimension->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
@@ -1764,21 +1780,21 @@ dxf_dimension_set_graphics_data_size
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1809,21 +1825,21 @@ dxf_dimension_get_shadow_mode
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1856,21 +1872,21 @@ dxf_dimension_set_shadow_mode
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1905,14 +1921,14 @@ dxf_dimension_get_binary_graphics_data
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1947,14 +1963,14 @@ dxf_dimension_set_binary_graphics_data
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1989,14 +2005,14 @@ dxf_dimension_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2004,7 +2020,7 @@ dxf_dimension_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dictionary_owner_soft));
+        return (dxf_strdup (dimension->dictionary_owner_soft));
 }
 
 
@@ -2031,19 +2047,19 @@ dxf_dimension_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        dimension->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2072,14 +2088,14 @@ dxf_dimension_get_material
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the material member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2087,7 +2103,7 @@ dxf_dimension_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->material));
+        return (dxf_strdup (dimension->material));
 }
 
 
@@ -2114,19 +2130,19 @@ dxf_dimension_set_material
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->material = strdup (material);
+        dimension->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2156,14 +2172,14 @@ dxf_dimension_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2171,7 +2187,7 @@ dxf_dimension_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dictionary_owner_hard));
+        return (dxf_strdup (dimension->dictionary_owner_hard));
 }
 
 
@@ -2198,19 +2214,19 @@ dxf_dimension_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        dimension->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2237,7 +2253,7 @@ dxf_dimension_get_lineweight
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2270,7 +2286,7 @@ dxf_dimension_set_lineweight
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2302,14 +2318,14 @@ dxf_dimension_get_plot_style_name
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2317,7 +2333,7 @@ dxf_dimension_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->plot_style_name));
+        return (dxf_strdup (dimension->plot_style_name));
 }
 
 
@@ -2343,19 +2359,19 @@ dxf_dimension_set_plot_style_name
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->plot_style_name = strdup (plot_style_name);
+        dimension->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2382,7 +2398,7 @@ dxf_dimension_get_color_value
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2415,7 +2431,7 @@ dxf_dimension_set_color_value
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2447,14 +2463,14 @@ dxf_dimension_get_color_name
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2462,7 +2478,7 @@ dxf_dimension_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->color_name));
+        return (dxf_strdup (dimension->color_name));
 }
 
 
@@ -2488,19 +2504,19 @@ dxf_dimension_set_color_name
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->color_name = strdup (color_name);
+        dimension->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2527,7 +2543,7 @@ dxf_dimension_get_transparency
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2560,7 +2576,7 @@ dxf_dimension_set_transparency
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2592,14 +2608,14 @@ dxf_dimension_get_dim_text
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->dim_text ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dim_text member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2607,7 +2623,7 @@ dxf_dimension_get_dim_text
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dim_text));
+        return (dxf_strdup (dimension->dim_text));
 }
 
 
@@ -2632,19 +2648,19 @@ dxf_dimension_set_dim_text
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dim_text == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dim_text = strdup (dim_text);
+        dimension->dim_text = dxf_strdup (dim_text);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2671,14 +2687,14 @@ dxf_dimension_get_dimblock_name
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->dimblock_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dimblock_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2686,7 +2702,7 @@ dxf_dimension_get_dimblock_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dimblock_name));
+        return (dxf_strdup (dimension->dimblock_name));
 }
 
 
@@ -2711,19 +2727,19 @@ dxf_dimension_set_dimblock_name
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimblock_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dimblock_name = strdup (dimblock_name);
+        dimension->dimblock_name = dxf_strdup (dimblock_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2750,14 +2766,14 @@ dxf_dimension_get_dimstyle_name
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->dimstyle_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dimstyle_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2765,7 +2781,7 @@ dxf_dimension_get_dimstyle_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimension->dimstyle_name));
+        return (dxf_strdup (dimension->dimstyle_name));
 }
 
 
@@ -2790,19 +2806,19 @@ dxf_dimension_set_dimstyle_name
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimstyle_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimension->dimblock_name = strdup (dimstyle_name);
+        dimension->dimstyle_name = dxf_strdup (dimstyle_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2824,20 +2840,20 @@ dxf_dimension_get_p0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2865,20 +2881,20 @@ dxf_dimension_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2905,20 +2921,20 @@ dxf_dimension_get_x0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p0 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -2946,20 +2962,20 @@ dxf_dimension_set_x0
                 /*!< the X-value \c x0 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2986,20 +3002,20 @@ dxf_dimension_get_y0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p0 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -3027,20 +3043,20 @@ dxf_dimension_set_y0
                 /*!< the Y-value \c y0 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3067,20 +3083,20 @@ dxf_dimension_get_z0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p0 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -3108,20 +3124,20 @@ dxf_dimension_set_z0
                 /*!< the Z-value \c z0 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3148,20 +3164,20 @@ dxf_dimension_get_p1
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3189,20 +3205,20 @@ dxf_dimension_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3229,20 +3245,20 @@ dxf_dimension_get_x1
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p1 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -3270,20 +3286,20 @@ dxf_dimension_set_x1
                 /*!< the X-value \c x1 of the middle point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3310,20 +3326,20 @@ dxf_dimension_get_y1
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p1 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -3351,20 +3367,20 @@ dxf_dimension_set_y1
                 /*!< the Y-value \c y1 of the middle point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3392,20 +3408,20 @@ dxf_dimension_get_z1
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p1 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -3433,20 +3449,20 @@ dxf_dimension_set_z1
                 /*!< the Z-coordinate value \c z1 of the middle point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3473,20 +3489,20 @@ dxf_dimension_get_p2
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3514,20 +3530,20 @@ dxf_dimension_set_p2
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3554,20 +3570,20 @@ dxf_dimension_get_x2
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p2 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -3595,20 +3611,20 @@ dxf_dimension_set_x2
                 /*!< the X-value \c x2 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3635,20 +3651,20 @@ dxf_dimension_get_y2
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p2 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -3677,20 +3693,20 @@ dxf_dimension_set_y2
                  * point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3717,20 +3733,20 @@ dxf_dimension_get_z2
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p2 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -3758,20 +3774,20 @@ dxf_dimension_set_z2
                 /*!< the Z-value \c z2 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3798,20 +3814,20 @@ dxf_dimension_get_p3
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3839,20 +3855,20 @@ dxf_dimension_set_p3
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3879,20 +3895,20 @@ dxf_dimension_get_x3
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p3 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -3921,20 +3937,20 @@ dxf_dimension_set_x3
                  * point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3961,20 +3977,20 @@ dxf_dimension_get_y3
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p3 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -4003,20 +4019,20 @@ dxf_dimension_set_y3
                  * point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4043,20 +4059,20 @@ dxf_dimension_get_z3
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p3 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -4085,20 +4101,20 @@ dxf_dimension_set_z3
                  * point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4125,20 +4141,20 @@ dxf_dimension_get_p4
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p4 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4166,20 +4182,20 @@ dxf_dimension_set_p4
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p4 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4206,20 +4222,20 @@ dxf_dimension_get_x4
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p4 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -4247,20 +4263,20 @@ dxf_dimension_set_x4
                 /*!< the X-value \c x4 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p4 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4287,20 +4303,20 @@ dxf_dimension_get_y4
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p4 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -4328,20 +4344,20 @@ dxf_dimension_set_y4
                 /*!< the Y-value \c y4 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p4 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4368,20 +4384,20 @@ dxf_dimension_get_z4
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p4 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -4409,20 +4425,20 @@ dxf_dimension_set_z4
                 /*!< the Z-value \c z4 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p4 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4449,20 +4465,20 @@ dxf_dimension_get_p5
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p5 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4490,20 +4506,20 @@ dxf_dimension_set_p5
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p5 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4530,20 +4546,20 @@ dxf_dimension_get_x5
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p5 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -4571,20 +4587,20 @@ dxf_dimension_set_x5
                 /*!< the X-value \c x5 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p5 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4611,20 +4627,20 @@ dxf_dimension_get_y5
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p5 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -4652,20 +4668,20 @@ dxf_dimension_set_y5
                 /*!< the Y-value \c y5 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p5 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4692,20 +4708,20 @@ dxf_dimension_get_z5
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p5 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -4733,20 +4749,20 @@ dxf_dimension_set_z5
                 /*!< the Z-value \c z5 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p5 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4773,20 +4789,20 @@ dxf_dimension_get_p6
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p6 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4814,20 +4830,20 @@ dxf_dimension_set_p6
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p6 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4854,20 +4870,20 @@ dxf_dimension_get_x6
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p6 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -4895,20 +4911,20 @@ dxf_dimension_set_x6
                 /*!< the X-value \c x6 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p6 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4935,20 +4951,20 @@ dxf_dimension_get_y6
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p6 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -4976,20 +4992,20 @@ dxf_dimension_set_y6
                 /*!< the Y-value \c y6 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p6 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5016,20 +5032,20 @@ dxf_dimension_get_z6
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimension->p6 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
@@ -5057,20 +5073,20 @@ dxf_dimension_set_z6
                 /*!< the Z-value \c z6 of the definition point. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->p6 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5101,7 +5117,7 @@ dxf_dimension_get_leader_length
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5134,7 +5150,7 @@ dxf_dimension_set_leader_length
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5167,7 +5183,7 @@ dxf_dimension_get_text_line_spacing_factor
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5201,7 +5217,7 @@ dxf_dimension_set_text_line_spacing_factor
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5233,7 +5249,7 @@ dxf_dimension_get_actual_measurement
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5266,7 +5282,7 @@ dxf_dimension_set_actual_measurement
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5298,7 +5314,7 @@ dxf_dimension_get_angle
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5332,7 +5348,7 @@ dxf_dimension_set_angle
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5365,7 +5381,7 @@ dxf_dimension_get_hor_dir
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5399,7 +5415,7 @@ dxf_dimension_set_hor_dir
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5432,7 +5448,7 @@ dxf_dimension_get_obl_angle
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5466,7 +5482,7 @@ dxf_dimension_set_obl_angle
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5497,7 +5513,7 @@ dxf_dimension_get_text_angle
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5530,7 +5546,7 @@ dxf_dimension_set_text_angle
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5561,14 +5577,14 @@ dxf_dimension_get_flag
 #endif
         if (dimension == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
               return (DXF_ERROR);
         }
         if (dimension->flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the flag member.\n")),
                   __FUNCTION__);
                 return (DXF_ERROR);
@@ -5601,14 +5617,14 @@ dxf_dimension_set_flag
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the passed flag.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5638,21 +5654,21 @@ dxf_dimension_get_attachment_point
 #endif
         if (dimension == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
               return (DXF_ERROR);
         }
         if (dimension->attachment_point < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the attachment_point member.\n")),
                   __FUNCTION__);
               return (DXF_ERROR);
         }
         if (dimension->attachment_point > 9)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the attachment_point member.\n")),
                   __FUNCTION__);
               return (DXF_ERROR);
@@ -5685,21 +5701,21 @@ dxf_dimension_set_attachment_point
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attachment_point < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed in the attachment_point.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (attachment_point > 9)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed in the attachment_point.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5729,21 +5745,21 @@ dxf_dimension_get_text_line_spacing
 #endif
         if (dimension == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
               return (DXF_ERROR);
         }
         if (dimension->text_line_spacing < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the text_line_spacing member.\n")),
                   __FUNCTION__);
               return (DXF_ERROR);
         }
         if (dimension->text_line_spacing > 2)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the text_line_spacing member.\n")),
                   __FUNCTION__);
               return (DXF_ERROR);
@@ -5776,21 +5792,21 @@ dxf_dimension_set_text_line_spacing
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (text_line_spacing < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed in the text_line_spacing.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (text_line_spacing > 2)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed in the text_line_spacing.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5817,13 +5833,13 @@ dxf_dimension_get_extr_x0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5851,13 +5867,13 @@ dxf_dimension_set_extr_x0
                 /*!< the X-value \c extr_x0 of the extrusion vector. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5884,13 +5900,13 @@ dxf_dimension_get_extr_y0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5918,13 +5934,13 @@ dxf_dimension_set_extr_y0
                 /*!< the Y-value \c extr_y0 of the extrusion vector. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5951,13 +5967,13 @@ dxf_dimension_get_extr_z0
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5985,13 +6001,13 @@ dxf_dimension_set_extr_z0
                 /*!< the Z-value \c extr_z0 of the extrusion vector. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6020,7 +6036,7 @@ dxf_dimension_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c DIMENSION entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -6028,7 +6044,7 @@ dxf_dimension_get_extrusion_vector_as_point
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6036,7 +6052,7 @@ dxf_dimension_get_extrusion_vector_as_point
         point = dxf_point_init (point);
         if (point == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -6076,7 +6092,7 @@ dxf_dimension_set_extrusion_vector
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6113,14 +6129,14 @@ dxf_dimension_get_next
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6154,14 +6170,14 @@ dxf_dimension_set_next
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6196,14 +6212,14 @@ dxf_dimension_get_last
         /* Do some basic checks. */
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimension->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfDimension *) dimension);
@@ -40,6 +40,7 @@
 
 
 #include "dimstyle.h"
+#include "util.h"
 
 
 /*!
@@ -62,9 +63,9 @@ dxf_dimstyle_new ()
         size = sizeof (DxfDimStyle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dimstyle = malloc (size)) == NULL)
+        if ((dimstyle = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfDimStyle struct.\n")),
                   __FUNCTION__);
                 dimstyle = NULL;
@@ -101,26 +102,26 @@ dxf_dimstyle_init
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dimstyle = dxf_dimstyle_new ();
         }
         if (dimstyle == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfDimStyle struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        dxf_dimstyle_set_dimstyle_name (dimstyle, strdup (""));
-        dxf_dimstyle_set_dimpost (dimstyle, strdup (""));
-        dxf_dimstyle_set_dimapost (dimstyle, strdup (""));
-        dxf_dimstyle_set_dimblk (dimstyle, strdup (""));
-        dxf_dimstyle_set_dimblk1 (dimstyle, strdup (""));
-        dxf_dimstyle_set_dimblk2 (dimstyle, strdup (""));
-        dxf_dimstyle_set_dimscale (dimstyle, 0.0);
-        dxf_dimstyle_set_dimasz (dimstyle, 0.0);
+        dxf_dimstyle_set_dimstyle_name (dimstyle, dxf_strdup (""));
+        dxf_dimstyle_set_dimpost (dimstyle, dxf_strdup (""));
+        dxf_dimstyle_set_dimapost (dimstyle, dxf_strdup (""));
+        dxf_dimstyle_set_dimblk (dimstyle, dxf_strdup (""));
+        dxf_dimstyle_set_dimblk1 (dimstyle, dxf_strdup (""));
+        dxf_dimstyle_set_dimblk2 (dimstyle, dxf_strdup (""));
+        dxf_dimstyle_set_dimscale (dimstyle, 1.0);
+        dxf_dimstyle_set_dimasz (dimstyle, 0.18);
         dxf_dimstyle_set_dimexo (dimstyle, 0.0);
         dxf_dimstyle_set_dimdli (dimstyle, 0.0);
         dxf_dimstyle_set_dimexe (dimstyle, 0.0);
@@ -154,6 +155,7 @@ dxf_dimstyle_init
         dxf_dimstyle_set_dimclrd (dimstyle, DXF_COLOR_BYLAYER);
         dxf_dimstyle_set_dimclre (dimstyle, DXF_COLOR_BYLAYER);
         dxf_dimstyle_set_dimclrt (dimstyle, DXF_COLOR_BYLAYER);
+        dimstyle->dimtxsty = dxf_strdup ("");
         dxf_dimstyle_set_next (dimstyle, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -181,76 +183,76 @@ dxf_dimstyle_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("DIMSTYLE");
+        char *dxf_entity_name = dxf_strdup ("DIMSTYLE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_dimstyle_get_dimstyle_name (dimstyle), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () dimstyle_name value is empty for the %s entity.\n")),
                   __FUNCTION__, dxf_entity_name);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tskipping %s table.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (!dxf_dimstyle_get_dimstyle_name (dimstyle))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () dimstyle_name value is NULL for the %s entity.\n")),
                   __FUNCTION__, dxf_entity_name);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tskipping %s table.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dimstyle->id_code);
         }
         if (!dxf_dimstyle_get_dimpost (dimstyle))
         {
-                dxf_dimstyle_set_dimpost (dimstyle, strdup (""));
+                dxf_dimstyle_set_dimpost (dimstyle, dxf_strdup (""));
         }
         if (!dxf_dimstyle_get_dimapost (dimstyle))
         {
-                dxf_dimstyle_set_dimapost (dimstyle, strdup (""));
+                dxf_dimstyle_set_dimapost (dimstyle, dxf_strdup (""));
         }
         if (!dxf_dimstyle_get_dimblk (dimstyle))
         {
-                dxf_dimstyle_set_dimblk (dimstyle, strdup (""));
+                dxf_dimstyle_set_dimblk (dimstyle, dxf_strdup (""));
         }
         if (!dxf_dimstyle_get_dimblk1 (dimstyle))
         {
-                dxf_dimstyle_set_dimblk1 (dimstyle, strdup (""));
+                dxf_dimstyle_set_dimblk1 (dimstyle, dxf_strdup (""));
         }
         if (!dxf_dimstyle_get_dimblk2 (dimstyle))
         {
-                dxf_dimstyle_set_dimblk2 (dimstyle, strdup (""));
+                dxf_dimstyle_set_dimblk2 (dimstyle, dxf_strdup (""));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -282,23 +284,23 @@ dxf_dimstyle_write
         {
                 fprintf (fp->fp, "  7\n%s\n", dxf_dimstyle_get_dimblk2 (dimstyle));
         }
-        fprintf (fp->fp, " 40\n%f\n", dxf_dimstyle_get_dimscale (dimstyle));
-        fprintf (fp->fp, " 41\n%f\n", dxf_dimstyle_get_dimasz (dimstyle));
-        fprintf (fp->fp, " 42\n%f\n", dxf_dimstyle_get_dimexo (dimstyle));
-        fprintf (fp->fp, " 43\n%f\n", dxf_dimstyle_get_dimdli (dimstyle));
-        fprintf (fp->fp, " 44\n%f\n", dxf_dimstyle_get_dimexe (dimstyle));
-        fprintf (fp->fp, " 45\n%f\n", dxf_dimstyle_get_dimrnd (dimstyle));
-        fprintf (fp->fp, " 46\n%f\n", dxf_dimstyle_get_dimdle (dimstyle));
-        fprintf (fp->fp, " 47\n%f\n", dxf_dimstyle_get_dimtp (dimstyle));
-        fprintf (fp->fp, " 48\n%f\n", dxf_dimstyle_get_dimtm (dimstyle));
-        fprintf (fp->fp, "140\n%f\n", dxf_dimstyle_get_dimtxt (dimstyle));
-        fprintf (fp->fp, "141\n%f\n", dxf_dimstyle_get_dimcen (dimstyle));
-        fprintf (fp->fp, "142\n%f\n", dxf_dimstyle_get_dimtsz (dimstyle));
-        fprintf (fp->fp, "143\n%f\n", dxf_dimstyle_get_dimaltf (dimstyle));
-        fprintf (fp->fp, "144\n%f\n", dxf_dimstyle_get_dimlfac (dimstyle));
-        fprintf (fp->fp, "145\n%f\n", dxf_dimstyle_get_dimtvp (dimstyle));
-        fprintf (fp->fp, "146\n%f\n", dxf_dimstyle_get_dimtfac (dimstyle));
-        fprintf (fp->fp, "147\n%f\n", dxf_dimstyle_get_dimgap (dimstyle));
+        dxf_write_real (fp, 40, dxf_dimstyle_get_dimscale (dimstyle));
+        dxf_write_real (fp, 41, dxf_dimstyle_get_dimasz (dimstyle));
+        dxf_write_real (fp, 42, dxf_dimstyle_get_dimexo (dimstyle));
+        dxf_write_real (fp, 43, dxf_dimstyle_get_dimdli (dimstyle));
+        dxf_write_real (fp, 44, dxf_dimstyle_get_dimexe (dimstyle));
+        dxf_write_real (fp, 45, dxf_dimstyle_get_dimrnd (dimstyle));
+        dxf_write_real (fp, 46, dxf_dimstyle_get_dimdle (dimstyle));
+        dxf_write_real (fp, 47, dxf_dimstyle_get_dimtp (dimstyle));
+        dxf_write_real (fp, 48, dxf_dimstyle_get_dimtm (dimstyle));
+        dxf_write_real (fp, 140, dxf_dimstyle_get_dimtxt (dimstyle));
+        dxf_write_real (fp, 141, dxf_dimstyle_get_dimcen (dimstyle));
+        dxf_write_real (fp, 142, dxf_dimstyle_get_dimtsz (dimstyle));
+        dxf_write_real (fp, 143, dxf_dimstyle_get_dimaltf (dimstyle));
+        dxf_write_real (fp, 144, dxf_dimstyle_get_dimlfac (dimstyle));
+        dxf_write_real (fp, 145, dxf_dimstyle_get_dimtvp (dimstyle));
+        dxf_write_real (fp, 146, dxf_dimstyle_get_dimtfac (dimstyle));
+        dxf_write_real (fp, 147, dxf_dimstyle_get_dimgap (dimstyle));
         fprintf (fp->fp, " 71\n%d\n", dxf_dimstyle_get_dimtol (dimstyle));
         fprintf (fp->fp, " 72\n%d\n", dxf_dimstyle_get_dimlim (dimstyle));
         fprintf (fp->fp, " 73\n%d\n", dxf_dimstyle_get_dimtih (dimstyle));
@@ -335,10 +337,9 @@ dxf_dimstyle_write
                 fprintf (fp->fp, "286\n%d\n", dxf_dimstyle_get_dimalttz (dimstyle));
                 fprintf (fp->fp, "287\n%d\n", dxf_dimstyle_get_dimfit (dimstyle));
                 fprintf (fp->fp, "288\n%d\n", dxf_dimstyle_get_dimupt (dimstyle));
-                fprintf (fp->fp, "  0\nENDTAB\n");
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -369,37 +370,34 @@ dxf_dimstyle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dimstyle = dxf_dimstyle_new ();
                 dimstyle = dxf_dimstyle_init (dimstyle);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -408,21 +406,21 @@ dxf_dimstyle_read
                         /* Now follows a string containing a dimension
                          * style name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimstyle_name);
+                        dxf_read_string (fp, &dimstyle->dimstyle_name);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a general
                          * dimensioning suffix. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimpost);
+                        dxf_read_string (fp, &dimstyle->dimpost);
                 }
                 else if (strcmp (temp_string, "4") == 0)
                 {
                         /* Now follows a string containing an alternate
                          * dimensioning suffix. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimapost);
+                        dxf_read_string (fp, &dimstyle->dimapost);
                 }
                 else if ((fp->acad_version_number < AutoCAD_2000)
                         && (strcmp (temp_string, "5") == 0))
@@ -430,7 +428,7 @@ dxf_dimstyle_read
                         /* Now follows a string containing an arrow
                          * block name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimblk);
+                        dxf_read_string (fp, &dimstyle->dimblk);
                 }
                 else if ((fp->acad_version_number < AutoCAD_2000)
                         && (strcmp (temp_string, "6") == 0))
@@ -438,7 +436,7 @@ dxf_dimstyle_read
                         /* Now follows a string containing a first arrow
                          * block name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimblk1);
+                        dxf_read_string (fp, &dimstyle->dimblk1);
                 }
 #if 0
 /*!
@@ -460,7 +458,7 @@ dxf_dimstyle_read
                         /* Now follows a string containing a first arrow
                          * block name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimblk2);
+                        dxf_read_string (fp, &dimstyle->dimblk2);
                 }
 #if 0
 /*!
@@ -612,7 +610,7 @@ dxf_dimstyle_read
                         if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
                         && (strcmp (temp_string, "AcDbDimStyleTableRecord") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -860,21 +858,29 @@ dxf_dimstyle_read
                         /* Now follows a string containing dimension
                          * text style. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", dimstyle->dimtxsty);
+                        dxf_read_string (fp, &dimstyle->dimtxsty);
+                }
+                else
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
+                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_dimstyle_get_dimstyle_name (dimstyle), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () dimstyle_name value is empty.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -902,18 +908,18 @@ dxf_dimstyle_free
 #endif
         if (dimstyle->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfDimStyle was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_dimstyle_get_dimstyle_name (dimstyle));
-        free (dxf_dimstyle_get_dimpost (dimstyle));
-        free (dxf_dimstyle_get_dimapost (dimstyle));
-        free (dxf_dimstyle_get_dimblk (dimstyle));
-        free (dxf_dimstyle_get_dimblk1 (dimstyle));
-        free (dxf_dimstyle_get_dimblk2 (dimstyle));
-        free (dimstyle);
+        dxf_free (dxf_dimstyle_get_dimstyle_name (dimstyle));
+        dxf_free (dxf_dimstyle_get_dimpost (dimstyle));
+        dxf_free (dxf_dimstyle_get_dimapost (dimstyle));
+        dxf_free (dxf_dimstyle_get_dimblk (dimstyle));
+        dxf_free (dxf_dimstyle_get_dimblk1 (dimstyle));
+        dxf_free (dxf_dimstyle_get_dimblk2 (dimstyle));
+        dxf_free (dimstyle);
         dimstyle = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -934,18 +940,19 @@ dxf_dimstyle_free_chain
                  * tables. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (dimstyles == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (dimstyles != NULL)
         {
                 struct DxfDimStyle *iter = dimstyles->next;
+                dimstyles->next = NULL;
                 dxf_dimstyle_free (dimstyles);
                 dimstyles = (DxfDimStyle *) iter;
         }
@@ -975,7 +982,7 @@ dxf_dimstyle_get_dimstyle_name
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -983,7 +990,7 @@ dxf_dimstyle_get_dimstyle_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimstyle_name));
+        return (dxf_strdup (dimstyle->dimstyle_name));
 }
 
 
@@ -1017,19 +1024,19 @@ dxf_dimstyle_set_dimstyle_name
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimstyle_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () the string name contained a NULL pointer.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimstyle_name = strdup (dimstyle_name);
+        dimstyle->dimstyle_name = dxf_strdup (dimstyle_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1057,7 +1064,7 @@ dxf_dimstyle_get_dimpost
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1065,7 +1072,7 @@ dxf_dimstyle_get_dimpost
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimpost));
+        return (dxf_strdup (dimstyle->dimpost));
 }
 
 
@@ -1099,19 +1106,19 @@ dxf_dimstyle_set_dimpost
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimpost == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () the string name contained a NULL pointer.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimpost = strdup (dimpost);
+        dimstyle->dimpost = dxf_strdup (dimpost);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1139,7 +1146,7 @@ dxf_dimstyle_get_dimapost
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1147,7 +1154,7 @@ dxf_dimstyle_get_dimapost
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimapost));
+        return (dxf_strdup (dimstyle->dimapost));
 }
 
 
@@ -1181,19 +1188,19 @@ dxf_dimstyle_set_dimapost
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimapost == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () the string name contained a NULL pointer.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimapost = strdup (dimapost);
+        dimstyle->dimapost = dxf_strdup (dimapost);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1221,7 +1228,7 @@ dxf_dimstyle_get_dimblk
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1229,7 +1236,7 @@ dxf_dimstyle_get_dimblk
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimblk));
+        return (dxf_strdup (dimstyle->dimblk));
 }
 
 
@@ -1262,19 +1269,19 @@ dxf_dimstyle_set_dimblk
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () the string contained a NULL pointer.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimblk = strdup (dimblk);
+        dimstyle->dimblk = dxf_strdup (dimblk);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1302,7 +1309,7 @@ dxf_dimstyle_get_dimblk1
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1310,7 +1317,7 @@ dxf_dimstyle_get_dimblk1
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimblk1));
+        return (dxf_strdup (dimstyle->dimblk1));
 }
 
 
@@ -1344,19 +1351,19 @@ dxf_dimstyle_set_dimblk1
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimblk1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () the string contained a NULL pointer.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimblk1 = strdup (dimblk1);
+        dimstyle->dimblk1 = dxf_strdup (dimblk1);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1384,7 +1391,7 @@ dxf_dimstyle_get_dimblk2
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1392,7 +1399,7 @@ dxf_dimstyle_get_dimblk2
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimblk2));
+        return (dxf_strdup (dimstyle->dimblk2));
 }
 
 
@@ -1426,19 +1433,19 @@ dxf_dimstyle_set_dimblk2
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimblk2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () the string contained a NULL pointer.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimblk2 = strdup (dimblk2);
+        dimstyle->dimblk2 = dxf_strdup (dimblk2);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1466,14 +1473,14 @@ dxf_dimstyle_get_dimscale
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimscale == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was found in the dimscale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1506,14 +1513,14 @@ dxf_dimstyle_set_dimscale
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimscale == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1546,14 +1553,14 @@ dxf_dimstyle_get_dimasz
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimasz == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was found in the dimasz member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1586,14 +1593,14 @@ dxf_dimstyle_set_dimasz
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimasz == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1626,7 +1633,7 @@ dxf_dimstyle_get_dimexo
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1659,7 +1666,7 @@ dxf_dimstyle_set_dimexo
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1692,7 +1699,7 @@ dxf_dimstyle_get_dimdli
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1725,7 +1732,7 @@ dxf_dimstyle_set_dimdli
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1758,7 +1765,7 @@ dxf_dimstyle_get_dimexe
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1791,7 +1798,7 @@ dxf_dimstyle_set_dimexe
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1824,7 +1831,7 @@ dxf_dimstyle_get_dimrnd
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1857,7 +1864,7 @@ dxf_dimstyle_set_dimrnd
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1890,7 +1897,7 @@ dxf_dimstyle_get_dimdle
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1923,7 +1930,7 @@ dxf_dimstyle_set_dimdle
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1956,7 +1963,7 @@ dxf_dimstyle_get_dimtp
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1989,7 +1996,7 @@ dxf_dimstyle_set_dimtp
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2022,7 +2029,7 @@ dxf_dimstyle_get_dimtm
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2055,7 +2062,7 @@ dxf_dimstyle_set_dimtm
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2092,7 +2099,7 @@ dxf_dimstyle_get_flag
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2128,7 +2135,7 @@ dxf_dimstyle_set_flag
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2161,7 +2168,7 @@ dxf_dimstyle_get_dimtol
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2194,7 +2201,7 @@ dxf_dimstyle_set_dimtol
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2227,7 +2234,7 @@ dxf_dimstyle_get_dimlim
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2260,7 +2267,7 @@ dxf_dimstyle_set_dimlim
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2293,7 +2300,7 @@ dxf_dimstyle_get_dimtih
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2326,7 +2333,7 @@ dxf_dimstyle_set_dimtih
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2359,7 +2366,7 @@ dxf_dimstyle_get_dimtoh
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2392,7 +2399,7 @@ dxf_dimstyle_set_dimtoh
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2425,7 +2432,7 @@ dxf_dimstyle_get_dimse1
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2458,7 +2465,7 @@ dxf_dimstyle_set_dimse1
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2491,7 +2498,7 @@ dxf_dimstyle_get_dimse2
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2524,7 +2531,7 @@ dxf_dimstyle_set_dimse2
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2557,7 +2564,7 @@ dxf_dimstyle_get_dimtad
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2590,7 +2597,7 @@ dxf_dimstyle_set_dimtad
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2624,7 +2631,7 @@ dxf_dimstyle_get_dimzin
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2657,7 +2664,7 @@ dxf_dimstyle_set_dimzin
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2689,7 +2696,7 @@ dxf_dimstyle_get_id_code
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2723,7 +2730,7 @@ dxf_dimstyle_set_id_code
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2756,7 +2763,7 @@ dxf_dimstyle_get_dimtxt
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2789,7 +2796,7 @@ dxf_dimstyle_set_dimtxt
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2822,7 +2829,7 @@ dxf_dimstyle_get_dimcen
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2855,7 +2862,7 @@ dxf_dimstyle_set_dimcen
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2888,7 +2895,7 @@ dxf_dimstyle_get_dimtsz
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2921,7 +2928,7 @@ dxf_dimstyle_set_dimtsz
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2954,7 +2961,7 @@ dxf_dimstyle_get_dimaltf
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2987,7 +2994,7 @@ dxf_dimstyle_set_dimaltf
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3020,7 +3027,7 @@ dxf_dimstyle_get_dimlfac
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3053,7 +3060,7 @@ dxf_dimstyle_set_dimlfac
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3086,7 +3093,7 @@ dxf_dimstyle_get_dimtvp
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3119,7 +3126,7 @@ dxf_dimstyle_set_dimtvp
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3152,7 +3159,7 @@ dxf_dimstyle_get_dimtfac
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3185,7 +3192,7 @@ dxf_dimstyle_set_dimtfac
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3218,7 +3225,7 @@ dxf_dimstyle_get_dimgap
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3251,7 +3258,7 @@ dxf_dimstyle_set_dimgap
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3284,7 +3291,7 @@ dxf_dimstyle_get_dimalt
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3317,7 +3324,7 @@ dxf_dimstyle_set_dimalt
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3350,7 +3357,7 @@ dxf_dimstyle_get_dimaltd
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3383,7 +3390,7 @@ dxf_dimstyle_set_dimaltd
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3417,7 +3424,7 @@ dxf_dimstyle_get_dimtofl
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3450,7 +3457,7 @@ dxf_dimstyle_set_dimtofl
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3483,7 +3490,7 @@ dxf_dimstyle_get_dimsah
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3516,7 +3523,7 @@ dxf_dimstyle_set_dimsah
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3549,7 +3556,7 @@ dxf_dimstyle_get_dimtix
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3582,7 +3589,7 @@ dxf_dimstyle_set_dimtix
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3616,7 +3623,7 @@ dxf_dimstyle_get_dimsoxd
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3649,7 +3656,7 @@ dxf_dimstyle_set_dimsoxd
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3682,7 +3689,7 @@ dxf_dimstyle_get_dimclrd
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3715,7 +3722,7 @@ dxf_dimstyle_set_dimclrd
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3748,7 +3755,7 @@ dxf_dimstyle_get_dimclre
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3781,7 +3788,7 @@ dxf_dimstyle_set_dimclre
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3814,7 +3821,7 @@ dxf_dimstyle_get_dimclrt
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3847,7 +3854,7 @@ dxf_dimstyle_set_dimclrt
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3880,20 +3887,20 @@ dxf_dimstyle_get_dimunit
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimunit < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the dimunit member.\n")),
                   __FUNCTION__);
         }
         if (dimstyle->dimunit > 4)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the dimunit member.\n")),
                   __FUNCTION__);
         }
@@ -3925,20 +3932,20 @@ dxf_dimstyle_set_dimunit
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimunit < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed in the dimunit member.\n")),
                   __FUNCTION__);
         }
         if (dimunit > 4)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed in the dimunit member.\n")),
                   __FUNCTION__);
         }
@@ -3972,7 +3979,7 @@ dxf_dimstyle_get_dimdec
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4007,7 +4014,7 @@ dxf_dimstyle_set_dimdec
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4042,7 +4049,7 @@ dxf_dimstyle_get_dimtdec
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4077,7 +4084,7 @@ dxf_dimstyle_set_dimtdec
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4110,7 +4117,7 @@ dxf_dimstyle_get_dimaltu
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4143,7 +4150,7 @@ dxf_dimstyle_set_dimaltu
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4178,7 +4185,7 @@ dxf_dimstyle_get_dimalttd
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4213,7 +4220,7 @@ dxf_dimstyle_set_dimalttd
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4247,20 +4254,20 @@ dxf_dimstyle_get_dimaunit
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimaunit < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the dimaunit member.\n")),
                   __FUNCTION__);
         }
         if (dimstyle->dimaunit > 4)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the dimaunit member.\n")),
                   __FUNCTION__);
         }
@@ -4292,20 +4299,20 @@ dxf_dimstyle_set_dimaunit
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimaunit < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed in the dimaunit variable.\n")),
                   __FUNCTION__);
         }
         if (dimaunit > 4)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed in the dimaunit variable.\n")),
                   __FUNCTION__);
         }
@@ -4337,20 +4344,20 @@ dxf_dimstyle_get_dimjust
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimjust < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the dimjust member.\n")),
                   __FUNCTION__);
         }
         if (dimstyle->dimjust > 4)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the dimjust member.\n")),
                   __FUNCTION__);
         }
@@ -4382,20 +4389,20 @@ dxf_dimstyle_set_dimjust
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimjust < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed in the dimjust variable.\n")),
                   __FUNCTION__);
         }
         if (dimjust > 4)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed in the dimjust variable.\n")),
                   __FUNCTION__);
         }
@@ -4427,20 +4434,20 @@ dxf_dimstyle_get_dimsd1
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimsd1 < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the dimsd1 member.\n")),
                   __FUNCTION__);
         }
         if (dimstyle->dimsd1 > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the dimsd1 member.\n")),
                   __FUNCTION__);
         }
@@ -4472,20 +4479,20 @@ dxf_dimstyle_set_dimsd1
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimsd1 < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed in the dimsd1 variable.\n")),
                   __FUNCTION__);
         }
         if (dimsd1 > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed in the dimsd1 variable.\n")),
                   __FUNCTION__);
         }
@@ -4518,20 +4525,20 @@ dxf_dimstyle_get_dimsd2
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimsd2 < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the dimsd2 member.\n")),
                   __FUNCTION__);
         }
         if (dimstyle->dimsd2 > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the dimsd2 member.\n")),
                   __FUNCTION__);
         }
@@ -4563,20 +4570,20 @@ dxf_dimstyle_set_dimsd2
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimsd2 < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed in the dimsd2 variable.\n")),
                   __FUNCTION__);
         }
         if (dimsd2 > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed in the dimsd2 variable.\n")),
                   __FUNCTION__);
         }
@@ -4608,20 +4615,20 @@ dxf_dimstyle_get_dimtolj
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimtolj < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the dimtolj member.\n")),
                   __FUNCTION__);
         }
         if (dimstyle->dimtolj > 2)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the dimtolj member.\n")),
                   __FUNCTION__);
         }
@@ -4653,20 +4660,20 @@ dxf_dimstyle_set_dimtolj
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimtolj < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed in the dimtolj variable.\n")),
                   __FUNCTION__);
         }
         if (dimtolj > 2)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed in the dimtolj variable.\n")),
                   __FUNCTION__);
         }
@@ -4698,20 +4705,20 @@ dxf_dimstyle_get_dimtzin
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimtzin < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the dimtzin member.\n")),
                   __FUNCTION__);
         }
         if (dimstyle->dimtzin > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the dimtzin member.\n")),
                   __FUNCTION__);
         }
@@ -4743,20 +4750,20 @@ dxf_dimstyle_set_dimtzin
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimtzin < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed in the dimtzin variable.\n")),
                   __FUNCTION__);
         }
         if (dimtzin > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed in the dimtzin variable.\n")),
                   __FUNCTION__);
         }
@@ -4790,20 +4797,20 @@ dxf_dimstyle_get_dimaltz
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimaltz < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the dimaltz member.\n")),
                   __FUNCTION__);
         }
         if (dimstyle->dimaltz > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the dimaltz member.\n")),
                   __FUNCTION__);
         }
@@ -4837,20 +4844,20 @@ dxf_dimstyle_set_dimaltz
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimaltz < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed in the dimaltz variable.\n")),
                   __FUNCTION__);
         }
         if (dimaltz > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed in the dimaltz variable.\n")),
                   __FUNCTION__);
         }
@@ -4884,20 +4891,20 @@ dxf_dimstyle_get_dimalttz
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimalttz < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the dimalttz member.\n")),
                   __FUNCTION__);
         }
         if (dimstyle->dimalttz > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the dimalttz member.\n")),
                   __FUNCTION__);
         }
@@ -4930,20 +4937,20 @@ dxf_dimstyle_set_dimalttz
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimalttz < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed in the dimalttz variable.\n")),
                   __FUNCTION__);
         }
         if (dimalttz > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed in the dimalttz variable.\n")),
                   __FUNCTION__);
         }
@@ -4975,20 +4982,20 @@ dxf_dimstyle_get_dimfit
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimfit < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the dimfit member.\n")),
                   __FUNCTION__);
         }
         if (dimstyle->dimfit > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the dimfit member.\n")),
                   __FUNCTION__);
         }
@@ -5020,20 +5027,20 @@ dxf_dimstyle_set_dimfit
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimfit < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed in the dimfit variable.\n")),
                   __FUNCTION__);
         }
         if (dimfit > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed in the dimfit variable.\n")),
                   __FUNCTION__);
         }
@@ -5066,20 +5073,20 @@ dxf_dimstyle_get_dimupt
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dimstyle->dimupt < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the dimupt member.\n")),
                   __FUNCTION__);
         }
         if (dimstyle->dimupt > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the dimupt member.\n")),
                   __FUNCTION__);
         }
@@ -5111,20 +5118,20 @@ dxf_dimstyle_set_dimupt
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimupt < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed in the dimupt variable.\n")),
                   __FUNCTION__);
         }
         if (dimupt > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed in the dimupt variable.\n")),
                   __FUNCTION__);
         }
@@ -5156,7 +5163,7 @@ dxf_dimstyle_get_dimtxsty
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5164,7 +5171,7 @@ dxf_dimstyle_get_dimtxsty
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (dimstyle->dimtxsty));
+        return (dxf_strdup (dimstyle->dimtxsty));
 }
 
 
@@ -5189,19 +5196,19 @@ dxf_dimstyle_set_dimtxsty
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimtxsty == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dimstyle->dimtxsty = strdup (dimtxsty);
+        dimstyle->dimtxsty = dxf_strdup (dimtxsty);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -5231,14 +5238,14 @@ dxf_dimstyle_get_next
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimstyle->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5271,14 +5278,14 @@ dxf_dimstyle_set_next
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5314,14 +5321,14 @@ dxf_dimstyle_get_last
         /* Do some basic checks. */
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dimstyle->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfDimStyle *) dimstyle);
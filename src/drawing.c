@@ -38,7 +38,9 @@
 /*!
  * \brief Allocate memory for a libDXF \c drawing.
  *
- * Fill the memory contents with zeros.
+ * Fill the memory contents with zeros.\n
+ * The drawing remembers the allocator active in the calling thread,
+ * it is activated again while the drawing is freed.
  *
  * \return \c NULL when no memory was allocated, a pointer to the
  * allocated memory when succesful.
@@ -55,9 +57,9 @@ dxf_drawing_new ()
         size = sizeof (DxfDrawing);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((drawing = malloc (size)) == NULL)
+        if ((drawing = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfDrawing struct.\n")),
                   __FUNCTION__);
                 drawing = NULL;
@@ -65,6 +67,7 @@ dxf_drawing_new ()
         else
         {
                 memset (drawing, 0, size);
+                drawing->allocator = (struct DxfAllocator *) dxf_allocator_get_active ();
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -94,22 +97,51 @@ dxf_drawing_init
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 drawing = dxf_drawing_new ();
         }
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfDrawing struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        /* Allocate the sections which are not there yet. */
+        if (drawing->header == NULL)
+        {
+                drawing->header = (struct DxfHeader *) dxf_header_new ();
+        }
+        if (drawing->class_list == NULL)
+        {
+                drawing->class_list = (struct DxfClass *) dxf_class_new ();
+        }
+        if (drawing->tables_list == NULL)
+        {
+                drawing->tables_list = (struct DxfTables *) dxf_tables_new ();
+        }
+        if (drawing->block_list == NULL)
+        {
+                drawing->block_list = (struct DxfBlock *) dxf_block_new ();
+        }
+        if (drawing->entities_list == NULL)
+        {
+                drawing->entities_list = (struct DxfEntities *) dxf_entities_new ();
+        }
+        if (drawing->object_list == NULL)
+        {
+                drawing->object_list = (struct DxfObject *) dxf_object_new ();
+        }
+        if (drawing->thumbnail == NULL)
+        {
+                drawing->thumbnail = (struct DxfThumbnail *) dxf_thumbnail_new ();
+        }
         dxf_header_init ((DxfHeader *) drawing->header, acad_version_number);
         dxf_class_init ((DxfClass *) drawing->class_list);
+        dxf_tables_init ((DxfTables *) drawing->tables_list);
         dxf_block_init ((DxfBlock *) drawing->block_list);
-        //dxf_entities_init ((DxfEntities *) drawing->entities_list);
         dxf_object_init ((DxfObject *) drawing->object_list);
         dxf_thumbnail_init ((DxfThumbnail *) drawing->thumbnail);
 #if DEBUG
@@ -137,14 +169,49 @@ dxf_drawing_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        dxf_header_free ((DxfHeader *) drawing->header);
-        dxf_class_free_chain ((DxfClass *) drawing->class_list);
-        dxf_block_free_chain ((DxfBlock *) drawing->block_list);
-        //dxf_entities_free_chain ((DxfEntities *) drawing->entities_list);
-        dxf_object_free_chain ((DxfObject *) drawing->object_list);
-        dxf_thumbnail_free ((DxfThumbnail *) drawing->thumbnail);
-        free (drawing);
+        DxfAllocator *previous;
+
+        /* Free with the allocator the drawing was created with. */
+        previous = dxf_allocator_activate ((DxfAllocator *) drawing->allocator);
+        if (drawing->header != NULL)
+        {
+                dxf_header_free ((DxfHeader *) drawing->header);
+        }
+        if (drawing->class_list != NULL)
+        {
+                dxf_class_free_chain ((DxfClass *) drawing->class_list);
+        }
+        if (drawing->tables_list != NULL)
+        {
+                dxf_tables_free ((DxfTables *) drawing->tables_list);
+        }
+        if (drawing->block_list != NULL)
+        {
+                dxf_block_free_chain ((DxfBlock *) drawing->block_list);
+        }
+        if (drawing->entities_list != NULL)
+        {
+                dxf_entities_free ((DxfEntities *) drawing->entities_list);
+        }
+        if (drawing->object_list != NULL)
+        {
+                dxf_object_free_chain ((DxfObject *) drawing->object_list);
+        }
+        if (drawing->thumbnail != NULL)
+        {
+                dxf_thumbnail_free ((DxfThumbnail *) drawing->thumbnail);
+        }
+        if (drawing->paged_entities != NULL)
+        {
+                dxf_paged_entities_free ((DxfPagedEntities *) drawing->paged_entities);
+        }
+        if (drawing->raw_section_list != NULL)
+        {
+                dxf_raw_section_free_chain ((DxfRawSection *) drawing->raw_section_list);
+        }
+        dxf_free (drawing);
         drawing = NULL;
+        dxf_allocator_activate (previous);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -172,14 +239,14 @@ dxf_drawing_get_header
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (drawing->header ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the header member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -214,14 +281,14 @@ dxf_drawing_set_header
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (header == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -254,14 +321,14 @@ dxf_drawing_get_class_list
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (drawing->class_list ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the class_list member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -296,14 +363,14 @@ dxf_drawing_set_class_list
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class_list == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -336,14 +403,14 @@ dxf_drawing_get_tables_list
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (drawing->tables_list ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the tables_list member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -378,14 +445,14 @@ dxf_drawing_set_tables_list
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (tables_list == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -418,14 +485,14 @@ dxf_drawing_get_block_list
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (drawing->block_list ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the block_list member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -460,14 +527,14 @@ dxf_drawing_set_block_list
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (block_list == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -501,14 +568,14 @@ dxf_drawing_get_entities_list
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (drawing->entities_list ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the entities_list member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -543,14 +610,14 @@ dxf_drawing_set_entities_list
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (entities_list == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -584,14 +651,14 @@ dxf_drawing_get_object_list
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (drawing->object_list ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the object_list member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -626,14 +693,14 @@ dxf_drawing_set_object_list
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object_list == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -666,14 +733,14 @@ dxf_drawing_get_thumbnail
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (drawing->thumbnail ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the thumbnail member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -708,14 +775,14 @@ dxf_drawing_set_thumbnail
         /* Do some basic checks. */
         if (drawing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thumbnail == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -727,5 +794,201 @@ dxf_drawing_set_thumbnail
         return (drawing);
 }
 
+/*!
+ * \brief Get the out-of-core entities from a libDXF drawing.
+ *
+ * \return \c paged_entities when sucessful, \c NULL when an error
+ * occurred or the drawing is kept in memory.
+ */
+DxfPagedEntities *
+dxf_drawing_get_paged_entities
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPagedEntities *result = NULL;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        result = (DxfPagedEntities *) drawing->paged_entities;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Set the out-of-core entities for a libDXF drawing.
+ *
+ * The drawing takes ownership of \c paged_entities, it is freed by
+ * dxf_drawing_free ().
+ *
+ * \return a pointer to the libDXF drawing when OK, \c NULL when an
+ * error occurred.
+ */
+DxfDrawing *
+dxf_drawing_set_paged_entities
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfPagedEntities *paged_entities
+                /*!< a pointer to the out-of-core entities for the
+                 * libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (paged_entities == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->paged_entities = (struct DxfPagedEntities *) paged_entities;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
+/*!
+ * \brief Get the raw sections from a libDXF drawing.
+ *
+ * \return \c raw_section_list when sucessful, \c NULL when an error
+ * occurred or the drawing has no raw sections.
+ */
+DxfRawSection *
+dxf_drawing_get_raw_section_list
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRawSection *result = NULL;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        result = (DxfRawSection *) drawing->raw_section_list;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Set the raw sections for a libDXF drawing.
+ *
+ * The drawing takes ownership of \c raw_section_list, it is freed by
+ * dxf_drawing_free ().\n
+ * A raw \c OBJECTS section replaces the objects of the drawing when it
+ * is written.
+ *
+ * \return a pointer to the libDXF drawing when OK, \c NULL when an
+ * error occurred.
+ */
+DxfDrawing *
+dxf_drawing_set_raw_section_list
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfRawSection *raw_section_list
+                /*!< a pointer to the raw sections for the libDXF
+                 * drawing (single linked list). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (raw_section_list == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->raw_section_list = (struct DxfRawSection *) raw_section_list;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
+/*!
+ * \brief Get the allocator of a libDXF drawing.
+ *
+ * Activate it with dxf_allocator_activate () while adding data to the
+ * drawing.
+ *
+ * \return a pointer to the allocator, \c NULL when the drawing uses
+ * the process wide allocator or an error occurred.
+ */
+DxfAllocator *
+dxf_drawing_get_allocator
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfAllocator *result = NULL;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        result = (DxfAllocator *) drawing->allocator;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
 
 /* EOF*/
@@ -45,6 +45,8 @@
 #include "entities.h"
 #include "object.h"
 #include "thumbnail.h"
+#include "paged_entities.h"
+#include "raw_data.h"
 
 
 #ifdef __cplusplus
@@ -72,6 +74,15 @@ dxf_drawing_struct
         /*!< Objects section data (single linked list).*/
     struct DxfThumbnail *thumbnail;
         /*!< Thumbnail data.*/
+    struct DxfPagedEntities *paged_entities;
+        /*!< Out-of-core entities section data, \c NULL when the
+         * drawing is kept in memory.*/
+    struct DxfRawSection *raw_section_list;
+        /*!< Sections which are not modeled, written as they were
+         * read (single linked list).*/
+    struct DxfAllocator *allocator;
+        /*!< Allocator that was active when the drawing was created,
+         * \c NULL for the process wide allocator.*/
 } DxfDrawing;
 
 
@@ -92,6 +103,11 @@ DxfObject *dxf_drawing_get_object_list (DxfDrawing *drawing);
 DxfDrawing *dxf_drawing_set_object_list (DxfDrawing *drawing, DxfObject *object_list);
 DxfThumbnail *dxf_drawing_get_thumbnail (DxfDrawing *drawing);
 DxfDrawing *dxf_drawing_set_thumbnail (DxfDrawing *drawing, DxfThumbnail *thumbnail);
+DxfPagedEntities *dxf_drawing_get_paged_entities (DxfDrawing *drawing);
+DxfDrawing *dxf_drawing_set_paged_entities (DxfDrawing *drawing, DxfPagedEntities *paged_entities);
+DxfRawSection *dxf_drawing_get_raw_section_list (DxfDrawing *drawing);
+DxfDrawing *dxf_drawing_set_raw_section_list (DxfDrawing *drawing, DxfRawSection *raw_section_list);
+DxfAllocator *dxf_drawing_get_allocator (DxfDrawing *drawing);
 
 
 #ifdef __cplusplus
@@ -41,36 +41,48 @@
 #include "3dline.h"
 #include "3dsolid.h"
 #include "acad_proxy_entity.h"
+#include "allocator.h"
 #include "appid.h"
 #include "arc.h"
 #include "attdef.h"
 #include "attrib.h"
+#include "binary_data.h"
 #include "binary_entity_data.h"
 #include "binary_graphics_data.h"
 #include "block.h"
 #include "block_record.h"
 #include "body.h"
+#include "cache.h"
 #include "circle.h"
 #include "class.h"
 #include "color.h"
 #include "comment.h"
+#include "diagnostics.h"
 #include "dictionary.h"
 #include "dictionaryvar.h"
+#include "diff.h"
 #include "dimension.h"
 #include "dimstyle.h"
 #include "donut.h"
+#include "drawing.h"
 #include "ellipse.h"
 #include "endblk.h"
 #include "endsec.h"
 #include "endtab.h"
 #include "entities.h"
 #include "entity.h"
+#include "entity_vtable.h"
 #include "file.h"
+#include "fingerprint.h"
 #include "global.h"
 #include "group.h"
+#include "hash.h"
 #include "hatch.h"
+#include "hatch_fill.h"
+#include "hatch_region.h"
 #include "header.h"
 #include "helix.h"
+#include "hex.h"
 #include "idbuffer.h"
 #include "image.h"
 #include "imagedef.h"
@@ -82,19 +94,26 @@
 #include "line.h"
 #include "ltype.h"
 #include "lwpolyline.h"
+#include "memory_writer.h"
 #include "mline.h"
 #include "mlinestyle.h"
 #include "mtext.h"
+#include "nurbs.h"
 #include "object.h"
 #include "object_ptr.h"
 #include "oleframe.h"
 #include "ole2frame.h"
+#include "paged_entities.h"
 #include "param.h"
 #include "point.h"
 #include "polyline.h"
+#include "pool.h"
 #include "rastervariables.h"
+#include "raw_data.h"
+#include "raw_entity.h"
 #include "ray.h"
 #include "region.h"
+#include "sat.h"
 #include "section.h"
 #include "seqend.h"
 #include "shape.h"
@@ -102,13 +121,16 @@
 #include "sortentstable.h"
 #include "spatial_filter.h"
 #include "spatial_index.h"
+#include "stream.h"
 #include "style.h"
 #include "table.h"
 #include "tables.h"
+#include "tessellation.h"
 #include "text.h"
 #include "thumbnail.h"
 #include "tolerance.h"
 #include "trace.h"
+#include "tracing.h"
 #include "ucs.h"
 #include "util.h"
 #include "vertex.h"
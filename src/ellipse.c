@@ -40,6 +40,7 @@
 
 
 #include "ellipse.h"
+#include "util.h"
 
 
 /*!
@@ -62,9 +63,9 @@ dxf_ellipse_new ()
         size = sizeof (DxfEllipse);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ellipse = malloc (size)) == NULL)
+        if ((ellipse = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfEllipse struct.\n")),
                   __FUNCTION__);
                 ellipse = NULL;
@@ -72,6 +73,8 @@ dxf_ellipse_new ()
         else
         {
                 memset (ellipse, 0, size);
+                ellipse->header.type = ELLIPSE;
+                DXF_TRACING_COUNT (ELLIPSE, DXF_TRACING_ALLOCATIONS, 1);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -100,21 +103,21 @@ dxf_ellipse_init
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ellipse = dxf_ellipse_new ();
         }
         if (ellipse == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfEllipse struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_ellipse_set_id_code (ellipse, 0);
-        dxf_ellipse_set_linetype (ellipse, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_ellipse_set_layer (ellipse, strdup (DXF_DEFAULT_LAYER));
+        dxf_ellipse_set_linetype (ellipse, DXF_DEFAULT_LINETYPE);
+        dxf_ellipse_set_layer (ellipse, DXF_DEFAULT_LAYER);
         dxf_ellipse_set_elevation (ellipse, 0.0);
         dxf_ellipse_set_thickness (ellipse, 0.0);
         dxf_ellipse_set_linetype_scale (ellipse, DXF_DEFAULT_LINETYPE_SCALE);
@@ -124,13 +127,13 @@ dxf_ellipse_init
         dxf_ellipse_set_graphics_data_size (ellipse, 0);
         dxf_ellipse_set_shadow_mode (ellipse, 0);
         dxf_ellipse_set_binary_graphics_data (ellipse, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
-        dxf_ellipse_set_dictionary_owner_soft (ellipse, strdup (""));
-        dxf_ellipse_set_material (ellipse, strdup (""));
-        dxf_ellipse_set_dictionary_owner_hard (ellipse, strdup (""));
+        dxf_ellipse_set_dictionary_owner_soft (ellipse, "");
+        dxf_ellipse_set_material (ellipse, "");
+        dxf_ellipse_set_dictionary_owner_hard (ellipse, "");
         dxf_ellipse_set_lineweight (ellipse, 0);
-        dxf_ellipse_set_plot_style_name (ellipse, strdup (""));
+        dxf_ellipse_set_plot_style_name (ellipse, "");
         dxf_ellipse_set_color_value (ellipse, 0);
-        dxf_ellipse_set_color_name (ellipse, strdup (""));
+        dxf_ellipse_set_color_name (ellipse, "");
         dxf_ellipse_set_transparency (ellipse, 0);
         dxf_ellipse_set_p0 (ellipse, (DxfPoint *) dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_ellipse_get_p0 (ellipse));
@@ -156,6 +159,79 @@ dxf_ellipse_init
 }
 
 
+/*!
+ * \brief Reset a DXF \c ELLIPSE entity to the values set by
+ * \c dxf_ellipse_init (), reusing its allocated members.
+ *
+ * The center point \c p0 and the end point of the major axis \c p1
+ * stay allocated.\n
+ * The link to the next entity is kept.
+ *
+ * \return a pointer to the DXF \c ELLIPSE entity, or a newly allocated
+ * and initialized one when \c NULL was passed.
+ */
+DxfEllipse *
+dxf_ellipse_reset
+(
+        DxfEllipse *ellipse
+                /*!< a pointer to the DXF \c ELLIPSE entity, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (ellipse == NULL)
+        {
+                return (dxf_ellipse_init (dxf_ellipse_new ()));
+        }
+        ellipse->id_code = 0;
+        dxf_string_assign (&ellipse->linetype, DXF_DEFAULT_LINETYPE);
+        dxf_string_assign (&ellipse->layer, DXF_DEFAULT_LAYER);
+        ellipse->elevation = 0.0;
+        ellipse->thickness = 0.0;
+        ellipse->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
+        ellipse->visibility = DXF_DEFAULT_VISIBILITY;
+        ellipse->color = DXF_COLOR_BYLAYER;
+        ellipse->paperspace = DXF_MODELSPACE;
+        ellipse->graphics_data_size = 0;
+        ellipse->shadow_mode = 0;
+        if (ellipse->binary_graphics_data == NULL)
+        {
+                ellipse->binary_graphics_data = dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+        }
+        else
+        {
+                dxf_binary_graphics_data_reset (ellipse->binary_graphics_data);
+        }
+        dxf_string_assign (&ellipse->dictionary_owner_soft, "");
+        dxf_string_assign (&ellipse->material, "");
+        dxf_string_assign (&ellipse->dictionary_owner_hard, "");
+        ellipse->lineweight = 0;
+        dxf_string_assign (&ellipse->plot_style_name, "");
+        ellipse->color_value = 0;
+        dxf_string_assign (&ellipse->color_name, "");
+        ellipse->transparency = 0;
+        ellipse->p0 = dxf_point_reset (ellipse->p0);
+        ellipse->p1 = dxf_point_reset (ellipse->p1);
+        ellipse->x0 = 0.0;
+        ellipse->y0 = 0.0;
+        ellipse->z0 = 0.0;
+        ellipse->x1 = 0.0;
+        ellipse->y1 = 0.0;
+        ellipse->z1 = 0.0;
+        ellipse->ratio = 0.0;
+        ellipse->start_angle = 0.0;
+        ellipse->end_angle = 0.0;
+        ellipse->extr_x0 = 0.0;
+        ellipse->extr_y0 = 0.0;
+        ellipse->extr_z0 = 0.0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (ellipse);
+}
+
+
 /*!
  * \brief Read data from a DXF file into a DXF \c ELLIPSE entity.
  *
@@ -179,38 +255,36 @@ dxf_ellipse_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ellipse = dxf_ellipse_new ();
                 ellipse = dxf_ellipse_init (ellipse);
         }
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (ELLIPSE, fp);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -225,13 +299,13 @@ dxf_ellipse_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ellipse->linetype);
+                        dxf_read_string (fp, &ellipse->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ellipse->layer);
+                        dxf_read_string (fp, &ellipse->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -356,7 +430,7 @@ dxf_ellipse_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbEllipse") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -387,14 +461,14 @@ dxf_ellipse_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ellipse->dictionary_owner_soft);
+                        dxf_read_string (fp, &ellipse->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ellipse->dictionary_owner_hard);
+                        dxf_read_string (fp, &ellipse->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -405,22 +479,27 @@ dxf_ellipse_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ellipse->linetype, "") == 0)
         {
-                ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_string_assign (&ellipse->linetype, DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ellipse->layer, "") == 0)
         {
-                ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_string_assign (&ellipse->layer, DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
+        DXF_TRACING_ENTITY_END (ELLIPSE, fp, trace_offset);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -449,64 +528,64 @@ dxf_ellipse_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ELLIPSE");
+        char *dxf_entity_name = dxf_strdup ("ELLIPSE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ellipse->ratio == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () ratio value equals 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ellipse->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (ellipse->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ellipse->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ellipse->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ellipse->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ellipse->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ellipse->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                ellipse->layer = strdup (DXF_DEFAULT_LAYER);
+                ellipse->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -555,12 +634,12 @@ dxf_ellipse_write
           && DXF_FLATLAND
           && (ellipse->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", ellipse->elevation);
+                dxf_write_real (fp, 38, ellipse->elevation);
         }
         if ((fp->acad_version_number <= AutoCAD_13)
           && (ellipse->thickness != 0.0))
         {
-                fprintf (fp->fp, " 39\n%f\n", ellipse->thickness);
+                dxf_write_real (fp, 39, ellipse->thickness);
         }
         if (ellipse->color != DXF_COLOR_BYLAYER)
         {
@@ -568,7 +647,7 @@ dxf_ellipse_write
         }
         if (ellipse->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", ellipse->linetype_scale);
+                dxf_write_real (fp, 48, ellipse->linetype_scale);
         }
         if (ellipse->visibility != 0)
         {
@@ -578,20 +657,20 @@ dxf_ellipse_write
         {
                 fprintf (fp->fp, "100\nAcDbEllipse\n");
         }
-        fprintf (fp->fp, " 10\n%f\n", ellipse->x0);
-        fprintf (fp->fp, " 20\n%f\n", ellipse->y0);
-        fprintf (fp->fp, " 30\n%f\n", ellipse->z0);
-        fprintf (fp->fp, " 11\n%f\n", ellipse->x1);
-        fprintf (fp->fp, " 21\n%f\n", ellipse->y1);
-        fprintf (fp->fp, " 31\n%f\n", ellipse->z1);
-        fprintf (fp->fp, " 210\n%f\n", ellipse->extr_x0);
-        fprintf (fp->fp, " 220\n%f\n", ellipse->extr_y0);
-        fprintf (fp->fp, " 230\n%f\n", ellipse->extr_z0);
-        fprintf (fp->fp, " 40\n%f\n", ellipse->ratio);
-        fprintf (fp->fp, " 41\n%f\n", ellipse->start_angle);
-        fprintf (fp->fp, " 42\n%f\n", ellipse->end_angle);
+        dxf_write_real (fp, 10, ellipse->x0);
+        dxf_write_real (fp, 20, ellipse->y0);
+        dxf_write_real (fp, 30, ellipse->z0);
+        dxf_write_real (fp, 11, ellipse->x1);
+        dxf_write_real (fp, 21, ellipse->y1);
+        dxf_write_real (fp, 31, ellipse->z1);
+        dxf_write_real (fp, 210, ellipse->extr_x0);
+        dxf_write_real (fp, 220, ellipse->extr_y0);
+        dxf_write_real (fp, 230, ellipse->extr_z0);
+        dxf_write_real (fp, 40, ellipse->ratio);
+        dxf_write_real (fp, 41, ellipse->start_angle);
+        dxf_write_real (fp, 42, ellipse->end_angle);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -619,16 +698,22 @@ dxf_ellipse_free
 #endif
         if (ellipse->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfEllipse was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (ellipse->linetype);
-        free (ellipse->layer);
-        free (ellipse->dictionary_owner_soft);
-        free (ellipse->dictionary_owner_hard);
-        free (ellipse);
+        dxf_free (ellipse->linetype);
+        dxf_free (ellipse->layer);
+        dxf_binary_graphics_data_free_chain (ellipse->binary_graphics_data);
+        dxf_free (ellipse->dictionary_owner_soft);
+        dxf_free (ellipse->material);
+        dxf_free (ellipse->dictionary_owner_hard);
+        dxf_free (ellipse->plot_style_name);
+        dxf_free (ellipse->color_name);
+        dxf_point_free (ellipse->p0);
+        dxf_point_free (ellipse->p1);
+        dxf_free (ellipse);
         ellipse = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -648,18 +733,19 @@ dxf_ellipse_free_chain
                 /*!< pointer to the chain of DXF \c ELLIPSE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (ellipses == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (ellipses != NULL)
         {
                 struct DxfEllipse *iter = ellipses->next;
+                ellipses->next = NULL;
                 dxf_ellipse_free (ellipses);
                 ellipses = (DxfEllipse *) iter;
         }
@@ -687,14 +773,14 @@ dxf_ellipse_get_id_code
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -726,14 +812,14 @@ dxf_ellipse_set_id_code
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -764,14 +850,14 @@ dxf_ellipse_get_linetype
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -779,7 +865,7 @@ dxf_ellipse_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->linetype));
+        return (dxf_strdup (ellipse->linetype));
 }
 
 
@@ -801,19 +887,19 @@ dxf_ellipse_set_linetype
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->linetype = strdup (linetype);
+        ellipse->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -839,14 +925,14 @@ dxf_ellipse_get_layer
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -854,7 +940,7 @@ dxf_ellipse_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->layer));
+        return (dxf_strdup (ellipse->layer));
 }
 
 
@@ -876,19 +962,19 @@ dxf_ellipse_set_layer
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->layer = strdup (layer);
+        ellipse->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -914,7 +1000,7 @@ dxf_ellipse_get_elevation
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -944,7 +1030,7 @@ dxf_ellipse_set_elevation
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -975,14 +1061,14 @@ dxf_ellipse_get_thickness
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1012,14 +1098,14 @@ dxf_ellipse_set_thickness
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1050,14 +1136,14 @@ dxf_ellipse_get_linetype_scale
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1087,14 +1173,14 @@ dxf_ellipse_set_linetype_scale
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative linetype scale value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1125,21 +1211,21 @@ dxf_ellipse_get_visibility
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1169,21 +1255,21 @@ dxf_ellipse_set_visibility
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1214,14 +1300,14 @@ dxf_ellipse_get_color
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1250,17 +1336,17 @@ dxf_ellipse_set_color
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         ellipse->color = color;
@@ -1289,20 +1375,20 @@ dxf_ellipse_get_paperspace
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (ellipse->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1331,21 +1417,21 @@ dxf_ellipse_set_paperspace
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1378,20 +1464,20 @@ dxf_ellipse_get_graphics_data_size
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
         if (ellipse->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
@@ -1425,21 +1511,21 @@ dxf_ellipse_set_graphics_data_size
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1470,21 +1556,21 @@ dxf_ellipse_get_shadow_mode
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1517,21 +1603,21 @@ dxf_ellipse_set_shadow_mode
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1565,14 +1651,14 @@ dxf_ellipse_get_binary_graphics_data
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1604,14 +1690,14 @@ dxf_ellipse_set_binary_graphics_data
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1645,14 +1731,14 @@ dxf_ellipse_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1660,7 +1746,7 @@ dxf_ellipse_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->dictionary_owner_soft));
+        return (dxf_strdup (ellipse->dictionary_owner_soft));
 }
 
 
@@ -1684,19 +1770,19 @@ dxf_ellipse_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ellipse->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1725,14 +1811,14 @@ dxf_ellipse_get_material
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the material member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1740,7 +1826,7 @@ dxf_ellipse_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->material));
+        return (dxf_strdup (ellipse->material));
 }
 
 
@@ -1766,19 +1852,19 @@ dxf_ellipse_set_material
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->material = strdup (material);
+        ellipse->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1807,14 +1893,14 @@ dxf_ellipse_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1822,7 +1908,7 @@ dxf_ellipse_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->dictionary_owner_hard));
+        return (dxf_strdup (ellipse->dictionary_owner_hard));
 }
 
 
@@ -1846,19 +1932,19 @@ dxf_ellipse_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ellipse->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1885,7 +1971,7 @@ dxf_ellipse_get_lineweight
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1918,7 +2004,7 @@ dxf_ellipse_set_lineweight
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1950,14 +2036,14 @@ dxf_ellipse_get_plot_style_name
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1965,7 +2051,7 @@ dxf_ellipse_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->plot_style_name));
+        return (dxf_strdup (ellipse->plot_style_name));
 }
 
 
@@ -1991,19 +2077,19 @@ dxf_ellipse_set_plot_style_name
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->plot_style_name = strdup (plot_style_name);
+        ellipse->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2030,7 +2116,7 @@ dxf_ellipse_get_color_value
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2063,7 +2149,7 @@ dxf_ellipse_set_color_value
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2095,14 +2181,14 @@ dxf_ellipse_get_color_name
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2110,7 +2196,7 @@ dxf_ellipse_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ellipse->color_name));
+        return (dxf_strdup (ellipse->color_name));
 }
 
 
@@ -2136,19 +2222,19 @@ dxf_ellipse_set_color_name
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ellipse->color_name = strdup (color_name);
+        ellipse->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2175,7 +2261,7 @@ dxf_ellipse_get_transparency
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2208,7 +2294,7 @@ dxf_ellipse_set_transparency
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2233,20 +2319,20 @@ dxf_ellipse_get_p0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->p0 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -2272,20 +2358,20 @@ dxf_ellipse_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2311,21 +2397,21 @@ dxf_ellipse_get_x0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2354,20 +2440,20 @@ dxf_ellipse_set_x0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2393,21 +2479,21 @@ dxf_ellipse_get_y0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2436,20 +2522,20 @@ dxf_ellipse_set_y0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2475,21 +2561,21 @@ dxf_ellipse_get_z0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2518,20 +2604,20 @@ dxf_ellipse_set_z0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2557,13 +2643,13 @@ dxf_ellipse_get_p1
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2590,20 +2676,20 @@ dxf_ellipse_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2629,21 +2715,21 @@ dxf_ellipse_get_x1
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2671,20 +2757,20 @@ dxf_ellipse_set_x1
                 /*!< the X-value \c x1 of a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2710,21 +2796,21 @@ dxf_ellipse_get_y1
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2752,20 +2838,20 @@ dxf_ellipse_set_y1
                 /*!< the Y-value \c y1 of a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2791,21 +2877,21 @@ dxf_ellipse_get_z1
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2833,20 +2919,20 @@ dxf_ellipse_set_z1
                 /*!< the Z-value \c z1 of a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2878,21 +2964,21 @@ dxf_ellipse_get_ratio
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->ratio < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the ratio member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->ratio == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was found in the ratio member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2919,13 +3005,13 @@ dxf_ellipse_set_ratio
                 /*!< the \c ratio of a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2956,7 +3042,7 @@ dxf_ellipse_get_start_angle
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2986,7 +3072,7 @@ dxf_ellipse_set_start_angle
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3017,7 +3103,7 @@ dxf_ellipse_get_end_angle
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3047,7 +3133,7 @@ dxf_ellipse_set_end_angle
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3073,14 +3159,14 @@ dxf_ellipse_get_extr_x0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3109,13 +3195,13 @@ dxf_ellipse_set_extr_x0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3141,14 +3227,14 @@ dxf_ellipse_get_extr_y0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3177,13 +3263,13 @@ dxf_ellipse_set_extr_y0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3209,14 +3295,14 @@ dxf_ellipse_get_extr_z0
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3245,13 +3331,13 @@ dxf_ellipse_set_extr_z0
                  * \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3279,7 +3365,7 @@ dxf_ellipse_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c ELLIPSE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3287,7 +3373,7 @@ dxf_ellipse_get_extrusion_vector_as_point
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3295,7 +3381,7 @@ dxf_ellipse_get_extrusion_vector_as_point
         point = dxf_point_init (point);
         if (point == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -3329,14 +3415,14 @@ dxf_ellipse_set_extrusion_vector_from_point
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3373,7 +3459,7 @@ dxf_ellipse_set_extrusion_vector
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3409,14 +3495,14 @@ dxf_ellipse_get_next
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3447,14 +3533,14 @@ dxf_ellipse_set_next
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3488,14 +3574,14 @@ dxf_ellipse_get_last
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfEllipse *) ellipse);
@@ -61,6 +61,9 @@ extern "C" {
 typedef struct
 dxf_ellipse_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -241,6 +244,7 @@ dxf_ellipse_struct
 
 DxfEllipse *dxf_ellipse_new ();
 DxfEllipse *dxf_ellipse_init (DxfEllipse *ellipse);
+DxfEllipse *dxf_ellipse_reset (DxfEllipse *ellipse);
 DxfEllipse *dxf_ellipse_read (DxfFile *fp, DxfEllipse *ellipse);
 int dxf_ellipse_write (DxfFile *fp, DxfEllipse *ellipse);
 int dxf_ellipse_free (DxfEllipse *ellipse);
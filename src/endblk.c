@@ -61,9 +61,9 @@ dxf_endblk_new ()
         size = sizeof (DxfEndblk);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((endblk = malloc (size)) == NULL)
+        if ((endblk = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfEndblk struct.\n")),
                   __FUNCTION__);
                 endblk = NULL;
@@ -105,21 +105,21 @@ dxf_endblk_init
         /* Do some basic checks. */
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 endblk = dxf_endblk_new ();
         }
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfEndblk struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_endblk_set_id_code (endblk, 0);
-        dxf_endblk_set_layer (endblk, strdup (DXF_DEFAULT_LAYER));
-        dxf_endblk_set_dictionary_owner_soft (endblk, strdup (""));
+        dxf_endblk_set_layer (endblk, dxf_strdup (DXF_DEFAULT_LAYER));
+        dxf_endblk_set_dictionary_owner_soft (endblk, dxf_strdup (""));
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -161,37 +161,33 @@ dxf_endblk_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 endblk = dxf_endblk_new ();
                 endblk = dxf_endblk_init (endblk);
         }
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 else if (strcmp (temp_string, "5") == 0)
@@ -203,13 +199,13 @@ dxf_endblk_read
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        fscanf (fp->fp, "%s\n", endblk->layer);
+                        dxf_read_string (fp, &endblk->layer);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner object. */
-                        fscanf (fp->fp, "%s\n", endblk->dictionary_owner_soft);
+                        dxf_read_string (fp, &endblk->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -219,18 +215,22 @@ dxf_endblk_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle ommitted members and/or illegal values. */
         if (strcmp (endblk->layer, "") == 0)
         {
-                endblk->layer = strdup (DXF_DEFAULT_LAYER);
+                endblk->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -265,14 +265,14 @@ dxf_endblk_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -329,9 +329,9 @@ dxf_endblk_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        free (dxf_endblk_get_layer (endblk));
-        free (dxf_endblk_get_dictionary_owner_soft (endblk));
-        free (endblk);
+        dxf_free (dxf_endblk_get_layer (endblk));
+        dxf_free (dxf_endblk_get_dictionary_owner_soft (endblk));
+        dxf_free (endblk);
         endblk = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -366,14 +366,14 @@ dxf_endblk_get_id_code
         /* Do some basic checks. */
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (endblk->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -412,14 +412,14 @@ dxf_endblk_set_id_code
         /* Do some basic checks. */
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -458,19 +458,19 @@ dxf_endblk_get_layer
         /* Do some basic checks. */
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (endblk->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (endblk->layer);
+        result = dxf_strdup (endblk->layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -502,19 +502,19 @@ dxf_endblk_set_layer
         /* Do some basic checks. */
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        endblk->layer = strdup (layer);
+        endblk->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -551,19 +551,19 @@ dxf_endblk_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (endblk->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (endblk->dictionary_owner_soft);
+        result = dxf_strdup (endblk->dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -597,19 +597,19 @@ dxf_endblk_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        endblk->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        endblk->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
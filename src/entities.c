@@ -52,6 +52,877 @@
 
 
 #include "entities.h"
+#include "entity_vtable.h"
+#include "section.h"
+#include "endsec.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+
+#define DXF_ENTITIES_MIN_CAPACITY 256
+        /*!< \brief Initial number of pointers in the file order vector of
+         * a \c DxfEntities container. */
+
+#define DXF_ENTITIES_WRITE_CHUNK_SIZE 8192
+        /*!< \brief Number of entities formatted by a thread at a time
+         * in \c dxf_entities_write_parallel (). */
+
+#define DXF_ENTITIES_MAX_THREADS 64
+        /*!< \brief Maximum number of threads of
+         * \c dxf_entities_write_parallel (). */
+
+
+/*!
+ * \brief Range of entities formatted by a thread into its own buffer.
+ */
+typedef struct
+dxf_entities_write_job_struct
+{
+        DxfEntities *entities;
+                /*!< The entities container. */
+        size_t first;
+                /*!< Index of the first entity. */
+        size_t last;
+                /*!< Index after the last entity. */
+        DxfFile file;
+                /*!< Copy of the output file, writing to \c buffer. */
+        char *buffer;
+                /*!< Buffer of the memory stream of \c file. */
+        size_t size;
+                /*!< Size of the memory stream of \c file. */
+        size_t length;
+                /*!< Number of characters formatted in \c buffer. */
+        DxfDiagnostics *diagnostics;
+                /*!< Diagnostics of the range, deferred until the
+                 * range is written. */
+        int result;
+                /*!< \c EXIT_SUCCESS, or \c EXIT_FAILURE when one or
+                 * more entities could not be written. */
+} DxfEntitiesWriteJob;
+
+
+/*!
+ * \brief Allocate memory for a DXF entities container.
+ *
+ * Fill the memory contents with zeros.
+ *
+ * \return a pointer to the container, or \c NULL when an error
+ * occurred.
+ */
+DxfEntities *
+dxf_entities_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntities *entities = NULL;
+        size_t size;
+
+        size = sizeof (DxfEntities);
+        if ((entities = dxf_malloc (size)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfEntities struct.\n")),
+                  __FUNCTION__);
+                entities = NULL;
+        }
+        else
+        {
+                memset (entities, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entities);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF entities container, and
+ * all entities in its typed lists.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_free
+(
+        DxfEntities *entities
+                /*!< a pointer to the DXF entities container. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityVtable *vtable;
+        void **list;
+        void *entity;
+        void *next;
+        int type;
+
+        if (entities == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (type = 0; type < DXF_NUMBER_OF_ENTITY_TYPES; type++)
+        {
+                if ((vtable = dxf_entity_get_vtable ((DxfEntityType) type)) == NULL)
+                {
+                        continue;
+                }
+                list = (void **) ((char *) entities + vtable->list_offset);
+                for (entity = *list; entity != NULL; entity = next)
+                {
+                        next = *(void **) ((char *) entity + vtable->next_offset);
+                        *(void **) ((char *) entity + vtable->next_offset) = NULL;
+                        vtable->free (entity);
+                }
+                *list = NULL;
+        }
+        dxf_free (entities->entities);
+        dxf_free (entities);
+        entities = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append an entity of any type to a DXF entities container.
+ *
+ * The entity is linked at the end of the typed list for its type, and
+ * its pointer is appended to the file order vector of the container.\n
+ * The container owns the entity from here on.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_append
+(
+        DxfEntities *entities,
+                /*!< a pointer to the DXF entities container. */
+        void *entity
+                /*!< a pointer to the entity, its \c next member has to
+                 * be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityVtable *vtable;
+        DxfEntityType type;
+        void **list;
+        void *last;
+        void **vector;
+        size_t capacity;
+
+        if ((entities == NULL) || (entity == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        type = DXF_ENTITY_HEADER (entity)->type;
+        if ((vtable = dxf_entity_get_vtable (type)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an entity of an unsupported type %d was passed.\n")),
+                  __FUNCTION__, (int) type);
+                return (EXIT_FAILURE);
+        }
+        if (*(void **) ((char *) entity + vtable->next_offset) != NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () pointer to next entity was not NULL.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (entities->number_of_entities == entities->capacity)
+        {
+                capacity = (entities->capacity == 0)
+                  ? DXF_ENTITIES_MIN_CAPACITY
+                  : 2 * entities->capacity;
+                vector = dxf_realloc (entities->entities, capacity * sizeof (void *));
+                if (vector == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for the entities.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                entities->entities = vector;
+                entities->capacity = capacity;
+        }
+        list = (void **) ((char *) entities + vtable->list_offset);
+        last = entities->last[type];
+        if ((last == NULL) && (*list != NULL))
+        {
+                /* Find the end of a list built before the first append. */
+                for (last = *list;
+                  *(void **) ((char *) last + vtable->next_offset) != NULL;
+                  last = *(void **) ((char *) last + vtable->next_offset));
+        }
+        if (last == NULL)
+        {
+                *list = entity;
+        }
+        else
+        {
+                *(void **) ((char *) last + vtable->next_offset) = entity;
+        }
+        entities->last[type] = entity;
+        entities->entities[entities->number_of_entities++] = entity;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of entities in the file order vector of a DXF
+ * entities container.
+ *
+ * \return the number of entities.
+ */
+size_t
+dxf_entities_get_number_of_entities
+(
+        DxfEntities *entities
+                /*!< a pointer to the DXF entities container. */
+)
+{
+        if (entities == NULL)
+        {
+                return (0);
+        }
+        return (entities->number_of_entities);
+}
+
+
+/*!
+ * \brief Get an entity from the file order vector of a DXF entities
+ * container.
+ *
+ * \return a pointer to the entity, or \c NULL when the index is out of
+ * range.
+ */
+void *
+dxf_entities_get_entity
+(
+        DxfEntities *entities,
+                /*!< a pointer to the DXF entities container. */
+        size_t index
+                /*!< index of the entity in file order. */
+)
+{
+        if ((entities == NULL) || (index >= entities->number_of_entities))
+        {
+                return (NULL);
+        }
+        return (entities->entities[index]);
+}
+
+
+/*!
+ * \brief Take all entities out of a DXF entities container, without
+ * freeing them.
+ *
+ * The entities are unlinked from the typed lists and the container is
+ * left empty, the caller owns the returned file order vector (free it
+ * with dxf_free ()) and the entities in it.\n
+ * Only entities added with dxf_entities_append () are in the vector.
+ *
+ * \return the file order vector, or \c NULL when the container was
+ * empty or an error occurred.
+ */
+void **
+dxf_entities_detach
+(
+        DxfEntities *entities,
+                /*!< a pointer to the DXF entities container. */
+        size_t *number_of_entities
+                /*!< the number of entities in the returned vector. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityVtable *vtable;
+        void **vector;
+        void **list;
+        void *entity;
+        void *next;
+        int type;
+
+        if ((entities == NULL) || (number_of_entities == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (type = 0; type < DXF_NUMBER_OF_ENTITY_TYPES; type++)
+        {
+                if ((vtable = dxf_entity_get_vtable ((DxfEntityType) type)) == NULL)
+                {
+                        continue;
+                }
+                list = (void **) ((char *) entities + vtable->list_offset);
+                for (entity = *list; entity != NULL; entity = next)
+                {
+                        next = *(void **) ((char *) entity + vtable->next_offset);
+                        *(void **) ((char *) entity + vtable->next_offset) = NULL;
+                }
+                *list = NULL;
+                entities->last[type] = NULL;
+        }
+        vector = entities->entities;
+        *number_of_entities = entities->number_of_entities;
+        entities->entities = NULL;
+        entities->number_of_entities = 0;
+        entities->capacity = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (vector);
+}
+
+
+/*!
+ * \brief Write a range of the entities of a DXF entities container in
+ * file order on the calling thread, skipping entities with
+ * \c DXF_ENTITY_FLAG_ERASED set.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when one or more
+ * entities could not be written.
+ */
+static int
+dxf_entities_write_serial
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntities *entities,
+                /*!< a pointer to the DXF entities container. */
+        size_t first,
+                /*!< index of the first entity. */
+        size_t last
+                /*!< index after the last entity. */
+)
+{
+        void *entity;
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        for (i = first; i < last; i++)
+        {
+                entity = entities->entities[i];
+                if (DXF_ENTITY_HEADER (entity)->flags & DXF_ENTITY_FLAG_ERASED)
+                {
+                        continue;
+                }
+                if (dxf_entity_write (fp, entity) != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Write the entities of a DXF entities container in file order.
+ *
+ * Entities with \c DXF_ENTITY_FLAG_ERASED set are skipped.\n
+ * When the \c write_threads member of \c fp is larger than 1 the
+ * entities are formatted by \c dxf_entities_write_parallel ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntities *entities
+                /*!< a pointer to the DXF entities container. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        if ((fp == NULL) || (entities == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_entities_write_range (fp, entities, 0, entities->number_of_entities);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Format a range of entities into the buffer of a job, run on
+ * a thread of \c dxf_entities_write_parallel ().
+ */
+static void *
+dxf_entities_run_write_job
+(
+        void *data
+                /*!< the job. */
+)
+{
+        DxfEntitiesWriteJob *job = (DxfEntitiesWriteJob *) data;
+        DxfDiagnostics *previous;
+
+        /* Diagnostics without a file end up with the job as well. */
+        previous = dxf_diagnostics_get_default ();
+        dxf_diagnostics_set_default (job->diagnostics);
+        fseeko (job->file.fp, 0, SEEK_SET);
+        job->result = dxf_entities_write_serial (&job->file, job->entities,
+          job->first, job->last);
+        fflush (job->file.fp);
+        job->length = (size_t) ftello (job->file.fp);
+        dxf_diagnostics_set_default (previous);
+        return (NULL);
+}
+
+
+/*!
+ * \brief Write the buffers of the jobs to a stream, in job order.
+ *
+ * Streams backed by a file descriptor are written with a single
+ * \c writev () where possible, other streams with \c fwrite ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_entities_write_jobs
+(
+        FILE *stream,
+                /*!< the output stream. */
+        DxfEntitiesWriteJob *jobs,
+                /*!< the jobs. */
+        int number_of_jobs
+                /*!< number of jobs. */
+)
+{
+        struct iovec iov[DXF_ENTITIES_MAX_THREADS];
+        ssize_t written;
+        off_t offset;
+        int number_of_buffers = 0;
+        int first = 0;
+        int fd;
+        int k;
+
+        for (k = 0; k < number_of_jobs; k++)
+        {
+                if (jobs[k].length > 0)
+                {
+                        iov[number_of_buffers].iov_base = jobs[k].buffer;
+                        iov[number_of_buffers].iov_len = jobs[k].length;
+                        number_of_buffers++;
+                }
+        }
+        if (number_of_buffers == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (fflush (stream) != 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        fd = fileno (stream);
+        if (fd < 0)
+        {
+                for (k = 0; k < number_of_buffers; k++)
+                {
+                        if (fwrite (iov[k].iov_base, 1, iov[k].iov_len, stream) != iov[k].iov_len)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                return (EXIT_SUCCESS);
+        }
+        while (first < number_of_buffers)
+        {
+                written = writev (fd, &iov[first], number_of_buffers - first);
+                if (written < 0)
+                {
+                        if (errno == EINTR)
+                        {
+                                continue;
+                        }
+                        return (EXIT_FAILURE);
+                }
+                /* Skip the buffers written completely. */
+                while ((first < number_of_buffers)
+                  && ((size_t) written >= iov[first].iov_len))
+                {
+                        written -= iov[first].iov_len;
+                        first++;
+                }
+                if (first < number_of_buffers)
+                {
+                        iov[first].iov_base = (char *) iov[first].iov_base + written;
+                        iov[first].iov_len -= written;
+                }
+        }
+        /* The stream continues after the data written around it,
+         * this fails harmlessly for pipes. */
+        offset = lseek (fd, 0, SEEK_CUR);
+        if (offset >= 0)
+        {
+                fseeko (stream, offset, SEEK_SET);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write a range of the entities of a DXF entities container in
+ * file order, formatting them on several threads.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_entities_write_parallel_range
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntities *entities,
+                /*!< a pointer to the DXF entities container. */
+        size_t first,
+                /*!< index of the first entity. */
+        size_t last,
+                /*!< index after the last entity. */
+        int number_of_threads
+                /*!< number of threads, or 0 for the number of online
+                 * processors. */
+)
+{
+        DxfEntitiesWriteJob jobs[DXF_ENTITIES_MAX_THREADS];
+        pthread_t threads[DXF_ENTITIES_MAX_THREADS];
+        int started[DXF_ENTITIES_MAX_THREADS];
+        size_t i;
+        int result = EXIT_SUCCESS;
+        int k;
+
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        if (number_of_threads > DXF_ENTITIES_MAX_THREADS)
+        {
+                number_of_threads = DXF_ENTITIES_MAX_THREADS;
+        }
+        if ((number_of_threads <= 1)
+          || ((last - first) <= DXF_ENTITIES_WRITE_CHUNK_SIZE)
+          || (!dxf_allocator_is_system ()))
+        {
+                return (dxf_entities_write_serial (fp, entities, first, last));
+        }
+        memset (jobs, 0, sizeof (jobs));
+        for (k = 0; k < number_of_threads; k++)
+        {
+                jobs[k].entities = entities;
+                jobs[k].file = *fp;
+                jobs[k].file.write_threads = 0;
+                jobs[k].file.fp = open_memstream (&jobs[k].buffer, &jobs[k].size);
+                jobs[k].diagnostics = dxf_diagnostics_init (dxf_diagnostics_new ());
+                jobs[k].file.diagnostics = (struct DxfDiagnostics *) jobs[k].diagnostics;
+                if ((jobs[k].file.fp == NULL)
+                  || (jobs[k].diagnostics == NULL))
+                {
+                        /* Write the entities on the calling thread. */
+                        number_of_threads = 0;
+                        break;
+                }
+                dxf_diagnostics_set_mode (jobs[k].diagnostics, DXF_DIAGNOSTICS_DEFER);
+        }
+        i = first;
+        while ((number_of_threads > 0) && (i < last))
+        {
+                for (k = 0; k < number_of_threads; k++)
+                {
+                        jobs[k].first = i;
+                        jobs[k].last = ((last - i) < DXF_ENTITIES_WRITE_CHUNK_SIZE)
+                          ? last
+                          : i + DXF_ENTITIES_WRITE_CHUNK_SIZE;
+                        i = jobs[k].last;
+                }
+                for (k = 1; k < number_of_threads; k++)
+                {
+                        started[k] = (jobs[k].first < jobs[k].last)
+                          && (pthread_create (&threads[k], NULL, dxf_entities_run_write_job, &jobs[k]) == 0);
+                }
+                dxf_entities_run_write_job (&jobs[0]);
+                for (k = 1; k < number_of_threads; k++)
+                {
+                        if (started[k])
+                        {
+                                pthread_join (threads[k], NULL);
+                        }
+                        else
+                        {
+                                dxf_entities_run_write_job (&jobs[k]);
+                        }
+                }
+                /* Report the diagnostics of the chunks in order. */
+                for (k = 0; k < number_of_threads; k++)
+                {
+                        dxf_diagnostics_replay (jobs[k].diagnostics, fp);
+                        dxf_diagnostics_clear (jobs[k].diagnostics);
+                        if (jobs[k].result != EXIT_SUCCESS)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                }
+                if (dxf_entities_write_jobs (fp->fp, jobs, number_of_threads) != EXIT_SUCCESS)
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not write the entities.\n")),
+                          __FUNCTION__);
+                        result = EXIT_FAILURE;
+                        break;
+                }
+        }
+        /* Clean up. */
+        for (k = 0; k < DXF_ENTITIES_MAX_THREADS; k++)
+        {
+                if (jobs[k].file.fp != NULL)
+                {
+                        fclose (jobs[k].file.fp);
+                }
+                /* The memory stream allocated its buffer with malloc (). */
+                free (jobs[k].buffer);
+                if (jobs[k].diagnostics != NULL)
+                {
+                        dxf_diagnostics_free (jobs[k].diagnostics);
+                }
+        }
+        if (number_of_threads == 0)
+        {
+                result = dxf_entities_write_serial (fp, entities, first, last);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Write the entities of a DXF entities container in file order,
+ * formatting them on several threads.
+ *
+ * The entities are divided in chunks of
+ * \c DXF_ENTITIES_WRITE_CHUNK_SIZE entities, every thread formats a
+ * chunk into its own memory buffer with the \c *_write () function of
+ * the entity, then the buffers are written in order.\n
+ * The output and the order of the diagnostics are identical to those
+ * of \c dxf_entities_write () on a single thread.\n
+ * Allocators need not be thread safe, so the entities are written on
+ * the calling thread when the C library allocator is not in use (see
+ * \c dxf_allocator_is_system ()).
+ *
+ * Entities with \c DXF_ENTITY_FLAG_ERASED set are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_write_parallel
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntities *entities,
+                /*!< a pointer to the DXF entities container. */
+        int number_of_threads
+                /*!< number of threads, or 0 for the number of online
+                 * processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        if ((fp == NULL) || (entities == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_entities_write_parallel_range (fp, entities, 0,
+          entities->number_of_entities, number_of_threads);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Write a range of the entities of a DXF entities container in
+ * file order.
+ *
+ * Entities with \c DXF_ENTITY_FLAG_ERASED set are skipped.\n
+ * When the \c write_threads member of \c fp is larger than 1 the
+ * entities are formatted on several threads, as in
+ * \c dxf_entities_write_parallel ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entities_write_range
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntities *entities,
+                /*!< a pointer to the DXF entities container. */
+        size_t first,
+                /*!< index of the first entity. */
+        size_t last
+                /*!< index after the last entity. */
+)
+{
+        if ((fp == NULL) || (entities == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (last > entities->number_of_entities)
+        {
+                last = entities->number_of_entities;
+        }
+        if (first >= last)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (fp->write_threads > 1)
+        {
+                return (dxf_entities_write_parallel_range (fp, entities,
+                  first, last, fp->write_threads));
+        }
+        return (dxf_entities_write_serial (fp, entities, first, last));
+}
+
+
+/*!
+ * \brief Get the extents of the entities of a DXF entities container.
+ *
+ * Entities with \c DXF_ENTITY_FLAG_ERASED set, and entities of types
+ * without extents are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when none of
+ * the entities has extents.
+ */
+int
+dxf_entities_get_extents
+(
+        DxfEntities *entities,
+                /*!< a pointer to the DXF entities container. */
+        DxfExtents *extents
+                /*!< a pointer to the extents, set on success. */
+)
+{
+        const DxfEntityVtable *vtable;
+        DxfExtents entity_extents;
+        void *entity;
+        size_t i;
+
+        if ((entities == NULL) || (extents == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_init (extents);
+        for (i = 0; i < entities->number_of_entities; i++)
+        {
+                entity = entities->entities[i];
+                if (DXF_ENTITY_HEADER (entity)->flags & DXF_ENTITY_FLAG_ERASED)
+                {
+                        continue;
+                }
+                vtable = dxf_entity_get_vtable (DXF_ENTITY_HEADER (entity)->type);
+                if ((vtable->extents != NULL)
+                  && (vtable->extents (entity, &entity_extents) == EXIT_SUCCESS))
+                {
+                        dxf_extents_add_extents (extents, &entity_extents);
+                }
+        }
+        return (dxf_extents_is_empty (extents) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Transform the entities of a DXF entities container in place.
+ *
+ * Entities with \c DXF_ENTITY_FLAG_ERASED set are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when one or more
+ * entities could not be transformed, these are left unchanged.
+ */
+int
+dxf_entities_transform
+(
+        DxfEntities *entities,
+                /*!< a pointer to the DXF entities container. */
+        const DxfMatrix *matrix
+                /*!< a pointer to the matrix. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        void *entity;
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        if ((entities == NULL) || (matrix == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < entities->number_of_entities; i++)
+        {
+                entity = entities->entities[i];
+                if (DXF_ENTITY_HEADER (entity)->flags & DXF_ENTITY_FLAG_ERASED)
+                {
+                        continue;
+                }
+                if (dxf_entity_transform (entity, matrix) != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
 
 
 /*!
@@ -83,23 +954,48 @@ dxf_entities_read_table
 
 
 /*!
- * \brief Write DXF output to a file for a DXF \c ENTITIES table.
+ * \brief Write DXF output to a file for a DXF \c ENTITIES section.
+ *
+ * Writes the complete section, the entities are written by
+ * \c dxf_entities_write (), a \c NULL container results in an empty
+ * section.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
 dxf_entities_write_table
 (
-        char *dxf_entities_list, 
-        int acad_version_number
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntities *entities
+                /*!< a pointer to the DXF entities container, may be
+                 * \c NULL. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /*! \todo Add code here. */
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_section_write (fp, "ENTITIES");
+        if (entities != NULL)
+        {
+                result = dxf_entities_write (fp, entities);
+        }
+        dxf_endsec_write (fp);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (result);
 }
 
 
@@ -111,10 +111,34 @@ typedef struct dxf_entities_struct
     struct DxfVertex *vertex_list;
     struct DxfViewport *viewport_list;
     //struct DxfWipeout *wipeout_list;
-    //struct DxfXline *xline_list;
+    struct DxfXLine *xline_list;
+    struct DxfRawEntity *raw_entity_list;
+        /*!< Entities of the types which are not modeled, written as
+         * they were read. */
+    void **entities;
+        /*!< Pointers to the entities in the order they were appended
+         * (file order), the typed lists above own the entities. */
+    size_t number_of_entities;
+        /*!< Number of pointers in \c entities. */
+    size_t capacity;
+        /*!< Number of allocated pointers in \c entities. */
+    void *last[DXF_NUMBER_OF_ENTITY_TYPES];
+        /*!< Last entity of each typed list, or \c NULL when not yet
+         * known. */
 } DxfEntities;
 
 
+DxfEntities *dxf_entities_new ();
+int dxf_entities_free (DxfEntities *entities);
+int dxf_entities_append (DxfEntities *entities, void *entity);
+size_t dxf_entities_get_number_of_entities (DxfEntities *entities);
+void *dxf_entities_get_entity (DxfEntities *entities, size_t index);
+void **dxf_entities_detach (DxfEntities *entities, size_t *number_of_entities);
+int dxf_entities_write (DxfFile *fp, DxfEntities *entities);
+int dxf_entities_write_range (DxfFile *fp, DxfEntities *entities, size_t first, size_t last);
+int dxf_entities_write_parallel (DxfFile *fp, DxfEntities *entities, int number_of_threads);
+int dxf_entities_get_extents (DxfEntities *entities, DxfExtents *extents);
+int dxf_entities_transform (DxfEntities *entities, const DxfMatrix *matrix);
 int
 dxf_entities_read_table
 (
@@ -124,12 +148,7 @@ dxf_entities_read_table
        char *dxf_entities_list,
        int acad_version_number
 );
-int
-dxf_entities_write_table
-(
-        char *dxf_entities_list,
-        int acad_version_number
-);
+int dxf_entities_write_table (DxfFile *fp, DxfEntities *entities);
 
 
 #ifdef __cplusplus
@@ -51,6 +51,8 @@ dxf_entity_skip
 #endif
         char answer;
         if (dxf_entity_name == NULL) return (EXIT_FAILURE);
+        DXF_TRACING_COUNT (dxf_tracing_entity_type (dxf_entity_name),
+          DXF_TRACING_SKIPPED, 1);
         if (INTER_ACTIVE_PROMPT)
         {
                 fprintf (stderr,
@@ -64,7 +66,7 @@ dxf_entity_skip
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("    skipping %s entity.\n")), dxf_entity_name);
         }
 #if DEBUG
@@ -90,10 +90,81 @@ dxf_entity_type
         VERTEX,
         VIEWPORT,
         WIPEOUT,
-        XLINE
+        XLINE,
+        MLINE
+                /*!< Added after the other types, to keep their
+                 * values. */
 } DxfEntityType;
 
 
+#define DXF_NUMBER_OF_ENTITY_TYPES (MLINE + 1)
+        /*!< \brief Number of members in \c DxfEntityType. */
+
+#define DXF_ENTITY_FLAG_MODIFIED 0x0001
+        /*!< \brief The entity was changed after it was read. */
+#define DXF_ENTITY_FLAG_ERASED 0x0002
+        /*!< \brief The entity is skipped by the passes over the entities
+         * of a \c DxfEntities container. */
+
+
+/*!
+ * \brief Header common for all DXF entities.
+ *
+ * The header is the first member of every entity struct, so a pointer
+ * to any entity can be cast to a pointer to its header, to find the
+ * type of the entity and from there its \c DxfEntityVtable.
+ */
+typedef struct
+dxf_entity_header_struct
+{
+        DxfEntityType type;
+                /*!< Type of the entity, set by the \c dxf_*_new ()
+                 * function of the entity. */
+        uint32_t flags;
+                /*!< Bitwise OR of \c DXF_ENTITY_FLAG_* values. */
+        uint64_t fingerprint;
+                /*!< Content fingerprint of the entity, 0 when it was
+                 * not computed (see fingerprint.h). */
+} DxfEntityHeader;
+
+
+/*!
+ * \brief Extents (bounding box) of one or more entities.
+ */
+typedef struct
+dxf_extents_struct
+{
+        double min_x;
+                /*!< Minimum X-value. */
+        double min_y;
+                /*!< Minimum Y-value. */
+        double min_z;
+                /*!< Minimum Z-value. */
+        double max_x;
+                /*!< Maximum X-value. */
+        double max_y;
+                /*!< Maximum Y-value. */
+        double max_z;
+                /*!< Maximum Z-value. */
+} DxfExtents;
+
+
+/*!
+ * \brief Affine transformation matrix.
+ *
+ * A point (x, y, z) is transformed into:\n
+ * x' = m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3]\n
+ * y' = m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3]\n
+ * z' = m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3]
+ */
+typedef struct
+dxf_matrix_struct
+{
+        double m[3][4];
+                /*!< Rows of the matrix. */
+} DxfMatrix;
+
+
 int
 dxf_entity_skip
 (
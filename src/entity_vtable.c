@@ -0,0 +1,2240 @@
+/*!
+ * \file entity_vtable.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the libDXF per entity type function tables.
+ *
+ * Every entity struct starts with a \c DxfEntityHeader holding the type
+ * of the entity, so code handling entities of any type takes a
+ * \c void pointer to the entity and dispatches through the
+ * \c DxfEntityVtable of the type, instead of a switch over all entity
+ * types.\n
+ * \n
+ * The handle, layer and color of an entity are read through the member
+ * offsets in the table, they stay in the members of the entity struct
+ * where the readers, writers and accessors of the entity keep them.\n
+ * \n
+ * The extents function is available for the entity types with their
+ * geometry in the entity struct, not for \c 3DSOLID, \c BODY,
+ * \c REGION, \c ACAD_PROXY_ENTITY, \c OLEFRAME and the entities kept
+ * as a \c DxfRawEntity.\n
+ * The transform, clone and fingerprint functions are available for the
+ * \c POINT, \c LINE, \c CIRCLE and \c ARC entities.\n
+ * \n
+ * Entities of the types without a module of their own are kept as a
+ * \c DxfRawEntity, with the type \c UNKNOWN_ENTITY.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "entity_vtable.h"
+#include "entities.h"
+#include "fingerprint.h"
+#include "3dface.h"
+#include "3dsolid.h"
+#include "acad_proxy_entity.h"
+#include "arc.h"
+#include "attdef.h"
+#include "attrib.h"
+#include "body.h"
+#include "circle.h"
+#include "dimension.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "helix.h"
+#include "image.h"
+#include "insert.h"
+#include "leader.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "mline.h"
+#include "mtext.h"
+#include "oleframe.h"
+#include "ole2frame.h"
+#include "point.h"
+#include "polyline.h"
+#include "ray.h"
+#include "raw_entity.h"
+#include "region.h"
+#include "shape.h"
+#include "solid.h"
+#include "spline.h"
+#include "table.h"
+#include "text.h"
+#include "tolerance.h"
+#include "trace.h"
+#include "vertex.h"
+#include "viewport.h"
+#include "xline.h"
+
+
+#define DXF_ENTITY_VTABLE_TOLERANCE 1e-9
+        /*!< \brief Relative tolerance for the similarity test of a
+         * transformation matrix. */
+
+
+/*!
+ * \brief Define the create, init, read, write and free functions of a
+ * function table, they convert the entity pointer for the functions of
+ * the entity module.
+ */
+#define DXF_ENTITY_VTABLE_FUNCTIONS(name, type) \
+static void * \
+dxf_entity_vtable_##name##_create (void) \
+{ \
+        return (dxf_##name##_new ()); \
+} \
+static void * \
+dxf_entity_vtable_##name##_init (void *entity) \
+{ \
+        return (dxf_##name##_init ((type *) entity)); \
+} \
+static void * \
+dxf_entity_vtable_##name##_read (DxfFile *fp, void *entity) \
+{ \
+        return (dxf_##name##_read (fp, (type *) entity)); \
+} \
+static int \
+dxf_entity_vtable_##name##_write (DxfFile *fp, void *entity) \
+{ \
+        return (dxf_##name##_write (fp, (type *) entity)); \
+} \
+static int \
+dxf_entity_vtable_##name##_free (void *entity) \
+{ \
+        return (dxf_##name##_free ((type *) entity)); \
+}
+
+
+DXF_ENTITY_VTABLE_FUNCTIONS (3dsolid, Dxf3dsolid)
+DXF_ENTITY_VTABLE_FUNCTIONS (acad_proxy_entity, DxfAcadProxyEntity)
+DXF_ENTITY_VTABLE_FUNCTIONS (arc, DxfArc)
+DXF_ENTITY_VTABLE_FUNCTIONS (attdef, DxfAttdef)
+DXF_ENTITY_VTABLE_FUNCTIONS (attrib, DxfAttrib)
+DXF_ENTITY_VTABLE_FUNCTIONS (body, DxfBody)
+DXF_ENTITY_VTABLE_FUNCTIONS (circle, DxfCircle)
+DXF_ENTITY_VTABLE_FUNCTIONS (dimension, DxfDimension)
+DXF_ENTITY_VTABLE_FUNCTIONS (ellipse, DxfEllipse)
+DXF_ENTITY_VTABLE_FUNCTIONS (hatch, DxfHatch)
+DXF_ENTITY_VTABLE_FUNCTIONS (helix, DxfHelix)
+DXF_ENTITY_VTABLE_FUNCTIONS (image, DxfImage)
+DXF_ENTITY_VTABLE_FUNCTIONS (insert, DxfInsert)
+DXF_ENTITY_VTABLE_FUNCTIONS (leader, DxfLeader)
+DXF_ENTITY_VTABLE_FUNCTIONS (line, DxfLine)
+DXF_ENTITY_VTABLE_FUNCTIONS (lwpolyline, DxfLWPolyline)
+DXF_ENTITY_VTABLE_FUNCTIONS (mline, DxfMline)
+DXF_ENTITY_VTABLE_FUNCTIONS (mtext, DxfMtext)
+DXF_ENTITY_VTABLE_FUNCTIONS (oleframe, DxfOleFrame)
+DXF_ENTITY_VTABLE_FUNCTIONS (ole2frame, DxfOle2Frame)
+DXF_ENTITY_VTABLE_FUNCTIONS (point, DxfPoint)
+DXF_ENTITY_VTABLE_FUNCTIONS (polyline, DxfPolyline)
+DXF_ENTITY_VTABLE_FUNCTIONS (ray, DxfRay)
+DXF_ENTITY_VTABLE_FUNCTIONS (raw_entity, DxfRawEntity)
+DXF_ENTITY_VTABLE_FUNCTIONS (region, DxfRegion)
+DXF_ENTITY_VTABLE_FUNCTIONS (shape, DxfShape)
+DXF_ENTITY_VTABLE_FUNCTIONS (solid, DxfSolid)
+DXF_ENTITY_VTABLE_FUNCTIONS (spline, DxfSpline)
+DXF_ENTITY_VTABLE_FUNCTIONS (table, DxfTable)
+DXF_ENTITY_VTABLE_FUNCTIONS (text, DxfText)
+DXF_ENTITY_VTABLE_FUNCTIONS (tolerance, DxfTolerance)
+DXF_ENTITY_VTABLE_FUNCTIONS (trace, DxfTrace)
+DXF_ENTITY_VTABLE_FUNCTIONS (vertex, DxfVertex)
+DXF_ENTITY_VTABLE_FUNCTIONS (viewport, DxfViewport)
+DXF_ENTITY_VTABLE_FUNCTIONS (xline, DxfXLine)
+
+
+/* dxf_3dface_free () returns the face when it was not freed. */
+
+static void *
+dxf_entity_vtable_3dface_create (void)
+{
+        return (dxf_3dface_new ());
+}
+
+
+static void *
+dxf_entity_vtable_3dface_init (void *entity)
+{
+        return (dxf_3dface_init ((Dxf3dface *) entity));
+}
+
+
+static void *
+dxf_entity_vtable_3dface_read (DxfFile *fp, void *entity)
+{
+        return (dxf_3dface_read (fp, (Dxf3dface *) entity));
+}
+
+
+static int
+dxf_entity_vtable_3dface_write (DxfFile *fp, void *entity)
+{
+        return (dxf_3dface_write (fp, (Dxf3dface *) entity));
+}
+
+
+static int
+dxf_entity_vtable_3dface_free (void *entity)
+{
+        return ((dxf_3dface_free ((Dxf3dface *) entity) == NULL)
+          ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Transform a point with a matrix.
+ */
+static void
+dxf_entity_vtable_transform_xyz
+(
+        const DxfMatrix *matrix,
+                /*!< a pointer to the matrix. */
+        double *x,
+                /*!< X-value of the point. */
+        double *y,
+                /*!< Y-value of the point. */
+        double *z
+                /*!< Z-value of the point. */
+)
+{
+        double x0 = *x;
+        double y0 = *y;
+        double z0 = *z;
+
+        *x = matrix->m[0][0] * x0 + matrix->m[0][1] * y0 + matrix->m[0][2] * z0 + matrix->m[0][3];
+        *y = matrix->m[1][0] * x0 + matrix->m[1][1] * y0 + matrix->m[1][2] * z0 + matrix->m[1][3];
+        *z = matrix->m[2][0] * x0 + matrix->m[2][1] * y0 + matrix->m[2][2] * z0 + matrix->m[2][3];
+}
+
+
+/*!
+ * \brief Transform an extrusion direction with the linear part of a
+ * matrix, the result is normalized.
+ */
+static void
+dxf_entity_vtable_transform_direction
+(
+        const DxfMatrix *matrix,
+                /*!< a pointer to the matrix. */
+        double *x,
+                /*!< X-value of the direction. */
+        double *y,
+                /*!< Y-value of the direction. */
+        double *z
+                /*!< Z-value of the direction. */
+)
+{
+        double x0 = *x;
+        double y0 = *y;
+        double z0 = *z;
+        double x1;
+        double y1;
+        double z1;
+        double length;
+
+        x1 = matrix->m[0][0] * x0 + matrix->m[0][1] * y0 + matrix->m[0][2] * z0;
+        y1 = matrix->m[1][0] * x0 + matrix->m[1][1] * y0 + matrix->m[1][2] * z0;
+        z1 = matrix->m[2][0] * x0 + matrix->m[2][1] * y0 + matrix->m[2][2] * z0;
+        length = sqrt (x1 * x1 + y1 * y1 + z1 * z1);
+        if (length > 0.0)
+        {
+                *x = x1 / length;
+                *y = y1 / length;
+                *z = z1 / length;
+        }
+}
+
+
+/*!
+ * \brief Test if a matrix maps circles in planes parallel to the XY
+ * plane onto circles in planes parallel to the XY plane, and get the
+ * scale and rotation (or the mirror line) in the XY plane.
+ *
+ * \return \c TRUE when it does, else \c FALSE.
+ */
+static int
+dxf_entity_vtable_get_similarity
+(
+        const DxfMatrix *matrix,
+                /*!< a pointer to the matrix. */
+        double *scale,
+                /*!< scale in the XY plane. */
+        double *angle,
+                /*!< rotation in degrees, or twice the angle of the mirror
+                 * line when \c mirror is \c TRUE. */
+        int *mirror
+                /*!< \c TRUE when the matrix mirrors the XY plane. */
+)
+{
+        double a = matrix->m[0][0];
+        double b = matrix->m[0][1];
+        double c = matrix->m[1][0];
+        double d = matrix->m[1][1];
+        double tolerance;
+
+        *scale = sqrt (a * a + c * c);
+        tolerance = DXF_ENTITY_VTABLE_TOLERANCE * *scale;
+        if ((*scale == 0.0)
+          || (fabs (matrix->m[0][2]) > tolerance)
+          || (fabs (matrix->m[1][2]) > tolerance)
+          || (fabs (matrix->m[2][0]) > tolerance)
+          || (fabs (matrix->m[2][1]) > tolerance)
+          || (matrix->m[2][2] <= 0.0))
+        {
+                return (FALSE);
+        }
+        if ((fabs (a - d) <= tolerance) && (fabs (b + c) <= tolerance))
+        {
+                *mirror = FALSE;
+        }
+        else if ((fabs (a + d) <= tolerance) && (fabs (b - c) <= tolerance))
+        {
+                *mirror = TRUE;
+        }
+        else
+        {
+                return (FALSE);
+        }
+        *angle = atan2 (c, a) * 180.0 / M_PI;
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Normalize an angle in degrees to [0, 360).
+ */
+static double
+dxf_entity_vtable_normalize_angle
+(
+        double angle
+                /*!< angle in degrees. */
+)
+{
+        angle = fmod (angle, 360.0);
+        if (angle < 0.0)
+        {
+                angle += 360.0;
+        }
+        return (angle);
+}
+
+
+/*!
+ * \brief Test if the extrusion direction of an entity is the Z-axis
+ * (or not set), so its object coordinate system is the world coordinate
+ * system.
+ */
+#define DXF_ENTITY_VTABLE_HAS_DEFAULT_EXTRUSION(entity) \
+        (((entity)->extr_x0 == 0.0) \
+          && ((entity)->extr_y0 == 0.0) \
+          && (((entity)->extr_z0 == 1.0) || ((entity)->extr_z0 == 0.0)))
+
+
+/*!
+ * \brief Duplicate a string member, \c NULL is kept.
+ */
+static char *
+dxf_entity_vtable_strdup
+(
+        const char *s
+                /*!< the string, or \c NULL. */
+)
+{
+        return ((s == NULL) ? NULL : dxf_strdup (s));
+}
+
+
+/*!
+ * \brief Duplicate a chain of binary graphics data.
+ */
+static DxfBinaryGraphicsData *
+dxf_entity_vtable_clone_binary_graphics_data
+(
+        DxfBinaryGraphicsData *data
+                /*!< a pointer to the first binary graphics data, or
+                 * \c NULL. */
+)
+{
+        DxfBinaryGraphicsData *first = NULL;
+        DxfBinaryGraphicsData *last = NULL;
+        DxfBinaryGraphicsData *clone;
+
+        for (; data != NULL; data = (DxfBinaryGraphicsData *) data->next)
+        {
+                if ((clone = dxf_binary_graphics_data_new ()) == NULL)
+                {
+                        break;
+                }
+                clone->data_line = dxf_entity_vtable_strdup (data->data_line);
+                clone->length = data->length;
+                if (last == NULL)
+                {
+                        first = clone;
+                }
+                else
+                {
+                        last->next = (struct DxfBinaryGraphicsData *) clone;
+                }
+                last = clone;
+        }
+        return (first);
+}
+
+
+/*!
+ * \brief Duplicate the members common for all drawable entities of a
+ * clone made by struct assignment.
+ */
+#define DXF_ENTITY_VTABLE_CLONE_COMMON(clone, entity) \
+        (clone)->linetype = dxf_entity_vtable_strdup ((entity)->linetype); \
+        (clone)->layer = dxf_entity_vtable_strdup ((entity)->layer); \
+        (clone)->binary_graphics_data = dxf_entity_vtable_clone_binary_graphics_data ((entity)->binary_graphics_data); \
+        (clone)->dictionary_owner_soft = dxf_entity_vtable_strdup ((entity)->dictionary_owner_soft); \
+        (clone)->material = dxf_entity_vtable_strdup ((entity)->material); \
+        (clone)->dictionary_owner_hard = dxf_entity_vtable_strdup ((entity)->dictionary_owner_hard); \
+        (clone)->plot_style_name = dxf_entity_vtable_strdup ((entity)->plot_style_name); \
+        (clone)->color_name = dxf_entity_vtable_strdup ((entity)->color_name); \
+        (clone)->next = NULL;
+
+
+/*!
+ * \brief Add a string member to the hash of an entity, an empty string
+ * is added as \c empty, as the writer of the entity replaces it.
+ */
+static void
+dxf_entity_vtable_fingerprint_string
+(
+        DxfFingerprintHasher *hasher,
+        const char *value,
+        const char *empty
+)
+{
+        dxf_fingerprint_hasher_add_string (hasher,
+          ((value == NULL) || (value[0] == '\0')) ? empty : value);
+}
+
+
+/*!
+ * \brief Add an extrusion direction to the hash of an entity, a
+ * direction which is not written is added as the Z-axis it reads back
+ * as.
+ */
+static void
+dxf_entity_vtable_fingerprint_extrusion
+(
+        DxfFingerprintHasher *hasher,
+        double x,
+        double y,
+        double z
+)
+{
+        int written = ((x != 0.0) && (y != 0.0) && (z != 1.0));
+
+        dxf_fingerprint_hasher_add_double (hasher, written ? x : 0.0);
+        dxf_fingerprint_hasher_add_double (hasher, written ? y : 0.0);
+        dxf_fingerprint_hasher_add_double (hasher, written ? z : 1.0);
+}
+
+
+/*!
+ * \brief Add the members common for all drawable entities which are
+ * written for \c DXF_FINGERPRINT_ACAD_VERSION to the hash of an entity,
+ * the handle is left out.
+ */
+#define DXF_ENTITY_VTABLE_FINGERPRINT_COMMON(hasher, entity) \
+        dxf_entity_vtable_fingerprint_string ((hasher), (entity)->dictionary_owner_soft, ""); \
+        dxf_entity_vtable_fingerprint_string ((hasher), (entity)->dictionary_owner_hard, ""); \
+        dxf_fingerprint_hasher_add_int ((hasher), (entity)->paperspace == DXF_PAPERSPACE); \
+        dxf_entity_vtable_fingerprint_string ((hasher), (entity)->layer, DXF_DEFAULT_LAYER); \
+        dxf_entity_vtable_fingerprint_string ((hasher), (entity)->linetype, DXF_DEFAULT_LINETYPE); \
+        dxf_fingerprint_hasher_add_int ((hasher), (entity)->color); \
+        dxf_fingerprint_hasher_add_double ((hasher), (entity)->thickness); \
+        dxf_fingerprint_hasher_add_double ((hasher), (entity)->linetype_scale); \
+        dxf_fingerprint_hasher_add_int ((hasher), (entity)->visibility);
+
+
+static int
+dxf_entity_vtable_point_extents (void *entity, DxfExtents *extents)
+{
+        DxfPoint *point = (DxfPoint *) entity;
+
+        dxf_extents_init (extents);
+        dxf_extents_add_point (extents, point->x0, point->y0, point->z0);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_point_transform (void *entity, const DxfMatrix *matrix)
+{
+        DxfPoint *point = (DxfPoint *) entity;
+
+        dxf_entity_vtable_transform_xyz (matrix, &point->x0, &point->y0, &point->z0);
+        dxf_entity_vtable_transform_direction (matrix, &point->extr_x0, &point->extr_y0, &point->extr_z0);
+        return (EXIT_SUCCESS);
+}
+
+
+static void *
+dxf_entity_vtable_point_clone (void *entity)
+{
+        DxfPoint *point = (DxfPoint *) entity;
+        DxfPoint *clone;
+
+        if (point == NULL)
+        {
+                return (NULL);
+        }
+        if ((clone = dxf_point_new ()) == NULL)
+        {
+                return (NULL);
+        }
+        *clone = *point;
+        DXF_ENTITY_VTABLE_CLONE_COMMON (clone, point);
+        return (clone);
+}
+
+
+static uint64_t
+dxf_entity_vtable_point_fingerprint (void *entity)
+{
+        DxfPoint *point = (DxfPoint *) entity;
+        DxfFingerprintHasher hasher;
+
+        dxf_fingerprint_hasher_init (&hasher, POINT);
+        DXF_ENTITY_VTABLE_FINGERPRINT_COMMON (&hasher, point);
+        dxf_fingerprint_hasher_add_double (&hasher, point->x0);
+        dxf_fingerprint_hasher_add_double (&hasher, point->y0);
+        dxf_fingerprint_hasher_add_double (&hasher, point->z0);
+        dxf_entity_vtable_fingerprint_extrusion (&hasher, point->extr_x0, point->extr_y0, point->extr_z0);
+        dxf_fingerprint_hasher_add_double (&hasher, point->angle_to_X);
+        return (dxf_fingerprint_hasher_finish (&hasher));
+}
+
+
+static int
+dxf_entity_vtable_line_extents (void *entity, DxfExtents *extents)
+{
+        DxfLine *line = (DxfLine *) entity;
+
+        if ((line->p0 == NULL) || (line->p1 == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_init (extents);
+        dxf_extents_add_point (extents, line->p0->x0, line->p0->y0, line->p0->z0);
+        dxf_extents_add_point (extents, line->p1->x0, line->p1->y0, line->p1->z0);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_line_transform (void *entity, const DxfMatrix *matrix)
+{
+        DxfLine *line = (DxfLine *) entity;
+
+        if ((line->p0 == NULL) || (line->p1 == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_entity_vtable_transform_xyz (matrix, &line->p0->x0, &line->p0->y0, &line->p0->z0);
+        dxf_entity_vtable_transform_xyz (matrix, &line->p1->x0, &line->p1->y0, &line->p1->z0);
+        dxf_entity_vtable_transform_direction (matrix, &line->extr_x0, &line->extr_y0, &line->extr_z0);
+        return (EXIT_SUCCESS);
+}
+
+
+static void *
+dxf_entity_vtable_line_clone (void *entity)
+{
+        DxfLine *line = (DxfLine *) entity;
+        DxfLine *clone;
+
+        if ((clone = dxf_line_new ()) == NULL)
+        {
+                return (NULL);
+        }
+        *clone = *line;
+        DXF_ENTITY_VTABLE_CLONE_COMMON (clone, line);
+        clone->p0 = dxf_entity_vtable_point_clone (line->p0);
+        clone->p1 = dxf_entity_vtable_point_clone (line->p1);
+        return (clone);
+}
+
+
+static uint64_t
+dxf_entity_vtable_line_fingerprint (void *entity)
+{
+        DxfLine *line = (DxfLine *) entity;
+        DxfBinaryGraphicsData *data;
+        DxfFingerprintHasher hasher;
+
+        if ((line->p0 == NULL) || (line->p1 == NULL))
+        {
+                return (0);
+        }
+        dxf_fingerprint_hasher_init (&hasher, LINE);
+        DXF_ENTITY_VTABLE_FINGERPRINT_COMMON (&hasher, line);
+        dxf_entity_vtable_fingerprint_string (&hasher, line->material, "");
+        dxf_fingerprint_hasher_add_int (&hasher, line->lineweight);
+        if (line->graphics_data_size > 0)
+        {
+                dxf_fingerprint_hasher_add_int (&hasher, line->graphics_data_size);
+                for (data = line->binary_graphics_data; data != NULL; data = (DxfBinaryGraphicsData *) data->next)
+                {
+                        dxf_fingerprint_hasher_add_string (&hasher, data->data_line);
+                }
+        }
+        dxf_fingerprint_hasher_add_int (&hasher, line->color_value);
+        dxf_fingerprint_hasher_add_string (&hasher, line->color_name);
+        dxf_fingerprint_hasher_add_int (&hasher, line->transparency);
+        dxf_fingerprint_hasher_add_string (&hasher, line->plot_style_name);
+        dxf_fingerprint_hasher_add_int (&hasher, line->shadow_mode);
+        dxf_fingerprint_hasher_add_double (&hasher, line->p0->x0);
+        dxf_fingerprint_hasher_add_double (&hasher, line->p0->y0);
+        dxf_fingerprint_hasher_add_double (&hasher, line->p0->z0);
+        dxf_fingerprint_hasher_add_double (&hasher, line->p1->x0);
+        dxf_fingerprint_hasher_add_double (&hasher, line->p1->y0);
+        dxf_fingerprint_hasher_add_double (&hasher, line->p1->z0);
+        dxf_entity_vtable_fingerprint_extrusion (&hasher, line->extr_x0, line->extr_y0, line->extr_z0);
+        return (dxf_fingerprint_hasher_finish (&hasher));
+}
+
+
+static int
+dxf_entity_vtable_circle_extents (void *entity, DxfExtents *extents)
+{
+        DxfCircle *circle = (DxfCircle *) entity;
+
+        if (circle->p0 == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_init (extents);
+        dxf_extents_add_point (extents,
+          circle->p0->x0 - circle->radius,
+          circle->p0->y0 - circle->radius,
+          circle->p0->z0);
+        dxf_extents_add_point (extents,
+          circle->p0->x0 + circle->radius,
+          circle->p0->y0 + circle->radius,
+          circle->p0->z0);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_circle_transform (void *entity, const DxfMatrix *matrix)
+{
+        DxfCircle *circle = (DxfCircle *) entity;
+        double scale;
+        double angle;
+        int mirror;
+
+        if ((circle->p0 == NULL)
+          || (!DXF_ENTITY_VTABLE_HAS_DEFAULT_EXTRUSION (circle))
+          || (!dxf_entity_vtable_get_similarity (matrix, &scale, &angle, &mirror)))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_entity_vtable_transform_xyz (matrix, &circle->p0->x0, &circle->p0->y0, &circle->p0->z0);
+        circle->radius *= scale;
+        return (EXIT_SUCCESS);
+}
+
+
+static void *
+dxf_entity_vtable_circle_clone (void *entity)
+{
+        DxfCircle *circle = (DxfCircle *) entity;
+        DxfCircle *clone;
+
+        if ((clone = dxf_circle_new ()) == NULL)
+        {
+                return (NULL);
+        }
+        *clone = *circle;
+        DXF_ENTITY_VTABLE_CLONE_COMMON (clone, circle);
+        clone->p0 = dxf_entity_vtable_point_clone (circle->p0);
+        return (clone);
+}
+
+
+static uint64_t
+dxf_entity_vtable_circle_fingerprint (void *entity)
+{
+        DxfCircle *circle = (DxfCircle *) entity;
+        DxfFingerprintHasher hasher;
+
+        if (circle->p0 == NULL)
+        {
+                return (0);
+        }
+        dxf_fingerprint_hasher_init (&hasher, CIRCLE);
+        DXF_ENTITY_VTABLE_FINGERPRINT_COMMON (&hasher, circle);
+        dxf_fingerprint_hasher_add_double (&hasher, circle->p0->x0);
+        dxf_fingerprint_hasher_add_double (&hasher, circle->p0->y0);
+        dxf_fingerprint_hasher_add_double (&hasher, circle->p0->z0);
+        dxf_fingerprint_hasher_add_double (&hasher, circle->radius);
+        dxf_entity_vtable_fingerprint_extrusion (&hasher, circle->extr_x0, circle->extr_y0, circle->extr_z0);
+        return (dxf_fingerprint_hasher_finish (&hasher));
+}
+
+
+static int
+dxf_entity_vtable_arc_extents (void *entity, DxfExtents *extents)
+{
+        DxfArc *arc = (DxfArc *) entity;
+        double start_angle;
+        double sweep;
+        double angle;
+        int i;
+
+        if (arc->p0 == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        start_angle = dxf_entity_vtable_normalize_angle (arc->start_angle);
+        sweep = dxf_entity_vtable_normalize_angle (arc->end_angle - arc->start_angle);
+        if (sweep == 0.0)
+        {
+                sweep = 360.0;
+        }
+        dxf_extents_init (extents);
+        dxf_extents_add_point (extents,
+          arc->p0->x0 + arc->radius * cos (start_angle * M_PI / 180.0),
+          arc->p0->y0 + arc->radius * sin (start_angle * M_PI / 180.0),
+          arc->p0->z0);
+        dxf_extents_add_point (extents,
+          arc->p0->x0 + arc->radius * cos (arc->end_angle * M_PI / 180.0),
+          arc->p0->y0 + arc->radius * sin (arc->end_angle * M_PI / 180.0),
+          arc->p0->z0);
+        /* Add the quadrant points passed by the arc. */
+        for (i = 0; i < 4; i++)
+        {
+                angle = 90.0 * i;
+                if (dxf_entity_vtable_normalize_angle (angle - start_angle) <= sweep)
+                {
+                        dxf_extents_add_point (extents,
+                          arc->p0->x0 + arc->radius * ((i == 0) ? 1.0 : (i == 2) ? -1.0 : 0.0),
+                          arc->p0->y0 + arc->radius * ((i == 1) ? 1.0 : (i == 3) ? -1.0 : 0.0),
+                          arc->p0->z0);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_arc_transform (void *entity, const DxfMatrix *matrix)
+{
+        DxfArc *arc = (DxfArc *) entity;
+        double scale;
+        double angle;
+        double start_angle;
+        int mirror;
+
+        if ((arc->p0 == NULL)
+          || (!DXF_ENTITY_VTABLE_HAS_DEFAULT_EXTRUSION (arc))
+          || (!dxf_entity_vtable_get_similarity (matrix, &scale, &angle, &mirror)))
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_entity_vtable_transform_xyz (matrix, &arc->p0->x0, &arc->p0->y0, &arc->p0->z0);
+        arc->radius *= scale;
+        if (mirror)
+        {
+                /* A mirror reverses the direction of the arc, swap the
+                 * angles to keep it counter clockwise. */
+                start_angle = angle - arc->end_angle;
+                arc->end_angle = dxf_entity_vtable_normalize_angle (angle - arc->start_angle);
+                arc->start_angle = dxf_entity_vtable_normalize_angle (start_angle);
+        }
+        else
+        {
+                arc->start_angle = dxf_entity_vtable_normalize_angle (arc->start_angle + angle);
+                arc->end_angle = dxf_entity_vtable_normalize_angle (arc->end_angle + angle);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+static void *
+dxf_entity_vtable_arc_clone (void *entity)
+{
+        DxfArc *arc = (DxfArc *) entity;
+        DxfArc *clone;
+
+        if ((clone = dxf_arc_new ()) == NULL)
+        {
+                return (NULL);
+        }
+        *clone = *arc;
+        DXF_ENTITY_VTABLE_CLONE_COMMON (clone, arc);
+        clone->p0 = dxf_entity_vtable_point_clone (arc->p0);
+        return (clone);
+}
+
+
+static uint64_t
+dxf_entity_vtable_arc_fingerprint (void *entity)
+{
+        DxfArc *arc = (DxfArc *) entity;
+        DxfFingerprintHasher hasher;
+
+        if (arc->p0 == NULL)
+        {
+                return (0);
+        }
+        dxf_fingerprint_hasher_init (&hasher, ARC);
+        DXF_ENTITY_VTABLE_FINGERPRINT_COMMON (&hasher, arc);
+        dxf_fingerprint_hasher_add_double (&hasher, arc->p0->x0);
+        dxf_fingerprint_hasher_add_double (&hasher, arc->p0->y0);
+        dxf_fingerprint_hasher_add_double (&hasher, arc->p0->z0);
+        dxf_fingerprint_hasher_add_double (&hasher, arc->radius);
+        dxf_fingerprint_hasher_add_double (&hasher, arc->start_angle);
+        dxf_fingerprint_hasher_add_double (&hasher, arc->end_angle);
+        dxf_entity_vtable_fingerprint_extrusion (&hasher, arc->extr_x0, arc->extr_y0, arc->extr_z0);
+        return (dxf_fingerprint_hasher_finish (&hasher));
+}
+
+
+/*!
+ * \brief Grow extents to include a point, a \c NULL point is skipped.
+ */
+static void
+dxf_entity_vtable_add_point (DxfExtents *extents, DxfPoint *point)
+{
+        if (point != NULL)
+        {
+                dxf_extents_add_point (extents, point->x0, point->y0, point->z0);
+        }
+}
+
+
+/*!
+ * \brief Grow extents to include the points of a list of points.
+ */
+static void
+dxf_entity_vtable_add_points (DxfExtents *extents, DxfPoint *point)
+{
+        for (; point != NULL; point = (DxfPoint *) point->next)
+        {
+                dxf_extents_add_point (extents, point->x0, point->y0, point->z0);
+        }
+}
+
+
+/*!
+ * \brief Grow extents to include the vertices of a polyline.
+ *
+ * A bulged segment is represented by its end points and its apex.
+ */
+static void
+dxf_entity_vtable_add_vertices
+(
+        DxfExtents *extents,
+        DxfVertex *vertex,
+        double elevation,
+        int use_z,
+        int is_closed
+)
+{
+        DxfVertex *first = vertex;
+        DxfVertex *next;
+        double dx;
+        double dy;
+        double z;
+
+        for (; vertex != NULL; vertex = next)
+        {
+                next = (DxfVertex *) vertex->next;
+                z = use_z ? vertex->z0 : elevation;
+                dxf_extents_add_point (extents, vertex->x0, vertex->y0, z);
+                if ((next == NULL) && (is_closed))
+                {
+                        next = first;
+                        if (next == vertex)
+                        {
+                                break;
+                        }
+                }
+                if ((next != NULL) && (vertex->bulge != 0.0))
+                {
+                        /* The apex lies at the bulge times half the
+                         * chord from the middle of the chord, to the
+                         * right of the chord for a positive bulge. */
+                        dx = next->x0 - vertex->x0;
+                        dy = next->y0 - vertex->y0;
+                        dxf_extents_add_point (extents,
+                          vertex->x0 + dx / 2.0 + vertex->bulge * dy / 2.0,
+                          vertex->y0 + dy / 2.0 - vertex->bulge * dx / 2.0,
+                          z);
+                }
+                if (next == first)
+                {
+                        break;
+                }
+        }
+}
+
+
+/*!
+ * \brief Grow extents to include an ellipse with its center at
+ * (\c x, \c y, \c z) and its major axis (\c major_x, \c major_y) in
+ * the XY plane.
+ */
+static void
+dxf_entity_vtable_add_ellipse
+(
+        DxfExtents *extents,
+        double x,
+        double y,
+        double z,
+        double major_x,
+        double major_y,
+        double ratio
+)
+{
+        double half_width;
+        double half_height;
+
+        /* The minor axis is the major axis turned a quarter counter
+         * clockwise and scaled by the ratio. */
+        half_width = sqrt (major_x * major_x + ratio * ratio * major_y * major_y);
+        half_height = sqrt (major_y * major_y + ratio * ratio * major_x * major_x);
+        dxf_extents_add_point (extents, x - half_width, y - half_height, z);
+        dxf_extents_add_point (extents, x + half_width, y + half_height, z);
+}
+
+
+static int
+dxf_entity_vtable_3dface_extents (void *entity, DxfExtents *extents)
+{
+        Dxf3dface *face = (Dxf3dface *) entity;
+
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_point (extents, face->p0);
+        dxf_entity_vtable_add_point (extents, face->p1);
+        dxf_entity_vtable_add_point (extents, face->p2);
+        dxf_entity_vtable_add_point (extents, face->p3);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_attdef_extents (void *entity, DxfExtents *extents)
+{
+        DxfAttdef *attdef = (DxfAttdef *) entity;
+
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_point (extents, attdef->p0);
+        if ((attdef->hor_align != 0) || (attdef->vert_align != 0))
+        {
+                dxf_entity_vtable_add_point (extents, attdef->p1);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_attrib_extents (void *entity, DxfExtents *extents)
+{
+        DxfAttrib *attrib = (DxfAttrib *) entity;
+
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_point (extents, attrib->p0);
+        if ((attrib->hor_align != 0) || (attrib->vert_align != 0))
+        {
+                dxf_entity_vtable_add_point (extents, attrib->p1);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_dimension_extents (void *entity, DxfExtents *extents)
+{
+        DxfDimension *dimension = (DxfDimension *) entity;
+
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_point (extents, dimension->p0);
+        dxf_entity_vtable_add_point (extents, dimension->p1);
+        /* Only the definition points used by the dimension type. */
+        switch (dimension->flag & 0x0F)
+        {
+                case 0:
+                case 1:
+                case 6:
+                        dxf_entity_vtable_add_point (extents, dimension->p3);
+                        dxf_entity_vtable_add_point (extents, dimension->p4);
+                        break;
+                case 2:
+                        dxf_entity_vtable_add_point (extents, dimension->p3);
+                        dxf_entity_vtable_add_point (extents, dimension->p4);
+                        dxf_entity_vtable_add_point (extents, dimension->p5);
+                        dxf_entity_vtable_add_point (extents, dimension->p6);
+                        break;
+                case 3:
+                case 4:
+                        dxf_entity_vtable_add_point (extents, dimension->p5);
+                        break;
+                case 5:
+                        dxf_entity_vtable_add_point (extents, dimension->p3);
+                        dxf_entity_vtable_add_point (extents, dimension->p4);
+                        dxf_entity_vtable_add_point (extents, dimension->p5);
+                        break;
+                default:
+                        break;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_ellipse_extents (void *entity, DxfExtents *extents)
+{
+        DxfEllipse *ellipse = (DxfEllipse *) entity;
+
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_ellipse (extents,
+          ellipse->x0, ellipse->y0, ellipse->z0,
+          ellipse->x1, ellipse->y1, ellipse->ratio);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_hatch_extents (void *entity, DxfExtents *extents)
+{
+        DxfHatch *hatch = (DxfHatch *) entity;
+        DxfHatchBoundaryPath *path;
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        DxfHatchBoundaryPathEdge *edge;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeArc *arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+        DxfHatchBoundaryPathEdgeSplineCp *control_point;
+
+        dxf_extents_init (extents);
+        /* The boundary is in the plane at the elevation of the hatch,
+         * arcs and ellipses are added as full circles and ellipses. */
+        for (path = (DxfHatchBoundaryPath *) hatch->paths; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines; polyline != NULL; polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices; vertex != NULL; vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+                        {
+                                dxf_extents_add_point (extents, vertex->x0, vertex->y0, hatch->z0);
+                        }
+                }
+                for (edge = (DxfHatchBoundaryPathEdge *) path->edges; edge != NULL; edge = (DxfHatchBoundaryPathEdge *) edge->next)
+                {
+                        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines; line != NULL; line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                        {
+                                dxf_extents_add_point (extents, line->x0, line->y0, hatch->z0);
+                                dxf_extents_add_point (extents, line->x1, line->y1, hatch->z0);
+                        }
+                        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs; arc != NULL; arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                        {
+                                dxf_extents_add_point (extents, arc->x0 - arc->radius, arc->y0 - arc->radius, hatch->z0);
+                                dxf_extents_add_point (extents, arc->x0 + arc->radius, arc->y0 + arc->radius, hatch->z0);
+                        }
+                        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses; ellipse != NULL; ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                        {
+                                dxf_entity_vtable_add_ellipse (extents,
+                                  ellipse->x0, ellipse->y0, hatch->z0,
+                                  ellipse->x1, ellipse->y1, ellipse->ratio);
+                        }
+                        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines; spline != NULL; spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                        {
+                                for (control_point = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points; control_point != NULL; control_point = (DxfHatchBoundaryPathEdgeSplineCp *) control_point->next)
+                                {
+                                        dxf_extents_add_point (extents, control_point->x0, control_point->y0, hatch->z0);
+                                }
+                        }
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_helix_extents (void *entity, DxfExtents *extents)
+{
+        DxfHelix *helix = (DxfHelix *) entity;
+
+        dxf_extents_init (extents);
+        /* The helix lies in the convex hull of its control points. */
+        if (helix->spline != NULL)
+        {
+                dxf_entity_vtable_add_points (extents, helix->spline->p0);
+        }
+        dxf_entity_vtable_add_point (extents, helix->p1);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_image_extents (void *entity, DxfExtents *extents)
+{
+        DxfImage *image = (DxfImage *) entity;
+        double width;
+        double height;
+
+        if ((image->p0 == NULL)
+          || (image->p1 == NULL)
+          || (image->p2 == NULL)
+          || (image->p3 == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        width = image->p3->x0;
+        height = image->p3->y0;
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_point (extents, image->p0);
+        dxf_extents_add_point (extents,
+          image->p0->x0 + width * image->p1->x0,
+          image->p0->y0 + width * image->p1->y0,
+          image->p0->z0 + width * image->p1->z0);
+        dxf_extents_add_point (extents,
+          image->p0->x0 + height * image->p2->x0,
+          image->p0->y0 + height * image->p2->y0,
+          image->p0->z0 + height * image->p2->z0);
+        dxf_extents_add_point (extents,
+          image->p0->x0 + width * image->p1->x0 + height * image->p2->x0,
+          image->p0->y0 + width * image->p1->y0 + height * image->p2->y0,
+          image->p0->z0 + width * image->p1->z0 + height * image->p2->z0);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_insert_extents (void *entity, DxfExtents *extents)
+{
+        DxfInsert *insert = (DxfInsert *) entity;
+
+        if (insert->p0 == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_point (extents, insert->p0);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_leader_extents (void *entity, DxfExtents *extents)
+{
+        DxfLeader *leader = (DxfLeader *) entity;
+
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_points (extents, leader->p0);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_lwpolyline_extents (void *entity, DxfExtents *extents)
+{
+        DxfLWPolyline *lwpolyline = (DxfLWPolyline *) entity;
+
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_vertices (extents,
+          (DxfVertex *) lwpolyline->vertices,
+          lwpolyline->elevation, FALSE, lwpolyline->flag & 1);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_mline_extents (void *entity, DxfExtents *extents)
+{
+        DxfMline *mline = (DxfMline *) entity;
+
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_point (extents, mline->p0);
+        dxf_entity_vtable_add_points (extents, mline->p1);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_mtext_extents (void *entity, DxfExtents *extents)
+{
+        DxfMtext *mtext = (DxfMtext *) entity;
+
+        if (mtext->p0 == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_point (extents, mtext->p0);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_ole2frame_extents (void *entity, DxfExtents *extents)
+{
+        DxfOle2Frame *ole2frame = (DxfOle2Frame *) entity;
+
+        dxf_extents_init (extents);
+        /* The upper left and the lower right corner. */
+        dxf_entity_vtable_add_point (extents, ole2frame->p0);
+        dxf_entity_vtable_add_point (extents, ole2frame->p1);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_polyline_extents (void *entity, DxfExtents *extents)
+{
+        DxfPolyline *polyline = (DxfPolyline *) entity;
+
+        dxf_extents_init (extents);
+        dxf_entity_vtable_add_vertices (extents, polyline->vertices,
+          0.0, TRUE, polyline->flag & 1);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Rays and construction lines are infinite, as in AutoCAD they
+ * do not add to the extents.
+ */
+static int
+dxf_entity_vtable_infinite_extents (void *entity, DxfExtents *extents)
+{
+        (void) entity;
+        dxf_extents_init (extents);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_shape_extents (void *entity, DxfExtents *extents)
+{
+        DxfShape *shape = (DxfShape *) entity;
+
+        dxf_extents_init (extents);
+        dxf_extents_add_point (extents, shape->x0, shape->y0, shape->z0);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_solid_extents (void *entity, DxfExtents *extents)
+{
+        DxfSolid *solid = (DxfSolid *) entity;
+
+        dxf_extents_init (extents);
+        dxf_extents_add_point (extents, solid->x0, solid->y0, solid->z0);
+        dxf_extents_add_point (extents, solid->x1, solid->y1, solid->z1);
+        dxf_extents_add_point (extents, solid->x2, solid->y2, solid->z2);
+        dxf_extents_add_point (extents, solid->x3, solid->y3, solid->z3);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_spline_extents (void *entity, DxfExtents *extents)
+{
+        DxfSpline *spline = (DxfSpline *) entity;
+
+        dxf_extents_init (extents);
+        /* The spline lies in the convex hull of its control points and
+         * passes through its fit points. */
+        dxf_entity_vtable_add_points (extents, spline->p0);
+        dxf_entity_vtable_add_points (extents, spline->p1);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_table_extents (void *entity, DxfExtents *extents)
+{
+        DxfTable *table = (DxfTable *) entity;
+
+        dxf_extents_init (extents);
+        dxf_extents_add_point (extents, table->x0, table->y0, table->z0);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_text_extents (void *entity, DxfExtents *extents)
+{
+        DxfText *text = (DxfText *) entity;
+
+        dxf_extents_init (extents);
+        dxf_extents_add_point (extents, text->x0, text->y0, text->z0);
+        if ((text->hor_align != 0) || (text->vert_align != 0))
+        {
+                dxf_extents_add_point (extents, text->x1, text->y1, text->z1);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_tolerance_extents (void *entity, DxfExtents *extents)
+{
+        DxfTolerance *tolerance = (DxfTolerance *) entity;
+
+        dxf_extents_init (extents);
+        dxf_extents_add_point (extents, tolerance->x0, tolerance->y0, tolerance->z0);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_trace_extents (void *entity, DxfExtents *extents)
+{
+        DxfTrace *trace = (DxfTrace *) entity;
+
+        dxf_extents_init (extents);
+        dxf_extents_add_point (extents, trace->x0, trace->y0, trace->z0);
+        dxf_extents_add_point (extents, trace->x1, trace->y1, trace->z1);
+        dxf_extents_add_point (extents, trace->x2, trace->y2, trace->z2);
+        dxf_extents_add_point (extents, trace->x3, trace->y3, trace->z3);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_vertex_extents (void *entity, DxfExtents *extents)
+{
+        DxfVertex *vertex = (DxfVertex *) entity;
+
+        dxf_extents_init (extents);
+        dxf_extents_add_point (extents, vertex->x0, vertex->y0, vertex->z0);
+        return (EXIT_SUCCESS);
+}
+
+
+static int
+dxf_entity_vtable_viewport_extents (void *entity, DxfExtents *extents)
+{
+        DxfViewport *viewport = (DxfViewport *) entity;
+
+        dxf_extents_init (extents);
+        /* The center point and the size in paper space. */
+        dxf_extents_add_point (extents,
+          viewport->x0 - viewport->width / 2.0,
+          viewport->y0 - viewport->height / 2.0,
+          viewport->z0);
+        dxf_extents_add_point (extents,
+          viewport->x0 + viewport->width / 2.0,
+          viewport->y0 + viewport->height / 2.0,
+          viewport->z0);
+        return (EXIT_SUCCESS);
+}
+
+
+static void *
+dxf_entity_vtable_raw_entity_clone (void *entity)
+{
+        return (dxf_raw_entity_clone ((DxfRawEntity *) entity));
+}
+
+
+/*!
+ * \brief Function table entry of an entity type.
+ */
+#define DXF_ENTITY_VTABLE_ENTRY(entity_type, type, list, name, read, extents, transform, clone, fingerprint) \
+        [entity_type] = \
+        { \
+                entity_type, \
+                sizeof (type), \
+                offsetof (type, id_code), \
+                offsetof (type, layer), \
+                offsetof (type, color), \
+                offsetof (type, next), \
+                offsetof (DxfEntities, list), \
+                dxf_entity_vtable_##name##_create, \
+                dxf_entity_vtable_##name##_init, \
+                read, \
+                dxf_entity_vtable_##name##_write, \
+                dxf_entity_vtable_##name##_free, \
+                extents, \
+                transform, \
+                clone, \
+                fingerprint \
+        }
+
+
+/*!
+ * \brief Function tables indexed by \c DxfEntityType, entries with a
+ * \c size of 0 are entity types which are not supported.
+ */
+static const DxfEntityVtable dxf_entity_vtables[DXF_NUMBER_OF_ENTITY_TYPES] =
+{
+        DXF_ENTITY_VTABLE_ENTRY (UNKNOWN_ENTITY, DxfRawEntity, raw_entity_list, raw_entity,
+          dxf_entity_vtable_raw_entity_read, NULL, NULL,
+          dxf_entity_vtable_raw_entity_clone, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (DFACE, Dxf3dface, dface_list, 3dface,
+          dxf_entity_vtable_3dface_read,
+          dxf_entity_vtable_3dface_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (DSOLID, Dxf3dsolid, dsolid_list, 3dsolid,
+          dxf_entity_vtable_3dsolid_read, NULL, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (ACADPROXYENTITY, DxfAcadProxyEntity, acad_proxy_entity_list, acad_proxy_entity,
+          dxf_entity_vtable_acad_proxy_entity_read, NULL, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (ARC, DxfArc, arc_list, arc,
+          dxf_entity_vtable_arc_read,
+          dxf_entity_vtable_arc_extents,
+          dxf_entity_vtable_arc_transform,
+          dxf_entity_vtable_arc_clone,
+          dxf_entity_vtable_arc_fingerprint),
+        DXF_ENTITY_VTABLE_ENTRY (ATTDEF, DxfAttdef, attdef_list, attdef,
+          dxf_entity_vtable_attdef_read,
+          dxf_entity_vtable_attdef_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (ATTRIB, DxfAttrib, attrib_list, attrib,
+          dxf_entity_vtable_attrib_read,
+          dxf_entity_vtable_attrib_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (BODY, DxfBody, body_list, body,
+          dxf_entity_vtable_body_read, NULL, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (CIRCLE, DxfCircle, circle_list, circle,
+          dxf_entity_vtable_circle_read,
+          dxf_entity_vtable_circle_extents,
+          dxf_entity_vtable_circle_transform,
+          dxf_entity_vtable_circle_clone,
+          dxf_entity_vtable_circle_fingerprint),
+        DXF_ENTITY_VTABLE_ENTRY (DIMENSION, DxfDimension, dimension_list, dimension,
+          dxf_entity_vtable_dimension_read,
+          dxf_entity_vtable_dimension_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (ELLIPSE, DxfEllipse, ellipse_list, ellipse,
+          dxf_entity_vtable_ellipse_read,
+          dxf_entity_vtable_ellipse_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (HATCH, DxfHatch, hatch_list, hatch,
+          dxf_entity_vtable_hatch_read,
+          dxf_entity_vtable_hatch_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (HELIX, DxfHelix, helix_list, helix,
+          dxf_entity_vtable_helix_read,
+          dxf_entity_vtable_helix_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (IMAGE, DxfImage, image_list, image,
+          dxf_entity_vtable_image_read,
+          dxf_entity_vtable_image_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (INSERT, DxfInsert, insert_list, insert,
+          dxf_entity_vtable_insert_read,
+          dxf_entity_vtable_insert_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (LEADER, DxfLeader, leader_list, leader,
+          dxf_entity_vtable_leader_read,
+          dxf_entity_vtable_leader_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (LINE, DxfLine, line_list, line,
+          dxf_entity_vtable_line_read,
+          dxf_entity_vtable_line_extents,
+          dxf_entity_vtable_line_transform,
+          dxf_entity_vtable_line_clone,
+          dxf_entity_vtable_line_fingerprint),
+        DXF_ENTITY_VTABLE_ENTRY (LWPOLYLINE, DxfLWPolyline, lw_polyline_list, lwpolyline,
+          dxf_entity_vtable_lwpolyline_read,
+          dxf_entity_vtable_lwpolyline_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (MTEXT, DxfMtext, mtext_list, mtext,
+          dxf_entity_vtable_mtext_read,
+          dxf_entity_vtable_mtext_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (OLEFRAME, DxfOleFrame, oleframe_list, oleframe,
+          dxf_entity_vtable_oleframe_read, NULL, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (OLE2FRAME, DxfOle2Frame, ole2frame_list, ole2frame,
+          dxf_entity_vtable_ole2frame_read,
+          dxf_entity_vtable_ole2frame_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (POINT, DxfPoint, point_list, point,
+          dxf_entity_vtable_point_read,
+          dxf_entity_vtable_point_extents,
+          dxf_entity_vtable_point_transform,
+          dxf_entity_vtable_point_clone,
+          dxf_entity_vtable_point_fingerprint),
+        DXF_ENTITY_VTABLE_ENTRY (POLYLINE, DxfPolyline, polyline_list, polyline,
+          dxf_entity_vtable_polyline_read,
+          dxf_entity_vtable_polyline_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (RAY, DxfRay, ray_list, ray,
+          dxf_entity_vtable_ray_read,
+          dxf_entity_vtable_infinite_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (REGION, DxfRegion, region_list, region,
+          dxf_entity_vtable_region_read, NULL, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (SHAPE, DxfShape, shape_list, shape,
+          dxf_entity_vtable_shape_read,
+          dxf_entity_vtable_shape_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (SOLID, DxfSolid, solid_list, solid,
+          dxf_entity_vtable_solid_read,
+          dxf_entity_vtable_solid_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (SPLINE, DxfSpline, spline_list, spline,
+          dxf_entity_vtable_spline_read,
+          dxf_entity_vtable_spline_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (TABLE, DxfTable, table_list, table,
+          dxf_entity_vtable_table_read,
+          dxf_entity_vtable_table_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (TEXT, DxfText, text_list, text,
+          dxf_entity_vtable_text_read,
+          dxf_entity_vtable_text_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (TOLERANCE, DxfTolerance, tolerance_list, tolerance,
+          dxf_entity_vtable_tolerance_read,
+          dxf_entity_vtable_tolerance_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (TRACE, DxfTrace, trace_list, trace,
+          dxf_entity_vtable_trace_read,
+          dxf_entity_vtable_trace_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (VERTEX, DxfVertex, vertex_list, vertex,
+          dxf_entity_vtable_vertex_read,
+          dxf_entity_vtable_vertex_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (VIEWPORT, DxfViewport, viewport_list, viewport,
+          dxf_entity_vtable_viewport_read,
+          dxf_entity_vtable_viewport_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (XLINE, DxfXLine, xline_list, xline,
+          dxf_entity_vtable_xline_read,
+          dxf_entity_vtable_infinite_extents, NULL, NULL, NULL),
+        DXF_ENTITY_VTABLE_ENTRY (MLINE, DxfMline, mline_list, mline,
+          dxf_entity_vtable_mline_read,
+          dxf_entity_vtable_mline_extents, NULL, NULL, NULL)
+};
+
+
+/*!
+ * \brief Get the function table of an entity type.
+ *
+ * \return a pointer to the function table, or \c NULL when the entity
+ * type is not supported.
+ */
+const DxfEntityVtable *
+dxf_entity_get_vtable
+(
+        DxfEntityType type
+                /*!< type of the entity. */
+)
+{
+        if ((type < UNKNOWN_ENTITY)
+          || (type >= DXF_NUMBER_OF_ENTITY_TYPES)
+          || (dxf_entity_vtables[type].size == 0))
+        {
+                return (NULL);
+        }
+        return (&dxf_entity_vtables[type]);
+}
+
+
+/*!
+ * \brief Get the function table of an entity, and report an error when
+ * the entity or its type is not valid.
+ */
+static const DxfEntityVtable *
+dxf_entity_get_entity_vtable
+(
+        void *entity,
+                /*!< a pointer to the entity. */
+        const char *function
+                /*!< name of the calling function. */
+)
+{
+        const DxfEntityVtable *vtable;
+
+        if (entity == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  function);
+                return (NULL);
+        }
+        vtable = dxf_entity_get_vtable (DXF_ENTITY_HEADER (entity)->type);
+        if (vtable == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an entity of an unsupported type %d was passed.\n")),
+                  function, (int) DXF_ENTITY_HEADER (entity)->type);
+        }
+        return (vtable);
+}
+
+
+/*!
+ * \brief Allocate memory for an entity of a given type.
+ *
+ * \return a pointer to the entity, or \c NULL when the type is not
+ * supported or when an error occurred.
+ */
+void *
+dxf_entity_new
+(
+        DxfEntityType type
+                /*!< type of the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityVtable *vtable;
+
+        if ((vtable = dxf_entity_get_vtable (type)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an unsupported entity type %d was passed.\n")),
+                  __FUNCTION__, (int) type);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (vtable->create ());
+}
+
+
+/*!
+ * \brief Initialize the members of an entity allocated by
+ * \c dxf_entity_new ().
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred.
+ */
+void *
+dxf_entity_init
+(
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityVtable *vtable;
+
+        if ((vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__)) == NULL)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (vtable->init (entity));
+}
+
+
+/*!
+ * \brief Read an entity of a given type from a DXF file.
+ *
+ * The fingerprint of the entity is computed when the
+ * \c fingerprint_entities member of \c fp is set (see fingerprint.h).
+ *
+ * \return a pointer to the entity, or \c NULL when the type can not be
+ * read or when an error occurred.
+ */
+void *
+dxf_entity_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntityType type,
+                /*!< type of the entity. */
+        void *entity
+                /*!< a pointer to the entity to read into, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityVtable *vtable;
+
+        vtable = dxf_entity_get_vtable (type);
+        if ((vtable == NULL) || (vtable->read == NULL))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () entities of type %d can not be read.\n")),
+                  __FUNCTION__, (int) type);
+                return (NULL);
+        }
+        entity = vtable->read (fp, entity);
+        if ((entity != NULL) && (fp != NULL) && (fp->fingerprint_entities))
+        {
+                dxf_file_fingerprint_entity (fp, entity);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entity);
+}
+
+
+/*!
+ * \brief Write an entity of any type to a DXF file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entity_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityVtable *vtable;
+
+        if ((vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__)) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (vtable->write (fp, entity));
+}
+
+
+/*!
+ * \brief Free the allocated memory for an entity of any type.
+ *
+ * The \c next member of the entity has to be \c NULL.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_entity_free
+(
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityVtable *vtable;
+
+        if ((vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__)) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (vtable->free (entity));
+}
+
+
+/*!
+ * \brief Get the extents of an entity of any type.
+ *
+ * The extents are computed from the coordinates as stored in the
+ * entity, an extrusion direction is not applied.\n
+ * Text, shapes, tables and block references are represented by their
+ * insertion and alignment points, dimensions by their definition
+ * points.\n
+ * Rays and construction lines have empty extents.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the extents
+ * of the entity are not available.
+ */
+int
+dxf_entity_get_extents
+(
+        void *entity,
+                /*!< a pointer to the entity. */
+        DxfExtents *extents
+                /*!< a pointer to the extents, set on success. */
+)
+{
+        const DxfEntityVtable *vtable;
+
+        if ((extents == NULL)
+          || ((vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__)) == NULL)
+          || (vtable->extents == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        return (vtable->extents (entity, extents));
+}
+
+
+/*!
+ * \brief Transform an entity of any type in place.
+ *
+ * Circles and arcs can only be transformed when their extrusion
+ * direction is the Z-axis and the matrix keeps them circular and in
+ * planes parallel to the XY plane (translation, rotation about the
+ * Z-axis, uniform scale in the XY plane and mirror in the XY plane).\n
+ * On success \c DXF_ENTITY_FLAG_MODIFIED is set in the header of the
+ * entity and its fingerprint is cleared.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the entity
+ * can not be transformed by the matrix.
+ */
+int
+dxf_entity_transform
+(
+        void *entity,
+                /*!< a pointer to the entity. */
+        const DxfMatrix *matrix
+                /*!< a pointer to the matrix. */
+)
+{
+        const DxfEntityVtable *vtable;
+
+        if ((matrix == NULL)
+          || ((vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__)) == NULL)
+          || (vtable->transform == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        if (vtable->transform (entity, matrix) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        DXF_ENTITY_HEADER (entity)->flags |= DXF_ENTITY_FLAG_MODIFIED;
+        DXF_ENTITY_HEADER (entity)->fingerprint = 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make a deep copy of an entity of any type.
+ *
+ * The copy is not linked to the entities following the original.
+ *
+ * \return a pointer to the copy, or \c NULL when the entity can not be
+ * copied or when an error occurred.
+ */
+void *
+dxf_entity_clone
+(
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityVtable *vtable;
+
+        vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__);
+        if ((vtable == NULL) || (vtable->clone == NULL))
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (vtable->clone (entity));
+}
+
+
+/*!
+ * \brief Get the type of an entity.
+ *
+ * \return the type, or \c UNKNOWN_ENTITY when \c NULL was passed.
+ */
+DxfEntityType
+dxf_entity_get_type
+(
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        if (entity == NULL)
+        {
+                return (UNKNOWN_ENTITY);
+        }
+        return (DXF_ENTITY_HEADER (entity)->type);
+}
+
+
+/*!
+ * \brief Get the flags of an entity.
+ *
+ * \return the flags, or 0 when \c NULL was passed.
+ */
+uint32_t
+dxf_entity_get_flags
+(
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        if (entity == NULL)
+        {
+                return (0);
+        }
+        return (DXF_ENTITY_HEADER (entity)->flags);
+}
+
+
+/*!
+ * \brief Set the flags of an entity.
+ *
+ * \return a pointer to the entity, or \c NULL when \c NULL was passed.
+ */
+void *
+dxf_entity_set_flags
+(
+        void *entity,
+                /*!< a pointer to the entity. */
+        uint32_t flags
+                /*!< bitwise OR of \c DXF_ENTITY_FLAG_* values. */
+)
+{
+        if (entity == NULL)
+        {
+                return (NULL);
+        }
+        DXF_ENTITY_HEADER (entity)->flags = flags;
+        return (entity);
+}
+
+
+/*!
+ * \brief Get the content fingerprint of an entity.
+ *
+ * \return the fingerprint, or 0 when it was not computed or \c NULL was
+ * passed.
+ */
+uint64_t
+dxf_entity_get_fingerprint
+(
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        if (entity == NULL)
+        {
+                return (0);
+        }
+        return (DXF_ENTITY_HEADER (entity)->fingerprint);
+}
+
+
+/*!
+ * \brief Set the content fingerprint of an entity, 0 clears it.
+ *
+ * \return a pointer to the entity, or \c NULL when \c NULL was passed.
+ */
+void *
+dxf_entity_set_fingerprint
+(
+        void *entity,
+                /*!< a pointer to the entity. */
+        uint64_t fingerprint
+                /*!< the fingerprint (see fingerprint.h). */
+)
+{
+        if (entity == NULL)
+        {
+                return (NULL);
+        }
+        DXF_ENTITY_HEADER (entity)->fingerprint = fingerprint;
+        return (entity);
+}
+
+
+/*!
+ * \brief Get the identification number (handle) of an entity of any
+ * type.
+ *
+ * \return the identification number, or -1 when an error occurred.
+ */
+int
+dxf_entity_get_id_code
+(
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        const DxfEntityVtable *vtable;
+
+        if ((vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__)) == NULL)
+        {
+                return (-1);
+        }
+        return (*(int *) ((char *) entity + vtable->id_code_offset));
+}
+
+
+/*!
+ * \brief Set the identification number (handle) of an entity of any
+ * type.
+ *
+ * The fingerprint of the entity is kept, it does not cover the handle.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred.
+ */
+void *
+dxf_entity_set_id_code
+(
+        void *entity,
+                /*!< a pointer to the entity. */
+        int id_code
+                /*!< the identification number, -1 for no handle. */
+)
+{
+        const DxfEntityVtable *vtable;
+
+        if ((vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__)) == NULL)
+        {
+                return (NULL);
+        }
+        *(int *) ((char *) entity + vtable->id_code_offset) = id_code;
+        return (entity);
+}
+
+
+/*!
+ * \brief Get the layer of an entity of any type.
+ *
+ * \return a pointer to the layer name owned by the entity, do not free
+ * it, or \c NULL when an error occurred.
+ */
+const char *
+dxf_entity_get_layer
+(
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        const DxfEntityVtable *vtable;
+
+        if ((vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__)) == NULL)
+        {
+                return (NULL);
+        }
+        return (*(char **) ((char *) entity + vtable->layer_offset));
+}
+
+
+/*!
+ * \brief Get the color of an entity of any type.
+ *
+ * \return the color, or \c DXF_COLOR_BYLAYER when an error occurred.
+ */
+int
+dxf_entity_get_color
+(
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        const DxfEntityVtable *vtable;
+
+        if ((vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__)) == NULL)
+        {
+                return (DXF_COLOR_BYLAYER);
+        }
+        return (*(int *) ((char *) entity + vtable->color_offset));
+}
+
+
+/*!
+ * \brief Get the entity following an entity of any type in its list.
+ *
+ * \return a pointer to the next entity, or \c NULL.
+ */
+void *
+dxf_entity_get_next
+(
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        const DxfEntityVtable *vtable;
+
+        if ((vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__)) == NULL)
+        {
+                return (NULL);
+        }
+        return (*(void **) ((char *) entity + vtable->next_offset));
+}
+
+
+/*!
+ * \brief Set the entity following an entity of any type in its list.
+ *
+ * The next entity has to be of the same type.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred.
+ */
+void *
+dxf_entity_set_next
+(
+        void *entity,
+                /*!< a pointer to the entity. */
+        void *next
+                /*!< a pointer to the next entity, or \c NULL. */
+)
+{
+        const DxfEntityVtable *vtable;
+
+        if ((vtable = dxf_entity_get_entity_vtable (entity, __FUNCTION__)) == NULL)
+        {
+                return (NULL);
+        }
+        if ((next != NULL)
+          && (DXF_ENTITY_HEADER (next)->type != vtable->type))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the next entity is of another type.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        *(void **) ((char *) entity + vtable->next_offset) = next;
+        return (entity);
+}
+
+
+/*!
+ * \brief Initialize extents to empty extents.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_init
+(
+        DxfExtents *extents
+                /*!< a pointer to the extents. */
+)
+{
+        if (extents == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        extents->min_x = HUGE_VAL;
+        extents->min_y = HUGE_VAL;
+        extents->min_z = HUGE_VAL;
+        extents->max_x = -HUGE_VAL;
+        extents->max_y = -HUGE_VAL;
+        extents->max_z = -HUGE_VAL;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test if extents are empty.
+ *
+ * \return \c TRUE when no point was added to the extents, else
+ * \c FALSE.
+ */
+int
+dxf_extents_is_empty
+(
+        const DxfExtents *extents
+                /*!< a pointer to the extents. */
+)
+{
+        return ((extents == NULL) || (extents->min_x > extents->max_x));
+}
+
+
+/*!
+ * \brief Grow extents to include a point.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_point
+(
+        DxfExtents *extents,
+                /*!< a pointer to the extents. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double z
+                /*!< Z-value of the point. */
+)
+{
+        if (extents == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (x < extents->min_x) extents->min_x = x;
+        if (y < extents->min_y) extents->min_y = y;
+        if (z < extents->min_z) extents->min_z = z;
+        if (x > extents->max_x) extents->max_x = x;
+        if (y > extents->max_y) extents->max_y = y;
+        if (z > extents->max_z) extents->max_z = z;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Grow extents to include other extents.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_extents_add_extents
+(
+        DxfExtents *extents,
+                /*!< a pointer to the extents. */
+        const DxfExtents *other
+                /*!< a pointer to the other extents. */
+)
+{
+        if ((extents == NULL) || (other == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_extents_is_empty (other))
+        {
+                return (EXIT_SUCCESS);
+        }
+        dxf_extents_add_point (extents, other->min_x, other->min_y, other->min_z);
+        dxf_extents_add_point (extents, other->max_x, other->max_y, other->max_z);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Initialize a matrix to the identity matrix.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_matrix_init
+(
+        DxfMatrix *matrix
+                /*!< a pointer to the matrix. */
+)
+{
+        if (matrix == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        memset (matrix, 0, sizeof (DxfMatrix));
+        matrix->m[0][0] = 1.0;
+        matrix->m[1][1] = 1.0;
+        matrix->m[2][2] = 1.0;
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,136 @@
+/*!
+ * \file entity_vtable.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for the libDXF per entity type function tables.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_ENTITY_VTABLE_H
+#define LIBDXF_SRC_ENTITY_VTABLE_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Get the header of an entity.
+ */
+#define DXF_ENTITY_HEADER(entity) ((DxfEntityHeader *) (entity))
+
+
+/*!
+ * \brief Functions and member offsets of an entity type.
+ *
+ * Functions which are not available for a type are \c NULL.
+ */
+typedef struct
+dxf_entity_vtable_struct
+{
+        DxfEntityType type;
+                /*!< Type of the entity. */
+        size_t size;
+                /*!< Size of the entity struct in bytes. */
+        size_t id_code_offset;
+                /*!< Offset of the \c id_code member (handle). */
+        size_t layer_offset;
+                /*!< Offset of the \c layer member. */
+        size_t color_offset;
+                /*!< Offset of the \c color member. */
+        size_t next_offset;
+                /*!< Offset of the \c next member. */
+        size_t list_offset;
+                /*!< Offset of the list of this type in a
+                 * \c DxfEntities container. */
+        void *(*create) (void);
+                /*!< Allocate a zeroed entity. */
+        void *(*init) (void *entity);
+                /*!< Initialize the members of an entity allocated by
+                 * \c create. */
+        void *(*read) (DxfFile *fp, void *entity);
+                /*!< Read the entity from a DXF file. */
+        int (*write) (DxfFile *fp, void *entity);
+                /*!< Write the entity to a DXF file. */
+        int (*free) (void *entity);
+                /*!< Free the entity and its members, not the entities
+                 * following it in its list. */
+        int (*extents) (void *entity, DxfExtents *extents);
+                /*!< Get the extents of the entity. */
+        int (*transform) (void *entity, const DxfMatrix *matrix);
+                /*!< Transform the entity in place. */
+        void *(*clone) (void *entity);
+                /*!< Make a deep copy of the entity, without the
+                 * entities following it in its list. */
+        uint64_t (*fingerprint) (void *entity);
+                /*!< Hash the members of the entity, except its handle
+                 * (see fingerprint.h). */
+} DxfEntityVtable;
+
+
+const DxfEntityVtable *dxf_entity_get_vtable (DxfEntityType type);
+void *dxf_entity_new (DxfEntityType type);
+void *dxf_entity_init (void *entity);
+void *dxf_entity_read (DxfFile *fp, DxfEntityType type, void *entity);
+int dxf_entity_write (DxfFile *fp, void *entity);
+int dxf_entity_free (void *entity);
+int dxf_entity_get_extents (void *entity, DxfExtents *extents);
+int dxf_entity_transform (void *entity, const DxfMatrix *matrix);
+void *dxf_entity_clone (void *entity);
+DxfEntityType dxf_entity_get_type (void *entity);
+uint32_t dxf_entity_get_flags (void *entity);
+void *dxf_entity_set_flags (void *entity, uint32_t flags);
+uint64_t dxf_entity_get_fingerprint (void *entity);
+void *dxf_entity_set_fingerprint (void *entity, uint64_t fingerprint);
+int dxf_entity_get_id_code (void *entity);
+void *dxf_entity_set_id_code (void *entity, int id_code);
+const char *dxf_entity_get_layer (void *entity);
+int dxf_entity_get_color (void *entity);
+void *dxf_entity_get_next (void *entity);
+void *dxf_entity_set_next (void *entity, void *next);
+int dxf_extents_init (DxfExtents *extents);
+int dxf_extents_is_empty (const DxfExtents *extents);
+int dxf_extents_add_point (DxfExtents *extents, double x, double y, double z);
+int dxf_extents_add_extents (DxfExtents *extents, const DxfExtents *other);
+int dxf_matrix_init (DxfMatrix *matrix);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_ENTITY_VTABLE_H */
+
+
+/* EOF */
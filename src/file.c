@@ -33,12 +33,38 @@
 
 
 #include "file.h"
+#include "drawing.h"
+#include "endblk.h"
+#include "endsec.h"
+#include "entity_vtable.h"
+#include "raw_entity.h"
+#include "tracing.h"
+#include "appid.h"
+#include "block_record.h"
+#include "dimstyle.h"
+#include "layer.h"
+#include "ltype.h"
+#include "style.h"
+#include "ucs.h"
+#include "view.h"
+#include "vport.h"
+#include <strings.h>
+#include <unistd.h>
 
 
-char *dxf_entities_list;
-char *dxf_objects_list;
-char *dxf_blocks_list;
-DxfThumbnail *dxf_thumbnail;
+/*!
+ * \brief Handles (id-codes) collected from a drawing before writing.
+ */
+typedef struct
+dxf_file_handles_struct
+{
+        int *handles;
+                /*!< The collected handles. */
+        size_t number_of_handles;
+                /*!< Number of collected handles. */
+        size_t capacity;
+                /*!< Number of allocated handles. */
+} DxfFileHandles;
 
 
 /*!
@@ -66,11 +92,12 @@ dxf_file_read
         fp = dxf_read_init (filename);
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
+        DXF_TRACING_PHASE_BEGIN (DXF_TRACING_PHASE_FILE);
         while (fp)
         {
                 dxf_read_line (temp_string, fp);
@@ -99,7 +126,7 @@ dxf_file_read
                                 {
                                          /* We were expecting a dxf SECTION and
                                           * got something else. */
-                                        fprintf (stderr,
+                                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                                           (_("Warning: in line %d \"SECTION\" was expected, \"%s\" was found.\n")),
                                           fp->line_number, temp_string);
                                 }
@@ -107,12 +134,13 @@ dxf_file_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning: unexpected string encountered while reading line %d from: %s.\n")),
                           fp->line_number , fp->filename);
                         return (EXIT_FAILURE);
                 }
         }
+        DXF_TRACING_PHASE_END (DXF_TRACING_PHASE_FILE);
         dxf_read_close (fp);
 #if DEBUG
         DXF_DEBUG_END
@@ -122,50 +150,1509 @@ dxf_file_read
 
 
 /*!
- * \brief Function generates dxf output to a file for a complete DXF file.
+ * \brief Append a handle to the collected handles, handles of 0 or less
+ * are not written and are ignored.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_file_handles_append
+(
+        DxfFileHandles *handles,
+                /*!< the collected handles. */
+        int id_code
+                /*!< the handle to append. */
+)
+{
+        int *new_handles;
+        size_t new_capacity;
+
+        if (id_code <= 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (handles->number_of_handles == handles->capacity)
+        {
+                new_capacity = (handles->capacity == 0) ? 1024 : 2 * handles->capacity;
+                new_handles = dxf_realloc (handles->handles, new_capacity * sizeof (int));
+                if (new_handles == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                handles->handles = new_handles;
+                handles->capacity = new_capacity;
+        }
+        handles->handles[handles->number_of_handles++] = id_code;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append the handle of a paged entity, called by
+ * \c dxf_paged_entities_foreach ().
+ */
+static int
+dxf_file_handles_append_paged_entity
+(
+        const DxfPagedEntity *entity,
+                /*!< the paged entity. */
+        void *data
+                /*!< the collected handles. */
+)
+{
+        return (dxf_file_handles_append ((DxfFileHandles *) data, entity->id_code));
+}
+
+
+/*!
+ * \brief Compare two handles for \c qsort ().
+ */
+static int
+dxf_file_handles_compare
+(
+        const void *a,
+        const void *b
+)
+{
+        int handle_a = *(const int *) a;
+        int handle_b = *(const int *) b;
+
+        return ((handle_a > handle_b) - (handle_a < handle_b));
+}
+
+
+/*!
+ * \brief Validate the handles (id-codes) of all symbol table entries,
+ * block definitions, end of block markers and entities of a drawing
+ * before it is written.
+ *
+ * Handles have to be unique within a drawing, and the \c $HANDSEED of
+ * the header has to be larger than the largest handle in use.\n
+ * The drawing is not changed, the next free handle is returned in
+ * \c next_handle: the \c $HANDSEED of the header, or the handle
+ * following the largest handle in use when that is larger.
+ *
+ * \return \c EXIT_SUCCESS when the handles are valid, or
+ * \c EXIT_FAILURE when a handle is used more than once.
  */
 int
-dxf_file_write
+dxf_file_validate_handles
 (
         DxfFile *fp,
-                /*!< file pointer to output file (or device). */
-        DxfHeader dxf_header,
-                /*!< a dxf header. */
-        DxfClass dxf_classes_list,
-                /*!< pointer to a list of CLASSES. */
-        DxfTable dxf_tables_list
-                /*!< pointer to a list of TABLES. */
+                /*!< DXF file pointer to an output file (or device). */
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing. */
+        int *next_handle
+                /*!< the next free handle, may be \c NULL. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        extern char *dxf_entities_list;
-        extern char *dxf_objects_list;
-//        DxfBlock *dxf_blocks_list;
-        extern DxfThumbnail *dxf_thumbnail;
+        DxfFileHandles handles;
+        DxfTables *tables;
+        DxfEntities *entities;
+        DxfHeader *header;
+        DxfBlock *block;
+        void *entity;
+        size_t i;
+        long hand_seed;
+        int result = EXIT_SUCCESS;
 
         /* Do some basic checks. */
-        if (fp == NULL)
+        if (drawing == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-//        dxf_header_init (dxf_header);
-//        dxf_header_write (fp, dxf_header);
-//        dxf_write_classes (fp, dxf_classes_list);
-//        dxf_write_tables (fp, dxf_tables_list);
-//        dxf_block_write_table (fp, dxf_blocks_list);
-//        dxf_entities_write_table (fp, dxf_entities_list);
-//        dxf_object_write_objects (fp, dxf_objects_list);
-//        dxf_thumbnail_write (fp, dxf_thumbnail);
-//        dxf_file_write_eof (fp);
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (EXIT_SUCCESS);
+        header = (DxfHeader *) drawing->header;
+        hand_seed = ((header != NULL) && (header->HandSeed != NULL))
+          ? strtol (header->HandSeed, NULL, 16)
+          : 0;
+        if (next_handle != NULL)
+        {
+                *next_handle = (hand_seed > 0) ? (int) hand_seed : 1;
+        }
+        memset (&handles, 0, sizeof (DxfFileHandles));
+        tables = (DxfTables *) drawing->tables_list;
+        if (tables != NULL)
+        {
+                DxfVPort *vport;
+                DxfLType *ltype;
+                DxfLayer *layer;
+                DxfStyle *style;
+                DxfView *view;
+                DxfUcs *ucs;
+                DxfAppid *appid;
+                DxfDimStyle *dimstyle;
+                DxfBlockRecord *block_record;
+
+                for (vport = (DxfVPort *) tables->vports; vport != NULL; vport = (DxfVPort *) vport->next)
+                {
+                        result |= dxf_file_handles_append (&handles, vport->id_code);
+                }
+                for (ltype = (DxfLType *) tables->ltypes; ltype != NULL; ltype = (DxfLType *) ltype->next)
+                {
+                        result |= dxf_file_handles_append (&handles, ltype->id_code);
+                }
+                for (layer = (DxfLayer *) tables->layers; layer != NULL; layer = (DxfLayer *) layer->next)
+                {
+                        result |= dxf_file_handles_append (&handles, layer->id_code);
+                }
+                for (style = (DxfStyle *) tables->styles; style != NULL; style = (DxfStyle *) style->next)
+                {
+                        result |= dxf_file_handles_append (&handles, style->id_code);
+                }
+                for (view = (DxfView *) tables->views; view != NULL; view = (DxfView *) view->next)
+                {
+                        result |= dxf_file_handles_append (&handles, view->id_code);
+                }
+                for (ucs = (DxfUcs *) tables->ucss; ucs != NULL; ucs = (DxfUcs *) ucs->next)
+                {
+                        result |= dxf_file_handles_append (&handles, ucs->id_code);
+                }
+                for (appid = (DxfAppid *) tables->appids; appid != NULL; appid = (DxfAppid *) appid->next)
+                {
+                        result |= dxf_file_handles_append (&handles, appid->id_code);
+                }
+                for (dimstyle = (DxfDimStyle *) tables->dimstyles; dimstyle != NULL; dimstyle = (DxfDimStyle *) dimstyle->next)
+                {
+                        result |= dxf_file_handles_append (&handles, dimstyle->id_code);
+                }
+                for (block_record = (DxfBlockRecord *) tables->block_records; block_record != NULL; block_record = (DxfBlockRecord *) block_record->next)
+                {
+                        result |= dxf_file_handles_append (&handles, block_record->id_code);
+                }
+        }
+        for (block = (DxfBlock *) drawing->block_list; block != NULL; block = (DxfBlock *) block->next)
+        {
+                if ((block->block_name != NULL)
+                  && (strcmp (block->block_name, "") != 0))
+                {
+                        result |= dxf_file_handles_append (&handles, block->id_code);
+                        if (block->endblk != NULL)
+                        {
+                                result |= dxf_file_handles_append (&handles,
+                                  ((DxfEndblk *) block->endblk)->id_code);
+                        }
+                }
+        }
+        entities = (DxfEntities *) drawing->entities_list;
+        if (entities != NULL)
+        {
+                for (i = 0; i < entities->number_of_entities; i++)
+                {
+                        entity = entities->entities[i];
+                        if (DXF_ENTITY_HEADER (entity)->flags & DXF_ENTITY_FLAG_ERASED)
+                        {
+                                continue;
+                        }
+                        result |= dxf_file_handles_append (&handles, dxf_entity_get_id_code (entity));
+                }
+        }
+        if (drawing->paged_entities != NULL)
+        {
+                result |= dxf_paged_entities_foreach ((DxfPagedEntities *) drawing->paged_entities,
+                  dxf_file_handles_append_paged_entity, &handles);
+        }
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_free (handles.handles);
+                return (EXIT_FAILURE);
+        }
+        if (handles.number_of_handles == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        qsort (handles.handles, handles.number_of_handles, sizeof (int), dxf_file_handles_compare);
+        for (i = 1; i < handles.number_of_handles; i++)
+        {
+                if (handles.handles[i] == handles.handles[i - 1])
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () the handle %x is used more than once.\n")),
+                          __FUNCTION__, handles.handles[i]);
+                        result = EXIT_FAILURE;
+                }
+        }
+        if ((result == EXIT_SUCCESS)
+          && (hand_seed <= handles.handles[handles.number_of_handles - 1]))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
+                  (_("Information from %s () $HANDSEED %lX is not above the largest handle %X.\n")),
+                  __FUNCTION__, hand_seed, handles.handles[handles.number_of_handles - 1]);
+                if (next_handle != NULL)
+                {
+                        *next_handle = handles.handles[handles.number_of_handles - 1] + 1;
+                }
+        }
+        dxf_free (handles.handles);
+        return (result);
+}
+
+
+/*!
+ * \brief Test if the data of a section is written from the members of
+ * a drawing.
+ *
+ * \return \c TRUE for the \c HEADER, \c CLASSES, \c TABLES, \c BLOCKS,
+ * \c ENTITIES, \c OBJECTS and \c THUMBNAILIMAGE sections, \c FALSE
+ * otherwise.
+ */
+static int
+dxf_file_is_modeled_section
+(
+        const char *section_name
+                /*!< name of the section. */
+)
+{
+        return ((strcmp (section_name, "HEADER") == 0)
+          || (strcmp (section_name, "CLASSES") == 0)
+          || (strcmp (section_name, "TABLES") == 0)
+          || (strcmp (section_name, "BLOCKS") == 0)
+          || (strcmp (section_name, "ENTITIES") == 0)
+          || (strcmp (section_name, "OBJECTS") == 0)
+          || (strcmp (section_name, "THUMBNAILIMAGE") == 0));
+}
+
+
+/*!
+ * \brief Get the raw section of a drawing which is written in place of
+ * the members of the drawing.
+ *
+ * A raw \c HEADER, \c CLASSES, \c TABLES, \c BLOCKS or
+ * \c THUMBNAILIMAGE section is written only to a file of the DXF
+ * version it was read from, for another version the section is written
+ * from the members of the drawing.
+ *
+ * \return a pointer to the section, or \c NULL when there is none.
+ */
+static DxfRawSection *
+dxf_file_get_raw_section
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing. */
+        const char *section_name
+                /*!< name of the section. */
+)
+{
+        DxfRawSection *raw_section;
+
+        for (raw_section = (DxfRawSection *) drawing->raw_section_list;
+          raw_section != NULL;
+          raw_section = (DxfRawSection *) raw_section->next)
+        {
+                if ((strcmp (raw_section->section_name, section_name) == 0)
+                  && (raw_section->acad_version_number == fp->acad_version_number))
+                {
+                        return (raw_section);
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Symbol table entries and block definitions a drawing has to
+ * have, see \c dxf_file_missing_defaults ().
+ */
+#define DXF_FILE_DEFAULT_VPORT 0x0001
+#define DXF_FILE_DEFAULT_LTYPE_BYBLOCK 0x0002
+#define DXF_FILE_DEFAULT_LTYPE_BYLAYER 0x0004
+#define DXF_FILE_DEFAULT_LTYPE_CONTINUOUS 0x0008
+#define DXF_FILE_DEFAULT_LAYER 0x0010
+#define DXF_FILE_DEFAULT_STYLE 0x0020
+#define DXF_FILE_DEFAULT_APPID 0x0040
+#define DXF_FILE_DEFAULT_DIMSTYLE 0x0080
+#define DXF_FILE_DEFAULT_MODEL_SPACE_RECORD 0x0100
+#define DXF_FILE_DEFAULT_PAPER_SPACE_RECORD 0x0200
+#define DXF_FILE_DEFAULT_MODEL_SPACE 0x0400
+#define DXF_FILE_DEFAULT_PAPER_SPACE 0x0800
+
+
+/*!
+ * \brief Find the symbol table entries and block definitions a drawing
+ * has to have which are missing in \c drawing.
+ *
+ * All DXF versions have the \c *ACTIVE viewport, the \c CONTINUOUS
+ * linetype, layer \c 0, the \c STANDARD text style and the \c ACAD
+ * application, AutoCAD R13 and later add the \c BYBLOCK and \c BYLAYER
+ * linetypes, the \c STANDARD dimension style and the \c *Model_Space and
+ * \c *Paper_Space blocks with their block records.\n
+ * Names are compared without regard to case, like AutoCAD does.\n
+ * Nothing is missing from a raw \c TABLES or \c BLOCKS section, see
+ * \c dxf_file_get_raw_section ().
+ *
+ * \return the missing entries, \c DXF_FILE_DEFAULT_* flags.
+ */
+static int
+dxf_file_missing_defaults
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfDrawing *drawing
+                /*!< a pointer to the drawing. */
+)
+{
+        DxfTables *tables;
+        DxfBlock *block;
+        int missing;
+
+        missing = DXF_FILE_DEFAULT_VPORT
+          | DXF_FILE_DEFAULT_LTYPE_CONTINUOUS
+          | DXF_FILE_DEFAULT_LAYER
+          | DXF_FILE_DEFAULT_STYLE
+          | DXF_FILE_DEFAULT_APPID;
+        if (fp->acad_version_number >= AutoCAD_13)
+        {
+                missing |= DXF_FILE_DEFAULT_LTYPE_BYBLOCK
+                  | DXF_FILE_DEFAULT_LTYPE_BYLAYER
+                  | DXF_FILE_DEFAULT_DIMSTYLE
+                  | DXF_FILE_DEFAULT_MODEL_SPACE_RECORD
+                  | DXF_FILE_DEFAULT_PAPER_SPACE_RECORD
+                  | DXF_FILE_DEFAULT_MODEL_SPACE
+                  | DXF_FILE_DEFAULT_PAPER_SPACE;
+        }
+        if (dxf_file_get_raw_section (fp, drawing, "TABLES") != NULL)
+        {
+                missing &= DXF_FILE_DEFAULT_MODEL_SPACE
+                  | DXF_FILE_DEFAULT_PAPER_SPACE;
+        }
+        if (dxf_file_get_raw_section (fp, drawing, "BLOCKS") != NULL)
+        {
+                missing &= ~(DXF_FILE_DEFAULT_MODEL_SPACE
+                  | DXF_FILE_DEFAULT_PAPER_SPACE);
+        }
+        tables = (DxfTables *) drawing->tables_list;
+        if (tables != NULL)
+        {
+                DxfVPort *vport;
+                DxfLType *ltype;
+                DxfLayer *layer;
+                DxfStyle *style;
+                DxfAppid *appid;
+                DxfDimStyle *dimstyle;
+                DxfBlockRecord *block_record;
+
+                for (vport = (DxfVPort *) tables->vports; vport != NULL; vport = (DxfVPort *) vport->next)
+                {
+                        if ((vport->viewport_name != NULL)
+                          && (strcasecmp (vport->viewport_name, "*ACTIVE") == 0))
+                        {
+                                missing &= ~DXF_FILE_DEFAULT_VPORT;
+                        }
+                }
+                for (ltype = (DxfLType *) tables->ltypes; ltype != NULL; ltype = (DxfLType *) ltype->next)
+                {
+                        if (ltype->linetype_name == NULL)
+                        {
+                                continue;
+                        }
+                        if (strcasecmp (ltype->linetype_name, "BYBLOCK") == 0)
+                        {
+                                missing &= ~DXF_FILE_DEFAULT_LTYPE_BYBLOCK;
+                        }
+                        if (strcasecmp (ltype->linetype_name, "BYLAYER") == 0)
+                        {
+                                missing &= ~DXF_FILE_DEFAULT_LTYPE_BYLAYER;
+                        }
+                        if (strcasecmp (ltype->linetype_name, "CONTINUOUS") == 0)
+                        {
+                                missing &= ~DXF_FILE_DEFAULT_LTYPE_CONTINUOUS;
+                        }
+                }
+                for (layer = (DxfLayer *) tables->layers; layer != NULL; layer = (DxfLayer *) layer->next)
+                {
+                        if ((layer->layer_name != NULL)
+                          && (strcmp (layer->layer_name, DXF_DEFAULT_LAYER) == 0))
+                        {
+                                missing &= ~DXF_FILE_DEFAULT_LAYER;
+                        }
+                }
+                for (style = (DxfStyle *) tables->styles; style != NULL; style = (DxfStyle *) style->next)
+                {
+                        if ((style->style_name != NULL)
+                          && (strcasecmp (style->style_name, "STANDARD") == 0))
+                        {
+                                missing &= ~DXF_FILE_DEFAULT_STYLE;
+                        }
+                }
+                for (appid = (DxfAppid *) tables->appids; appid != NULL; appid = (DxfAppid *) appid->next)
+                {
+                        if ((appid->application_name != NULL)
+                          && (strcasecmp (appid->application_name, "ACAD") == 0))
+                        {
+                                missing &= ~DXF_FILE_DEFAULT_APPID;
+                        }
+                }
+                for (dimstyle = (DxfDimStyle *) tables->dimstyles; dimstyle != NULL; dimstyle = (DxfDimStyle *) dimstyle->next)
+                {
+                        if ((dimstyle->dimstyle_name != NULL)
+                          && (strcasecmp (dimstyle->dimstyle_name, "STANDARD") == 0))
+                        {
+                                missing &= ~DXF_FILE_DEFAULT_DIMSTYLE;
+                        }
+                }
+                for (block_record = (DxfBlockRecord *) tables->block_records; block_record != NULL; block_record = (DxfBlockRecord *) block_record->next)
+                {
+                        if (block_record->block_name == NULL)
+                        {
+                                continue;
+                        }
+                        if (strcasecmp (block_record->block_name, "*Model_Space") == 0)
+                        {
+                                missing &= ~DXF_FILE_DEFAULT_MODEL_SPACE_RECORD;
+                        }
+                        if (strcasecmp (block_record->block_name, "*Paper_Space") == 0)
+                        {
+                                missing &= ~DXF_FILE_DEFAULT_PAPER_SPACE_RECORD;
+                        }
+                }
+        }
+        for (block = (DxfBlock *) drawing->block_list; block != NULL; block = (DxfBlock *) block->next)
+        {
+                if (block->block_name == NULL)
+                {
+                        continue;
+                }
+                if (strcasecmp (block->block_name, "*Model_Space") == 0)
+                {
+                        missing &= ~DXF_FILE_DEFAULT_MODEL_SPACE;
+                }
+                if (strcasecmp (block->block_name, "*Paper_Space") == 0)
+                {
+                        missing &= ~DXF_FILE_DEFAULT_PAPER_SPACE;
+                }
+        }
+        return (missing);
+}
+
+
+/*!
+ * \brief Count the handles the missing symbol table entries and block
+ * definitions of a drawing take when they are written, see
+ * \c dxf_file_write_before_entities ().
+ *
+ * \return the number of handles.
+ */
+static int
+dxf_file_count_default_handles
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfDrawing *drawing
+                /*!< a pointer to the drawing. */
+)
+{
+        int missing;
+        int number_of_handles = 0;
+
+        missing = dxf_file_missing_defaults (fp, drawing);
+        /* A block definition and its ENDBLK both have a handle. */
+        if (missing & DXF_FILE_DEFAULT_MODEL_SPACE)
+        {
+                number_of_handles++;
+        }
+        if (missing & DXF_FILE_DEFAULT_PAPER_SPACE)
+        {
+                number_of_handles++;
+        }
+        while (missing != 0)
+        {
+                number_of_handles++;
+                missing &= missing - 1;
+        }
+        return (number_of_handles);
+}
+
+
+/*!
+ * \brief Replace a string member of a default entry.
+ */
+#define DXF_FILE_DEFAULT_NAME(member, name) \
+        { \
+                dxf_free (member); \
+                (member) = dxf_strdup (name); \
+        }
+
+
+/*!
+ * \brief Put the missing symbol table entries and block definitions of
+ * a drawing in front of its symbol tables and block definitions.
+ *
+ * \c tables is a copy of the symbol tables of \c drawing and
+ * \c blocks points to its block definitions, the entries and block
+ * definitions of the drawing are not changed.\n
+ * The default entries get the handles following \c fp->last_id_code,
+ * which is advanced, see \c dxf_file_count_default_handles ().\n
+ * The defaults are removed again with \c dxf_file_free_defaults (), also
+ * when an error occurred.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_file_add_defaults
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing. */
+        DxfTables *tables,
+                /*!< the symbol tables which are written. */
+        DxfBlock **blocks
+                /*!< the block definitions which are written. */
+)
+{
+        static const char *linetype_names[3] = {"BYBLOCK", "BYLAYER", "CONTINUOUS"};
+        static const char *descriptions[3] = {"", "", "Solid line"};
+        static const int linetype_flags[3] = {DXF_FILE_DEFAULT_LTYPE_BYBLOCK, DXF_FILE_DEFAULT_LTYPE_BYLAYER, DXF_FILE_DEFAULT_LTYPE_CONTINUOUS};
+        static const char *block_names[2] = {"*Model_Space", "*Paper_Space"};
+        static const int record_flags[2] = {DXF_FILE_DEFAULT_MODEL_SPACE_RECORD, DXF_FILE_DEFAULT_PAPER_SPACE_RECORD};
+        static const int block_flags[2] = {DXF_FILE_DEFAULT_MODEL_SPACE, DXF_FILE_DEFAULT_PAPER_SPACE};
+        DxfHeader *header;
+        DxfLType *last_ltype = NULL;
+        DxfBlockRecord *last_block_record = NULL;
+        DxfBlock *last_block = NULL;
+        int missing;
+        int i;
+
+        header = (DxfHeader *) drawing->header;
+        missing = dxf_file_missing_defaults (fp, drawing);
+        if (missing & DXF_FILE_DEFAULT_VPORT)
+        {
+                DxfVPort *vport;
+
+                if ((vport = dxf_vport_init (dxf_vport_new ())) == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                vport->id_code = ++fp->last_id_code;
+                DXF_FILE_DEFAULT_NAME (vport->viewport_name, "*ACTIVE");
+                vport->x_max = 1.0;
+                vport->y_max = 1.0;
+                vport->x_snap_spacing = 1.0;
+                vport->y_snap_spacing = 1.0;
+                vport->x_grid_spacing = 10.0;
+                vport->y_grid_spacing = 10.0;
+                vport->z_direction = 1.0;
+                vport->view_height = 1.0;
+                vport->viewport_aspect_ratio = 1.0;
+                vport->lens_length = 50.0;
+                vport->circle_zoom_percent = 100;
+                vport->fast_zoom_setting = 1;
+                vport->UCSICON_setting = 3;
+                vport->next = tables->vports;
+                tables->vports = (struct DxfVPort *) vport;
+        }
+        /* Linetypes in the order AutoCAD writes them. */
+        for (i = 0; i < 3; i++)
+        {
+                DxfLType *ltype;
+
+                if (!(missing & linetype_flags[i]))
+                {
+                        continue;
+                }
+                if ((ltype = dxf_ltype_init (dxf_ltype_new ())) == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                ltype->id_code = ++fp->last_id_code;
+                DXF_FILE_DEFAULT_NAME (ltype->linetype_name, linetype_names[i]);
+                DXF_FILE_DEFAULT_NAME (ltype->description, descriptions[i]);
+                if (last_ltype == NULL)
+                {
+                        ltype->next = tables->ltypes;
+                        tables->ltypes = (struct DxfLType *) ltype;
+                }
+                else
+                {
+                        ltype->next = last_ltype->next;
+                        last_ltype->next = (struct DxfLType *) ltype;
+                }
+                last_ltype = ltype;
+        }
+        if (missing & DXF_FILE_DEFAULT_LAYER)
+        {
+                DxfLayer *layer;
+
+                if ((layer = dxf_layer_init (dxf_layer_new ())) == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                layer->id_code = ++fp->last_id_code;
+                DXF_FILE_DEFAULT_NAME (layer->layer_name, DXF_DEFAULT_LAYER);
+                DXF_FILE_DEFAULT_NAME (layer->linetype, "CONTINUOUS");
+                layer->color = DXF_COLOR_WHITE;
+                layer->plotting_flag = 1;
+                layer->lineweight = -3;
+                layer->next = tables->layers;
+                tables->layers = (struct DxfLayer *) layer;
+        }
+        if (missing & DXF_FILE_DEFAULT_STYLE)
+        {
+                DxfStyle *style;
+
+                if ((style = dxf_style_init (dxf_style_new ())) == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                style->id_code = ++fp->last_id_code;
+                DXF_FILE_DEFAULT_NAME (style->style_name, "STANDARD");
+                DXF_FILE_DEFAULT_NAME (style->primary_font_filename, "txt");
+                style->width = 1.0;
+                style->last_height = (header != NULL) ? header->TextSize : 2.5;
+                style->next = tables->styles;
+                tables->styles = (struct DxfStyle *) style;
+        }
+        if (missing & DXF_FILE_DEFAULT_APPID)
+        {
+                DxfAppid *appid;
+
+                if ((appid = dxf_appid_init (dxf_appid_new ())) == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                appid->id_code = ++fp->last_id_code;
+                DXF_FILE_DEFAULT_NAME (appid->application_name, "ACAD");
+                appid->next = tables->appids;
+                tables->appids = (struct DxfAppid *) appid;
+        }
+        if (missing & DXF_FILE_DEFAULT_DIMSTYLE)
+        {
+                DxfDimStyle *dimstyle;
+                DxfStyle *style;
+                char handle[16];
+
+                if ((dimstyle = dxf_dimstyle_init (dxf_dimstyle_new ())) == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                dimstyle->id_code = ++fp->last_id_code;
+                DXF_FILE_DEFAULT_NAME (dimstyle->dimstyle_name, "STANDARD");
+                /* The dimension variables of the header. */
+                if (header != NULL)
+                {
+                        dimstyle->dimscale = header->DimSCALE;
+                        dimstyle->dimasz = header->DimASZ;
+                        dimstyle->dimexo = header->DimEXO;
+                        dimstyle->dimdli = header->DimDLI;
+                        dimstyle->dimexe = header->DimEXE;
+                        dimstyle->dimtxt = header->DimTXT;
+                        dimstyle->dimcen = header->DimCEN;
+                        dimstyle->dimtih = header->DimTIH;
+                        dimstyle->dimtoh = header->DimTOH;
+                        dimstyle->dimaltd = header->DimALTD;
+                        dimstyle->dimaltf = header->DimALTF;
+                        dimstyle->dimlfac = header->DimLFAC;
+                        dimstyle->dimtfac = header->DimTFAC;
+                        dimstyle->dimgap = header->DimGAP;
+                }
+                for (style = (DxfStyle *) tables->styles; style != NULL; style = (DxfStyle *) style->next)
+                {
+                        if ((style->style_name != NULL)
+                          && (strcasecmp (style->style_name, "STANDARD") == 0))
+                        {
+                                snprintf (handle, sizeof (handle), "%X", style->id_code);
+                                DXF_FILE_DEFAULT_NAME (dimstyle->dimtxsty, handle);
+                                break;
+                        }
+                }
+                dimstyle->next = tables->dimstyles;
+                tables->dimstyles = (struct DxfDimStyle *) dimstyle;
+        }
+        for (i = 0; i < 2; i++)
+        {
+                DxfBlockRecord *block_record;
+                DxfBlock *block;
+                DxfEndblk *endblk;
+
+                if (missing & record_flags[i])
+                {
+                        if ((block_record = dxf_block_record_init (dxf_block_record_new ())) == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        block_record->id_code = ++fp->last_id_code;
+                        DXF_FILE_DEFAULT_NAME (block_record->block_name, block_names[i]);
+                        if (last_block_record == NULL)
+                        {
+                                block_record->next = tables->block_records;
+                                tables->block_records = (struct DxfBlockRecord *) block_record;
+                        }
+                        else
+                        {
+                                block_record->next = last_block_record->next;
+                                last_block_record->next = (struct DxfBlockRecord *) block_record;
+                        }
+                        last_block_record = block_record;
+                }
+                if (missing & block_flags[i])
+                {
+                        if ((block = dxf_block_init (dxf_block_new ())) == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        if (last_block == NULL)
+                        {
+                                block->next = (struct DxfBlock *) *blocks;
+                                *blocks = block;
+                        }
+                        else
+                        {
+                                block->next = last_block->next;
+                                last_block->next = (struct DxfBlock *) block;
+                        }
+                        last_block = block;
+                        if ((endblk = (DxfEndblk *) block->endblk) == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        block->id_code = ++fp->last_id_code;
+                        endblk->id_code = ++fp->last_id_code;
+                        DXF_FILE_DEFAULT_NAME (block->block_name, block_names[i]);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the default entries in front of the entries of the
+ * drawing in a symbol table.
+ */
+#define DXF_FILE_FREE_DEFAULTS(type, list, free_entry) \
+        while (tables->list != drawing_tables->list) \
+        { \
+                entry = tables->list; \
+                tables->list = ((type *) entry)->next; \
+                ((type *) entry)->next = NULL; \
+                free_entry ((type *) entry); \
+        }
+
+
+/*!
+ * \brief Free the entries added by \c dxf_file_add_defaults ().
+ */
+static void
+dxf_file_free_defaults
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing. */
+        DxfTables *tables,
+                /*!< the symbol tables which were written. */
+        DxfBlock *blocks
+                /*!< the block definitions which were written. */
+)
+{
+        DxfTables *drawing_tables;
+        DxfTables empty_tables;
+        DxfBlock *block;
+        void *entry;
+
+        drawing_tables = (DxfTables *) drawing->tables_list;
+        if (drawing_tables == NULL)
+        {
+                memset (&empty_tables, 0, sizeof (DxfTables));
+                drawing_tables = &empty_tables;
+        }
+        DXF_FILE_FREE_DEFAULTS (DxfVPort, vports, dxf_vport_free);
+        DXF_FILE_FREE_DEFAULTS (DxfLType, ltypes, dxf_ltype_free);
+        DXF_FILE_FREE_DEFAULTS (DxfLayer, layers, dxf_layer_free);
+        DXF_FILE_FREE_DEFAULTS (DxfStyle, styles, dxf_style_free);
+        DXF_FILE_FREE_DEFAULTS (DxfAppid, appids, dxf_appid_free);
+        DXF_FILE_FREE_DEFAULTS (DxfDimStyle, dimstyles, dxf_dimstyle_free);
+        DXF_FILE_FREE_DEFAULTS (DxfBlockRecord, block_records, dxf_block_record_free);
+        while (blocks != (DxfBlock *) drawing->block_list)
+        {
+                block = blocks;
+                blocks = (DxfBlock *) block->next;
+                block->next = NULL;
+                if (block->endblk != NULL)
+                {
+                        dxf_endblk_free ((DxfEndblk *) block->endblk);
+                }
+                dxf_block_free (block);
+        }
+}
+
+
+/*!
+ * \brief Write the sections of a drawing which precede the \c ENTITIES
+ * section, except the \c HEADER section.
+ *
+ * The \c CLASSES section (AutoCAD R13 and later), the \c TABLES section
+ * and the \c BLOCKS section are written.\n
+ * Symbol table entries and block definitions AutoCAD requires which
+ * the drawing does not have (see \c dxf_file_missing_defaults ()) are
+ * written with default values, with the handles following
+ * \c fp->last_id_code, the drawing is not changed.\n
+ * A raw section of the drawing (see \c dxf_file_get_raw_section ()) is
+ * written as it was read, in place of the classes, symbol tables or
+ * block definitions of the drawing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_write_before_entities
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfDrawing *drawing
+                /*!< a pointer to the drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfClass *class;
+        DxfTables tables;
+        DxfBlock *blocks;
+        DxfRawSection *raw_section;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (drawing == NULL))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->tables_list != NULL)
+        {
+                tables = *(DxfTables *) drawing->tables_list;
+        }
+        else
+        {
+                memset (&tables, 0, sizeof (DxfTables));
+        }
+        blocks = (DxfBlock *) drawing->block_list;
+        if (dxf_file_add_defaults (fp, drawing, &tables, &blocks) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the default symbol table entries.\n")),
+                  __FUNCTION__);
+                dxf_file_free_defaults (drawing, &tables, blocks);
+                return (EXIT_FAILURE);
+        }
+        /* Classes were introduced in AutoCAD R13, classes without a
+         * record name are placeholders. */
+        if ((raw_section = dxf_file_get_raw_section (fp, drawing, "CLASSES")) != NULL)
+        {
+                result |= dxf_raw_section_write (fp, raw_section);
+        }
+        else if (fp->acad_version_number >= AutoCAD_13)
+        {
+                dxf_section_write (fp, "CLASSES");
+                for (class = (DxfClass *) drawing->class_list; class != NULL; class = (DxfClass *) class->next)
+                {
+                        if ((class->record_name != NULL)
+                          && (strcmp (class->record_name, "") != 0))
+                        {
+                                result |= dxf_class_write (fp, class);
+                        }
+                }
+                dxf_class_write_endclass (fp);
+        }
+        if ((raw_section = dxf_file_get_raw_section (fp, drawing, "TABLES")) != NULL)
+        {
+                result |= dxf_raw_section_write (fp, raw_section);
+        }
+        else
+        {
+                result |= dxf_tables_write (fp, &tables);
+        }
+        if ((raw_section = dxf_file_get_raw_section (fp, drawing, "BLOCKS")) != NULL)
+        {
+                result |= dxf_raw_section_write (fp, raw_section);
+        }
+        else
+        {
+                result |= dxf_block_write_table (fp, blocks);
+        }
+        dxf_file_free_defaults (drawing, &tables, blocks);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Write the sections of a drawing which follow the \c ENTITIES
+ * section, and the End Of File marker.
+ *
+ * The \c OBJECTS section (AutoCAD R13 and later) and the
+ * \c THUMBNAILIMAGE section (AutoCAD R2000 and later, when the drawing
+ * has a thumbnail) are written.\n
+ * A raw \c OBJECTS section of the drawing is written instead of its
+ * objects, a raw \c THUMBNAILIMAGE section (see
+ * \c dxf_file_get_raw_section ()) instead of its thumbnail, the raw
+ * sections which are not part of a drawing are written before the
+ * \c THUMBNAILIMAGE section.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, including errors of the stream of \c fp.
+ */
+int
+dxf_file_write_after_entities
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfDrawing *drawing
+                /*!< a pointer to the drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfThumbnail *thumbnail;
+        DxfRawSection *raw_section;
+        DxfRawSection *raw_objects = NULL;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (drawing == NULL))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (raw_section = (DxfRawSection *) drawing->raw_section_list;
+          raw_section != NULL;
+          raw_section = (DxfRawSection *) raw_section->next)
+        {
+                if (strcmp (raw_section->section_name, "OBJECTS") == 0)
+                {
+                        raw_objects = raw_section;
+                }
+        }
+        if (fp->acad_version_number >= AutoCAD_13)
+        {
+                if (raw_objects != NULL)
+                {
+                        result |= dxf_raw_section_write (fp, raw_objects);
+                }
+                else
+                {
+                        result |= dxf_object_write_objects (fp, (DxfObject *) drawing->object_list);
+                }
+        }
+        for (raw_section = (DxfRawSection *) drawing->raw_section_list;
+          raw_section != NULL;
+          raw_section = (DxfRawSection *) raw_section->next)
+        {
+                if (!dxf_file_is_modeled_section (raw_section->section_name))
+                {
+                        result |= dxf_raw_section_write (fp, raw_section);
+                }
+        }
+        thumbnail = (DxfThumbnail *) drawing->thumbnail;
+        if ((raw_section = dxf_file_get_raw_section (fp, drawing, "THUMBNAILIMAGE")) != NULL)
+        {
+                result |= dxf_raw_section_write (fp, raw_section);
+        }
+        else if ((fp->acad_version_number >= AutoCAD_2000)
+          && (thumbnail != NULL)
+          && (thumbnail->number_of_bytes > 0))
+        {
+                result |= dxf_thumbnail_write (fp, thumbnail);
+        }
+        dxf_file_write_eof (fp);
+        if (ferror (fp->fp))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not write to %s.\n")),
+                  __FUNCTION__, (fp->filename != NULL) ? fp->filename : "");
+                result = EXIT_FAILURE;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Function generates dxf output to a file for a complete DXF file.
+ *
+ * The handles of the drawing are validated before anything is written,
+ * then all sections are written in the order AutoCAD writes them.\n
+ * The \c $HANDSEED written is the next free handle returned by
+ * \c dxf_file_validate_handles (), following the handles of the
+ * default symbol table entries, the drawing is not changed.\n
+ * A raw \c HEADER section (see \c dxf_file_get_raw_section ()) is
+ * written as it was read, except for its \c $HANDSEED.\n
+ * Sections which do not exist in the DXF version of \c fp are skipped,
+ * a section which fails is still completed so the file stays readable.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_write
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfDrawing *drawing
+                /*!< a pointer to the drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHeader *header;
+        DxfRawSection *raw_header;
+        char *hand_seed;
+        char next_hand_seed[16];
+        int next_handle;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (drawing == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_file_validate_handles (fp, drawing, &next_handle) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        /* The default symbol table entries take the handles following
+         * the handles of the drawing. */
+        fp->last_id_code = next_handle - 1;
+        next_handle += dxf_file_count_default_handles (fp, drawing);
+        header = (DxfHeader *) drawing->header;
+        if ((raw_header = dxf_file_get_raw_section (fp, drawing, "HEADER")) != NULL)
+        {
+                result |= dxf_raw_section_write_header (fp, raw_header, next_handle);
+        }
+        else if (header != NULL)
+        {
+                /* Write the next free handle as $HANDSEED, the header
+                 * of the drawing is left as it is. */
+                hand_seed = header->HandSeed;
+                snprintf (next_hand_seed, sizeof (next_hand_seed), "%X", next_handle);
+                header->HandSeed = next_hand_seed;
+                result |= dxf_header_write (fp, header);
+                header->HandSeed = hand_seed;
+        }
+        result |= dxf_file_write_before_entities (fp, drawing);
+        if (drawing->paged_entities == NULL)
+        {
+                result |= dxf_entities_write_table (fp, (DxfEntities *) drawing->entities_list);
+        }
+        else
+        {
+                /* Out-of-core entities are merged in file order with
+                 * the entities kept in memory. */
+                dxf_section_write (fp, "ENTITIES");
+                result |= dxf_paged_entities_write (fp,
+                  (DxfPagedEntities *) drawing->paged_entities,
+                  (DxfEntities *) drawing->entities_list);
+                dxf_endsec_write (fp);
+        }
+        result |= dxf_file_write_after_entities (fp, drawing);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Write a complete drawing to a new DXF file.
+ *
+ * The output is written through a \c DXF_FILE_WRITE_BUFFER_SIZE bytes
+ * stdio buffer, see \c dxf_file_write ().\n
+ * With more than one thread the entities are formatted in parallel by
+ * \c dxf_entities_write_parallel (), the output is the same as with a
+ * single thread.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_save
+(
+        const char *filename,
+                /*!< filename of output file (or device). */
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing. */
+        int acad_version_number,
+                /*!< AutoCAD version number of the output file. */
+        int number_of_threads
+                /*!< number of threads formatting the entities, 0 for
+                 * the number of online processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile fp;
+        int result;
+
+        /* Do some basic checks. */
+        if ((filename == NULL) || (strcmp (filename, "") == 0))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () no filename was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.fp = fopen (filename, "w");
+        if (fp.fp == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not open file: %s for writing.\n")),
+                  __FUNCTION__, filename);
+                return (EXIT_FAILURE);
+        }
+        setvbuf (fp.fp, NULL, _IOFBF, DXF_FILE_WRITE_BUFFER_SIZE);
+        fp.filename = dxf_strdup (filename);
+        fp.acad_version_number = acad_version_number;
+        fp.write_threads = (number_of_threads == 0)
+          ? (int) sysconf (_SC_NPROCESSORS_ONLN)
+          : number_of_threads;
+        result = dxf_file_write (&fp, drawing);
+        if (fclose (fp.fp) != 0)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not write to %s.\n")),
+                  __FUNCTION__, filename);
+                result = EXIT_FAILURE;
+        }
+        dxf_free (fp.filename);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Read one group (a group code line and a value line) while
+ * loading a drawing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE at the end of
+ * the file.
+ */
+static int
+dxf_file_load_group
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        int *code,
+                /*!< returns the group code. */
+        char *value
+                /*!< returns the value, \c DXF_MAX_STRING_LENGTH bytes. */
+)
+{
+        char code_string[DXF_MAX_STRING_LENGTH];
+
+        if ((fgets (code_string, DXF_MAX_STRING_LENGTH, fp->fp) == NULL)
+          || (fgets (value, DXF_MAX_STRING_LENGTH, fp->fp) == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        fp->line_number += 2;
+        *code = (int) strtol (code_string, NULL, 10);
+        value[strcspn (value, "\r\n")] = '\0';
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read an entity of any type, after its name was read.
+ *
+ * The entity is read by the reader of the type with the name \c name,
+ * an entity of a type which can not be read is kept as a
+ * \c DxfRawEntity.\n
+ * Like the readers of the entities, the group code of the next entity
+ * is read, its name follows.\n
+ * When the reader fails it closes the file, the \c fp member of
+ * \c fp is set to \c NULL.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred.
+ */
+void *
+dxf_file_read_entity
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        const char *name
+                /*!< name of the entity type, as in the \c 0 group. */
+)
+{
+        const DxfEntityVtable *vtable;
+        void *entity;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (fp->fp == NULL) || (name == NULL))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        vtable = dxf_entity_get_vtable (dxf_tracing_entity_type (name));
+        if ((vtable == NULL) || (vtable->read == NULL))
+        {
+                vtable = dxf_entity_get_vtable (UNKNOWN_ENTITY);
+        }
+        entity = dxf_entity_init (dxf_entity_new (vtable->type));
+        if (entity == NULL)
+        {
+                return (NULL);
+        }
+        if (vtable->type == UNKNOWN_ENTITY)
+        {
+                dxf_raw_entity_set_entity_name ((DxfRawEntity *) entity, (char *) name);
+        }
+        if (dxf_entity_read (fp, vtable->type, entity) == NULL)
+        {
+                /* The reader closed the file. */
+                fp->fp = NULL;
+                dxf_entity_free (entity);
+                return (NULL);
+        }
+        return (entity);
+}
+
+
+/*!
+ * \brief Read a DXF file into a drawing, the counterpart of
+ * \c dxf_file_save ().
+ *
+ * The caller creates the drawing with \c dxf_drawing_new () and
+ * \c dxf_drawing_init (), and may give it a paged storage with
+ * \c dxf_drawing_set_paged_entities () before loading.\n
+ * The AutoCAD version is taken from \c $ACADVER in the \c HEADER
+ * section.\n
+ * The entities of the \c ENTITIES section are read by their type.
+ * With a paged storage, entities which can be kept in a record (see
+ * \c dxf_paged_entities_append_entity ()) are appended to it and freed,
+ * the other entities are appended to the entities of the drawing.
+ * Every paged entity records the number of entities kept in memory
+ * which precede it (see \c dxf_paged_entities_set_sequence ()), so a
+ * saved file keeps the order of the entities of the loaded file.\n
+ * Entities of a type which can not be read are kept as a
+ * \c DxfRawEntity, all other sections are kept as a \c DxfRawSection,
+ * they are written as they were read (see
+ * \c dxf_file_get_raw_section ()).\n
+ * Of the header, \c $ACADVER and \c $HANDSEED are set in the header of
+ * the drawing, the other members keep the values the drawing was
+ * initialized with.\n
+ * The file has to stay unchanged while the drawing refers to it, see
+ * raw_data.c.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_load
+(
+        const char *filename,
+                /*!< filename of input file (or device). */
+        DxfDrawing *drawing
+                /*!< a pointer to the drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char value[DXF_MAX_STRING_LENGTH];
+        DxfFile *fp;
+        DxfAllocator *previous;
+        DxfHeader *header;
+        DxfRawSection *raw_section;
+        DxfRawSection *last_raw_section = NULL;
+        void *entity;
+        int code;
+        int in_entities = FALSE;
+        int have_name = FALSE;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Load with the allocator the drawing was created with. */
+        previous = dxf_allocator_activate ((DxfAllocator *) drawing->allocator);
+        fp = dxf_read_init (filename);
+        if (fp == NULL)
+        {
+                dxf_allocator_activate (previous);
+                return (EXIT_FAILURE);
+        }
+        if (drawing->entities_list == NULL)
+        {
+                drawing->entities_list = (struct DxfEntities *) dxf_entities_new ();
+        }
+        header = (DxfHeader *) drawing->header;
+        fp->acad_version_number = ((header != NULL) && (header->AcadVer != NULL))
+          ? dxf_header_acad_version_from_string (header->AcadVer)
+          : AutoCAD_2000;
+        DXF_TRACING_PHASE_BEGIN (DXF_TRACING_PHASE_FILE);
+        while (drawing->entities_list != NULL)
+        {
+                if (have_name)
+                {
+                        /* The entity reader read the group code of the
+                         * next entity, only its name follows, with or
+                         * without the end of the group code line. */
+                        have_name = FALSE;
+                        code = 0;
+                        if (fscanf (fp->fp, " %[^\n]%*[\n]", value) != 1)
+                        {
+                                break;
+                        }
+                        fp->line_number++;
+                        value[strcspn (value, "\r\n")] = '\0';
+                }
+                else if (dxf_file_load_group (fp, &code, value) != EXIT_SUCCESS)
+                {
+                        break;
+                }
+                if ((code == 0) && (strcmp (value, "EOF") == 0))
+                {
+                        break;
+                }
+                if ((code == 0) && (strcmp (value, "SECTION") == 0))
+                {
+                        if (dxf_file_load_group (fp, &code, value) != EXIT_SUCCESS)
+                        {
+                                break;
+                        }
+                        in_entities = (strcmp (value, "ENTITIES") == 0);
+                        if (!in_entities)
+                        {
+                                /* Keep the section as it was read. */
+                                raw_section = dxf_raw_section_read (fp, value);
+                                if (raw_section == NULL)
+                                {
+                                        result = EXIT_FAILURE;
+                                        break;
+                                }
+                                if (raw_section->acad_version != NULL)
+                                {
+                                        fp->acad_version_number = dxf_header_acad_version_from_string (raw_section->acad_version);
+                                        raw_section->acad_version_number = fp->acad_version_number;
+                                        if (header != NULL)
+                                        {
+                                                dxf_free (header->AcadVer);
+                                                header->AcadVer = dxf_strdup (raw_section->acad_version);
+                                                header->_AcadVer = fp->acad_version_number;
+                                        }
+                                }
+                                if ((raw_section->hand_seed != NULL)
+                                  && (header != NULL))
+                                {
+                                        dxf_free (header->HandSeed);
+                                        header->HandSeed = dxf_strdup (raw_section->hand_seed);
+                                }
+                                if (last_raw_section == NULL)
+                                {
+                                        last_raw_section = (DxfRawSection *) drawing->raw_section_list;
+                                        while ((last_raw_section != NULL)
+                                          && (last_raw_section->next != NULL))
+                                        {
+                                                last_raw_section = (DxfRawSection *) last_raw_section->next;
+                                        }
+                                }
+                                if (last_raw_section == NULL)
+                                {
+                                        drawing->raw_section_list = (struct DxfRawSection *) raw_section;
+                                }
+                                else
+                                {
+                                        last_raw_section->next = (struct DxfRawSection *) raw_section;
+                                }
+                                last_raw_section = raw_section;
+                        }
+                        continue;
+                }
+                if ((code == 0) && (strcmp (value, "ENDSEC") == 0))
+                {
+                        in_entities = FALSE;
+                        continue;
+                }
+                if ((!in_entities) || (code != 0))
+                {
+                        continue;
+                }
+                entity = dxf_file_read_entity (fp, value);
+                if (entity == NULL)
+                {
+                        result = EXIT_FAILURE;
+                        break;
+                }
+                have_name = TRUE;
+                /* A paged entity is written after the entities kept
+                 * in memory which precede it in the file. */
+                if ((drawing->paged_entities != NULL)
+                  && (dxf_paged_entities_set_sequence ((DxfPagedEntities *) drawing->paged_entities,
+                    dxf_entities_get_number_of_entities ((DxfEntities *) drawing->entities_list)) != NULL)
+                  && (dxf_paged_entities_append_entity ((DxfPagedEntities *) drawing->paged_entities, entity) == EXIT_SUCCESS))
+                {
+                        dxf_entity_free (entity);
+                }
+                else if (dxf_entities_append ((DxfEntities *) drawing->entities_list, entity) != EXIT_SUCCESS)
+                {
+                        dxf_entity_free (entity);
+                        result = EXIT_FAILURE;
+                        break;
+                }
+        }
+        DXF_TRACING_PHASE_END (DXF_TRACING_PHASE_FILE);
+        if (drawing->paged_entities != NULL)
+        {
+                /* Entities appended later follow all entities. */
+                dxf_paged_entities_set_sequence ((DxfPagedEntities *) drawing->paged_entities,
+                  DXF_PAGED_ENTITIES_AFTER_RESIDENT);
+        }
+        if (drawing->entities_list == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the entities.\n")),
+                  __FUNCTION__);
+                result = EXIT_FAILURE;
+        }
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not load: %s.\n")),
+                  __FUNCTION__, filename);
+        }
+        dxf_read_close (fp);
+        dxf_allocator_activate (previous);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
 }
 
 
@@ -185,7 +1672,7 @@ dxf_file_write_eof
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
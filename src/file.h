@@ -54,10 +54,32 @@ extern "C" {
 #endif
 
 
+#define DXF_FILE_WRITE_BUFFER_SIZE 1048576
+        /*!< \brief Size of the stdio buffer used by
+         * \c dxf_file_save (). */
+
+
+/* util.h includes this header before drawing.h can be complete, the
+ * drawing is declared by its structure tag (DxfDrawing). */
+struct dxf_drawing_struct;
+
+
 int
 dxf_file_read (char *filename);
 int
-dxf_file_write (DxfFile *fp, DxfHeader dxf_header, DxfClass dxf_classes_list, DxfTable dxf_tables_list);
+dxf_file_validate_handles (DxfFile *fp, struct dxf_drawing_struct *drawing, int *next_handle);
+int
+dxf_file_write_before_entities (DxfFile *fp, struct dxf_drawing_struct *drawing);
+int
+dxf_file_write_after_entities (DxfFile *fp, struct dxf_drawing_struct *drawing);
+int
+dxf_file_write (DxfFile *fp, struct dxf_drawing_struct *drawing);
+int
+dxf_file_save (const char *filename, struct dxf_drawing_struct *drawing, int acad_version_number, int number_of_threads);
+void *
+dxf_file_read_entity (DxfFile *fp, const char *name);
+int
+dxf_file_load (const char *filename, struct dxf_drawing_struct *drawing);
 int
 dxf_file_write_eof (DxfFile *fp);
 
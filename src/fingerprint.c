@@ -0,0 +1,1174 @@
+/*!
+ * \file fingerprint.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF content fingerprints of entities, and
+ * their roll up per layer, per block and per drawing.
+ *
+ * The fingerprint of a \c POINT, \c LINE, \c CIRCLE or \c ARC entity is
+ * the 64 bit hash (see hash.h) of its members, added to a
+ * \c DxfFingerprintHasher by the \c fingerprint function of its
+ * \c DxfEntityVtable, without formatting them.\n
+ * The fingerprint of an entity of another type is the hash of the groups
+ * written for the entity, for \c DXF_FINGERPRINT_ACAD_VERSION, with one
+ * \c DxfMemoryWriter reused for all entities of a thread.\n
+ * Every member except the handle is covered, values which read back the
+ * same give the same fingerprint, whatever the formatting of the file
+ * read or the handles assigned.\n
+ * The fingerprint is stored in the header of the entity, 0 means it was
+ * not computed yet.\n
+ * \c dxf_entity_transform () and the set functions of the \c POINT,
+ * \c LINE, \c CIRCLE and \c ARC entities clear the fingerprint.
+ * After changing an entity of another type through the functions of its
+ * type, the fingerprint has to be cleared by the caller with
+ * \c dxf_entity_set_fingerprint () before it is computed again.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "fingerprint.h"
+#include "entity_vtable.h"
+#include "hash.h"
+#include <pthread.h>
+#include <strings.h>
+#include <unistd.h>
+
+
+#define DXF_FINGERPRINT_MAX_THREADS 64
+        /*!< \brief Maximum number of threads computing fingerprints. */
+
+#define DXF_FINGERPRINT_MIN_ENTITIES_PER_THREAD 4096
+        /*!< \brief Minimum number of entities fingerprinted by a
+         * thread. */
+
+
+/*!
+ * \brief Entity of a drawing, keyed by its layer.
+ */
+typedef struct
+dxf_fingerprint_entry_struct
+{
+        const char *layer;
+                /*!< Name of the layer of the entity. */
+        size_t index;
+                /*!< Index of the entity in the file order vector. */
+        uint64_t fingerprint;
+                /*!< Fingerprint of the entity. */
+} DxfFingerprintEntry;
+
+
+/*!
+ * \brief Range of entities fingerprinted by a thread.
+ */
+typedef struct
+dxf_fingerprint_job_struct
+{
+        DxfEntities *entities;
+                /*!< The entities container. */
+        size_t first;
+                /*!< Index of the first entity. */
+        size_t last;
+                /*!< Index after the last entity. */
+        DxfMemoryWriter writer;
+                /*!< Writer of the entities of the job. */
+        int result;
+                /*!< \c EXIT_SUCCESS, or \c EXIT_FAILURE when one or
+                 * more entities could not be written. */
+} DxfFingerprintJob;
+
+
+/*!
+ * \brief Write a block, for \c dxf_memory_writer_write ().
+ */
+static int
+dxf_fingerprint_write_block
+(
+        DxfFile *fp,
+                /*!< the output file. */
+        void *block
+                /*!< a pointer to the block. */
+)
+{
+        return (dxf_block_write (fp, (DxfBlock *) block));
+}
+
+
+/*!
+ * \brief Hash the text in the buffer of a memory writer, 0 is replaced
+ * by 1 as it marks a missing fingerprint.
+ *
+ * The handles (group code 5) are removed from the text first, so
+ * reassigning handles does not change the fingerprint.
+ */
+static uint64_t
+dxf_fingerprint_text
+(
+        DxfMemoryWriter *writer
+                /*!< the memory writer. */
+)
+{
+        char *line = writer->buffer;
+        char *end = writer->buffer + writer->length;
+        char *code;
+        char *next;
+        uint64_t fingerprint;
+
+        while (line < end)
+        {
+                /* A group is a line with the code and a line with the
+                 * value. */
+                next = memchr (line, '\n', (size_t) (end - line));
+                next = (next != NULL) ? memchr (next + 1, '\n', (size_t) (end - next - 1)) : NULL;
+                next = (next != NULL) ? next + 1 : end;
+                code = line;
+                while (*code == ' ')
+                {
+                        code++;
+                }
+                if ((code[0] == '5')
+                  && ((code[1] == '\n') || (code[1] == '\r')))
+                {
+                        memmove (line, next, (size_t) (end - next));
+                        end -= next - line;
+                }
+                else
+                {
+                        line = next;
+                }
+        }
+        writer->length = (size_t) (end - writer->buffer);
+        fingerprint = dxf_hash64 (writer->buffer, writer->length, 0);
+        return ((fingerprint == 0) ? 1 : fingerprint);
+}
+
+
+/*!
+ * \brief Add bytes to a hasher, hashing the collected bytes when the
+ * buffer is full.
+ */
+static void
+dxf_fingerprint_hasher_add
+(
+        DxfFingerprintHasher *hasher,
+                /*!< the hasher. */
+        const void *data,
+                /*!< the bytes. */
+        size_t length
+                /*!< number of bytes. */
+)
+{
+        if (hasher->length + length > DXF_FINGERPRINT_HASHER_SIZE)
+        {
+                hasher->seed = dxf_hash64 (hasher->buffer, hasher->length, hasher->seed);
+                hasher->length = 0;
+        }
+        if (length > DXF_FINGERPRINT_HASHER_SIZE)
+        {
+                hasher->seed = dxf_hash64 (data, length, hasher->seed);
+                return;
+        }
+        memcpy (hasher->buffer + hasher->length, data, length);
+        hasher->length += length;
+}
+
+
+/*!
+ * \brief Start the hash of the members of an entity of type \c type.
+ */
+void
+dxf_fingerprint_hasher_init
+(
+        DxfFingerprintHasher *hasher,
+                /*!< the hasher. */
+        int type
+                /*!< type of the entity, entities of different types
+                 * get different fingerprints. */
+)
+{
+        hasher->length = 0;
+        hasher->seed = (uint64_t) type;
+}
+
+
+/*!
+ * \brief Add an integer member to a hasher.
+ */
+void
+dxf_fingerprint_hasher_add_int
+(
+        DxfFingerprintHasher *hasher,
+                /*!< the hasher. */
+        long value
+                /*!< the value of the member. */
+)
+{
+        unsigned char bytes[8];
+        uint64_t bits = (uint64_t) (int64_t) value;
+        int k;
+
+        for (k = 0; k < 8; k++)
+        {
+                bytes[k] = (unsigned char) (bits >> (8 * k));
+        }
+        dxf_fingerprint_hasher_add (hasher, bytes, 8);
+}
+
+
+/*!
+ * \brief Add a floating point member to a hasher.
+ *
+ * Values which are written and read back the same add the same bytes.
+ */
+void
+dxf_fingerprint_hasher_add_double
+(
+        DxfFingerprintHasher *hasher,
+                /*!< the hasher. */
+        double value
+                /*!< the value of the member. */
+)
+{
+        unsigned char bytes[8];
+        uint64_t bits;
+        int k;
+
+        memcpy (&bits, &value, sizeof (bits));
+        for (k = 0; k < 8; k++)
+        {
+                bytes[k] = (unsigned char) (bits >> (8 * k));
+        }
+        dxf_fingerprint_hasher_add (hasher, bytes, 8);
+}
+
+
+/*!
+ * \brief Add a string member to a hasher, \c NULL is added as an empty
+ * string.
+ */
+void
+dxf_fingerprint_hasher_add_string
+(
+        DxfFingerprintHasher *hasher,
+                /*!< the hasher. */
+        const char *value
+                /*!< the value of the member. */
+)
+{
+        size_t length = (value != NULL) ? strlen (value) : 0;
+
+        dxf_fingerprint_hasher_add_int (hasher, (long) length);
+        dxf_fingerprint_hasher_add (hasher, value, length);
+}
+
+
+/*!
+ * \brief Finish the hash of the members of an entity, 0 is replaced by
+ * 1 as it marks a missing fingerprint.
+ *
+ * \return the fingerprint.
+ */
+uint64_t
+dxf_fingerprint_hasher_finish
+(
+        DxfFingerprintHasher *hasher
+                /*!< the hasher. */
+)
+{
+        uint64_t fingerprint;
+
+        fingerprint = dxf_hash64 (hasher->buffer, hasher->length, hasher->seed);
+        return ((fingerprint == 0) ? 1 : fingerprint);
+}
+
+
+/*!
+ * \brief Hash a sequence of fingerprints.
+ *
+ * The fingerprints are hashed as little endian bytes, so the result
+ * does not depend on the byte order of the host.
+ *
+ * \return the hash, or 0 when an error occurred.
+ */
+static uint64_t
+dxf_fingerprint_values
+(
+        const uint64_t *values,
+                /*!< the fingerprints. */
+        size_t number_of_values
+                /*!< number of fingerprints. */
+)
+{
+        unsigned char *bytes;
+        uint64_t fingerprint;
+        size_t i;
+        int k;
+
+        bytes = dxf_malloc (8 * number_of_values + 1);
+        if (bytes == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for %lu fingerprints.\n")),
+                  __FUNCTION__, (unsigned long) number_of_values);
+                return (0);
+        }
+        for (i = 0; i < number_of_values; i++)
+        {
+                for (k = 0; k < 8; k++)
+                {
+                        bytes[8 * i + k] = (unsigned char) (values[i] >> (8 * k));
+                }
+        }
+        fingerprint = dxf_hash64 (bytes, 8 * number_of_values, 0);
+        dxf_free (bytes);
+        return ((fingerprint == 0) ? 1 : fingerprint);
+}
+
+
+/*!
+ * \brief Compute the fingerprint of an entity and store it in the
+ * header of the entity.
+ *
+ * The fingerprint is the hash of the members of the entity for the
+ * types with a \c fingerprint function in their \c DxfEntityVtable,
+ * and the hash of the groups written to \c writer for the other types.
+ *
+ * \return the fingerprint, or 0 when the entity could not be written.
+ */
+uint64_t
+dxf_entity_update_fingerprint
+(
+        DxfMemoryWriter *writer,
+                /*!< the memory writer, may be \c NULL for the types
+                 * with a \c fingerprint function. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityVtable *vtable;
+        uint64_t fingerprint = 0;
+
+        vtable = dxf_entity_get_vtable (dxf_entity_get_type (entity));
+        if ((vtable != NULL) && (vtable->fingerprint != NULL))
+        {
+                fingerprint = vtable->fingerprint (entity);
+        }
+        else if ((writer != NULL)
+          && (dxf_memory_writer_write_entity (writer, entity) == EXIT_SUCCESS))
+        {
+                fingerprint = dxf_fingerprint_text (writer);
+        }
+        dxf_entity_set_fingerprint (entity, fingerprint);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (fingerprint);
+}
+
+
+/*!
+ * \brief Compute the fingerprints of a range of entities, the body of a
+ * thread.
+ */
+static void *
+dxf_fingerprint_run_job
+(
+        void *data
+                /*!< the job. */
+)
+{
+        DxfFingerprintJob *job = (DxfFingerprintJob *) data;
+        void *entity;
+        size_t i;
+
+        job->result = EXIT_SUCCESS;
+        for (i = job->first; i < job->last; i++)
+        {
+                entity = job->entities->entities[i];
+                if ((DXF_ENTITY_HEADER (entity)->flags & DXF_ENTITY_FLAG_ERASED)
+                  || (DXF_ENTITY_HEADER (entity)->fingerprint != 0))
+                {
+                        continue;
+                }
+                if (dxf_entity_update_fingerprint (&job->writer, entity) == 0)
+                {
+                        job->result = EXIT_FAILURE;
+                }
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Compute the missing fingerprints of the entities in a
+ * container, on several threads.
+ *
+ * Erased entities are skipped, entities which have a fingerprint keep
+ * it.\n
+ * The entities are written on the calling thread only when the C
+ * library allocator is not in use, or when there are few entities.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an entity
+ * could not be written or an error occurred.
+ */
+int
+dxf_entities_update_fingerprints
+(
+        DxfEntities *entities,
+                /*!< the entities container. */
+        int number_of_threads
+                /*!< number of threads, or 0 for the number of online
+                 * processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFingerprintJob jobs[DXF_FINGERPRINT_MAX_THREADS];
+        pthread_t threads[DXF_FINGERPRINT_MAX_THREADS];
+        int started[DXF_FINGERPRINT_MAX_THREADS];
+        size_t number_of_entities;
+        size_t first;
+        int result = EXIT_SUCCESS;
+        int k;
+
+        /* Do some basic checks. */
+        if (entities == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        number_of_entities = entities->number_of_entities;
+        if (number_of_entities == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        if (number_of_threads > DXF_FINGERPRINT_MAX_THREADS)
+        {
+                number_of_threads = DXF_FINGERPRINT_MAX_THREADS;
+        }
+        if ((size_t) number_of_threads > number_of_entities / DXF_FINGERPRINT_MIN_ENTITIES_PER_THREAD)
+        {
+                number_of_threads = (int) (number_of_entities / DXF_FINGERPRINT_MIN_ENTITIES_PER_THREAD);
+        }
+        if ((number_of_threads < 1)
+          || (!dxf_allocator_is_system ()))
+        {
+                number_of_threads = 1;
+        }
+        memset (jobs, 0, sizeof (jobs));
+        for (k = 0; k < number_of_threads; k++)
+        {
+                if (dxf_memory_writer_open (&jobs[k].writer, DXF_FINGERPRINT_ACAD_VERSION) != EXIT_SUCCESS)
+                {
+                        dxf_memory_writer_close (&jobs[k].writer);
+                        number_of_threads = k;
+                        break;
+                }
+        }
+        first = 0;
+        for (k = 0; k < number_of_threads; k++)
+        {
+                jobs[k].entities = entities;
+                jobs[k].first = first;
+                jobs[k].last = first + (number_of_entities - first) / (number_of_threads - k);
+                first = jobs[k].last;
+        }
+        for (k = 1; k < number_of_threads; k++)
+        {
+                started[k] = (pthread_create (&threads[k], NULL, dxf_fingerprint_run_job, &jobs[k]) == 0);
+        }
+        if (number_of_threads > 0)
+        {
+                dxf_fingerprint_run_job (&jobs[0]);
+                result = jobs[0].result;
+        }
+        else
+        {
+                result = EXIT_FAILURE;
+        }
+        for (k = 1; k < number_of_threads; k++)
+        {
+                if (started[k])
+                {
+                        pthread_join (threads[k], NULL);
+                }
+                else
+                {
+                        dxf_fingerprint_run_job (&jobs[k]);
+                }
+                if (jobs[k].result != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        for (k = 0; k < number_of_threads; k++)
+        {
+                dxf_memory_writer_close (&jobs[k].writer);
+        }
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not write all entities.\n")),
+                  __FUNCTION__);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Compute the fingerprint of an entity read from a DXF file, when
+ * the \c fingerprint_entities member of the file is set.
+ *
+ * The memory writer of the file is created on first use by an entity
+ * type without a \c fingerprint function, and freed by
+ * \c dxf_read_close ().
+ *
+ * \return the fingerprint, or 0 when it was not computed.
+ */
+uint64_t
+dxf_file_fingerprint_entity
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        void *entity
+                /*!< a pointer to the entity read. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfEntityVtable *vtable;
+        DxfMemoryWriter *writer;
+
+        if ((fp == NULL)
+          || (entity == NULL)
+          || (!fp->fingerprint_entities))
+        {
+                return (0);
+        }
+        vtable = dxf_entity_get_vtable (dxf_entity_get_type (entity));
+        if ((fp->fingerprinter == NULL)
+          && ((vtable == NULL) || (vtable->fingerprint == NULL)))
+        {
+                writer = dxf_malloc (sizeof (DxfMemoryWriter));
+                if (writer == NULL)
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for a DxfMemoryWriter struct.\n")),
+                          __FUNCTION__);
+                        return (0);
+                }
+                if (dxf_memory_writer_open (writer, DXF_FINGERPRINT_ACAD_VERSION) != EXIT_SUCCESS)
+                {
+                        dxf_memory_writer_close (writer);
+                        dxf_free (writer);
+                        return (0);
+                }
+                fp->fingerprinter = (struct DxfMemoryWriter *) writer;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_entity_update_fingerprint ((DxfMemoryWriter *) fp->fingerprinter, entity));
+}
+
+
+/*!
+ * \brief Free the memory writer computing the fingerprints of a DXF
+ * file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_free_fingerprinter
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (fp->fingerprinter != NULL)
+        {
+                dxf_memory_writer_close ((DxfMemoryWriter *) fp->fingerprinter);
+                dxf_free (fp->fingerprinter);
+                fp->fingerprinter = NULL;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compare two entries on the name of their layer, without regard
+ * to case, and then on their index, for \c qsort ().
+ */
+static int
+dxf_fingerprint_entry_compare
+(
+        const void *a,
+                /*!< the first entry. */
+        const void *b
+                /*!< the second entry. */
+)
+{
+        const DxfFingerprintEntry *entry_a = (const DxfFingerprintEntry *) a;
+        const DxfFingerprintEntry *entry_b = (const DxfFingerprintEntry *) b;
+        int result;
+
+        result = strcasecmp (entry_a->layer, entry_b->layer);
+        if (result != 0)
+        {
+                return (result);
+        }
+        if (entry_a->index != entry_b->index)
+        {
+                return ((entry_a->index < entry_b->index) ? -1 : 1);
+        }
+        return (0);
+}
+
+
+/*!
+ * \brief Compare two layer fingerprints on the name of their layer,
+ * without regard to case, for \c bsearch ().
+ */
+static int
+dxf_fingerprint_layer_compare
+(
+        const void *a,
+                /*!< the first layer fingerprint. */
+        const void *b
+                /*!< the second layer fingerprint. */
+)
+{
+        return (strcasecmp (((const DxfLayerFingerprint *) a)->layer,
+          ((const DxfLayerFingerprint *) b)->layer));
+}
+
+
+/*!
+ * \brief Compare two block fingerprints on the name of their block,
+ * without regard to case, for \c qsort () and \c bsearch ().
+ */
+static int
+dxf_fingerprint_block_compare
+(
+        const void *a,
+                /*!< the first block fingerprint. */
+        const void *b
+                /*!< the second block fingerprint. */
+)
+{
+        return (strcasecmp (((const DxfBlockFingerprint *) a)->block_name,
+          ((const DxfBlockFingerprint *) b)->block_name));
+}
+
+
+/*!
+ * \brief Roll the fingerprints of the entities up per layer.
+ *
+ * The entities of a layer are hashed in the order of the entities
+ * container.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_fingerprint_layers
+(
+        DxfFingerprints *fingerprints,
+                /*!< the fingerprints of the drawing. */
+        DxfFingerprintEntry *entries,
+                /*!< the entries of the entities, sorted on return. */
+        size_t number_of_entries
+                /*!< number of entries. */
+)
+{
+        uint64_t *values;
+        DxfLayerFingerprint *layer;
+        size_t first;
+        size_t last;
+        size_t i;
+
+        if (number_of_entries == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        qsort (entries, number_of_entries, sizeof (DxfFingerprintEntry),
+          dxf_fingerprint_entry_compare);
+        values = dxf_malloc (number_of_entries * sizeof (uint64_t));
+        fingerprints->layers = dxf_malloc (number_of_entries * sizeof (DxfLayerFingerprint));
+        if ((values == NULL) || (fingerprints->layers == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the fingerprints of the layers.\n")),
+                  __FUNCTION__);
+                dxf_free (values);
+                return (EXIT_FAILURE);
+        }
+        for (first = 0; first < number_of_entries; first = last)
+        {
+                for (last = first; last < number_of_entries; last++)
+                {
+                        if (strcasecmp (entries[first].layer, entries[last].layer) != 0)
+                        {
+                                break;
+                        }
+                        values[last - first] = entries[last].fingerprint;
+                }
+                layer = &fingerprints->layers[fingerprints->number_of_layers];
+                layer->layer = dxf_strdup (entries[first].layer);
+                layer->number_of_entities = last - first;
+                layer->fingerprint = dxf_fingerprint_values (values, last - first);
+                fingerprints->number_of_layers++;
+                if ((layer->layer == NULL) || (layer->fingerprint == 0))
+                {
+                        dxf_free (values);
+                        return (EXIT_FAILURE);
+                }
+        }
+        /* Restore the file order for the drawing fingerprint. */
+        for (i = 0; i < number_of_entries; i++)
+        {
+                values[entries[i].index] = entries[i].fingerprint;
+        }
+        for (i = 0; i < number_of_entries; i++)
+        {
+                entries[i].fingerprint = values[i];
+        }
+        dxf_free (values);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the fingerprints of the blocks of a drawing.
+ *
+ * The block list of a drawing starts with an unnamed block, blocks
+ * without a name are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a block
+ * could not be written or an error occurred.
+ */
+static int
+dxf_fingerprint_blocks
+(
+        DxfFingerprints *fingerprints,
+                /*!< the fingerprints of the drawing. */
+        DxfBlock *blocks
+                /*!< the first block of the drawing. */
+)
+{
+        DxfMemoryWriter writer;
+        DxfBlockFingerprint *fingerprint;
+        DxfBlock *block;
+        size_t number_of_blocks = 0;
+        int result = EXIT_SUCCESS;
+
+        for (block = blocks; block != NULL; block = dxf_block_get_next (block))
+        {
+                if ((block->block_name != NULL) && (block->block_name[0] != '\0'))
+                {
+                        number_of_blocks++;
+                }
+        }
+        if (number_of_blocks == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        fingerprints->blocks = dxf_malloc (number_of_blocks * sizeof (DxfBlockFingerprint));
+        if (fingerprints->blocks == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the fingerprints of the blocks.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_memory_writer_open (&writer, DXF_FINGERPRINT_ACAD_VERSION) != EXIT_SUCCESS)
+        {
+                dxf_memory_writer_close (&writer);
+                return (EXIT_FAILURE);
+        }
+        for (block = blocks; block != NULL; block = dxf_block_get_next (block))
+        {
+                if ((block->block_name == NULL) || (block->block_name[0] == '\0'))
+                {
+                        continue;
+                }
+                fingerprint = &fingerprints->blocks[fingerprints->number_of_blocks];
+                fingerprint->block_name = dxf_strdup (block->block_name);
+                fingerprint->fingerprint = 0;
+                fingerprints->number_of_blocks++;
+                if (dxf_memory_writer_write (&writer,
+                  dxf_fingerprint_write_block, block) != EXIT_SUCCESS)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not write the block %s.\n")),
+                          __FUNCTION__, block->block_name);
+                        result = EXIT_FAILURE;
+                        break;
+                }
+                fingerprint->fingerprint = dxf_fingerprint_text (&writer);
+        }
+        dxf_memory_writer_close (&writer);
+        if (result == EXIT_SUCCESS)
+        {
+                qsort (fingerprints->blocks, fingerprints->number_of_blocks,
+                  sizeof (DxfBlockFingerprint), dxf_fingerprint_block_compare);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfFingerprints.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfFingerprints *
+dxf_fingerprints_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFingerprints *fingerprints = NULL;
+        size_t size;
+
+        size = sizeof (DxfFingerprints);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((fingerprints = dxf_malloc (size)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfFingerprints struct.\n")),
+                  __FUNCTION__);
+                fingerprints = NULL;
+        }
+        else
+        {
+                memset (fingerprints, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (fingerprints);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfFingerprints and all its
+ * data fields.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_fingerprints_free
+(
+        DxfFingerprints *fingerprints
+                /*!< a pointer to the fingerprints. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i;
+
+        /* Do some basic checks. */
+        if (fingerprints == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < fingerprints->number_of_layers; i++)
+        {
+                dxf_free (fingerprints->layers[i].layer);
+        }
+        dxf_free (fingerprints->layers);
+        for (i = 0; i < fingerprints->number_of_blocks; i++)
+        {
+                dxf_free (fingerprints->blocks[i].block_name);
+        }
+        dxf_free (fingerprints->blocks);
+        dxf_free (fingerprints);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Roll the fingerprints of the entities of a drawing up per
+ * layer, per block and for the drawing.
+ *
+ * Missing fingerprints of the entities are computed first, erased
+ * entities are skipped.\n
+ * Entities without a layer are counted on layer \c "0".\n
+ * The drawing fingerprint covers the entities in the order of the
+ * entities container, followed by the blocks sorted by name.\n
+ * Blocks do not hold entities in a \c DxfBlock, so the fingerprint of a
+ * block covers the groups of its \c BLOCK and \c ENDBLK.
+ *
+ * \return the fingerprints, or \c NULL when an entity or a block could
+ * not be written or an error occurred.
+ */
+DxfFingerprints *
+dxf_fingerprints_drawing
+(
+        DxfDrawing *drawing,
+                /*!< the drawing. */
+        int number_of_threads
+                /*!< number of threads computing the fingerprints of the
+                 * entities, or 0 for the number of online processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFingerprints *fingerprints;
+        DxfFingerprintEntry *entries = NULL;
+        DxfEntities *entities;
+        uint64_t *values = NULL;
+        void *entity;
+        size_t number_of_entries = 0;
+        size_t number_of_values;
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((fingerprints = dxf_fingerprints_new ()) == NULL)
+        {
+                return (NULL);
+        }
+        entities = dxf_drawing_get_entities_list (drawing);
+        if ((entities != NULL)
+          && (entities->number_of_entities > 0))
+        {
+                result = dxf_entities_update_fingerprints (entities, number_of_threads);
+                entries = dxf_malloc (entities->number_of_entities * sizeof (DxfFingerprintEntry));
+                if (entries == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for the fingerprints of the entities.\n")),
+                          __FUNCTION__);
+                        result = EXIT_FAILURE;
+                }
+        }
+        for (i = 0; (result == EXIT_SUCCESS) && (entries != NULL) && (i < entities->number_of_entities); i++)
+        {
+                entity = entities->entities[i];
+                if (DXF_ENTITY_HEADER (entity)->flags & DXF_ENTITY_FLAG_ERASED)
+                {
+                        continue;
+                }
+                entries[number_of_entries].layer = dxf_entity_get_layer (entity);
+                if (entries[number_of_entries].layer == NULL)
+                {
+                        entries[number_of_entries].layer = DXF_DEFAULT_LAYER;
+                }
+                entries[number_of_entries].index = number_of_entries;
+                entries[number_of_entries].fingerprint = DXF_ENTITY_HEADER (entity)->fingerprint;
+                number_of_entries++;
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_fingerprint_layers (fingerprints, entries, number_of_entries);
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_fingerprint_blocks (fingerprints, dxf_drawing_get_block_list (drawing));
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                /* The numbers of entities and blocks go first, so
+                 * entities and blocks can not be mistaken. */
+                number_of_values = 2 + number_of_entries + fingerprints->number_of_blocks;
+                values = dxf_malloc (number_of_values * sizeof (uint64_t));
+                if (values == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for the fingerprint of the drawing.\n")),
+                          __FUNCTION__);
+                        result = EXIT_FAILURE;
+                }
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                values[0] = number_of_entries;
+                values[1] = fingerprints->number_of_blocks;
+                for (i = 0; i < number_of_entries; i++)
+                {
+                        values[2 + i] = entries[i].fingerprint;
+                }
+                for (i = 0; i < fingerprints->number_of_blocks; i++)
+                {
+                        values[2 + number_of_entries + i] = fingerprints->blocks[i].fingerprint;
+                }
+                fingerprints->drawing = dxf_fingerprint_values (values, number_of_values);
+                if (fingerprints->drawing == 0)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        dxf_free (values);
+        dxf_free (entries);
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_fingerprints_free (fingerprints);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (fingerprints);
+}
+
+
+/*!
+ * \brief Get the fingerprint of the drawing.
+ *
+ * \return the fingerprint, or 0 when a \c NULL pointer was passed.
+ */
+uint64_t
+dxf_fingerprints_get_drawing
+(
+        DxfFingerprints *fingerprints
+                /*!< a pointer to the fingerprints. */
+)
+{
+        if (fingerprints == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (fingerprints->drawing);
+}
+
+
+/*!
+ * \brief Get the fingerprint of the entities on a layer.
+ *
+ * \return the fingerprint, or 0 when no entities are on the layer.
+ */
+uint64_t
+dxf_fingerprints_get_layer
+(
+        DxfFingerprints *fingerprints,
+                /*!< a pointer to the fingerprints. */
+        const char *layer
+                /*!< name of the layer, compared without regard to
+                 * case. */
+)
+{
+        DxfLayerFingerprint key;
+        DxfLayerFingerprint *found;
+
+        if ((fingerprints == NULL) || (layer == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        key.layer = (char *) layer;
+        found = bsearch (&key, fingerprints->layers, fingerprints->number_of_layers,
+          sizeof (DxfLayerFingerprint), dxf_fingerprint_layer_compare);
+        return ((found != NULL) ? found->fingerprint : 0);
+}
+
+
+/*!
+ * \brief Get the fingerprint of a block.
+ *
+ * \return the fingerprint, or 0 when the drawing has no such block.
+ */
+uint64_t
+dxf_fingerprints_get_block
+(
+        DxfFingerprints *fingerprints,
+                /*!< a pointer to the fingerprints. */
+        const char *block_name
+                /*!< name of the block, compared without regard to
+                 * case. */
+)
+{
+        DxfBlockFingerprint key;
+        DxfBlockFingerprint *found;
+
+        if ((fingerprints == NULL) || (block_name == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        key.block_name = (char *) block_name;
+        found = bsearch (&key, fingerprints->blocks, fingerprints->number_of_blocks,
+          sizeof (DxfBlockFingerprint), dxf_fingerprint_block_compare);
+        return ((found != NULL) ? found->fingerprint : 0);
+}
+
+
+/* EOF */
@@ -0,0 +1,161 @@
+/*!
+ * \file fingerprint.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF content fingerprints of entities, and
+ * their roll up per layer, per block and per drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_FINGERPRINT_H
+#define LIBDXF_SRC_FINGERPRINT_H
+
+
+#include "global.h"
+#include "diagnostics.h"
+#include "drawing.h"
+#include "entities.h"
+#include "memory_writer.h"
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_FINGERPRINT_ACAD_VERSION AutoCAD_2013
+        /*!< \brief AutoCAD version the entities are written for when
+         * their fingerprint is computed, so the fingerprint does not
+         * depend on the version of the file read. */
+
+
+#define DXF_FINGERPRINT_HASHER_SIZE 256
+        /*!< \brief Number of bytes collected by a
+         * \c DxfFingerprintHasher before they are hashed. */
+
+
+/*!
+ * \brief Hash of the members of an entity, for the \c fingerprint
+ * function of a \c DxfEntityVtable.
+ *
+ * The members are collected in \c buffer as little endian bytes, a full
+ * buffer is hashed into \c seed.
+ */
+typedef struct
+dxf_fingerprint_hasher_struct
+{
+        unsigned char buffer[DXF_FINGERPRINT_HASHER_SIZE];
+                /*!< Bytes of the members added last. */
+        size_t length;
+                /*!< Number of bytes in \c buffer. */
+        uint64_t seed;
+                /*!< Hash of the bytes added before. */
+} DxfFingerprintHasher;
+
+
+/*!
+ * \brief Fingerprint of the entities on a layer.
+ */
+typedef struct
+dxf_layer_fingerprint_struct
+{
+        char *layer;
+                /*!< Name of the layer. */
+        uint64_t fingerprint;
+                /*!< Fingerprint of the entities on the layer, in the
+                 * order of the entities container. */
+        size_t number_of_entities;
+                /*!< Number of entities on the layer. */
+} DxfLayerFingerprint;
+
+
+/*!
+ * \brief Fingerprint of a block definition.
+ */
+typedef struct
+dxf_block_fingerprint_struct
+{
+        char *block_name;
+                /*!< Name of the block. */
+        uint64_t fingerprint;
+                /*!< Fingerprint of the block as written. */
+} DxfBlockFingerprint;
+
+
+/*!
+ * \brief Fingerprints of a drawing, rolled up from the fingerprints of
+ * its entities.
+ *
+ * The layers and the blocks are sorted by name, layer names are
+ * compared without regard to case.
+ */
+typedef struct
+dxf_fingerprints_struct
+{
+        uint64_t drawing;
+                /*!< Fingerprint of the entities and the blocks of the
+                 * drawing. */
+        DxfLayerFingerprint *layers;
+                /*!< Fingerprints of the layers with entities. */
+        size_t number_of_layers;
+                /*!< Number of members of \c layers. */
+        DxfBlockFingerprint *blocks;
+                /*!< Fingerprints of the blocks. */
+        size_t number_of_blocks;
+                /*!< Number of members of \c blocks. */
+} DxfFingerprints;
+
+
+void dxf_fingerprint_hasher_init (DxfFingerprintHasher *hasher, int type);
+void dxf_fingerprint_hasher_add_double (DxfFingerprintHasher *hasher, double value);
+void dxf_fingerprint_hasher_add_int (DxfFingerprintHasher *hasher, long value);
+void dxf_fingerprint_hasher_add_string (DxfFingerprintHasher *hasher, const char *value);
+uint64_t dxf_fingerprint_hasher_finish (DxfFingerprintHasher *hasher);
+uint64_t dxf_entity_update_fingerprint (DxfMemoryWriter *writer, void *entity);
+int dxf_entities_update_fingerprints (DxfEntities *entities, int number_of_threads);
+uint64_t dxf_file_fingerprint_entity (DxfFile *fp, void *entity);
+int dxf_file_free_fingerprinter (DxfFile *fp);
+DxfFingerprints *dxf_fingerprints_new ();
+int dxf_fingerprints_free (DxfFingerprints *fingerprints);
+DxfFingerprints *dxf_fingerprints_drawing (DxfDrawing *drawing, int number_of_threads);
+uint64_t dxf_fingerprints_get_drawing (DxfFingerprints *fingerprints);
+uint64_t dxf_fingerprints_get_layer (DxfFingerprints *fingerprints, const char *layer);
+uint64_t dxf_fingerprints_get_block (DxfFingerprints *fingerprints, const char *block_name);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_FINGERPRINT_H */
+
+
+/* EOF */
@@ -45,6 +45,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdint.h> /* not part of the C++ standard */
+#include <stddef.h>
 #include <stdlib.h>
 #include <ctype.h>
 #include <inttypes.h>
@@ -129,7 +130,7 @@
 
 #ifndef DEBUG
 #  define DEBUG 0
-        /*!< \brief Verbose debugging output to \c stderr on/off toggle.
+        /*!< \brief Function entry and exit tracing on/off toggle.
          *
          * If not already defined as a compiler directive the default value is
          * 0 (off). */
@@ -172,20 +173,20 @@
 #endif
 
 #define DXF_DEBUG_BEGIN \
-        fprintf (stderr, \
-          (_("[File: %s: line: %d] Entering %s () function.\n")), \
-          __FILE__, __LINE__, __FUNCTION__);
-        /*!< \brief Verbose debugging output to \c stderr.
+        dxf_tracing_function_begin (__FUNCTION__);
+        /*!< \brief Record the entry of a function as an event in the
+         * trace ring buffer (see tracing.h).
          *
-         * Compile with -DDEBUG compiler directive enabled. */
+         * Compile with -DDEBUG compiler directive enabled and enable
+         * \c DXF_TRACING_EVENTS at run time. */
 
 #define DXF_DEBUG_END \
-        fprintf (stderr, \
-          (_("[File: %s: line: %d] Leaving %s () function.\n")), \
-          __FILE__, __LINE__, __FUNCTION__);
-        /*!< \brief Verbose debugging output to \c stderr.
+        dxf_tracing_function_end (__FUNCTION__);
+        /*!< \brief Record the exit of a function as an event in the
+         * trace ring buffer (see tracing.h).
          *
-         * Compile with -DDEBUG compiler directive enabled. */
+         * Compile with -DDEBUG compiler directive enabled and enable
+         * \c DXF_TRACING_EVENTS at run time. */
 
 
 /*!
@@ -206,6 +207,33 @@ dxf_file_struct
         /*!< AutoCAD version number. */
     int follow_strict_version_rules;
         /*!< follow strict rules when writing to file. */
+    struct DxfDiagnostics *diagnostics;
+        /*!< Collector of diagnostics for this file, or \c NULL for
+         * the default collector (see diagnostics.h). */
+    int keep_binary_text;
+        /*!< keep the hexadecimal text of binary chunk groups (group
+         * code 310) next to the decoded data while reading (see
+         * binary_data.h). */
+    int lazy_proprietary_data;
+        /*!< only record the location of the proprietary data of
+         * \c 3DSOLID, \c BODY and \c REGION entities while reading,
+         * the data is loaded on first access. */
+    int write_threads;
+        /*!< number of threads formatting the entities in
+         * \c dxf_entities_write (), 0 or 1 to format them on the
+         * calling thread. */
+    struct DxfRawSource *raw_source;
+        /*!< the file as a source of raw data passed through, created
+         * when the first raw data is recorded, \c NULL otherwise. */
+    int fingerprint_entities;
+        /*!< compute the fingerprint of every entity read by
+         * \c dxf_entity_read () (see fingerprint.h). */
+    struct DxfMemoryWriter *fingerprinter;
+        /*!< writer computing the fingerprints of the entities read,
+         * created on first use, \c NULL otherwise. */
+    int exact_reals;
+        /*!< write real values with all their significant digits
+         * instead of six decimals (see \c dxf_write_real ()). */
 } DxfFile;
 
 
@@ -506,6 +534,12 @@ dxf_char_struct
          * entity in the drawing the last time the drawing was edited. */
 
 
+/* Need DxfFile, included last. */
+#include "allocator.h"
+#include "diagnostics.h"
+#include "tracing.h"
+
+
 #endif /* LIBDXF_SRC_GLOBAL_H */
 
 
@@ -41,6 +41,7 @@
 
 
 #include "group.h"
+#include "util.h"
 
 
 /*!
@@ -60,9 +61,9 @@ dxf_group_new ()
         size = sizeof (DxfGroup);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((group = malloc (size)) == NULL)
+        if ((group = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfGroup struct.\n")),
                   __FUNCTION__);
                 group = NULL;
@@ -98,25 +99,25 @@ dxf_group_init
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 group = dxf_group_new ();
         }
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfGroup struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         group->id_code = 0;
-        group->description = strdup ("");
-        group->handle_entity_in_group = strdup ("");
+        group->description = dxf_strdup ("");
+        group->handle_entity_in_group = dxf_strdup ("");
         group->unnamed_flag = 0;
         group->selectability_flag = 0;
-        group->dictionary_owner_soft = strdup ("");
-        group->dictionary_owner_hard = strdup ("");
+        group->dictionary_owner_soft = dxf_strdup ("");
+        group->dictionary_owner_hard = dxf_strdup ("");
         group->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -147,43 +148,40 @@ dxf_group_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 group = dxf_group_new ();
                 group = dxf_group_init (group);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -217,7 +215,7 @@ dxf_group_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbGroup") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -226,28 +224,28 @@ dxf_group_read
                 {
                         /* Now follows a string containing a description. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", group->description);
+                        dxf_read_string (fp, &group->description);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", group->dictionary_owner_soft);
+                        dxf_read_string (fp, &group->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "340") == 0)
                 {
                         /* Now follows a string containing a handle to an
                          * entry in group object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", group->handle_entity_in_group);
+                        dxf_read_string (fp, &group->handle_entity_in_group);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", group->dictionary_owner_hard);
+                        dxf_read_string (fp, &group->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -258,13 +256,17 @@ dxf_group_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -290,48 +292,48 @@ dxf_group_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("GROUP");
+        char *dxf_entity_name = dxf_strdup ("GROUP");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (group->description, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty description string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (group->handle_entity_in_group, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty string for handle entity in group for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, group->id_code);
         }
@@ -374,7 +376,7 @@ dxf_group_write
         fprintf (fp->fp, " 71\n%d\n", group->selectability_flag);
         fprintf (fp->fp, "340\n%s\n", group->handle_entity_in_group);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -403,16 +405,16 @@ dxf_group_free
         /* Do some basic checks. */
         if (group->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfGroup was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (group->dictionary_owner_soft);
-        free (group->dictionary_owner_hard);
-        free (group->description);
-        free (group->handle_entity_in_group);
-        free (group);
+        dxf_free (group->dictionary_owner_soft);
+        dxf_free (group->dictionary_owner_hard);
+        dxf_free (group->description);
+        dxf_free (group->handle_entity_in_group);
+        dxf_free (group);
         group = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -432,18 +434,19 @@ dxf_group_free_chain
                 /*!< pointer to the chain of DXF \c GROUP objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (groups == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (groups != NULL)
         {
                 struct DxfGroup *iter = groups->next;
+                groups->next = NULL;
                 dxf_group_free (groups);
                 groups = (DxfGroup *) iter;
         }
@@ -473,14 +476,14 @@ dxf_group_get_id_code
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (group->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -513,14 +516,14 @@ dxf_group_set_id_code
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -556,19 +559,19 @@ dxf_group_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (group->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (group->dictionary_owner_soft);
+        result = dxf_strdup (group->dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -596,19 +599,19 @@ dxf_group_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        group->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        group->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -639,19 +642,19 @@ dxf_group_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (group->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (group->dictionary_owner_hard);
+        result = dxf_strdup (group->dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -679,19 +682,19 @@ dxf_group_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        group->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        group->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -719,20 +722,20 @@ dxf_group_get_unnamed_flag
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (group->unnamed_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the unnamed_flag member.\n")),
                   __FUNCTION__);
         }
         if (group->unnamed_flag > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the unnamed_flag member.\n")),
                   __FUNCTION__);
         }
@@ -762,14 +765,14 @@ dxf_group_set_unnamed_flag
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (unnamed_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative unnamed flag value was passed.\n")),
                   __FUNCTION__);
         }
@@ -801,20 +804,20 @@ dxf_group_get_selectability_flag
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (group->selectability_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the selectability_flag member.\n")),
                   __FUNCTION__);
         }
         if (group->selectability_flag > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the selectability_flag member.\n")),
                   __FUNCTION__);
         }
@@ -844,20 +847,20 @@ dxf_group_set_selectability_flag
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (selectability_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative selectability flag value was passed.\n")),
                   __FUNCTION__);
         }
         if (selectability_flag > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range selectability flag value was passed.\n")),
                   __FUNCTION__);
         }
@@ -889,19 +892,19 @@ dxf_group_get_description
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (group->description ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the description member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (group->description);
+        result = dxf_strdup (group->description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -927,19 +930,19 @@ dxf_group_set_description
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (description == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        group->description = strdup (description);
+        group->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -968,19 +971,19 @@ dxf_group_get_handle_entity_in_group
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (group->handle_entity_in_group ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the handle_entity_in_group member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (group->handle_entity_in_group);
+        result = dxf_strdup (group->handle_entity_in_group);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1007,19 +1010,19 @@ dxf_group_set_handle_entity_in_group
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (handle_entity_in_group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        group->handle_entity_in_group = strdup (handle_entity_in_group);
+        group->handle_entity_in_group = dxf_strdup (handle_entity_in_group);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1050,14 +1053,14 @@ dxf_group_get_next
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (group->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1089,14 +1092,14 @@ dxf_group_set_next
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1130,14 +1133,14 @@ dxf_group_get_last
         /* Do some basic checks. */
         if (group == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (group->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfGroup *) group);
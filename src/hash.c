@@ -0,0 +1,186 @@
+/*!
+ * \file hash.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF 64 bit hashes of data.
+ *
+ * The hash is the XXH64 algorithm by Yann Collet, it processes 32 bytes
+ * per round and gives the same values as the reference implementation,
+ * on hosts of either byte order.\n
+ * It is not a cryptographic hash, it detects changes in data, it does
+ * not protect against deliberate collisions.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "hash.h"
+
+
+#define DXF_HASH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define DXF_HASH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define DXF_HASH_PRIME64_3 0x165667B19E3779F9ULL
+#define DXF_HASH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define DXF_HASH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+
+static uint64_t
+dxf_hash_rotate (uint64_t value, int bits)
+{
+        return ((value << bits) | (value >> (64 - bits)));
+}
+
+
+/*!
+ * \brief Read 8 bytes in little endian byte order.
+ */
+static uint64_t
+dxf_hash_read64 (const unsigned char *bytes)
+{
+        uint64_t value;
+
+        memcpy (&value, bytes, sizeof (value));
+#if defined (__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        value = __builtin_bswap64 (value);
+#endif
+        return (value);
+}
+
+
+/*!
+ * \brief Read 4 bytes in little endian byte order.
+ */
+static uint64_t
+dxf_hash_read32 (const unsigned char *bytes)
+{
+        uint32_t value;
+
+        memcpy (&value, bytes, sizeof (value));
+#if defined (__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        value = __builtin_bswap32 (value);
+#endif
+        return ((uint64_t) value);
+}
+
+
+static uint64_t
+dxf_hash_round (uint64_t accumulator, uint64_t input)
+{
+        accumulator += input * DXF_HASH_PRIME64_2;
+        accumulator = dxf_hash_rotate (accumulator, 31);
+        return (accumulator * DXF_HASH_PRIME64_1);
+}
+
+
+static uint64_t
+dxf_hash_merge (uint64_t accumulator, uint64_t value)
+{
+        accumulator ^= dxf_hash_round (0, value);
+        return (accumulator * DXF_HASH_PRIME64_1 + DXF_HASH_PRIME64_4);
+}
+
+
+/*!
+ * \brief Compute the 64 bit hash of a block of data.
+ *
+ * Equal data gives equal hashes for equal seeds, on every host.
+ *
+ * \return the hash.
+ */
+uint64_t
+dxf_hash64
+(
+        const void *data,
+                /*!< the data, may be \c NULL when \c length is 0. */
+        size_t length,
+                /*!< number of bytes of \c data. */
+        uint64_t seed
+                /*!< seed of the hash, 0 when not used. */
+)
+{
+        const unsigned char *bytes = (const unsigned char *) data;
+        const unsigned char *end = bytes + length;
+        uint64_t hash;
+        uint64_t v1;
+        uint64_t v2;
+        uint64_t v3;
+        uint64_t v4;
+
+        if (length >= 32)
+        {
+                v1 = seed + DXF_HASH_PRIME64_1 + DXF_HASH_PRIME64_2;
+                v2 = seed + DXF_HASH_PRIME64_2;
+                v3 = seed;
+                v4 = seed - DXF_HASH_PRIME64_1;
+                do
+                {
+                        v1 = dxf_hash_round (v1, dxf_hash_read64 (bytes));
+                        v2 = dxf_hash_round (v2, dxf_hash_read64 (bytes + 8));
+                        v3 = dxf_hash_round (v3, dxf_hash_read64 (bytes + 16));
+                        v4 = dxf_hash_round (v4, dxf_hash_read64 (bytes + 24));
+                        bytes += 32;
+                }
+                while (bytes + 32 <= end);
+                hash = dxf_hash_rotate (v1, 1) + dxf_hash_rotate (v2, 7)
+                  + dxf_hash_rotate (v3, 12) + dxf_hash_rotate (v4, 18);
+                hash = dxf_hash_merge (hash, v1);
+                hash = dxf_hash_merge (hash, v2);
+                hash = dxf_hash_merge (hash, v3);
+                hash = dxf_hash_merge (hash, v4);
+        }
+        else
+        {
+                hash = seed + DXF_HASH_PRIME64_5;
+        }
+        hash += (uint64_t) length;
+        for (; bytes + 8 <= end; bytes += 8)
+        {
+                hash ^= dxf_hash_round (0, dxf_hash_read64 (bytes));
+                hash = dxf_hash_rotate (hash, 27) * DXF_HASH_PRIME64_1 + DXF_HASH_PRIME64_4;
+        }
+        if (bytes + 4 <= end)
+        {
+                hash ^= dxf_hash_read32 (bytes) * DXF_HASH_PRIME64_1;
+                hash = dxf_hash_rotate (hash, 23) * DXF_HASH_PRIME64_2 + DXF_HASH_PRIME64_3;
+                bytes += 4;
+        }
+        for (; bytes < end; bytes++)
+        {
+                hash ^= (*bytes) * DXF_HASH_PRIME64_5;
+                hash = dxf_hash_rotate (hash, 11) * DXF_HASH_PRIME64_1;
+        }
+        /* Avalanche. */
+        hash ^= hash >> 33;
+        hash *= DXF_HASH_PRIME64_2;
+        hash ^= hash >> 29;
+        hash *= DXF_HASH_PRIME64_3;
+        hash ^= hash >> 32;
+        return (hash);
+}
+
+
+/* EOF */
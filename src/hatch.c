@@ -40,6 +40,8 @@
 
 
 #include "hatch.h"
+#include "pool.h"
+#include "util.h"
 
 
 /* dxf_hatch functions. */
@@ -61,9 +63,9 @@ dxf_hatch_new ()
         size = sizeof (DxfHatch);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((hatch = malloc (size)) == NULL)
+        if ((hatch = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatch struct.\n")),
                   __FUNCTION__);
                 hatch = NULL;
@@ -71,6 +73,7 @@ dxf_hatch_new ()
         else
         {
                 memset (hatch, 0, size);
+                hatch->header.type = HATCH;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -96,24 +99,26 @@ dxf_hatch_init
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        int i;
+
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 hatch = dxf_hatch_new ();
         }
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatch struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         hatch->id_code = 0;
-        hatch->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        hatch->layer = strdup (DXF_DEFAULT_LAYER);
+        hatch->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        hatch->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         hatch->x0 = 0.0;
         hatch->y0 = 0.0;
         hatch->z0 = 0.0;
@@ -128,22 +133,35 @@ dxf_hatch_init
         hatch->visibility = DXF_DEFAULT_VISIBILITY;
         hatch->color = DXF_COLOR_BYLAYER;
         hatch->paperspace = DXF_MODELSPACE;
+        hatch->pattern_name = dxf_strdup ("");
         hatch->solid_fill = 0;
         hatch->associative = 1;
         hatch->hatch_style = 0;
         hatch->hatch_pattern_type = 0;
         hatch->pattern_double = 0;
         hatch->number_of_pattern_def_lines = 0;
-        dxf_hatch_pattern_def_line_init ((DxfHatchPatternDefLine *) hatch->def_lines);
+        hatch->def_lines = NULL;
         hatch->number_of_boundary_paths = 0;
-        dxf_hatch_boundary_path_init ((DxfHatchBoundaryPath *) hatch->paths);
+        hatch->paths = NULL;
         hatch->number_of_seed_points = 0;
-        dxf_hatch_pattern_seedpoint_init ((DxfHatchPatternSeedPoint *) hatch->seed_points);
+        hatch->seed_points = NULL;
         hatch->graphics_data_size = 0;
-        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) hatch->binary_graphics_data);
-        dxf_hatch_pattern_init ((DxfHatchPattern *) hatch->patterns);
-        hatch->dictionary_owner_soft = strdup ("");
-        hatch->dictionary_owner_hard = strdup ("");
+        hatch->binary_graphics_data = NULL;
+        hatch->patterns = NULL;
+        hatch->dictionary_owner_soft = dxf_strdup ("");
+        hatch->dictionary_owner_hard = dxf_strdup ("");
+        hatch->gradient_fill = 0;
+        hatch->gradient_one_color = 0;
+        hatch->number_of_gradient_colors = 0;
+        hatch->gradient_angle = 0.0;
+        hatch->gradient_shift = 0.0;
+        hatch->gradient_tint = 0.0;
+        for (i = 0; i < DXF_MAX_HATCH_GRADIENT_COLORS; i++)
+        {
+                hatch->gradient_colors[i] = 0;
+                hatch->gradient_true_colors[i] = 0;
+        }
+        hatch->gradient_name = dxf_strdup ("");
         hatch->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -152,6 +170,866 @@ dxf_hatch_init
 }
 
 
+/*!
+ * \brief Sections of the group codes of a \c HATCH entity, group codes
+ * such as 10 have a different meaning in each section.
+ */
+enum
+{
+        DXF_HATCH_READ_ENTITY,
+                /*!< Members of the entity. */
+        DXF_HATCH_READ_BOUNDARY,
+                /*!< Boundary path data, after group code 91. */
+        DXF_HATCH_READ_PATTERN,
+                /*!< Pattern definition lines, after group code 78. */
+        DXF_HATCH_READ_SEED
+                /*!< Seed points, after group code 98. */
+};
+
+
+/*!
+ * \brief Read a group code line from a file.
+ *
+ * Empty lines, as left by reading the entity name with \c fscanf (),
+ * are skipped.
+ *
+ * \return the group code, or -1 at the end of the file.
+ */
+static int
+dxf_hatch_read_group_code
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+        char line[DXF_MAX_STRING_LENGTH];
+        char *end;
+        long code;
+
+        while (fgets (line, DXF_MAX_STRING_LENGTH, fp->fp) != NULL)
+        {
+                code = strtol (line, &end, 10);
+                if (end != line)
+                {
+                        (fp->line_number)++;
+                        return ((int) code);
+                }
+                if (strspn (line, " \t\r\n") != strlen (line))
+                {
+                        (fp->line_number)++;
+                        return (-1);
+                }
+        }
+        return (-1);
+}
+
+
+/*!
+ * \brief Read a group value line from a file.
+ *
+ * A trailing carriage return and line feed are stripped, the remainder
+ * of a line which does not fit is skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE at the end of
+ * the file.
+ */
+static int
+dxf_hatch_read_group_value
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        char *value
+                /*!< buffer of \c DXF_MAX_STRING_LENGTH characters. */
+)
+{
+        size_t length;
+        int c;
+
+        (fp->line_number)++;
+        if (fgets (value, DXF_MAX_STRING_LENGTH, fp->fp) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        length = strlen (value);
+        if ((length > 0) && (value[length - 1] != '\n') && !feof (fp->fp))
+        {
+                while (((c = getc (fp->fp)) != EOF) && (c != '\n'))
+                {
+                }
+        }
+        while ((length > 0)
+          && ((value[length - 1] == '\n') || (value[length - 1] == '\r')))
+        {
+                value[--length] = '\0';
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Terminate the vertices of a boundary path polyline after the
+ * last vertex read.
+ */
+static void
+dxf_hatch_read_trim_vertices
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< DXF hatch boundary path polyline entity. */
+        int number_of_vertices
+                /*!< number of vertices read. */
+)
+{
+        DxfHatchBoundaryPathPolylineVertex *vertices;
+
+        vertices = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+        polyline->number_of_vertices = number_of_vertices;
+        if (number_of_vertices > 0)
+        {
+                vertices[number_of_vertices - 1].next = NULL;
+        }
+        else
+        {
+                dxf_free (vertices);
+                polyline->vertices = NULL;
+                polyline->number_of_allocated_vertices = 0;
+        }
+}
+
+
+/*!
+ * \brief Read data from a DXF file into a DXF \c HATCH entity.
+ *
+ * The last line read from file contained the string "HATCH". \n
+ * Now follows some data for the \c HATCH, to be terminated with a "  0"
+ * string announcing the following entity, or the end of the
+ * \c ENTITY section marker \c ENDSEC. \n
+ * The boundary paths, pattern definition lines and seed points of the
+ * \c HATCH are replaced by the ones read.\n
+ * The vertices of a polyline boundary path are allocated as one array,
+ * sized by the number of vertices (group code 93) given in the file.\n
+ * Every edge of an edge boundary path is read into an element of its
+ * own in the list of edges, in the order of the file.\n
+ * The fit data of spline edges and the handles of the source boundary
+ * objects are skipped.
+ *
+ * \return a pointer to a DXF \c HATCH entity, or \c NULL when an error
+ * occurred.
+ */
+DxfHatch *
+dxf_hatch_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfHatch *hatch
+                /*!< DXF \c HATCH entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char value[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
+        DxfBinaryGraphicsData *binary_graphics_data = NULL;
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathEdge *edge = NULL;
+        DxfHatchBoundaryPathEdgeArc *arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse = NULL;
+        DxfHatchBoundaryPathEdgeLine *line = NULL;
+        DxfHatchBoundaryPathEdgeSpline *spline = NULL;
+        DxfHatchBoundaryPathEdgeSplineCp *control_points = NULL;
+        DxfHatchPatternDefLine *def_line = NULL;
+        DxfHatchPatternDefLineDash *dash = NULL;
+        DxfHatchPatternSeedPoint *seed_point = NULL;
+        int section = DXF_HATCH_READ_ENTITY;
+        int edge_type = 0;
+        int number_of_edges = 0;
+        int has_bulge = 0;
+        int number_of_vertices = 0;
+        int number_of_control_points = 0;
+        int number_of_weights = 0;
+        int gradient_color = -1;
+        int code;
+        int i;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (hatch == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                hatch = dxf_hatch_init (dxf_hatch_new ());
+                if (hatch == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        if (hatch->paths != NULL)
+        {
+                dxf_hatch_boundary_path_free_chain ((DxfHatchBoundaryPath *) hatch->paths);
+                hatch->paths = NULL;
+        }
+        if (hatch->def_lines != NULL)
+        {
+                dxf_hatch_pattern_def_line_free_chain ((DxfHatchPatternDefLine *) hatch->def_lines);
+                hatch->def_lines = NULL;
+        }
+        if (hatch->seed_points != NULL)
+        {
+                dxf_hatch_pattern_seedpoint_free_chain ((DxfHatchPatternSeedPoint *) hatch->seed_points);
+                hatch->seed_points = NULL;
+        }
+        hatch->number_of_boundary_paths = 0;
+        hatch->number_of_pattern_def_lines = 0;
+        hatch->number_of_seed_points = 0;
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (HATCH, fp);
+        while ((code = dxf_hatch_read_group_code (fp)) != 0)
+        {
+                if ((code < 0)
+                  || (dxf_hatch_read_group_value (fp, value) != EXIT_SUCCESS)
+                  || ferror (fp->fp))
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        fclose (fp->fp);
+                        return (NULL);
+                }
+                if ((section == DXF_HATCH_READ_BOUNDARY) && (code == 92))
+                {
+                        /* Now follows a string containing the boundary
+                         * path type flag, which starts a new boundary
+                         * path. */
+                        if (polyline != NULL)
+                        {
+                                dxf_hatch_read_trim_vertices (polyline, number_of_vertices);
+                        }
+                        if (path == NULL)
+                        {
+                                path = dxf_hatch_boundary_path_init (dxf_hatch_boundary_path_new ());
+                                hatch->paths = (struct DxfHatchBoundaryPath *) path;
+                        }
+                        else
+                        {
+                                path->next = (struct DxfHatchBoundaryPath *) dxf_hatch_boundary_path_init (dxf_hatch_boundary_path_new ());
+                                path = (DxfHatchBoundaryPath *) path->next;
+                        }
+                        if (path == NULL)
+                        {
+                                return (NULL);
+                        }
+                        hatch->number_of_boundary_paths++;
+                        path->type_flag = atoi (value);
+                        polyline = NULL;
+                        edge = NULL;
+                        if (path->type_flag & 2)
+                        {
+                                polyline = dxf_hatch_boundary_path_polyline_init (dxf_hatch_boundary_path_polyline_new ());
+                                path->polylines = (struct DxfHatchBoundaryPathPolyline *) polyline;
+                                number_of_vertices = 0;
+                                has_bulge = 0;
+                        }
+                        else
+                        {
+                                edge = dxf_hatch_boundary_path_edge_init (dxf_hatch_boundary_path_edge_new ());
+                                path->edges = (struct DxfHatchBoundaryPathEdge *) edge;
+                                number_of_edges = 0;
+                                edge_type = 0;
+                        }
+                        if ((polyline == NULL) && (edge == NULL))
+                        {
+                                return (NULL);
+                        }
+                        continue;
+                }
+                if ((section == DXF_HATCH_READ_BOUNDARY) && (polyline != NULL))
+                {
+                        switch (code)
+                        {
+                                case 72:
+                                        /* The polyline has bulges. */
+                                        has_bulge = atoi (value);
+                                        continue;
+                                case 73:
+                                        polyline->is_closed = atoi (value);
+                                        continue;
+                                case 93:
+                                        /* Now follows the number of
+                                         * vertices, allocate them in one
+                                         * array. */
+                                        i = atoi (value);
+                                        if ((i > 0)
+                                          && (dxf_hatch_boundary_path_polyline_allocate_vertices (polyline, i) != EXIT_SUCCESS))
+                                        {
+                                                return (NULL);
+                                        }
+                                        continue;
+                                case 10:
+                                        /* Now follows the X-value of a
+                                         * vertex, which starts a new
+                                         * vertex. */
+                                        if ((number_of_vertices == polyline->number_of_allocated_vertices)
+                                          && (dxf_hatch_boundary_path_polyline_allocate_vertices (polyline,
+                                          (number_of_vertices == 0) ? 16 : 2 * number_of_vertices) != EXIT_SUCCESS))
+                                        {
+                                                return (NULL);
+                                        }
+                                        vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices + number_of_vertices;
+                                        number_of_vertices++;
+                                        vertex->x0 = strtod (value, NULL);
+                                        vertex->has_bulge = has_bulge;
+                                        continue;
+                                case 20:
+                                        if (number_of_vertices > 0)
+                                        {
+                                                vertex->y0 = strtod (value, NULL);
+                                        }
+                                        continue;
+                                case 42:
+                                        if (number_of_vertices > 0)
+                                        {
+                                                vertex->bulge = strtod (value, NULL);
+                                        }
+                                        continue;
+                                case 97:
+                                case 330:
+                                        /* Source boundary objects. */
+                                        continue;
+                                default:
+                                        break;
+                        }
+                }
+                if ((section == DXF_HATCH_READ_BOUNDARY) && (edge != NULL))
+                {
+                        if (code == 72)
+                        {
+                                /* Now follows the edge type, which
+                                 * starts a new edge. */
+                                edge_type = atoi (value);
+                                if ((edge_type >= 1) && (edge_type <= 4))
+                                {
+                                        /* Every edge gets its own
+                                         * element of the edge list, so
+                                         * the order of the edges is
+                                         * kept. */
+                                        if (number_of_edges > 0)
+                                        {
+                                                edge->next = (struct DxfHatchBoundaryPathEdge *) dxf_hatch_boundary_path_edge_init (dxf_hatch_boundary_path_edge_new ());
+                                                edge = (DxfHatchBoundaryPathEdge *) edge->next;
+                                                if (edge == NULL)
+                                                {
+                                                        return (NULL);
+                                                }
+                                        }
+                                        number_of_edges++;
+                                }
+                                switch (edge_type)
+                                {
+                                        case 1:
+                                                line = dxf_hatch_boundary_path_edge_line_init (dxf_hatch_boundary_path_edge_line_new ());
+                                                if (line == NULL)
+                                                {
+                                                        return (NULL);
+                                                }
+                                                edge->lines = (struct DxfHatchBoundaryPathEdgeLine *) line;
+                                                break;
+                                        case 2:
+                                                arc = dxf_hatch_boundary_path_edge_arc_init (dxf_hatch_boundary_path_edge_arc_new ());
+                                                if (arc == NULL)
+                                                {
+                                                        return (NULL);
+                                                }
+                                                edge->arcs = (struct DxfHatchBoundaryPathEdgeArc *) arc;
+                                                break;
+                                        case 3:
+                                                ellipse = dxf_hatch_boundary_path_edge_ellipse_init (dxf_hatch_boundary_path_edge_ellipse_new ());
+                                                if (ellipse == NULL)
+                                                {
+                                                        return (NULL);
+                                                }
+                                                edge->ellipses = (struct DxfHatchBoundaryPathEdgeEllipse *) ellipse;
+                                                break;
+                                        case 4:
+                                                spline = dxf_hatch_boundary_path_edge_spline_init (dxf_hatch_boundary_path_edge_spline_new ());
+                                                if (spline == NULL)
+                                                {
+                                                        return (NULL);
+                                                }
+                                                edge->splines = (struct DxfHatchBoundaryPathEdgeSpline *) spline;
+                                                control_points = NULL;
+                                                number_of_control_points = 0;
+                                                number_of_weights = 0;
+                                                break;
+                                        default:
+                                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
+                                                  (_("Warning in %s () unknown edge type found while reading from: %s in line: %d.\n")),
+                                                  __FUNCTION__, fp->filename, fp->line_number);
+                                                edge_type = 0;
+                                                break;
+                                }
+                                continue;
+                        }
+                        if ((code == 93) || (code == 97) || (code == 330))
+                        {
+                                /* The number of edges and the source
+                                 * boundary objects. */
+                                continue;
+                        }
+                        if ((edge_type == 1) && ((code == 10) || (code == 20) || (code == 11) || (code == 21)))
+                        {
+                                switch (code)
+                                {
+                                        case 10: line->x0 = strtod (value, NULL); break;
+                                        case 20: line->y0 = strtod (value, NULL); break;
+                                        case 11: line->x1 = strtod (value, NULL); break;
+                                        case 21: line->y1 = strtod (value, NULL); break;
+                                }
+                                continue;
+                        }
+                        if (edge_type == 2)
+                        {
+                                switch (code)
+                                {
+                                        case 10: arc->x0 = strtod (value, NULL); continue;
+                                        case 20: arc->y0 = strtod (value, NULL); continue;
+                                        case 40: arc->radius = strtod (value, NULL); continue;
+                                        case 50: arc->start_angle = strtod (value, NULL); continue;
+                                        case 51: arc->end_angle = strtod (value, NULL); continue;
+                                        case 73: arc->is_ccw = atoi (value); continue;
+                                        default: break;
+                                }
+                        }
+                        if (edge_type == 3)
+                        {
+                                switch (code)
+                                {
+                                        case 10: ellipse->x0 = strtod (value, NULL); continue;
+                                        case 20: ellipse->y0 = strtod (value, NULL); continue;
+                                        case 11: ellipse->x1 = strtod (value, NULL); continue;
+                                        case 21: ellipse->y1 = strtod (value, NULL); continue;
+                                        case 40: ellipse->ratio = strtod (value, NULL); continue;
+                                        case 50: ellipse->start_angle = strtod (value, NULL); continue;
+                                        case 51: ellipse->end_angle = strtod (value, NULL); continue;
+                                        case 73: ellipse->is_ccw = atoi (value); continue;
+                                        default: break;
+                                }
+                        }
+                        if (edge_type == 4)
+                        {
+                                switch (code)
+                                {
+                                        case 94: spline->degree = atoi (value); continue;
+                                        case 73: spline->rational = atoi (value); continue;
+                                        case 74: spline->periodic = atoi (value); continue;
+                                        case 95:
+                                                /* The knots are counted
+                                                 * while they are read. */
+                                                continue;
+                                        case 40:
+                                                if (spline->number_of_knots < DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
+                                                {
+                                                        spline->knots[spline->number_of_knots++] = strtod (value, NULL);
+                                                }
+                                                else
+                                                {
+                                                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
+                                                          (_("Warning in %s () too many knots found while reading from: %s in line: %d.\n")),
+                                                          __FUNCTION__, fp->filename, fp->line_number);
+                                                }
+                                                continue;
+                                        case 96:
+                                                /* Now follows the number
+                                                 * of control points,
+                                                 * allocate them in one
+                                                 * array. */
+                                                i = atoi (value);
+                                                if ((control_points != NULL) || (i <= 0))
+                                                {
+                                                        continue;
+                                                }
+                                                control_points = dxf_malloc (i * sizeof (DxfHatchBoundaryPathEdgeSplineCp));
+                                                if (control_points == NULL)
+                                                {
+                                                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                                                          (_("Error in %s () could not allocate memory for the control points.\n")),
+                                                          __FUNCTION__);
+                                                        return (NULL);
+                                                }
+                                                memset (control_points, 0, i * sizeof (DxfHatchBoundaryPathEdgeSplineCp));
+                                                for (number_of_control_points = 0;
+                                                  number_of_control_points < i;
+                                                  number_of_control_points++)
+                                                {
+                                                        control_points[number_of_control_points].weight = 1.0;
+                                                        if (number_of_control_points + 1 < i)
+                                                        {
+                                                                control_points[number_of_control_points].next = (struct DxfHatchBoundaryPathEdgeSplineCp *) &control_points[number_of_control_points + 1];
+                                                        }
+                                                }
+                                                spline->control_points = (struct DxfHatchBoundaryPathEdgeSplineCp *) control_points;
+                                                spline->number_of_control_points = i;
+                                                number_of_control_points = 0;
+                                                continue;
+                                        case 10:
+                                                if (number_of_control_points < spline->number_of_control_points)
+                                                {
+                                                        control_points[number_of_control_points++].x0 = strtod (value, NULL);
+                                                }
+                                                continue;
+                                        case 20:
+                                                if (number_of_control_points > 0)
+                                                {
+                                                        control_points[number_of_control_points - 1].y0 = strtod (value, NULL);
+                                                }
+                                                continue;
+                                        case 42:
+                                                /* The weights either
+                                                 * follow each control
+                                                 * point or all control
+                                                 * points. */
+                                                if (number_of_weights < spline->number_of_control_points)
+                                                {
+                                                        control_points[number_of_weights++].weight = strtod (value, NULL);
+                                                }
+                                                continue;
+                                        case 11:
+                                        case 21:
+                                        case 12:
+                                        case 22:
+                                        case 13:
+                                        case 23:
+                                                /* Fit data. */
+                                                continue;
+                                        default:
+                                                break;
+                                }
+                        }
+                }
+                if (section == DXF_HATCH_READ_PATTERN)
+                {
+                        if (code == 53)
+                        {
+                                /* Now follows the angle of a pattern
+                                 * definition line, which starts a new
+                                 * line. */
+                                if (def_line == NULL)
+                                {
+                                        def_line = dxf_hatch_pattern_def_line_init (dxf_hatch_pattern_def_line_new ());
+                                        hatch->def_lines = (struct DxfHatchPatternDefLine *) def_line;
+                                }
+                                else
+                                {
+                                        def_line->next = (struct DxfHatchPatternDefLine *) dxf_hatch_pattern_def_line_init (dxf_hatch_pattern_def_line_new ());
+                                        def_line = (DxfHatchPatternDefLine *) def_line->next;
+                                }
+                                if (def_line == NULL)
+                                {
+                                        return (NULL);
+                                }
+                                hatch->number_of_pattern_def_lines++;
+                                def_line->angle = strtod (value, NULL);
+                                dash = NULL;
+                                continue;
+                        }
+                        if ((def_line != NULL) && (code == 49))
+                        {
+                                /* Now follows a dash length. */
+                                if (dash == NULL)
+                                {
+                                        dash = dxf_hatch_pattern_def_line_dash_init (dxf_hatch_pattern_def_line_dash_new ());
+                                        def_line->dashes = (struct DxfHatchPatternDefLineDash *) dash;
+                                }
+                                else
+                                {
+                                        dash->next = (struct DxfHatchPatternDefLineDash *) dxf_hatch_pattern_def_line_dash_init (dxf_hatch_pattern_def_line_dash_new ());
+                                        dash = (DxfHatchPatternDefLineDash *) dash->next;
+                                }
+                                if (dash == NULL)
+                                {
+                                        return (NULL);
+                                }
+                                dash->length = strtod (value, NULL);
+                                continue;
+                        }
+                        if (def_line != NULL)
+                        {
+                                switch (code)
+                                {
+                                        case 43: def_line->x0 = strtod (value, NULL); continue;
+                                        case 44: def_line->y0 = strtod (value, NULL); continue;
+                                        case 45: def_line->x1 = strtod (value, NULL); continue;
+                                        case 46: def_line->y1 = strtod (value, NULL); continue;
+                                        case 79: def_line->number_of_dash_items = atoi (value); continue;
+                                        default: break;
+                                }
+                        }
+                }
+                if (section == DXF_HATCH_READ_SEED)
+                {
+                        if (code == 10)
+                        {
+                                /* Now follows the X-value of a seed
+                                 * point, which starts a new seed point. */
+                                if (seed_point == NULL)
+                                {
+                                        seed_point = dxf_hatch_pattern_seedpoint_init (dxf_hatch_pattern_seedpoint_new ());
+                                        hatch->seed_points = (struct DxfHatchPatternSeedPoint *) seed_point;
+                                }
+                                else
+                                {
+                                        seed_point->next = (struct DxfHatchPatternSeedPoint *) dxf_hatch_pattern_seedpoint_init (dxf_hatch_pattern_seedpoint_new ());
+                                        seed_point = (DxfHatchPatternSeedPoint *) seed_point->next;
+                                }
+                                if (seed_point == NULL)
+                                {
+                                        return (NULL);
+                                }
+                                hatch->number_of_seed_points++;
+                                seed_point->x0 = strtod (value, NULL);
+                                continue;
+                        }
+                        if ((seed_point != NULL) && (code == 20))
+                        {
+                                seed_point->y0 = strtod (value, NULL);
+                                continue;
+                        }
+                }
+                /* The members of the entity, these end the boundary
+                 * path data, pattern data and seed points. */
+                if (section == DXF_HATCH_READ_BOUNDARY)
+                {
+                        if (polyline != NULL)
+                        {
+                                dxf_hatch_read_trim_vertices (polyline, number_of_vertices);
+                        }
+                        polyline = NULL;
+                        edge = NULL;
+                }
+                section = DXF_HATCH_READ_ENTITY;
+                switch (code)
+                {
+                        case 2:
+                                /* Now follows a string containing the
+                                 * pattern name. */
+                                dxf_string_assign (&hatch->pattern_name, value);
+                                break;
+                        case 5:
+                                /* Now follows a string containing a
+                                 * sequential id number. */
+                                hatch->id_code = (int) strtol (value, NULL, 16);
+                                break;
+                        case 6:
+                                /* Now follows a string containing a
+                                 * linetype name. */
+                                dxf_string_assign (&hatch->linetype, value);
+                                break;
+                        case 8:
+                                /* Now follows a string containing a
+                                 * layer name. */
+                                dxf_string_assign (&hatch->layer, value);
+                                break;
+                        case 10:
+                                /* Now follows a string containing the
+                                 * X-value of the elevation point. */
+                                hatch->x0 = strtod (value, NULL);
+                                break;
+                        case 20:
+                                hatch->y0 = strtod (value, NULL);
+                                break;
+                        case 30:
+                                hatch->z0 = strtod (value, NULL);
+                                break;
+                        case 39:
+                                hatch->thickness = strtod (value, NULL);
+                                break;
+                        case 41:
+                                hatch->pattern_scale = strtod (value, NULL);
+                                break;
+                        case 47:
+                                hatch->pixel_size = strtod (value, NULL);
+                                break;
+                        case 48:
+                                hatch->linetype_scale = strtod (value, NULL);
+                                break;
+                        case 52:
+                                hatch->pattern_angle = strtod (value, NULL);
+                                break;
+                        case 60:
+                                hatch->visibility = (int16_t) atoi (value);
+                                break;
+                        case 62:
+                                hatch->color = atoi (value);
+                                break;
+                        case 63:
+                                /* Now follows a string containing the
+                                 * color index of a gradient color. */
+                                if (gradient_color < 0)
+                                {
+                                        gradient_color = 0;
+                                }
+                                if (gradient_color < DXF_MAX_HATCH_GRADIENT_COLORS)
+                                {
+                                        hatch->gradient_colors[gradient_color] = atoi (value);
+                                }
+                                break;
+                        case 67:
+                                hatch->paperspace = atoi (value);
+                                break;
+                        case 70:
+                                hatch->solid_fill = atoi (value);
+                                break;
+                        case 71:
+                                hatch->associative = atoi (value);
+                                break;
+                        case 75:
+                                hatch->hatch_style = atoi (value);
+                                break;
+                        case 76:
+                                hatch->hatch_pattern_type = atoi (value);
+                                break;
+                        case 77:
+                                hatch->pattern_double = atoi (value);
+                                break;
+                        case 78:
+                                /* Now follows the number of pattern
+                                 * definition lines. */
+                                section = DXF_HATCH_READ_PATTERN;
+                                break;
+                        case 91:
+                                /* Now follows the number of boundary
+                                 * paths. */
+                                section = DXF_HATCH_READ_BOUNDARY;
+                                break;
+                        case 92:
+                                hatch->graphics_data_size = atoi (value);
+                                break;
+                        case 98:
+                                /* Now follows the number of seed
+                                 * points. */
+                                section = DXF_HATCH_READ_SEED;
+                                break;
+                        case 210:
+                                hatch->extr_x0 = strtod (value, NULL);
+                                break;
+                        case 220:
+                                hatch->extr_y0 = strtod (value, NULL);
+                                break;
+                        case 230:
+                                hatch->extr_z0 = strtod (value, NULL);
+                                break;
+                        case 310:
+                                /* Now follows a string containing binary
+                                 * graphics data, append it to the chain. */
+                                if (binary_graphics_data == NULL)
+                                {
+                                        if (hatch->binary_graphics_data == NULL)
+                                        {
+                                                hatch->binary_graphics_data = (struct DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+                                        }
+                                        binary_graphics_data = (DxfBinaryGraphicsData *) hatch->binary_graphics_data;
+                                }
+                                else
+                                {
+                                        binary_graphics_data->next = (struct DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+                                        binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
+                                }
+                                if (binary_graphics_data == NULL)
+                                {
+                                        return (NULL);
+                                }
+                                dxf_string_assign (&binary_graphics_data->data_line, value);
+                                binary_graphics_data->length = strlen (value);
+                                break;
+                        case 330:
+                                /* Now follows a string containing
+                                 * Soft-pointer ID/handle to owner
+                                 * dictionary. */
+                                dxf_string_assign (&hatch->dictionary_owner_soft, value);
+                                break;
+                        case 360:
+                                /* Now follows a string containing Hard
+                                 * owner ID/handle to owner dictionary. */
+                                dxf_string_assign (&hatch->dictionary_owner_hard, value);
+                                break;
+                        case 421:
+                                if ((gradient_color >= 0)
+                                  && (gradient_color < DXF_MAX_HATCH_GRADIENT_COLORS))
+                                {
+                                        hatch->gradient_true_colors[gradient_color] = atoi (value);
+                                }
+                                break;
+                        case 450:
+                                hatch->gradient_fill = atoi (value);
+                                break;
+                        case 452:
+                                hatch->gradient_one_color = atoi (value);
+                                break;
+                        case 453:
+                                hatch->number_of_gradient_colors = atoi (value);
+                                break;
+                        case 460:
+                                hatch->gradient_angle = strtod (value, NULL);
+                                break;
+                        case 461:
+                                hatch->gradient_shift = strtod (value, NULL);
+                                break;
+                        case 462:
+                                hatch->gradient_tint = strtod (value, NULL);
+                                break;
+                        case 463:
+                                /* A gradient color follows. */
+                                gradient_color++;
+                                break;
+                        case 470:
+                                dxf_string_assign (&hatch->gradient_name, value);
+                                break;
+                        case 100:
+                        case 102:
+                        case 451:
+                                /* Subclass markers, application
+                                 * defined groups and reserved values. */
+                                break;
+                        case 999:
+                                /* Now follows a string containing a
+                                 * comment. */
+                                fprintf (stdout, "DXF comment: %s\n", value);
+                                break;
+                        default:
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
+                                  (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                break;
+                }
+        }
+        if (polyline != NULL)
+        {
+                dxf_hatch_read_trim_vertices (polyline, number_of_vertices);
+        }
+        /* Handle omitted members and/or illegal values. */
+        if ((hatch->linetype == NULL) || (strcmp (hatch->linetype, "") == 0))
+        {
+                dxf_string_assign (&hatch->linetype, DXF_DEFAULT_LINETYPE);
+        }
+        if ((hatch->layer == NULL) || (strcmp (hatch->layer, "") == 0))
+        {
+                dxf_string_assign (&hatch->layer, DXF_DEFAULT_LAYER);
+        }
+        DXF_TRACING_ENTITY_END (HATCH, fp, trace_offset);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (hatch);
+}
+
+
 /*!
  * \brief Write DXF output to a file for a hatch entity (\c HATCH).
  */
@@ -167,7 +1045,7 @@ dxf_hatch_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("HATCH");
+        char *dxf_entity_name = dxf_strdup ("HATCH");
         DxfBinaryGraphicsData *data = NULL;
         DxfHatchPatternDefLine *line = NULL;
         DxfHatchPatternSeedPoint *point = NULL;
@@ -175,50 +1053,50 @@ dxf_hatch_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (hatch->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning: empty layer string for the %s entity with id-code: %x\n")),
                         dxf_entity_name, hatch->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("    %s entity is relocated to layer 0")),
                         dxf_entity_name);
-                hatch->layer = strdup (DXF_DEFAULT_LAYER);
+                hatch->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (strcmp (hatch->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning: empty linetype string for the %s entity with id-code: %x\n")),
                         dxf_entity_name, hatch->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("    %s entity is reset to default linetype")),
                         dxf_entity_name);
-                hatch->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                hatch->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -267,11 +1145,11 @@ dxf_hatch_write
           && DXF_FLATLAND
           && (hatch->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", hatch->elevation);
+                dxf_write_real (fp, 38, hatch->elevation);
         }
         if (hatch->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", hatch->thickness);
+                dxf_write_real (fp, 39, hatch->thickness);
         }
         if (hatch->color != DXF_COLOR_BYLAYER)
         {
@@ -279,7 +1157,7 @@ dxf_hatch_write
         }
         if (hatch->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", hatch->linetype_scale);
+                dxf_write_real (fp, 48, hatch->linetype_scale);
         }
         if (hatch->visibility != 0)
         {
@@ -296,12 +1174,12 @@ dxf_hatch_write
                 data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (data);
         }
         fprintf (fp->fp, "100\nAcDbHatch\n");
-        fprintf (fp->fp, " 10\n%f\n", hatch->x0);
-        fprintf (fp->fp, " 20\n%f\n", hatch->y0);
-        fprintf (fp->fp, " 30\n%f\n", hatch->z0);
-        fprintf (fp->fp, "210\n%f\n", hatch->extr_x0);
-        fprintf (fp->fp, "220\n%f\n", hatch->extr_y0);
-        fprintf (fp->fp, "230\n%f\n", hatch->extr_z0);
+        dxf_write_real (fp, 10, hatch->x0);
+        dxf_write_real (fp, 20, hatch->y0);
+        dxf_write_real (fp, 30, hatch->z0);
+        dxf_write_real (fp, 210, hatch->extr_x0);
+        dxf_write_real (fp, 220, hatch->extr_y0);
+        dxf_write_real (fp, 230, hatch->extr_z0);
         fprintf (fp->fp, "  2\n%s\n", hatch->pattern_name);
         fprintf (fp->fp, " 70\n%d\n", hatch->solid_fill);
         fprintf (fp->fp, " 71\n%d\n", hatch->associative);
@@ -311,8 +1189,8 @@ dxf_hatch_write
         fprintf (fp->fp, " 76\n%d\n", hatch->hatch_pattern_type);
         if (!hatch->solid_fill)
         {
-                fprintf (fp->fp, " 52\n%f\n", hatch->pattern_angle);
-                fprintf (fp->fp, " 41\n%f\n", hatch->pattern_scale);
+                dxf_write_real (fp, 52, hatch->pattern_angle);
+                dxf_write_real (fp, 41, hatch->pattern_scale);
                 fprintf (fp->fp, " 77\n%d\n", hatch->pattern_double);
         }
         fprintf (fp->fp, " 78\n%d\n", hatch->number_of_pattern_def_lines);
@@ -322,7 +1200,7 @@ dxf_hatch_write
                 dxf_hatch_pattern_def_line_write (fp, (DxfHatchPatternDefLine *) line);
                 line = (DxfHatchPatternDefLine *) line->next;
         }
-        fprintf (fp->fp, " 47\n%f\n", hatch->pixel_size);
+        dxf_write_real (fp, 47, hatch->pixel_size);
         fprintf (fp->fp, " 98\n%d\n", hatch->number_of_seed_points);
         point = (DxfHatchPatternSeedPoint *) hatch->seed_points;
         while (point != NULL)
@@ -331,9 +1209,7 @@ dxf_hatch_write
                 point = (DxfHatchPatternSeedPoint *) point->next;
         }
         /* Clean up. */
-        dxf_hatch_pattern_def_line_free (line);
-        dxf_hatch_pattern_seedpoint_free (point);
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -362,29 +1238,45 @@ dxf_hatch_free
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatch was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (hatch->pattern_name);
-        free (hatch->linetype);
-        free (hatch->layer);
-        free (hatch->def_lines);
-        free (hatch->paths);
-        free (hatch->seed_points);
-        dxf_binary_graphics_data_free_chain ((DxfBinaryGraphicsData *) hatch->binary_graphics_data);
-        dxf_hatch_pattern_free_chain ((DxfHatchPattern *) hatch->patterns);
-        free (hatch->dictionary_owner_soft);
-        free (hatch->dictionary_owner_hard);
-        free (hatch);
+        dxf_free (hatch->pattern_name);
+        dxf_free (hatch->linetype);
+        dxf_free (hatch->layer);
+        if (hatch->def_lines != NULL)
+        {
+                dxf_hatch_pattern_def_line_free_chain ((DxfHatchPatternDefLine *) hatch->def_lines);
+        }
+        if (hatch->paths != NULL)
+        {
+                dxf_hatch_boundary_path_free_chain ((DxfHatchBoundaryPath *) hatch->paths);
+        }
+        if (hatch->seed_points != NULL)
+        {
+                dxf_hatch_pattern_seedpoint_free_chain ((DxfHatchPatternSeedPoint *) hatch->seed_points);
+        }
+        if (hatch->binary_graphics_data != NULL)
+        {
+                dxf_binary_graphics_data_free_chain ((DxfBinaryGraphicsData *) hatch->binary_graphics_data);
+        }
+        if (hatch->patterns != NULL)
+        {
+                dxf_hatch_pattern_free_chain ((DxfHatchPattern *) hatch->patterns);
+        }
+        dxf_free (hatch->dictionary_owner_soft);
+        dxf_free (hatch->dictionary_owner_hard);
+        dxf_free (hatch->gradient_name);
+        dxf_free (hatch);
         hatch = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -404,19 +1296,20 @@ dxf_hatch_free_chain
                 /*!< pointer to the chain of DXF \c HATCH entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatches == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatches != NULL)
         {
                 struct DxfHatch *iter = hatches->next;
+                hatches->next = NULL;
                 dxf_hatch_free (hatches);
                 hatches = (DxfHatch *) iter;
         }
@@ -446,14 +1339,14 @@ dxf_hatch_get_id_code
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -486,14 +1379,14 @@ dxf_hatch_set_id_code
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -526,19 +1419,19 @@ dxf_hatch_get_linetype
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (hatch->linetype);
+        result = dxf_strdup (hatch->linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -564,19 +1457,19 @@ dxf_hatch_set_linetype
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->linetype = strdup (linetype);
+        hatch->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -604,19 +1497,19 @@ dxf_hatch_get_layer
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (hatch->layer);
+        result = dxf_strdup (hatch->layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -642,19 +1535,19 @@ dxf_hatch_set_layer
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->layer = strdup (layer);
+        hatch->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -682,7 +1575,7 @@ dxf_hatch_get_elevation
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -713,7 +1606,7 @@ dxf_hatch_set_elevation
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -746,14 +1639,14 @@ dxf_hatch_get_thickness
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
         }
@@ -783,14 +1676,14 @@ dxf_hatch_set_thickness
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
         }
@@ -822,14 +1715,14 @@ dxf_hatch_get_linetype_scale
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -860,14 +1753,14 @@ dxf_hatch_set_linetype_scale
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative linetype scale value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -900,21 +1793,21 @@ dxf_hatch_get_visibility
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -945,21 +1838,21 @@ dxf_hatch_set_visibility
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -992,14 +1885,14 @@ dxf_hatch_get_color
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1029,17 +1922,17 @@ dxf_hatch_set_color
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         hatch->color = color;
@@ -1070,20 +1963,20 @@ dxf_hatch_get_paperspace
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (hatch->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1113,21 +2006,21 @@ dxf_hatch_set_paperspace
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1160,20 +2053,20 @@ dxf_hatch_get_graphics_data_size
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
         if (hatch->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
@@ -1204,21 +2097,21 @@ dxf_hatch_set_graphics_data_size
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1254,14 +2147,14 @@ dxf_hatch_get_binary_graphics_data
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1294,14 +2187,14 @@ dxf_hatch_set_binary_graphics_data
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1337,19 +2230,19 @@ dxf_hatch_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (hatch->dictionary_owner_soft);
+        result = dxf_strdup (hatch->dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1377,19 +2270,19 @@ dxf_hatch_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        hatch->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1420,19 +2313,19 @@ dxf_hatch_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (hatch->dictionary_owner_hard);
+        result = dxf_strdup (hatch->dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1460,19 +2353,19 @@ dxf_hatch_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        hatch->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1500,19 +2393,19 @@ dxf_hatch_get_pattern_name
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch->pattern_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the pattern_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (hatch->pattern_name);
+        result = dxf_strdup (hatch->pattern_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1538,19 +2431,19 @@ dxf_hatch_set_pattern_name
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (pattern_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        hatch->pattern_name = strdup (pattern_name);
+        hatch->pattern_name = dxf_strdup (pattern_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1578,7 +2471,7 @@ dxf_hatch_get_x0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1609,7 +2502,7 @@ dxf_hatch_set_x0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1642,7 +2535,7 @@ dxf_hatch_get_y0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1673,7 +2566,7 @@ dxf_hatch_set_y0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1706,7 +2599,7 @@ dxf_hatch_get_z0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1737,7 +2630,7 @@ dxf_hatch_set_z0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1770,7 +2663,7 @@ dxf_hatch_get_pattern_scale
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1801,7 +2694,7 @@ dxf_hatch_set_pattern_scale
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1834,7 +2727,7 @@ dxf_hatch_get_pixel_size
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1865,7 +2758,7 @@ dxf_hatch_set_pixel_size
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1898,7 +2791,7 @@ dxf_hatch_get_pattern_angle
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1929,7 +2822,7 @@ dxf_hatch_set_pattern_angle
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1962,21 +2855,21 @@ dxf_hatch_get_solid_fill
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->solid_fill < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the solid_fill member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->solid_fill > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the solid_fill member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2007,21 +2900,21 @@ dxf_hatch_set_solid_fill
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid_fill < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative solid_fill value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (solid_fill > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range solid_fill value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2054,21 +2947,21 @@ dxf_hatch_get_associative
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->associative < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the associative member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->associative > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the associative member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2099,21 +2992,21 @@ dxf_hatch_set_associative
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (associative < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative associative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (associative > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range associative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2146,21 +3039,21 @@ dxf_hatch_get_hatch_style
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->hatch_style < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the hatch_style member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->hatch_style > 2)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the hatch_style member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2191,21 +3084,21 @@ dxf_hatch_set_hatch_style
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch_style < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative hatch_style value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch_style > 2)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range hatch_style value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2238,21 +3131,21 @@ dxf_hatch_get_hatch_pattern_type
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->hatch_pattern_type < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the hatch_pattern_type member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->hatch_pattern_type > 2)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the hatch_pattern_type member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2283,21 +3176,21 @@ dxf_hatch_set_hatch_pattern_type
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch_pattern_type < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative hatch_pattern_type value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch_pattern_type > 2)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range hatch_pattern_type value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2330,21 +3223,21 @@ dxf_hatch_get_pattern_double
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->pattern_double < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the pattern_double member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (hatch->pattern_double > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the pattern_double member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2375,21 +3268,21 @@ dxf_hatch_set_pattern_double
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (pattern_double < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative pattern_double value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (pattern_double > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range pattern_double value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2422,7 +3315,7 @@ dxf_hatch_get_extr_x0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2453,7 +3346,7 @@ dxf_hatch_set_extr_x0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2486,7 +3379,7 @@ dxf_hatch_get_extr_y0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2517,7 +3410,7 @@ dxf_hatch_set_extr_y0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2550,7 +3443,7 @@ dxf_hatch_get_extr_z0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2581,7 +3474,7 @@ dxf_hatch_set_extr_z0
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2616,14 +3509,14 @@ dxf_hatch_get_boundary_paths
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch->paths == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the paths member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2654,14 +3547,14 @@ dxf_hatch_set_boundary_paths
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paths == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2696,14 +3589,14 @@ dxf_hatch_get_patterns
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch->patterns == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the patterns member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2734,14 +3627,14 @@ dxf_hatch_set_patterns
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (patterns == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2777,14 +3670,14 @@ dxf_hatch_get_next
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2816,14 +3709,14 @@ dxf_hatch_set_next
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2857,14 +3750,14 @@ dxf_hatch_get_last
         /* Do some basic checks. */
         if (hatch == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (hatch->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatch *) hatch);
@@ -2901,9 +3794,9 @@ dxf_hatch_pattern_new ()
         size = sizeof (DxfHatchPattern);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((pattern = malloc (size)) == NULL)
+        if ((pattern = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchPatternSeedpoint struct.\n")),
                   __FUNCTION__);
                 pattern = NULL;
@@ -2939,14 +3832,14 @@ dxf_hatch_pattern_init
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 pattern = dxf_hatch_pattern_new ();
         }
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchPattern struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2985,21 +3878,21 @@ dxf_hatch_pattern_free
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (pattern->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchPattern was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (pattern->def_lines);
-        free (pattern->seed_points);
-        free (pattern);
+        dxf_free (pattern->def_lines);
+        dxf_free (pattern->seed_points);
+        dxf_free (pattern);
         pattern = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -3019,19 +3912,20 @@ dxf_hatch_pattern_free_chain
                 /*!< pointer to the chain of DXF \c HATCH patterns. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (patterns == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (patterns != NULL)
         {
                 struct DxfHatchPattern *iter = patterns->next;
+                patterns->next = NULL;
                 dxf_hatch_pattern_free (patterns);
                 patterns = (DxfHatchPattern *) iter;
         }
@@ -3061,14 +3955,14 @@ dxf_hatch_pattern_get_id_code
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (pattern->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3101,14 +3995,14 @@ dxf_hatch_pattern_set_id_code
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3142,14 +4036,14 @@ dxf_hatch_pattern_get_number_of_def_lines
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (pattern->number_of_def_lines < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the number_of_def_lines member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3181,14 +4075,14 @@ dxf_hatch_pattern_set_number_of_def_lines
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (number_of_def_lines < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative number_of_def_lines value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3224,7 +4118,7 @@ dxf_hatch_pattern_get_def_lines
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3256,14 +4150,14 @@ dxf_hatch_pattern_set_def_lines
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (def_lines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3297,14 +4191,14 @@ dxf_hatch_pattern_get_number_of_seed_points
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (pattern->number_of_seed_points < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the number_of_seed_points member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3336,14 +4230,14 @@ dxf_hatch_pattern_set_number_of_seed_points
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (number_of_seed_points < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative number_of_seed_points value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3379,7 +4273,7 @@ dxf_hatch_pattern_get_seed_points
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3411,14 +4305,14 @@ dxf_hatch_pattern_set_seed_points
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (seed_points == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3454,14 +4348,14 @@ dxf_hatch_pattern_get_next
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (pattern->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3494,14 +4388,14 @@ dxf_hatch_pattern_set_next
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3535,14 +4429,14 @@ dxf_hatch_pattern_get_last
         /* Do some basic checks. */
         if (pattern == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (pattern->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchPattern *) pattern);
@@ -3579,9 +4473,9 @@ dxf_hatch_pattern_def_line_dash_new ()
         size = sizeof (DxfHatchPatternDefLineDash);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((dash = malloc (size)) == NULL)
+        if ((dash = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchPatternDefLineDash struct.\n")),
                   __FUNCTION__);
                 dash = NULL;
@@ -3618,7 +4512,7 @@ dxf_hatch_pattern_def_line_dash_init
         /* Do some basic checks. */
         if (dash == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dash = dxf_hatch_pattern_def_line_dash_new ();
@@ -3653,19 +4547,19 @@ dxf_hatch_pattern_def_line_dash_free
         /* Do some basic checks. */
         if (dash == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (dash->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchPatternDefLineDash was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dash);
+        dxf_free (dash);
         dash = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -3686,19 +4580,20 @@ dxf_hatch_pattern_def_line_dash_free_chain
                  * definition line dashes. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (dashes == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (dashes != NULL)
         {
                 struct DxfHatchPatternDefLineDash *iter = dashes->next;
+                dashes->next = NULL;
                 dxf_hatch_pattern_def_line_dash_free (dashes);
                 dashes = (DxfHatchPatternDefLineDash *) iter;
         }
@@ -3729,7 +4624,7 @@ dxf_hatch_pattern_def_line_dash_get_length
         /* Do some basic checks. */
         if (dash == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3760,7 +4655,7 @@ dxf_hatch_pattern_def_line_dash_set_length
         /* Do some basic checks. */
         if (dash == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3796,14 +4691,14 @@ dxf_hatch_pattern_def_line_dash_get_next
         /* Do some basic checks. */
         if (dash == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dash->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3836,14 +4731,14 @@ dxf_hatch_pattern_def_line_dash_set_next
         /* Do some basic checks. */
         if (dash == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3877,14 +4772,14 @@ dxf_hatch_pattern_def_line_dash_get_last
         /* Do some basic checks. */
         if (dash == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dash->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchPatternDefLineDash *) dash);
@@ -3920,9 +4815,9 @@ dxf_hatch_pattern_def_line_new ()
         size = sizeof (DxfHatchPatternDefLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchPatternDefLine struct.\n")),
                   __FUNCTION__);
                 line = NULL;
@@ -3958,14 +4853,14 @@ dxf_hatch_pattern_def_line_init
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_hatch_pattern_def_line_new ();
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchPatternDefLine struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4010,24 +4905,24 @@ dxf_hatch_pattern_def_line_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, " 53\n%f\n", line->angle);
-        fprintf (fp->fp, " 43\n%f\n", line->x0);
-        fprintf (fp->fp, " 44\n%f\n", line->y0);
-        fprintf (fp->fp, " 45\n%f\n", line->x1);
-        fprintf (fp->fp, " 46\n%f\n", line->y1);
+        dxf_write_real (fp, 53, line->angle);
+        dxf_write_real (fp, 43, line->x0);
+        dxf_write_real (fp, 44, line->y0);
+        dxf_write_real (fp, 45, line->x1);
+        dxf_write_real (fp, 46, line->y1);
         fprintf (fp->fp, " 79\n%d\n", line->number_of_dash_items);
         if (line->number_of_dash_items > 0)
         {
@@ -4037,20 +4932,20 @@ dxf_hatch_pattern_def_line_write
                 dash = dxf_hatch_pattern_def_line_get_dashes (line);
                 if (dash == NULL)
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () no pointer to the first dash found.\n")),
                           __FUNCTION__);
 
                 }
                 while (dash != NULL)
                 {
-                        fprintf (fp->fp, " 49\n%f\n", dash->length);
+                        dxf_write_real (fp, 49, dash->length);
                         i++;
                         dash = dxf_hatch_pattern_def_line_dash_get_next (dash);
                 }
                 if (i >= line->number_of_dash_items)
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () more dashes found than expected.\n")),
                           __FUNCTION__);
 
@@ -4058,7 +4953,7 @@ dxf_hatch_pattern_def_line_write
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () no dash length found.\n")),
                   __FUNCTION__);
         }
@@ -4090,19 +4985,23 @@ dxf_hatch_pattern_def_line_free
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchPatternDefLine was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (line);
+        if (line->dashes != NULL)
+        {
+                dxf_hatch_pattern_def_line_dash_free_chain ((DxfHatchPatternDefLineDash *) line->dashes);
+        }
+        dxf_free (line);
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -4123,19 +5022,20 @@ dxf_hatch_pattern_def_line_free_chain
                  * definition lines. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (lines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (lines != NULL)
         {
                 struct DxfHatchPatternDefLine *iter = lines->next;
+                lines->next = NULL;
                 dxf_hatch_pattern_def_line_free (lines);
                 lines = (DxfHatchPatternDefLine *) iter;
         }
@@ -4165,14 +5065,14 @@ dxf_hatch_pattern_def_line_get_id_code
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4205,14 +5105,14 @@ dxf_hatch_pattern_def_line_set_id_code
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4245,7 +5145,7 @@ dxf_hatch_pattern_def_line_get_angle
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4276,7 +5176,7 @@ dxf_hatch_pattern_def_line_set_angle
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4310,7 +5210,7 @@ dxf_hatch_pattern_def_line_get_x0
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4341,7 +5241,7 @@ dxf_hatch_pattern_def_line_set_x0
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4375,7 +5275,7 @@ dxf_hatch_pattern_def_line_get_y0
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4406,7 +5306,7 @@ dxf_hatch_pattern_def_line_set_y0
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4440,7 +5340,7 @@ dxf_hatch_pattern_def_line_get_x1
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4472,7 +5372,7 @@ dxf_hatch_pattern_def_line_set_x1
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4506,7 +5406,7 @@ dxf_hatch_pattern_def_line_get_y1
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4538,7 +5438,7 @@ dxf_hatch_pattern_def_line_set_y1
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4572,14 +5472,14 @@ dxf_hatch_pattern_def_line_get_number_of_dash_items
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->number_of_dash_items < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the dash_items member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -4611,14 +5511,14 @@ dxf_hatch_pattern_def_line_set_number_of_dash_items
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (number_of_dash_items < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative dash_items value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4654,7 +5554,7 @@ dxf_hatch_pattern_def_line_get_dashes
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4686,14 +5586,14 @@ dxf_hatch_pattern_def_line_set_dashes
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dashes == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4729,14 +5629,14 @@ dxf_hatch_pattern_def_line_get_next
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4769,14 +5669,14 @@ dxf_hatch_pattern_def_line_set_next
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4810,14 +5710,14 @@ dxf_hatch_pattern_def_line_get_last
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchPatternDefLine *) line);
@@ -4853,9 +5753,9 @@ dxf_hatch_pattern_seedpoint_new ()
         size = sizeof (DxfHatchPatternSeedPoint);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((seedpoint = malloc (size)) == NULL)
+        if ((seedpoint = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchPatternSeedpoint struct.\n")),
                   __FUNCTION__);
                 seedpoint = NULL;
@@ -4891,14 +5791,14 @@ dxf_hatch_pattern_seedpoint_init
         /* Do some basic checks. */
         if (seedpoint == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 seedpoint = dxf_hatch_pattern_seedpoint_new ();
         }
         if (seedpoint == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchPatternSeedPoint struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -4936,21 +5836,21 @@ dxf_hatch_pattern_seedpoint_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (seedpoint == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, " 10\n%f\n", seedpoint->x0);
-        fprintf (fp->fp, " 20\n%f\n", seedpoint->y0);
+        dxf_write_real (fp, 10, seedpoint->x0);
+        dxf_write_real (fp, 20, seedpoint->y0);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -4979,19 +5879,19 @@ dxf_hatch_pattern_seedpoint_free
         /* Do some basic checks. */
         if (seedpoint == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (seedpoint->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchPatternSeedPoint was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (seedpoint);
+        dxf_free (seedpoint);
         seedpoint = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -5012,19 +5912,20 @@ dxf_hatch_pattern_seedpoint_free_chain
                  * points. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_pattern_seed_points == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_pattern_seed_points != NULL)
         {
                 struct DxfHatchPatternSeedPoint *iter = hatch_pattern_seed_points->next;
+                hatch_pattern_seed_points->next = NULL;
                 dxf_hatch_pattern_seedpoint_free (hatch_pattern_seed_points);
                 hatch_pattern_seed_points = (DxfHatchPatternSeedPoint *) iter;
         }
@@ -5054,14 +5955,14 @@ dxf_hatch_pattern_seedpoint_get_id_code
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5094,14 +5995,14 @@ dxf_hatch_pattern_seedpoint_set_id_code
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5134,7 +6035,7 @@ dxf_hatch_pattern_seedpoint_get_x0
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5165,7 +6066,7 @@ dxf_hatch_pattern_seedpoint_set_x0
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5198,7 +6099,7 @@ dxf_hatch_pattern_seedpoint_get_y0
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5229,7 +6130,7 @@ dxf_hatch_pattern_seedpoint_set_y0
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5265,14 +6166,14 @@ dxf_hatch_pattern_seedpoint_get_next
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5305,14 +6206,14 @@ dxf_hatch_pattern_seedpoint_set_next
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5346,14 +6247,14 @@ dxf_hatch_pattern_seedpoint_get_last
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchPatternSeedPoint *) point);
@@ -5389,9 +6290,9 @@ dxf_hatch_boundary_path_new ()
         size = sizeof (DxfHatchBoundaryPath);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((path = malloc (size)) == NULL)
+        if ((path = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPath struct.\n")),
                   __FUNCTION__);
                 path = NULL;
@@ -5427,21 +6328,22 @@ dxf_hatch_boundary_path_init
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 path = dxf_hatch_boundary_path_new ();
         }
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPath struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         path->id_code = 0;
-        dxf_hatch_boundary_path_edge_init ((DxfHatchBoundaryPathEdge *) path->edges);
-        dxf_hatch_boundary_path_polyline_init ((DxfHatchBoundaryPathPolyline *) path->polylines);
+        path->type_flag = 0;
+        path->edges = NULL;
+        path->polylines = NULL;
         path->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -5450,6 +6352,43 @@ dxf_hatch_boundary_path_init
 }
 
 
+/*!
+ * \brief Count the arcs, ellipses, lines and splines of a hatch boundary
+ * path edge.
+ */
+static int
+dxf_hatch_boundary_path_edge_count
+(
+        DxfHatchBoundaryPathEdge *edge
+                /*!< DXF hatch boundary path edge. */
+)
+{
+        DxfHatchBoundaryPathEdgeArc *arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+        int count = 0;
+
+        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines; line != NULL; line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+        {
+                count++;
+        }
+        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs; arc != NULL; arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+        {
+                count++;
+        }
+        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses; ellipse != NULL; ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+        {
+                count++;
+        }
+        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines; spline != NULL; spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+        {
+                count++;
+        }
+        return (count);
+}
+
+
 /*!
  * \brief Write DXF output to a file for hatch boundary entities.
  *
@@ -5467,66 +6406,66 @@ dxf_hatch_boundary_path_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        DxfHatchBoundaryPathPolyline *iter;
+        DxfHatchBoundaryPathEdge *edge;
+        DxfHatchBoundaryPathPolyline *polyline;
+        int number_of_edges;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        for (;;)
+        for (; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
         {
-                if (path->next == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Information from %s () last boundary path encountered.\n")),
-                          __FUNCTION__);
-                        break;
-                }
-                else
+                /* Test for edge type or polylines type. */
+                if (path->polylines != NULL)
                 {
-                        /* Test for edge type or polylines type. */
-                        if (path->edges != NULL)
+                        fprintf (fp->fp, " 92\n%d\n", path->type_flag | 2);
+                        for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                          polyline != NULL;
+                          polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
                         {
-                                /*! \todo Write edges data. */
+                                dxf_hatch_boundary_path_polyline_write (fp, polyline);
                         }
-                        else if (path->polylines != NULL)
+                }
+                else if (path->edges != NULL)
+                {
+                        fprintf (fp->fp, " 92\n%d\n", path->type_flag & ~2);
+                        number_of_edges = 0;
+                        for (edge = (DxfHatchBoundaryPathEdge *) path->edges;
+                          edge != NULL;
+                          edge = (DxfHatchBoundaryPathEdge *) edge->next)
                         {
-                                iter = dxf_hatch_boundary_path_polyline_new ();
-                                iter = (DxfHatchBoundaryPathPolyline *) path->polylines;
-                                for (;;)
-                                {
-                                        dxf_hatch_boundary_path_polyline_write
-                                        (
-                                                fp,
-                                                iter
-                                        );
-                                        iter = (DxfHatchBoundaryPathPolyline *) iter->next;
-                                        if (iter == NULL)
-                                        {
-                                                break;
-                                        }
-                                }
+                                number_of_edges += dxf_hatch_boundary_path_edge_count (edge);
                         }
-                        else
+                        fprintf (fp->fp, " 93\n%d\n", number_of_edges);
+                        for (edge = (DxfHatchBoundaryPathEdge *) path->edges;
+                          edge != NULL;
+                          edge = (DxfHatchBoundaryPathEdge *) edge->next)
                         {
-                                fprintf (stderr,
-                                  (_("Error in %s () unknown boundary path type encountered.\n")),
-                                  __FUNCTION__);
-                                return (EXIT_FAILURE);
+                                dxf_hatch_boundary_path_edge_write (fp, edge);
                         }
                 }
+                else
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () unknown boundary path type encountered.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                /* No source boundary objects. */
+                fprintf (fp->fp, " 97\n0\n");
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -5556,21 +6495,27 @@ dxf_hatch_boundary_path_free
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (path->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchBoundaryPath was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (path->edges);
-        free (path->polylines);
-        free (path);
+        if (path->edges != NULL)
+        {
+                dxf_hatch_boundary_path_edge_free_chain ((DxfHatchBoundaryPathEdge *) path->edges);
+        }
+        if (path->polylines != NULL)
+        {
+                dxf_hatch_boundary_path_polyline_free_chain ((DxfHatchBoundaryPathPolyline *) path->polylines);
+        }
+        dxf_free (path);
         path = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -5590,19 +6535,20 @@ dxf_hatch_boundary_path_free_chain
                 /*!< pointer to the chain of DXF \c HATCH boundary paths. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_paths == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_paths != NULL)
         {
                 struct DxfHatchBoundaryPath *iter = hatch_boundary_paths->next;
+                hatch_boundary_paths->next = NULL;
                 dxf_hatch_boundary_path_free (hatch_boundary_paths);
                 hatch_boundary_paths = (DxfHatchBoundaryPath *) iter;
         }
@@ -5632,14 +6578,14 @@ dxf_hatch_boundary_path_get_id_code
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (path->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -5672,14 +6618,14 @@ dxf_hatch_boundary_path_set_id_code
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5714,7 +6660,7 @@ dxf_hatch_boundary_path_get_edges
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5745,14 +6691,14 @@ dxf_hatch_boundary_path_set_edges
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (edges == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5787,7 +6733,7 @@ dxf_hatch_boundary_path_get_polylines
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5818,14 +6764,14 @@ dxf_hatch_boundary_path_set_polylines
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polylines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5861,14 +6807,14 @@ dxf_hatch_boundary_path_get_next
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (path->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5901,14 +6847,14 @@ dxf_hatch_boundary_path_set_next
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -5942,14 +6888,14 @@ dxf_hatch_boundary_path_get_last
         /* Do some basic checks. */
         if (path == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (path->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchBoundaryPath *) path);
@@ -5985,9 +6931,9 @@ dxf_hatch_boundary_path_polyline_new ()
         size = sizeof (DxfHatchBoundaryPathPolyline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((polyline = malloc (size)) == NULL)
+        if ((polyline = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathPolyline struct.\n")),
                   __FUNCTION__);
                 polyline = NULL;
@@ -6023,14 +6969,14 @@ dxf_hatch_boundary_path_polyline_init
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 polyline = dxf_hatch_boundary_path_polyline_new ();
         }
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathPolyline struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6039,6 +6985,7 @@ dxf_hatch_boundary_path_polyline_init
         polyline->is_closed = 0;
         polyline->number_of_vertices = 0;
         polyline->vertices = NULL;
+        polyline->number_of_allocated_vertices = 0;
         polyline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -6066,48 +7013,47 @@ dxf_hatch_boundary_path_polyline_write
         DXF_DEBUG_BEGIN
 #endif
         DxfHatchBoundaryPathPolylineVertex *iter;
+        int has_bulge;
+        int number_of_vertices;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        fprintf (fp->fp, " 73\n%d\n", polyline->is_closed);
-        fprintf (fp->fp, " 93\n%d\n", polyline->number_of_vertices);
-        /* draw hatch boundary vertices. */
-        iter = dxf_hatch_boundary_path_polyline_vertex_new ();
-        iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
-        for (;;)
-        {
-                dxf_hatch_boundary_path_polyline_vertex_write
-                (
-                        fp,
-                        iter
-                );
-                iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-                if (iter == NULL)
+        /* The bulge flag is set when any vertex has a bulge. */
+        has_bulge = 0;
+        number_of_vertices = 0;
+        for (iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+          iter != NULL;
+          iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next)
+        {
+                if (iter->has_bulge)
                 {
-                        break;
+                        has_bulge = 1;
                 }
+                number_of_vertices++;
         }
-        /* test for closed polyline: close with first vertex. */
-        if (polyline->is_closed)
+        fprintf (fp->fp, " 72\n%d\n", has_bulge);
+        fprintf (fp->fp, " 73\n%d\n", polyline->is_closed);
+        fprintf (fp->fp, " 93\n%d\n", number_of_vertices);
+        /* Draw hatch boundary vertices, a closed polyline is closed by
+         * the is_closed flag, its first vertex is not repeated. */
+        for (iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+          iter != NULL;
+          iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next)
         {
-                dxf_hatch_boundary_path_polyline_vertex_write
-                (
-                        fp,
-                        (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices
-                );
+                dxf_hatch_boundary_path_polyline_vertex_write (fp, iter);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -6134,23 +7080,47 @@ dxf_hatch_boundary_path_polyline_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfHatchBoundaryPathPolylineVertex *vertices;
+        DxfHatchBoundaryPathPolylineVertex *iter;
+        DxfHatchBoundaryPathPolylineVertex *next;
+
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchBoundaryPathPolyline was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (polyline->vertices);
-        free (polyline);
+        if (polyline->number_of_allocated_vertices > 0)
+        {
+                /* Free the vertices linked after the array, then the
+                 * array. */
+                vertices = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                for (iter = vertices; iter != NULL; iter = next)
+                {
+                        next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
+                        if ((iter < vertices)
+                          || (iter >= vertices + polyline->number_of_allocated_vertices))
+                        {
+                                iter->next = NULL;
+                                dxf_hatch_boundary_path_polyline_vertex_free (iter);
+                        }
+                }
+                dxf_free (vertices);
+        }
+        else if (polyline->vertices != NULL)
+        {
+                dxf_hatch_boundary_path_polyline_vertex_free_chain ((DxfHatchBoundaryPathPolylineVertex *) polyline->vertices);
+        }
+        dxf_free (polyline);
         polyline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -6171,19 +7141,20 @@ dxf_hatch_boundary_path_polyline_free_chain
                  * polylines. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polylines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (polylines != NULL)
         {
                 struct DxfHatchBoundaryPathPolyline *iter = polylines->next;
+                polylines->next = NULL;
                 dxf_hatch_boundary_path_polyline_free (polylines);
                 polylines = (DxfHatchBoundaryPathPolyline *) iter;
         }
@@ -6193,6 +7164,87 @@ dxf_hatch_boundary_path_polyline_free_chain
 }
 
 
+
+/*!
+ * \brief Allocate the vertices of a DXF \c HATCH boundary path polyline
+ * as one array.
+ *
+ * The array is grown to hold \c number_of_vertices vertices, the new
+ * vertices are zeroed and all vertices in the array are linked by their
+ * \c next pointers.\n
+ * Vertices linked after the array are not kept when the array is grown,
+ * so link them only after the last call.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_polyline_allocate_vertices
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< DXF hatch boundary path polyline entity. */
+        int number_of_vertices
+                /*!< number of vertices. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathPolylineVertex *vertices;
+        int i;
+
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_of_vertices < 1)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a number of vertices smaller than 1 was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((polyline->vertices != NULL)
+          && (polyline->number_of_allocated_vertices == 0))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the vertices were allocated one by one.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_of_vertices <= polyline->number_of_allocated_vertices)
+        {
+                return (EXIT_SUCCESS);
+        }
+        vertices = dxf_realloc (polyline->vertices,
+          number_of_vertices * sizeof (DxfHatchBoundaryPathPolylineVertex));
+        if (vertices == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for %d vertices.\n")),
+                  __FUNCTION__, number_of_vertices);
+                return (EXIT_FAILURE);
+        }
+        memset (vertices + polyline->number_of_allocated_vertices, 0,
+          (number_of_vertices - polyline->number_of_allocated_vertices)
+          * sizeof (DxfHatchBoundaryPathPolylineVertex));
+        for (i = 0; i < number_of_vertices - 1; i++)
+        {
+                vertices[i].next = (struct DxfHatchBoundaryPathPolylineVertex *) &vertices[i + 1];
+        }
+        vertices[number_of_vertices - 1].next = NULL;
+        polyline->vertices = (struct DxfHatchBoundaryPathPolylineVertex *) vertices;
+        polyline->number_of_allocated_vertices = number_of_vertices;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
 /*!
  * \brief Get the ID code from a DXF \c HATCH boundary path polyline.
  *
@@ -6213,14 +7265,14 @@ dxf_hatch_boundary_path_polyline_get_id_code
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -6253,14 +7305,14 @@ dxf_hatch_boundary_path_polyline_set_id_code
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6294,21 +7346,21 @@ dxf_hatch_boundary_path_polyline_get_is_closed
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->is_closed < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the is_closed member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->is_closed > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the is_closed member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -6340,21 +7392,21 @@ dxf_hatch_boundary_path_polyline_set_is_closed
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (is_closed < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (is_closed > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6388,14 +7440,14 @@ dxf_hatch_boundary_path_polyline_get_number_of_vertices
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->number_of_vertices < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the is_closed member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -6427,14 +7479,14 @@ dxf_hatch_boundary_path_polyline_set_number_of_vertices
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (number_of_vertices < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6470,7 +7522,7 @@ dxf_hatch_boundary_path_polyline_get_vertices
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6501,14 +7553,14 @@ dxf_hatch_boundary_path_polyline_set_vertices
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (vertices == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6541,7 +7593,7 @@ dxf_hatch_boundary_path_polyline_close_polyline
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () invalid pointer to polyline (NULL).\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -6628,30 +7680,84 @@ dxf_hatch_boundary_path_polyline_close_polyline
 
 
 /*!
- * \brief Compute if the coordinates of a point \c p lie inside or
- * outside a DXF hatch boundary path polyline \c polyline entity.
+ * \brief Compute the winding number contribution of a boundary path
+ * polyline segment about a point.
  *
- * \author Paul Bourke <http://www.paulbourke.net/geometry/insidepoly/>\n
- * Adapted for libDXF by Bert Timmerman <bert.timmerman@xs4all.nl>
+ * The chord of the segment adds +1 when it crosses the ray from the
+ * point in the positive X-direction upwards, and -1 when it crosses
+ * downwards, with the start of the chord included and the end
+ * excluded.\n
+ * A bulged segment adds the sign of its bulge when the point lies
+ * between the chord and the arc.
  *
- * A solution by Philippe Reverdy is to compute the sum of the angles
- * made between the test point and each pair of points making up the
- * polygon.\n
- * If this sum is (\f$ 2\pi \f$) then the point is an interior point,
- * if 0 then the point is an exterior point.\n
- * This also works for polygons with holes given the polygon is defined
- * with a path made up of coincident edges into and out of the hole as
- * is common practice in many CAD packages.\n
+ * \return the winding number contribution, -2 .. 2.
+ */
+static int
+dxf_hatch_boundary_path_polyline_segment_winding
+(
+        DxfHatchBoundaryPathPolylineVertex *vertex_0,
+                /*!< start vertex of the segment, with the bulge. */
+        DxfHatchBoundaryPathPolylineVertex *vertex_1,
+                /*!< end vertex of the segment. */
+        double x,
+                /*!< X-value of the point. */
+        double y
+                /*!< Y-value of the point. */
+)
+{
+        double dx = vertex_1->x0 - vertex_0->x0;
+        double dy = vertex_1->y0 - vertex_0->y0;
+        double side;
+        double distance;
+        double xc;
+        double yc;
+        double bulge = vertex_0->bulge;
+        int winding = 0;
+
+        /* side > 0 when the point is left of the chord. */
+        side = dx * (y - vertex_0->y0) - dy * (x - vertex_0->x0);
+        if ((vertex_0->y0 <= y) && (y < vertex_1->y0) && (side > 0.0))
+        {
+                winding++;
+        }
+        else if ((vertex_1->y0 <= y) && (y < vertex_0->y0) && (side < 0.0))
+        {
+                winding--;
+        }
+        if ((bulge == 0.0) || ((dx == 0.0) && (dy == 0.0)))
+        {
+                return (winding);
+        }
+        /* A positive bulge is a counter clockwise arc, right of the
+         * chord. */
+        if ((bulge > 0.0) ? (side >= 0.0) : (side <= 0.0))
+        {
+                return (winding);
+        }
+        /* The center is (1 - bulge^2) / (4 bulge) chord lengths left of
+         * the middle of the chord. */
+        distance = (1.0 - bulge * bulge) / (4.0 * bulge);
+        xc = 0.5 * (vertex_0->x0 + vertex_1->x0) - dy * distance;
+        yc = 0.5 * (vertex_0->y0 + vertex_1->y0) + dx * distance;
+        if ((x - xc) * (x - xc) + (y - yc) * (y - yc)
+          < (vertex_0->x0 - xc) * (vertex_0->x0 - xc) + (vertex_0->y0 - yc) * (vertex_0->y0 - yc))
+        {
+                winding += (bulge > 0.0) ? 1 : -1;
+        }
+        return (winding);
+}
+
+
+/*!
+ * \brief Compute if the coordinates of a point \c p lie inside or
+ * outside a DXF hatch boundary path polyline \c polyline entity.
  *
- * \note For most of the "point-in-polygon" algorithms there is a
- * pathological case if the point being queries lies exactly on a
- * vertex.\n
- * The easiest way to cope with this is to test that as a separate
- * process and make your own decision as to whether you want to consider
- * them inside or outside.
+ * The winding number of the polyline about the point is summed over its
+ * segments, including bulged segments, and the segment from the last
+ * vertex back to the first vertex.\n
+ * No memory is allocated.
  *
- * \note It is assumed that the polygon is simple (does not intersect
- * itself).
+ * \note A point on the boundary may be reported either way.
  *
  * \return \c INSIDE if an interior point, \c OUTSIDE if an exterior
  * point, or \c EXIT_FAILURE if an error occurred.
@@ -6668,67 +7774,46 @@ dxf_hatch_boundary_path_polyline_point_inside_polyline
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfHatchBoundaryPathPolylineVertex *iter;
+        DxfHatchBoundaryPathPolylineVertex *next;
+        int winding = 0;
+
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () invalid pointer to polyline (NULL).\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () invalid pointer to point (NULL).\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->is_closed != 1)
+        if (polyline->vertices == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () polyline is not a closed polygon.\n")),
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () polyline has no vertices.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        DxfHatchBoundaryPathPolylineVertex *p0;
-        DxfHatchBoundaryPathPolylineVertex *p1;
-        DxfHatchBoundaryPathPolylineVertex *iter;
-        DxfHatchBoundaryPathPolylineVertex *next;
-        double angle;
-        p0 = dxf_hatch_boundary_path_polyline_vertex_new ();
-        p1 = dxf_hatch_boundary_path_polyline_vertex_new ();
-        iter = dxf_hatch_boundary_path_polyline_vertex_new ();
-        next = dxf_hatch_boundary_path_polyline_vertex_new ();
-        iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
-        next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-        angle = 0;
-        for (;;)
-        {
-                if (next == NULL)
-                {
-                        /* iter is the last vertex, no use to continue. */
-                        break;
-                }
+        for (iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+          iter != NULL;
+          iter = next)
+        {
                 next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-                p0->x0 = iter->x0 - point->x0;
-                p0->y0 = iter->y0 - point->y0;
-                p1->x0 = next->x0 - point->x0;
-                p1->y0 = next->y0 - point->y0;
-                angle += dxf_hatch_boundary_path_polyline_vertex_angle (iter, next);
-                iter = next;
+                winding += dxf_hatch_boundary_path_polyline_segment_winding
+                  (iter,
+                  (next != NULL) ? next : (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices,
+                  point->x0, point->y0);
         }
-        /* clean up. */
-        dxf_hatch_boundary_path_polyline_vertex_free (p0);
-        dxf_hatch_boundary_path_polyline_vertex_free (p1);
-        if (abs (angle) < M_PI)
-                return (OUTSIDE);
-        else
-                return (INSIDE);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        /*! \todo This is a dead code path. */
-        return (EXIT_FAILURE);
+        return ((winding != 0) ? INSIDE : OUTSIDE);
 }
 
 
@@ -6755,14 +7840,14 @@ dxf_hatch_boundary_path_polyline_get_next
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6795,14 +7880,14 @@ dxf_hatch_boundary_path_polyline_set_next
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6836,14 +7921,14 @@ dxf_hatch_boundary_path_polyline_get_last
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchBoundaryPathPolyline *) polyline);
@@ -6878,11 +7963,9 @@ dxf_hatch_boundary_path_polyline_vertex_new ()
         size_t size;
 
         size = sizeof (DxfHatchBoundaryPathPolylineVertex);
-        /* avoid malloc of 0 bytes */
-        if (size == 0) size = 1;
-        if ((vertex = malloc (size)) == NULL)
+        if ((vertex = dxf_pool_alloc (DXF_POOL_HATCH_BOUNDARY_PATH_POLYLINE_VERTEX)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathPolylineVertex struct.\n")),
                   __FUNCTION__);
                 vertex = NULL;
@@ -6918,14 +8001,14 @@ dxf_hatch_boundary_path_polyline_vertex_init
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vertex = dxf_hatch_boundary_path_polyline_vertex_new ();
         }
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathPolylineVertex struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -6946,6 +8029,9 @@ dxf_hatch_boundary_path_polyline_vertex_init
 /*!
  * \brief Write DXF output to a file for a hatch boundary polyline
  * vertex.
+ *
+ * The bulge flag (group code 72) is written once for the polyline by
+ * \c dxf_hatch_boundary_path_polyline_write ().
  */
 int
 dxf_hatch_boundary_path_polyline_vertex_write
@@ -6962,24 +8048,23 @@ dxf_hatch_boundary_path_polyline_vertex_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        fprintf (fp->fp, " 10\n%f\n", vertex->x0);
-        fprintf (fp->fp, " 20\n%f\n", vertex->y0);
-        fprintf (fp->fp, " 72\n%d\n", vertex->has_bulge);
+        dxf_write_real (fp, 10, vertex->x0);
+        dxf_write_real (fp, 20, vertex->y0);
         if (vertex->has_bulge)
         {
-                fprintf (fp->fp, " 42\n%f\n", vertex->bulge);
+                dxf_write_real (fp, 42, vertex->bulge);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -7009,19 +8094,19 @@ dxf_hatch_boundary_path_polyline_vertex_free
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (vertex->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchBoundaryPathPolylineVertex was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (vertex);
+        dxf_pool_release (DXF_POOL_HATCH_BOUNDARY_PATH_POLYLINE_VERTEX, vertex);
         vertex = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -7042,19 +8127,20 @@ dxf_hatch_boundary_path_polyline_vertex_free_chain
                  * polyline vertices. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_polyline_vertices == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_polyline_vertices != NULL)
         {
                 struct DxfHatchBoundaryPathPolylineVertex *iter = hatch_boundary_path_polyline_vertices->next;
+                hatch_boundary_path_polyline_vertices->next = NULL;
                 dxf_hatch_boundary_path_polyline_vertex_free (hatch_boundary_path_polyline_vertices);
                 hatch_boundary_path_polyline_vertices = (DxfHatchBoundaryPathPolylineVertex *) iter;
         }
@@ -7086,14 +8172,14 @@ dxf_hatch_boundary_path_polyline_vertex_get_id_code
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (vertex->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -7128,14 +8214,14 @@ dxf_hatch_boundary_path_polyline_vertex_set_id_code
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7170,7 +8256,7 @@ dxf_hatch_boundary_path_polyline_vertex_get_x0
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -7204,7 +8290,7 @@ dxf_hatch_boundary_path_polyline_vertex_set_x0
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7239,7 +8325,7 @@ dxf_hatch_boundary_path_polyline_vertex_get_y0
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -7273,7 +8359,7 @@ dxf_hatch_boundary_path_polyline_vertex_set_y0
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7308,7 +8394,7 @@ dxf_hatch_boundary_path_polyline_vertex_get_bulge
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -7341,7 +8427,7 @@ dxf_hatch_boundary_path_polyline_vertex_set_bulge
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7376,21 +8462,21 @@ dxf_hatch_boundary_path_polyline_vertex_get_has_bulge
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (vertex->has_bulge < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the has_bulge member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (vertex->has_bulge > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the has_bulge member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -7423,21 +8509,21 @@ dxf_hatch_boundary_path_polyline_vertex_set_has_bulge
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (has_bulge < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative has_bulge flag value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (has_bulge > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range has_bulge flag value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7482,14 +8568,14 @@ dxf_hatch_boundary_path_polyline_vertex_angle
         /* Do some basic checks. */
         if (vertex_0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (vertex_1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -7497,7 +8583,7 @@ dxf_hatch_boundary_path_polyline_vertex_angle
         if ((vertex_0->x0 == vertex_1->x0)
           && (vertex_0->y0 == vertex_1->y0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () identical coordinates were passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -7544,14 +8630,14 @@ dxf_hatch_boundary_path_polyline_vertex_get_next
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (vertex->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7585,14 +8671,14 @@ dxf_hatch_boundary_path_polyline_vertex_set_next
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7628,14 +8714,14 @@ dxf_hatch_boundary_path_polyline_vertex_get_last
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (vertex->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchBoundaryPathPolylineVertex *) vertex);
@@ -7671,9 +8757,9 @@ dxf_hatch_boundary_path_edge_new ()
         size = sizeof (DxfHatchBoundaryPathEdge);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((edge = malloc (size)) == NULL)
+        if ((edge = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdge struct.\n")),
                   __FUNCTION__);
                 edge = NULL;
@@ -7709,14 +8795,14 @@ dxf_hatch_boundary_path_edge_init
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 edge = dxf_hatch_boundary_path_edge_new ();
         }
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdge struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7734,6 +8820,111 @@ dxf_hatch_boundary_path_edge_init
 }
 
 
+/*!
+ * \brief Write DXF output to a file for a hatch boundary path edge.
+ *
+ * The edge read by \c dxf_hatch_read () holds one arc, ellipse, line
+ * or spline, an edge holding more is written as its lines, arcs,
+ * ellipses and splines in that order.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_boundary_path_edge_write
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfHatchBoundaryPathEdge *edge
+                /*!< DXF hatch boundary path edge. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathEdgeArc *arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+        DxfHatchBoundaryPathEdgeSplineCp *control_point;
+        int i;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (edge == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines; line != NULL; line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+        {
+                fprintf (fp->fp, " 72\n1\n");
+                dxf_write_real (fp, 10, line->x0);
+                dxf_write_real (fp, 20, line->y0);
+                dxf_write_real (fp, 11, line->x1);
+                dxf_write_real (fp, 21, line->y1);
+        }
+        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs; arc != NULL; arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+        {
+                fprintf (fp->fp, " 72\n2\n");
+                dxf_write_real (fp, 10, arc->x0);
+                dxf_write_real (fp, 20, arc->y0);
+                dxf_write_real (fp, 40, arc->radius);
+                dxf_write_real (fp, 50, arc->start_angle);
+                dxf_write_real (fp, 51, arc->end_angle);
+                fprintf (fp->fp, " 73\n%d\n", arc->is_ccw);
+        }
+        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses; ellipse != NULL; ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+        {
+                fprintf (fp->fp, " 72\n3\n");
+                dxf_write_real (fp, 10, ellipse->x0);
+                dxf_write_real (fp, 20, ellipse->y0);
+                dxf_write_real (fp, 11, ellipse->x1);
+                dxf_write_real (fp, 21, ellipse->y1);
+                dxf_write_real (fp, 40, ellipse->ratio);
+                dxf_write_real (fp, 50, ellipse->start_angle);
+                dxf_write_real (fp, 51, ellipse->end_angle);
+                fprintf (fp->fp, " 73\n%d\n", ellipse->is_ccw);
+        }
+        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines; spline != NULL; spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+        {
+                fprintf (fp->fp, " 72\n4\n");
+                fprintf (fp->fp, " 94\n%d\n", spline->degree);
+                fprintf (fp->fp, " 73\n%d\n", spline->rational);
+                fprintf (fp->fp, " 74\n%d\n", spline->periodic);
+                fprintf (fp->fp, " 95\n%d\n", spline->number_of_knots);
+                fprintf (fp->fp, " 96\n%d\n", spline->number_of_control_points);
+                for (i = 0; i < spline->number_of_knots; i++)
+                {
+                        dxf_write_real (fp, 40, spline->knots[i]);
+                }
+                for (control_point = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points, i = 0;
+                  (control_point != NULL) && (i < spline->number_of_control_points);
+                  control_point = (DxfHatchBoundaryPathEdgeSplineCp *) control_point->next, i++)
+                {
+                        dxf_write_real (fp, 10, control_point->x0);
+                        dxf_write_real (fp, 20, control_point->y0);
+                        if (spline->rational)
+                        {
+                                dxf_write_real (fp, 42, control_point->weight);
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Free the allocated memory for a DXF \c HATCH boundary path
  * edge and all it's data fields.
@@ -7755,23 +8946,35 @@ dxf_hatch_boundary_path_edge_free
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (edge->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchBoundaryPathEdge was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (edge->arcs);
-        free (edge->ellipses);
-        free (edge->lines);
-        free (edge->splines);
-        free (edge);
+        if (edge->arcs != NULL)
+        {
+                dxf_hatch_boundary_path_edge_arc_free_chain ((DxfHatchBoundaryPathEdgeArc *) edge->arcs);
+        }
+        if (edge->ellipses != NULL)
+        {
+                dxf_hatch_boundary_path_edge_ellipse_free_chain ((DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses);
+        }
+        if (edge->lines != NULL)
+        {
+                dxf_hatch_boundary_path_edge_line_free_chain ((DxfHatchBoundaryPathEdgeLine *) edge->lines);
+        }
+        if (edge->splines != NULL)
+        {
+                dxf_hatch_boundary_path_edge_spline_free_chain ((DxfHatchBoundaryPathEdgeSpline *) edge->splines);
+        }
+        dxf_free (edge);
         edge = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -7792,19 +8995,20 @@ dxf_hatch_boundary_path_edge_free_chain
                  * edges. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (edges == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (edges != NULL)
         {
                 struct DxfHatchBoundaryPathEdge *iter = edges->next;
+                edges->next = NULL;
                 dxf_hatch_boundary_path_edge_free (edges);
                 edges = (DxfHatchBoundaryPathEdge *) iter;
         }
@@ -7834,14 +9038,14 @@ dxf_hatch_boundary_path_edge_get_id_code
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (edge->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -7874,14 +9078,14 @@ dxf_hatch_boundary_path_edge_set_id_code
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7915,14 +9119,14 @@ dxf_hatch_boundary_path_edge_get_arcs
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (edge->arcs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7930,7 +9134,7 @@ dxf_hatch_boundary_path_edge_get_arcs
         dxf_hatch_boundary_path_edge_arc_new (result);
         if (result == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () can not allocate memory for a DxfHatchBoundaryPathEdgeArc struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -7963,14 +9167,14 @@ dxf_hatch_boundary_path_edge_set_arcs
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arcs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8004,14 +9208,14 @@ dxf_hatch_boundary_path_edge_get_ellipses
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (edge->ellipses == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8019,7 +9223,7 @@ dxf_hatch_boundary_path_edge_get_ellipses
         dxf_hatch_boundary_path_edge_ellipse_new (result);
         if (result == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () can not allocate memory for a DxfHatchBoundaryPathEdgeEllipse struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8052,14 +9256,14 @@ dxf_hatch_boundary_path_edge_set_ellipses
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipses == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8093,14 +9297,14 @@ dxf_hatch_boundary_path_edge_get_lines
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (edge->lines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8108,7 +9312,7 @@ dxf_hatch_boundary_path_edge_get_lines
         dxf_hatch_boundary_path_edge_line_new (result);
         if (result == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () can not allocate memory for a DxfHatchBoundaryPathEdgeLine struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8141,14 +9345,14 @@ dxf_hatch_boundary_path_edge_set_lines
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8182,14 +9386,14 @@ dxf_hatch_boundary_path_edge_get_splines
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (edge->splines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8197,7 +9401,7 @@ dxf_hatch_boundary_path_edge_get_splines
         dxf_hatch_boundary_path_edge_spline_new (result);
         if (result == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () can not allocate memory for a DxfHatchBoundaryPathEdgeSpline struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8230,14 +9434,14 @@ dxf_hatch_boundary_path_edge_set_splines
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (splines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8273,14 +9477,14 @@ dxf_hatch_boundary_path_edge_get_next
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (edge->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8313,14 +9517,14 @@ dxf_hatch_boundary_path_edge_set_next
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8354,14 +9558,14 @@ dxf_hatch_boundary_path_edge_get_last
         /* Do some basic checks. */
         if (edge == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (edge->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdge *) edge);
@@ -8397,9 +9601,9 @@ dxf_hatch_boundary_path_edge_arc_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeArc);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((arc = malloc (size)) == NULL)
+        if ((arc = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdgeArc struct.\n")),
                   __FUNCTION__);
                 arc = NULL;
@@ -8435,14 +9639,14 @@ dxf_hatch_boundary_path_edge_arc_init
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 arc = dxf_hatch_boundary_path_edge_arc_new ();
         }
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdgeArc struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8483,19 +9687,19 @@ dxf_hatch_boundary_path_edge_arc_free
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchBoundaryPathEdgeArc was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (arc);
+        dxf_free (arc);
         arc = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -8516,19 +9720,20 @@ dxf_hatch_boundary_path_edge_arc_free_chain
                  * edge arcs. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_edge_arcs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_edge_arcs != NULL)
         {
                 struct DxfHatchBoundaryPathEdgeArc *iter = hatch_boundary_path_edge_arcs->next;
+                hatch_boundary_path_edge_arcs->next = NULL;
                 dxf_hatch_boundary_path_edge_arc_free (hatch_boundary_path_edge_arcs);
                 hatch_boundary_path_edge_arcs = (DxfHatchBoundaryPathEdgeArc *) iter;
         }
@@ -8558,14 +9763,14 @@ dxf_hatch_boundary_path_edge_arc_get_id_code
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -8598,14 +9803,14 @@ dxf_hatch_boundary_path_edge_arc_set_id_code
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8639,7 +9844,7 @@ dxf_hatch_boundary_path_edge_arc_get_x0
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -8671,7 +9876,7 @@ dxf_hatch_boundary_path_edge_arc_set_x0
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8705,7 +9910,7 @@ dxf_hatch_boundary_path_edge_arc_get_y0
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -8737,7 +9942,7 @@ dxf_hatch_boundary_path_edge_arc_set_y0
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8766,7 +9971,7 @@ dxf_hatch_boundary_path_edge_arc_get_center_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p1 = NULL;
@@ -8774,7 +9979,7 @@ dxf_hatch_boundary_path_edge_arc_get_center_point
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8782,14 +9987,14 @@ dxf_hatch_boundary_path_edge_arc_get_center_point
         p1 = dxf_point_init (p1);
         if (p1 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         if (id_code < 0)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () passed id_code is smaller than 0.\n")),
                 __FUNCTION__);
         }
@@ -8817,20 +10022,20 @@ dxf_hatch_boundary_path_edge_arc_set_center_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8864,21 +10069,21 @@ dxf_hatch_boundary_path_edge_arc_get_radius
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->radius < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the radius member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->radius == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was found in the radius member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -8909,21 +10114,21 @@ dxf_hatch_boundary_path_edge_arc_set_radius
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (radius < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative radius value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (radius == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -8956,7 +10161,7 @@ dxf_hatch_boundary_path_edge_arc_get_start_angle
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -8987,7 +10192,7 @@ dxf_hatch_boundary_path_edge_arc_set_start_angle
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9020,7 +10225,7 @@ dxf_hatch_boundary_path_edge_arc_get_end_angle
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -9051,7 +10256,7 @@ dxf_hatch_boundary_path_edge_arc_set_end_angle
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9085,14 +10290,14 @@ dxf_hatch_boundary_path_edge_arc_get_is_ccw
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (arc->is_ccw < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the is_ccw member.\n")),
                   __FUNCTION__);
         }
@@ -9122,14 +10327,14 @@ dxf_hatch_boundary_path_edge_arc_set_is_ccw
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (is_ccw < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative is_ccw value was passed.\n")),
                   __FUNCTION__);
         }
@@ -9164,14 +10369,14 @@ dxf_hatch_boundary_path_edge_arc_get_next
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9204,14 +10409,14 @@ dxf_hatch_boundary_path_edge_arc_set_next
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9245,14 +10450,14 @@ dxf_hatch_boundary_path_edge_arc_get_last
         /* Do some basic checks. */
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (arc->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdgeArc *) arc);
@@ -9288,9 +10493,9 @@ dxf_hatch_boundary_path_edge_ellipse_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeEllipse);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ellipse = malloc (size)) == NULL)
+        if ((ellipse = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdgeEllipse struct.\n")),
                   __FUNCTION__);
                 ellipse = NULL;
@@ -9326,14 +10531,14 @@ dxf_hatch_boundary_path_edge_ellipse_init
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ellipse = dxf_hatch_boundary_path_edge_ellipse_new ();
         }
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdgeEllipse struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9376,19 +10581,19 @@ dxf_hatch_boundary_path_edge_ellipse_free
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchBoundaryPathEdgeEllipse was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ellipse);
+        dxf_free (ellipse);
         ellipse = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -9409,19 +10614,20 @@ dxf_hatch_boundary_path_edge_ellipse_free_chain
                  * edge ellipses. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_edge_ellipses == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_edge_ellipses != NULL)
         {
                 struct DxfHatchBoundaryPathEdgeEllipse *iter = hatch_boundary_path_edge_ellipses->next;
+                hatch_boundary_path_edge_ellipses->next = NULL;
                 dxf_hatch_boundary_path_edge_ellipse_free (hatch_boundary_path_edge_ellipses);
                 hatch_boundary_path_edge_ellipses = (DxfHatchBoundaryPathEdgeEllipse *) iter;
         }
@@ -9453,14 +10659,14 @@ dxf_hatch_boundary_path_edge_ellipse_get_id_code
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -9494,14 +10700,14 @@ dxf_hatch_boundary_path_edge_ellipse_set_id_code
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9536,7 +10742,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_x0
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -9570,7 +10776,7 @@ dxf_hatch_boundary_path_edge_ellipse_set_x0
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9605,7 +10811,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_y0
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -9639,7 +10845,7 @@ dxf_hatch_boundary_path_edge_ellipse_set_y0
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9670,7 +10876,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_center_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p1 = NULL;
@@ -9678,7 +10884,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_center_point
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9686,14 +10892,14 @@ dxf_hatch_boundary_path_edge_ellipse_get_center_point
         p1 = dxf_point_init (p1);
         if (p1 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         if (id_code < 0)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () passed id_code is smaller than 0.\n")),
                 __FUNCTION__);
         }
@@ -9723,20 +10929,20 @@ dxf_hatch_boundary_path_edge_ellipse_set_center_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9772,7 +10978,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_x1
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -9806,7 +11012,7 @@ dxf_hatch_boundary_path_edge_ellipse_set_x1
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9841,7 +11047,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_y1
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -9875,7 +11081,7 @@ dxf_hatch_boundary_path_edge_ellipse_set_y1
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9906,7 +11112,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_end_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p1 = NULL;
@@ -9914,7 +11120,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_end_point
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -9922,14 +11128,14 @@ dxf_hatch_boundary_path_edge_ellipse_get_end_point
         p1 = dxf_point_init (p1);
         if (p1 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         if (id_code < 0)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () passed id_code is smaller than 0.\n")),
                 __FUNCTION__);
         }
@@ -9959,20 +11165,20 @@ dxf_hatch_boundary_path_edge_ellipse_set_end_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10008,21 +11214,21 @@ dxf_hatch_boundary_path_edge_ellipse_get_ratio
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->ratio < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the ratio member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->ratio == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was found in the ratio member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -10055,21 +11261,21 @@ dxf_hatch_boundary_path_edge_ellipse_set_ratio
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ratio < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative ratio value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ratio == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of zero was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10104,7 +11310,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_start_angle
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -10137,7 +11343,7 @@ dxf_hatch_boundary_path_edge_ellipse_set_start_angle
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10172,7 +11378,7 @@ dxf_hatch_boundary_path_edge_ellipse_get_end_angle
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -10205,7 +11411,7 @@ dxf_hatch_boundary_path_edge_ellipse_set_end_angle
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10240,14 +11446,14 @@ dxf_hatch_boundary_path_edge_ellipse_get_is_ccw
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ellipse->is_ccw < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the is_ccw member.\n")),
                   __FUNCTION__);
         }
@@ -10279,14 +11485,14 @@ dxf_hatch_boundary_path_edge_ellipse_set_is_ccw
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (is_ccw < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative is_ccw value was passed.\n")),
                   __FUNCTION__);
         }
@@ -10322,14 +11528,14 @@ dxf_hatch_boundary_path_edge_ellipse_get_next
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10363,14 +11569,14 @@ dxf_hatch_boundary_path_edge_ellipse_set_next
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10406,14 +11612,14 @@ dxf_hatch_boundary_path_edge_ellipse_get_last
         /* Do some basic checks. */
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ellipse->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdgeEllipse *) ellipse);
@@ -10449,9 +11655,9 @@ dxf_hatch_boundary_path_edge_line_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdgeLine struct.\n")),
                   __FUNCTION__);
                 line = NULL;
@@ -10487,14 +11693,14 @@ dxf_hatch_boundary_path_edge_line_init
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_hatch_boundary_path_edge_line_new ();
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdgeLine struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10533,19 +11739,19 @@ dxf_hatch_boundary_path_edge_line_free
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchBoundaryPathEdgeLine was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (line);
+        dxf_free (line);
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -10566,19 +11772,20 @@ dxf_hatch_boundary_path_edge_line_free_chain
                  * edge lines. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_edge_lines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_edge_lines != NULL)
         {
                 struct DxfHatchBoundaryPathEdgeLine *iter = hatch_boundary_path_edge_lines->next;
+                hatch_boundary_path_edge_lines->next = NULL;
                 dxf_hatch_boundary_path_edge_line_free (hatch_boundary_path_edge_lines);
                 hatch_boundary_path_edge_lines = (DxfHatchBoundaryPathEdgeLine *) iter;
         }
@@ -10609,14 +11816,14 @@ dxf_hatch_boundary_path_edge_line_get_id_code
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -10650,14 +11857,14 @@ dxf_hatch_boundary_path_edge_line_set_id_code
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10691,7 +11898,7 @@ dxf_hatch_boundary_path_edge_line_get_x0
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -10724,7 +11931,7 @@ dxf_hatch_boundary_path_edge_line_set_x0
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10758,7 +11965,7 @@ dxf_hatch_boundary_path_edge_line_get_y0
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -10791,7 +11998,7 @@ dxf_hatch_boundary_path_edge_line_set_y0
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10820,7 +12027,7 @@ dxf_hatch_boundary_path_edge_line_get_start_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p1 = NULL;
@@ -10828,7 +12035,7 @@ dxf_hatch_boundary_path_edge_line_get_start_point
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10836,7 +12043,7 @@ dxf_hatch_boundary_path_edge_line_get_start_point
         if ((line->x0 == line->x1)
           && (line->y0 == line->y1))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a LINE with points with identical coordinates were passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10844,14 +12051,14 @@ dxf_hatch_boundary_path_edge_line_get_start_point
         p1 = dxf_point_init (p1);
         if (p1 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         if (id_code < 0)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () passed id_code is smaller than 0.\n")),
                 __FUNCTION__);
         }
@@ -10879,20 +12086,20 @@ dxf_hatch_boundary_path_edge_line_set_start_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10927,7 +12134,7 @@ dxf_hatch_boundary_path_edge_line_get_x1
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -10960,7 +12167,7 @@ dxf_hatch_boundary_path_edge_line_set_x1
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -10994,7 +12201,7 @@ dxf_hatch_boundary_path_edge_line_get_y1
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -11027,7 +12234,7 @@ dxf_hatch_boundary_path_edge_line_set_y1
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11056,7 +12263,7 @@ dxf_hatch_boundary_path_edge_line_get_end_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p2 = NULL;
@@ -11064,7 +12271,7 @@ dxf_hatch_boundary_path_edge_line_get_end_point
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11072,7 +12279,7 @@ dxf_hatch_boundary_path_edge_line_get_end_point
         if ((line->x0 == line->x1)
           && (line->y0 == line->y1))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a line with endpoints with identical coordinates was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11080,14 +12287,14 @@ dxf_hatch_boundary_path_edge_line_get_end_point
         p2 = dxf_point_init (p2);
         if (p2 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         if (id_code < 0)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () passed id_code is smaller than 0.\n")),
                 __FUNCTION__);
         }
@@ -11115,20 +12322,20 @@ dxf_hatch_boundary_path_edge_line_set_end_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11165,14 +12372,14 @@ dxf_hatch_boundary_path_edge_line_get_next
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11205,14 +12412,14 @@ dxf_hatch_boundary_path_edge_line_set_next
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11246,14 +12453,14 @@ dxf_hatch_boundary_path_edge_line_get_last
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdgeLine *) line);
@@ -11289,9 +12496,9 @@ dxf_hatch_boundary_path_edge_spline_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeSpline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spline = malloc (size)) == NULL)
+        if ((spline = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdgeSpline struct.\n")),
                   __FUNCTION__);
                 spline = NULL;
@@ -11329,14 +12536,14 @@ dxf_hatch_boundary_path_edge_spline_init
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spline = dxf_hatch_boundary_path_edge_spline_new ();
         }
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdgeSpline struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11381,20 +12588,20 @@ dxf_hatch_boundary_path_edge_spline_free
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchBoundaryPathEdgeSpline was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (spline->control_points);
-        free (spline);
+        dxf_free (spline->control_points);
+        dxf_free (spline);
         spline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -11415,19 +12622,20 @@ dxf_hatch_boundary_path_edge_spline_free_chain
                  * edge splines. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_edge_splines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_edge_splines != NULL)
         {
                 struct DxfHatchBoundaryPathEdgeSpline *iter = hatch_boundary_path_edge_splines->next;
+                hatch_boundary_path_edge_splines->next = NULL;
                 dxf_hatch_boundary_path_edge_spline_free (hatch_boundary_path_edge_splines);
                 hatch_boundary_path_edge_splines = (DxfHatchBoundaryPathEdgeSpline *) iter;
         }
@@ -11458,14 +12666,14 @@ dxf_hatch_boundary_path_edge_spline_get_id_code
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -11499,14 +12707,14 @@ dxf_hatch_boundary_path_edge_spline_set_id_code
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11540,14 +12748,14 @@ dxf_hatch_boundary_path_edge_spline_get_degree
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->degree < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the degree member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -11579,14 +12787,14 @@ dxf_hatch_boundary_path_edge_spline_set_degree
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (degree < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative degree value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11620,7 +12828,7 @@ dxf_hatch_boundary_path_edge_spline_get_rational
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -11652,7 +12860,7 @@ dxf_hatch_boundary_path_edge_spline_set_rational
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11686,7 +12894,7 @@ dxf_hatch_boundary_path_edge_spline_get_periodic
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -11718,7 +12926,7 @@ dxf_hatch_boundary_path_edge_spline_set_periodic
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11752,14 +12960,14 @@ dxf_hatch_boundary_path_edge_spline_get_number_of_knots
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->number_of_knots < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative number_of_knots value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -11791,14 +12999,14 @@ dxf_hatch_boundary_path_edge_spline_set_number_of_knots
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (number_of_knots < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative number_of_knots value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11836,7 +13044,7 @@ dxf_hatch_boundary_path_edge_spline_get_knots
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -11874,7 +13082,7 @@ dxf_hatch_boundary_path_edge_spline_set_knots
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -11883,7 +13091,7 @@ dxf_hatch_boundary_path_edge_spline_set_knots
         {
                 if (&knots[i] ==  NULL)
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () a NULL pointer was found in the knots array at element %d.\n")),
                           __FUNCTION__, i);
                         return (NULL);
@@ -11918,14 +13126,14 @@ dxf_hatch_boundary_path_edge_spline_get_number_of_control_points
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->number_of_control_points < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative number_of_control_points value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -11958,14 +13166,14 @@ dxf_hatch_boundary_path_edge_spline_set_number_of_control_points
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (number_of_control_points < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative number_of_control_points value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -12001,7 +13209,7 @@ dxf_hatch_boundary_path_edge_spline_get_control_points
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -12034,14 +13242,14 @@ dxf_hatch_boundary_path_edge_spline_set_control_points
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (control_points == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -12132,21 +13340,21 @@ dxf_hatch_boundary_path_edge_spline_append_control_point
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline_cp.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -12273,21 +13481,21 @@ dxf_hatch_boundary_path_edge_spline_prepend_control_point
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline_cp.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -12352,25 +13560,25 @@ dxf_hatch_boundary_path_edge_spline_get_control_point
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (position <= 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->number_of_control_points <= position)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () position is greater than the number of control points.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -12436,32 +13644,32 @@ dxf_hatch_boundary_path_edge_spline_set_control_point
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position <= 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in control_point.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->number_of_control_points <= position)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () position is greater than the number of control points.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -12604,42 +13812,42 @@ dxf_hatch_boundary_path_edge_spline_insert_control_point
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position <= 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in control_point.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->number_of_control_points <= position)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () position is greater than the number of control points.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
@@ -12743,41 +13951,41 @@ dxf_hatch_boundary_path_edge_spline_remove_control_point
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position <= 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position >= DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->number_of_control_points <= position)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () position is greater than the number of control points.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
                 /* no control points yet, so there is no control point to
                  * remove. */
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () spline contins no control points.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -12926,20 +14134,20 @@ dxf_hatch_boundary_path_edge_spline_copy_control_points
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (sizeof (spline) < sizeof (DxfHatchBoundaryPathEdgeSpline))
         {
-                spline = realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
+                spline = dxf_realloc (spline, sizeof (DxfHatchBoundaryPathEdgeSpline));
         }
         if (spline->control_points == NULL)
         {
                 /* no control points yet, so there is no control point
                  * to copy. */
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () spline contains no control points.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -13014,14 +14222,14 @@ dxf_hatch_boundary_path_edge_spline_append_knot_value
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if ((spline->number_of_knots + 1) > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (("Error in %s () resulted in a array pointer overflow.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -13063,14 +14271,14 @@ dxf_hatch_boundary_path_edge_spline_prepend_knot_value
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if ((spline->number_of_knots + 1) > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () resulted in a array pointer overflow.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -13114,21 +14322,21 @@ dxf_hatch_boundary_path_edge_spline_get_knot_value
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position <= 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in  %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -13167,21 +14375,21 @@ dxf_hatch_boundary_path_edge_spline_set_knot_value
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position <= 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -13225,28 +14433,28 @@ dxf_hatch_boundary_path_edge_spline_insert_knot_value
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if ((spline->number_of_knots + 1) > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () resulted in a array pointer overflow.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position <= 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position >= DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -13292,35 +14500,35 @@ dxf_hatch_boundary_path_edge_spline_remove_knot_value
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->number_of_knots > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () resulted in a array pointer overflow.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if ((spline->number_of_knots - 1) < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () resulted in a array pointer underflow.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position <= 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received an invalid value in position.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (position >= DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a position greater than DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -13368,14 +14576,14 @@ dxf_hatch_boundary_path_edge_spline_copy_knot_values
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->number_of_knots > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () resulted in a array pointer overflow.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -13412,14 +14620,14 @@ dxf_hatch_boundary_path_edge_spline_get_next
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -13450,14 +14658,14 @@ dxf_hatch_boundary_path_edge_spline_set_next
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -13491,14 +14699,14 @@ dxf_hatch_boundary_path_edge_spline_get_last
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdgeSpline *) spline);
@@ -13535,9 +14743,9 @@ dxf_hatch_boundary_path_edge_spline_control_point_new ()
         size = sizeof (DxfHatchBoundaryPathEdgeSplineCp);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((control_point = malloc (size)) == NULL)
+        if ((control_point = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdgeSplineCp struct.\n")),
                   __FUNCTION__);
                 control_point = NULL;
@@ -13573,14 +14781,14 @@ dxf_hatch_boundary_path_edge_spline_control_point_init
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 control_point = dxf_hatch_boundary_path_edge_spline_control_point_new ();
         }
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHatchBoundaryPathEdgeSplineCp struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -13618,19 +14826,19 @@ dxf_hatch_boundary_path_edge_spline_control_point_free
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (control_point->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfHatchBoundaryPathEdgeSplineCp was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (control_point);
+        dxf_free (control_point);
         control_point = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -13651,19 +14859,20 @@ dxf_hatch_boundary_path_edge_spline_control_point_free_chain
                  * edge spline control points. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (hatch_boundary_path_edge_spline_control_points == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (hatch_boundary_path_edge_spline_control_points != NULL)
         {
                 struct DxfHatchBoundaryPathEdgeSplineCp *iter = hatch_boundary_path_edge_spline_control_points->next;
+                hatch_boundary_path_edge_spline_control_points->next = NULL;
                 dxf_hatch_boundary_path_edge_spline_control_point_free (hatch_boundary_path_edge_spline_control_points);
                 hatch_boundary_path_edge_spline_control_points = (DxfHatchBoundaryPathEdgeSplineCp *) iter;
         }
@@ -13695,14 +14904,14 @@ dxf_hatch_boundary_path_edge_spline_cp_get_id_code
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (control_point->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -13737,14 +14946,14 @@ dxf_hatch_boundary_path_edge_spline_cp_set_id_code
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -13779,7 +14988,7 @@ dxf_hatch_boundary_path_edge_spline_cp_get_x0
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -13813,7 +15022,7 @@ dxf_hatch_boundary_path_edge_spline_cp_set_x0
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -13848,7 +15057,7 @@ dxf_hatch_boundary_path_edge_spline_cp_get_y0
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -13882,7 +15091,7 @@ dxf_hatch_boundary_path_edge_spline_cp_set_y0
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -13913,7 +15122,7 @@ dxf_hatch_boundary_path_edge_spline_cp_get_point
                  * file. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *p1 = NULL;
@@ -13921,7 +15130,7 @@ dxf_hatch_boundary_path_edge_spline_cp_get_point
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -13929,14 +15138,14 @@ dxf_hatch_boundary_path_edge_spline_cp_get_point
         p1 = dxf_point_init (p1);
         if (p1 == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         if (id_code < 0)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () passed id_code is smaller than 0.\n")),
                 __FUNCTION__);
         }
@@ -13967,20 +15176,20 @@ dxf_hatch_boundary_path_edge_spline_cp_set_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -14016,7 +15225,7 @@ dxf_hatch_boundary_path_edge_spline_cp_get_weight
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -14052,7 +15261,7 @@ dxf_hatch_boundary_path_edge_spline_cp_set_weight
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () received a NULL pointer value in dxf_hatch_boundary_path_edge_spline.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -14090,14 +15299,14 @@ dxf_hatch_boundary_path_edge_spline_cp_get_next
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (control_point->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -14132,14 +15341,14 @@ dxf_hatch_boundary_path_edge_spline_cp_set_next
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -14176,14 +15385,14 @@ dxf_hatch_boundary_path_edge_spline_cp_get_last
         /* Do some basic checks. */
         if (control_point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (control_point->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdgeSplineCp *) control_point);
@@ -57,6 +57,7 @@ extern "C" {
 
 #define DXF_MAX_HATCH_PATTERN_DEF_LINE_DASH_ITEMS 16
 #define DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS 64
+#define DXF_MAX_HATCH_GRADIENT_COLORS 2
 
 
 /*!
@@ -225,6 +226,10 @@ dxf_hatch_boundary_path_edge_spline_struct
 /*!
  * \brief DXF definition of an AutoCAD hatch boundary path edge
  * (composite of arcs, ellipses, lines or splines).
+ *
+ * \c dxf_hatch_read () reads every edge of a boundary path into an
+ * edge of its own, holding one arc, ellipse, line or spline, so the
+ * list of edges keeps the order of the boundary path.
  */
 typedef struct
 dxf_hatch_boundary_path_edge_struct
@@ -303,6 +308,11 @@ dxf_hatch_boundary_path_polyline_struct
                  * \c NULL if there is no
                  * DxfHatchBoundaryPathPolylineVertex in the
                  * DxfHatchBoundaryPathPolyline. */
+        int number_of_allocated_vertices;
+                /*!< Number of vertices in the array allocated by
+                 * \c dxf_hatch_boundary_path_polyline_allocate_vertices (),
+                 * starting at \c vertices.\n
+                 * 0 if the vertices were allocated one by one. */
         struct DxfHatchBoundaryPathPolyline *next;
                 /*!< Pointer to the next DxfHatchBoundaryPathPolyline.\n
                  * \c NULL if the last DxfHatchBoundaryPathPolyline. */
@@ -320,6 +330,15 @@ dxf_hatch_boundary_path_struct
                 /*!< Treat the boundary path as if it were a single
                  * (composite) entity.\n
                  * Group code = 5. */
+        int type_flag;
+                /*!< Boundary path type flag (bit coded):\n
+                 * 0 = default\n
+                 * 1 = external\n
+                 * 2 = polyline\n
+                 * 4 = derived\n
+                 * 8 = textbox\n
+                 * 16 = outermost.\n
+                 * Group code = 92. */
         struct DxfHatchBoundaryPathEdge *edges;
                 /*!< Pointer to the first DxfHatchBoundaryPathEdge.\n
                  * \c NULL if there is no DxfHatchBoundaryPathEdge in
@@ -435,6 +454,9 @@ dxf_hatch_pattern_struct
 typedef struct
 dxf_hatch_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -559,6 +581,36 @@ dxf_hatch_struct
                 /*!< Extrusion direction\n
                  * optional, if omitted defaults to 1.0.\n
                  * Group code = 230. */
+        int gradient_fill;
+                /*!< 0 = solid or pattern fill\n
+                 * 1 = gradient fill.\n
+                 * Group code = 450. */
+        int gradient_one_color;
+                /*!< 0 = two color gradient\n
+                 * 1 = single color gradient.\n
+                 * Group code = 452. */
+        int number_of_gradient_colors;
+                /*!< Number of gradient colors.\n
+                 * Group code = 453. */
+        double gradient_angle;
+                /*!< Rotation angle of the gradient in radians.\n
+                 * Group code = 460. */
+        double gradient_shift;
+                /*!< Gradient definition, 0.0 = unshifted, 1.0 =
+                 * shifted.\n
+                 * Group code = 461. */
+        double gradient_tint;
+                /*!< Color tint of a single color gradient.\n
+                 * Group code = 462. */
+        int gradient_colors[DXF_MAX_HATCH_GRADIENT_COLORS];
+                /*!< Color index of the gradient colors.\n
+                 * Group code = 63. */
+        int gradient_true_colors[DXF_MAX_HATCH_GRADIENT_COLORS];
+                /*!< RGB value of the gradient colors.\n
+                 * Group code = 421. */
+        char *gradient_name;
+                /*!< Name of the gradient, for example "LINEAR".\n
+                 * Group code = 470. */
         struct DxfHatchBoundaryPath *paths;
                 /*!< Pointer to the first DxfHatchBoundaryPath.\n
                  * \c NULL if there is no DxfHatchBoundaryPath in the
@@ -582,6 +634,7 @@ dxf_hatch_struct
 /* dxf_hatch functions. */
 DxfHatch *dxf_hatch_new ();
 DxfHatch *dxf_hatch_init (DxfHatch *hatch);
+DxfHatch *dxf_hatch_read (DxfFile *fp, DxfHatch *hatch);
 int dxf_hatch_write (DxfFile *fp, DxfHatch *hatch);
 int dxf_hatch_free (DxfHatch *hatch);
 void dxf_hatch_free_chain (DxfHatch *hatches);
@@ -736,6 +789,7 @@ DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_new ();
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_init (DxfHatchBoundaryPathPolyline *polyline);
 int dxf_hatch_boundary_path_polyline_write (DxfFile *fp, DxfHatchBoundaryPathPolyline *polyline);
 int dxf_hatch_boundary_path_polyline_free (DxfHatchBoundaryPathPolyline *polyline);
+int dxf_hatch_boundary_path_polyline_allocate_vertices (DxfHatchBoundaryPathPolyline *polyline, int number_of_vertices);
 void dxf_hatch_boundary_path_polyline_free_chain (DxfHatchBoundaryPathPolyline *polylines);
 int dxf_hatch_boundary_path_polyline_get_id_code (DxfHatchBoundaryPathPolyline *polyline);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_id_code (DxfHatchBoundaryPathPolyline *polyline, int id_code);
@@ -773,6 +827,7 @@ DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_get_
 /* dxf_hatch_boundary_path_edge functions. */
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_edge_new ();
 DxfHatchBoundaryPathEdge * dxf_hatch_boundary_path_edge_init (DxfHatchBoundaryPathEdge *edge);
+int dxf_hatch_boundary_path_edge_write (DxfFile *fp, DxfHatchBoundaryPathEdge *edge);
 int dxf_hatch_boundary_path_edge_free (DxfHatchBoundaryPathEdge *edge);
 void dxf_hatch_boundary_path_edge_free_chain (DxfHatchBoundaryPathEdge *edges);
 int dxf_hatch_boundary_path_edge_get_id_code (DxfHatchBoundaryPathEdge *edge);
@@ -0,0 +1,956 @@
+/*!
+ * \file hatch_fill.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF generation of the line segments of a
+ * \c HATCH pattern.
+ *
+ * Every pattern definition line is a family of parallel lines.\n
+ * The boundary segments of a hatch region are rotated into the frame of
+ * the family, where the lines are horizontal, and sorted by their
+ * lowest end point.\n
+ * The lines are then scanned upwards with an active edge list, the
+ * crossings of each line are sorted, the hatched intervals follow from
+ * the winding number and the hatch style, and the dash sequence is laid
+ * over each interval.\n
+ * The lines of all families are divided over a number of threads, the
+ * segments are in the same order for any number of threads.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "hatch_fill.h"
+#include <pthread.h>
+
+
+/*!
+ * \brief A pattern definition line prepared for scanning.
+ */
+typedef struct
+dxf_hatch_fill_family_struct
+{
+        double ux;
+                /*!< X-value of the direction of the lines. */
+        double uy;
+                /*!< Y-value of the direction of the lines. */
+        double spacing;
+                /*!< Distance between the lines. */
+        double shift;
+                /*!< Shift of the dash sequence from one line to the
+                 * next. */
+        double first_v;
+                /*!< Distance from the origin of the first line
+                 * crossing the region, perpendicular to the lines. */
+        double first_origin;
+                /*!< Start of the dash sequence of the first line. */
+        size_t number_of_lines;
+                /*!< Number of lines crossing the region. */
+        double *edges;
+                /*!< Boundary segments in the frame of the lines, u0,
+                 * v0, u1, v1 and the direction per segment, sorted by
+                 * v0. */
+        double *dashes;
+                /*!< Dash lengths, negative for gaps. */
+        int number_of_dashes;
+                /*!< Number of dash lengths. */
+        double period;
+                /*!< Sum of the absolute dash lengths. */
+} DxfHatchFillFamily;
+
+
+/*!
+ * \brief A crossing of a pattern line and a boundary segment.
+ */
+typedef struct
+dxf_hatch_fill_crossing_struct
+{
+        double u;
+                /*!< Position along the line. */
+        int direction;
+                /*!< +1 when the loop crosses upwards, -1 downwards. */
+} DxfHatchFillCrossing;
+
+
+/*!
+ * \brief Range of pattern lines scanned by a thread.
+ */
+typedef struct
+dxf_hatch_fill_job_struct
+{
+        DxfHatchRegion *region;
+                /*!< The hatch region. */
+        DxfHatchFillFamily *families;
+                /*!< The families. */
+        int number_of_families;
+                /*!< Number of families. */
+        size_t first;
+                /*!< Index of the first line, counting the lines of all
+                 * families. */
+        size_t last;
+                /*!< Index after the last line. */
+        DxfHatchFill fill;
+                /*!< Segments generated by the thread. */
+        int result;
+                /*!< \c EXIT_SUCCESS, or \c EXIT_FAILURE when no memory
+                 * could be allocated. */
+} DxfHatchFillJob;
+
+
+/*!
+ * \brief Allocate memory for hatch fill segments.
+ *
+ * \return a pointer to the hatch fill, or \c NULL when an error
+ * occurred.
+ */
+DxfHatchFill *
+dxf_hatch_fill_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchFill *fill = NULL;
+        size_t size;
+
+        size = sizeof (DxfHatchFill);
+        if ((fill = dxf_malloc (size)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfHatchFill struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (fill, 0, size);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (fill);
+}
+
+
+/*!
+ * \brief Free the allocated memory for hatch fill segments.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_free
+(
+        DxfHatchFill *fill
+                /*!< a pointer to the hatch fill. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (fill == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (fill->segments);
+        dxf_free (fill);
+        fill = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all segments from a hatch fill, the memory is kept for
+ * reuse.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_clear
+(
+        DxfHatchFill *fill
+                /*!< a pointer to the hatch fill. */
+)
+{
+        if (fill == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fill->number_of_segments = 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make room for more segments.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_reserve
+(
+        DxfHatchFill *fill,
+                /*!< a pointer to the hatch fill. */
+        size_t number_of_segments
+                /*!< number of segments to be added. */
+)
+{
+        double *segments;
+        size_t capacity;
+
+        if (fill->number_of_segments + number_of_segments <= fill->capacity)
+        {
+                return (EXIT_SUCCESS);
+        }
+        capacity = (fill->capacity == 0) ? 1024 : 2 * fill->capacity;
+        if (capacity < fill->number_of_segments + number_of_segments)
+        {
+                capacity = fill->number_of_segments + number_of_segments;
+        }
+        segments = dxf_realloc (fill->segments, 4 * capacity * sizeof (double));
+        if (segments == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fill->segments = segments;
+        fill->capacity = capacity;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a segment of a pattern line.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_add_segment
+(
+        DxfHatchFill *fill,
+                /*!< a pointer to the hatch fill. */
+        DxfHatchFillFamily *family,
+                /*!< the family of the line. */
+        double v,
+                /*!< position of the line. */
+        double u0,
+                /*!< start of the segment along the line. */
+        double u1
+                /*!< end of the segment along the line. */
+)
+{
+        double *segment;
+
+        if (dxf_hatch_fill_reserve (fill, 1) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        segment = fill->segments + 4 * fill->number_of_segments;
+        segment[0] = u0 * family->ux - v * family->uy;
+        segment[1] = u0 * family->uy + v * family->ux;
+        segment[2] = u1 * family->ux - v * family->uy;
+        segment[3] = u1 * family->uy + v * family->ux;
+        fill->number_of_segments++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Lay the dash sequence of a line over a hatched interval.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_add_interval
+(
+        DxfHatchFill *fill,
+                /*!< a pointer to the hatch fill. */
+        DxfHatchFillFamily *family,
+                /*!< the family of the line. */
+        double v,
+                /*!< position of the line. */
+        double origin,
+                /*!< start of the dash sequence of the line. */
+        double start,
+                /*!< start of the interval along the line. */
+        double end
+                /*!< end of the interval along the line. */
+)
+{
+        double position;
+        double length;
+        double dash_end;
+        int i;
+
+        if ((family->number_of_dashes == 0) || !(family->period > 0.0))
+        {
+                return (dxf_hatch_fill_add_segment (fill, family, v, start, end));
+        }
+        /* Start at the sequence which holds the start of the interval. */
+        position = origin + floor ((start - origin) / family->period) * family->period;
+        for (i = 0; position < end; i = (i + 1) % family->number_of_dashes)
+        {
+                length = family->dashes[i];
+                dash_end = position + fabs (length);
+                if ((length > 0.0) && (dash_end > start))
+                {
+                        if (dxf_hatch_fill_add_segment (fill, family, v,
+                          (position > start) ? position : start,
+                          (dash_end < end) ? dash_end : end) != EXIT_SUCCESS)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                else if ((length == 0.0) && (position >= start))
+                {
+                        if (dxf_hatch_fill_add_segment (fill, family, v,
+                          position, position) != EXIT_SUCCESS)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                position = dash_end;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compare two crossings by their position along the line.
+ *
+ * \return -1, 0 or 1.
+ */
+static int
+dxf_hatch_fill_compare_crossings
+(
+        const void *a,
+                /*!< a pointer to the first crossing. */
+        const void *b
+                /*!< a pointer to the second crossing. */
+)
+{
+        const DxfHatchFillCrossing *c0 = (const DxfHatchFillCrossing *) a;
+        const DxfHatchFillCrossing *c1 = (const DxfHatchFillCrossing *) b;
+
+        if (c0->u != c1->u)
+        {
+                return ((c0->u < c1->u) ? -1 : 1);
+        }
+        return (c0->direction - c1->direction);
+}
+
+
+/*!
+ * \brief Scan a range of lines of one family.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_scan
+(
+        DxfHatchFill *fill,
+                /*!< a pointer to the hatch fill of the thread. */
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        DxfHatchFillFamily *family,
+                /*!< the family. */
+        size_t first,
+                /*!< index of the first line. */
+        size_t last,
+                /*!< index after the last line. */
+        size_t *active,
+                /*!< work space for the active edge list, one index per
+                 * boundary segment. */
+        DxfHatchFillCrossing *crossings
+                /*!< work space for the crossings, one per boundary
+                 * segment. */
+)
+{
+        const double *edges = family->edges;
+        const double *edge;
+        size_t number_of_edges = region->number_of_edges;
+        size_t number_of_active = 0;
+        size_t next = 0;
+        size_t number_of_crossings;
+        size_t line;
+        size_t i;
+        size_t k;
+        double v;
+        double start = 0.0;
+        int depth;
+        int hatched;
+        int was_hatched;
+
+        for (line = first; line < last; line++)
+        {
+                v = family->first_v + line * family->spacing;
+                /* Update the active edge list, segments cover
+                 * [v0, v1). */
+                while ((next < number_of_edges) && (edges[5 * next + 1] <= v))
+                {
+                        active[number_of_active++] = next++;
+                }
+                for (i = 0, k = 0; i < number_of_active; i++)
+                {
+                        if (edges[5 * active[i] + 3] > v)
+                        {
+                                active[k++] = active[i];
+                        }
+                }
+                number_of_active = k;
+                if (number_of_active == 0)
+                {
+                        continue;
+                }
+                number_of_crossings = number_of_active;
+                for (i = 0; i < number_of_active; i++)
+                {
+                        edge = edges + 5 * active[i];
+                        crossings[i].u = edge[0] + (v - edge[1]) * (edge[2] - edge[0]) / (edge[3] - edge[1]);
+                        crossings[i].direction = (int) edge[4];
+                }
+                qsort (crossings, number_of_crossings, sizeof (DxfHatchFillCrossing),
+                  dxf_hatch_fill_compare_crossings);
+                /* Left of all crossings the depth is 0, crossing a
+                 * loop running upwards leaves it. */
+                depth = 0;
+                was_hatched = FALSE;
+                for (i = 0; i < number_of_crossings; i++)
+                {
+                        depth -= crossings[i].direction;
+                        hatched = dxf_hatch_region_depth_is_hatched (region, depth);
+                        if (hatched && !was_hatched)
+                        {
+                                start = crossings[i].u;
+                        }
+                        else if (!hatched && was_hatched && (crossings[i].u > start))
+                        {
+                                if (dxf_hatch_fill_add_interval (fill, family, v,
+                                  family->first_origin + line * family->shift,
+                                  start, crossings[i].u) != EXIT_SUCCESS)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                        }
+                        was_hatched = hatched;
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Scan a range of lines of all families.
+ */
+static void *
+dxf_hatch_fill_run_job
+(
+        void *data
+                /*!< a pointer to the \c DxfHatchFillJob. */
+)
+{
+        DxfHatchFillJob *job = (DxfHatchFillJob *) data;
+        DxfHatchFillCrossing *crossings = NULL;
+        size_t *active = NULL;
+        size_t number_of_edges = job->region->number_of_edges;
+        size_t offset = 0;
+        size_t first;
+        size_t last;
+        int f;
+
+        job->result = EXIT_SUCCESS;
+        if (job->first >= job->last)
+        {
+                return (NULL);
+        }
+        active = dxf_malloc (number_of_edges * sizeof (size_t));
+        crossings = dxf_malloc (number_of_edges * sizeof (DxfHatchFillCrossing));
+        if ((active == NULL) || (crossings == NULL))
+        {
+                job->result = EXIT_FAILURE;
+        }
+        for (f = 0; (f < job->number_of_families) && (job->result == EXIT_SUCCESS); f++)
+        {
+                first = (job->first > offset) ? job->first - offset : 0;
+                last = job->last - offset;
+                if (last > job->families[f].number_of_lines)
+                {
+                        last = job->families[f].number_of_lines;
+                }
+                if ((job->last > offset) && (first < last))
+                {
+                        job->result = dxf_hatch_fill_scan (&job->fill, job->region,
+                          job->families + f, first, last, active, crossings);
+                }
+                offset += job->families[f].number_of_lines;
+        }
+        dxf_free (active);
+        dxf_free (crossings);
+        return (NULL);
+}
+
+
+/*!
+ * \brief Compare two rotated boundary segments by their lowest
+ * position.
+ *
+ * \return -1, 0 or 1.
+ */
+static int
+dxf_hatch_fill_compare_edges
+(
+        const void *a,
+                /*!< a pointer to the first segment. */
+        const void *b
+                /*!< a pointer to the second segment. */
+)
+{
+        const double *e0 = (const double *) a;
+        const double *e1 = (const double *) b;
+
+        if (e0[1] != e1[1])
+        {
+                return ((e0[1] < e1[1]) ? -1 : 1);
+        }
+        return (0);
+}
+
+
+/*!
+ * \brief Prepare a pattern definition line for scanning.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the lines
+ * have no spacing, too many lines cross the region, or no memory could
+ * be allocated.
+ */
+static int
+dxf_hatch_fill_family_init
+(
+        DxfHatchFillFamily *family,
+                /*!< the family. */
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        DxfHatchPatternDefLine *def_line
+                /*!< a pointer to the pattern definition line. */
+)
+{
+        DxfHatchPatternDefLineDash *dash;
+        DxfHatchRegionEdge *edge;
+        double angle = def_line->angle * M_PI / 180.0;
+        double ux = cos (angle);
+        double uy = sin (angle);
+        double *e;
+        double u0;
+        double v0;
+        double u1;
+        double v1;
+        double v_min = HUGE_VAL;
+        double v_max = -HUGE_VAL;
+        double base_u;
+        double base_v;
+        double lines;
+        double first;
+        size_t i;
+        int n;
+
+        memset (family, 0, sizeof (DxfHatchFillFamily));
+        family->ux = ux;
+        family->uy = uy;
+        /* Successive lines are offset by (x1, y1), split into a spacing
+         * perpendicular to the lines and a shift along the lines. */
+        family->spacing = -def_line->x1 * uy + def_line->y1 * ux;
+        family->shift = def_line->x1 * ux + def_line->y1 * uy;
+        if (family->spacing < 0.0)
+        {
+                family->spacing = -family->spacing;
+                family->shift = -family->shift;
+        }
+        if (!(family->spacing > 0.0))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (n = 0, dash = (DxfHatchPatternDefLineDash *) def_line->dashes;
+          dash != NULL;
+          dash = (DxfHatchPatternDefLineDash *) dash->next, n++);
+        family->edges = dxf_malloc ((5 * region->number_of_edges + n + 1) * sizeof (double));
+        if (family->edges == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        family->dashes = family->edges + 5 * region->number_of_edges;
+        family->number_of_dashes = n;
+        for (n = 0, dash = (DxfHatchPatternDefLineDash *) def_line->dashes;
+          dash != NULL;
+          dash = (DxfHatchPatternDefLineDash *) dash->next, n++)
+        {
+                family->dashes[n] = dash->length;
+                family->period += fabs (dash->length);
+        }
+        /* Rotate the boundary segments, keeping the lowest end point
+         * first. */
+        for (i = 0; i < region->number_of_edges; i++)
+        {
+                edge = region->edges + i;
+                e = family->edges + 5 * i;
+                u0 = edge->x0 * ux + edge->y0 * uy;
+                v0 = -edge->x0 * uy + edge->y0 * ux;
+                u1 = edge->x1 * ux + edge->y1 * uy;
+                v1 = -edge->x1 * uy + edge->y1 * ux;
+                if (v0 <= v1)
+                {
+                        e[0] = u0;
+                        e[1] = v0;
+                        e[2] = u1;
+                        e[3] = v1;
+                        e[4] = edge->direction;
+                }
+                else
+                {
+                        e[0] = u1;
+                        e[1] = v1;
+                        e[2] = u0;
+                        e[3] = v0;
+                        e[4] = -edge->direction;
+                }
+                v_min = (e[1] < v_min) ? e[1] : v_min;
+                v_max = (e[3] > v_max) ? e[3] : v_max;
+        }
+        qsort (family->edges, region->number_of_edges, 5 * sizeof (double),
+          dxf_hatch_fill_compare_edges);
+        if (region->number_of_edges == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        base_u = def_line->x0 * ux + def_line->y0 * uy;
+        base_v = -def_line->x0 * uy + def_line->y0 * ux;
+        first = ceil ((v_min - base_v) / family->spacing);
+        lines = floor ((v_max - base_v) / family->spacing) - first + 1.0;
+        if (lines > DXF_HATCH_FILL_MAX_LINES)
+        {
+                return (EXIT_FAILURE);
+        }
+        family->first_v = base_v + first * family->spacing;
+        family->first_origin = base_u + first * family->shift;
+        family->number_of_lines = (lines > 0.0) ? (size_t) lines : 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Generate the line segments of a hatch pattern inside a hatch
+ * region, on one or more threads.
+ *
+ * Every pattern definition line gives a family of lines at its angle
+ * (in degrees) through its base point, successive lines are offset by
+ * its offset vector.\n
+ * The dash lengths are laid along each line starting at the base point,
+ * positive lengths are dashes, negative lengths gaps and lengths of 0.0
+ * dots.\n
+ * The pattern definition lines are taken as stored in the \c HATCH
+ * entity, which are already scaled and rotated.\n
+ * The segments are added to the hatch fill, in the coordinates of the
+ * region.\n
+ * The lines are clipped on the calling thread only when the C library
+ * allocator is not in use, as the buffers of the threads are allocated
+ * in the threads and freed in the calling thread.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_generate
+(
+        DxfHatchFill *fill,
+                /*!< a pointer to the hatch fill. */
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        DxfHatchPatternDefLine *def_lines,
+                /*!< a pointer to the first pattern definition line. */
+        int number_of_threads
+                /*!< number of threads, or 0 for the number of online
+                 * processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchFillJob jobs[DXF_HATCH_FILL_MAX_THREADS];
+        pthread_t threads[DXF_HATCH_FILL_MAX_THREADS];
+        int started[DXF_HATCH_FILL_MAX_THREADS];
+        DxfHatchFillFamily *families = NULL;
+        DxfHatchPatternDefLine *def_line;
+        size_t number_of_lines = 0;
+        size_t total = 0;
+        int number_of_families;
+        int result = EXIT_SUCCESS;
+        int f;
+        int k;
+
+        if ((fill == NULL) || (region == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        if (number_of_threads > DXF_HATCH_FILL_MAX_THREADS)
+        {
+                number_of_threads = DXF_HATCH_FILL_MAX_THREADS;
+        }
+        if ((number_of_threads < 1)
+          || (!dxf_allocator_is_system ()))
+        {
+                number_of_threads = 1;
+        }
+        for (number_of_families = 0, def_line = def_lines;
+          def_line != NULL;
+          def_line = (DxfHatchPatternDefLine *) def_line->next, number_of_families++);
+        if (number_of_families == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        families = dxf_malloc (number_of_families * sizeof (DxfHatchFillFamily));
+        if (families == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the pattern lines.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (families, 0, number_of_families * sizeof (DxfHatchFillFamily));
+        for (f = 0, def_line = def_lines; f < number_of_families;
+          f++, def_line = (DxfHatchPatternDefLine *) def_line->next)
+        {
+                if (dxf_hatch_fill_family_init (families + f, region, def_line) != EXIT_SUCCESS)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () pattern definition line %d has no spacing, too many lines or could not be allocated.\n")),
+                          __FUNCTION__, f);
+                        result = EXIT_FAILURE;
+                        number_of_families = f + 1;
+                        break;
+                }
+                number_of_lines += families[f].number_of_lines;
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                /* Split the lines of all families in equal ranges. */
+                for (k = 0; k < number_of_threads; k++)
+                {
+                        memset (&jobs[k], 0, sizeof (DxfHatchFillJob));
+                        jobs[k].region = region;
+                        jobs[k].families = families;
+                        jobs[k].number_of_families = number_of_families;
+                        jobs[k].first = number_of_lines * k / number_of_threads;
+                        jobs[k].last = number_of_lines * (k + 1) / number_of_threads;
+                }
+                for (k = 1; k < number_of_threads; k++)
+                {
+                        started[k] = (jobs[k].first < jobs[k].last)
+                          && (pthread_create (&threads[k], NULL, dxf_hatch_fill_run_job, &jobs[k]) == 0);
+                }
+                dxf_hatch_fill_run_job (&jobs[0]);
+                for (k = 1; k < number_of_threads; k++)
+                {
+                        if (started[k])
+                        {
+                                pthread_join (threads[k], NULL);
+                        }
+                        else
+                        {
+                                dxf_hatch_fill_run_job (&jobs[k]);
+                        }
+                }
+                /* Append the segments in the order of the lines. */
+                for (k = 0; k < number_of_threads; k++)
+                {
+                        total += jobs[k].fill.number_of_segments;
+                        if (jobs[k].result != EXIT_SUCCESS)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                }
+                if ((result == EXIT_SUCCESS)
+                  && (dxf_hatch_fill_reserve (fill, total) == EXIT_SUCCESS))
+                {
+                        for (k = 0; k < number_of_threads; k++)
+                        {
+                                memcpy (fill->segments + 4 * fill->number_of_segments,
+                                  jobs[k].fill.segments,
+                                  4 * jobs[k].fill.number_of_segments * sizeof (double));
+                                fill->number_of_segments += jobs[k].fill.number_of_segments;
+                        }
+                }
+                else
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for the segments.\n")),
+                          __FUNCTION__);
+                        result = EXIT_FAILURE;
+                }
+                for (k = 0; k < number_of_threads; k++)
+                {
+                        dxf_free (jobs[k].fill.segments);
+                }
+        }
+        for (f = 0; f < number_of_families; f++)
+        {
+                dxf_free (families[f].edges);
+        }
+        dxf_free (families);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Generate the line segments of the pattern of a DXF \c HATCH
+ * entity.
+ *
+ * The pattern definition lines of the hatch are used, or else those of
+ * its first pattern.\n
+ * A solid fill has no segments.\n
+ * The segments are in the object coordinate system of the hatch.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_set_hatch
+(
+        DxfHatchFill *fill,
+                /*!< a pointer to the hatch fill. */
+        DxfHatch *hatch,
+                /*!< a pointer to the DXF \c HATCH entity. */
+        double tolerance,
+                /*!< maximum distance between a curved boundary edge and
+                 * its line segments. */
+        int number_of_threads
+                /*!< number of threads, or 0 for the number of online
+                 * processors. */
+)
+{
+        DxfHatchRegion *region;
+        DxfHatchPatternDefLine *def_lines;
+        int result;
+
+        if ((fill == NULL) || (hatch == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_hatch_fill_clear (fill);
+        def_lines = (DxfHatchPatternDefLine *) hatch->def_lines;
+        if ((def_lines == NULL) && (hatch->patterns != NULL))
+        {
+                def_lines = (DxfHatchPatternDefLine *) ((DxfHatchPattern *) hatch->patterns)->def_lines;
+        }
+        if ((hatch->solid_fill == 1) || (def_lines == NULL))
+        {
+                return (EXIT_SUCCESS);
+        }
+        if ((region = dxf_hatch_region_new (tolerance)) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        result = dxf_hatch_region_set_hatch (region, hatch);
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_hatch_fill_generate (fill, region, def_lines,
+                  number_of_threads);
+        }
+        dxf_hatch_region_free (region);
+        return (result);
+}
+
+
+/*!
+ * \brief Get the number of segments of a hatch fill.
+ *
+ * \return the number of segments.
+ */
+size_t
+dxf_hatch_fill_get_number_of_segments
+(
+        DxfHatchFill *fill
+                /*!< a pointer to the hatch fill. */
+)
+{
+        if (fill == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (fill->number_of_segments);
+}
+
+
+/*!
+ * \brief Get the coordinates of the segments of a hatch fill, x0, y0,
+ * x1, y1 per segment.
+ *
+ * \return a pointer to the coordinates, or \c NULL when an error
+ * occurred.
+ */
+const double *
+dxf_hatch_fill_get_segments
+(
+        DxfHatchFill *fill
+                /*!< a pointer to the hatch fill. */
+)
+{
+        if (fill == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        return (fill->segments);
+}
+
+
+/* EOF */
@@ -0,0 +1,94 @@
+/*!
+ * \file hatch_fill.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF generation of the line segments of a
+ * \c HATCH pattern.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_HATCH_FILL_H
+#define LIBDXF_SRC_HATCH_FILL_H
+
+
+#include "global.h"
+#include "hatch.h"
+#include "hatch_region.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_HATCH_FILL_MAX_THREADS 64
+        /*!< \brief Maximum number of threads of
+         * \c dxf_hatch_fill_generate (). */
+
+#define DXF_HATCH_FILL_MAX_LINES 10000000
+        /*!< \brief Maximum number of pattern lines of one pattern
+         * definition line crossing a region. */
+
+
+/*!
+ * \brief Line segments of a hatch pattern, clipped to a hatch region.
+ *
+ * Dots (dashes of length 0.0) are segments with equal end points.
+ */
+typedef struct
+dxf_hatch_fill_struct
+{
+        double *segments;
+                /*!< Coordinates of the segments, x0, y0, x1, y1 per
+                 * segment. */
+        size_t number_of_segments;
+                /*!< Number of segments. */
+        size_t capacity;
+                /*!< Number of segments allocated. */
+} DxfHatchFill;
+
+
+DxfHatchFill *dxf_hatch_fill_new ();
+int dxf_hatch_fill_free (DxfHatchFill *fill);
+int dxf_hatch_fill_clear (DxfHatchFill *fill);
+int dxf_hatch_fill_generate (DxfHatchFill *fill, DxfHatchRegion *region, DxfHatchPatternDefLine *def_lines, int number_of_threads);
+int dxf_hatch_fill_set_hatch (DxfHatchFill *fill, DxfHatch *hatch, double tolerance, int number_of_threads);
+size_t dxf_hatch_fill_get_number_of_segments (DxfHatchFill *fill);
+const double *dxf_hatch_fill_get_segments (DxfHatchFill *fill);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_HATCH_FILL_H */
+
+
+/* EOF */
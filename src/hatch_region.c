@@ -0,0 +1,1002 @@
+/*!
+ * \file hatch_region.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF point classification against the
+ * boundary paths of a \c HATCH entity.
+ *
+ * Polyline boundaries (with bulges) and edge boundaries (lines, arcs,
+ * elliptic arcs and splines) are flattened into line segments within a
+ * tolerance.\n
+ * A point is classified by the winding number of the segments about
+ * the point, counting only the segments of its horizontal band.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "hatch_region.h"
+
+
+#define DXF_HATCH_REGION_MAX_SEGMENTS 4096
+        /*!< \brief Maximum number of line segments of a curved edge. */
+
+
+/*!
+ * \brief Allocate memory for a hatch region.
+ *
+ * \return a pointer to the hatch region, or \c NULL when an error
+ * occurred.
+ */
+DxfHatchRegion *
+dxf_hatch_region_new
+(
+        double tolerance
+                /*!< maximum distance between a curved edge and its line
+                 * segments. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchRegion *region = NULL;
+        size_t size;
+
+        if (!(tolerance > 0.0))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a tolerance which is not positive was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        size = sizeof (DxfHatchRegion);
+        if ((region = dxf_malloc (size)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfHatchRegion struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (region, 0, size);
+        region->tolerance = tolerance;
+        dxf_hatch_region_clear (region);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (region);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a hatch region.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_region_free
+(
+        DxfHatchRegion *region
+                /*!< a pointer to the hatch region. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (region == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (region->nurbs != NULL)
+        {
+                dxf_nurbs_free (region->nurbs);
+        }
+        dxf_free (region->edges);
+        dxf_free (region->band_start);
+        dxf_free (region->band_edges);
+        dxf_free (region->points);
+        dxf_free (region);
+        region = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all loops from a hatch region, the memory is kept for
+ * reuse.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_region_clear
+(
+        DxfHatchRegion *region
+                /*!< a pointer to the hatch region. */
+)
+{
+        if (region == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        region->number_of_edges = 0;
+        region->loop_start = 0;
+        region->loop_area = 0.0;
+        region->min_x = HUGE_VAL;
+        region->min_y = HUGE_VAL;
+        region->max_x = -HUGE_VAL;
+        region->max_y = -HUGE_VAL;
+        region->number_of_bands = 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a line segment to the loop being added.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_region_add_segment
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1
+                /*!< Y-value of the end point. */
+)
+{
+        DxfHatchRegionEdge *edge;
+        size_t capacity;
+
+        region->loop_area += x0 * y1 - x1 * y0;
+        region->min_x = (x0 < region->min_x) ? x0 : region->min_x;
+        region->min_x = (x1 < region->min_x) ? x1 : region->min_x;
+        region->max_x = (x0 > region->max_x) ? x0 : region->max_x;
+        region->max_x = (x1 > region->max_x) ? x1 : region->max_x;
+        region->min_y = (y0 < region->min_y) ? y0 : region->min_y;
+        region->min_y = (y1 < region->min_y) ? y1 : region->min_y;
+        region->max_y = (y0 > region->max_y) ? y0 : region->max_y;
+        region->max_y = (y1 > region->max_y) ? y1 : region->max_y;
+        if (region->number_of_edges == region->capacity)
+        {
+                capacity = (region->capacity == 0) ? 256 : 2 * region->capacity;
+                edge = dxf_realloc (region->edges, capacity * sizeof (DxfHatchRegionEdge));
+                if (edge == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                region->edges = edge;
+                region->capacity = capacity;
+        }
+        edge = region->edges + region->number_of_edges;
+        if (y0 <= y1)
+        {
+                edge->x0 = x0;
+                edge->y0 = y0;
+                edge->x1 = x1;
+                edge->y1 = y1;
+                edge->direction = 1;
+        }
+        else
+        {
+                edge->x0 = x1;
+                edge->y0 = y1;
+                edge->x1 = x0;
+                edge->y1 = y0;
+                edge->direction = -1;
+        }
+        region->number_of_edges++;
+        region->number_of_bands = 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Start a new loop.
+ */
+static void
+dxf_hatch_region_begin_loop
+(
+        DxfHatchRegion *region
+                /*!< a pointer to the hatch region. */
+)
+{
+        region->loop_start = region->number_of_edges;
+        region->loop_area = 0.0;
+}
+
+
+/*!
+ * \brief Finish a loop, turning it counter clockwise.
+ */
+static void
+dxf_hatch_region_end_loop
+(
+        DxfHatchRegion *region
+                /*!< a pointer to the hatch region. */
+)
+{
+        size_t i;
+
+        if (region->loop_area < 0.0)
+        {
+                for (i = region->loop_start; i < region->number_of_edges; i++)
+                {
+                        region->edges[i].direction = -region->edges[i].direction;
+                }
+        }
+        region->loop_start = region->number_of_edges;
+        region->loop_area = 0.0;
+}
+
+
+/*!
+ * \brief Get the number of line segments for an arc of an ellipse or a
+ * circle within the tolerance.
+ *
+ * \return the number of segments, at least 1.
+ */
+static int
+dxf_hatch_region_get_number_of_segments
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        double radius,
+                /*!< (largest) radius of the arc. */
+        double sweep
+                /*!< included angle of the arc in radians. */
+)
+{
+        double step = M_PI / 4.0;
+        double angle;
+        double number_of_segments;
+
+        if (radius > region->tolerance)
+        {
+                /* The chord error of a segment spanning angle a is
+                 * radius * (1 - cos (a / 2)). */
+                angle = 2.0 * acos (1.0 - region->tolerance / radius);
+                step = (angle < step) ? angle : step;
+        }
+        number_of_segments = ceil (fabs (sweep) / step - 1e-9);
+        if (number_of_segments < 1.0)
+        {
+                return (1);
+        }
+        if (number_of_segments > DXF_HATCH_REGION_MAX_SEGMENTS)
+        {
+                return (DXF_HATCH_REGION_MAX_SEGMENTS);
+        }
+        return ((int) number_of_segments);
+}
+
+
+/*!
+ * \brief Add an arc of an ellipse, or of a circle when the axes are
+ * perpendicular and of equal length, to the loop being added.
+ *
+ * The point at angle t is center + major axis * cos (t) + minor axis *
+ * sin (t).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_region_add_arc
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        double xc,
+                /*!< X-value of the center point. */
+        double yc,
+                /*!< Y-value of the center point. */
+        double xa,
+                /*!< X-value of the major axis. */
+        double ya,
+                /*!< Y-value of the major axis. */
+        double xb,
+                /*!< X-value of the minor axis. */
+        double yb,
+                /*!< Y-value of the minor axis. */
+        double start,
+                /*!< start angle in radians. */
+        double sweep
+                /*!< included angle in radians, negative for a clockwise
+                 * arc. */
+)
+{
+        double x0;
+        double y0;
+        double x1;
+        double y1;
+        double t;
+        int number_of_segments;
+        int i;
+
+        number_of_segments = dxf_hatch_region_get_number_of_segments (region,
+          sqrt (xa * xa + ya * ya), sweep);
+        x0 = xc + xa * cos (start) + xb * sin (start);
+        y0 = yc + ya * cos (start) + yb * sin (start);
+        for (i = 1; i <= number_of_segments; i++)
+        {
+                t = start + sweep * i / number_of_segments;
+                x1 = xc + xa * cos (t) + xb * sin (t);
+                y1 = yc + ya * cos (t) + yb * sin (t);
+                if (dxf_hatch_region_add_segment (region, x0, y0, x1, y1) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+                x0 = x1;
+                y0 = y1;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the included angle of a hatch edge arc or elliptic arc.
+ *
+ * Clockwise arcs store their angles mirrored in the X-axis, their
+ * start angle is the negated \c start_angle.
+ *
+ * \return the included angle in radians, negative for a clockwise arc.
+ */
+static double
+dxf_hatch_region_get_sweep
+(
+        double start_angle,
+                /*!< start angle in degrees. */
+        double end_angle,
+                /*!< end angle in degrees. */
+        int is_ccw
+                /*!< counter clockwise flag. */
+)
+{
+        double sweep;
+
+        sweep = fmod (end_angle - start_angle, 360.0);
+        if (sweep <= 0.0)
+        {
+                sweep += 360.0;
+        }
+        sweep = sweep * M_PI / 180.0;
+        return (is_ccw ? sweep : -sweep);
+}
+
+
+/*!
+ * \brief Add a hatch boundary path polyline as a loop.
+ *
+ * The polyline is closed from its last vertex to its first vertex.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_region_add_polyline
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        DxfHatchBoundaryPathPolyline *polyline
+                /*!< a pointer to the boundary path polyline. */
+)
+{
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        DxfHatchBoundaryPathPolylineVertex *next;
+        double dx;
+        double dy;
+        double offset;
+        double xc;
+        double yc;
+        double bulge;
+        int result = EXIT_SUCCESS;
+
+        if ((region == NULL) || (polyline == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_hatch_region_begin_loop (region);
+        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+          (vertex != NULL) && (result == EXIT_SUCCESS);
+          vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+        {
+                next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                if (next == NULL)
+                {
+                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                }
+                dx = next->x0 - vertex->x0;
+                dy = next->y0 - vertex->y0;
+                bulge = vertex->bulge;
+                if ((dx == 0.0) && (dy == 0.0))
+                {
+                        continue;
+                }
+                if (bulge == 0.0)
+                {
+                        result = dxf_hatch_region_add_segment (region,
+                          vertex->x0, vertex->y0, next->x0, next->y0);
+                        continue;
+                }
+                /* The bulge is the tangent of a quarter of the included
+                 * angle, the center lies (1 - bulge^2) / (4 bulge)
+                 * chord lengths left of the middle of the chord. */
+                offset = (1.0 - bulge * bulge) / (4.0 * bulge);
+                xc = 0.5 * (vertex->x0 + next->x0) - dy * offset;
+                yc = 0.5 * (vertex->y0 + next->y0) + dx * offset;
+                result = dxf_hatch_region_add_arc (region, xc, yc,
+                  vertex->x0 - xc, vertex->y0 - yc,
+                  -(vertex->y0 - yc), vertex->x0 - xc,
+                  0.0, 4.0 * atan (bulge));
+        }
+        dxf_hatch_region_end_loop (region);
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the edges.\n")),
+                  __FUNCTION__);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Add a spline edge to the loop being added.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_hatch_region_add_spline
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        DxfHatchBoundaryPathEdgeSpline *spline
+                /*!< a pointer to the spline edge. */
+)
+{
+        double *points;
+        size_t count;
+        size_t i;
+
+        if ((region->nurbs == NULL)
+          && ((region->nurbs = dxf_nurbs_new ()) == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_nurbs_set_hatch_spline (region->nurbs, spline) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        count = dxf_nurbs_flatten (region->nurbs, region->tolerance, NULL);
+        if (count > region->points_capacity)
+        {
+                points = dxf_realloc (region->points, 3 * count * sizeof (double));
+                if (points == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                region->points = points;
+                region->points_capacity = count;
+        }
+        dxf_nurbs_flatten (region->nurbs, region->tolerance, region->points);
+        points = region->points;
+        for (i = 1; i < count; i++)
+        {
+                if (dxf_hatch_region_add_segment (region, points[3 * i - 3],
+                  points[3 * i - 2], points[3 * i], points[3 * i + 1]) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a chain of hatch boundary path edges as one loop.
+ *
+ * Every edge keeps its own direction, so the order of the lines, arcs,
+ * elliptic arcs and splines in their lists does not matter.\n
+ * The angles of elliptic arcs are taken as parameters of the ellipse.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_region_add_edges
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        DxfHatchBoundaryPathEdge *edges
+                /*!< a pointer to the first boundary path edge. */
+)
+{
+        DxfHatchBoundaryPathEdge *edge;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeArc *arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+        double start;
+        int result = EXIT_SUCCESS;
+
+        if ((region == NULL) || (edges == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_hatch_region_begin_loop (region);
+        for (edge = edges;
+          (edge != NULL) && (result == EXIT_SUCCESS);
+          edge = (DxfHatchBoundaryPathEdge *) edge->next)
+        {
+                for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines;
+                  (line != NULL) && (result == EXIT_SUCCESS);
+                  line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                {
+                        result = dxf_hatch_region_add_segment (region,
+                          line->x0, line->y0, line->x1, line->y1);
+                }
+                for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs;
+                  (arc != NULL) && (result == EXIT_SUCCESS);
+                  arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                {
+                        start = arc->start_angle * M_PI / 180.0;
+                        result = dxf_hatch_region_add_arc (region,
+                          arc->x0, arc->y0, arc->radius, 0.0, 0.0, arc->radius,
+                          arc->is_ccw ? start : -start,
+                          dxf_hatch_region_get_sweep (arc->start_angle,
+                          arc->end_angle, arc->is_ccw));
+                }
+                for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses;
+                  (ellipse != NULL) && (result == EXIT_SUCCESS);
+                  ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                {
+                        start = ellipse->start_angle * M_PI / 180.0;
+                        result = dxf_hatch_region_add_arc (region,
+                          ellipse->x0, ellipse->y0, ellipse->x1, ellipse->y1,
+                          -ellipse->ratio * ellipse->y1, ellipse->ratio * ellipse->x1,
+                          ellipse->is_ccw ? start : -start,
+                          dxf_hatch_region_get_sweep (ellipse->start_angle,
+                          ellipse->end_angle, ellipse->is_ccw));
+                }
+                for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines;
+                  (spline != NULL) && (result == EXIT_SUCCESS);
+                  spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                {
+                        result = dxf_hatch_region_add_spline (region, spline);
+                }
+        }
+        dxf_hatch_region_end_loop (region);
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not add the edges.\n")),
+                  __FUNCTION__);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Add a hatch boundary path, each of its polylines is a loop and
+ * its edges together are one loop.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_region_add_path
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        DxfHatchBoundaryPath *path
+                /*!< a pointer to the boundary path. */
+)
+{
+        DxfHatchBoundaryPathPolyline *polyline;
+
+        if ((region == NULL) || (path == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+          polyline != NULL;
+          polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+        {
+                if (dxf_hatch_region_add_polyline (region, polyline) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if ((path->edges != NULL)
+          && (dxf_hatch_region_add_edges (region,
+          (DxfHatchBoundaryPathEdge *) path->edges) != EXIT_SUCCESS))
+        {
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set a hatch region to the boundary paths and the hatch style
+ * of a DXF \c HATCH entity, and build its band table.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_region_set_hatch
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        DxfHatch *hatch
+                /*!< a pointer to the DXF \c HATCH entity. */
+)
+{
+        DxfHatchBoundaryPath *path;
+
+        if ((region == NULL) || (hatch == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_hatch_region_clear (region);
+        region->hatch_style = hatch->hatch_style;
+        for (path = (DxfHatchBoundaryPath *) hatch->paths;
+          path != NULL;
+          path = (DxfHatchBoundaryPath *) path->next)
+        {
+                if (dxf_hatch_region_add_path (region, path) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (dxf_hatch_region_build (region));
+}
+
+
+/*!
+ * \brief Get the band of a Y-value.
+ *
+ * \return the index of the band.
+ */
+static int
+dxf_hatch_region_get_band
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        double y
+                /*!< Y-value. */
+)
+{
+        double band = floor ((y - region->min_y) / region->band_height);
+
+        if (band < 0.0)
+        {
+                return (0);
+        }
+        if (band >= region->number_of_bands)
+        {
+                return (region->number_of_bands - 1);
+        }
+        return ((int) band);
+}
+
+
+/*!
+ * \brief Build the table of the segments crossing each horizontal band.
+ *
+ * The table is built by the first query after loops were added, build
+ * it explicitly before querying a region from more than one thread.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_region_build
+(
+        DxfHatchRegion *region
+                /*!< a pointer to the hatch region. */
+)
+{
+        DxfHatchRegionEdge *edge;
+        size_t *band_start;
+        size_t *band_edges;
+        size_t total;
+        size_t i;
+        int number_of_bands;
+        int b;
+        int b1;
+
+        if (region == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        number_of_bands = (region->number_of_edges > DXF_HATCH_REGION_MAX_BANDS)
+          ? DXF_HATCH_REGION_MAX_BANDS : (int) region->number_of_edges;
+        if ((number_of_bands < 1) || !(region->max_y > region->min_y))
+        {
+                number_of_bands = 1;
+        }
+        band_start = dxf_realloc (region->band_start, (number_of_bands + 1) * sizeof (size_t));
+        if (band_start == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the band table.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        region->band_start = band_start;
+        region->number_of_bands = number_of_bands;
+        region->band_height = (region->max_y > region->min_y)
+          ? (region->max_y - region->min_y) / number_of_bands : 1.0;
+        /* Count the segments per band, shifted by one band. */
+        memset (band_start, 0, (number_of_bands + 1) * sizeof (size_t));
+        for (i = 0; i < region->number_of_edges; i++)
+        {
+                edge = region->edges + i;
+                /* Horizontal segments never cross a horizontal ray. */
+                if (edge->y0 == edge->y1)
+                {
+                        continue;
+                }
+                b1 = dxf_hatch_region_get_band (region, edge->y1);
+                for (b = dxf_hatch_region_get_band (region, edge->y0); b <= b1; b++)
+                {
+                        band_start[b + 1]++;
+                }
+        }
+        for (b = 0; b < number_of_bands; b++)
+        {
+                band_start[b + 1] += band_start[b];
+        }
+        total = band_start[number_of_bands];
+        if (total > region->band_edges_capacity)
+        {
+                band_edges = dxf_realloc (region->band_edges, total * sizeof (size_t));
+                if (band_edges == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for the band table.\n")),
+                          __FUNCTION__);
+                        region->number_of_bands = 0;
+                        return (EXIT_FAILURE);
+                }
+                region->band_edges = band_edges;
+                region->band_edges_capacity = total;
+        }
+        /* Fill the bands, using the start of each band as its cursor,
+         * then shift the starts back. */
+        for (i = 0; i < region->number_of_edges; i++)
+        {
+                edge = region->edges + i;
+                if (edge->y0 == edge->y1)
+                {
+                        continue;
+                }
+                b1 = dxf_hatch_region_get_band (region, edge->y1);
+                for (b = dxf_hatch_region_get_band (region, edge->y0); b <= b1; b++)
+                {
+                        region->band_edges[band_start[b]++] = i;
+                }
+        }
+        for (b = number_of_bands; b > 0; b--)
+        {
+                band_start[b] = band_start[b - 1];
+        }
+        band_start[0] = 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of loops of a hatch region holding a point.
+ *
+ * \return the winding number of the counter clockwise loops about the
+ * point, or -1 when an error occurred.
+ */
+int
+dxf_hatch_region_get_depth
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        double x,
+                /*!< X-value of the point. */
+        double y
+                /*!< Y-value of the point. */
+)
+{
+        DxfHatchRegionEdge *edge;
+        size_t i;
+        size_t last;
+        int band;
+        int winding = 0;
+
+        if (region == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((region->number_of_bands == 0)
+          && (dxf_hatch_region_build (region) != EXIT_SUCCESS))
+        {
+                return (-1);
+        }
+        if ((region->number_of_edges == 0)
+          || (y < region->min_y) || (y >= region->max_y) || (x >= region->max_x))
+        {
+                return (0);
+        }
+        band = dxf_hatch_region_get_band (region, y);
+        last = region->band_start[band + 1];
+        for (i = region->band_start[band]; i < last; i++)
+        {
+                edge = region->edges + region->band_edges[i];
+                if ((edge->y0 <= y) && (y < edge->y1)
+                  && (edge->x0 + (y - edge->y0) * (edge->x1 - edge->x0) / (edge->y1 - edge->y0) > x))
+                {
+                        winding += edge->direction;
+                }
+        }
+        return (winding);
+}
+
+
+/*!
+ * \brief Test if a depth is hatched in the hatch style of a hatch
+ * region.
+ *
+ * Odd depths are hatched for the Normal style, depth 1 for the Outer
+ * style and any depth for the Ignore style.
+ *
+ * \return \c TRUE when the depth is hatched, \c FALSE otherwise.
+ */
+int
+dxf_hatch_region_depth_is_hatched
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        int depth
+                /*!< number of loops holding a point. */
+)
+{
+        switch (region->hatch_style)
+        {
+                case 1:
+                        return (depth == 1);
+                case 2:
+                        return (depth >= 1);
+                default:
+                        return ((depth % 2) != 0);
+        }
+}
+
+
+/*!
+ * \brief Test if a point lies in the hatched area of a hatch region.
+ *
+ * \return \c INSIDE or \c OUTSIDE, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_region_point_inside
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        double x,
+                /*!< X-value of the point. */
+        double y
+                /*!< Y-value of the point. */
+)
+{
+        int depth;
+
+        depth = dxf_hatch_region_get_depth (region, x, y);
+        if (depth < 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        return (dxf_hatch_region_depth_is_hatched (region, depth) ? INSIDE : OUTSIDE);
+}
+
+
+/*!
+ * \brief Classify a batch of points against a hatch region.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_region_classify
+(
+        DxfHatchRegion *region,
+                /*!< a pointer to the hatch region. */
+        const double *points,
+                /*!< the points, 2 values per point. */
+        size_t number_of_points,
+                /*!< number of points. */
+        int *results
+                /*!< \c INSIDE or \c OUTSIDE for each point. */
+)
+{
+        size_t i;
+
+        if ((region == NULL) || (points == NULL) || (results == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((region->number_of_bands == 0)
+          && (dxf_hatch_region_build (region) != EXIT_SUCCESS))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_of_points; i++)
+        {
+                results[i] = dxf_hatch_region_point_inside (region,
+                  points[2 * i], points[2 * i + 1]);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,168 @@
+/*!
+ * \file hatch_region.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF point classification against the
+ * boundary paths of a \c HATCH entity.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_HATCH_REGION_H
+#define LIBDXF_SRC_HATCH_REGION_H
+
+
+#include "global.h"
+#include "hatch.h"
+#include "nurbs.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_HATCH_REGION_DEFAULT_TOLERANCE 0.001
+        /*!< \brief Default maximum distance between a curved boundary
+         * edge and its line segments, in drawing units. */
+
+#define DXF_HATCH_REGION_MAX_BANDS 65536
+        /*!< \brief Maximum number of horizontal bands of the edge
+         * table. */
+
+
+/*!
+ * \brief A line segment of a boundary path, with its lowest end point
+ * first.
+ *
+ * Horizontal segments keep the order of their loop, they are not used
+ * by point queries but are needed to clip lines at other angles.
+ */
+typedef struct
+dxf_hatch_region_edge_struct
+{
+        double x0;
+                /*!< X-value of the lowest end point. */
+        double y0;
+                /*!< Y-value of the lowest end point. */
+        double x1;
+                /*!< X-value of the highest end point. */
+        double y1;
+                /*!< Y-value of the highest end point. */
+        int direction;
+                /*!< +1 when the loop runs from the first to the second
+                 * end point, -1 when it runs back, after all loops are
+                 * turned counter clockwise. */
+} DxfHatchRegionEdge;
+
+
+/*!
+ * \brief The boundary paths of a hatch, prepared for point
+ * classification.
+ *
+ * Every loop is flattened into line segments and turned counter
+ * clockwise, so the winding number about a point counts the loops
+ * holding the point.\n
+ * The segments are listed per horizontal band, so a query only visits
+ * the segments crossing the band of the point.
+ */
+typedef struct
+dxf_hatch_region_struct
+{
+        double tolerance;
+                /*!< Maximum distance between a curved edge and its line
+                 * segments. */
+        int hatch_style;
+                /*!< 0 = odd parity (Normal style)\n
+                 * 1 = outermost area only (Outer style)\n
+                 * 2 = entire area (Ignore style). */
+        DxfHatchRegionEdge *edges;
+                /*!< Line segments of all loops. */
+        size_t number_of_edges;
+                /*!< Number of line segments. */
+        size_t capacity;
+                /*!< Number of line segments allocated. */
+        size_t loop_start;
+                /*!< Index of the first line segment of the loop being
+                 * added. */
+        double loop_area;
+                /*!< Twice the signed area of the loop being added,
+                 * positive when counter clockwise. */
+        double min_x;
+                /*!< Lowest X-value of the segments. */
+        double min_y;
+                /*!< Lowest Y-value of the segments. */
+        double max_x;
+                /*!< Highest X-value of the segments. */
+        double max_y;
+                /*!< Highest Y-value of the segments. */
+        int number_of_bands;
+                /*!< Number of horizontal bands, 0 when the band table
+                 * has to be (re)built. */
+        double band_height;
+                /*!< Height of a band. */
+        size_t *band_start;
+                /*!< Index in \c band_edges of the first segment of
+                 * each band, \c number_of_bands + 1 values. */
+        size_t *band_edges;
+                /*!< Indices of the segments crossing each band. */
+        size_t band_edges_capacity;
+                /*!< Number of indices allocated in \c band_edges. */
+        DxfNurbs *nurbs;
+                /*!< Work space for spline edges. */
+        double *points;
+                /*!< Work space for flattened spline edges, 3 values per
+                 * point. */
+        size_t points_capacity;
+                /*!< Number of points allocated. */
+} DxfHatchRegion;
+
+
+DxfHatchRegion *dxf_hatch_region_new (double tolerance);
+int dxf_hatch_region_free (DxfHatchRegion *region);
+int dxf_hatch_region_clear (DxfHatchRegion *region);
+int dxf_hatch_region_add_polyline (DxfHatchRegion *region, DxfHatchBoundaryPathPolyline *polyline);
+int dxf_hatch_region_add_edges (DxfHatchRegion *region, DxfHatchBoundaryPathEdge *edges);
+int dxf_hatch_region_add_path (DxfHatchRegion *region, DxfHatchBoundaryPath *path);
+int dxf_hatch_region_set_hatch (DxfHatchRegion *region, DxfHatch *hatch);
+int dxf_hatch_region_build (DxfHatchRegion *region);
+int dxf_hatch_region_get_depth (DxfHatchRegion *region, double x, double y);
+int dxf_hatch_region_depth_is_hatched (DxfHatchRegion *region, int depth);
+int dxf_hatch_region_point_inside (DxfHatchRegion *region, double x, double y);
+int dxf_hatch_region_classify (DxfHatchRegion *region, const double *points, size_t number_of_points, int *results);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_HATCH_REGION_H */
+
+
+/* EOF */
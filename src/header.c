@@ -67,9 +67,9 @@ dxf_header_new ()
         size = sizeof (DxfHeader);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((header = malloc (size)) == NULL)
+        if ((header = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHeader struct.\n")),
                   __FUNCTION__);
                 header = NULL;
@@ -136,7 +136,7 @@ dxf_header_acad_version_from_string
 #endif
         if (version_string == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -202,14 +202,14 @@ dxf_header_init
         /* Do some basic checks. */
         if (header == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 header = dxf_header_new ();
         }
         if (header == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHeader struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -226,12 +226,12 @@ dxf_header_init
                         header->AttDia = 0;
                         header->AttReq = 1;
                         header->Handling = 1;
-                        header->HandSeed = strdup ("233");
+                        header->HandSeed = dxf_strdup ("233");
 
                 }
                 case AC1012: /* AutoCAD 13 */
                 {
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->DragMode = 2;
                         header->OSMode = 125;
                         header->CELTScale = 1.0;
@@ -251,7 +251,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->BlipMode = 0;
                         header->ChamferC = 10.0;
@@ -260,10 +260,10 @@ dxf_header_init
                         header->AttDia = 0;
                         header->AttReq = 1;
                         header->Handling = 1;
-                        header->HandSeed = strdup ("233");
+                        header->HandSeed = dxf_strdup ("233");
                         header->TreeDepth = 3020;
                         header->PickStyle = 1;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->SaveImages = 1;
@@ -271,7 +271,7 @@ dxf_header_init
                 case AC1014: /* AutoCAD 14 */
                 {
                         header->AcadMaintVer = 0;
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->DragMode = 2;
                         header->OSMode = 125;
                         header->CELTScale = 1.0;
@@ -291,7 +291,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->BlipMode = 0;
                         header->ChamferC = 10.0;
@@ -300,19 +300,21 @@ dxf_header_init
                         header->AttDia = 0;
                         header->AttReq = 1;
                         header->Handling = 1;
-                        header->HandSeed = strdup ("262");
+                        header->HandSeed = dxf_strdup ("262");
                         header->TreeDepth = 3020;
                         header->PickStyle = 1;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->ProxyGraphics = 1;
                         header->Measurement = 0;
                 }
                 case AC1015: /* AutoCAD 2000 */
+                case AC1016: /* AutoCAD 2000i */
+                case AC1017: /* AutoCAD 2002 */
                 {
                         header->AcadMaintVer = 20;
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->CELTScale = 1.0;
                         header->DispSilH = 0;
                         header->DimJUST = 0;
@@ -327,7 +329,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->DimADEC = 0;
                         header->DimALTRND = 0.0;
@@ -335,7 +337,7 @@ dxf_header_init
                         header->DimDSEP = 46;
                         header->DimATFIT = 3;
                         header->DimFRAC = 0;
-                        header->DimLDRBLK = strdup ("");
+                        header->DimLDRBLK = dxf_strdup ("");
                         header->DimLUNIT = 2;
                         header->DimLWD = -2;
                         header->DimLWE = -2;
@@ -344,9 +346,9 @@ dxf_header_init
                         header->ChamferD = 10.0;
                         header->TDUCreate = 0.0;
                         header->TDUUpdate = 0.0;
-                        header->HandSeed = strdup ("274");
-                        header->UCSBase = strdup ("");
-                        header->UCSOrthoRef = strdup ("");
+                        header->HandSeed = dxf_strdup ("274");
+                        header->UCSBase = dxf_strdup ("");
+                        header->UCSOrthoRef = dxf_strdup ("");
                         header->UCSOrthoView = 0;
                         header->UCSOrgTop.x0 = 0.0;
                         header->UCSOrgTop.y0 = 0.0;
@@ -366,8 +368,8 @@ dxf_header_init
                         header->UCSOrgBack.x0 = 0.0;
                         header->UCSOrgBack.y0 = 0.0;
                         header->UCSOrgBack.z0 = 0.0;
-                        header->PUCSBase = strdup ("");
-                        header->PUCSOrthoRef = strdup ("");
+                        header->PUCSBase = dxf_strdup ("");
+                        header->PUCSOrthoRef = dxf_strdup ("");
                         header->PUCSOrthoView = 0;
                         header->PUCSOrgTop.x0 = 0.0;
                         header->PUCSOrgTop.y0 = 0.0;
@@ -388,7 +390,7 @@ dxf_header_init
                         header->PUCSOrgBack.y0 = 0.0;
                         header->PUCSOrgBack.z0 = 0.0;
                         header->TreeDepth = 3020;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->ProxyGraphics = 1;
@@ -398,21 +400,23 @@ dxf_header_init
                         header->JoinStyle = 0;
                         header->LWDisplay = 0;
                         header->InsUnits = 0;
-                        header->HyperLinkBase = strdup ("");
-                        header->StyleSheet = strdup ("");
+                        header->HyperLinkBase = dxf_strdup ("");
+                        header->StyleSheet = dxf_strdup ("");
                         header->XEdit = 1;
                         header->CEPSNType = 0;
                         header->PStyleMode = 1;
-                        header->FingerPrintGUID = strdup ("");
-                        header->VersionGUID = strdup ("");
+                        header->FingerPrintGUID = dxf_strdup ("");
+                        header->VersionGUID = dxf_strdup ("");
                         header->ExtNames = 0;
                         header->PSVPScale = 0.0;
                         header->OLEStartUp = 0;
                 }
                 case AC1018: /* AutoCAD 2004 */
+                case AC1021: /* AutoCAD 2007 */
+                case AC1024: /* AutoCAD 2010 */
                 {
                         header->AcadMaintVer = 0;
-                        header->DWGCodePage = strdup ("ANSI_1252");
+                        header->DWGCodePage = dxf_strdup ("ANSI_1252");
                         header->CELTScale = 1.0;
                         header->DispSilH = 0;
                         header->DimJUST = 0;
@@ -427,7 +431,7 @@ dxf_header_init
                         header->DimTDEC = 4;
                         header->DimALTU = 2;
                         header->DimALTTD = 2;
-                        header->DimTXSTY = strdup ("STANDARD");
+                        header->DimTXSTY = dxf_strdup ("STANDARD");
                         header->DimAUNIT = 0;
                         header->DimADEC = 0;
                         header->DimALTRND = 0.0;
@@ -435,7 +439,7 @@ dxf_header_init
                         header->DimDSEP = 46;
                         header->DimATFIT = 3;
                         header->DimFRAC = 0;
-                        header->DimLDRBLK = strdup ("");
+                        header->DimLDRBLK = dxf_strdup ("");
                         header->DimLUNIT = 2;
                         header->DimLWD = -2;
                         header->DimLWE = -2;
@@ -444,9 +448,9 @@ dxf_header_init
                         header->ChamferD = 10.0;
                         header->TDUCreate = 0.0;
                         header->TDUUpdate = 0.0;
-                        header->HandSeed = strdup ("26A");
-                        header->UCSBase = strdup ("");
-                        header->UCSOrthoRef = strdup ("");
+                        header->HandSeed = dxf_strdup ("26A");
+                        header->UCSBase = dxf_strdup ("");
+                        header->UCSOrthoRef = dxf_strdup ("");
                         header->UCSOrthoView = 0;
                         header->UCSOrgTop.x0 = 0.0;
                         header->UCSOrgTop.y0 = 0.0;
@@ -466,8 +470,8 @@ dxf_header_init
                         header->UCSOrgBack.x0 = 0.0;
                         header->UCSOrgBack.y0 = 0.0;
                         header->UCSOrgBack.z0 = 0.0;
-                        header->PUCSBase = strdup ("");
-                        header->PUCSOrthoRef = strdup ("");
+                        header->PUCSBase = dxf_strdup ("");
+                        header->PUCSOrthoRef = dxf_strdup ("");
                         header->PUCSOrthoView = 0;
                         header->PUCSOrgTop.x0 = 0.0;
                         header->PUCSOrgTop.y0 = 0.0;
@@ -488,7 +492,7 @@ dxf_header_init
                         header->PUCSOrgBack.y0 = 0.0;
                         header->PUCSOrgBack.z0 = 0.0;
                         header->TreeDepth = 3020;
-                        header->CMLStyle = strdup ("STANDARD");
+                        header->CMLStyle = dxf_strdup ("STANDARD");
                         header->CMLJust = 0;
                         header->CMLScale = 1.0;
                         header->ProxyGraphics = 1;
@@ -498,13 +502,13 @@ dxf_header_init
                         header->JoinStyle = 0;
                         header->LWDisplay = 0;
                         header->InsUnits = 0;
-                        header->HyperLinkBase = strdup ("");
-                        header->StyleSheet = strdup ("");
+                        header->HyperLinkBase = dxf_strdup ("");
+                        header->StyleSheet = dxf_strdup ("");
                         header->XEdit = 1;
                         header->CEPSNType = 0;
                         header->PStyleMode = 1;
-                        header->FingerPrintGUID = strdup ("");
-                        header->VersionGUID = strdup ("");
+                        header->FingerPrintGUID = dxf_strdup ("");
+                        header->VersionGUID = dxf_strdup ("");
                         header->ExtNames = 0;
                         header->PSVPScale = 0.0;
                         header->OLEStartUp = 0;
@@ -518,10 +522,10 @@ dxf_header_init
                         header->InterSectionDisplay = 0;
                         header->InterSectionColor = 257;
                         header->DimASSOC = 1;
-                        header->ProjectName = strdup ("");
+                        header->ProjectName = dxf_strdup ("");
                 }
         }
-        header->AcadVer = strdup (dxf_header_acad_version_to_string (acad_version_number));
+        header->AcadVer = dxf_strdup (dxf_header_acad_version_to_string (acad_version_number));
         header->InsBase.x0 = 0.0;
         header->InsBase.y0 = 0.0;
         header->InsBase.z0 = 0.0;
@@ -544,9 +548,9 @@ dxf_header_init
         header->AttMode = 1;
         header->TextSize = 2.5;
         header->TraceWid = 1.0;
-        header->TextStyle = strdup ("STANDARD");
-        header->CELType = strdup ("BYLAYER");
-        header->CLayer = strdup ("0");
+        header->TextStyle = dxf_strdup ("STANDARD");
+        header->CELType = dxf_strdup ("BYLAYER");
+        header->CLayer = dxf_strdup ("0");
         header->CEColor = 256;
         header->DimSCALE = 1.0;
         header->DimASZ = 2.5;
@@ -568,11 +572,11 @@ dxf_header_init
         header->DimSE2 = 0;
         header->DimTAD = 1;
         header->DimZIN = 8;
-        header->DimBLK = strdup ("");
+        header->DimBLK = dxf_strdup ("");
         header->DimASO = 1;
         header->DimSHO = 1;
-        header->DimPOST = strdup ("");
-        header->DimAPOST = strdup ("");
+        header->DimPOST = dxf_strdup ("");
+        header->DimAPOST = dxf_strdup ("");
         header->DimALT = 0;
         header->DimALTD = 4;
         header->DimALTF = 0.0394;
@@ -582,8 +586,9 @@ dxf_header_init
         header->DimTIX = 0;
         header->DimSOXD = 0;
         header->DimSAH = 0;
-        header->DimBLK1 = strdup ("");
-        header->DimBLK2 = strdup ("");
+        header->DimBLK1 = dxf_strdup ("");
+        header->DimBLK2 = dxf_strdup ("");
+        header->DimSTYLE = dxf_strdup ("STANDARD");
         header->DimCLRD = 0;
         header->DimCLRE = 0;
         header->DimCLRT = 0;
@@ -595,7 +600,7 @@ dxf_header_init
         header->FilletRad = 1.0;
         header->AUnits = 0;
         header->AUPrec = 0;
-        header->Menu = strdup (".");
+        header->Menu = dxf_strdup (".");
         header->Elevation = 0.0;
         header->PElevation = 0.0;
         header->Thickness = 0.0;
@@ -621,7 +626,7 @@ dxf_header_init
         header->SurfType = 6;
         header->SurfU = 6;
         header->SurfV = 6;
-        header->UCSName = strdup ("");
+        header->UCSName = dxf_strdup ("");
         header->UCSOrg.x0 = 0.0;
         header->UCSOrg.y0 = 0.0;
         header->UCSOrg.z0 = 0.0;
@@ -631,7 +636,7 @@ dxf_header_init
         header->UCSYDir.x0 = 0.0;
         header->UCSYDir.y0 = 0.0;
         header->UCSYDir.z0 = 0.0;
-        header->PUCSName = strdup ("");
+        header->PUCSName = dxf_strdup ("");
         header->PUCSOrg.x0 = 0.0;
         header->PUCSOrg.y0 = 0.0;
         header->PUCSOrg.z0 = 0.0;
@@ -722,7 +727,7 @@ dxf_header_write_metric_new
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -894,7 +899,7 @@ dxf_header_write_metric_new
         fprintf (fp->fp, "  9\n$PEXTMIN\n 10\n1.000000E+20\n 20\n1.000000E+20\n 30\n1.000000E+20\n");
         fprintf (fp->fp, "  9\n$PEXTMAX\n 10\n-1.000000E+20\n 20\n-1.000000E+20\n 30\n-1.000000E+20\n");
         fprintf (fp->fp, "  9\n$PLIMMIN\n 10\n0.0\n 20\n0.0\n");
-        fprintf (fp->fp, "  9\n$PLIMMAX\n 10\n420.0\n 20\n297.0");
+        fprintf (fp->fp, "  9\n$PLIMMAX\n 10\n420.0\n 20\n297.0\n");
         fprintf (fp->fp, "  9\n$UNITMODE\n 70\n     0\n");
         fprintf (fp->fp, "  9\n$VISRETAIN\n 70\n     1\n");
         fprintf (fp->fp, "  9\n$PLINEGEN\n 70\n     0\n");
@@ -929,32 +934,32 @@ dxf_header_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("HEADER");
+        char *dxf_entity_name = dxf_strdup ("HEADER");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (header == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         dxf_section_write (fp, dxf_entity_name);
         fprintf (fp->fp, "  9\n$ACADVER\n  1\n%s\n", header->AcadVer);
         if (fp->acad_version_number >= AC1014) fprintf (fp->fp, "  9\n$ACADMAINTVER\n 70\n%i\n", header->AcadMaintVer);
         if (fp->acad_version_number >= AC1012) fprintf (fp->fp, "  9\n$DWGCODEPAGE\n  3\n%s\n", header->DWGCodePage);
-        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$LASTSAVEDBY\n  1\n%s\n", getenv("USER"));
+        if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$LASTSAVEDBY\n  1\n%s\n", (getenv ("USER") != NULL) ? getenv ("USER") : "");
         fprintf (fp->fp, "  9\n$INSBASE\n 10\n%f\n 20\n%f\n 30\n%f\n", header->InsBase.x0, header->InsBase.y0, header->InsBase.z0);
         fprintf (fp->fp, "  9\n$EXTMIN\n 10\n%f\n 20\n%f\n 30\n%f\n", header->ExtMin.x0, header->ExtMin.y0, header->ExtMin.z0);
         fprintf (fp->fp, "  9\n$EXTMAX\n 10\n%f\n 20\n%f\n 30\n%f\n", header->ExtMax.x0, header->ExtMax.y0, header->ExtMax.z0);
@@ -1180,7 +1185,7 @@ dxf_header_write
         if (fp->acad_version_number >= AC1018) fprintf (fp->fp, "  9\n$PROJECTNAME\n  1\n%s\n", header->ProjectName);
         dxf_endsec_write (fp);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1209,7 +1214,7 @@ dxf_header_read_parse_string
                 dxf_read_scanf (fp, "%i\n%s\n", &n, tstring);
                 if (dxf_read_is_string(n))
                 {
-                        *value_string = strdup(tstring);
+                        *value_string = dxf_strdup(tstring);
                 }
                 else
                         ret = FAIL;
@@ -1242,21 +1247,21 @@ dxf_header_read_parse_int
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (temp_string == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer to temp_string was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (header_var == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer to header_var was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1307,21 +1312,21 @@ dxf_header_read_parse_n_double
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (temp_string == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer to temp_string was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (header_var == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer to header_var was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1381,21 +1386,21 @@ dxf_header_read_parser
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (header == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer to header was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (temp_string == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer to temp_string was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1881,14 +1886,14 @@ dxf_header_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (header == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 header = dxf_header_new ();
@@ -1896,7 +1901,7 @@ dxf_header_read
         }
         if (header == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHeader struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1931,7 +1936,7 @@ dxf_header_read
                 else if (n == 0 && strcmp (temp_string, "ENDSEC") == 0)
                 {
 #if DEBUG
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                           (_("[File: %s: line: %d] read_header :: Section Ended.\n")),
                           __FILE__, __LINE__);
 #endif
@@ -1964,42 +1969,42 @@ dxf_header_free
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (header == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to DxfHeader was NULL.\n")),
                 __FUNCTION__);
               return (header);
         }
-        free (header->AcadVer);
-        free (header->DWGCodePage);
+        dxf_free (header->AcadVer);
+        dxf_free (header->DWGCodePage);
 //        dxf_point_free ((struct DxfPoint) header->InsBase);
 //        dxf_point_free ((struct DxfPoint) header->ExtMin);
 //        dxf_point_free ((struct DxfPoint) header->ExtMax);
 //        dxf_point_free ((struct DxfPoint) header->LimMin);
 //        dxf_point_free ((struct DxfPoint) header->LimMax);
-        free (header->TextStyle);
-        free (header->CLayer);
-        free (header->CELType);
-        free (header->DimBLK);
-        free (header->DimPOST);
-        free (header->DimAPOST);
-        free (header->DimBLK1);
-        free (header->DimBLK2);
-        free (header->DimSTYLE);
-        free (header->DimTXSTY);
-        free (header->DimLDRBLK);
-        free (header->Menu);
-        free (header->HandSeed);
-        free (header->UCSBase);
-        free (header->UCSName);
+        dxf_free (header->TextStyle);
+        dxf_free (header->CLayer);
+        dxf_free (header->CELType);
+        dxf_free (header->DimBLK);
+        dxf_free (header->DimPOST);
+        dxf_free (header->DimAPOST);
+        dxf_free (header->DimBLK1);
+        dxf_free (header->DimBLK2);
+        dxf_free (header->DimSTYLE);
+        dxf_free (header->DimTXSTY);
+        dxf_free (header->DimLDRBLK);
+        dxf_free (header->Menu);
+        dxf_free (header->HandSeed);
+        dxf_free (header->UCSBase);
+        dxf_free (header->UCSName);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrg);
 //        dxf_point_free ((struct DxfPoint) header->UCSXDir);
 //        dxf_point_free ((struct DxfPoint) header->UCSYDir);
-        free (header->UCSOrthoRef);
+        dxf_free (header->UCSOrthoRef);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrgTop);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrgBottom);
 //        dxf_point_free ((struct DxfPoint) header->UCSOrgLeft);
@@ -2009,7 +2014,7 @@ dxf_header_free
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrg);
 //        dxf_point_free ((struct DxfPoint) header->PUCSXDir);
 //        dxf_point_free ((struct DxfPoint) header->PUCSYDir);
-        free (header->PUCSOrthoRef);
+        dxf_free (header->PUCSOrthoRef);
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrgTop);
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrgBottom);
 //        dxf_point_free ((struct DxfPoint) header->PUCSOrgLeft);
@@ -2021,15 +2026,15 @@ dxf_header_free
 //        dxf_point_free ((struct DxfPoint) header->PExtMax);
 //        dxf_point_free ((struct DxfPoint) header->PLimMin);
 //        dxf_point_free ((struct DxfPoint) header->PLimMax);
-        free (header->CMLStyle);
-        free (header->HyperLinkBase);
-        free (header->StyleSheet);
-        free (header->FingerPrintGUID);
-        free (header->VersionGUID);
-        free (header->ProjectName);
-        free (header);
+        dxf_free (header->CMLStyle);
+        dxf_free (header->HyperLinkBase);
+        dxf_free (header->StyleSheet);
+        dxf_free (header->FingerPrintGUID);
+        dxf_free (header->VersionGUID);
+        dxf_free (header->ProjectName);
+        dxf_free (header);
         header = NULL;
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_END
 #endif
         return (header);
@@ -36,6 +36,7 @@
 
 
 #include "helix.h"
+#include "util.h"
 
 
 /*!
@@ -58,9 +59,9 @@ dxf_helix_new ()
         size = sizeof (DxfHelix);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((helix = malloc (size)) == NULL)
+        if ((helix = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfHelix struct.\n")),
                   __FUNCTION__);
                 helix = NULL;
@@ -68,6 +69,7 @@ dxf_helix_new ()
         else
         {
                 memset (helix, 0, size);
+                helix->header.type = HELIX;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -96,21 +98,21 @@ dxf_helix_init
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 helix = dxf_helix_new ();
         }
         if (helix == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfHelix struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         helix->id_code = 0;
-        helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        helix->layer = strdup (DXF_DEFAULT_LAYER);
+        helix->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        helix->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         helix->p0 = dxf_point_init (helix->p0);
         helix->p1 = dxf_point_init (helix->p1);
         helix->p2 = dxf_point_init (helix->p2);
@@ -129,13 +131,13 @@ dxf_helix_init
         helix->shadow_mode = 0;
         helix->handedness = 0;
         helix->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (helix->binary_graphics_data);
-        helix->dictionary_owner_hard = strdup ("");
-        helix->material = strdup ("");
-        helix->dictionary_owner_soft = strdup ("");
+        helix->dictionary_owner_hard = dxf_strdup ("");
+        helix->material = dxf_strdup ("");
+        helix->dictionary_owner_soft = dxf_strdup ("");
         helix->lineweight = 0;
-        helix->plot_style_name = strdup ("");
+        helix->plot_style_name = dxf_strdup ("");
         helix->color_value = 0;
-        helix->color_name = strdup ("");
+        helix->color_name = dxf_strdup ("");
         helix->transparency = 0;
         helix->spline = (DxfSpline *) dxf_spline_init (helix->spline);
         helix->next = NULL;
@@ -170,40 +172,38 @@ dxf_helix_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        int i;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int i_binary_graphics_data;
+        DxfBinaryGraphicsData *binary_graphics_data = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 helix = dxf_helix_new ();
                 helix = dxf_helix_init (helix);
         }
-        i = 0;
+        i_binary_graphics_data = 0;
+        binary_graphics_data = (DxfBinaryGraphicsData *) helix->binary_graphics_data;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -218,13 +218,13 @@ dxf_helix_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->linetype);
+                        dxf_read_string (fp, &helix->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->layer);
+                        dxf_read_string (fp, &helix->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -374,12 +374,15 @@ dxf_helix_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if ((strcmp (temp_string, "AcDbSpline") == 0))
                         {
+                                /* The spline reads its groups up to and
+                                 * including the AcDbHelix subclass
+                                 * marker. */
                                 helix->spline = dxf_spline_read (fp, helix->spline);
                         }
                         else if ((strcmp (temp_string, "AcDbEntity") != 0)
                                 && ((strcmp (temp_string, "AcDbHelix") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -415,32 +418,37 @@ dxf_helix_read
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
-                         * graphics data. */
+                         * graphics data, every next line gets a new
+                         * link in the list. */
+                        if (i_binary_graphics_data > 0)
+                        {
+                                binary_graphics_data->next = (struct DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+                                binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
+                        }
+                        i_binary_graphics_data++;
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) helix->binary_graphics_data->next);
-                        helix->binary_graphics_data = (DxfBinaryGraphicsData *) helix->binary_graphics_data->next;
+                        dxf_read_string (fp, &binary_graphics_data->data_line);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing a
                          * soft-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->dictionary_owner_soft);
+                        dxf_read_string (fp, &helix->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->material);
+                        dxf_read_string (fp, &helix->material);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->dictionary_owner_hard);
+                        dxf_read_string (fp, &helix->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -454,7 +462,7 @@ dxf_helix_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->plot_style_name);
+                        dxf_read_string (fp, &helix->plot_style_name);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -467,7 +475,7 @@ dxf_helix_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", helix->color_name);
+                        dxf_read_string (fp, &helix->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -485,22 +493,26 @@ dxf_helix_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (helix->linetype, "") == 0)
         {
-                helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                helix->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (helix->layer, "") == 0)
         {
-                helix->layer = strdup (DXF_DEFAULT_LAYER);
+                helix->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -526,61 +538,63 @@ dxf_helix_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("HELIX");
+        char *dxf_entity_name = dxf_strdup ("HELIX");
+        DxfBinaryGraphicsData *binary_graphics_data = NULL;
+        DxfPoint *point;
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (helix->radius == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () radius value equals 0.0 for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, helix->id_code);
-                fprintf (stderr, "    skipping %s entity.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO, "    skipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (helix->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, helix->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                helix->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                helix->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (helix->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, helix->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
                 helix->layer = DXF_DEFAULT_LAYER;
@@ -613,11 +627,11 @@ dxf_helix_write
         fprintf (fp->fp, "370\n%d\n", helix->lineweight);
         if (helix->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", helix->thickness);
+                dxf_write_real (fp, 39, helix->thickness);
         }
         if (helix->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", helix->linetype_scale);
+                dxf_write_real (fp, 48, helix->linetype_scale);
         }
         if (helix->visibility != 0)
         {
@@ -628,10 +642,11 @@ dxf_helix_write
 #else
         fprintf (fp->fp, " 92\n%d\n", helix->graphics_data_size);
 #endif
-        while (helix->binary_graphics_data != NULL)
+        binary_graphics_data = (DxfBinaryGraphicsData *) helix->binary_graphics_data;
+        while (binary_graphics_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", helix->binary_graphics_data->data_line);
-                helix->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (helix->binary_graphics_data);
+                fprintf (fp->fp, "310\n%s\n", binary_graphics_data->data_line);
+                binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
         }
         fprintf (fp->fp, "420\n%ld\n", helix->color_value);
         fprintf (fp->fp, "430\n%s\n", helix->color_name);
@@ -647,59 +662,60 @@ dxf_helix_write
         fprintf (fp->fp, " 72\n%d\n", helix->spline->number_of_knots);
         fprintf (fp->fp, " 73\n%d\n", helix->spline->number_of_control_points);
         fprintf (fp->fp, " 74\n%d\n", helix->spline->number_of_fit_points);
-        fprintf (fp->fp, " 42\n%f\n", helix->spline->knot_tolerance);
-        fprintf (fp->fp, " 43\n%f\n", helix->spline->control_point_tolerance);
-        fprintf (fp->fp, " 12\n%f\n", helix->spline->p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", helix->spline->p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", helix->spline->p2->z0);
-        fprintf (fp->fp, " 13\n%f\n", helix->spline->p3->x0);
-        fprintf (fp->fp, " 23\n%f\n", helix->spline->p3->y0);
-        fprintf (fp->fp, " 33\n%f\n", helix->spline->p3->z0);
-        for (i = 0; i < helix->spline->number_of_knots; i++)
-        {
-                fprintf (fp->fp, " 40\n%f\n", helix->spline->knot_value[i]);
-        }
-        if (helix->spline->number_of_fit_points != 0)
-        {
-                for (i = 0; i < helix->spline->number_of_fit_points; i++)
-                {
-                        fprintf (fp->fp, " 41\n%f\n", helix->spline->weight_value[i]);
-                }
-        }
-        while (helix->spline->p0 != NULL)
+        dxf_write_real (fp, 42, helix->spline->knot_tolerance);
+        dxf_write_real (fp, 43, helix->spline->control_point_tolerance);
+        dxf_write_real (fp, 12, helix->spline->p2->x0);
+        dxf_write_real (fp, 22, helix->spline->p2->y0);
+        dxf_write_real (fp, 32, helix->spline->p2->z0);
+        dxf_write_real (fp, 13, helix->spline->p3->x0);
+        dxf_write_real (fp, 23, helix->spline->p3->y0);
+        dxf_write_real (fp, 33, helix->spline->p3->z0);
+        for (i = 0; (i < helix->spline->number_of_knots) && (i < DXF_MAX_PARAM); i++)
+        {
+                dxf_write_real (fp, 40, helix->spline->knot_value[i]);
+        }
+        /* Only as many points as the spline counts are written (see
+         * dxf_spline_write ()). */
+        point = helix->spline->p0;
+        i = 0;
+        while ((point != NULL) && (i < helix->spline->number_of_control_points))
         {
-                fprintf (fp->fp, " 10\n%f\n", helix->spline->p0->x0);
-                fprintf (fp->fp, " 20\n%f\n", helix->spline->p0->y0);
-                fprintf (fp->fp, " 30\n%f\n", helix->spline->p0->z0);
-                helix->spline->p0 = (DxfPoint *) helix->spline->p0->next;
+                dxf_write_real (fp, 10, point->x0);
+                dxf_write_real (fp, 20, point->y0);
+                dxf_write_real (fp, 30, point->z0);
+                point = (DxfPoint *) point->next;
+                i++;
         }
-        while (helix->spline->p1 != NULL)
+        point = helix->spline->p1;
+        i = 0;
+        while ((point != NULL) && (i < helix->spline->number_of_fit_points))
         {
-                fprintf (fp->fp, " 11\n%f\n", helix->spline->p1->x0);
-                fprintf (fp->fp, " 21\n%f\n", helix->spline->p1->y0);
-                fprintf (fp->fp, " 31\n%f\n", helix->spline->p1->z0);
-                helix->spline->p1 = (DxfPoint *) helix->spline->p1->next;
+                dxf_write_real (fp, 11, point->x0);
+                dxf_write_real (fp, 21, point->y0);
+                dxf_write_real (fp, 31, point->z0);
+                point = (DxfPoint *) point->next;
+                i++;
         }
         /* Continue writing helix entity parameters. */
         fprintf (fp->fp, "100\nAcDbHelix\n");
         fprintf (fp->fp, " 90\n%ld\n", helix->major_release_number);
         fprintf (fp->fp, " 91\n%ld\n", helix->maintainance_release_number);
-        fprintf (fp->fp, " 10\n%f\n", helix->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", helix->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", helix->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", helix->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", helix->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", helix->p1->z0);
-        fprintf (fp->fp, " 12\n%f\n", helix->p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", helix->p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", helix->p2->z0);
-        fprintf (fp->fp, " 40\n%f\n", helix->radius);
-        fprintf (fp->fp, " 41\n%f\n", helix->number_of_turns);
-        fprintf (fp->fp, " 42\n%f\n", helix->turn_height);
+        dxf_write_real (fp, 10, helix->p0->x0);
+        dxf_write_real (fp, 20, helix->p0->y0);
+        dxf_write_real (fp, 30, helix->p0->z0);
+        dxf_write_real (fp, 11, helix->p1->x0);
+        dxf_write_real (fp, 21, helix->p1->y0);
+        dxf_write_real (fp, 31, helix->p1->z0);
+        dxf_write_real (fp, 12, helix->p2->x0);
+        dxf_write_real (fp, 22, helix->p2->y0);
+        dxf_write_real (fp, 32, helix->p2->z0);
+        dxf_write_real (fp, 40, helix->radius);
+        dxf_write_real (fp, 41, helix->number_of_turns);
+        dxf_write_real (fp, 42, helix->turn_height);
         fprintf (fp->fp, "290\n%d\n", helix->handedness);
         fprintf (fp->fp, "280\n%d\n", helix->constraint_type);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -727,23 +743,27 @@ dxf_helix_free
 #endif
         if (helix->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfHelix was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_helix_get_linetype (helix));
-        free (dxf_helix_get_layer (helix));
+        dxf_free (dxf_helix_get_linetype (helix));
+        dxf_free (dxf_helix_get_layer (helix));
         dxf_binary_graphics_data_free_chain ((DxfBinaryGraphicsData *) dxf_helix_get_binary_graphics_data (helix));
-        free (dxf_helix_get_dictionary_owner_hard (helix));
-        free (dxf_helix_get_material (helix));
-        free (dxf_helix_get_dictionary_owner_soft (helix));
-        free (dxf_helix_get_plot_style_name (helix));
-        free (dxf_helix_get_color_name (helix));
+        dxf_free (dxf_helix_get_dictionary_owner_hard (helix));
+        dxf_free (dxf_helix_get_material (helix));
+        dxf_free (dxf_helix_get_dictionary_owner_soft (helix));
+        dxf_free (dxf_helix_get_plot_style_name (helix));
+        dxf_free (dxf_helix_get_color_name (helix));
         dxf_point_free (dxf_helix_get_p0 (helix));
         dxf_point_free (dxf_helix_get_p1 (helix));
         dxf_point_free (dxf_helix_get_p2 (helix));
-        free (helix);
+        if (helix->spline != NULL)
+        {
+                dxf_spline_free (helix->spline);
+        }
+        dxf_free (helix);
         helix = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -764,18 +784,19 @@ dxf_helix_free_chain
                  * \c HELIX entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (helices == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (helices != NULL)
         {
                 struct DxfHelix *iter = helices->next;
+                helices->next = NULL;
                 dxf_helix_free (helices);
                 helices = (DxfHelix *) iter;
         }
@@ -804,14 +825,14 @@ dxf_helix_get_id_code
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -846,14 +867,14 @@ dxf_helix_set_id_code
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -884,14 +905,14 @@ dxf_helix_get_linetype
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -899,7 +920,7 @@ dxf_helix_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->linetype));
+        return (dxf_strdup (helix->linetype));
 }
 
 
@@ -924,19 +945,19 @@ dxf_helix_set_linetype
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->linetype = strdup (linetype);
+        helix->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -962,14 +983,14 @@ dxf_helix_get_layer
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -977,7 +998,7 @@ dxf_helix_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->layer));
+        return (dxf_strdup (helix->layer));
 }
 
 
@@ -1002,19 +1023,19 @@ dxf_helix_set_layer
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->layer = strdup (layer);
+        helix->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1041,14 +1062,14 @@ dxf_helix_get_thickness
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
         }
@@ -1080,14 +1101,14 @@ dxf_helix_set_thickness
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1118,14 +1139,14 @@ dxf_helix_get_linetype_scale
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1158,14 +1179,14 @@ dxf_helix_set_linetype_scale
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative linetype scale value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1197,21 +1218,21 @@ dxf_helix_get_visibility
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1244,21 +1265,21 @@ dxf_helix_set_visibility
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1290,14 +1311,14 @@ dxf_helix_get_color
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1329,17 +1350,17 @@ dxf_helix_set_color
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         helix->color = color;
@@ -1369,20 +1390,20 @@ dxf_helix_get_paperspace
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (helix->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1415,21 +1436,21 @@ dxf_helix_set_paperspace
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1461,20 +1482,20 @@ dxf_helix_get_graphics_data_size
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
         if (helix->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
@@ -1507,21 +1528,21 @@ dxf_helix_set_graphics_data_size
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1553,21 +1574,21 @@ dxf_helix_get_shadow_mode
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1600,21 +1621,21 @@ dxf_helix_set_shadow_mode
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1648,14 +1669,14 @@ dxf_helix_get_binary_graphics_data
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1690,14 +1711,14 @@ dxf_helix_set_binary_graphics_data
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1732,14 +1753,14 @@ dxf_helix_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1747,7 +1768,7 @@ dxf_helix_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->dictionary_owner_soft));
+        return (dxf_strdup (helix->dictionary_owner_soft));
 }
 
 
@@ -1774,19 +1795,19 @@ dxf_helix_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        helix->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1815,14 +1836,14 @@ dxf_helix_get_material
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the material member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1830,7 +1851,7 @@ dxf_helix_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->material));
+        return (dxf_strdup (helix->material));
 }
 
 
@@ -1856,19 +1877,19 @@ dxf_helix_set_material
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->material = strdup (material);
+        helix->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1898,14 +1919,14 @@ dxf_helix_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1913,7 +1934,7 @@ dxf_helix_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->dictionary_owner_hard));
+        return (dxf_strdup (helix->dictionary_owner_hard));
 }
 
 
@@ -1940,19 +1961,19 @@ dxf_helix_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        helix->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1979,7 +2000,7 @@ dxf_helix_get_lineweight
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2012,7 +2033,7 @@ dxf_helix_set_lineweight
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2044,14 +2065,14 @@ dxf_helix_get_plot_style_name
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2059,7 +2080,7 @@ dxf_helix_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->plot_style_name));
+        return (dxf_strdup (helix->plot_style_name));
 }
 
 
@@ -2085,19 +2106,19 @@ dxf_helix_set_plot_style_name
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->plot_style_name = strdup (plot_style_name);
+        helix->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2124,7 +2145,7 @@ dxf_helix_get_color_value
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2157,7 +2178,7 @@ dxf_helix_set_color_value
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2189,14 +2210,14 @@ dxf_helix_get_color_name
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2204,7 +2225,7 @@ dxf_helix_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (helix->color_name));
+        return (dxf_strdup (helix->color_name));
 }
 
 
@@ -2230,19 +2251,19 @@ dxf_helix_set_color_name
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        helix->color_name = strdup (color_name);
+        helix->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2269,7 +2290,7 @@ dxf_helix_get_transparency
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2302,7 +2323,7 @@ dxf_helix_set_transparency
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2334,14 +2355,14 @@ dxf_helix_get_p0
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->p0 ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the p0 member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2374,14 +2395,14 @@ dxf_helix_set_p0
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2413,7 +2434,7 @@ dxf_helix_get_x0
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2447,7 +2468,7 @@ dxf_helix_set_x0
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2479,7 +2500,7 @@ dxf_helix_get_y0
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2513,7 +2534,7 @@ dxf_helix_set_y0
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2545,7 +2566,7 @@ dxf_helix_get_z0
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2579,7 +2600,7 @@ dxf_helix_set_z0
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2611,14 +2632,14 @@ dxf_helix_get_p1
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->p1 ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the p1 member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2651,14 +2672,14 @@ dxf_helix_set_p1
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2690,7 +2711,7 @@ dxf_helix_get_x1
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2724,7 +2745,7 @@ dxf_helix_set_x1
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2756,7 +2777,7 @@ dxf_helix_get_y1
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2789,7 +2810,7 @@ dxf_helix_set_y1
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2821,7 +2842,7 @@ dxf_helix_get_z1
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2855,7 +2876,7 @@ dxf_helix_set_z1
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2887,14 +2908,14 @@ dxf_helix_get_p2
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->p2 ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the p2 member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2928,14 +2949,14 @@ dxf_helix_set_p2
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2967,7 +2988,7 @@ dxf_helix_get_x2
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3001,7 +3022,7 @@ dxf_helix_set_x2
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3033,7 +3054,7 @@ dxf_helix_get_y2
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3067,7 +3088,7 @@ dxf_helix_set_y2
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3099,7 +3120,7 @@ dxf_helix_get_z2
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3133,7 +3154,7 @@ dxf_helix_set_z2
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3165,7 +3186,7 @@ dxf_helix_get_radius
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3198,7 +3219,7 @@ dxf_helix_set_radius
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3230,7 +3251,7 @@ dxf_helix_get_number_of_turns
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3263,7 +3284,7 @@ dxf_helix_set_number_of_turns
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3295,7 +3316,7 @@ dxf_helix_get_turn_height
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3328,7 +3349,7 @@ dxf_helix_set_turn_height
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3360,7 +3381,7 @@ dxf_helix_get_major_release_number
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3394,7 +3415,7 @@ dxf_helix_set_major_release_number
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3427,7 +3448,7 @@ dxf_helix_get_maintainance_release_number
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3461,7 +3482,7 @@ dxf_helix_set_maintainance_release_number
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3493,21 +3514,21 @@ dxf_helix_get_constraint_type
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->constraint_type < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the constraint_type member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->constraint_type > 2)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found in the constraint_type member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3540,21 +3561,21 @@ dxf_helix_set_constraint_type
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (constraint_type < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative constraint_type value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (constraint_type > 2)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid constraint_type value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3586,21 +3607,21 @@ dxf_helix_get_handedness
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->handedness < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the handedness member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (helix->handedness > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found in the handedness member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3633,21 +3654,21 @@ dxf_helix_set_handedness
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (handedness < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative handedness value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (handedness > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid handedness value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3679,14 +3700,14 @@ dxf_helix_get_spline
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3719,14 +3740,14 @@ dxf_helix_set_spline
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3760,14 +3781,14 @@ dxf_helix_get_next
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3801,14 +3822,14 @@ dxf_helix_set_next
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3842,14 +3863,14 @@ dxf_helix_get_last
         /* Do some basic checks. */
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (helix->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfHelix *) helix);
@@ -0,0 +1,292 @@
+/*!
+ * \file hex.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF conversion between binary data and the
+ * hexadecimal text of binary chunk groups (group code 310).
+ *
+ * Thumbnails, proxy graphics and OLE objects are stored as long runs of
+ * hexadecimal text, two characters per byte.\n
+ * When the compiler targets SSE2 the text is converted 32 characters
+ * (16 bytes) at a time, the remainder and other targets are converted
+ * one character at a time.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "hex.h"
+
+#if defined (__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+/*!
+ * \brief Characters of the hexadecimal digits, AutoCAD writes upper
+ * case.
+ */
+static const char dxf_hex_digits[] = "0123456789ABCDEF";
+
+
+/*!
+ * \brief Value of a hexadecimal digit, or -1 when the character is not
+ * a hexadecimal digit.
+ */
+static int
+dxf_hex_value
+(
+        unsigned char c
+                /*!< the character. */
+)
+{
+        if ((c >= '0') && (c <= '9'))
+        {
+                return (c - '0');
+        }
+        c |= 0x20;
+        if ((c >= 'a') && (c <= 'f'))
+        {
+                return (c - 'a' + 10);
+        }
+        return (-1);
+}
+
+
+#if defined (__SSE2__)
+/*!
+ * \brief Convert 16 hexadecimal digits into their values.
+ *
+ * \return a mask with a bit set for every character which is not a
+ * hexadecimal digit.
+ */
+static int
+dxf_hex_nibbles_sse2
+(
+        __m128i text,
+                /*!< 16 characters. */
+        __m128i *nibbles
+                /*!< the 16 values of the characters. */
+)
+{
+        __m128i digit;
+        __m128i letter;
+        __m128i is_digit;
+        __m128i is_letter;
+
+        /* Subtracting wraps around, so only the wanted characters
+         * end up in the small range tested by the unsigned minimum. */
+        digit = _mm_sub_epi8 (text, _mm_set1_epi8 ('0'));
+        is_digit = _mm_cmpeq_epi8 (_mm_min_epu8 (digit, _mm_set1_epi8 (9)), digit);
+        letter = _mm_sub_epi8 (_mm_or_si128 (text, _mm_set1_epi8 (0x20)), _mm_set1_epi8 ('a'));
+        is_letter = _mm_cmpeq_epi8 (_mm_min_epu8 (letter, _mm_set1_epi8 (5)), letter);
+        letter = _mm_add_epi8 (letter, _mm_set1_epi8 (10));
+        *nibbles = _mm_or_si128 (_mm_and_si128 (is_digit, digit),
+          _mm_and_si128 (is_letter, letter));
+        return (_mm_movemask_epi8 (_mm_or_si128 (is_digit, is_letter)) ^ 0xFFFF);
+}
+
+
+/*!
+ * \brief Combine 16 pairs of nibbles into 8 bytes, stored in 16 bit
+ * lanes.
+ */
+static __m128i
+dxf_hex_pairs_sse2
+(
+        __m128i nibbles
+                /*!< the values of 16 characters, high nibble first. */
+)
+{
+        return (_mm_or_si128 (
+          _mm_and_si128 (_mm_slli_epi16 (nibbles, 4), _mm_set1_epi16 (0x00F0)),
+          _mm_srli_epi16 (nibbles, 8)));
+}
+
+
+/*!
+ * \brief Convert 16 nibbles into hexadecimal digits.
+ */
+static __m128i
+dxf_hex_digits_sse2
+(
+        __m128i nibbles
+                /*!< 16 values in the range 0 to 15. */
+)
+{
+        __m128i above_nine;
+
+        above_nine = _mm_cmpgt_epi8 (nibbles, _mm_set1_epi8 (9));
+        return (_mm_add_epi8 (_mm_add_epi8 (nibbles, _mm_set1_epi8 ('0')),
+          _mm_and_si128 (above_nine, _mm_set1_epi8 ('A' - '0' - 10))));
+}
+#endif
+
+
+/*!
+ * \brief Convert hexadecimal text into bytes.
+ *
+ * Upper and lower case digits are accepted, \c text is not required to
+ * be terminated.\n
+ * \c bytes has to hold \c length / 2 bytes, its contents are undefined
+ * when an error occurred.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the length
+ * is odd or the text contains a character which is not a hexadecimal
+ * digit.
+ */
+int
+dxf_hex_decode
+(
+        const char *text,
+                /*!< the hexadecimal text. */
+        size_t length,
+                /*!< number of characters in \c text. */
+        unsigned char *bytes
+                /*!< the decoded bytes. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i = 0;
+        int high;
+        int low;
+
+        /* Do some basic checks. */
+        if ((length % 2) != 0)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an odd number of hexadecimal digits was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((length > 0) && ((text == NULL) || (bytes == NULL)))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if defined (__SSE2__)
+        for (; i + 32 <= length; i += 32)
+        {
+                __m128i first;
+                __m128i second;
+                int invalid;
+
+                invalid = dxf_hex_nibbles_sse2 (_mm_loadu_si128 ((const __m128i *) (text + i)), &first);
+                invalid |= dxf_hex_nibbles_sse2 (_mm_loadu_si128 ((const __m128i *) (text + i + 16)), &second);
+                if (invalid != 0)
+                {
+                        break;
+                }
+                _mm_storeu_si128 ((__m128i *) (bytes + i / 2),
+                  _mm_packus_epi16 (dxf_hex_pairs_sse2 (first),
+                  dxf_hex_pairs_sse2 (second)));
+        }
+#endif
+        for (; i < length; i += 2)
+        {
+                high = dxf_hex_value ((unsigned char) text[i]);
+                low = dxf_hex_value ((unsigned char) text[i + 1]);
+                if ((high < 0) || (low < 0))
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () a character which is not a hexadecimal digit was found at position %lu.\n")),
+                          __FUNCTION__, (unsigned long) ((high < 0) ? i : i + 1));
+                        return (EXIT_FAILURE);
+                }
+                bytes[i / 2] = (unsigned char) ((high << 4) | low);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Convert bytes into upper case hexadecimal text.
+ *
+ * \c text has to hold 2 * \c size characters, no terminating zero is
+ * written.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hex_encode
+(
+        const unsigned char *bytes,
+                /*!< the bytes to encode. */
+        size_t size,
+                /*!< number of bytes. */
+        char *text
+                /*!< the hexadecimal text. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t i = 0;
+
+        /* Do some basic checks. */
+        if ((size > 0) && ((bytes == NULL) || (text == NULL)))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if defined (__SSE2__)
+        for (; i + 16 <= size; i += 16)
+        {
+                __m128i data;
+                __m128i high;
+                __m128i low;
+
+                data = _mm_loadu_si128 ((const __m128i *) (bytes + i));
+                high = dxf_hex_digits_sse2 (_mm_and_si128 (_mm_srli_epi16 (data, 4), _mm_set1_epi8 (0x0F)));
+                low = dxf_hex_digits_sse2 (_mm_and_si128 (data, _mm_set1_epi8 (0x0F)));
+                _mm_storeu_si128 ((__m128i *) (text + 2 * i), _mm_unpacklo_epi8 (high, low));
+                _mm_storeu_si128 ((__m128i *) (text + 2 * i + 16), _mm_unpackhi_epi8 (high, low));
+        }
+#endif
+        for (; i < size; i++)
+        {
+                text[2 * i] = dxf_hex_digits[bytes[i] >> 4];
+                text[2 * i + 1] = dxf_hex_digits[bytes[i] & 0x0F];
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -41,6 +41,7 @@
 
 
 #include "idbuffer.h"
+#include "util.h"
 
 
 /*!
@@ -60,9 +61,9 @@ dxf_idbuffer_new ()
         size = sizeof (DxfIdbuffer);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((idbuffer = malloc (size)) == NULL)
+        if ((idbuffer = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfIdbuffer struct.\n")),
                   __FUNCTION__);
                 idbuffer = NULL;
@@ -98,21 +99,21 @@ dxf_idbuffer_init
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 idbuffer = dxf_idbuffer_new ();
         }
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfIdbuffer struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         idbuffer->id_code = 0;
-        idbuffer->dictionary_owner_soft = strdup ("");
-        idbuffer->dictionary_owner_hard = strdup ("");
+        idbuffer->dictionary_owner_soft = dxf_strdup ("");
+        idbuffer->dictionary_owner_hard = dxf_strdup ("");
         idbuffer->entity_pointer = (DxfIdbufferEntityPointer *) dxf_idbuffer_entity_pointer_init (idbuffer->entity_pointer);
         idbuffer->next = NULL;
 #if DEBUG
@@ -145,29 +146,27 @@ dxf_idbuffer_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
         DxfIdbufferEntityPointer *entity_pointer = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 idbuffer = dxf_idbuffer_new ();
@@ -176,16 +175,15 @@ dxf_idbuffer_read
         i = 0;
         entity_pointer = (DxfIdbufferEntityPointer *) dxf_idbuffer_entity_pointer_init (entity_pointer);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -204,7 +202,7 @@ dxf_idbuffer_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbIdBuffer") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -215,7 +213,7 @@ dxf_idbuffer_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", idbuffer->dictionary_owner_soft);
+                        dxf_read_string (fp, &idbuffer->dictionary_owner_soft);
                         i++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -224,7 +222,7 @@ dxf_idbuffer_read
                         /* Now follows a string containing a Soft
                          * pointer reference to entity. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", entity_pointer->soft_pointer);
+                        dxf_read_string (fp, &entity_pointer->soft_pointer);
                         dxf_idbuffer_entity_pointer_init ((DxfIdbufferEntityPointer *) entity_pointer->next);
                         entity_pointer = (DxfIdbufferEntityPointer *) entity_pointer->next;
                 }
@@ -233,7 +231,7 @@ dxf_idbuffer_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", idbuffer->dictionary_owner_hard);
+                        dxf_read_string (fp, &idbuffer->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -244,13 +242,17 @@ dxf_idbuffer_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -276,31 +278,31 @@ dxf_idbuffer_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("IDBUFFER");
+        char *dxf_entity_name = dxf_strdup ("IDBUFFER");
         DxfIdbufferEntityPointer * entity_pointer = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_idbuffer_get_id_code (idbuffer));
         }
@@ -345,7 +347,7 @@ dxf_idbuffer_write
                 entity_pointer = dxf_idbuffer_entity_pointer_get_next (dxf_idbuffer_get_entity_pointer (idbuffer));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -374,15 +376,15 @@ dxf_idbuffer_free
         /* Do some basic checks. */
         if (idbuffer->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfIdbuffer was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_idbuffer_get_dictionary_owner_soft (idbuffer));
-        free (dxf_idbuffer_get_dictionary_owner_hard (idbuffer));
+        dxf_free (dxf_idbuffer_get_dictionary_owner_soft (idbuffer));
+        dxf_free (dxf_idbuffer_get_dictionary_owner_hard (idbuffer));
         dxf_idbuffer_entity_pointer_free_chain ((DxfIdbufferEntityPointer *) dxf_idbuffer_get_entity_pointer (idbuffer));
-        free (idbuffer);
+        dxf_free (idbuffer);
         idbuffer = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -402,12 +404,12 @@ dxf_idbuffer_free_chain
                 /*!< pointer to the chain of DXF \c IDBUFFER objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (id_buffers == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
@@ -442,14 +444,14 @@ dxf_idbuffer_get_id_code
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (idbuffer->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -484,14 +486,14 @@ dxf_idbuffer_set_id_code
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -526,14 +528,14 @@ dxf_idbuffer_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (idbuffer->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -541,7 +543,7 @@ dxf_idbuffer_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (idbuffer->dictionary_owner_soft));
+        return (dxf_strdup (idbuffer->dictionary_owner_soft));
 }
 
 
@@ -568,19 +570,19 @@ dxf_idbuffer_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        idbuffer->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        idbuffer->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -610,14 +612,14 @@ dxf_idbuffer_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (idbuffer->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -625,7 +627,7 @@ dxf_idbuffer_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (idbuffer->dictionary_owner_hard));
+        return (dxf_strdup (idbuffer->dictionary_owner_hard));
 }
 
 
@@ -652,19 +654,19 @@ dxf_idbuffer_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        idbuffer->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        idbuffer->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -693,14 +695,14 @@ dxf_idbuffer_get_entity_pointer
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (idbuffer->entity_pointer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the entity_pointer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -735,14 +737,14 @@ dxf_idbuffer_set_entity_pointer
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (entity_pointer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -776,14 +778,14 @@ dxf_idbuffer_get_next
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (idbuffer->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -817,14 +819,14 @@ dxf_idbuffer_set_next
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -858,14 +860,14 @@ dxf_idbuffer_get_last
         /* Do some basic checks. */
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (idbuffer->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfIdbuffer *) idbuffer);
@@ -899,9 +901,9 @@ dxf_idbuffer_entity_pointer_new ()
         size = sizeof (DxfIdbufferEntityPointer);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((entity_pointer = malloc (size)) == NULL)
+        if ((entity_pointer = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfIdbufferEntityPointer struct.\n")),
                   __FUNCTION__);
                 entity_pointer = NULL;
@@ -937,19 +939,19 @@ dxf_idbuffer_entity_pointer_init
         /* Do some basic checks. */
         if (entity_pointer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 entity_pointer = dxf_idbuffer_entity_pointer_new ();
         }
         if (entity_pointer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfIdbufferEntityPointer struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        entity_pointer->soft_pointer = strdup ("");
+        entity_pointer->soft_pointer = dxf_strdup ("");
         entity_pointer->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -979,13 +981,13 @@ dxf_idbuffer_entity_pointer_free
         /* Do some basic checks. */
         if (entity_pointer->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfIdbufferEntityPointer was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (entity_pointer->soft_pointer);
-        free (entity_pointer);
+        dxf_free (entity_pointer->soft_pointer);
+        dxf_free (entity_pointer);
         entity_pointer = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1006,18 +1008,19 @@ dxf_idbuffer_entity_pointer_free_chain
                  * \c DxfIdbufferEntityPointer structs. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (entity_pointers == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (entity_pointers != NULL)
         {
                 struct DxfIdbufferEntityPointer *iter = entity_pointers->next;
+                entity_pointers->next = NULL;
                 dxf_idbuffer_entity_pointer_free (entity_pointers);
                 entity_pointers = (DxfIdbufferEntityPointer *) iter;
         }
@@ -1049,14 +1052,14 @@ dxf_idbuffer_entity_pointer_get_soft_pointer
         /* Do some basic checks. */
         if (entity_pointer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (entity_pointer->soft_pointer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the soft_pointer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1064,7 +1067,7 @@ dxf_idbuffer_entity_pointer_get_soft_pointer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (entity_pointer->soft_pointer));
+        return (dxf_strdup (entity_pointer->soft_pointer));
 }
 
 
@@ -1091,19 +1094,19 @@ dxf_idbuffer_entity_pointer_set_soft_pointer
         /* Do some basic checks. */
         if (entity_pointer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (soft_pointer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        entity_pointer->soft_pointer = strdup (soft_pointer);
+        entity_pointer->soft_pointer = dxf_strdup (soft_pointer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1132,14 +1135,14 @@ dxf_idbuffer_entity_pointer_get_next
         /* Do some basic checks. */
         if (entity_pointer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (entity_pointer->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1175,14 +1178,14 @@ dxf_idbuffer_entity_pointer_set_next
         /* Do some basic checks. */
         if (entity_pointer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1217,14 +1220,14 @@ dxf_idbuffer_entity_pointer_get_last
         /* Do some basic checks. */
         if (entity_pointer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (entity_pointer->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfIdbufferEntityPointer *) entity_pointer);
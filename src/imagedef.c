@@ -43,6 +43,7 @@
 
 
 #include "imagedef.h"
+#include "util.h"
 
 
 /*!
@@ -62,9 +63,9 @@ dxf_imagedef_new ()
         size = sizeof (DxfImagedef);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((imagedef = malloc (size)) == NULL)
+        if ((imagedef = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfImagedef struct.\n")),
                   __FUNCTION__);
                 imagedef = NULL;
@@ -100,30 +101,32 @@ dxf_imagedef_init
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 imagedef = dxf_imagedef_new ();
         }
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfImagedef struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_imagedef_set_id_code (imagedef, 0);
-        dxf_imagedef_set_dictionary_owner_soft (imagedef, strdup (""));
-        dxf_imagedef_set_dictionary_owner_hard (imagedef, strdup (""));
-        dxf_imagedef_set_file_name (imagedef, strdup (""));
-        dxf_imagedef_set_x0 (imagedef, 0.0);
-        dxf_imagedef_set_y0 (imagedef, 0.0);
+        dxf_imagedef_set_dictionary_owner_soft (imagedef, dxf_strdup (""));
+        dxf_imagedef_set_dictionary_owner_hard (imagedef, dxf_strdup (""));
+        dxf_imagedef_set_file_name (imagedef, dxf_strdup (""));
+        imagedef->p0 = dxf_point_init (dxf_point_new ());
+        imagedef->p1 = dxf_point_init (dxf_point_new ());
         dxf_imagedef_set_x0 (imagedef, 0.0);
         dxf_imagedef_set_y0 (imagedef, 0.0);
+        dxf_imagedef_set_x1 (imagedef, 0.0);
+        dxf_imagedef_set_y1 (imagedef, 0.0);
         dxf_imagedef_set_class_version (imagedef, 0);
         dxf_imagedef_set_image_is_loaded_flag (imagedef, 0);
         dxf_imagedef_set_resolution_units (imagedef, 0);
-        dxf_imagedef_set_acad_image_dict_soft (imagedef, strdup (""));
+        dxf_imagedef_set_acad_image_dict_soft (imagedef, dxf_strdup (""));
         dxf_imagedef_set_imagedef_reactor (imagedef, dxf_imagedef_reactor_new ());
         dxf_imagedef_reactor_init ((DxfImagedefReactor *) dxf_imagedef_get_imagedef_reactor (imagedef)); 
         dxf_imagedef_set_next (imagedef, NULL);
@@ -157,28 +160,26 @@ dxf_imagedef_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 imagedef = dxf_imagedef_new ();
@@ -186,16 +187,15 @@ dxf_imagedef_read
         }
         i = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -203,7 +203,7 @@ dxf_imagedef_read
                 {
                         /* Now follows a string containing a file name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef->file_name);
+                        dxf_read_string (fp, &imagedef->file_name);
                 }
                 if (strcmp (temp_string, "5") == 0)
                 {
@@ -258,7 +258,7 @@ dxf_imagedef_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbRasterImageDef") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -283,7 +283,7 @@ dxf_imagedef_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef->dictionary_owner_soft);
+                        dxf_read_string (fp, &imagedef->dictionary_owner_soft);
                         i++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -292,7 +292,7 @@ dxf_imagedef_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef->acad_image_dict_soft);
+                        dxf_read_string (fp, &imagedef->acad_image_dict_soft);
                         i++;
                         /*! \todo Check for overrun of array index. */
                 }
@@ -302,7 +302,7 @@ dxf_imagedef_read
                         /* Now follows a string containing a Soft
                          * pointer reference to entity. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef->imagedef_reactor_soft[i]);
+                        dxf_read_string (fp, &imagedef->imagedef_reactor_soft[i]);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
@@ -310,7 +310,7 @@ dxf_imagedef_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef->dictionary_owner_hard);
+                        dxf_read_string (fp, &imagedef->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -321,13 +321,17 @@ dxf_imagedef_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -353,30 +357,30 @@ dxf_imagedef_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("IMAGEDEF");
+        char *dxf_entity_name = dxf_strdup ("IMAGEDEF");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, imagedef->id_code);
         }
@@ -427,14 +431,14 @@ dxf_imagedef_write
         }
         fprintf (fp->fp, " 90\n%d\n", dxf_imagedef_get_class_version (imagedef));
         fprintf (fp->fp, "  1\n%s\n", dxf_imagedef_get_file_name (imagedef));
-        fprintf (fp->fp, " 10\n%f\n", dxf_imagedef_get_x0 (imagedef));
-        fprintf (fp->fp, " 20\n%f\n", dxf_imagedef_get_y0 (imagedef));
-        fprintf (fp->fp, " 11\n%f\n", dxf_imagedef_get_x1 (imagedef));
-        fprintf (fp->fp, " 12\n%f\n", dxf_imagedef_get_y1 (imagedef));
+        dxf_write_real (fp, 10, dxf_imagedef_get_x0 (imagedef));
+        dxf_write_real (fp, 20, dxf_imagedef_get_y0 (imagedef));
+        dxf_write_real (fp, 11, dxf_imagedef_get_x1 (imagedef));
+        dxf_write_real (fp, 12, dxf_imagedef_get_y1 (imagedef));
         fprintf (fp->fp, "280\n%d\n", dxf_imagedef_get_image_is_loaded_flag (imagedef));
         fprintf (fp->fp, "281\n%d\n", dxf_imagedef_get_resolution_units (imagedef));
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -465,20 +469,22 @@ dxf_imagedef_free
         /* Do some basic checks. */
         if (imagedef->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfImagedef was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (imagedef->dictionary_owner_soft);
-        free (imagedef->dictionary_owner_hard);
-        free (imagedef->file_name);
-        free (imagedef->acad_image_dict_soft);
+        dxf_free (imagedef->dictionary_owner_soft);
+        dxf_free (imagedef->dictionary_owner_hard);
+        dxf_free (imagedef->file_name);
+        dxf_free (imagedef->acad_image_dict_soft);
+        dxf_point_free (imagedef->p0);
+        dxf_point_free (imagedef->p1);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (imagedef->imagedef_reactor_soft[i]);
+                dxf_free (imagedef->imagedef_reactor_soft[i]);
         }
-        free (imagedef);
+        dxf_free (imagedef);
         imagedef = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -498,18 +504,19 @@ dxf_imagedef_free_chain
                 /*!< pointer to the chain of DXF \c IMAGEDEF objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (imagedefs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (imagedefs != NULL)
         {
                 struct DxfImagedef *iter = imagedefs->next;
+                imagedefs->next = NULL;
                 dxf_imagedef_free (imagedefs);
                 imagedefs = (DxfImagedef *) iter;
         }
@@ -538,14 +545,14 @@ dxf_imagedef_get_id_code
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -580,14 +587,14 @@ dxf_imagedef_set_id_code
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -622,14 +629,14 @@ dxf_imagedef_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -637,7 +644,7 @@ dxf_imagedef_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->dictionary_owner_soft));
+        return (dxf_strdup (imagedef->dictionary_owner_soft));
 }
 
 
@@ -664,19 +671,19 @@ dxf_imagedef_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        imagedef->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -706,14 +713,14 @@ dxf_imagedef_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -721,7 +728,7 @@ dxf_imagedef_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->dictionary_owner_hard));
+        return (dxf_strdup (imagedef->dictionary_owner_hard));
 }
 
 
@@ -748,19 +755,19 @@ dxf_imagedef_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        imagedef->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -786,14 +793,14 @@ dxf_imagedef_get_file_name
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->file_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the file_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -801,7 +808,7 @@ dxf_imagedef_get_file_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->file_name));
+        return (dxf_strdup (imagedef->file_name));
 }
 
 
@@ -827,19 +834,19 @@ dxf_imagedef_set_file_name
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (file_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->file_name = strdup (file_name);
+        imagedef->file_name = dxf_strdup (file_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -859,20 +866,20 @@ dxf_imagedef_get_p0
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -898,20 +905,20 @@ dxf_imagedef_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -937,21 +944,21 @@ dxf_imagedef_get_x0
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -980,20 +987,20 @@ dxf_imagedef_set_x0
                  * DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1019,21 +1026,21 @@ dxf_imagedef_get_y0
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1062,20 +1069,20 @@ dxf_imagedef_set_y0
                  * DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1101,20 +1108,20 @@ dxf_imagedef_get_p1
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1141,20 +1148,20 @@ dxf_imagedef_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1180,21 +1187,21 @@ dxf_imagedef_get_x1
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1223,20 +1230,20 @@ dxf_imagedef_set_x1
                  * AutoCAD units \c x1 of a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1262,21 +1269,21 @@ dxf_imagedef_get_y1
                 /*!< a pointer to a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1305,20 +1312,20 @@ dxf_imagedef_set_y1
                  * AutoCAD units \c y1 of a DXF \c IMAGEDEF object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1350,21 +1357,21 @@ dxf_imagedef_get_class_version
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->class_version < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the class_version member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->class_version > 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the class_version member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1397,21 +1404,21 @@ dxf_imagedef_set_class_version
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class_version < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative class_version value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class_version > 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range class_version value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1443,21 +1450,21 @@ dxf_imagedef_get_image_is_loaded_flag
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->image_is_loaded_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the image_is_loaded_flag member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->image_is_loaded_flag > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the image_is_loaded_flag member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1490,21 +1497,21 @@ dxf_imagedef_set_image_is_loaded_flag
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (image_is_loaded_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative image_is_loaded_flag value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (image_is_loaded_flag > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range image_is_loaded_flag value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1536,21 +1543,21 @@ dxf_imagedef_get_resolution_units
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->resolution_units < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the resolution_units member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef->resolution_units > 5)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the resolution_units member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1583,21 +1590,21 @@ dxf_imagedef_set_resolution_units
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (resolution_units < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative resolution_units value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (resolution_units > 5)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range resolution_units value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1632,14 +1639,14 @@ dxf_imagedef_get_acad_image_dict_soft
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->acad_image_dict_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the acad_image_dict_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1647,7 +1654,7 @@ dxf_imagedef_get_acad_image_dict_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef->acad_image_dict_soft));
+        return (dxf_strdup (imagedef->acad_image_dict_soft));
 }
 
 
@@ -1674,19 +1681,19 @@ dxf_imagedef_set_acad_image_dict_soft
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (acad_image_dict_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef->acad_image_dict_soft = strdup (acad_image_dict_soft);
+        imagedef->acad_image_dict_soft = dxf_strdup (acad_image_dict_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1715,14 +1722,14 @@ dxf_imagedef_get_imagedef_reactor
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the imagedef_reactor member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1754,14 +1761,14 @@ dxf_imagedef_set_imagedef_reactor
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1795,14 +1802,14 @@ dxf_imagedef_get_next
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1833,14 +1840,14 @@ dxf_imagedef_set_next
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1874,14 +1881,14 @@ dxf_imagedef_get_last
         /* Do some basic checks. */
         if (imagedef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfImagedef *) imagedef);
@@ -44,6 +44,7 @@
 
 
 #include "imagedef_reactor.h"
+#include "util.h"
 
 
 /*!
@@ -63,9 +64,9 @@ dxf_imagedef_reactor_new ()
         size = sizeof (DxfImagedefReactor);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((imagedef_reactor = malloc (size)) == NULL)
+        if ((imagedef_reactor = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfImagedefReactor struct.\n")),
                   __FUNCTION__);
                 imagedef_reactor = NULL;
@@ -101,23 +102,23 @@ dxf_imagedef_reactor_init
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 imagedef_reactor = dxf_imagedef_reactor_new ();
         }
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfImagedefReactor struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         dxf_imagedef_reactor_set_id_code (imagedef_reactor, 0);
-        dxf_imagedef_reactor_set_dictionary_owner_soft (imagedef_reactor, strdup (""));
-        dxf_imagedef_reactor_set_dictionary_owner_hard (imagedef_reactor, strdup (""));
+        dxf_imagedef_reactor_set_dictionary_owner_soft (imagedef_reactor, dxf_strdup (""));
+        dxf_imagedef_reactor_set_dictionary_owner_hard (imagedef_reactor, dxf_strdup (""));
         dxf_imagedef_reactor_set_class_version (imagedef_reactor, 2);
-        dxf_imagedef_reactor_set_associated_image_object (imagedef_reactor, strdup (""));
+        dxf_imagedef_reactor_set_associated_image_object (imagedef_reactor, dxf_strdup (""));
         dxf_imagedef_reactor_set_associated_image_object_length (imagedef_reactor, 0);
         dxf_imagedef_reactor_set_next (imagedef_reactor, NULL);
 #if DEBUG
@@ -151,28 +152,26 @@ dxf_imagedef_reactor_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 imagedef_reactor = dxf_imagedef_reactor_new ();
@@ -180,16 +179,15 @@ dxf_imagedef_reactor_read
         }
         i = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -216,7 +214,7 @@ dxf_imagedef_reactor_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbRasterImageDef") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -227,7 +225,7 @@ dxf_imagedef_reactor_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef_reactor->dictionary_owner_soft);
+                        dxf_read_string (fp, &imagedef_reactor->dictionary_owner_soft);
                         i++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -236,7 +234,7 @@ dxf_imagedef_reactor_read
                         /* Now follows a string containing object ID for
                          * associated image object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef_reactor->associated_image_object);
+                        dxf_read_string (fp, &imagedef_reactor->associated_image_object);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
@@ -244,7 +242,7 @@ dxf_imagedef_reactor_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", imagedef_reactor->dictionary_owner_hard);
+                        dxf_read_string (fp, &imagedef_reactor->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -255,13 +253,17 @@ dxf_imagedef_reactor_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -288,30 +290,30 @@ dxf_imagedef_reactor_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("IMAGEDEF_REACTOR");
+        char *dxf_entity_name = dxf_strdup ("IMAGEDEF_REACTOR");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_imagedef_reactor_get_id_code (imagedef_reactor));
         }
@@ -356,7 +358,7 @@ dxf_imagedef_reactor_write
         fprintf (fp->fp, " 90\n%d\n", dxf_imagedef_reactor_get_class_version (imagedef_reactor));
         fprintf (fp->fp, "330\n%s\n", dxf_imagedef_reactor_get_associated_image_object (imagedef_reactor));
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -385,15 +387,15 @@ dxf_imagedef_reactor_free
         /* Do some basic checks. */
         if (imagedef_reactor->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfImagedefReactor was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (imagedef_reactor->dictionary_owner_soft);
-        free (imagedef_reactor->dictionary_owner_hard);
-        free (imagedef_reactor->associated_image_object);
-        free (imagedef_reactor);
+        dxf_free (imagedef_reactor->dictionary_owner_soft);
+        dxf_free (imagedef_reactor->dictionary_owner_hard);
+        dxf_free (imagedef_reactor->associated_image_object);
+        dxf_free (imagedef_reactor);
         imagedef_reactor = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -414,18 +416,19 @@ dxf_imagedef_reactor_free_chain
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (imagedef_reactors == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (imagedef_reactors != NULL)
         {
                 struct DxfImagedefReactor *iter = imagedef_reactors->next;
+                imagedef_reactors->next = NULL;
                 dxf_imagedef_reactor_free (imagedef_reactors);
                 imagedef_reactors = (DxfImagedefReactor *) iter;
         }
@@ -454,14 +457,14 @@ dxf_imagedef_reactor_get_id_code
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef_reactor->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -496,14 +499,14 @@ dxf_imagedef_reactor_set_id_code
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -538,14 +541,14 @@ dxf_imagedef_reactor_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef_reactor->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -553,7 +556,7 @@ dxf_imagedef_reactor_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->dictionary_owner_soft));
+        return (dxf_strdup (imagedef_reactor->dictionary_owner_soft));
 }
 
 
@@ -580,19 +583,19 @@ dxf_imagedef_reactor_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef_reactor->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        imagedef_reactor->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -622,14 +625,14 @@ dxf_imagedef_reactor_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef_reactor->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -637,7 +640,7 @@ dxf_imagedef_reactor_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->dictionary_owner_hard));
+        return (dxf_strdup (imagedef_reactor->dictionary_owner_hard));
 }
 
 
@@ -664,19 +667,19 @@ dxf_imagedef_reactor_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef_reactor->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        imagedef_reactor->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -703,21 +706,21 @@ dxf_imagedef_reactor_get_class_version
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef_reactor->class_version < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the class_version member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef_reactor->class_version > 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the class_version member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -750,21 +753,21 @@ dxf_imagedef_reactor_set_class_version
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class_version < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative class_version value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (class_version > 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range class_version value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -799,14 +802,14 @@ dxf_imagedef_reactor_get_associated_image_object
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef_reactor->associated_image_object ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the associated_image_object member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -814,7 +817,7 @@ dxf_imagedef_reactor_get_associated_image_object
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (imagedef_reactor->associated_image_object));
+        return (dxf_strdup (imagedef_reactor->associated_image_object));
 }
 
 
@@ -841,19 +844,19 @@ dxf_imagedef_reactor_set_associated_image_object
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (associated_image_object == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        imagedef_reactor->associated_image_object = strdup (associated_image_object);
+        imagedef_reactor->associated_image_object = dxf_strdup (associated_image_object);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -881,14 +884,14 @@ dxf_imagedef_reactor_get_associated_image_object_length
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (imagedef_reactor->associated_image_object_length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the associated_image_object_length member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -922,14 +925,14 @@ dxf_imagedef_reactor_set_associated_image_object_length
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (associated_image_object_length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative associated_image_object_length value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -963,14 +966,14 @@ dxf_imagedef_reactor_get_next
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef_reactor->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1002,14 +1005,14 @@ dxf_imagedef_reactor_set_next
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1043,14 +1046,14 @@ dxf_imagedef_reactor_get_last
         /* Do some basic checks. */
         if (imagedef_reactor == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (imagedef_reactor->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfImagedefReactor *) imagedef_reactor);
@@ -38,6 +38,7 @@
 
 
 #include "layer.h"
+#include "util.h"
 
 
 /*!
@@ -60,9 +61,9 @@ dxf_layer_new ()
         size = sizeof (DxfLayer);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((layer = malloc (size)) == NULL)
+        if ((layer = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfLayer struct.\n")),
                   __FUNCTION__);
                 layer = NULL;
@@ -98,29 +99,29 @@ dxf_layer_init
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 layer = dxf_layer_new ();
         }
         if (layer == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfLayer struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_layer_set_id_code (layer, 0);
-        dxf_layer_set_layer_name (layer, strdup (""));
-        dxf_layer_set_linetype (layer, strdup (DXF_DEFAULT_LINETYPE));
+        dxf_layer_set_layer_name (layer, dxf_strdup (""));
+        dxf_layer_set_linetype (layer, dxf_strdup (DXF_DEFAULT_LINETYPE));
         dxf_layer_set_color (layer, DXF_COLOR_BYLAYER);
         dxf_layer_set_flag (layer, 0);
         dxf_layer_set_plotting_flag (layer, 0);
-        dxf_layer_set_dictionary_owner_soft (layer, strdup (""));
-        dxf_layer_set_material (layer, strdup (""));
-        dxf_layer_set_dictionary_owner_hard (layer, strdup (""));
+        dxf_layer_set_dictionary_owner_soft (layer, dxf_strdup (""));
+        dxf_layer_set_material (layer, dxf_strdup (""));
+        dxf_layer_set_dictionary_owner_hard (layer, dxf_strdup (""));
         dxf_layer_set_lineweight (layer, 0);
-        dxf_layer_set_plot_style_name (layer, strdup (""));
+        dxf_layer_set_plot_style_name (layer, dxf_strdup (""));
         dxf_layer_set_next (layer, NULL);
 #if DEBUG
         DXF_DEBUG_END
@@ -152,38 +153,34 @@ dxf_layer_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 layer = dxf_layer_new ();
                 layer = dxf_layer_init (layer);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -191,14 +188,14 @@ dxf_layer_read
                         /* Now follows a string containing the layer
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->layer_name);
+                        dxf_read_string (fp, &layer->layer_name);
                 }
                 else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing the linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->linetype);
+                        dxf_read_string (fp, &layer->linetype);
                 }
                 else if (strcmp (temp_string, "62") == 0)
                 {
@@ -224,7 +221,7 @@ dxf_layer_read
                         if ((strcmp (temp_string, "AcDbSymbolTable") != 0)
                         && ((strcmp (temp_string, "AcDbLayerTableRecord") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -241,20 +238,20 @@ dxf_layer_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->dictionary_owner_soft);
+                        dxf_read_string (fp, &layer->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing the material. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->material);
+                        dxf_read_string (fp, &layer->material);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->dictionary_owner_hard);
+                        dxf_read_string (fp, &layer->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -268,7 +265,7 @@ dxf_layer_read
                         /* Now follows a string containing the plot style
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer->plot_style_name);
+                        dxf_read_string (fp, &layer->plot_style_name);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -279,27 +276,31 @@ dxf_layer_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (layer->layer_name, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () found a bad layer name in: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tskipping layer.\n")));
                 return (NULL);
         }
         if (strcmp (layer->linetype, "") == 0)
         {
-                layer->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                layer->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -325,45 +326,45 @@ dxf_layer_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LAYER");
+        char *dxf_entity_name = dxf_strdup ("LAYER");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_layer_get_layer_name (layer), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty layer string for the %s table.\n")),
                   __FUNCTION__, dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_layer_get_linetype (layer), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s layer\n")),
                   __FUNCTION__, dxf_entity_name);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_layer_set_linetype (layer, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_layer_set_linetype (layer, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -390,7 +391,7 @@ dxf_layer_write
         }
         if (fp->acad_version_number >= AutoCAD_14)
         {
-                fprintf (fp->fp, "100\nAcDbSymbolTable\n");
+                fprintf (fp->fp, "100\nAcDbSymbolTableRecord\n");
         }
         if (fp->acad_version_number >= AutoCAD_14)
         {
@@ -404,14 +405,20 @@ dxf_layer_write
         {
                 fprintf (fp->fp, "290\n%d\n", dxf_layer_get_plotting_flag (layer));
                 fprintf (fp->fp, "370\n%hd\n", dxf_layer_get_lineweight (layer));
-                fprintf (fp->fp, "390\n%s\n", dxf_layer_get_plot_style_name (layer));
+                if ((layer->plot_style_name != NULL)
+                  && (strcmp (layer->plot_style_name, "") != 0))
+                {
+                        fprintf (fp->fp, "390\n%s\n", layer->plot_style_name);
+                }
         }
-        if (fp->acad_version_number >= AutoCAD_2007)
+        if ((fp->acad_version_number >= AutoCAD_2007)
+          && (layer->material != NULL)
+          && (strcmp (layer->material, "") != 0))
         {
-                fprintf (fp->fp, "347\n%s\n", dxf_layer_get_material (layer));
+                fprintf (fp->fp, "347\n%s\n", layer->material);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -439,18 +446,18 @@ dxf_layer_free
 #endif
         if (layer->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_layer_get_layer_name (layer));
-        free (dxf_layer_get_linetype (layer));
-        free (dxf_layer_get_dictionary_owner_soft (layer));
-        free (dxf_layer_get_material (layer));
-        free (dxf_layer_get_dictionary_owner_hard (layer));
-        free (dxf_layer_get_plot_style_name (layer));
-        free (layer);
+        dxf_free (dxf_layer_get_layer_name (layer));
+        dxf_free (dxf_layer_get_linetype (layer));
+        dxf_free (dxf_layer_get_dictionary_owner_soft (layer));
+        dxf_free (dxf_layer_get_material (layer));
+        dxf_free (dxf_layer_get_dictionary_owner_hard (layer));
+        dxf_free (dxf_layer_get_plot_style_name (layer));
+        dxf_free (layer);
         layer = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -476,18 +483,19 @@ dxf_layer_free_chain
                 /*!< pointer to the chain of DXF \c LAYER tables. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (layers == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (layers != NULL)
         {
                 struct DxfLayer *iter = layers->next;
+                layers->next = NULL;
                 dxf_layer_free (layers);
                 layers = (DxfLayer *) iter;
         }
@@ -515,14 +523,14 @@ dxf_layer_get_id_code
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (layer->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -554,14 +562,14 @@ dxf_layer_set_id_code
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -592,14 +600,14 @@ dxf_layer_get_layer_name
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer->layer_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -607,7 +615,7 @@ dxf_layer_get_layer_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->layer_name));
+        return (dxf_strdup (layer->layer_name));
 }
 
 
@@ -630,19 +638,19 @@ dxf_layer_set_layer_name
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->layer_name = strdup (layer_name);
+        layer->layer_name = dxf_strdup (layer_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -668,14 +676,14 @@ dxf_layer_get_linetype
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -683,7 +691,7 @@ dxf_layer_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->linetype));
+        return (dxf_strdup (layer->linetype));
 }
 
 
@@ -705,19 +713,19 @@ dxf_layer_set_linetype
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->linetype = strdup (linetype);
+        layer->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -743,14 +751,14 @@ dxf_layer_get_color
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (layer->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -779,14 +787,14 @@ dxf_layer_set_color
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -819,7 +827,7 @@ dxf_layer_is_off
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -850,14 +858,14 @@ dxf_layer_get_flag
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (layer->flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -887,14 +895,14 @@ dxf_layer_set_flag
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -928,7 +936,7 @@ dxf_layer_is_frozen
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -963,7 +971,7 @@ dxf_layer_is_locked
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -998,7 +1006,7 @@ dxf_layer_is_xreferenced
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -1035,7 +1043,7 @@ dxf_layer_is_xresolved
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -1071,7 +1079,7 @@ dxf_layer_is_referenced
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -1102,14 +1110,14 @@ dxf_layer_get_plotting_flag
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (layer->plotting_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1139,14 +1147,14 @@ dxf_layer_set_plotting_flag
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plotting_flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1180,14 +1188,14 @@ dxf_layer_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1195,7 +1203,7 @@ dxf_layer_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->dictionary_owner_soft));
+        return (dxf_strdup (layer->dictionary_owner_soft));
 }
 
 
@@ -1219,19 +1227,19 @@ dxf_layer_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        layer->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1260,14 +1268,14 @@ dxf_layer_get_material
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1275,7 +1283,7 @@ dxf_layer_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->material));
+        return (dxf_strdup (layer->material));
 }
 
 
@@ -1301,19 +1309,19 @@ dxf_layer_set_material
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->material = strdup (material);
+        layer->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1342,14 +1350,14 @@ dxf_layer_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1357,7 +1365,7 @@ dxf_layer_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->dictionary_owner_hard));
+        return (dxf_strdup (layer->dictionary_owner_hard));
 }
 
 
@@ -1381,19 +1389,19 @@ dxf_layer_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        layer->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1420,7 +1428,7 @@ dxf_layer_get_lineweight
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1453,7 +1461,7 @@ dxf_layer_set_lineweight
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1485,14 +1493,14 @@ dxf_layer_get_plot_style_name
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1500,7 +1508,7 @@ dxf_layer_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer->plot_style_name));
+        return (dxf_strdup (layer->plot_style_name));
 }
 
 
@@ -1526,19 +1534,19 @@ dxf_layer_set_plot_style_name
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        layer->plot_style_name = strdup (plot_style_name);
+        layer->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1567,14 +1575,14 @@ dxf_layer_get_next
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1605,14 +1613,14 @@ dxf_layer_set_next
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1646,14 +1654,14 @@ dxf_layer_get_last
         /* Do some basic checks. */
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfLayer *) layer);
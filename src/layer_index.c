@@ -60,6 +60,7 @@
 
 
 #include "layer_index.h"
+#include "util.h"
 
 
 /*!
@@ -79,9 +80,9 @@ dxf_layer_index_new ()
         size = sizeof (DxfLayerIndex);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((layer_index = malloc (size)) == NULL)
+        if ((layer_index = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfLayerIndex struct.\n")),
                   __FUNCTION__);
                 layer_index = NULL;
@@ -119,29 +120,29 @@ dxf_layer_index_init
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 layer_index = dxf_layer_index_new ();
         }
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfLayerIndex struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         layer_index->id_code = 0;
-        layer_index->dictionary_owner_soft = strdup ("");
-        layer_index->dictionary_owner_hard = strdup ("");
+        layer_index->dictionary_owner_soft = dxf_strdup ("");
+        layer_index->dictionary_owner_hard = dxf_strdup ("");
         layer_index->time_stamp = 0;
         layer_index->layer_name = (DxfLayerName *) dxf_layer_name_new ();
         layer_index->layer_name = (DxfLayerName *) dxf_layer_name_init (layer_index->layer_name);
-        layer_index->layer_name->name = strdup ("");
+        layer_index->layer_name->name = dxf_strdup ("");
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
                 layer_index->number_of_entries[i] = 0;
-                layer_index->hard_owner_reference[i] = strdup ("");
+                layer_index->hard_owner_reference[i] = dxf_strdup ("");
         }
         layer_index->next = NULL;
 #if DEBUG
@@ -174,7 +175,7 @@ dxf_layer_index_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfLayerName *iter;
         int i;
         int j;
@@ -183,22 +184,20 @@ dxf_layer_index_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 layer_index = dxf_layer_index_new ();
@@ -209,16 +208,15 @@ dxf_layer_index_read
         k = 0;
         iter = (DxfLayerName *) layer_index->layer_name; /* Pointer to first entry. */
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -229,7 +227,7 @@ dxf_layer_index_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", &layer_index->id_code);
                 }
-                if (strcmp (temp_string, "8") == 0)
+                else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name
                          * (multiple entries may exist). */
@@ -239,16 +237,16 @@ dxf_layer_index_read
                                 iter = (DxfLayerName *) iter->next;
                         }
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", iter->name);
+                        dxf_read_string (fp, &iter->name);
                         i++; /* Increase number of entries. */
                 }
-                if (strcmp (temp_string, "40") == 0)
+                else if (strcmp (temp_string, "40") == 0)
                 {
                         /* Now follows a string containing a time stamp. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &layer_index->time_stamp);
                 }
-                if (strcmp (temp_string, "90") == 0)
+                else if (strcmp (temp_string, "90") == 0)
                 {
                         /* Now follows a string containing a number of
                          * entries in the LAYER_INDEX list (multiple
@@ -267,7 +265,7 @@ dxf_layer_index_read
                         if ((strcmp (temp_string, "AcDbIndex") != 0)
                           && (strcmp (temp_string, "AcDbLayerIndex") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -277,7 +275,7 @@ dxf_layer_index_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer_index->dictionary_owner_soft);
+                        dxf_read_string (fp, &layer_index->dictionary_owner_soft);
                 }
                 else if ((strcmp (temp_string, "360") == 0)
                   && (k == 0))
@@ -285,7 +283,7 @@ dxf_layer_index_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer_index->dictionary_owner_hard);
+                        dxf_read_string (fp, &layer_index->dictionary_owner_hard);
                         k++;
                 }
                 else if ((strcmp (temp_string, "360") == 0)
@@ -295,7 +293,7 @@ dxf_layer_index_read
                          * reference LAYER_INDEX (multiple entries may
                          * exist). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", layer_index->hard_owner_reference[k]);
+                        dxf_read_string (fp, &layer_index->hard_owner_reference[k]);
                         k++;
                         /*! \todo Check for overrun of array index. */
                 }
@@ -308,13 +306,17 @@ dxf_layer_index_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -340,32 +342,32 @@ dxf_layer_index_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LAYER_INDEX");
+        char *dxf_entity_name = dxf_strdup ("LAYER_INDEX");
         DxfLayerName *iter;
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, layer_index->id_code);
         }
@@ -421,7 +423,7 @@ dxf_layer_index_write
                 /*! \todo Check for overrun of array index. */
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -452,19 +454,19 @@ dxf_layer_index_free
         /* Do some basic checks. */
         if (layer_index->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfLayerIndex was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (layer_index->dictionary_owner_soft);
-        free (layer_index->dictionary_owner_hard);
+        dxf_free (layer_index->dictionary_owner_soft);
+        dxf_free (layer_index->dictionary_owner_hard);
         dxf_layer_name_free_chain (layer_index->layer_name);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (layer_index->hard_owner_reference[i]);
+                dxf_free (layer_index->hard_owner_reference[i]);
         }
-        free (layer_index);
+        dxf_free (layer_index);
         layer_index = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -484,18 +486,19 @@ dxf_layer_index_free_chain
                 /*!< pointer to the chain of DXF \c LAYER_INDEX objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (layer_indices == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (layer_indices != NULL)
         {
                 struct DxfLayerIndex *iter = layer_indices->next;
+                layer_indices->next = NULL;
                 dxf_layer_index_free (layer_indices);
                 layer_indices = (DxfLayerIndex *) iter;
         }
@@ -523,14 +526,14 @@ dxf_layer_index_get_id_code
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (layer_index->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -562,14 +565,14 @@ dxf_layer_index_set_id_code
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -603,14 +606,14 @@ dxf_layer_index_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer_index->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -618,7 +621,7 @@ dxf_layer_index_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer_index->dictionary_owner_soft));
+        return (dxf_strdup (layer_index->dictionary_owner_soft));
 }
 
 
@@ -642,19 +645,19 @@ dxf_layer_index_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_index->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        layer_index->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -683,14 +686,14 @@ dxf_layer_index_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer_index->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -698,7 +701,7 @@ dxf_layer_index_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer_index->dictionary_owner_hard));
+        return (dxf_strdup (layer_index->dictionary_owner_hard));
 }
 
 
@@ -722,19 +725,19 @@ dxf_layer_index_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_index->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        layer_index->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -760,14 +763,14 @@ dxf_layer_index_get_time_stamp
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (layer_index->time_stamp < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -797,14 +800,14 @@ dxf_layer_index_set_time_stamp
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (time_stamp < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -838,14 +841,14 @@ dxf_layer_index_get_next
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer_index->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -877,14 +880,14 @@ dxf_layer_index_set_next
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -918,14 +921,14 @@ dxf_layer_index_get_last
         /* Do some basic checks. */
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer_index->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfLayerIndex *) layer_index);
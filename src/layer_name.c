@@ -60,9 +60,9 @@ dxf_layer_name_new ()
         size = sizeof (DxfLayerName);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((layer_name = malloc (size)) == NULL)
+        if ((layer_name = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 layer_name = NULL;
@@ -98,19 +98,19 @@ dxf_layer_name_init
         /* Do some basic checks. */
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 layer_name = dxf_layer_name_new ();
         }
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_name->name = strdup ("");
+        layer_name->name = dxf_strdup ("");
         layer_name->length = 0;
         layer_name->next = NULL;
 #if DEBUG
@@ -141,13 +141,13 @@ dxf_layer_name_free
         /* Do some basic checks. */
         if (layer_name->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (layer_name->name);
-        free (layer_name);
+        dxf_free (layer_name->name);
+        dxf_free (layer_name);
         layer_name = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -167,18 +167,19 @@ dxf_layer_name_free_chain
                 /*!< pointer to the chain of DXF \c LAYER_NAME objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (layer_names == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (layer_names != NULL)
         {
                 struct DxfLayerName *iter = layer_names->next;
+                layer_names->next = NULL;
                 dxf_layer_name_free (layer_names);
                 layer_names = (DxfLayerName *) iter;
         }
@@ -208,14 +209,14 @@ dxf_layer_name_get_name
         /* Do some basic checks. */
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer_name->name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -223,7 +224,7 @@ dxf_layer_name_get_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (layer_name->name));
+        return (dxf_strdup (layer_name->name));
 }
 
 
@@ -245,19 +246,19 @@ dxf_layer_name_set_name
         /* Do some basic checks. */
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        layer_name->name = strdup (name);
+        layer_name->name = dxf_strdup (name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -284,14 +285,14 @@ dxf_layer_name_get_length
         /* Do some basic checks. */
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (layer_name->length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -322,14 +323,14 @@ dxf_layer_name_set_length
         /* Do some basic checks. */
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -363,14 +364,14 @@ dxf_layer_name_get_next
         /* Do some basic checks. */
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer_name->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -402,14 +403,14 @@ dxf_layer_name_set_next
         /* Do some basic checks. */
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -443,14 +444,14 @@ dxf_layer_name_get_last
         /* Do some basic checks. */
         if (layer_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer_name->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfLayerName *) layer_name);
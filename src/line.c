@@ -40,6 +40,8 @@
 
 
 #include "line.h"
+#include "pool.h"
+#include "util.h"
 
 
 /*!
@@ -60,11 +62,9 @@ dxf_line_new ()
         size_t size;
 
         size = sizeof (DxfLine);
-        /* avoid malloc of 0 bytes */
-        if (size == 0) size = 1;
-        if ((line = malloc (size)) == NULL)
+        if ((line = dxf_pool_alloc (DXF_POOL_LINE)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfLine struct.\n")),
                   __FUNCTION__);
                 line = NULL;
@@ -72,6 +72,8 @@ dxf_line_new ()
         else
         {
                 memset (line, 0, size);
+                line->header.type = LINE;
+                DXF_TRACING_COUNT (LINE, DXF_TRACING_ALLOCATIONS, 1);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -100,21 +102,21 @@ dxf_line_init
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_line_new ();
         }
         if (line == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfLine struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_line_set_id_code (line, 0);
-        dxf_line_set_linetype (line, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_line_set_layer (line, strdup (DXF_DEFAULT_LAYER));
+        dxf_line_set_linetype (line, DXF_DEFAULT_LINETYPE);
+        dxf_line_set_layer (line, DXF_DEFAULT_LAYER);
         dxf_line_set_elevation (line, 0.0);
         dxf_line_set_thickness (line, 0.0);
         dxf_line_set_linetype_scale (line, DXF_DEFAULT_LINETYPE_SCALE);
@@ -124,13 +126,13 @@ dxf_line_init
         dxf_line_set_graphics_data_size (line, 0);
         dxf_line_set_shadow_mode (line, 0);
         dxf_line_set_binary_graphics_data (line, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new());
-        dxf_line_set_dictionary_owner_soft (line, strdup (""));
-        dxf_line_set_material (line, strdup (""));
-        dxf_line_set_dictionary_owner_hard (line, strdup (""));
+        dxf_line_set_dictionary_owner_soft (line, "");
+        dxf_line_set_material (line, "");
+        dxf_line_set_dictionary_owner_hard (line, "");
         dxf_line_set_lineweight (line, 0);
-        dxf_line_set_plot_style_name (line, strdup (""));
+        dxf_line_set_plot_style_name (line, "");
         dxf_line_set_color_value (line, 0);
-        dxf_line_set_color_name (line, strdup (""));
+        dxf_line_set_color_name (line, "");
         dxf_line_set_transparency (line, 0);
         dxf_line_set_p0 (line, (DxfPoint *) dxf_point_new());
         dxf_point_init ((DxfPoint *) dxf_line_get_p0 (line));
@@ -138,7 +140,7 @@ dxf_line_init
         dxf_line_set_y0 (line, 0.0);
         dxf_line_set_z0 (line, 0.0);
         dxf_line_set_p1 (line, (DxfPoint *) dxf_point_new());
-        dxf_point_init ((DxfPoint *) dxf_line_get_p0 (line));
+        dxf_point_init ((DxfPoint *) dxf_line_get_p1 (line));
         dxf_line_set_x1 (line, 0.0);
         dxf_line_set_y1 (line, 0.0);
         dxf_line_set_z1 (line, 0.0);
@@ -153,6 +155,69 @@ dxf_line_init
 }
 
 
+/*!
+ * \brief Reset a DXF \c LINE entity to the values set by
+ * \c dxf_line_init (), reusing its allocated members.
+ *
+ * The start point \c p0 and the end point \c p1 stay allocated.\n
+ * The link to the next entity is kept.
+ *
+ * \return a pointer to the DXF \c LINE entity, or a newly allocated
+ * and initialized one when \c NULL was passed.
+ */
+DxfLine *
+dxf_line_reset
+(
+        DxfLine *line
+                /*!< a pointer to the DXF \c LINE entity, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (line == NULL)
+        {
+                return (dxf_line_init (dxf_line_new ()));
+        }
+        line->id_code = 0;
+        dxf_string_assign (&line->linetype, DXF_DEFAULT_LINETYPE);
+        dxf_string_assign (&line->layer, DXF_DEFAULT_LAYER);
+        line->elevation = 0.0;
+        line->thickness = 0.0;
+        line->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
+        line->visibility = DXF_DEFAULT_VISIBILITY;
+        line->color = DXF_COLOR_BYLAYER;
+        line->paperspace = DXF_MODELSPACE;
+        line->graphics_data_size = 0;
+        line->shadow_mode = 0;
+        if (line->binary_graphics_data == NULL)
+        {
+                line->binary_graphics_data = dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+        }
+        else
+        {
+                dxf_binary_graphics_data_reset (line->binary_graphics_data);
+        }
+        dxf_string_assign (&line->dictionary_owner_soft, "");
+        dxf_string_assign (&line->material, "");
+        dxf_string_assign (&line->dictionary_owner_hard, "");
+        line->lineweight = 0;
+        dxf_string_assign (&line->plot_style_name, "");
+        line->color_value = 0;
+        dxf_string_assign (&line->color_name, "");
+        line->transparency = 0;
+        line->p0 = dxf_point_reset (line->p0);
+        line->p1 = dxf_point_reset (line->p1);
+        line->extr_x0 = 0.0;
+        line->extr_y0 = 0.0;
+        line->extr_z0 = 0.0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (line);
+}
+
+
 /*!
  * \brief Read data from a DXF file into a DXF \c LINE entity.
  *
@@ -176,38 +241,37 @@ dxf_line_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
+        DxfBinaryGraphicsData *binary_graphics_data = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_line_new ();
                 line = dxf_line_init (line);
         }
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (LINE, fp);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -222,13 +286,13 @@ dxf_line_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->linetype);
+                        dxf_read_string (fp, &line->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->layer);
+                        dxf_read_string (fp, &line->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -330,7 +394,7 @@ dxf_line_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbLine") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -373,32 +437,44 @@ dxf_line_read
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
-                         * graphics data. */
+                         * graphics data, append it to the chain. */
+                        if (binary_graphics_data == NULL)
+                        {
+                                if (line->binary_graphics_data == NULL)
+                                {
+                                        line->binary_graphics_data = dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+                                }
+                                binary_graphics_data = line->binary_graphics_data;
+                        }
+                        else
+                        {
+                                binary_graphics_data->next = (struct DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+                                binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
+                        }
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) line->binary_graphics_data->next);
-                        line->binary_graphics_data = (DxfBinaryGraphicsData *) line->binary_graphics_data->next;
+                        dxf_read_string (fp, &binary_graphics_data->data_line);
+                        binary_graphics_data->length = strlen (binary_graphics_data->data_line);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->dictionary_owner_soft);
+                        dxf_read_string (fp, &line->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->material);
+                        dxf_read_string (fp, &line->material);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->dictionary_owner_hard);
+                        dxf_read_string (fp, &line->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -412,7 +488,7 @@ dxf_line_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->plot_style_name);
+                        dxf_read_string (fp, &line->plot_style_name);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -425,7 +501,7 @@ dxf_line_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", line->color_name);
+                        dxf_read_string (fp, &line->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -443,22 +519,27 @@ dxf_line_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (dxf_line_get_linetype (line), "") == 0)
+        if (strcmp (line->linetype, "") == 0)
         {
-                dxf_line_set_linetype (line, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_string_assign (&line->linetype, DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (dxf_line_get_layer (line), "") == 0)
+        if (strcmp (line->layer, "") == 0)
         {
-                dxf_line_set_layer (line, strdup (DXF_DEFAULT_LAYER));
+                dxf_string_assign (&line->layer, DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
+        DXF_TRACING_ENTITY_END (LINE, fp, trace_offset);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -484,58 +565,58 @@ dxf_line_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LINE");
+        char *dxf_entity_name = dxf_strdup ("LINE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((dxf_line_get_x0 (line) == dxf_line_get_x1 (line))
                 && (dxf_line_get_y0 (line) == dxf_line_get_y1 (line))
                 && (dxf_line_get_z0 (line) == dxf_line_get_z1 (line)))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_line_get_id_code (line));
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_line_get_linetype (line), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_line_get_id_code (line));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                dxf_line_set_linetype (line, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_line_set_linetype (line, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_line_get_layer (line), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_line_get_id_code (line));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                dxf_line_set_layer (line, strdup (DXF_DEFAULT_LAYER));
+                dxf_line_set_layer (line, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -597,15 +678,15 @@ dxf_line_write
           && DXF_FLATLAND
           && (dxf_line_get_elevation (line) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_line_get_elevation (line));
+                dxf_write_real (fp, 38, dxf_line_get_elevation (line));
         }
         if (dxf_line_get_thickness (line) != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_line_get_thickness (line));
+                dxf_write_real (fp, 39, dxf_line_get_thickness (line));
         }
         if (dxf_line_get_linetype_scale (line) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_line_get_linetype_scale (line));
+                dxf_write_real (fp, 48, dxf_line_get_linetype_scale (line));
         }
         if (dxf_line_get_visibility (line) != 0)
         {
@@ -645,23 +726,23 @@ dxf_line_write
         {
                 fprintf (fp->fp, "100\nAcDbLine\n");
         }
-        fprintf (fp->fp, " 10\n%f\n", dxf_line_get_x0 (line));
-        fprintf (fp->fp, " 20\n%f\n", dxf_line_get_y0 (line));
-        fprintf (fp->fp, " 30\n%f\n", dxf_line_get_z0 (line));
-        fprintf (fp->fp, " 11\n%f\n", dxf_line_get_x1 (line));
-        fprintf (fp->fp, " 21\n%f\n", dxf_line_get_y1 (line));
-        fprintf (fp->fp, " 31\n%f\n", dxf_line_get_z1 (line));
+        dxf_write_real (fp, 10, dxf_line_get_x0 (line));
+        dxf_write_real (fp, 20, dxf_line_get_y0 (line));
+        dxf_write_real (fp, 30, dxf_line_get_z0 (line));
+        dxf_write_real (fp, 11, dxf_line_get_x1 (line));
+        dxf_write_real (fp, 21, dxf_line_get_y1 (line));
+        dxf_write_real (fp, 31, dxf_line_get_z1 (line));
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (dxf_line_get_extr_x0 (line) != 0.0)
                 && (dxf_line_get_extr_y0 (line) != 0.0)
                 && (dxf_line_get_extr_z0 (line) != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", dxf_line_get_extr_x0 (line));
-                fprintf (fp->fp, "220\n%f\n", dxf_line_get_extr_y0 (line));
-                fprintf (fp->fp, "230\n%f\n", dxf_line_get_extr_z0 (line));
+                dxf_write_real (fp, 210, dxf_line_get_extr_x0 (line));
+                dxf_write_real (fp, 220, dxf_line_get_extr_y0 (line));
+                dxf_write_real (fp, 230, dxf_line_get_extr_z0 (line));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -687,24 +768,28 @@ dxf_line_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfAllocator *allocator;
+
         if (line->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfLine was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_line_get_linetype (line));
-        free (dxf_line_get_layer (line));
+        allocator = dxf_pool_activate_owner (line);
+        dxf_free (line->linetype);
+        dxf_free (line->layer);
         dxf_binary_graphics_data_free_chain (dxf_line_get_binary_graphics_data (line));
-        free (dxf_line_get_dictionary_owner_soft (line));
-        free (dxf_line_get_material (line));
-        free (dxf_line_get_dictionary_owner_hard (line));
-        free (dxf_line_get_plot_style_name (line));
-        free (dxf_line_get_color_name (line));
+        dxf_free (line->dictionary_owner_soft);
+        dxf_free (line->material);
+        dxf_free (line->dictionary_owner_hard);
+        dxf_free (line->plot_style_name);
+        dxf_free (line->color_name);
         dxf_point_free (dxf_line_get_p0 (line));
         dxf_point_free (dxf_line_get_p1 (line));
-        free (line);
+        dxf_pool_release (DXF_POOL_LINE, line);
+        dxf_allocator_activate (allocator);
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -724,18 +809,19 @@ dxf_line_free_chain
                 /*!< pointer to the chain of DXF \c LINE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (lines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (lines != NULL)
         {
                 struct DxfLine *iter = lines->next;
+                lines->next = NULL;
                 dxf_line_free (lines);
                 lines = (DxfLine *) iter;
         }
@@ -763,14 +849,14 @@ dxf_line_get_id_code
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -802,14 +888,14 @@ dxf_line_set_id_code
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -840,14 +926,14 @@ dxf_line_get_linetype
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -855,7 +941,7 @@ dxf_line_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->linetype));
+        return (dxf_strdup (line->linetype));
 }
 
 
@@ -877,19 +963,20 @@ dxf_line_set_linetype
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->linetype = strdup (linetype);
+        line->linetype = dxf_strdup (linetype);
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -915,14 +1002,14 @@ dxf_line_get_layer
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -930,7 +1017,7 @@ dxf_line_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->layer));
+        return (dxf_strdup (line->layer));
 }
 
 
@@ -952,19 +1039,20 @@ dxf_line_set_layer
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->layer = strdup (layer);
+        line->layer = dxf_strdup (layer);
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -990,7 +1078,7 @@ dxf_line_get_elevation
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1020,12 +1108,13 @@ dxf_line_set_elevation
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->elevation = elevation;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1051,14 +1140,14 @@ dxf_line_get_thickness
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1088,19 +1177,20 @@ dxf_line_set_thickness
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->thickness = thickness;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1126,14 +1216,14 @@ dxf_line_get_linetype_scale
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1163,19 +1253,20 @@ dxf_line_set_linetype_scale
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative linetype scale value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->linetype_scale = linetype_scale;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1201,21 +1292,21 @@ dxf_line_get_visibility
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1245,26 +1336,27 @@ dxf_line_set_visibility
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->visibility = visibility;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1290,14 +1382,14 @@ dxf_line_get_color
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1326,20 +1418,21 @@ dxf_line_set_color
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         line->color = color;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1365,20 +1458,20 @@ dxf_line_get_paperspace
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (line->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1407,26 +1500,27 @@ dxf_line_set_paperspace
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->paperspace = paperspace;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1454,20 +1548,20 @@ dxf_line_get_graphics_data_size
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
         if (line->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
@@ -1501,25 +1595,26 @@ dxf_line_set_graphics_data_size
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
         }
         line->graphics_data_size = graphics_data_size;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1546,21 +1641,21 @@ dxf_line_get_shadow_mode
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1593,26 +1688,27 @@ dxf_line_set_shadow_mode
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->shadow_mode = shadow_mode;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1641,14 +1737,14 @@ dxf_line_get_binary_graphics_data
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1680,19 +1776,20 @@ dxf_line_set_binary_graphics_data
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1721,14 +1818,14 @@ dxf_line_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1736,7 +1833,7 @@ dxf_line_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_soft));
+        return (dxf_strdup (line->dictionary_owner_soft));
 }
 
 
@@ -1760,19 +1857,20 @@ dxf_line_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        line->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1802,14 +1900,14 @@ dxf_line_get_material
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the material member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1817,7 +1915,7 @@ dxf_line_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->material));
+        return (dxf_strdup (line->material));
 }
 
 
@@ -1844,19 +1942,20 @@ dxf_line_set_material
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->material = strdup (material);
+        line->material = dxf_strdup (material);
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1885,14 +1984,14 @@ dxf_line_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1900,7 +1999,7 @@ dxf_line_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->dictionary_owner_hard));
+        return (dxf_strdup (line->dictionary_owner_hard));
 }
 
 
@@ -1924,19 +2023,20 @@ dxf_line_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        line->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1963,7 +2063,7 @@ dxf_line_get_lineweight
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1996,12 +2096,13 @@ dxf_line_set_lineweight
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->lineweight = lineweight;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2028,14 +2129,14 @@ dxf_line_get_plot_style_name
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2043,7 +2144,7 @@ dxf_line_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->plot_style_name));
+        return (dxf_strdup (line->plot_style_name));
 }
 
 
@@ -2069,19 +2170,20 @@ dxf_line_set_plot_style_name
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->plot_style_name = strdup (plot_style_name);
+        line->plot_style_name = dxf_strdup (plot_style_name);
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2108,7 +2210,7 @@ dxf_line_get_color_value
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2141,12 +2243,13 @@ dxf_line_set_color_value
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->color_value = color_value;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2173,14 +2276,14 @@ dxf_line_get_color_name
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2188,7 +2291,7 @@ dxf_line_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (line->color_name));
+        return (dxf_strdup (line->color_name));
 }
 
 
@@ -2214,19 +2317,20 @@ dxf_line_set_color_name
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        line->color_name = strdup (color_name);
+        line->color_name = dxf_strdup (color_name);
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2253,7 +2357,7 @@ dxf_line_get_transparency
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2286,12 +2390,13 @@ dxf_line_set_transparency
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->transparency = transparency;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2311,20 +2416,20 @@ dxf_line_get_p0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2350,25 +2455,26 @@ dxf_line_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->p0 = p0;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2389,21 +2495,21 @@ dxf_line_get_x0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2432,25 +2538,26 @@ dxf_line_set_x0
                  * \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->p0->x0 = x0;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2471,21 +2578,21 @@ dxf_line_get_y0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2514,25 +2621,26 @@ dxf_line_set_y0
                  * \c line entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->p0->y0 = y0;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2553,21 +2661,21 @@ dxf_line_get_z0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2596,25 +2704,26 @@ dxf_line_set_z0
                  * \c line entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->p0->z0 = z0;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2634,20 +2743,20 @@ dxf_line_get_p1
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2673,25 +2782,26 @@ dxf_line_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->p1 = p1;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2712,21 +2822,21 @@ dxf_line_get_x1
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2755,25 +2865,26 @@ dxf_line_set_x1
                  * \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->p1->x0 = x1;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2794,21 +2905,21 @@ dxf_line_get_y1
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2837,25 +2948,26 @@ dxf_line_set_y1
                  * \c line entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->p1->y0 = y1;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2876,21 +2988,21 @@ dxf_line_get_z1
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2919,25 +3031,26 @@ dxf_line_set_z1
                  * \c line entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->p1->z0 = z1;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2958,14 +3071,14 @@ dxf_line_get_extr_x0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2994,18 +3107,19 @@ dxf_line_set_extr_x0
                  * \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->extr_x0 = extr_x0;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3026,14 +3140,14 @@ dxf_line_get_extr_y0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3062,18 +3176,19 @@ dxf_line_set_extr_y0
                  * \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->extr_y0 = extr_y0;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3094,14 +3209,14 @@ dxf_line_get_extr_z0
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3130,18 +3245,19 @@ dxf_line_set_extr_z0
                  * \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         line->extr_z0 = extr_z0;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3164,7 +3280,7 @@ dxf_line_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3172,7 +3288,7 @@ dxf_line_get_extrusion_vector_as_point
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3181,7 +3297,7 @@ dxf_line_get_extrusion_vector_as_point
           && (line->p0->y0 == line->p1->y0)
           && (line->p0->z0 == line->p1->z0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a 3DLINE with points with identical coordinates were passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3189,7 +3305,7 @@ dxf_line_get_extrusion_vector_as_point
         point = dxf_point_init (point);
         if (point == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -3226,7 +3342,7 @@ dxf_line_set_extrusion_vector
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3234,6 +3350,7 @@ dxf_line_set_extrusion_vector
         line->extr_x0 = extr_x0;
         line->extr_y0 = extr_y0;
         line->extr_z0 = extr_z0;
+        line->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3262,14 +3379,14 @@ dxf_line_get_next
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3300,14 +3417,14 @@ dxf_line_set_next
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3341,14 +3458,14 @@ dxf_line_get_last
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfLine *) line);
@@ -3389,7 +3506,7 @@ dxf_line_calculate_mid_point
                  */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *point = NULL;
@@ -3397,7 +3514,7 @@ dxf_line_calculate_mid_point
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3406,7 +3523,7 @@ dxf_line_calculate_mid_point
           && (line->p0->y0 == line->p1->y0)
           && (line->p0->z0 == line->p1->z0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a 3DLINE with points with identical coordinates were passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3414,14 +3531,14 @@ dxf_line_calculate_mid_point
         point = dxf_point_init (point);
         if (point == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         if (id_code < 0)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () passed id_code is smaller than 0.\n")),
                 __FUNCTION__);
         }
@@ -3437,11 +3554,11 @@ dxf_line_calculate_mid_point
                 case 1:
                         if (line->linetype != NULL)
                         {
-                                point->linetype = strdup (line->linetype);
+                                point->linetype = dxf_strdup (line->linetype);
                         }
                         if (line->layer != NULL)
                         {
-                                point->layer = strdup (line->layer);
+                                point->layer = dxf_strdup (line->layer);
                         }
                         point->thickness = line->thickness;
                         point->linetype_scale = line->linetype_scale;
@@ -3450,18 +3567,18 @@ dxf_line_calculate_mid_point
                         point->paperspace = line->paperspace;
                         if (line->dictionary_owner_soft != NULL)
                         {
-                                point->dictionary_owner_soft = strdup (line->dictionary_owner_soft);
+                                point->dictionary_owner_soft = dxf_strdup (line->dictionary_owner_soft);
                         }
                         if (line->dictionary_owner_hard != NULL)
                         {
-                                point->dictionary_owner_hard = strdup (line->dictionary_owner_hard);
+                                point->dictionary_owner_hard = dxf_strdup (line->dictionary_owner_hard);
                         }
                         break;
                 default:
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s (): unknown inheritance option passed.\n")),
                           __FUNCTION__);
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                           (_("\tResolving to default.\n")));
                         break;
         }
@@ -3485,7 +3602,7 @@ dxf_line_calculate_length
                 /*!< a pointer to a DXF \c LINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         double length;
@@ -3493,7 +3610,7 @@ dxf_line_calculate_length
         /* Do some basic checks. */
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (0.0);
@@ -3502,7 +3619,7 @@ dxf_line_calculate_length
           && (line->p0->y0 == line->p1->y0)
           && (line->p0->z0 == line->p1->z0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () endpoints with identical coordinates were passed.\n")),
                   __FUNCTION__);
                 return (0.0);
@@ -3558,21 +3675,21 @@ dxf_line_create_from_points
         /* Do some basic checks. */
         if ((p1 == NULL) || (p2 == NULL))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if ((p1->x0 == p2->x0) && (p1->y0 == p2->y0) && (p1->z0 == p2->z0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () points with identical coordinates were passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if ((inheritance < 0) || (inheritance > 2))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an illegal inherit value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3580,14 +3697,14 @@ dxf_line_create_from_points
         line = dxf_line_init (line);
         if (line == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfLine struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         if (id_code < 0)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () passed id_code is smaller than 0.\n")),
                 __FUNCTION__);
         }
@@ -3623,25 +3740,25 @@ dxf_line_create_from_points
                         line->binary_graphics_data = p1->binary_graphics_data;
                         if (p1->dictionary_owner_soft != NULL)
                         {
-                                line->dictionary_owner_soft = strdup (p1->dictionary_owner_soft);
+                                line->dictionary_owner_soft = dxf_strdup (p1->dictionary_owner_soft);
                         }
                         if (p1->material != NULL)
                         {
-                                line->material = strdup (p1->material);
+                                line->material = dxf_strdup (p1->material);
                         }
                         if (p1->dictionary_owner_hard != NULL)
                         {
-                                line->dictionary_owner_hard = strdup (p1->dictionary_owner_hard);
+                                line->dictionary_owner_hard = dxf_strdup (p1->dictionary_owner_hard);
                         }
                         line->lineweight = p1->lineweight;
                         if (p1->plot_style_name != NULL)
                         {
-                                line->plot_style_name = strdup (p1->plot_style_name);
+                                line->plot_style_name = dxf_strdup (p1->plot_style_name);
                         }
                         line->color_value = p1->color_value;
                         if (p1->color_name != NULL)
                         {
-                                line->color_name = strdup (p1->color_name);
+                                line->color_name = dxf_strdup (p1->color_name);
                         }
                         line->transparency = p1->transparency;
                         break;
@@ -3665,33 +3782,33 @@ dxf_line_create_from_points
                         line->binary_graphics_data = p2->binary_graphics_data;
                         if (p2->dictionary_owner_soft != NULL)
                         {
-                                line->dictionary_owner_soft = strdup (p2->dictionary_owner_soft);
+                                line->dictionary_owner_soft = dxf_strdup (p2->dictionary_owner_soft);
                         }
                         if (p2->material != NULL)
                         {
-                                line->material = strdup (p2->material);
+                                line->material = dxf_strdup (p2->material);
                         }
                         if (p2->dictionary_owner_hard != NULL)
                         {
-                                line->dictionary_owner_hard = strdup (p2->dictionary_owner_hard);
+                                line->dictionary_owner_hard = dxf_strdup (p2->dictionary_owner_hard);
                         }
                         line->lineweight = p2->lineweight;
                         if (p2->plot_style_name != NULL)
                         {
-                                line->plot_style_name = strdup (p2->plot_style_name);
+                                line->plot_style_name = dxf_strdup (p2->plot_style_name);
                         }
                         line->color_value = p2->color_value;
                         if (p2->color_name != NULL)
                         {
-                                line->color_name = strdup (p2->color_name);
+                                line->color_name = dxf_strdup (p2->color_name);
                         }
                         line->transparency = p2->transparency;
                         break;
                 default:
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s (): unknown inheritance option passed.\n")),
                           __FUNCTION__);
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                           (_("\tResolving to default.\n")));
                         break;
         }
@@ -59,6 +59,9 @@ extern "C" {
 typedef struct
 dxf_line_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -210,6 +213,7 @@ dxf_line_struct
 
 DxfLine *dxf_line_new ();
 DxfLine *dxf_line_init (DxfLine *line);
+DxfLine *dxf_line_reset (DxfLine *line);
 DxfLine *dxf_line_read (DxfFile *fp, DxfLine *line);
 int dxf_line_write (DxfFile *fp, DxfLine *line);
 int dxf_line_free (DxfLine *line);
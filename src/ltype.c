@@ -40,6 +40,7 @@
 
 
 #include "ltype.h"
+#include "util.h"
 
 
 /*!
@@ -59,9 +60,9 @@ dxf_ltype_new ()
         size = sizeof (DxfLType);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ltype = malloc (size)) == NULL)
+        if ((ltype = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfArc struct.\n")),
                   __FUNCTION__);
                 ltype = NULL;
@@ -99,26 +100,26 @@ dxf_ltype_init
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ltype = dxf_ltype_new ();
         }
         if (ltype == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfLType struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_ltype_set_id_code (ltype, 0);
-        dxf_ltype_set_linetype_name (ltype, strdup (""));
-        dxf_ltype_set_description (ltype, strdup (""));
+        dxf_ltype_set_linetype_name (ltype, dxf_strdup (""));
+        dxf_ltype_set_description (ltype, dxf_strdup (""));
         dxf_ltype_set_total_pattern_length (ltype, 0.0);
         dxf_ltype_set_number_of_linetype_elements (ltype, 0);
-        for ((i = 0); (i <= DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS); i++)
+        for ((i = 0); (i < DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS); i++)
         {
-                dxf_ltype_set_complex_text_string (ltype, i, strdup (""));
+                dxf_ltype_set_complex_text_string (ltype, i, dxf_strdup (""));
                 dxf_ltype_set_complex_x_offset (ltype, i, 0.0);
                 dxf_ltype_set_complex_y_offset (ltype, i, 0.0);
                 dxf_ltype_set_complex_scale (ltype, i, 0.0);
@@ -126,12 +127,12 @@ dxf_ltype_init
                 dxf_ltype_set_complex_rotation (ltype, i, 0.0);
                 dxf_ltype_set_complex_element (ltype, i, 1);
                 dxf_ltype_set_complex_shape_number (ltype, i, 0);
-                dxf_ltype_set_complex_style_pointer (ltype, i, strdup (""));
+                dxf_ltype_set_complex_style_pointer (ltype, i, dxf_strdup (""));
         }
         dxf_ltype_set_flag (ltype, 0);
         dxf_ltype_set_alignment (ltype, 65);
-        dxf_ltype_set_dictionary_owner_soft (ltype, strdup (""));
-        dxf_ltype_set_dictionary_owner_hard (ltype, strdup (""));
+        dxf_ltype_set_dictionary_owner_soft (ltype, dxf_strdup (""));
+        dxf_ltype_set_dictionary_owner_hard (ltype, dxf_strdup (""));
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -162,22 +163,20 @@ dxf_ltype_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int element;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ltype = dxf_ltype_new ();
@@ -185,17 +184,15 @@ dxf_ltype_read
         }
         element = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -210,20 +207,20 @@ dxf_ltype_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ltype->linetype_name);
+                        dxf_read_string (fp, &ltype->linetype_name);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a description. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ltype->description);
+                        dxf_read_string (fp, &ltype->description);
                 }
                 else if (strcmp (temp_string, "9") == 0)
                 {
                         /* Now follows a string containing a complex
                          * text string (multiple entries possible). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ltype->complex_text_string[element]);
+                        dxf_read_string (fp, &ltype->complex_text_string[element]);
                 }
                 else if (strcmp (temp_string, "40") == 0)
                 {
@@ -315,21 +312,21 @@ dxf_ltype_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ltype->dictionary_owner_soft);
+                        dxf_read_string (fp, &ltype->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "340") == 0)
                 {
                         /* Now follows a string containing a complex
                          * style pointer string (multiple entries possible). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ltype->complex_style_pointer[element]);
+                        dxf_read_string (fp, &ltype->complex_style_pointer[element]);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ltype->dictionary_owner_hard);
+                        dxf_read_string (fp, &ltype->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -340,18 +337,24 @@ dxf_ltype_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ltype->linetype_name, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s (): empty linetype name string for the entity with id-code: %x\n")),
                   __FUNCTION__, ltype->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tentity is discarded from output.\n")));
                 return (NULL);
         }
@@ -359,8 +362,6 @@ dxf_ltype_read
         {
                 ltype->alignment = 65;
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -386,38 +387,38 @@ dxf_ltype_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LTYPE");
+        char *dxf_entity_name = dxf_strdup ("LTYPE");
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (ltype->linetype_name, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s (): empty linetype name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_ltype_get_id_code (ltype));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -467,25 +468,25 @@ dxf_ltype_write
         }
         fprintf (fp->fp, " 72\n%d\n", dxf_ltype_get_alignment (ltype));
         fprintf (fp->fp, " 73\n%d\n", dxf_ltype_get_number_of_linetype_elements (ltype));
-        fprintf (fp->fp, " 40\n%f\n", dxf_ltype_get_total_pattern_length (ltype));
+        dxf_write_real (fp, 40, dxf_ltype_get_total_pattern_length (ltype));
         for ((i = 0); (i < dxf_ltype_get_number_of_linetype_elements (ltype)); i++)
         {
-                fprintf (fp->fp, " 49\n%f\n", dxf_ltype_get_dash_length (ltype, i));
+                dxf_write_real (fp, 49, dxf_ltype_get_dash_length (ltype, i));
                 fprintf (fp->fp, " 74\n%d\n", dxf_ltype_get_complex_element (ltype, i));
                 switch (dxf_ltype_get_complex_element (ltype, i))
                 {
                         case 0:
                                 /* No embedded shape/text. */
-                                fprintf (fp->fp, " 44\n%f\n", dxf_ltype_get_complex_x_offset (ltype, i));
-                                fprintf (fp->fp, " 45\n%f\n", dxf_ltype_get_complex_y_offset (ltype, i));
-                                fprintf (fp->fp, " 46\n%f\n", dxf_ltype_get_complex_scale (ltype, i));
+                                dxf_write_real (fp, 44, dxf_ltype_get_complex_x_offset (ltype, i));
+                                dxf_write_real (fp, 45, dxf_ltype_get_complex_y_offset (ltype, i));
+                                dxf_write_real (fp, 46, dxf_ltype_get_complex_scale (ltype, i));
                                 fprintf (fp->fp, " 75\n0\n");
                                 break;
                         case 1:
                                 /* Specify an absolute rotation. */
-                                fprintf (fp->fp, " 44\n%f\n", dxf_ltype_get_complex_x_offset (ltype, i));
-                                fprintf (fp->fp, " 45\n%f\n", dxf_ltype_get_complex_y_offset (ltype, i));
-                                fprintf (fp->fp, " 46\n%f\n", dxf_ltype_get_complex_scale (ltype, i));
+                                dxf_write_real (fp, 44, dxf_ltype_get_complex_x_offset (ltype, i));
+                                dxf_write_real (fp, 45, dxf_ltype_get_complex_y_offset (ltype, i));
+                                dxf_write_real (fp, 46, dxf_ltype_get_complex_scale (ltype, i));
                                 fprintf (fp->fp, " 75\n0\n");
                                 fprintf (fp->fp, "340\n%s\n", dxf_ltype_get_complex_style_pointer (ltype, i));
                                 break;
@@ -495,10 +496,10 @@ dxf_ltype_write
                                  * Use a relative rotation angle.
                                  */
                                 fprintf (fp->fp, "  9\n%s\n", dxf_ltype_get_complex_text_string (ltype, i));
-                                fprintf (fp->fp, " 44\n%f\n", dxf_ltype_get_complex_x_offset (ltype, i));
-                                fprintf (fp->fp, " 45\n%f\n", dxf_ltype_get_complex_y_offset (ltype, i));
-                                fprintf (fp->fp, " 46\n%f\n", dxf_ltype_get_complex_scale (ltype, i));
-                                fprintf (fp->fp, " 50\n%f\n", dxf_ltype_get_complex_rotation (ltype, i));
+                                dxf_write_real (fp, 44, dxf_ltype_get_complex_x_offset (ltype, i));
+                                dxf_write_real (fp, 45, dxf_ltype_get_complex_y_offset (ltype, i));
+                                dxf_write_real (fp, 46, dxf_ltype_get_complex_scale (ltype, i));
+                                dxf_write_real (fp, 50, dxf_ltype_get_complex_rotation (ltype, i));
                                 fprintf (fp->fp, " 75\n0\n");
                                 fprintf (fp->fp, "340\n%s\n", dxf_ltype_get_complex_style_pointer (ltype, i));
                                 break;
@@ -508,10 +509,10 @@ dxf_ltype_write
                                  * Use an absolute rotation angle.
                                  */
                                 fprintf (fp->fp, "  9\n%s\n", dxf_ltype_get_complex_text_string (ltype, i));
-                                fprintf (fp->fp, " 44\n%f\n", dxf_ltype_get_complex_x_offset (ltype, i));
-                                fprintf (fp->fp, " 45\n%f\n", dxf_ltype_get_complex_y_offset (ltype, i));
-                                fprintf (fp->fp, " 46\n%f\n", dxf_ltype_get_complex_scale (ltype, i));
-                                fprintf (fp->fp, " 50\n%f\n", dxf_ltype_get_complex_rotation (ltype, i));
+                                dxf_write_real (fp, 44, dxf_ltype_get_complex_x_offset (ltype, i));
+                                dxf_write_real (fp, 45, dxf_ltype_get_complex_y_offset (ltype, i));
+                                dxf_write_real (fp, 46, dxf_ltype_get_complex_scale (ltype, i));
+                                dxf_write_real (fp, 50, dxf_ltype_get_complex_rotation (ltype, i));
                                 fprintf (fp->fp, " 75\n0\n");
                                 fprintf (fp->fp, "340\n%s\n", dxf_ltype_get_complex_style_pointer (ltype, i));
                                 break;
@@ -520,10 +521,10 @@ dxf_ltype_write
                                  * The complex is a shape.
                                  * Use a relative rotation angle.
                                  */
-                                fprintf (fp->fp, " 44\n%f\n", dxf_ltype_get_complex_x_offset (ltype, i));
-                                fprintf (fp->fp, " 45\n%f\n", dxf_ltype_get_complex_y_offset (ltype, i));
-                                fprintf (fp->fp, " 46\n%f\n", dxf_ltype_get_complex_scale (ltype, i));
-                                fprintf (fp->fp, " 50\n%f\n", dxf_ltype_get_complex_rotation (ltype, i));
+                                dxf_write_real (fp, 44, dxf_ltype_get_complex_x_offset (ltype, i));
+                                dxf_write_real (fp, 45, dxf_ltype_get_complex_y_offset (ltype, i));
+                                dxf_write_real (fp, 46, dxf_ltype_get_complex_scale (ltype, i));
+                                dxf_write_real (fp, 50, dxf_ltype_get_complex_rotation (ltype, i));
                                 fprintf (fp->fp, " 75\n%d\n", dxf_ltype_get_complex_shape_number (ltype, i));
                                 fprintf (fp->fp, "340\n%s\n", dxf_ltype_get_complex_style_pointer (ltype, i));
                                 break;
@@ -532,22 +533,22 @@ dxf_ltype_write
                                  * The complex is a shape.
                                  * Use an absolute rotation angle.
                                  */
-                                fprintf (fp->fp, " 44\n%f\n", dxf_ltype_get_complex_x_offset (ltype, i));
-                                fprintf (fp->fp, " 45\n%f\n", dxf_ltype_get_complex_y_offset (ltype, i));
-                                fprintf (fp->fp, " 46\n%f\n", dxf_ltype_get_complex_scale (ltype, i));
-                                fprintf (fp->fp, " 50\n%f\n", dxf_ltype_get_complex_rotation (ltype, i));
+                                dxf_write_real (fp, 44, dxf_ltype_get_complex_x_offset (ltype, i));
+                                dxf_write_real (fp, 45, dxf_ltype_get_complex_y_offset (ltype, i));
+                                dxf_write_real (fp, 46, dxf_ltype_get_complex_scale (ltype, i));
+                                dxf_write_real (fp, 50, dxf_ltype_get_complex_rotation (ltype, i));
                                 fprintf (fp->fp, " 75\n%d\n", dxf_ltype_get_complex_shape_number (ltype, i));
                                 fprintf (fp->fp, "340\n%s\n", dxf_ltype_get_complex_style_pointer (ltype, i));
                                 break;
                         default:
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s (): unknown complex element code for the %s entity with id-code: %x\n")),
                                   __FUNCTION__, dxf_entity_name, dxf_ltype_get_id_code (ltype));
                                 break;
                 }
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -577,21 +578,21 @@ dxf_ltype_free
 
         if (ltype->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfLType was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_ltype_get_linetype_name (ltype));
-        free (dxf_ltype_get_description (ltype));
-        for ((i = 0); (i <= DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS); i++)
+        dxf_free (dxf_ltype_get_linetype_name (ltype));
+        dxf_free (dxf_ltype_get_description (ltype));
+        for ((i = 0); (i < DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS); i++)
         {
-                free (dxf_ltype_get_complex_text_string (ltype, i));
-                free (dxf_ltype_get_complex_style_pointer (ltype, i));
+                dxf_free (dxf_ltype_get_complex_text_string (ltype, i));
+                dxf_free (dxf_ltype_get_complex_style_pointer (ltype, i));
         }
-        free (dxf_ltype_get_dictionary_owner_soft (ltype));
-        free (dxf_ltype_get_dictionary_owner_hard (ltype));
-        free (ltype);
+        dxf_free (dxf_ltype_get_dictionary_owner_soft (ltype));
+        dxf_free (dxf_ltype_get_dictionary_owner_hard (ltype));
+        dxf_free (ltype);
         ltype = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -612,18 +613,19 @@ dxf_ltype_free_chain
                  * entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (ltypes == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (ltypes != NULL)
         {
                 struct DxfLType *iter = ltypes->next;
+                ltypes->next = NULL;
                 dxf_ltype_free (ltypes);
                 ltypes = (DxfLType *) iter;
         }
@@ -651,14 +653,14 @@ dxf_ltype_get_id_code
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ltype->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -690,14 +692,14 @@ dxf_ltype_set_id_code
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -729,14 +731,14 @@ dxf_ltype_get_linetype_name
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ltype->linetype_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -744,7 +746,7 @@ dxf_ltype_get_linetype_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->linetype_name));
+        return (dxf_strdup (ltype->linetype_name));
 }
 
 
@@ -767,19 +769,19 @@ dxf_ltype_set_linetype_name
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->linetype_name = strdup (linetype_name);
+        ltype->linetype_name = dxf_strdup (linetype_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -806,14 +808,14 @@ dxf_ltype_get_description
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ltype->description ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -821,7 +823,7 @@ dxf_ltype_get_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->description));
+        return (dxf_strdup (ltype->description));
 }
 
 
@@ -844,19 +846,19 @@ dxf_ltype_set_description
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (description == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->description = strdup (description);
+        ltype->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -886,28 +888,28 @@ dxf_ltype_get_complex_text_string
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ltype->complex_text_string[i] ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -915,7 +917,7 @@ dxf_ltype_get_complex_text_string
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->complex_text_string[i]));
+        return (dxf_strdup (ltype->complex_text_string[i]));
 }
 
 
@@ -941,33 +943,33 @@ dxf_ltype_set_complex_text_string
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (complex_text_string == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->complex_text_string[i] = strdup (complex_text_string);
+        ltype->complex_text_string[i] = dxf_strdup (complex_text_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -993,7 +995,7 @@ dxf_ltype_get_total_pattern_length
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1024,7 +1026,7 @@ dxf_ltype_set_total_pattern_length
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1058,21 +1060,21 @@ dxf_ltype_get_complex_x_offset
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1106,21 +1108,21 @@ dxf_ltype_set_complex_x_offset
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1154,21 +1156,21 @@ dxf_ltype_get_complex_y_offset
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1202,21 +1204,21 @@ dxf_ltype_set_complex_y_offset
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1250,21 +1252,21 @@ dxf_ltype_get_complex_scale
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1298,21 +1300,21 @@ dxf_ltype_set_complex_scale
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1346,21 +1348,21 @@ dxf_ltype_get_dash_length
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1394,21 +1396,21 @@ dxf_ltype_set_dash_length
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1442,21 +1444,21 @@ dxf_ltype_get_complex_rotation
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1490,21 +1492,21 @@ dxf_ltype_set_complex_rotation
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1535,14 +1537,14 @@ dxf_ltype_get_flag
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ltype->flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1572,14 +1574,14 @@ dxf_ltype_set_flag
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1611,7 +1613,7 @@ dxf_ltype_is_xreferenced
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1645,7 +1647,7 @@ dxf_ltype_is_xresolved
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1677,7 +1679,7 @@ dxf_ltype_is_referenced
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1707,14 +1709,14 @@ dxf_ltype_get_alignment
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ltype->alignment != 65)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1744,14 +1746,14 @@ dxf_ltype_set_alignment
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (alignment != 65)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1782,14 +1784,14 @@ dxf_ltype_get_number_of_linetype_elements
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ltype->number_of_linetype_elements < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1820,14 +1822,14 @@ dxf_ltype_set_number_of_linetype_elements
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (number_of_linetype_elements < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1861,21 +1863,21 @@ dxf_ltype_get_complex_element
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1909,21 +1911,21 @@ dxf_ltype_set_complex_element
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1957,21 +1959,21 @@ dxf_ltype_get_complex_shape_number
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2005,21 +2007,21 @@ dxf_ltype_set_complex_shape_number
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2053,14 +2055,14 @@ dxf_ltype_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ltype->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2068,7 +2070,7 @@ dxf_ltype_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->dictionary_owner_soft));
+        return (dxf_strdup (ltype->dictionary_owner_soft));
 }
 
 
@@ -2092,19 +2094,19 @@ dxf_ltype_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ltype->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2134,28 +2136,28 @@ dxf_ltype_get_complex_style_pointer
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ltype->complex_style_pointer[i] ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2163,7 +2165,7 @@ dxf_ltype_get_complex_style_pointer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->complex_style_pointer[i]));
+        return (dxf_strdup (ltype->complex_style_pointer[i]));
 }
 
 
@@ -2189,33 +2191,33 @@ dxf_ltype_set_complex_style_pointer
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_NUMBER_OF_DASH_LENGTH_ITEMS)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (complex_style_pointer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->complex_style_pointer[i] = strdup (complex_style_pointer);
+        ltype->complex_style_pointer[i] = dxf_strdup (complex_style_pointer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2244,14 +2246,14 @@ dxf_ltype_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ltype->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2259,7 +2261,7 @@ dxf_ltype_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ltype->dictionary_owner_hard));
+        return (dxf_strdup (ltype->dictionary_owner_hard));
 }
 
 
@@ -2283,19 +2285,19 @@ dxf_ltype_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ltype->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ltype->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2324,14 +2326,14 @@ dxf_ltype_get_next
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ltype->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2362,14 +2364,14 @@ dxf_ltype_set_next
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2403,14 +2405,14 @@ dxf_ltype_get_last
         /* Do some basic checks. */
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ltype->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfLType *) ltype);
@@ -38,6 +38,7 @@
 
 
 #include "lwpolyline.h"
+#include "util.h"
 
 
 /*!
@@ -65,9 +66,9 @@ dxf_lwpolyline_new ()
         size = sizeof (DxfLWPolyline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((lwpolyline = malloc (size)) == NULL)
+        if ((lwpolyline = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfLWPolyline struct.\n")),
                   __FUNCTION__);
                 lwpolyline = NULL;
@@ -75,6 +76,8 @@ dxf_lwpolyline_new ()
         else
         {
                 memset (lwpolyline, 0, size);
+                lwpolyline->header.type = LWPOLYLINE;
+                DXF_TRACING_COUNT (LWPOLYLINE, DXF_TRACING_ALLOCATIONS, 1);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -109,21 +112,21 @@ dxf_lwpolyline_init
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 lwpolyline = dxf_lwpolyline_new ();
         }
         if (lwpolyline == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfLWPolyline struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         lwpolyline->id_code = 0;
-        lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+        lwpolyline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        lwpolyline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         lwpolyline->elevation = 0.0;
         lwpolyline->thickness = 0.0;
         lwpolyline->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -136,8 +139,8 @@ dxf_lwpolyline_init
         lwpolyline->extr_x0 = 0.0;
         lwpolyline->extr_y0 = 0.0;
         lwpolyline->extr_z0 = 0.0;
-        lwpolyline->dictionary_owner_soft = strdup ("");
-        lwpolyline->dictionary_owner_hard = strdup ("");
+        lwpolyline->dictionary_owner_soft = dxf_strdup ("");
+        lwpolyline->dictionary_owner_hard = dxf_strdup ("");
         lwpolyline->vertices = (struct DxfVertex *) dxf_vertex_new ();
         lwpolyline->next = NULL;
 #if DEBUG
@@ -147,6 +150,61 @@ dxf_lwpolyline_init
 }
 
 
+/*!
+ * \brief Reset a DXF \c LWPOLYLINE entity to the values set by
+ * \c dxf_lwpolyline_init (), reusing its allocated members.
+ *
+ * All vertices are reset and stay allocated, \c dxf_lwpolyline_read ()
+ * reuses them and frees the ones left over.\n
+ * The link to the next entity is kept.
+ *
+ * \return a pointer to the DXF \c LWPOLYLINE entity, or a newly allocated
+ * and initialized one when \c NULL was passed.
+ */
+DxfLWPolyline *
+dxf_lwpolyline_reset
+(
+        DxfLWPolyline *lwpolyline
+                /*!< a pointer to the DXF \c LWPOLYLINE entity, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVertex *iter = NULL;
+
+        if (lwpolyline == NULL)
+        {
+                return (dxf_lwpolyline_init (dxf_lwpolyline_new ()));
+        }
+        lwpolyline->id_code = 0;
+        dxf_string_assign (&lwpolyline->linetype, DXF_DEFAULT_LINETYPE);
+        dxf_string_assign (&lwpolyline->layer, DXF_DEFAULT_LAYER);
+        lwpolyline->elevation = 0.0;
+        lwpolyline->thickness = 0.0;
+        lwpolyline->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
+        lwpolyline->visibility = DXF_DEFAULT_VISIBILITY;
+        lwpolyline->color = DXF_COLOR_BYLAYER;
+        lwpolyline->paperspace = DXF_MODELSPACE;
+        lwpolyline->constant_width = 0.0;
+        lwpolyline->flag = 0;
+        lwpolyline->number_vertices = 0;
+        lwpolyline->extr_x0 = 0.0;
+        lwpolyline->extr_y0 = 0.0;
+        lwpolyline->extr_z0 = 0.0;
+        dxf_string_assign (&lwpolyline->dictionary_owner_soft, "");
+        dxf_string_assign (&lwpolyline->dictionary_owner_hard, "");
+        for (iter = (DxfVertex *) lwpolyline->vertices; iter != NULL; iter = (DxfVertex *) iter->next)
+        {
+                dxf_vertex_reset (iter);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lwpolyline);
+}
+
+
 /*!
  * \brief Read data from a DXF file into an \c LWPOLYLINE entity.
  *
@@ -176,35 +234,36 @@ dxf_lwpolyline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
         DxfVertex *iter = NULL;
+        int number_of_read_vertices = 0;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 lwpolyline = dxf_lwpolyline_new ();
                 lwpolyline = dxf_lwpolyline_init (lwpolyline);
         }
         iter = (DxfVertex *) lwpolyline->vertices;
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (LWPOLYLINE, fp);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
@@ -222,18 +281,35 @@ dxf_lwpolyline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", lwpolyline->linetype);
+                        dxf_read_string (fp, &lwpolyline->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", lwpolyline->layer);
+                        dxf_read_string (fp, &lwpolyline->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
                         /* Now follows a string containing the
-                        * X-coordinate of a vertex. */
+                        * X-coordinate of a vertex, which starts a new
+                        * vertex. */
+                        if (iter == NULL)
+                        {
+                                lwpolyline->vertices = (struct DxfVertex *) dxf_vertex_init (dxf_vertex_new ());
+                                iter = (DxfVertex *) lwpolyline->vertices;
+                        }
+                        else if (number_of_read_vertices > 0)
+                        {
+                                /* Reuse the vertices left by
+                                 * dxf_lwpolyline_reset (). */
+                                if (iter->next == NULL)
+                                {
+                                        iter->next = (struct DxfVertex *) dxf_vertex_init (dxf_vertex_new ());
+                                }
+                                iter = (DxfVertex *) iter->next;
+                        }
+                        number_of_read_vertices++;
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &iter->x0);
                 }
@@ -280,11 +356,6 @@ dxf_lwpolyline_read
                          * the vertex. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &iter->bulge);
-                        /* The last member of the vertex is read.\n */
-                        /*! \todo The pointer administration needs to be checked for functionality. */
-                         /* Increment iter to next DxfVertex. */
-                        iter->next = (struct DxfVertex *) dxf_vertex_new ();
-                        iter = (DxfVertex *) iter->next;
                 }
                 else if (strcmp (temp_string, "43") == 0)
                 {
@@ -372,14 +443,14 @@ dxf_lwpolyline_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", lwpolyline->dictionary_owner_soft);
+                        dxf_read_string (fp, &lwpolyline->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", lwpolyline->dictionary_owner_hard);
+                        dxf_read_string (fp, &lwpolyline->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -390,26 +461,34 @@ dxf_lwpolyline_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
+        }
+        /* Terminate the linked list of vertices, free the vertices
+         * left over. */
+        if ((iter != NULL) && (iter->next != NULL))
+        {
+                dxf_vertex_free_chain ((DxfVertex *) iter->next);
+                iter->next = NULL;
         }
-        /*! \todo Free memory to the last (unused) vertex in the linked list. */
-
-        /* Set the pointer to the last (unused) vertex in the linked list to NULL. */
-        iter->next = NULL;
         /* Handle omitted members and/or illegal values. */
         if (strcmp (lwpolyline->linetype, "") == 0)
         {
-                lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_string_assign (&lwpolyline->linetype, DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (lwpolyline->layer, "") == 0)
         {
-                lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_string_assign (&lwpolyline->layer, DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
+        DXF_TRACING_ENTITY_END (LWPOLYLINE, fp, trace_offset);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -448,61 +527,61 @@ dxf_lwpolyline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("LWPOLYLINE");
+        char *dxf_entity_name = dxf_strdup ("LWPOLYLINE");
         DxfVertex *iter = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((fp->acad_version_number < AutoCAD_14)
           && (fp->follow_strict_version_rules))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
                 return (EXIT_FAILURE);
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
         }
         if (strcmp (lwpolyline->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                lwpolyline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                lwpolyline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (lwpolyline->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, lwpolyline->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
+                lwpolyline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -553,7 +632,7 @@ dxf_lwpolyline_write
         }
         if (lwpolyline->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", lwpolyline->linetype_scale);
+                dxf_write_real (fp, 48, lwpolyline->linetype_scale);
         }
         if (lwpolyline->visibility != 0)
         {
@@ -565,39 +644,39 @@ dxf_lwpolyline_write
         }
         fprintf (fp->fp, " 90\n%d\n", lwpolyline->number_vertices);
         fprintf (fp->fp, " 70\n%d\n", lwpolyline->flag);
-        fprintf (fp->fp, " 43\n%f\n", lwpolyline->constant_width);
+        dxf_write_real (fp, 43, lwpolyline->constant_width);
         if (lwpolyline->elevation != 0.0)
         {
-                fprintf (fp->fp, " 38\n%f\n", lwpolyline->elevation);
+                dxf_write_real (fp, 38, lwpolyline->elevation);
         }
         if (lwpolyline->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", lwpolyline->thickness);
+                dxf_write_real (fp, 39, lwpolyline->thickness);
         }
         /* Start of writing (multiple) vertices. */
         iter = (DxfVertex *) lwpolyline->vertices;
         while (iter != NULL)
         {
-                fprintf (fp->fp, " 10\n%f\n", iter->x0);
-                fprintf (fp->fp, " 20\n%f\n", iter->y0);
+                dxf_write_real (fp, 10, iter->x0);
+                dxf_write_real (fp, 20, iter->y0);
                 if ((iter->start_width != lwpolyline->constant_width)
                   || (iter->end_width != lwpolyline->constant_width))
                 {
-                        fprintf (fp->fp, " 40\n%f\n", iter->start_width);
-                        fprintf (fp->fp, " 41\n%f\n", iter->end_width);
+                        dxf_write_real (fp, 40, iter->start_width);
+                        dxf_write_real (fp, 41, iter->end_width);
                 }
-                fprintf (fp->fp, " 42\n%f\n", iter->bulge);
+                dxf_write_real (fp, 42, iter->bulge);
                 iter = (DxfVertex *) iter->next;
         }
         /* End of writing (multiple) vertices. */
         if (fp->acad_version_number >= AutoCAD_12)
         {
-                fprintf (fp->fp, "210\n%f\n", lwpolyline->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", lwpolyline->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", lwpolyline->extr_z0);
+                dxf_write_real (fp, 210, lwpolyline->extr_x0);
+                dxf_write_real (fp, 220, lwpolyline->extr_y0);
+                dxf_write_real (fp, 230, lwpolyline->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -630,14 +709,20 @@ dxf_lwpolyline_free
 #endif
         if (lwpolyline->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfLWPolyline was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (lwpolyline->linetype);
-        free (lwpolyline->layer);
-        free (lwpolyline);
+        dxf_free (lwpolyline->linetype);
+        dxf_free (lwpolyline->layer);
+        dxf_free (lwpolyline->dictionary_owner_soft);
+        dxf_free (lwpolyline->dictionary_owner_hard);
+        if (lwpolyline->vertices != NULL)
+        {
+                dxf_vertex_free_chain ((DxfVertex *) lwpolyline->vertices);
+        }
+        dxf_free (lwpolyline);
         lwpolyline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -663,18 +748,19 @@ dxf_lwpolyline_free_chain
                 /*!< a pointer to the chain of DXF \c LWPOLYLINE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (lwpolylines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (lwpolylines != NULL)
         {
                 struct DxfLWPolyline *iter = lwpolylines->next;
+                lwpolylines->next = NULL;
                 dxf_lwpolyline_free (lwpolylines);
                 lwpolylines = (DxfLWPolyline *) iter;
         }
@@ -702,14 +788,14 @@ dxf_lwpolyline_get_id_code
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -741,14 +827,14 @@ dxf_lwpolyline_set_id_code
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -779,14 +865,14 @@ dxf_lwpolyline_get_linetype
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -794,7 +880,7 @@ dxf_lwpolyline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->linetype));
+        return (dxf_strdup (lwpolyline->linetype));
 }
 
 
@@ -816,19 +902,19 @@ dxf_lwpolyline_set_linetype
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->linetype = strdup (linetype);
+        lwpolyline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -854,14 +940,14 @@ dxf_lwpolyline_get_layer
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -869,7 +955,7 @@ dxf_lwpolyline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->layer));
+        return (dxf_strdup (lwpolyline->layer));
 }
 
 
@@ -891,19 +977,19 @@ dxf_lwpolyline_set_layer
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->layer = strdup (layer);
+        lwpolyline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -929,7 +1015,7 @@ dxf_lwpolyline_get_elevation
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -959,7 +1045,7 @@ dxf_lwpolyline_set_elevation
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -990,14 +1076,14 @@ dxf_lwpolyline_get_thickness
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1027,14 +1113,14 @@ dxf_lwpolyline_set_thickness
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1065,14 +1151,14 @@ dxf_lwpolyline_get_linetype_scale
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1102,14 +1188,14 @@ dxf_lwpolyline_set_linetype_scale
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1140,21 +1226,21 @@ dxf_lwpolyline_get_visibility
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1184,21 +1270,21 @@ dxf_lwpolyline_set_visibility
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1229,14 +1315,14 @@ dxf_lwpolyline_get_color
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1265,14 +1351,14 @@ dxf_lwpolyline_set_color
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1302,20 +1388,20 @@ dxf_lwpolyline_get_paperspace
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (lwpolyline->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found.\n")),
                   __FUNCTION__);
         }
@@ -1344,21 +1430,21 @@ dxf_lwpolyline_set_paperspace
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1391,20 +1477,20 @@ dxf_lwpolyline_get_graphics_data_size
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (lwpolyline->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found.\n")),
                   __FUNCTION__);
         }
@@ -1438,21 +1524,21 @@ dxf_lwpolyline_set_graphics_data_size
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1483,21 +1569,21 @@ dxf_lwpolyline_get_shadow_mode
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1530,21 +1616,21 @@ dxf_lwpolyline_set_shadow_mode
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1578,14 +1664,14 @@ dxf_lwpolyline_get_binary_graphics_data
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1617,14 +1703,14 @@ dxf_lwpolyline_set_binary_graphics_data
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1658,14 +1744,14 @@ dxf_lwpolyline_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1673,7 +1759,7 @@ dxf_lwpolyline_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->dictionary_owner_soft));
+        return (dxf_strdup (lwpolyline->dictionary_owner_soft));
 }
 
 
@@ -1697,19 +1783,19 @@ dxf_lwpolyline_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        lwpolyline->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1738,14 +1824,14 @@ dxf_lwpolyline_get_material
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1753,7 +1839,7 @@ dxf_lwpolyline_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->material));
+        return (dxf_strdup (lwpolyline->material));
 }
 
 
@@ -1780,19 +1866,19 @@ dxf_lwpolyline_set_material
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->material = strdup (material);
+        lwpolyline->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1821,14 +1907,14 @@ dxf_lwpolyline_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1836,7 +1922,7 @@ dxf_lwpolyline_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->dictionary_owner_hard));
+        return (dxf_strdup (lwpolyline->dictionary_owner_hard));
 }
 
 
@@ -1860,19 +1946,19 @@ dxf_lwpolyline_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        lwpolyline->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1899,7 +1985,7 @@ dxf_lwpolyline_get_lineweight
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1932,7 +2018,7 @@ dxf_lwpolyline_set_lineweight
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1964,14 +2050,14 @@ dxf_lwpolyline_get_plot_style_name
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1979,7 +2065,7 @@ dxf_lwpolyline_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->plot_style_name));
+        return (dxf_strdup (lwpolyline->plot_style_name));
 }
 
 
@@ -2005,19 +2091,19 @@ dxf_lwpolyline_set_plot_style_name
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->plot_style_name = strdup (plot_style_name);
+        lwpolyline->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2044,7 +2130,7 @@ dxf_lwpolyline_get_color_value
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2077,7 +2163,7 @@ dxf_lwpolyline_set_color_value
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2109,14 +2195,14 @@ dxf_lwpolyline_get_color_name
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2124,7 +2210,7 @@ dxf_lwpolyline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (lwpolyline->color_name));
+        return (dxf_strdup (lwpolyline->color_name));
 }
 
 
@@ -2150,19 +2236,19 @@ dxf_lwpolyline_set_color_name
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        lwpolyline->color_name = strdup (color_name);
+        lwpolyline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2189,7 +2275,7 @@ dxf_lwpolyline_get_transparency
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2222,7 +2308,7 @@ dxf_lwpolyline_set_transparency
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2247,21 +2333,21 @@ dxf_lwpolyline_get_constant_width
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->constant_width < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -2289,20 +2375,20 @@ dxf_lwpolyline_set_constant_width
                  * entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->constant_width < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -2332,14 +2418,14 @@ dxf_lwpolyline_get_flag
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2369,14 +2455,14 @@ dxf_lwpolyline_set_flag
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2407,14 +2493,14 @@ dxf_lwpolyline_get_number_vertices
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (lwpolyline->number_vertices < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2445,14 +2531,14 @@ dxf_lwpolyline_set_number_vertices
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (number_vertices < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2478,14 +2564,14 @@ dxf_lwpolyline_get_extr_x0
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2514,13 +2600,13 @@ dxf_lwpolyline_set_extr_x0
                  * DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2546,14 +2632,14 @@ dxf_lwpolyline_get_extr_y0
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2582,13 +2668,13 @@ dxf_lwpolyline_set_extr_y0
                  * DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2614,14 +2700,14 @@ dxf_lwpolyline_get_extr_z0
                 /*!< a pointer to a DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2650,13 +2736,13 @@ dxf_lwpolyline_set_extr_z0
                  * DXF \c LWPOLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2690,14 +2776,14 @@ dxf_lwpolyline_get_vertices
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->vertices == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the vertices member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2729,14 +2815,14 @@ dxf_lwpolyline_set_vertices
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (vertices == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2770,14 +2856,14 @@ dxf_lwpolyline_get_next
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2808,14 +2894,14 @@ dxf_lwpolyline_set_next
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2849,14 +2935,14 @@ dxf_lwpolyline_get_last
         /* Do some basic checks. */
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (lwpolyline->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfLWPolyline *) lwpolyline);
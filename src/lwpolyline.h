@@ -56,6 +56,9 @@ extern "C" {
 typedef struct
 dxf_lwpolyline_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -224,6 +227,7 @@ dxf_lwpolyline_struct
 
 DxfLWPolyline *dxf_lwpolyline_new ();
 DxfLWPolyline *dxf_lwpolyline_init (DxfLWPolyline *lwpolyline);
+DxfLWPolyline *dxf_lwpolyline_reset (DxfLWPolyline *lwpolyline);
 DxfLWPolyline *dxf_lwpolyline_read (DxfFile *fp, DxfLWPolyline *lwpolyline);
 int dxf_lwpolyline_write (DxfFile *fp, DxfLWPolyline *lwpolyline);
 int dxf_lwpolyline_free (DxfLWPolyline *lwpolyline);
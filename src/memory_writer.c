@@ -0,0 +1,210 @@
+/*!
+ * \file memory_writer.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF writers of single entities into memory.
+ *
+ * A memory writer writes one entity at a time with the writer of its
+ * type into a memory stream, the text written is compared or hashed by
+ * the caller.  The buffer is rewound for every entity, so writing many
+ * entities allocates no memory after the largest one was written.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "memory_writer.h"
+#include "entity_vtable.h"
+
+
+/*!
+ * \brief Open a memory writer writing entities for an AutoCAD version.
+ *
+ * The memory writer has to be closed with
+ * \c dxf_memory_writer_close (), also when opening failed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_writer_open
+(
+        DxfMemoryWriter *writer,
+                /*!< the memory writer. */
+        int acad_version_number
+                /*!< AutoCAD version number. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (writer == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (writer, 0, sizeof (DxfMemoryWriter));
+        writer->file.fp = open_memstream (&writer->buffer, &writer->size);
+        writer->file.filename = (char *) "";
+        writer->file.acad_version_number = acad_version_number;
+        writer->diagnostics = dxf_diagnostics_init (dxf_diagnostics_new ());
+        if ((writer->file.fp == NULL)
+          || (writer->diagnostics == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for writing the entities.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_diagnostics_set_mode (writer->diagnostics, DXF_DIAGNOSTICS_SILENT);
+        writer->file.diagnostics = (struct DxfDiagnostics *) writer->diagnostics;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Close a memory writer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_memory_writer_close
+(
+        DxfMemoryWriter *writer
+                /*!< the memory writer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (writer == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (writer->file.fp != NULL)
+        {
+                fclose (writer->file.fp);
+        }
+        /* The memory stream allocated its buffer with malloc (). */
+        free (writer->buffer);
+        if (writer->diagnostics != NULL)
+        {
+                dxf_diagnostics_free (writer->diagnostics);
+        }
+        memset (writer, 0, sizeof (DxfMemoryWriter));
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write an object into the buffer of a memory writer.
+ *
+ * The diagnostics of the writer are discarded, the buffer holds
+ * \c length characters of the object when done.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the object
+ * could not be written.
+ */
+int
+dxf_memory_writer_write
+(
+        DxfMemoryWriter *writer,
+                /*!< the memory writer. */
+        int (*write) (DxfFile *fp, void *object),
+                /*!< the writer of the object. */
+        void *object
+                /*!< a pointer to the object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDiagnostics *previous;
+        int result;
+
+        /* Do some basic checks. */
+        if ((writer == NULL)
+          || (writer->file.fp == NULL)
+          || (write == NULL)
+          || (object == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        previous = dxf_diagnostics_get_default ();
+        dxf_diagnostics_set_default (writer->diagnostics);
+        fseeko (writer->file.fp, 0, SEEK_SET);
+        result = write (&writer->file, object);
+        if (fflush (writer->file.fp) != 0)
+        {
+                result = EXIT_FAILURE;
+        }
+        writer->length = (size_t) ftello (writer->file.fp);
+        dxf_diagnostics_set_default (previous);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Write an entity into the buffer of a memory writer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the entity
+ * could not be written.
+ */
+int
+dxf_memory_writer_write_entity
+(
+        DxfMemoryWriter *writer,
+                /*!< the memory writer. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        return (dxf_memory_writer_write (writer, dxf_entity_write, entity));
+}
+
+
+/* EOF */
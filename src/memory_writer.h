@@ -0,0 +1,82 @@
+/*!
+ * \file memory_writer.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF writers of single entities into memory.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_MEMORY_WRITER_H
+#define LIBDXF_SRC_MEMORY_WRITER_H
+
+
+#include "global.h"
+#include "diagnostics.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Writer of single entities, or other objects, into memory.
+ */
+typedef struct
+dxf_memory_writer_struct
+{
+        DxfFile file;
+                /*!< Output file writing to \c buffer. */
+        char *buffer;
+                /*!< Buffer of the memory stream of \c file. */
+        size_t size;
+                /*!< Size of the memory stream of \c file. */
+        size_t length;
+                /*!< Number of characters of the last object written. */
+        DxfDiagnostics *diagnostics;
+                /*!< Silent collector of the diagnostics of the
+                 * writers. */
+} DxfMemoryWriter;
+
+
+int dxf_memory_writer_open (DxfMemoryWriter *writer, int acad_version_number);
+int dxf_memory_writer_close (DxfMemoryWriter *writer);
+int dxf_memory_writer_write (DxfMemoryWriter *writer, int (*write) (DxfFile *fp, void *object), void *object);
+int dxf_memory_writer_write_entity (DxfMemoryWriter *writer, void *entity);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_MEMORY_WRITER_H */
+
+
+/* EOF */
@@ -41,6 +41,7 @@
 
 
 #include "mlinestyle.h"
+#include "util.h"
 
 
 /*!
@@ -63,9 +64,9 @@ dxf_mlinestyle_new ()
         size = sizeof (DxfMlinestyle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((mlinestyle = malloc (size)) == NULL)
+        if ((mlinestyle = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfMlinestyle struct.\n")),
                   __FUNCTION__);
                 mlinestyle = NULL;
@@ -103,23 +104,23 @@ dxf_mlinestyle_init
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mlinestyle = dxf_mlinestyle_new ();
         }
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfMlinestyle struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        dxf_mlinestyle_set_name (mlinestyle, strdup (""));
-        dxf_mlinestyle_set_description (mlinestyle, strdup (""));
+        dxf_mlinestyle_set_name (mlinestyle, dxf_strdup (""));
+        dxf_mlinestyle_set_description (mlinestyle, dxf_strdup (""));
         dxf_mlinestyle_set_id_code (mlinestyle, 0);
-        dxf_mlinestyle_set_dictionary_owner_soft (mlinestyle, strdup (""));
-        dxf_mlinestyle_set_dictionary_owner_hard (mlinestyle, strdup (""));
+        dxf_mlinestyle_set_dictionary_owner_soft (mlinestyle, dxf_strdup (""));
+        dxf_mlinestyle_set_dictionary_owner_hard (mlinestyle, dxf_strdup (""));
         dxf_mlinestyle_set_start_angle (mlinestyle, 0.0);
         dxf_mlinestyle_set_end_angle (mlinestyle, 0.0);
         dxf_mlinestyle_set_color (mlinestyle, DXF_COLOR_BYLAYER);
@@ -127,7 +128,7 @@ dxf_mlinestyle_init
         dxf_mlinestyle_set_number_of_elements (mlinestyle, 0);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                dxf_mlinestyle_set_ith_element_linetype (mlinestyle, strdup (""), i);
+                dxf_mlinestyle_set_ith_element_linetype (mlinestyle, dxf_strdup (""), i);
                 dxf_mlinestyle_set_ith_element_offset (mlinestyle, 0.0, i);
                 dxf_mlinestyle_set_ith_element_color (mlinestyle, 0, i);
         }
@@ -162,28 +163,26 @@ dxf_mlinestyle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mlinestyle = dxf_mlinestyle_new ();
@@ -191,16 +190,15 @@ dxf_mlinestyle_read
         }
         i = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -209,45 +207,45 @@ dxf_mlinestyle_read
                         /* Now follows a string containing a mlinestyle
                          * name string. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mlinestyle->name);
+                        dxf_read_string (fp, &mlinestyle->name);
                 }
-                if (strcmp (temp_string, "3") == 0)
+                else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a description
                          * string. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mlinestyle->description);
+                        dxf_read_string (fp, &mlinestyle->description);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", &mlinestyle->id_code);
                 }
-                if (strcmp (temp_string, "6") == 0)
+                else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing an element
                          * linetype. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mlinestyle->element_linetype[i]);
+                        dxf_read_string (fp, &mlinestyle->element_linetype[i]);
                         i++;
                 }
-                if (strcmp (temp_string, "49") == 0)
+                else if (strcmp (temp_string, "49") == 0)
                 {
                         /* Now follows a string containing an element
                          * offset value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &mlinestyle->element_offset[i]);
                 }
-                if (strcmp (temp_string, "51") == 0)
+                else if (strcmp (temp_string, "51") == 0)
                 {
                         /* Now follows a string containing a start angle
                          * value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &mlinestyle->start_angle);
                 }
-                if (strcmp (temp_string, "52") == 0)
+                else if (strcmp (temp_string, "52") == 0)
                 {
                         /* Now follows a string containing a end angle
                          * value. */
@@ -271,14 +269,14 @@ dxf_mlinestyle_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &mlinestyle->element_color[i]);
                 }
-                if (strcmp (temp_string, "70") == 0)
+                else if (strcmp (temp_string, "70") == 0)
                 {
                         /* Now follows a string containing a flags
                          * value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &mlinestyle->flags);
                 }
-                if (strcmp (temp_string, "71") == 0)
+                else if (strcmp (temp_string, "71") == 0)
                 {
                         /* Now follows a string containing a number of
                          * elements value. */
@@ -294,7 +292,7 @@ dxf_mlinestyle_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbMlineStyle") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -304,14 +302,14 @@ dxf_mlinestyle_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mlinestyle->dictionary_owner_soft);
+                        dxf_read_string (fp, &mlinestyle->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", mlinestyle->dictionary_owner_hard);
+                        dxf_read_string (fp, &mlinestyle->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -322,13 +320,17 @@ dxf_mlinestyle_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -361,39 +363,39 @@ dxf_mlinestyle_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("MLINESTYLE");
+        char *dxf_entity_name = dxf_strdup ("MLINESTYLE");
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((fp->acad_version_number < AutoCAD_13)
           && (fp->follow_strict_version_rules))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mlinestyle_get_id_code (mlinestyle));
                 return (EXIT_FAILURE);
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, dxf_mlinestyle_get_id_code (mlinestyle));
         }
@@ -445,7 +447,7 @@ dxf_mlinestyle_write
                 fprintf (fp->fp, "  6\n%s\n", dxf_mlinestyle_get_ith_element_linetype (mlinestyle, i));
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -476,20 +478,20 @@ dxf_mlinestyle_free
         /* Do some basic checks. */
         if (mlinestyle->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfMlinestyle was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle));
-        free (dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle));
-        free (dxf_mlinestyle_get_name (mlinestyle));
-        free (dxf_mlinestyle_get_description (mlinestyle));
+        dxf_free (dxf_mlinestyle_get_dictionary_owner_soft (mlinestyle));
+        dxf_free (dxf_mlinestyle_get_dictionary_owner_hard (mlinestyle));
+        dxf_free (dxf_mlinestyle_get_name (mlinestyle));
+        dxf_free (dxf_mlinestyle_get_description (mlinestyle));
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (dxf_mlinestyle_get_ith_element_linetype (mlinestyle, 1));
+                dxf_free (dxf_mlinestyle_get_ith_element_linetype (mlinestyle, 1));
         }
-        free (mlinestyle);
+        dxf_free (mlinestyle);
         mlinestyle = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -509,18 +511,19 @@ dxf_mlinestyle_free_chain
                 /*!< a pointer to the chain of DXF \c MLINESTYLE objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (mlinestyles == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (mlinestyles != NULL)
         {
                 struct DxfMlinestyle *iter = mlinestyles->next;
+                mlinestyles->next = NULL;
                 dxf_mlinestyle_free (mlinestyles);
                 mlinestyles = (DxfMlinestyle *) iter;
         }
@@ -548,14 +551,14 @@ dxf_mlinestyle_get_id_code
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mlinestyle->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -587,14 +590,14 @@ dxf_mlinestyle_set_id_code
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -628,14 +631,14 @@ dxf_mlinestyle_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (mlinestyle->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -643,7 +646,7 @@ dxf_mlinestyle_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->dictionary_owner_soft));
+        return (dxf_strdup (mlinestyle->dictionary_owner_soft));
 }
 
 
@@ -667,19 +670,19 @@ dxf_mlinestyle_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        mlinestyle->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -708,14 +711,14 @@ dxf_mlinestyle_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (mlinestyle->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -723,7 +726,7 @@ dxf_mlinestyle_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->dictionary_owner_hard));
+        return (dxf_strdup (mlinestyle->dictionary_owner_hard));
 }
 
 
@@ -747,19 +750,19 @@ dxf_mlinestyle_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        mlinestyle->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -787,14 +790,14 @@ dxf_mlinestyle_get_name
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (mlinestyle->name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -802,7 +805,7 @@ dxf_mlinestyle_get_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->name));
+        return (dxf_strdup (mlinestyle->name));
 }
 
 
@@ -824,19 +827,19 @@ dxf_mlinestyle_set_name
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->name = strdup (name);
+        mlinestyle->name = dxf_strdup (name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -864,14 +867,14 @@ dxf_mlinestyle_get_description
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (mlinestyle->description ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -879,7 +882,7 @@ dxf_mlinestyle_get_description
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->description));
+        return (dxf_strdup (mlinestyle->description));
 }
 
 
@@ -902,19 +905,19 @@ dxf_mlinestyle_set_description
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (description == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->description = strdup (description);
+        mlinestyle->description = dxf_strdup (description);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -944,28 +947,28 @@ dxf_mlinestyle_get_ith_element_linetype
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative array index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_PARAM)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range array index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (mlinestyle->element_linetype[i] ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -973,7 +976,7 @@ dxf_mlinestyle_get_ith_element_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (mlinestyle->element_linetype[i]));
+        return (dxf_strdup (mlinestyle->element_linetype[i]));
 }
 
 
@@ -998,33 +1001,33 @@ dxf_mlinestyle_set_ith_element_linetype
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (element_linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative array index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_PARAM)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range array index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        mlinestyle->element_linetype[i] = strdup (element_linetype);
+        mlinestyle->element_linetype[i] = dxf_strdup (element_linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1044,21 +1047,21 @@ dxf_mlinestyle_get_element_offset
                 /*!< a pointer to a DXF \c MLINESTYLE object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mlinestyle->element_offset == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1087,20 +1090,20 @@ dxf_mlinestyle_set_element_offset
                  * be set for the object. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (element_offset == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1133,21 +1136,21 @@ dxf_mlinestyle_get_ith_element_offset
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative array index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i > DXF_MAX_PARAM)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range array index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1180,21 +1183,21 @@ dxf_mlinestyle_set_ith_element_offset
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative array index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_PARAM)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range array index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1225,7 +1228,7 @@ dxf_mlinestyle_get_start_angle
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1255,7 +1258,7 @@ dxf_mlinestyle_set_start_angle
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1286,7 +1289,7 @@ dxf_mlinestyle_get_end_angle
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1316,7 +1319,7 @@ dxf_mlinestyle_set_end_angle
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1347,14 +1350,14 @@ dxf_mlinestyle_get_color
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mlinestyle->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1383,14 +1386,14 @@ dxf_mlinestyle_set_color
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1422,21 +1425,21 @@ dxf_mlinestyle_get_ith_element_color
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative array index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (i > DXF_MAX_PARAM)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range array index was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1468,27 +1471,27 @@ dxf_mlinestyle_set_ith_element_color
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (element_color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
         if (i < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative array index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (i > DXF_MAX_PARAM)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range array index was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1519,21 +1522,21 @@ dxf_mlinestyle_get_flags
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mlinestyle->flags < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mlinestyle->flags > 2047)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1563,21 +1566,21 @@ dxf_mlinestyle_set_flags
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (flags < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (flags > 2047)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1609,7 +1612,7 @@ dxf_mlinestyle_flag_is_fill_on
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1641,7 +1644,7 @@ dxf_mlinestyle_flag_is_display_miters
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1673,7 +1676,7 @@ dxf_mlinestyle_flag_is_start_square_end_cap
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1705,7 +1708,7 @@ dxf_mlinestyle_flag_is_start_inner_arcs_cap
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1737,7 +1740,7 @@ dxf_mlinestyle_flag_is_start_round_outer_arcs_cap
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1769,7 +1772,7 @@ dxf_mlinestyle_flag_is_end_square_end_cap
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1801,7 +1804,7 @@ dxf_mlinestyle_flag_is_end_inner_arcs_cap
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1833,7 +1836,7 @@ dxf_mlinestyle_flag_is_end_round_outer_arcs_cap
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1863,14 +1866,14 @@ dxf_mlinestyle_get_number_of_elements
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (mlinestyle->number_of_elements < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1900,14 +1903,14 @@ dxf_mlinestyle_set_number_of_elements
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (number_of_elements < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1941,14 +1944,14 @@ dxf_mlinestyle_get_next
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (mlinestyle->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1979,14 +1982,14 @@ dxf_mlinestyle_set_next
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2020,14 +2023,14 @@ dxf_mlinestyle_get_last
         /* Do some basic checks. */
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (mlinestyle->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfMlinestyle *) mlinestyle);
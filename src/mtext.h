@@ -61,6 +61,9 @@ extern "C" {
 typedef struct
 dxf_mtext_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification code for the entity.\n
@@ -0,0 +1,1798 @@
+/*!
+ * \file nurbs.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF evaluation of NURBS curves.
+ *
+ * A \c DxfNurbs struct holds a curve in homogeneous coordinates and the
+ * power basis coefficients of one knot span.\n
+ * Parameters in the same knot span reuse these coefficients, so a
+ * sorted batch of parameters computes the basis functions of each span
+ * once and then evaluates every parameter with Horner's rule.\n
+ * The algorithms for knot insertion and Bézier decomposition follow
+ * "The NURBS Book" by Les Piegl and Wayne Tiller.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "nurbs.h"
+
+
+/*!
+ * \brief An end point of a parameter interval waiting to be flattened.
+ */
+typedef struct
+dxf_nurbs_interval_struct
+{
+        double t;
+                /*!< Local parameter of the end point. */
+        double point[3];
+                /*!< The end point. */
+        int depth;
+                /*!< Number of times the knot span was halved. */
+} DxfNurbsInterval;
+
+
+/*!
+ * \brief Allocate memory for a NURBS curve.
+ *
+ * \return a pointer to the NURBS curve, or \c NULL when an error
+ * occurred.
+ */
+DxfNurbs *
+dxf_nurbs_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfNurbs *nurbs = NULL;
+        size_t size;
+
+        size = sizeof (DxfNurbs);
+        if ((nurbs = dxf_malloc (size)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfNurbs struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (nurbs, 0, size);
+        nurbs->span = -1;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (nurbs);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a NURBS curve.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_nurbs_free
+(
+        DxfNurbs *nurbs
+                /*!< a pointer to the NURBS curve. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (nurbs == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (nurbs->control_points);
+        dxf_free (nurbs->knots);
+        dxf_free (nurbs);
+        nurbs = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make room for a number of control points and their knots.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_nurbs_reserve
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        int number_of_control_points
+                /*!< number of control points. */
+)
+{
+        double *control_points;
+        double *knots;
+        int capacity;
+
+        if (number_of_control_points <= nurbs->capacity)
+        {
+                return (EXIT_SUCCESS);
+        }
+        capacity = (nurbs->capacity == 0) ? 64 : 2 * nurbs->capacity;
+        if (capacity < number_of_control_points)
+        {
+                capacity = number_of_control_points;
+        }
+        control_points = dxf_realloc (nurbs->control_points, 4 * capacity * sizeof (double));
+        if (control_points == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        nurbs->control_points = control_points;
+        knots = dxf_realloc (nurbs->knots, (capacity + DXF_NURBS_MAX_DEGREE + 1) * sizeof (double));
+        if (knots == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        nurbs->knots = knots;
+        nurbs->capacity = capacity;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Check the degree and the knot vector of a NURBS curve.
+ *
+ * \return \c EXIT_SUCCESS when the curve can be evaluated, or
+ * \c EXIT_FAILURE otherwise.
+ */
+static int
+dxf_nurbs_check
+(
+        DxfNurbs *nurbs
+                /*!< a pointer to the NURBS curve. */
+)
+{
+        int p = nurbs->degree;
+        int n = nurbs->number_of_control_points;
+        int i;
+
+        if ((p < 1) || (p > DXF_NURBS_MAX_DEGREE) || (n < p + 1))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < n + p; i++)
+        {
+                if (!(nurbs->knots[i] <= nurbs->knots[i + 1]))
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (!(nurbs->knots[p] < nurbs->knots[n]))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < n; i++)
+        {
+                if (!(nurbs->control_points[4 * i + 3] > 0.0))
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the control points, weights and knots of a NURBS curve.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_nurbs_set
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        int degree,
+                /*!< degree of the curve. */
+        int number_of_control_points,
+                /*!< number of control points. */
+        const double *control_points,
+                /*!< control points, 3 values per control point. */
+        const double *weights,
+                /*!< weights of the control points, or \c NULL for a
+                 * non rational curve. */
+        const double *knots
+                /*!< \c number_of_control_points + \c degree + 1 knots,
+                 * or \c NULL for a clamped uniform knot vector on the
+                 * interval [0, 1]. */
+)
+{
+        double w;
+        int i;
+
+        if ((nurbs == NULL) || (control_points == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((degree < 1) || (degree > DXF_NURBS_MAX_DEGREE)
+          || (number_of_control_points < degree + 1))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an invalid degree or number of control points was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_nurbs_reserve (nurbs, number_of_control_points) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the control points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        nurbs->degree = degree;
+        nurbs->number_of_control_points = number_of_control_points;
+        nurbs->span = -1;
+        for (i = 0; i < number_of_control_points; i++)
+        {
+                w = (weights != NULL) ? weights[i] : 1.0;
+                nurbs->control_points[4 * i] = control_points[3 * i] * w;
+                nurbs->control_points[4 * i + 1] = control_points[3 * i + 1] * w;
+                nurbs->control_points[4 * i + 2] = control_points[3 * i + 2] * w;
+                nurbs->control_points[4 * i + 3] = w;
+        }
+        for (i = 0; i < number_of_control_points + degree + 1; i++)
+        {
+                if (knots != NULL)
+                {
+                        nurbs->knots[i] = knots[i];
+                }
+                else if (i <= degree)
+                {
+                        nurbs->knots[i] = 0.0;
+                }
+                else if (i >= number_of_control_points)
+                {
+                        nurbs->knots[i] = 1.0;
+                }
+                else
+                {
+                        nurbs->knots[i] = (double) (i - degree)
+                          / (double) (number_of_control_points - degree);
+                }
+        }
+        if (dxf_nurbs_check (nurbs) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an invalid knot vector or weight was passed.\n")),
+                  __FUNCTION__);
+                nurbs->number_of_control_points = 0;
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set a NURBS curve from the control points of a DXF \c SPLINE
+ * entity.
+ *
+ * Weights which are not set (0.0) are taken as 1.0.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the spline
+ * has no valid control points and knots or when an error occurred.
+ */
+int
+dxf_nurbs_set_spline
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        DxfSpline *spline
+                /*!< a pointer to the DXF \c SPLINE entity. */
+)
+{
+        DxfPoint *point;
+        double w;
+        int n;
+        int p;
+        int i;
+
+        if ((nurbs == NULL) || (spline == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        n = spline->number_of_control_points;
+        p = spline->degree;
+        if ((p < 1) || (p > DXF_NURBS_MAX_DEGREE) || (n < p + 1)
+          || (n > DXF_MAX_PARAM) || (spline->number_of_knots != n + p + 1))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the spline has an invalid degree, number of control points or number of knots.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_nurbs_reserve (nurbs, n) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the control points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        nurbs->degree = p;
+        nurbs->number_of_control_points = n;
+        nurbs->span = -1;
+        point = spline->p0;
+        for (i = 0; i < n; i++)
+        {
+                if (point == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () the spline has less control points than expected.\n")),
+                          __FUNCTION__);
+                        nurbs->number_of_control_points = 0;
+                        return (EXIT_FAILURE);
+                }
+                w = (spline->weight_value[i] > 0.0) ? spline->weight_value[i] : 1.0;
+                nurbs->control_points[4 * i] = point->x0 * w;
+                nurbs->control_points[4 * i + 1] = point->y0 * w;
+                nurbs->control_points[4 * i + 2] = point->z0 * w;
+                nurbs->control_points[4 * i + 3] = w;
+                point = (DxfPoint *) point->next;
+        }
+        memcpy (nurbs->knots, spline->knot_value, (n + p + 1) * sizeof (double));
+        if (dxf_nurbs_check (nurbs) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the spline has an invalid knot vector.\n")),
+                  __FUNCTION__);
+                nurbs->number_of_control_points = 0;
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+
+/*!
+ * \brief Set a NURBS curve from a DXF \c HATCH boundary path spline
+ * edge.
+ *
+ * The control points get a Z-value of 0.0, weights which are not set
+ * (0.0) are taken as 1.0.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the edge
+ * has no valid control points and knots or when an error occurred.
+ */
+int
+dxf_nurbs_set_hatch_spline
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        DxfHatchBoundaryPathEdgeSpline *spline
+                /*!< a pointer to the DXF \c HATCH boundary path spline
+                 * edge. */
+)
+{
+        DxfHatchBoundaryPathEdgeSplineCp *control_point;
+        double w;
+        int n;
+        int p;
+        int i;
+
+        if ((nurbs == NULL) || (spline == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        n = spline->number_of_control_points;
+        p = spline->degree;
+        if ((p < 1) || (p > DXF_NURBS_MAX_DEGREE) || (n < p + 1)
+          || (spline->number_of_knots != n + p + 1)
+          || (n + p + 1 > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the spline has an invalid degree, number of control points or number of knots.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_nurbs_reserve (nurbs, n) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the control points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        nurbs->degree = p;
+        nurbs->number_of_control_points = n;
+        nurbs->span = -1;
+        control_point = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points;
+        for (i = 0; i < n; i++)
+        {
+                if (control_point == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () the spline has less control points than expected.\n")),
+                          __FUNCTION__);
+                        nurbs->number_of_control_points = 0;
+                        return (EXIT_FAILURE);
+                }
+                w = (control_point->weight > 0.0) ? control_point->weight : 1.0;
+                nurbs->control_points[4 * i] = control_point->x0 * w;
+                nurbs->control_points[4 * i + 1] = control_point->y0 * w;
+                nurbs->control_points[4 * i + 2] = 0.0;
+                nurbs->control_points[4 * i + 3] = w;
+                control_point = (DxfHatchBoundaryPathEdgeSplineCp *) control_point->next;
+        }
+        memcpy (nurbs->knots, spline->knots, (n + p + 1) * sizeof (double));
+        if (dxf_nurbs_check (nurbs) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the spline has an invalid knot vector.\n")),
+                  __FUNCTION__);
+                nurbs->number_of_control_points = 0;
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+/*!
+ * \brief Get the parameter interval of a NURBS curve.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_nurbs_get_domain
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        double *start,
+                /*!< start parameter of the curve. */
+        double *end
+                /*!< end parameter of the curve. */
+)
+{
+        if ((nurbs == NULL) || (start == NULL) || (end == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (nurbs->number_of_control_points == 0)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the curve has no control points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        *start = nurbs->knots[nurbs->degree];
+        *end = nurbs->knots[nurbs->number_of_control_points];
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find the knot span of a parameter, trying the cached span
+ * first.
+ *
+ * Parameters outside the domain are clamped to the first or last knot
+ * span.
+ *
+ * \return the index of the knot span.
+ */
+static int
+dxf_nurbs_locate
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        double u
+                /*!< parameter. */
+)
+{
+        const double *knots = nurbs->knots;
+        int n = nurbs->number_of_control_points;
+        int low;
+        int high;
+        int middle;
+
+        if ((nurbs->span >= 0)
+          && (knots[nurbs->span] <= u) && (u < knots[nurbs->span + 1]))
+        {
+                return (nurbs->span);
+        }
+        low = nurbs->degree;
+        high = n;
+        if (u >= knots[n])
+        {
+                /* The end of the domain belongs to the last non empty
+                 * knot span. */
+                low = n - 1;
+                while (knots[low] == knots[n])
+                {
+                        low--;
+                }
+                return (low);
+        }
+        /* knots[low] <= u < knots[high], or u is before the domain. */
+        while (high - low > 1)
+        {
+                middle = (low + high) / 2;
+                if (u < knots[middle])
+                {
+                        high = middle;
+                }
+                else
+                {
+                        low = middle;
+                }
+        }
+        return (low);
+}
+
+
+/*!
+ * \brief Find the knot span of a parameter.
+ *
+ * \return the index i of the knot span [knots[i], knots[i + 1]) holding
+ * the parameter, or -1 when an error occurred.
+ */
+int
+dxf_nurbs_find_span
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        double u
+                /*!< parameter. */
+)
+{
+        if (nurbs == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (nurbs->number_of_control_points == 0)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the curve has no control points.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        return (dxf_nurbs_locate (nurbs, u));
+}
+
+
+/*!
+ * \brief Compute and cache the power basis coefficients of a knot span.
+ *
+ * The non zero basis functions of the span are built as polynomials in
+ * the local parameter with the Cox-de Boor recursion, and summed with
+ * the homogeneous control points.
+ */
+static void
+dxf_nurbs_cache_span
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        int span
+                /*!< index of a non empty knot span. */
+)
+{
+        double basis[DXF_NURBS_MAX_DEGREE + 1][DXF_NURBS_MAX_DEGREE + 1];
+        double previous[DXF_NURBS_MAX_DEGREE + 1][DXF_NURBS_MAX_DEGREE + 1];
+        const double *knots = nurbs->knots;
+        const double *control_point;
+        int p = nurbs->degree;
+        double a = knots[span];
+        double h = knots[span + 1] - knots[span];
+        double denominator;
+        double c0;
+        double c1;
+        int d;
+        int i;
+        int j;
+        int k;
+
+        if (nurbs->span == span)
+        {
+                return;
+        }
+        memset (basis, 0, sizeof (basis));
+        basis[0][0] = 1.0;
+        for (d = 1; d <= p; d++)
+        {
+                memcpy (previous, basis, sizeof (basis));
+                for (j = 0; j <= d; j++)
+                {
+                        memset (basis[j], 0, (d + 1) * sizeof (double));
+                        i = span - d + j;
+                        /* (u - knots[i]) / (knots[i + d] - knots[i])
+                         * times N(i, d - 1). */
+                        denominator = knots[i + d] - knots[i];
+                        if ((j >= 1) && (denominator > 0.0))
+                        {
+                                c0 = (a - knots[i]) / denominator;
+                                c1 = h / denominator;
+                                for (k = 0; k < d; k++)
+                                {
+                                        basis[j][k] += c0 * previous[j - 1][k];
+                                        basis[j][k + 1] += c1 * previous[j - 1][k];
+                                }
+                        }
+                        /* (knots[i + d + 1] - u) / (knots[i + d + 1] -
+                         * knots[i + 1]) times N(i + 1, d - 1). */
+                        denominator = knots[i + d + 1] - knots[i + 1];
+                        if ((j < d) && (denominator > 0.0))
+                        {
+                                c0 = (knots[i + d + 1] - a) / denominator;
+                                c1 = -h / denominator;
+                                for (k = 0; k < d; k++)
+                                {
+                                        basis[j][k] += c0 * previous[j][k];
+                                        basis[j][k + 1] += c1 * previous[j][k];
+                                }
+                        }
+                }
+        }
+        memset (nurbs->coefficients, 0, sizeof (nurbs->coefficients));
+        for (j = 0; j <= p; j++)
+        {
+                control_point = nurbs->control_points + 4 * (span - p + j);
+                for (k = 0; k <= p; k++)
+                {
+                        nurbs->coefficients[4 * k] += basis[j][k] * control_point[0];
+                        nurbs->coefficients[4 * k + 1] += basis[j][k] * control_point[1];
+                        nurbs->coefficients[4 * k + 2] += basis[j][k] * control_point[2];
+                        nurbs->coefficients[4 * k + 3] += basis[j][k] * control_point[3];
+                }
+        }
+        nurbs->span = span;
+}
+
+
+/*!
+ * \brief Evaluate the cached knot span at a local parameter.
+ */
+static void
+dxf_nurbs_evaluate_span
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        double t,
+                /*!< local parameter in the cached knot span. */
+        double *point
+                /*!< the point, 3 values. */
+)
+{
+        const double *c = nurbs->coefficients;
+        double x = 0.0;
+        double y = 0.0;
+        double z = 0.0;
+        double w = 0.0;
+        int k;
+
+        for (k = nurbs->degree; k >= 0; k--)
+        {
+                x = x * t + c[4 * k];
+                y = y * t + c[4 * k + 1];
+                z = z * t + c[4 * k + 2];
+                w = w * t + c[4 * k + 3];
+        }
+        point[0] = x / w;
+        point[1] = y / w;
+        point[2] = z / w;
+}
+
+
+/*!
+ * \brief Evaluate a NURBS curve at a batch of parameters.
+ *
+ * Sorted parameters are the fastest, as the basis functions of a knot
+ * span are computed once for all parameters in the span.\n
+ * Parameters outside the domain are extrapolated from the first or last
+ * knot span.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_nurbs_evaluate
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        const double *parameters,
+                /*!< parameters to evaluate. */
+        size_t number_of_parameters,
+                /*!< number of parameters. */
+        double *points
+                /*!< the points, 3 values per parameter. */
+)
+{
+        double u;
+        size_t i;
+        int span;
+
+        if ((nurbs == NULL) || (parameters == NULL) || (points == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (nurbs->number_of_control_points == 0)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the curve has no control points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_of_parameters; i++)
+        {
+                u = parameters[i];
+                span = dxf_nurbs_locate (nurbs, u);
+                dxf_nurbs_cache_span (nurbs, span);
+                dxf_nurbs_evaluate_span (nurbs,
+                  (u - nurbs->knots[span]) / (nurbs->knots[span + 1] - nurbs->knots[span]),
+                  points + 3 * i);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Evaluate a NURBS curve and its derivatives at a batch of
+ * parameters.
+ *
+ * For every parameter the point and the first up to the \c order-th
+ * derivative with respect to the parameter are written, 3 values each.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_nurbs_evaluate_derivatives
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        const double *parameters,
+                /*!< parameters to evaluate. */
+        size_t number_of_parameters,
+                /*!< number of parameters. */
+        int order,
+                /*!< highest derivative, at most
+                 * \c DXF_NURBS_MAX_DEGREE. */
+        double *derivatives
+                /*!< the derivatives, 3 * (\c order + 1) values per
+                 * parameter. */
+)
+{
+        double a[DXF_NURBS_MAX_DEGREE + 1][4];
+        const double *c;
+        double *d;
+        double u;
+        double t;
+        double h;
+        double scale;
+        double factor;
+        double binomial;
+        size_t i;
+        int span;
+        int r;
+        int k;
+        int m;
+
+        if ((nurbs == NULL) || (parameters == NULL) || (derivatives == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (nurbs->number_of_control_points == 0)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the curve has no control points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((order < 0) || (order > DXF_NURBS_MAX_DEGREE))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () an invalid order was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        c = nurbs->coefficients;
+        for (i = 0; i < number_of_parameters; i++)
+        {
+                u = parameters[i];
+                span = dxf_nurbs_locate (nurbs, u);
+                dxf_nurbs_cache_span (nurbs, span);
+                h = nurbs->knots[span + 1] - nurbs->knots[span];
+                t = (u - nurbs->knots[span]) / h;
+                /* Derivatives of the homogeneous curve, the r-th
+                 * derivative of t^k is k! / (k - r)! t^(k - r). */
+                scale = 1.0;
+                for (r = 0; r <= order; r++)
+                {
+                        a[r][0] = a[r][1] = a[r][2] = a[r][3] = 0.0;
+                        for (k = nurbs->degree; k >= r; k--)
+                        {
+                                factor = 1.0;
+                                for (m = k - r + 1; m <= k; m++)
+                                {
+                                        factor *= m;
+                                }
+                                a[r][0] = a[r][0] * t + factor * c[4 * k];
+                                a[r][1] = a[r][1] * t + factor * c[4 * k + 1];
+                                a[r][2] = a[r][2] * t + factor * c[4 * k + 2];
+                                a[r][3] = a[r][3] * t + factor * c[4 * k + 3];
+                        }
+                        a[r][0] *= scale;
+                        a[r][1] *= scale;
+                        a[r][2] *= scale;
+                        a[r][3] *= scale;
+                        scale /= h;
+                }
+                /* Quotient rule: C(r) = (A(r) - sum of binomial (r, k)
+                 * w(k) C(r - k) for k = 1 .. r) / w. */
+                d = derivatives + 3 * (order + 1) * i;
+                for (r = 0; r <= order; r++)
+                {
+                        d[3 * r] = a[r][0];
+                        d[3 * r + 1] = a[r][1];
+                        d[3 * r + 2] = a[r][2];
+                        binomial = 1.0;
+                        for (k = 1; k <= r; k++)
+                        {
+                                binomial = binomial * (r - k + 1) / k;
+                                d[3 * r] -= binomial * a[k][3] * d[3 * (r - k)];
+                                d[3 * r + 1] -= binomial * a[k][3] * d[3 * (r - k) + 1];
+                                d[3 * r + 2] -= binomial * a[k][3] * d[3 * (r - k) + 2];
+                        }
+                        d[3 * r] /= a[0][3];
+                        d[3 * r + 1] /= a[0][3];
+                        d[3 * r + 2] /= a[0][3];
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the square of the distance between a point and a line
+ * segment.
+ *
+ * \return the squared distance.
+ */
+static double
+dxf_nurbs_distance2
+(
+        const double *point,
+                /*!< the point. */
+        const double *start,
+                /*!< start point of the segment. */
+        const double *end
+                /*!< end point of the segment. */
+)
+{
+        double d[3];
+        double v[3];
+        double length2;
+        double s;
+        int i;
+
+        length2 = 0.0;
+        s = 0.0;
+        for (i = 0; i < 3; i++)
+        {
+                d[i] = end[i] - start[i];
+                v[i] = point[i] - start[i];
+                length2 += d[i] * d[i];
+                s += d[i] * v[i];
+        }
+        s = (length2 > 0.0) ? s / length2 : 0.0;
+        s = (s < 0.0) ? 0.0 : ((s > 1.0) ? 1.0 : s);
+        length2 = 0.0;
+        for (i = 0; i < 3; i++)
+        {
+                v[i] -= s * d[i];
+                length2 += v[i] * v[i];
+        }
+        return (length2);
+}
+
+
+/*!
+ * \brief Flatten a NURBS curve into a polyline within a tolerance.
+ *
+ * Every non empty knot span is halved until the middle of each piece is
+ * within the tolerance of its chord.\n
+ * A span of degree p is halved at least until it has p pieces, so
+ * inflections in a span are not skipped.\n
+ * The result only depends on the curve, so the vertices can be counted
+ * first with \c points set to \c NULL.
+ *
+ * \return the number of vertices, or 0 when an error occurred.
+ */
+size_t
+dxf_nurbs_flatten
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        double tolerance,
+                /*!< maximum distance between the curve and the
+                 * polyline. */
+        double *points
+                /*!< the vertices, 3 values per vertex, or \c NULL to
+                 * only count the vertices. */
+)
+{
+        DxfNurbsInterval stack[DXF_NURBS_MAX_DEPTH + 1];
+        int top;
+        double start[3];
+        double middle[3];
+        double t;
+        double tolerance2;
+        size_t count;
+        int min_depth;
+        int span;
+
+        if (nurbs == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        if ((nurbs->number_of_control_points == 0) || !(tolerance > 0.0))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the curve has no control points or the tolerance is not positive.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        tolerance2 = tolerance * tolerance;
+        for (min_depth = 0; (1 << min_depth) < nurbs->degree; min_depth++);
+        span = dxf_nurbs_locate (nurbs, nurbs->knots[nurbs->degree]);
+        dxf_nurbs_cache_span (nurbs, span);
+        dxf_nurbs_evaluate_span (nurbs, 0.0, start);
+        if (points != NULL)
+        {
+                memcpy (points, start, sizeof (start));
+        }
+        count = 1;
+        for (; span < nurbs->number_of_control_points; span++)
+        {
+                if (!(nurbs->knots[span] < nurbs->knots[span + 1]))
+                {
+                        continue;
+                }
+                dxf_nurbs_cache_span (nurbs, span);
+                t = 0.0;
+                top = 0;
+                stack[0].t = 1.0;
+                stack[0].depth = 0;
+                dxf_nurbs_evaluate_span (nurbs, 1.0, stack[0].point);
+                while (top >= 0)
+                {
+                        dxf_nurbs_evaluate_span (nurbs, 0.5 * (t + stack[top].t), middle);
+                        if ((stack[top].depth >= DXF_NURBS_MAX_DEPTH)
+                          || ((stack[top].depth >= min_depth)
+                          && (dxf_nurbs_distance2 (middle, start, stack[top].point) <= tolerance2)))
+                        {
+                                /* The piece is flat, emit its end point. */
+                                if (points != NULL)
+                                {
+                                        memcpy (points + 3 * count, stack[top].point, sizeof (start));
+                                }
+                                count++;
+                                t = stack[top].t;
+                                memcpy (start, stack[top].point, sizeof (start));
+                                top--;
+                        }
+                        else
+                        {
+                                /* Keep the second half and continue with
+                                 * the first half. */
+                                stack[top].depth++;
+                                stack[top + 1].t = 0.5 * (t + stack[top].t);
+                                stack[top + 1].depth = stack[top].depth;
+                                memcpy (stack[top + 1].point, middle, sizeof (middle));
+                                top++;
+                        }
+                }
+        }
+        return (count);
+}
+
+
+/*!
+ * \brief Insert a knot into a NURBS curve without changing its shape
+ * (Boehm's algorithm).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the knot is
+ * outside the domain, its multiplicity would exceed the degree, or when
+ * an error occurred.
+ */
+int
+dxf_nurbs_insert_knot
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        double u,
+                /*!< the knot. */
+        int times
+                /*!< number of times to insert the knot. */
+)
+{
+        double r[DXF_NURBS_MAX_DEGREE + 1][4];
+        double *knots;
+        double *control_points;
+        double alpha;
+        int p;
+        int n;
+        int k;
+        int s;
+        int i;
+        int j;
+        int c;
+        int l = 0;
+
+        if (nurbs == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        p = nurbs->degree;
+        n = nurbs->number_of_control_points;
+        if ((n == 0) || (times < 1)
+          || !(nurbs->knots[p] < u) || !(u < nurbs->knots[n]))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the knot is not inside the domain of the curve.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        k = dxf_nurbs_locate (nurbs, u);
+        for (s = 0; (s <= p) && (nurbs->knots[k - s] == u); s++);
+        if (s + times > p)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the multiplicity of the knot would exceed the degree.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_nurbs_reserve (nurbs, n + times) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the control points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        knots = nurbs->knots;
+        control_points = nurbs->control_points;
+        /* Keep the affected control points, then move the unaffected
+         * tail up. */
+        for (i = 0; i <= p - s; i++)
+        {
+                memcpy (r[i], control_points + 4 * (k - p + i), sizeof (r[i]));
+        }
+        memmove (control_points + 4 * (k - s + times), control_points + 4 * (k - s),
+          4 * (n - k + s) * sizeof (double));
+        /* The new knots are computed from the old knot vector. */
+        for (j = 1; j <= times; j++)
+        {
+                l = k - p + j;
+                for (i = 0; i <= p - j - s; i++)
+                {
+                        alpha = (u - knots[l + i]) / (knots[i + k + 1] - knots[l + i]);
+                        for (c = 0; c < 4; c++)
+                        {
+                                r[i][c] = alpha * r[i + 1][c] + (1.0 - alpha) * r[i][c];
+                        }
+                }
+                memcpy (control_points + 4 * l, r[0], sizeof (r[0]));
+                memcpy (control_points + 4 * (k + times - j - s), r[p - j - s], sizeof (r[0]));
+        }
+        for (i = l + 1; i < k - s; i++)
+        {
+                memcpy (control_points + 4 * i, r[i - l], sizeof (r[0]));
+        }
+        memmove (knots + k + 1 + times, knots + k + 1, (n + p - k) * sizeof (double));
+        for (i = 1; i <= times; i++)
+        {
+                knots[k + i] = u;
+        }
+        nurbs->number_of_control_points = n + times;
+        nurbs->span = -1;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of Bézier segments of a NURBS curve, which is
+ * the number of non empty knot spans in its domain.
+ *
+ * \return the number of segments, or -1 when an error occurred.
+ */
+int
+dxf_nurbs_get_number_of_bezier_segments
+(
+        DxfNurbs *nurbs
+                /*!< a pointer to the NURBS curve. */
+)
+{
+        int count = 0;
+        int i;
+
+        if (nurbs == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        for (i = nurbs->degree; i < nurbs->number_of_control_points; i++)
+        {
+                if (nurbs->knots[i] < nurbs->knots[i + 1])
+                {
+                        count++;
+                }
+        }
+        return (count);
+}
+
+
+/*!
+ * \brief Split a NURBS curve with a clamped knot vector into Bézier
+ * segments.
+ *
+ * Every segment has \c degree + 1 homogeneous control points
+ * (x * w, y * w, z * w, w), so \c segments has to hold
+ * 4 * (\c degree + 1) values per segment as counted by
+ * \c dxf_nurbs_get_number_of_bezier_segments ().\n
+ * The curve itself is not changed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the knot
+ * vector is not clamped or when an error occurred.
+ */
+int
+dxf_nurbs_decompose_bezier
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        double *segments
+                /*!< the control points of the segments. */
+)
+{
+        double alphas[DXF_NURBS_MAX_DEGREE];
+        const double *knots;
+        const double *control_points;
+        double *q;
+        double numerator;
+        double alpha;
+        int p;
+        int m;
+        int a;
+        int b;
+        int i;
+        int j;
+        int k;
+        int c;
+        int multiplicity;
+        int count;
+
+        if ((nurbs == NULL) || (segments == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        p = nurbs->degree;
+        m = nurbs->number_of_control_points + p;
+        knots = nurbs->knots;
+        control_points = nurbs->control_points;
+        if ((nurbs->number_of_control_points == 0)
+          || (knots[0] != knots[p]) || (knots[m - p] != knots[m]))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the curve has no clamped knot vector.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#define DXF_NURBS_Q(segment, index) (segments + 4 * ((segment) * (p + 1) + (index)))
+        memcpy (segments, control_points, 4 * (p + 1) * sizeof (double));
+        count = 0;
+        a = p;
+        b = p + 1;
+        while (b < m)
+        {
+                i = b;
+                while ((b < m) && (knots[b + 1] == knots[b]))
+                {
+                        b++;
+                }
+                multiplicity = b - i + 1;
+                if (multiplicity < p)
+                {
+                        /* Raise the multiplicity of knots[b] to the
+                         * degree. */
+                        numerator = knots[b] - knots[a];
+                        for (j = p; j > multiplicity; j--)
+                        {
+                                alphas[j - multiplicity - 1] = numerator / (knots[a + j] - knots[a]);
+                        }
+                        for (j = 1; j <= p - multiplicity; j++)
+                        {
+                                for (k = p; k >= multiplicity + j; k--)
+                                {
+                                        alpha = alphas[k - multiplicity - j];
+                                        q = DXF_NURBS_Q (count, k);
+                                        for (c = 0; c < 4; c++)
+                                        {
+                                                q[c] = alpha * q[c] + (1.0 - alpha) * q[c - 4];
+                                        }
+                                }
+                                if (b < m)
+                                {
+                                        memcpy (DXF_NURBS_Q (count + 1, p - multiplicity - j),
+                                          DXF_NURBS_Q (count, p), 4 * sizeof (double));
+                                }
+                        }
+                }
+                count++;
+                if (b < m)
+                {
+                        for (i = p - multiplicity; i <= p; i++)
+                        {
+                                memcpy (DXF_NURBS_Q (count, i),
+                                  control_points + 4 * (b - p + i), 4 * sizeof (double));
+                        }
+                        a = b;
+                        b++;
+                }
+        }
+#undef DXF_NURBS_Q
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the non zero basis functions of a knot span.
+ */
+static void
+dxf_nurbs_basis
+(
+        const double *knots,
+                /*!< knot vector. */
+        int span,
+                /*!< index of the knot span holding \c u. */
+        double u,
+                /*!< parameter. */
+        int degree,
+                /*!< degree of the basis functions. */
+        double *basis
+                /*!< the values of the \c degree + 1 basis functions
+                 * N(span - degree) .. N(span). */
+)
+{
+        double left[DXF_NURBS_MAX_DEGREE + 1];
+        double right[DXF_NURBS_MAX_DEGREE + 1];
+        double saved;
+        double temp;
+        int j;
+        int r;
+
+        basis[0] = 1.0;
+        for (j = 1; j <= degree; j++)
+        {
+                left[j] = u - knots[span + 1 - j];
+                right[j] = knots[span + j] - u;
+                saved = 0.0;
+                for (r = 0; r < j; r++)
+                {
+                        temp = basis[r] / (right[r + 1] + left[j - r]);
+                        basis[r] = saved + right[r + 1] * temp;
+                        saved = left[j - r] * temp;
+                }
+                basis[j] = saved;
+        }
+}
+
+
+/*!
+ * \brief Get the end derivative of an interpolating curve.
+ *
+ * A given tangent is scaled to the total chord length, as the curve is
+ * parametrized on [0, 1].\n
+ * Without a tangent the derivative of the parabola through the first
+ * (or last) three fit points is used.
+ */
+static void
+dxf_nurbs_end_derivative
+(
+        const double *q0,
+                /*!< the end fit point. */
+        const double *q1,
+                /*!< the next fit point. */
+        const double *q2,
+                /*!< the fit point after \c q1, or \c NULL. */
+        double h1,
+                /*!< parameter distance from \c q0 to \c q1. */
+        double h2,
+                /*!< parameter distance from \c q0 to \c q2. */
+        const double *tangent,
+                /*!< the tangent, or \c NULL. */
+        double sign,
+                /*!< 1.0 when the tangent points away from \c q0, -1.0
+                 * when it points towards \c q0. */
+        double length,
+                /*!< total chord length. */
+        double *derivative
+                /*!< the derivative, pointing away from \c q0. */
+)
+{
+        double norm = 0.0;
+        int c;
+
+        if (tangent != NULL)
+        {
+                norm = sqrt (tangent[0] * tangent[0] + tangent[1] * tangent[1]
+                  + tangent[2] * tangent[2]);
+        }
+        for (c = 0; c < 3; c++)
+        {
+                if (norm > 0.0)
+                {
+                        derivative[c] = sign * tangent[c] * length / norm;
+                }
+                else if (q2 == NULL)
+                {
+                        derivative[c] = (q1[c] - q0[c]) / h1;
+                }
+                else
+                {
+                        derivative[c] = - (1.0 / h1 + 1.0 / h2) * q0[c]
+                          + h2 / (h1 * (h2 - h1)) * q1[c]
+                          - h1 / (h2 * (h2 - h1)) * q2[c];
+                }
+        }
+}
+
+
+/*!
+ * \brief Solve the control points of a cubic curve interpolating fit
+ * points.
+ *
+ * On entry the first fit point is in control point 0 and fit point
+ * j > 0 is in control point j + 1, so no memory is needed beyond the
+ * arrays of the curve.\n
+ * The knots are the chord length parameters of the fit points, with the
+ * end derivatives the first and last two control points are known and
+ * the others follow from a tridiagonal system which is solved with the
+ * Thomas algorithm in O(n).\n
+ * The weight member of a control point holds the eliminated
+ * superdiagonal until the back substitution.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when there are
+ * less than 2 distinct fit points.
+ */
+static int
+dxf_nurbs_solve_interpolation
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        int number_of_fit_points,
+                /*!< number of fit points. */
+        const double *start_tangent,
+                /*!< start tangent, or \c NULL. */
+        const double *end_tangent
+                /*!< end tangent, or \c NULL. */
+)
+{
+        double *p = nurbs->control_points;
+        double *u = nurbs->knots;
+        double basis[4];
+        double d0[3];
+        double d1[3];
+        double length = 0.0;
+        double distance;
+        double denominator;
+        int m = number_of_fit_points - 1;
+        int i;
+        int j;
+        int c;
+
+#define DXF_NURBS_FIT(index) (p + 4 * (((index) == 0) ? 0 : (index) + 1))
+        if (m < 1)
+        {
+                return (EXIT_FAILURE);
+        }
+        /* Chord length parameters, stored as the interior knots. */
+        u[3] = 0.0;
+        for (j = 1; j <= m; j++)
+        {
+                distance = 0.0;
+                for (c = 0; c < 3; c++)
+                {
+                        distance += (DXF_NURBS_FIT (j)[c] - DXF_NURBS_FIT (j - 1)[c])
+                          * (DXF_NURBS_FIT (j)[c] - DXF_NURBS_FIT (j - 1)[c]);
+                }
+                length += sqrt (distance);
+                u[j + 3] = length;
+        }
+        if (!(length > 0.0))
+        {
+                return (EXIT_FAILURE);
+        }
+        for (j = 1; j < m; j++)
+        {
+                u[j + 3] /= length;
+        }
+        for (i = 0; i <= 3; i++)
+        {
+                u[i] = 0.0;
+                u[m + 3 + i] = 1.0;
+        }
+        dxf_nurbs_end_derivative (DXF_NURBS_FIT (0), DXF_NURBS_FIT (1),
+          (m > 1) ? DXF_NURBS_FIT (2) : NULL, u[4], u[5],
+          start_tangent, 1.0, length, d0);
+        dxf_nurbs_end_derivative (DXF_NURBS_FIT (m), DXF_NURBS_FIT (m - 1),
+          (m > 1) ? DXF_NURBS_FIT (m - 2) : NULL, 1.0 - u[m + 2], 1.0 - u[m + 1],
+          end_tangent, -1.0, length, d1);
+        /* Move the last fit point to the last control point. */
+        memcpy (p + 4 * (m + 2), p + 4 * (m + 1), 3 * sizeof (double));
+        for (c = 0; c < 3; c++)
+        {
+                p[4 + c] = p[c] + u[4] / 3.0 * d0[c];
+                p[4 * (m + 1) + c] = p[4 * (m + 2) + c] + (1.0 - u[m + 2]) / 3.0 * d1[c];
+        }
+#undef DXF_NURBS_FIT
+        /* Fit point j is interpolated at knot j + 3 by the control points
+         * j, j + 1 and j + 2, the unknowns are control points 2 .. m. */
+        for (j = 1; j < m; j++)
+        {
+                dxf_nurbs_basis (u, j + 3, u[j + 3], 3, basis);
+                for (c = 0; c < 3; c++)
+                {
+                        if (j == 1)
+                        {
+                                p[4 * (j + 1) + c] -= basis[0] * p[4 + c];
+                        }
+                        if (j == m - 1)
+                        {
+                                p[4 * (j + 1) + c] -= basis[2] * p[4 * (m + 1) + c];
+                        }
+                }
+                denominator = basis[1];
+                if (j > 1)
+                {
+                        denominator -= basis[0] * p[4 * j + 3];
+                        for (c = 0; c < 3; c++)
+                        {
+                                p[4 * (j + 1) + c] -= basis[0] * p[4 * j + c];
+                        }
+                }
+                for (c = 0; c < 3; c++)
+                {
+                        p[4 * (j + 1) + c] /= denominator;
+                }
+                p[4 * (j + 1) + 3] = basis[2] / denominator;
+        }
+        for (j = m - 2; j >= 1; j--)
+        {
+                for (c = 0; c < 3; c++)
+                {
+                        p[4 * (j + 1) + c] -= p[4 * (j + 1) + 3] * p[4 * (j + 2) + c];
+                }
+        }
+        for (i = 0; i < m + 3; i++)
+        {
+                p[4 * i + 3] = 1.0;
+        }
+        nurbs->degree = 3;
+        nurbs->number_of_control_points = m + 3;
+        nurbs->span = -1;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set a NURBS curve to the cubic curve interpolating a number of
+ * fit points.
+ *
+ * Consecutive equal fit points are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when there are
+ * less than 2 distinct fit points or when an error occurred.
+ */
+int
+dxf_nurbs_interpolate
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        const double *fit_points,
+                /*!< fit points, 3 values per fit point. */
+        int number_of_fit_points,
+                /*!< number of fit points. */
+        const double *start_tangent,
+                /*!< start tangent, or \c NULL to derive it from the fit
+                 * points. */
+        const double *end_tangent
+                /*!< end tangent, or \c NULL to derive it from the fit
+                 * points. */
+)
+{
+        double *slot;
+        int count = 0;
+        int i;
+
+        if ((nurbs == NULL) || (fit_points == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_nurbs_reserve (nurbs, number_of_fit_points + 2) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the control points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        nurbs->number_of_control_points = 0;
+        for (i = 0; i < number_of_fit_points; i++)
+        {
+                if ((count > 0)
+                  && (memcmp (fit_points + 3 * i, fit_points + 3 * (i - 1), 3 * sizeof (double)) == 0))
+                {
+                        continue;
+                }
+                slot = nurbs->control_points + 4 * ((count == 0) ? 0 : count + 1);
+                memcpy (slot, fit_points + 3 * i, 3 * sizeof (double));
+                count++;
+        }
+        if (dxf_nurbs_solve_interpolation (nurbs, count, start_tangent, end_tangent) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () less than 2 distinct fit points were passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Copy the degree, control points, weights and knots of a NURBS
+ * curve to a DXF \c SPLINE entity.
+ *
+ * The control points of the spline are reused, and more are appended
+ * when needed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the curve
+ * does not fit in a spline or when an error occurred.
+ */
+int
+dxf_nurbs_get_spline
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve. */
+        DxfSpline *spline
+                /*!< a pointer to the DXF \c SPLINE entity. */
+)
+{
+        DxfPoint *point;
+        DxfPoint **link;
+        const double *control_point;
+        int rational = FALSE;
+        int n;
+        int p;
+        int i;
+
+        if ((nurbs == NULL) || (spline == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        n = nurbs->number_of_control_points;
+        p = nurbs->degree;
+        if ((n == 0) || (n + p + 1 > DXF_MAX_PARAM))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the curve has no control points or too many knots.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        link = &spline->p0;
+        for (i = 0; i < n; i++)
+        {
+                if (*link == NULL)
+                {
+                        *link = dxf_point_init (dxf_point_new ());
+                        if (*link == NULL)
+                        {
+                                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                                  (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
+                                  __FUNCTION__);
+                                return (EXIT_FAILURE);
+                        }
+                }
+                point = *link;
+                control_point = nurbs->control_points + 4 * i;
+                point->x0 = control_point[0] / control_point[3];
+                point->y0 = control_point[1] / control_point[3];
+                point->z0 = control_point[2] / control_point[3];
+                spline->weight_value[i] = control_point[3];
+                if (control_point[3] != 1.0)
+                {
+                        rational = TRUE;
+                }
+                link = (DxfPoint **) &point->next;
+        }
+        memcpy (spline->knot_value, nurbs->knots, (n + p + 1) * sizeof (double));
+        spline->degree = p;
+        spline->number_of_control_points = n;
+        spline->number_of_knots = n + p + 1;
+        if (rational)
+        {
+                spline->flag |= 4;
+        }
+        else
+        {
+                spline->flag &= ~4;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the control points of a DXF \c SPLINE entity from its
+ * fit points.
+ *
+ * The spline becomes a cubic curve through its fit points, with the
+ * start and end tangents \c p2 and \c p3 when these are not zero.\n
+ * The knots are the chord length parameters of the fit points on
+ * [0, 1].\n
+ * Afterwards \c nurbs holds the curve, ready for evaluation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the spline
+ * has less than 2 distinct fit points, is not cubic, or when an error
+ * occurred.
+ */
+int
+dxf_nurbs_interpolate_spline
+(
+        DxfNurbs *nurbs,
+                /*!< a pointer to the NURBS curve, used as work space. */
+        DxfSpline *spline
+                /*!< a pointer to the DXF \c SPLINE entity. */
+)
+{
+        DxfPoint *point;
+        double *slot;
+        double start_tangent[3];
+        double end_tangent[3];
+        int count = 0;
+        int i;
+
+        if ((nurbs == NULL) || (spline == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((spline->degree != 0) && (spline->degree != 3))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () only cubic splines can be interpolated.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((spline->number_of_fit_points < 2)
+          || (spline->number_of_fit_points + 6 > DXF_MAX_PARAM))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the spline has an invalid number of fit points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_nurbs_reserve (nurbs, spline->number_of_fit_points + 2) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the control points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        nurbs->number_of_control_points = 0;
+        point = spline->p1;
+        for (i = 0; (i < spline->number_of_fit_points) && (point != NULL); i++)
+        {
+                slot = nurbs->control_points + 4 * ((count == 0) ? 0 : count + 1);
+                slot[0] = point->x0;
+                slot[1] = point->y0;
+                slot[2] = point->z0;
+                if ((count == 0)
+                  || (memcmp (slot, nurbs->control_points + 4 * ((count == 1) ? 0 : count), 3 * sizeof (double)) != 0))
+                {
+                        count++;
+                }
+                point = (DxfPoint *) point->next;
+        }
+        for (i = 0; i < 3; i++)
+        {
+                start_tangent[i] = 0.0;
+                end_tangent[i] = 0.0;
+        }
+        if (spline->p2 != NULL)
+        {
+                start_tangent[0] = spline->p2->x0;
+                start_tangent[1] = spline->p2->y0;
+                start_tangent[2] = spline->p2->z0;
+        }
+        if (spline->p3 != NULL)
+        {
+                end_tangent[0] = spline->p3->x0;
+                end_tangent[1] = spline->p3->y0;
+                end_tangent[2] = spline->p3->z0;
+        }
+        if (dxf_nurbs_solve_interpolation (nurbs, count, start_tangent, end_tangent) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the spline has less than 2 distinct fit points.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        return (dxf_nurbs_get_spline (nurbs, spline));
+}
+
+
+/* EOF */
@@ -0,0 +1,118 @@
+/*!
+ * \file nurbs.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF evaluation of NURBS curves.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_NURBS_H
+#define LIBDXF_SRC_NURBS_H
+
+
+#include "global.h"
+#include "spline.h"
+#include "hatch.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_NURBS_MAX_DEGREE 15
+        /*!< \brief Maximum degree of a NURBS curve. */
+
+#define DXF_NURBS_MAX_DEPTH 16
+        /*!< \brief Maximum number of times a knot span is halved by
+         * \c dxf_nurbs_flatten (). */
+
+
+/*!
+ * \brief A NURBS curve prepared for evaluation.
+ *
+ * The control points are stored as homogeneous coordinates
+ * (x * w, y * w, z * w, w).\n
+ * The arrays only grow, so a \c DxfNurbs struct can be reused for many
+ * curves without allocating memory per curve.
+ */
+typedef struct
+dxf_nurbs_struct
+{
+        int degree;
+                /*!< Degree of the curve. */
+        int number_of_control_points;
+                /*!< Number of control points. */
+        double *control_points;
+                /*!< Homogeneous control points, 4 values per control
+                 * point. */
+        double *knots;
+                /*!< Knot vector, \c number_of_control_points +
+                 * \c degree + 1 values. */
+        int capacity;
+                /*!< Number of control points allocated, the knot
+                 * vector has \c degree + 1 more values allocated. */
+        int span;
+                /*!< Index of the knot span whose coefficients are
+                 * cached, or -1. */
+        double coefficients[4 * (DXF_NURBS_MAX_DEGREE + 1)];
+                /*!< Power basis coefficients of the homogeneous curve
+                 * over the cached knot span, in the local parameter
+                 * t = (u - knots[span]) / (knots[span + 1] - knots[span]).\n
+                 * The 4 values of t^k start at index 4 * k. */
+} DxfNurbs;
+
+
+DxfNurbs *dxf_nurbs_new ();
+int dxf_nurbs_free (DxfNurbs *nurbs);
+int dxf_nurbs_set (DxfNurbs *nurbs, int degree, int number_of_control_points, const double *control_points, const double *weights, const double *knots);
+int dxf_nurbs_set_spline (DxfNurbs *nurbs, DxfSpline *spline);
+int dxf_nurbs_set_hatch_spline (DxfNurbs *nurbs, DxfHatchBoundaryPathEdgeSpline *spline);
+int dxf_nurbs_get_domain (DxfNurbs *nurbs, double *start, double *end);
+int dxf_nurbs_find_span (DxfNurbs *nurbs, double u);
+int dxf_nurbs_evaluate (DxfNurbs *nurbs, const double *parameters, size_t number_of_parameters, double *points);
+int dxf_nurbs_evaluate_derivatives (DxfNurbs *nurbs, const double *parameters, size_t number_of_parameters, int order, double *derivatives);
+size_t dxf_nurbs_flatten (DxfNurbs *nurbs, double tolerance, double *points);
+int dxf_nurbs_insert_knot (DxfNurbs *nurbs, double u, int times);
+int dxf_nurbs_get_number_of_bezier_segments (DxfNurbs *nurbs);
+int dxf_nurbs_decompose_bezier (DxfNurbs *nurbs, double *segments);
+int dxf_nurbs_interpolate (DxfNurbs *nurbs, const double *fit_points, int number_of_fit_points, const double *start_tangent, const double *end_tangent);
+int dxf_nurbs_get_spline (DxfNurbs *nurbs, DxfSpline *spline);
+int dxf_nurbs_interpolate_spline (DxfNurbs *nurbs, DxfSpline *spline);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_NURBS_H */
+
+
+/* EOF */
@@ -34,6 +34,8 @@
 
 
 #include "object.h"
+#include "section.h"
+#include "endsec.h"
 
 
 /*!
@@ -53,9 +55,9 @@ dxf_object_new ()
         size = sizeof (DxfObject);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((object = malloc (size)) == NULL)
+        if ((object = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfObject struct.\n")),
                   __FUNCTION__);
                 object = NULL;
@@ -93,14 +95,14 @@ dxf_object_init
         /* Do some basic checks. */
         if (object == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 object = dxf_object_new ();
         }
         if (object == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfObject struct.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -121,7 +123,14 @@ dxf_object_init
 /*!
  * \brief Write DXF output to a file for a table of objects.
  *
- * Appears only in \c TABLES section.\n
+ * Writes the complete \c OBJECTS section.\n
+ * The generic objects in \c dxf_objects_list only hold their parameter
+ * values without group codes, so they can not be written and are
+ * reported, the section is written empty.\n
+ * Placeholder objects of type \c UNKNOWN_ENTITY are ignored.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
 dxf_object_write_objects
@@ -135,7 +144,32 @@ dxf_object_write_objects
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /*! \todo Add code here. */
+        DxfObject *iter = NULL;
+        int number_of_objects = 0;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (iter = dxf_objects_list; iter != NULL; iter = (DxfObject *) iter->next)
+        {
+                if (iter->entity_type != UNKNOWN_ENTITY)
+                {
+                        number_of_objects++;
+                }
+        }
+        if (number_of_objects > 0)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () %d objects are discarded from output.\n")),
+                  __FUNCTION__, number_of_objects);
+        }
+        dxf_section_write (fp, "OBJECTS");
+        dxf_endsec_write (fp);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -163,12 +197,12 @@ dxf_object_free
 #endif
         if (object->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfObject was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (object);
+        dxf_free (object);
         object = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -189,18 +223,19 @@ dxf_object_free_chain
                 /*!< a pointer to the chain of DXF \c objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (objects == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (objects != NULL)
         {
                 struct DxfObject *iter = objects->next;
+                objects->next = NULL;
                 dxf_object_free (objects);
                 objects = (DxfObject *) iter;
         }
@@ -230,14 +265,14 @@ dxf_object_get_entity_type
         /* Do some basic checks. */
         if (object == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object->entity_type == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found.\n")),
                   __FUNCTION__);
         }
@@ -267,14 +302,14 @@ dxf_object_set_entity_type
         /* Do some basic checks. */
         if (object == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (entity_type == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -308,14 +343,14 @@ dxf_object_get_next
         /* Do some basic checks. */
         if (object == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -346,14 +381,14 @@ dxf_object_set_next
         /* Do some basic checks. */
         if (object == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -387,14 +422,14 @@ dxf_object_get_last
         /* Do some basic checks. */
         if (object == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfObject *) object);
@@ -52,9 +52,9 @@ dxf_object_id_new ()
         size = sizeof (DxfObjectId);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((object_id = malloc (size)) == NULL)
+        if ((object_id = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfObjectId struct.\n")),
                   __FUNCTION__);
                 object_id = NULL;
@@ -90,19 +90,19 @@ dxf_object_id_init
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 object_id = dxf_object_id_new ();
         }
         if (object_id == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfObjectId struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        object_id->data = strdup ("");
+        object_id->data = dxf_strdup ("");
         object_id->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -131,13 +131,13 @@ dxf_object_id_free
 #endif
         if (object_id->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfObject was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (object_id->data);
-        free (object_id);
+        dxf_free (object_id->data);
+        dxf_free (object_id);
         object_id = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -157,18 +157,19 @@ dxf_object_id_free_chain
                 /*!< a pointer to the chain of DXF \c object_ids. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (object_ids == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (object_ids != NULL)
         {
                 struct DxfObjectId *iter = object_ids->next;
+                object_ids->next = NULL;
                 dxf_object_id_free (object_ids);
                 object_ids = (DxfObjectId *) iter;
         }
@@ -196,7 +197,7 @@ dxf_object_id_get_group_code
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -206,7 +207,7 @@ dxf_object_id_get_group_code
           && (object_id->group_code != 350)
           && (object_id->group_code != 360))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid value was found in the group_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -239,7 +240,7 @@ dxf_object_id_set_group_code
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -249,7 +250,7 @@ dxf_object_id_set_group_code
           && (group_code != 350)
           && (group_code != 360))
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an invalid group_code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -280,14 +281,14 @@ dxf_object_id_get_data
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object_id->data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -295,7 +296,7 @@ dxf_object_id_get_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (object_id->data));
+        return (dxf_strdup (object_id->data));
 }
 
 
@@ -317,19 +318,19 @@ dxf_object_id_set_data
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        object_id->data = strdup (data);
+        object_id->data = dxf_strdup (data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -355,14 +356,14 @@ dxf_object_id_get_length
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (object_id->length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the length member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -395,14 +396,14 @@ dxf_object_id_set_length
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative length value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -436,14 +437,14 @@ dxf_object_id_get_next
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object_id->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -475,14 +476,14 @@ dxf_object_id_set_next
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -516,14 +517,14 @@ dxf_object_id_get_last
         /* Do some basic checks. */
         if (object_id == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object_id->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return ((DxfObjectId *) object_id);
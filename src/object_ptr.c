@@ -41,6 +41,7 @@
 
 
 #include "object_ptr.h"
+#include "util.h"
 
 
 /*!
@@ -60,9 +61,9 @@ dxf_object_ptr_new ()
         size = sizeof (DxfObjectPtr);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((object_ptr = malloc (size)) == NULL)
+        if ((object_ptr = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfObjectPtr struct.\n")),
                   __FUNCTION__);
                 object_ptr = NULL;
@@ -98,21 +99,32 @@ dxf_object_ptr_init
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 object_ptr = dxf_object_ptr_new ();
         }
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfObjectPtr struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         object_ptr->id_code = 0;
-        object_ptr->dictionary_owner_soft = strdup ("");
-        object_ptr->dictionary_owner_hard = strdup ("");
+        object_ptr->dictionary_owner_soft = dxf_strdup ("");
+        object_ptr->dictionary_owner_hard = dxf_strdup ("");
+        object_ptr->xdata = dxf_char_new ();
+        if (object_ptr->xdata == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfChar struct.\n")),
+                  __FUNCTION__);
+                dxf_free (object_ptr->dictionary_owner_soft);
+                dxf_free (object_ptr->dictionary_owner_hard);
+                dxf_free (object_ptr);
+                return (NULL);
+        }
         object_ptr->xdata->value = NULL;
         object_ptr->xdata->length = 0;
         object_ptr->xdata->next = NULL;
@@ -147,43 +159,40 @@ dxf_object_ptr_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 object_ptr = dxf_object_ptr_new ();
                 object_ptr = dxf_object_ptr_init (object_ptr);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -199,14 +208,14 @@ dxf_object_ptr_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", object_ptr->dictionary_owner_soft);
+                        dxf_read_string (fp, &object_ptr->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", object_ptr->dictionary_owner_hard);
+                        dxf_read_string (fp, &object_ptr->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -219,20 +228,24 @@ dxf_object_ptr_read
                 {
                         /* Now follows a string containing extended data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", object_ptr->xdata->value);
+                        dxf_read_string (fp, &object_ptr->xdata->value);
                         object_ptr->xdata->length = strlen (object_ptr->xdata->value);
                         /*! \todo Set pointer to xdata->next for
                          * following xdata object. */
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -258,30 +271,31 @@ dxf_object_ptr_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("OBJECT_PTR");
+        char *dxf_entity_name = dxf_strdup ("OBJECT_PTR");
+        DxfChar *iter = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, object_ptr->id_code);
         }
@@ -315,13 +329,14 @@ dxf_object_ptr_write
                 fprintf (fp->fp, "360\n%s\n", object_ptr->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
-        while (object_ptr->xdata->value != NULL)
+        iter = object_ptr->xdata;
+        while ((iter != NULL) && (iter->value != NULL))
         {
-                fprintf (fp->fp, "1001\n%s\n", object_ptr->xdata->value);
-                /*! \todo Write the complete linked list of char values. */
+                fprintf (fp->fp, "1001\n%s\n", iter->value);
+                iter = (DxfChar *) iter->next;
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -352,25 +367,21 @@ dxf_object_ptr_free
         /* Do some basic checks. */
         if (object_ptr->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfObjectPtr was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (object_ptr->dictionary_owner_soft);
-        free (object_ptr->dictionary_owner_hard);
-        while (object_ptr->xdata->value != NULL)
+        dxf_free (object_ptr->dictionary_owner_soft);
+        dxf_free (object_ptr->dictionary_owner_hard);
+        while (object_ptr->xdata != NULL)
         {
                 iter = (struct DxfChar *) object_ptr->xdata->next;
-                free (object_ptr->xdata->value);
-                free (object_ptr->xdata);
-                if (iter != NULL)
-                {
-                        object_ptr->xdata = (DxfChar *) iter;
-                }
+                dxf_free (object_ptr->xdata->value);
+                dxf_free (object_ptr->xdata);
+                object_ptr->xdata = (DxfChar *) iter;
         }
-        free (object_ptr);
-        free (iter);
+        dxf_free (object_ptr);
         object_ptr = NULL;
         iter = NULL;
 #if DEBUG
@@ -391,18 +402,19 @@ dxf_object_ptr_free_chain
                 /*!< a pointer to the chain of DXF \c OBJECT_PTR objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (objectptrs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (objectptrs != NULL)
         {
                 struct DxfObjectPtr *iter = objectptrs->next;
+                objectptrs->next = NULL;
                 dxf_object_ptr_free (objectptrs);
                 objectptrs = (DxfObjectPtr *) iter;
         }
@@ -430,14 +442,14 @@ dxf_object_ptr_get_id_code
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (object_ptr->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -469,14 +481,14 @@ dxf_object_ptr_set_id_code
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -510,14 +522,14 @@ dxf_object_ptr_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object_ptr->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -525,7 +537,7 @@ dxf_object_ptr_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (object_ptr->dictionary_owner_soft));
+        return (dxf_strdup (object_ptr->dictionary_owner_soft));
 }
 
 
@@ -549,19 +561,19 @@ dxf_object_ptr_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        object_ptr->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        object_ptr->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -590,14 +602,14 @@ dxf_object_ptr_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object_ptr->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -605,7 +617,7 @@ dxf_object_ptr_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (object_ptr->dictionary_owner_hard));
+        return (dxf_strdup (object_ptr->dictionary_owner_hard));
 }
 
 
@@ -629,19 +641,19 @@ dxf_object_ptr_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        object_ptr->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        object_ptr->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -670,14 +682,14 @@ dxf_object_ptr_get_next
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object_ptr->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -709,14 +721,14 @@ dxf_object_ptr_set_next
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -750,14 +762,14 @@ dxf_object_ptr_get_last
         /* Do some basic checks. */
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (object_ptr->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfObjectPtr *) object_ptr);
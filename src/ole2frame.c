@@ -39,6 +39,7 @@
 
 
 #include "ole2frame.h"
+#include "util.h"
 
 
 /*!
@@ -58,9 +59,9 @@ dxf_ole2frame_new ()
         size = sizeof (DxfOle2Frame);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ole2frame = malloc (size)) == NULL)
+        if ((ole2frame = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfOle2Frame struct.\n")),
                   __FUNCTION__);
                 ole2frame = NULL;
@@ -68,6 +69,7 @@ dxf_ole2frame_new ()
         else
         {
                 memset (ole2frame, 0, size);
+                ole2frame->header.type = OLE2FRAME;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -93,36 +95,34 @@ dxf_ole2frame_init
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ole2frame = dxf_ole2frame_new ();
         }
         if (ole2frame == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfOle2Frame struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         ole2frame->id_code = 0;
-        ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
+        ole2frame->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        ole2frame->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         ole2frame->elevation = 0.0;
         ole2frame->thickness = 0.0;
         ole2frame->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
         ole2frame->visibility = DXF_DEFAULT_VISIBILITY;
         ole2frame->color = DXF_COLOR_BYLAYER;
         ole2frame->paperspace = DXF_MODELSPACE;
-        ole2frame->dictionary_owner_soft = strdup ("");
-        ole2frame->dictionary_owner_hard = strdup ("");
-        ole2frame->end_of_data = strdup ("OLE");
-        ole2frame->length_of_binary_data = strdup ("");
+        ole2frame->dictionary_owner_soft = dxf_strdup ("");
+        ole2frame->dictionary_owner_hard = dxf_strdup ("");
+        ole2frame->end_of_data = dxf_strdup ("OLE");
+        ole2frame->length_of_binary_data = dxf_strdup ("");
         dxf_ole2frame_set_p0 (ole2frame, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_ole2frame_get_p0 (ole2frame));
         ole2frame->p0->x0 = 0.0;
@@ -137,10 +137,7 @@ dxf_ole2frame_init
         ole2frame->ole_object_type = 0;
         ole2frame->tilemode_descriptor = 0;
         ole2frame->length = 0;
-        for (i = 0; i < DXF_MAX_PARAM; i++)
-        {
-                ole2frame->binary_data[i] = strdup ("");
-        }
+        ole2frame->binary_data = dxf_binary_data_new ();
         ole2frame->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -172,40 +169,34 @@ dxf_ole2frame_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        int i;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ole2frame = dxf_ole2frame_new ();
                 ole2frame = dxf_ole2frame_init (ole2frame);
         }
-        i = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -216,19 +207,19 @@ dxf_ole2frame_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "OLE") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
-                if (strcmp (temp_string, "3") == 0)
+                else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing the length of
                          * binary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ole2frame->length_of_binary_data);
+                        dxf_read_string (fp, &ole2frame->length_of_binary_data);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -240,13 +231,13 @@ dxf_ole2frame_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ole2frame->linetype);
+                        dxf_read_string (fp, &ole2frame->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ole2frame->layer);
+                        dxf_read_string (fp, &ole2frame->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -371,31 +362,31 @@ dxf_ole2frame_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbOle2Frame") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
-                        /* Now follows a string containing binary data. */
+                        /* Now follows a string containing binary data,
+                         * decode it. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ole2frame->binary_data[i]);
-                        i++;
+                        dxf_binary_data_read (fp, ole2frame->binary_data);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ole2frame->dictionary_owner_soft);
+                        dxf_read_string (fp, &ole2frame->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ole2frame->dictionary_owner_hard);
+                        dxf_read_string (fp, &ole2frame->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -406,22 +397,26 @@ dxf_ole2frame_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ole2frame->linetype, "") == 0)
         {
-                ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ole2frame->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ole2frame->layer, "") == 0)
         {
-                ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
+                ole2frame->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -447,53 +442,52 @@ dxf_ole2frame_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("OLE2FRAME");
-        int i;
+        char *dxf_entity_name = dxf_strdup ("OLE2FRAME");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (ole2frame->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ole2frame->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ole2frame->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ole2frame->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ole2frame->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ole2frame->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
+                ole2frame->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -542,7 +536,7 @@ dxf_ole2frame_write
           && DXF_FLATLAND
           && (ole2frame->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", ole2frame->elevation);
+                dxf_write_real (fp, 38, ole2frame->elevation);
         }
         if (ole2frame->color != DXF_COLOR_BYLAYER)
         {
@@ -550,7 +544,7 @@ dxf_ole2frame_write
         }
         if (ole2frame->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", ole2frame->linetype_scale);
+                dxf_write_real (fp, 48, ole2frame->linetype_scale);
         }
         if (ole2frame->visibility != 0)
         {
@@ -562,28 +556,26 @@ dxf_ole2frame_write
         }
         if (ole2frame->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", ole2frame->thickness);
+                dxf_write_real (fp, 39, ole2frame->thickness);
         }
         fprintf (fp->fp, " 70\n%d\n", ole2frame->ole_version_number);
         fprintf (fp->fp, "  3\n%s\n", ole2frame->length_of_binary_data);
-        fprintf (fp->fp, " 10\n%f\n", ole2frame->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", ole2frame->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", ole2frame->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", ole2frame->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", ole2frame->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", ole2frame->p1->z0);
+        dxf_write_real (fp, 10, ole2frame->p0->x0);
+        dxf_write_real (fp, 20, ole2frame->p0->y0);
+        dxf_write_real (fp, 30, ole2frame->p0->z0);
+        dxf_write_real (fp, 11, ole2frame->p1->x0);
+        dxf_write_real (fp, 21, ole2frame->p1->y0);
+        dxf_write_real (fp, 31, ole2frame->p1->z0);
         fprintf (fp->fp, " 71\n%d\n", ole2frame->ole_object_type);
         fprintf (fp->fp, " 72\n%d\n", ole2frame->tilemode_descriptor);
         fprintf (fp->fp, " 90\n%ld\n", ole2frame->length);
-        i = 0;
-        while (strlen (ole2frame->binary_data[i]) > 0)
+        if (ole2frame->binary_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", ole2frame->binary_data[i]);
-                i++;
+                dxf_binary_data_write (fp, ole2frame->binary_data);
         }
         fprintf (fp->fp, "  1\nOLE\n");
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -609,26 +601,24 @@ dxf_ole2frame_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         if (ole2frame->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfOle2Frame was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (ole2frame->end_of_data);
-        free (ole2frame->length_of_binary_data);
-        free (ole2frame->linetype);
-        free (ole2frame->layer);
-        free (ole2frame->dictionary_owner_soft);
-        free (ole2frame->dictionary_owner_hard);
-        for (i = 0; i < DXF_MAX_PARAM; i++)
+        dxf_free (ole2frame->end_of_data);
+        dxf_free (ole2frame->length_of_binary_data);
+        dxf_free (ole2frame->linetype);
+        dxf_free (ole2frame->layer);
+        dxf_free (ole2frame->dictionary_owner_soft);
+        dxf_free (ole2frame->dictionary_owner_hard);
+        if (ole2frame->binary_data != NULL)
         {
-                free (ole2frame->binary_data[i]);
+                dxf_binary_data_free (ole2frame->binary_data);
         }
-        free (ole2frame);
+        dxf_free (ole2frame);
         ole2frame = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -648,18 +638,19 @@ dxf_ole2frame_free_chain
                 /*!< a pointer to the chain of DXF \c OLE2FRAME entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (ole2frames == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (ole2frames != NULL)
         {
                 struct DxfOle2Frame *iter = ole2frames->next;
+                ole2frames->next = NULL;
                 dxf_ole2frame_free (ole2frames);
                 ole2frames = (DxfOle2Frame *) iter;
         }
@@ -687,14 +678,14 @@ dxf_ole2frame_get_id_code
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -726,14 +717,14 @@ dxf_ole2frame_set_id_code
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -764,14 +755,14 @@ dxf_ole2frame_get_linetype
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -779,7 +770,7 @@ dxf_ole2frame_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->linetype));
+        return (dxf_strdup (ole2frame->linetype));
 }
 
 
@@ -801,19 +792,19 @@ dxf_ole2frame_set_linetype
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->linetype = strdup (linetype);
+        ole2frame->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -839,14 +830,14 @@ dxf_ole2frame_get_layer
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -854,7 +845,7 @@ dxf_ole2frame_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->layer));
+        return (dxf_strdup (ole2frame->layer));
 }
 
 
@@ -876,19 +867,19 @@ dxf_ole2frame_set_layer
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->layer = strdup (layer);
+        ole2frame->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -914,7 +905,7 @@ dxf_ole2frame_get_elevation
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -944,7 +935,7 @@ dxf_ole2frame_set_elevation
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -975,14 +966,14 @@ dxf_ole2frame_get_thickness
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1011,14 +1002,14 @@ dxf_ole2frame_set_thickness
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1049,14 +1040,14 @@ dxf_ole2frame_get_linetype_scale
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1085,14 +1076,14 @@ dxf_ole2frame_set_linetype_scale
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1122,20 +1113,20 @@ dxf_ole2frame_get_visibility
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (ole2frame->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found.\n")),
                   __FUNCTION__);
         }
@@ -1164,20 +1155,20 @@ dxf_ole2frame_set_visibility
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1207,14 +1198,14 @@ dxf_ole2frame_get_color
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -1243,14 +1234,14 @@ dxf_ole2frame_set_color
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1280,20 +1271,20 @@ dxf_ole2frame_get_paperspace
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (ole2frame->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found.\n")),
                   __FUNCTION__);
         }
@@ -1322,20 +1313,20 @@ dxf_ole2frame_set_paperspace
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1367,20 +1358,20 @@ dxf_ole2frame_get_graphics_data_size
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (ole2frame->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found.\n")),
                   __FUNCTION__);
         }
@@ -1414,21 +1405,21 @@ dxf_ole2frame_set_graphics_data_size
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1459,20 +1450,20 @@ dxf_ole2frame_get_shadow_mode
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
         if (ole2frame->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found.\n")),
                   __FUNCTION__);
         }
@@ -1504,20 +1495,20 @@ dxf_ole2frame_set_shadow_mode
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1550,14 +1541,14 @@ dxf_ole2frame_get_binary_graphics_data
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1589,14 +1580,14 @@ dxf_ole2frame_set_binary_graphics_data
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1630,14 +1621,14 @@ dxf_ole2frame_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1645,7 +1636,7 @@ dxf_ole2frame_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->dictionary_owner_soft));
+        return (dxf_strdup (ole2frame->dictionary_owner_soft));
 }
 
 
@@ -1669,19 +1660,19 @@ dxf_ole2frame_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        ole2frame->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1711,14 +1702,14 @@ dxf_ole2frame_get_material
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1726,7 +1717,7 @@ dxf_ole2frame_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->material));
+        return (dxf_strdup (ole2frame->material));
 }
 
 
@@ -1753,19 +1744,19 @@ dxf_ole2frame_set_material
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->material = strdup (material);
+        ole2frame->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1794,14 +1785,14 @@ dxf_ole2frame_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1809,7 +1800,7 @@ dxf_ole2frame_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->dictionary_owner_hard));
+        return (dxf_strdup (ole2frame->dictionary_owner_hard));
 }
 
 
@@ -1833,19 +1824,19 @@ dxf_ole2frame_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        ole2frame->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1872,7 +1863,7 @@ dxf_ole2frame_get_lineweight
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1905,7 +1896,7 @@ dxf_ole2frame_set_lineweight
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1937,14 +1928,14 @@ dxf_ole2frame_get_plot_style_name
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1952,7 +1943,7 @@ dxf_ole2frame_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->plot_style_name));
+        return (dxf_strdup (ole2frame->plot_style_name));
 }
 
 
@@ -1978,19 +1969,19 @@ dxf_ole2frame_set_plot_style_name
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->plot_style_name = strdup (plot_style_name);
+        ole2frame->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2017,7 +2008,7 @@ dxf_ole2frame_get_color_value
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2050,7 +2041,7 @@ dxf_ole2frame_set_color_value
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2082,14 +2073,14 @@ dxf_ole2frame_get_color_name
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2097,7 +2088,7 @@ dxf_ole2frame_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->color_name));
+        return (dxf_strdup (ole2frame->color_name));
 }
 
 
@@ -2123,19 +2114,19 @@ dxf_ole2frame_set_color_name
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->color_name = strdup (color_name);
+        ole2frame->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2162,7 +2153,7 @@ dxf_ole2frame_get_transparency
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2195,7 +2186,7 @@ dxf_ole2frame_set_transparency
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2227,14 +2218,14 @@ dxf_ole2frame_get_end_of_data
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->end_of_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2242,7 +2233,7 @@ dxf_ole2frame_get_end_of_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->end_of_data));
+        return (dxf_strdup (ole2frame->end_of_data));
 }
 
 
@@ -2268,19 +2259,19 @@ dxf_ole2frame_set_end_of_data
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (end_of_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->end_of_data = strdup (end_of_data);
+        ole2frame->end_of_data = dxf_strdup (end_of_data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2307,14 +2298,14 @@ dxf_ole2frame_get_length_of_binary_data
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->length_of_binary_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2322,7 +2313,7 @@ dxf_ole2frame_get_length_of_binary_data
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (ole2frame->length_of_binary_data));
+        return (dxf_strdup (ole2frame->length_of_binary_data));
 }
 
 
@@ -2348,19 +2339,19 @@ dxf_ole2frame_set_length_of_binary_data
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (length_of_binary_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        ole2frame->length_of_binary_data = strdup (length_of_binary_data);
+        ole2frame->length_of_binary_data = dxf_strdup (length_of_binary_data);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2380,20 +2371,20 @@ dxf_ole2frame_get_p0
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2419,20 +2410,20 @@ dxf_ole2frame_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2458,21 +2449,21 @@ dxf_ole2frame_get_x0
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2501,20 +2492,20 @@ dxf_ole2frame_set_x0
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2540,21 +2531,21 @@ dxf_ole2frame_get_y0
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2583,20 +2574,20 @@ dxf_ole2frame_set_y0
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2622,21 +2613,21 @@ dxf_ole2frame_get_z0
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2665,20 +2656,20 @@ dxf_ole2frame_set_z0
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2703,20 +2694,20 @@ dxf_ole2frame_get_p1
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2742,20 +2733,20 @@ dxf_ole2frame_set_p1
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2781,21 +2772,21 @@ dxf_ole2frame_get_x1
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2824,20 +2815,20 @@ dxf_ole2frame_set_x1
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2863,21 +2854,21 @@ dxf_ole2frame_get_y1
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2906,20 +2897,20 @@ dxf_ole2frame_set_y1
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2945,21 +2936,21 @@ dxf_ole2frame_get_z1
                 /*!< a pointer to a DXF \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2988,20 +2979,20 @@ dxf_ole2frame_set_z1
                  * \c OLE2FRAME entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole2frame->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3032,14 +3023,14 @@ dxf_ole2frame_get_ole_version_number
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (ole2frame->ole_version_number < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found.\n")),
                   __FUNCTION__);
         }
@@ -3068,14 +3059,14 @@ dxf_ole2frame_set_ole_version_number
         /* Do some basic checks. */
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (ole_version_number < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
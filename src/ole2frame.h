@@ -43,6 +43,7 @@
 
 
 #include "global.h"
+#include "binary_data.h"
 #include "point.h"
 #include "binary_graphics_data.h"
 
@@ -58,6 +59,9 @@ extern "C" {
 typedef struct
 dxf_ole2frame_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -225,9 +229,9 @@ dxf_ole2frame_struct
         long length;
                 /*!< group code = 90\n
                  * Length of binary data.\n */
-        char *binary_data[DXF_MAX_PARAM];
+        DxfBinaryData *binary_data;
                 /*!< group code = 310\n
-                 * Binary data (multiple lines).*/
+                 * Binary data, decoded from multiple lines.*/
         struct DxfOle2Frame *next;
                 /*!< pointer to the next DxfOle2Frame.\n
                  * \c NULL in the last DxfOle2Frame. */
@@ -33,6 +33,7 @@
 
 
 #include "oleframe.h"
+#include "util.h"
 
 
 /*!
@@ -55,9 +56,9 @@ dxf_oleframe_new ()
         size = sizeof (DxfOleFrame);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((oleframe = malloc (size)) == NULL)
+        if ((oleframe = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfOleFrame struct.\n")),
                   __FUNCTION__);
                 oleframe = NULL;
@@ -65,6 +66,7 @@ dxf_oleframe_new ()
         else
         {
                 memset (oleframe, 0, size);
+                oleframe->header.type = OLEFRAME;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -93,40 +95,35 @@ dxf_oleframe_init
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (oleframe == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 oleframe = dxf_oleframe_new ();
         }
         if (oleframe == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfOleFrame struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         oleframe->id_code = 0;
-        oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        oleframe->layer = strdup (DXF_DEFAULT_LAYER);
+        oleframe->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        oleframe->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         oleframe->elevation = 0.0;
         oleframe->thickness = 0.0;
         oleframe->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
         oleframe->visibility = DXF_DEFAULT_VISIBILITY;
         oleframe->color = DXF_COLOR_BYLAYER;
         oleframe->paperspace = DXF_MODELSPACE;
-        oleframe->dictionary_owner_soft = strdup ("");
-        oleframe->dictionary_owner_hard = strdup ("");
+        oleframe->dictionary_owner_soft = dxf_strdup ("");
+        oleframe->dictionary_owner_hard = dxf_strdup ("");
         oleframe->ole_version_number = 1;
         oleframe->length = 0;
-        for (i = 0; i < DXF_MAX_PARAM; i++)
-        {
-                oleframe->binary_data[i] = strdup ("");
-        }
+        oleframe->binary_data = dxf_binary_data_new ();
         oleframe->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -161,40 +158,34 @@ dxf_oleframe_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        int i;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (oleframe == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 oleframe = dxf_oleframe_new ();
                 oleframe = dxf_oleframe_init (oleframe);
         }
-        i = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
@@ -205,12 +196,12 @@ dxf_oleframe_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "OLE") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -222,13 +213,13 @@ dxf_oleframe_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", oleframe->linetype);
+                        dxf_read_string (fp, &oleframe->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", oleframe->layer);
+                        dxf_read_string (fp, &oleframe->layer);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
@@ -298,31 +289,31 @@ dxf_oleframe_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbOleFrame") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
-                        /* Now follows a string containing binary data. */
+                        /* Now follows a string containing binary data,
+                         * decode it. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", oleframe->binary_data[i]);
-                        i++;
+                        dxf_binary_data_read (fp, oleframe->binary_data);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", oleframe->dictionary_owner_soft);
+                        dxf_read_string (fp, &oleframe->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", oleframe->dictionary_owner_hard);
+                        dxf_read_string (fp, &oleframe->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -333,22 +324,26 @@ dxf_oleframe_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (oleframe->linetype, "") == 0)
         {
-                oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                oleframe->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (oleframe->layer, "") == 0)
         {
-                oleframe->layer = strdup (DXF_DEFAULT_LAYER);
+                oleframe->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -377,53 +372,52 @@ dxf_oleframe_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("OLEFRAME");
-        int i;
+        char *dxf_entity_name = dxf_strdup ("OLEFRAME");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (oleframe == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (oleframe->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, oleframe->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                oleframe->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                oleframe->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (oleframe->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, oleframe->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                oleframe->layer = strdup (DXF_DEFAULT_LAYER);
+                oleframe->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -472,7 +466,7 @@ dxf_oleframe_write
           && DXF_FLATLAND
           && (oleframe->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", oleframe->elevation);
+                dxf_write_real (fp, 38, oleframe->elevation);
         }
         if (oleframe->color != DXF_COLOR_BYLAYER)
         {
@@ -480,7 +474,7 @@ dxf_oleframe_write
         }
         if (oleframe->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", oleframe->linetype_scale);
+                dxf_write_real (fp, 48, oleframe->linetype_scale);
         }
         if (oleframe->visibility != 0)
         {
@@ -492,19 +486,17 @@ dxf_oleframe_write
         }
         if (oleframe->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", oleframe->thickness);
+                dxf_write_real (fp, 39, oleframe->thickness);
         }
         fprintf (fp->fp, " 70\n%d\n", oleframe->ole_version_number);
         fprintf (fp->fp, " 90\n%ld\n", oleframe->length);
-        i = 0;
-        while (strlen (oleframe->binary_data[i]) > 0)
+        if (oleframe->binary_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", oleframe->binary_data[i]);
-                i++;
+                dxf_binary_data_write (fp, oleframe->binary_data);
         }
         fprintf (fp->fp, "  1\nOLE\n");
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -533,24 +525,22 @@ dxf_oleframe_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         if (oleframe->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfOleFrame was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (oleframe->linetype);
-        free (oleframe->layer);
-        free (oleframe->dictionary_owner_soft);
-        free (oleframe->dictionary_owner_hard);
-        for (i = 0; i < DXF_MAX_PARAM; i++)
+        dxf_free (oleframe->linetype);
+        dxf_free (oleframe->layer);
+        dxf_free (oleframe->dictionary_owner_soft);
+        dxf_free (oleframe->dictionary_owner_hard);
+        if (oleframe->binary_data != NULL)
         {
-                free (oleframe->binary_data[i]);
+                dxf_binary_data_free (oleframe->binary_data);
         }
-        free (oleframe);
+        dxf_free (oleframe);
         oleframe = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -576,18 +566,19 @@ dxf_oleframe_free_chain
                 /*!< a pointer to the chain of DXF \c OLEFRAME entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (oleframes == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (oleframes != NULL)
         {
                 struct DxfOleFrame *iter = oleframes->next;
+                oleframes->next = NULL;
                 dxf_oleframe_free (oleframes);
                 oleframes = (DxfOleFrame *) iter;
         }
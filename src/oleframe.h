@@ -37,6 +37,7 @@
 
 
 #include "global.h"
+#include "binary_data.h"
 
 
 #ifdef __cplusplus
@@ -53,6 +54,9 @@ extern "C" {
 typedef struct
 dxf_oleframe
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< group code = 5\n
@@ -107,9 +111,9 @@ dxf_oleframe
         long length;
                 /*!< group code = 90\n
                  * Length of binary data.\n */
-        char *binary_data[DXF_MAX_PARAM];
+        DxfBinaryData *binary_data;
                 /*!< group code = 310\n
-                 * Binary data (multiple lines).*/
+                 * Binary data, decoded from multiple lines.*/
         struct DxfOleFrame *next;
                 /*!< pointer to the next DxfOleFrame.\n
                  * \c NULL in the last DxfOleFrame. */
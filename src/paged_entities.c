@@ -0,0 +1,2122 @@
+/*!
+ * \file paged_entities.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for out-of-core (paged) storage of DXF entities.
+ *
+ * Record layout (all members unaligned, native byte order):
+ * <ol>
+ * <li>\c uint8_t entity type,</li>
+ * <li>\c uint8_t number of geometry values,</li>
+ * <li>\c uint16_t length of the layer name,</li>
+ * <li>\c uint16_t length of the linetype name,</li>
+ * <li>\c int32_t id code,</li>
+ * <li>\c int32_t color,</li>
+ * <li>the geometry values as \c double,</li>
+ * <li>the \c NUL terminated layer name,</li>
+ * <li>the \c NUL terminated linetype name.</li>
+ * </ol>
+ * Page \c n is spilled at offset \c n * \c page_size in the scratch
+ * file, so a page is never moved once written.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "paged_entities.h"
+#include "entity_vtable.h"
+
+
+#define DXF_PAGED_ENTITIES_RECORD_HEADER_SIZE 34
+        /*!< \brief Size of the fixed part of a record in bytes.
+         *
+         * type (1), number of values (1), lengths of the layer, the
+         * linetype, the text and the text style (4 * 2), id-code (4),
+         * color (4), flag (4), number of vertices (4), sequence (8). */
+
+
+/*!
+ * \brief Get the number of geometry values for an entity type.
+ *
+ * \return the number of values, or -1 for an unsupported type.
+ */
+static int
+dxf_paged_entities_number_of_values
+(
+        DxfEntityType type
+                /*!< entity type. */
+)
+{
+        switch (type)
+        {
+                case POINT:
+                        return (3);
+                case LINE:
+                        return (6);
+                case CIRCLE:
+                        return (4);
+                case ARC:
+                        return (6);
+                case LWPOLYLINE:
+                        return (3);
+                case TEXT:
+                        return (6);
+                default:
+                        return (-1);
+        }
+}
+
+
+/*!
+ * \brief Decode the record at \c data.
+ *
+ * The vertices of a \c LWPOLYLINE are copied to the \c vertices member
+ * of \c paged, which was made large enough when the record was
+ * appended.
+ *
+ * \return the size of the record in bytes.
+ */
+static size_t
+dxf_paged_entities_decode
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        const unsigned char *data,
+                /*!< start of the record. */
+        DxfPagedEntity *entity
+                /*!< decoded entity, may be \c NULL to skip the record. */
+)
+{
+        uint16_t length[4];
+        uint32_t number_of_vertices;
+        int32_t value;
+        int number_of_values = data[1];
+        const char *string;
+
+        memcpy (length, data + 2, sizeof (length));
+        memcpy (&number_of_vertices, data + 22, sizeof (uint32_t));
+        if (entity != NULL)
+        {
+                entity->type = (DxfEntityType) data[0];
+                memcpy (&value, data + 10, sizeof (int32_t));
+                entity->id_code = value;
+                memcpy (&value, data + 14, sizeof (int32_t));
+                entity->color = value;
+                memcpy (&value, data + 18, sizeof (int32_t));
+                entity->flag = value;
+                memcpy (&entity->sequence, data + 26, sizeof (uint64_t));
+                memset (entity->value, 0, sizeof (entity->value));
+                memcpy (entity->value, data + DXF_PAGED_ENTITIES_RECORD_HEADER_SIZE, number_of_values * sizeof (double));
+                entity->number_of_vertices = number_of_vertices;
+                entity->vertices = NULL;
+                if (number_of_vertices > 0)
+                {
+                        memcpy (paged->vertices,
+                          data + DXF_PAGED_ENTITIES_RECORD_HEADER_SIZE + number_of_values * sizeof (double),
+                          3 * number_of_vertices * sizeof (double));
+                        entity->vertices = paged->vertices;
+                }
+                string = (const char *) data + DXF_PAGED_ENTITIES_RECORD_HEADER_SIZE
+                  + (number_of_values + 3 * number_of_vertices) * sizeof (double);
+                entity->layer = string;
+                string += length[0] + 1;
+                entity->linetype = string;
+                string += length[1] + 1;
+                entity->text_value = (entity->type == TEXT) ? string : NULL;
+                string += length[2] + 1;
+                entity->text_style = (entity->type == TEXT) ? string : NULL;
+        }
+        return (DXF_PAGED_ENTITIES_RECORD_HEADER_SIZE
+          + (number_of_values + 3 * number_of_vertices) * sizeof (double)
+          + length[0] + 1
+          + length[1] + 1
+          + length[2] + 1
+          + length[3] + 1);
+}
+
+
+/*!
+ * \brief Remove a resident page from the LRU list.
+ */
+static void
+dxf_paged_entities_lru_unlink
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        DxfPage *page
+                /*!< resident page. */
+)
+{
+        if (page->lru_prev != NULL)
+                ((DxfPage *) page->lru_prev)->lru_next = page->lru_next;
+        else
+                paged->lru_head = page->lru_next;
+        if (page->lru_next != NULL)
+                ((DxfPage *) page->lru_next)->lru_prev = page->lru_prev;
+        else
+                paged->lru_tail = page->lru_prev;
+        page->lru_prev = NULL;
+        page->lru_next = NULL;
+}
+
+
+/*!
+ * \brief Insert a resident page at the head (most recently used end)
+ * of the LRU list.
+ */
+static void
+dxf_paged_entities_lru_push
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        DxfPage *page
+                /*!< resident page. */
+)
+{
+        page->lru_prev = NULL;
+        page->lru_next = paged->lru_head;
+        if (paged->lru_head != NULL)
+                ((DxfPage *) paged->lru_head)->lru_prev = (struct DxfPage *) page;
+        paged->lru_head = (struct DxfPage *) page;
+        if (paged->lru_tail == NULL)
+                paged->lru_tail = (struct DxfPage *) page;
+}
+
+
+/*!
+ * \brief Evict the least recently used pages until \c needed bytes fit
+ * in the memory budget.
+ *
+ * The page \c keep is never evicted.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_paged_entities_evict
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        DxfPage *keep,
+                /*!< page which has to stay resident, may be \c NULL. */
+        size_t needed
+                /*!< number of bytes to make room for. */
+)
+{
+        DxfPage *victim;
+
+        while ((paged->resident_size + needed > paged->memory_budget)
+          && (paged->lru_tail != NULL))
+        {
+                victim = (DxfPage *) paged->lru_tail;
+                if (victim == keep)
+                {
+                        victim = (DxfPage *) victim->lru_prev;
+                        if (victim == NULL)
+                        {
+                                break;
+                        }
+                }
+                if (!victim->spilled)
+                {
+                        if (pwrite (fileno (paged->scratch), victim->data, paged->page_size,
+                          (off_t) victim->index * (off_t) paged->page_size) != (ssize_t) paged->page_size)
+                        {
+                                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                                  (_("Error in %s () could not write page %u to the scratch file.\n")),
+                                  __FUNCTION__, victim->index);
+                                return (EXIT_FAILURE);
+                        }
+                        victim->spilled = TRUE;
+                }
+                dxf_paged_entities_lru_unlink (paged, victim);
+                dxf_free (victim->data);
+                victim->data = NULL;
+                paged->resident_size -= paged->page_size;
+                paged->page_evictions++;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make a page resident and mark it most recently used.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_paged_entities_fault
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        DxfPage *page
+                /*!< page to make resident. */
+)
+{
+        if (page->data != NULL)
+        {
+                if (paged->lru_head != (struct DxfPage *) page)
+                {
+                        dxf_paged_entities_lru_unlink (paged, page);
+                        dxf_paged_entities_lru_push (paged, page);
+                }
+                return (EXIT_SUCCESS);
+        }
+        if (dxf_paged_entities_evict (paged, page, paged->page_size) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        page->data = dxf_malloc (paged->page_size);
+        if (page->data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a page.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (page->spilled)
+        {
+                if (pread (fileno (paged->scratch), page->data, paged->page_size,
+                  (off_t) page->index * (off_t) paged->page_size) != (ssize_t) paged->page_size)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not read page %u from the scratch file.\n")),
+                          __FUNCTION__, page->index);
+                        dxf_free (page->data);
+                        page->data = NULL;
+                        return (EXIT_FAILURE);
+                }
+                paged->page_faults++;
+        }
+        paged->resident_size += paged->page_size;
+        dxf_paged_entities_lru_push (paged, page);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate and initialize a paged storage for DXF entities.
+ *
+ * The scratch file is created in \c scratch_directory and unlinked
+ * immediately, so it is removed when the storage is freed or the
+ * process exits.
+ *
+ * \return \c NULL when no memory was allocated or the scratch file
+ * could not be created, a pointer to the paged storage when successful.
+ */
+DxfPagedEntities *
+dxf_paged_entities_new
+(
+        const char *scratch_directory,
+                /*!< directory for the scratch file, \c NULL for the
+                 * system default temporary directory. */
+        size_t page_size,
+                /*!< size of a page in bytes, 0 for
+                 * \c DXF_PAGED_ENTITIES_DEFAULT_PAGE_SIZE. */
+        size_t memory_budget
+                /*!< maximum number of bytes in resident pages, at least
+                 * two pages are kept resident. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPagedEntities *paged = NULL;
+        char *template = NULL;
+        int fd;
+
+        if (page_size == 0)
+        {
+                page_size = DXF_PAGED_ENTITIES_DEFAULT_PAGE_SIZE;
+        }
+        if (page_size < DXF_PAGED_ENTITIES_MIN_PAGE_SIZE)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () page size %lu is too small, using %d bytes.\n")),
+                  __FUNCTION__, (unsigned long) page_size, DXF_PAGED_ENTITIES_MIN_PAGE_SIZE);
+                page_size = DXF_PAGED_ENTITIES_MIN_PAGE_SIZE;
+        }
+        paged = dxf_malloc (sizeof (DxfPagedEntities));
+        if (paged == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfPagedEntities struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (paged, 0, sizeof (DxfPagedEntities));
+        paged->page_size = page_size;
+        paged->memory_budget = (memory_budget < 2 * page_size) ? 2 * page_size : memory_budget;
+        paged->sequence = DXF_PAGED_ENTITIES_AFTER_RESIDENT;
+        if (scratch_directory == NULL)
+        {
+                paged->scratch = tmpfile ();
+        }
+        else
+        {
+                template = dxf_malloc (strlen (scratch_directory) + 32);
+                if (template != NULL)
+                {
+                        sprintf (template, "%s/libdxf-pages-XXXXXX", scratch_directory);
+                        fd = mkstemp (template);
+                        if (fd >= 0)
+                        {
+                                unlink (template);
+                                paged->scratch = fdopen (fd, "w+b");
+                        }
+                        dxf_free (template);
+                }
+        }
+        if (paged->scratch == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not create a scratch file.\n")),
+                  __FUNCTION__);
+                dxf_free (paged);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (paged);
+}
+
+
+/*!
+ * \brief Free a paged storage, all resident pages and the scratch file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_paged_entities_free
+(
+        DxfPagedEntities *paged
+                /*!< paged storage. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        uint32_t i;
+
+        /* Do some basic checks. */
+        if (paged == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < paged->number_of_pages; i++)
+        {
+                dxf_free (paged->pages[i]->data);
+                dxf_free (paged->pages[i]);
+        }
+        dxf_free (paged->pages);
+        fclose (paged->scratch);
+        if (paged->point != NULL)
+        {
+                dxf_point_free (paged->point);
+        }
+        if (paged->line != NULL)
+        {
+                dxf_line_free (paged->line);
+        }
+        if (paged->circle != NULL)
+        {
+                dxf_circle_free (paged->circle);
+        }
+        if (paged->arc != NULL)
+        {
+                dxf_arc_free (paged->arc);
+        }
+        if (paged->lwpolyline != NULL)
+        {
+                dxf_lwpolyline_free (paged->lwpolyline);
+        }
+        if (paged->text != NULL)
+        {
+                dxf_text_free (paged->text);
+        }
+        dxf_free (paged->vertices);
+        dxf_free (paged);
+        paged = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append an entity to a paged storage.
+ *
+ * The record of the entity has to fit in a page.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_paged_entities_append
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        const DxfPagedEntity *entity
+                /*!< entity to append. */
+)
+{
+        DxfPage *page = NULL;
+        const char *string[4];
+        size_t string_length[4];
+        size_t record_size;
+        size_t number_of_doubles;
+        int number_of_values;
+        unsigned char *data;
+        uint16_t length;
+        uint32_t number_of_vertices;
+        int32_t value;
+        int i;
+
+        /* Do some basic checks. */
+        if ((paged == NULL) || (entity == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        number_of_values = dxf_paged_entities_number_of_values (entity->type);
+        if (number_of_values < 0)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () unsupported entity type %d.\n")),
+                  __FUNCTION__, entity->type);
+                return (EXIT_FAILURE);
+        }
+        number_of_vertices = (entity->type == LWPOLYLINE) ? entity->number_of_vertices : 0;
+        if ((number_of_vertices > 0) && (entity->vertices == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        string[0] = (entity->layer == NULL) ? DXF_DEFAULT_LAYER : entity->layer;
+        string[1] = (entity->linetype == NULL) ? DXF_DEFAULT_LINETYPE : entity->linetype;
+        string[2] = ((entity->type == TEXT) && (entity->text_value != NULL)) ? entity->text_value : "";
+        string[3] = ((entity->type == TEXT) && (entity->text_style != NULL)) ? entity->text_style : "";
+        number_of_doubles = number_of_values + 3 * (size_t) number_of_vertices;
+        record_size = DXF_PAGED_ENTITIES_RECORD_HEADER_SIZE
+          + number_of_doubles * sizeof (double);
+        for (i = 0; i < 4; i++)
+        {
+                string_length[i] = strlen (string[i]);
+                if (string_length[i] >= DXF_MAX_STRING_LENGTH)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () string too long for the entity with id-code: %x.\n")),
+                          __FUNCTION__, entity->id_code);
+                        return (EXIT_FAILURE);
+                }
+                record_size += string_length[i] + 1;
+        }
+        if (record_size > paged->page_size)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the entity with id-code: %x does not fit in a page.\n")),
+                  __FUNCTION__, entity->id_code);
+                return (EXIT_FAILURE);
+        }
+        /* Decoding copies the vertices, make room for them now. */
+        if (3 * (size_t) number_of_vertices > paged->vertices_capacity)
+        {
+                double *vertices = dxf_realloc (paged->vertices, 3 * (size_t) number_of_vertices * sizeof (double));
+
+                if (vertices == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for the vertices.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                paged->vertices = vertices;
+                paged->vertices_capacity = 3 * (size_t) number_of_vertices;
+        }
+        if (paged->number_of_pages > 0)
+        {
+                page = paged->pages[paged->number_of_pages - 1];
+        }
+        if ((page == NULL) || (page->size + record_size > paged->page_size))
+        {
+                /* Start a new page. */
+                if (paged->number_of_pages == paged->capacity)
+                {
+                        uint32_t capacity = (paged->capacity == 0) ? 64 : paged->capacity * 2;
+                        DxfPage **pages = dxf_realloc (paged->pages, capacity * sizeof (DxfPage *));
+
+                        if (pages == NULL)
+                        {
+                                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                                  (_("Error in %s () could not allocate memory for the page table.\n")),
+                                  __FUNCTION__);
+                                return (EXIT_FAILURE);
+                        }
+                        paged->pages = pages;
+                        paged->capacity = capacity;
+                }
+                page = dxf_malloc (sizeof (DxfPage));
+                if (page == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for a DxfPage struct.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                memset (page, 0, sizeof (DxfPage));
+                page->index = paged->number_of_pages;
+                page->first_record = paged->number_of_records;
+                paged->pages[paged->number_of_pages++] = page;
+        }
+        if (dxf_paged_entities_fault (paged, page) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        data = page->data + page->size;
+        data[0] = (unsigned char) entity->type;
+        data[1] = (unsigned char) number_of_values;
+        for (i = 0; i < 4; i++)
+        {
+                length = (uint16_t) string_length[i];
+                memcpy (data + 2 + i * sizeof (uint16_t), &length, sizeof (uint16_t));
+        }
+        value = entity->id_code;
+        memcpy (data + 10, &value, sizeof (int32_t));
+        value = entity->color;
+        memcpy (data + 14, &value, sizeof (int32_t));
+        value = entity->flag;
+        memcpy (data + 18, &value, sizeof (int32_t));
+        memcpy (data + 22, &number_of_vertices, sizeof (uint32_t));
+        memcpy (data + 26, &entity->sequence, sizeof (uint64_t));
+        data += DXF_PAGED_ENTITIES_RECORD_HEADER_SIZE;
+        memcpy (data, entity->value, number_of_values * sizeof (double));
+        data += number_of_values * sizeof (double);
+        if (number_of_vertices > 0)
+        {
+                memcpy (data, entity->vertices, 3 * (size_t) number_of_vertices * sizeof (double));
+                data += 3 * (size_t) number_of_vertices * sizeof (double);
+        }
+        for (i = 0; i < 4; i++)
+        {
+                memcpy (data, string[i], string_length[i] + 1);
+                data += string_length[i] + 1;
+        }
+        page->size += record_size;
+        page->number_of_records++;
+        /* The copy in the scratch file (if any) is stale now. */
+        page->spilled = FALSE;
+        paged->number_of_records++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a DXF \c POINT entity to a paged storage.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_paged_entities_append_point
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        DxfPoint *point
+                /*!< a pointer to a DXF \c POINT entity. */
+)
+{
+        DxfPagedEntity entity;
+
+        /* Do some basic checks. */
+        if ((paged == NULL) || (point == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&entity, 0, sizeof (DxfPagedEntity));
+        entity.type = POINT;
+        entity.sequence = paged->sequence;
+        entity.id_code = point->id_code;
+        entity.color = point->color;
+        entity.layer = point->layer;
+        entity.linetype = point->linetype;
+        entity.value[0] = point->x0;
+        entity.value[1] = point->y0;
+        entity.value[2] = point->z0;
+        return (dxf_paged_entities_append (paged, &entity));
+}
+
+
+/*!
+ * \brief Append a DXF \c LINE entity to a paged storage.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_paged_entities_append_line
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+        DxfPagedEntity entity;
+
+        /* Do some basic checks. */
+        if ((paged == NULL) || (line == NULL) || (line->p0 == NULL) || (line->p1 == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&entity, 0, sizeof (DxfPagedEntity));
+        entity.type = LINE;
+        entity.sequence = paged->sequence;
+        entity.id_code = line->id_code;
+        entity.color = line->color;
+        entity.layer = line->layer;
+        entity.linetype = line->linetype;
+        entity.value[0] = line->p0->x0;
+        entity.value[1] = line->p0->y0;
+        entity.value[2] = line->p0->z0;
+        entity.value[3] = line->p1->x0;
+        entity.value[4] = line->p1->y0;
+        entity.value[5] = line->p1->z0;
+        return (dxf_paged_entities_append (paged, &entity));
+}
+
+
+/*!
+ * \brief Append a DXF \c CIRCLE entity to a paged storage.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_paged_entities_append_circle
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        DxfCircle *circle
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+)
+{
+        DxfPagedEntity entity;
+
+        /* Do some basic checks. */
+        if ((paged == NULL) || (circle == NULL) || (circle->p0 == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&entity, 0, sizeof (DxfPagedEntity));
+        entity.type = CIRCLE;
+        entity.sequence = paged->sequence;
+        entity.id_code = circle->id_code;
+        entity.color = circle->color;
+        entity.layer = circle->layer;
+        entity.linetype = circle->linetype;
+        entity.value[0] = circle->p0->x0;
+        entity.value[1] = circle->p0->y0;
+        entity.value[2] = circle->p0->z0;
+        entity.value[3] = circle->radius;
+        return (dxf_paged_entities_append (paged, &entity));
+}
+
+
+/*!
+ * \brief Append a DXF \c ARC entity to a paged storage.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_paged_entities_append_arc
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        DxfArc *arc
+                /*!< a pointer to a DXF \c ARC entity. */
+)
+{
+        DxfPagedEntity entity;
+
+        /* Do some basic checks. */
+        if ((paged == NULL) || (arc == NULL) || (arc->p0 == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&entity, 0, sizeof (DxfPagedEntity));
+        entity.type = ARC;
+        entity.sequence = paged->sequence;
+        entity.id_code = arc->id_code;
+        entity.color = arc->color;
+        entity.layer = arc->layer;
+        entity.linetype = arc->linetype;
+        entity.value[0] = arc->p0->x0;
+        entity.value[1] = arc->p0->y0;
+        entity.value[2] = arc->p0->z0;
+        entity.value[3] = arc->radius;
+        entity.value[4] = arc->start_angle;
+        entity.value[5] = arc->end_angle;
+        return (dxf_paged_entities_append (paged, &entity));
+}
+
+
+/*!
+ * \brief Append a DXF \c LWPOLYLINE entity to a paged storage.
+ *
+ * The x, y and bulge of the first \c number_vertices vertices are kept,
+ * see \c dxf_paged_entities_is_plain ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_paged_entities_append_lwpolyline
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        DxfLWPolyline *lwpolyline
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+)
+{
+        DxfPagedEntity entity;
+        DxfVertex *vertex;
+        double *vertices;
+        uint32_t i;
+        int result;
+
+        /* Do some basic checks. */
+        if ((paged == NULL) || (lwpolyline == NULL) || (lwpolyline->number_vertices < 0))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&entity, 0, sizeof (DxfPagedEntity));
+        entity.type = LWPOLYLINE;
+        entity.sequence = paged->sequence;
+        entity.id_code = lwpolyline->id_code;
+        entity.color = lwpolyline->color;
+        entity.layer = lwpolyline->layer;
+        entity.linetype = lwpolyline->linetype;
+        entity.flag = lwpolyline->flag;
+        entity.value[0] = lwpolyline->elevation;
+        entity.value[1] = lwpolyline->thickness;
+        entity.value[2] = lwpolyline->constant_width;
+        entity.number_of_vertices = (uint32_t) lwpolyline->number_vertices;
+        vertices = dxf_malloc ((3 * (size_t) entity.number_of_vertices + 1) * sizeof (double));
+        if (vertices == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the vertices.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        vertex = (DxfVertex *) lwpolyline->vertices;
+        for (i = 0; i < entity.number_of_vertices; i++)
+        {
+                if (vertex == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () the entity with id-code: %x has less than %d vertices.\n")),
+                          __FUNCTION__, lwpolyline->id_code, lwpolyline->number_vertices);
+                        dxf_free (vertices);
+                        return (EXIT_FAILURE);
+                }
+                vertices[3 * i] = vertex->x0;
+                vertices[3 * i + 1] = vertex->y0;
+                vertices[3 * i + 2] = vertex->bulge;
+                vertex = (DxfVertex *) vertex->next;
+        }
+        entity.vertices = vertices;
+        result = dxf_paged_entities_append (paged, &entity);
+        dxf_free (vertices);
+        return (result);
+}
+
+
+/*!
+ * \brief Append a DXF \c TEXT entity to a paged storage.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_paged_entities_append_text
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        DxfText *text
+                /*!< a pointer to a DXF \c TEXT entity. */
+)
+{
+        DxfPagedEntity entity;
+
+        /* Do some basic checks. */
+        if ((paged == NULL) || (text == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&entity, 0, sizeof (DxfPagedEntity));
+        entity.type = TEXT;
+        entity.sequence = paged->sequence;
+        entity.id_code = text->id_code;
+        entity.color = text->color;
+        entity.layer = text->layer;
+        entity.linetype = text->linetype;
+        entity.text_value = text->text_value;
+        entity.text_style = text->text_style;
+        entity.value[0] = text->x0;
+        entity.value[1] = text->y0;
+        entity.value[2] = text->z0;
+        entity.value[3] = text->height;
+        entity.value[4] = text->rel_x_scale;
+        entity.value[5] = text->rot_angle;
+        return (dxf_paged_entities_append (paged, &entity));
+}
+
+
+/*!
+ * \brief Test if two strings are equal, a \c NULL pointer equals an
+ * empty string.
+ */
+static int
+dxf_paged_entities_same_string
+(
+        const char *string,
+                /*!< a string, or \c NULL. */
+        const char *other
+                /*!< the other string, or \c NULL. */
+)
+{
+        return (strcmp ((string == NULL) ? "" : string,
+          (other == NULL) ? "" : other) == 0);
+}
+
+
+/*!
+ * \brief Test if the members of \c entity which are not kept in a
+ * record have the values of \c prototype, a new entity of the same type,
+ * except the elevation and the thickness.
+ */
+#define DXF_PAGED_ENTITIES_IS_PLAIN_COMMON(entity, prototype) \
+        (((entity)->linetype_scale == (prototype)->linetype_scale) \
+          && ((entity)->visibility == (prototype)->visibility) \
+          && ((entity)->paperspace == (prototype)->paperspace) \
+          && ((entity)->graphics_data_size == 0) \
+          && ((entity)->shadow_mode == (prototype)->shadow_mode) \
+          && (dxf_paged_entities_same_string ((entity)->dictionary_owner_soft, (prototype)->dictionary_owner_soft)) \
+          && (dxf_paged_entities_same_string ((entity)->material, (prototype)->material)) \
+          && (dxf_paged_entities_same_string ((entity)->dictionary_owner_hard, (prototype)->dictionary_owner_hard)) \
+          && ((entity)->lineweight == (prototype)->lineweight) \
+          && (dxf_paged_entities_same_string ((entity)->plot_style_name, (prototype)->plot_style_name)) \
+          && ((entity)->color_value == (prototype)->color_value) \
+          && (dxf_paged_entities_same_string ((entity)->color_name, (prototype)->color_name)) \
+          && ((entity)->transparency == (prototype)->transparency) \
+          && ((entity)->extr_x0 == (prototype)->extr_x0) \
+          && ((entity)->extr_y0 == (prototype)->extr_y0) \
+          && ((entity)->extr_z0 == (prototype)->extr_z0))
+
+
+/*!
+ * \brief Test if the members of \c entity which are not kept in a
+ * record have the values of \c prototype, a new entity of the same type.
+ */
+#define DXF_PAGED_ENTITIES_IS_PLAIN(entity, prototype) \
+        (((entity)->elevation == (prototype)->elevation) \
+          && ((entity)->thickness == (prototype)->thickness) \
+          && (DXF_PAGED_ENTITIES_IS_PLAIN_COMMON (entity, prototype)))
+
+
+/*!
+ * \brief Test if the vertices of a \c LWPOLYLINE can be kept in a
+ * record: there are \c number_vertices of them and they have the
+ * constant width.
+ */
+static int
+dxf_paged_entities_is_plain_lwpolyline
+(
+        DxfLWPolyline *lwpolyline
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+)
+{
+        DxfVertex *vertex;
+        int number_of_vertices = 0;
+
+        for (vertex = (DxfVertex *) lwpolyline->vertices;
+          vertex != NULL;
+          vertex = (DxfVertex *) vertex->next)
+        {
+                if ((vertex->start_width != lwpolyline->constant_width)
+                  || (vertex->end_width != lwpolyline->constant_width))
+                {
+                        return (FALSE);
+                }
+                number_of_vertices++;
+        }
+        return ((number_of_vertices > 0)
+          && (number_of_vertices == lwpolyline->number_vertices));
+}
+
+
+/*!
+ * \brief Test if the members of a \c TEXT which are not kept in a
+ * record have the values of \c prototype, a new \c TEXT.
+ *
+ * A \c TEXT without a text is not written, it is not plain either.
+ */
+static int
+dxf_paged_entities_is_plain_text
+(
+        DxfText *text,
+                /*!< a pointer to a DXF \c TEXT entity. */
+        DxfText *prototype
+                /*!< a pointer to a new DXF \c TEXT entity. */
+)
+{
+        return ((text->elevation == prototype->elevation)
+          && (text->thickness == prototype->thickness)
+          && (text->linetype_scale == prototype->linetype_scale)
+          && (text->visibility == prototype->visibility)
+          && (text->paperspace == prototype->paperspace)
+          && (dxf_paged_entities_same_string (text->dictionary_owner_soft, prototype->dictionary_owner_soft))
+          && (dxf_paged_entities_same_string (text->dictionary_owner_hard, prototype->dictionary_owner_hard))
+          && (text->x1 == prototype->x1)
+          && (text->y1 == prototype->y1)
+          && (text->z1 == prototype->z1)
+          && (text->obl_angle == prototype->obl_angle)
+          && (text->text_flags == prototype->text_flags)
+          && (text->hor_align == prototype->hor_align)
+          && (text->vert_align == prototype->vert_align)
+          && (text->extr_x0 == prototype->extr_x0)
+          && (text->extr_y0 == prototype->extr_y0)
+          && (text->extr_z0 == prototype->extr_z0)
+          && (!dxf_paged_entities_same_string (text->text_value, "")));
+}
+
+
+/*!
+ * \brief Test if an entity can be kept in a record.
+ *
+ * Only \c POINT, \c LINE, \c CIRCLE, \c ARC, \c LWPOLYLINE and
+ * \c TEXT entities can be kept in a record, and only when the members
+ * which are not kept in a record have the values of \c prototype, a new
+ * entity of the same type, so the entity written from its record is the
+ * entity that was kept.\n
+ * Of a \c LWPOLYLINE the vertices are kept without their widths, all of
+ * them have to have the constant width.
+ *
+ * \return \c TRUE when the entity can be kept in a record, \c FALSE
+ * otherwise.
+ */
+int
+dxf_paged_entities_is_plain
+(
+        void *entity,
+                /*!< a pointer to a DXF entity. */
+        void *prototype
+                /*!< a pointer to a new entity of the same type, made by
+                 * \c dxf_entity_new () and \c dxf_entity_init (). */
+)
+{
+        /* Do some basic checks. */
+        if ((entity == NULL)
+          || (prototype == NULL)
+          || (dxf_entity_get_type (entity) != dxf_entity_get_type (prototype)))
+        {
+                return (FALSE);
+        }
+        switch (dxf_entity_get_type (entity))
+        {
+                case POINT:
+                        return ((DXF_PAGED_ENTITIES_IS_PLAIN ((DxfPoint *) entity, (DxfPoint *) prototype))
+                          && (((DxfPoint *) entity)->angle_to_X == ((DxfPoint *) prototype)->angle_to_X));
+                case LINE:
+                        return ((DXF_PAGED_ENTITIES_IS_PLAIN ((DxfLine *) entity, (DxfLine *) prototype))
+                          && (((DxfLine *) entity)->p0 != NULL)
+                          && (((DxfLine *) entity)->p1 != NULL));
+                case CIRCLE:
+                        return ((DXF_PAGED_ENTITIES_IS_PLAIN ((DxfCircle *) entity, (DxfCircle *) prototype))
+                          && (((DxfCircle *) entity)->p0 != NULL));
+                case ARC:
+                        return ((DXF_PAGED_ENTITIES_IS_PLAIN ((DxfArc *) entity, (DxfArc *) prototype))
+                          && (((DxfArc *) entity)->p0 != NULL));
+                case LWPOLYLINE:
+                        return ((DXF_PAGED_ENTITIES_IS_PLAIN_COMMON ((DxfLWPolyline *) entity, (DxfLWPolyline *) prototype))
+                          && (dxf_paged_entities_is_plain_lwpolyline ((DxfLWPolyline *) entity)));
+                case TEXT:
+                        return (dxf_paged_entities_is_plain_text ((DxfText *) entity, (DxfText *) prototype));
+                default:
+                        return (FALSE);
+        }
+}
+
+
+/*!
+ * \brief Append an entity of any type to a paged storage, when it can be
+ * kept in a record (see \c dxf_paged_entities_is_plain ()).
+ *
+ * The caller keeps ownership of \c entity.
+ *
+ * \return \c EXIT_SUCCESS when the entity was appended, or
+ * \c EXIT_FAILURE when it can not be kept in a record or an error
+ * occurred.
+ */
+int
+dxf_paged_entities_append_entity
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        void *entity
+                /*!< a pointer to a DXF entity. */
+)
+{
+        /* Do some basic checks. */
+        if ((paged == NULL) || (entity == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        switch (dxf_entity_get_type (entity))
+        {
+                case POINT:
+                        if (paged->point == NULL)
+                        {
+                                paged->point = dxf_point_init (dxf_point_new ());
+                        }
+                        if (!dxf_paged_entities_is_plain (entity, paged->point))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        return (dxf_paged_entities_append_point (paged, (DxfPoint *) entity));
+                case LINE:
+                        if (paged->line == NULL)
+                        {
+                                paged->line = dxf_line_init (dxf_line_new ());
+                        }
+                        if (!dxf_paged_entities_is_plain (entity, paged->line))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        return (dxf_paged_entities_append_line (paged, (DxfLine *) entity));
+                case CIRCLE:
+                        if (paged->circle == NULL)
+                        {
+                                paged->circle = dxf_circle_init (dxf_circle_new ());
+                        }
+                        if (!dxf_paged_entities_is_plain (entity, paged->circle))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        return (dxf_paged_entities_append_circle (paged, (DxfCircle *) entity));
+                case ARC:
+                        if (paged->arc == NULL)
+                        {
+                                paged->arc = dxf_arc_init (dxf_arc_new ());
+                        }
+                        if (!dxf_paged_entities_is_plain (entity, paged->arc))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        return (dxf_paged_entities_append_arc (paged, (DxfArc *) entity));
+                case LWPOLYLINE:
+                        if (paged->lwpolyline == NULL)
+                        {
+                                paged->lwpolyline = dxf_lwpolyline_init (dxf_lwpolyline_new ());
+                        }
+                        /* A record has to fit in a page. */
+                        if ((!dxf_paged_entities_is_plain (entity, paged->lwpolyline))
+                          || (DXF_PAGED_ENTITIES_RECORD_HEADER_SIZE
+                          + (3 + 3 * (size_t) ((DxfLWPolyline *) entity)->number_vertices) * sizeof (double)
+                          + 4 * DXF_MAX_STRING_LENGTH > paged->page_size))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        return (dxf_paged_entities_append_lwpolyline (paged, (DxfLWPolyline *) entity));
+                case TEXT:
+                        if (paged->text == NULL)
+                        {
+                                paged->text = dxf_text_init (dxf_text_new ());
+                        }
+                        if (!dxf_paged_entities_is_plain (entity, paged->text))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        return (dxf_paged_entities_append_text (paged, (DxfText *) entity));
+                default:
+                        return (EXIT_FAILURE);
+        }
+}
+
+
+/*!
+ * \brief Get an entity from a paged storage by index (in order of
+ * appending).
+ *
+ * The page holding the entity is faulted in when needed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_paged_entities_get
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        uint64_t index,
+                /*!< index of the entity. */
+        DxfPagedEntity *entity
+                /*!< returns the decoded entity. */
+)
+{
+        DxfPage *page;
+        uint32_t low;
+        uint32_t high;
+        uint32_t middle;
+        uint64_t i;
+        size_t offset = 0;
+
+        /* Do some basic checks. */
+        if ((paged == NULL) || (entity == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (index >= paged->number_of_records)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () index out of range.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Binary search for the last page starting at or before index. */
+        low = 0;
+        high = paged->number_of_pages - 1;
+        while (low < high)
+        {
+                middle = low + (high - low + 1) / 2;
+                if (paged->pages[middle]->first_record <= index)
+                        low = middle;
+                else
+                        high = middle - 1;
+        }
+        page = paged->pages[low];
+        if (dxf_paged_entities_fault (paged, page) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = page->first_record; i < index; i++)
+        {
+                offset += dxf_paged_entities_decode (paged, page->data + offset, NULL);
+        }
+        dxf_paged_entities_decode (paged, page->data + offset, entity);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Iterate over all entities in a paged storage in order of
+ * appending.
+ *
+ * Every page is faulted in at most once.\n
+ * Iteration stops when \c callback returns a non-zero value.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or the iteration was stopped.
+ */
+int
+dxf_paged_entities_foreach
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        int (*callback) (const DxfPagedEntity *entity, void *data),
+                /*!< function invoked for every entity. */
+        void *data
+                /*!< user data passed to \c callback. */
+)
+{
+        DxfPagedEntity entity;
+        DxfPage *page;
+        uint32_t i;
+        uint32_t j;
+        size_t offset;
+
+        /* Do some basic checks. */
+        if ((paged == NULL) || (callback == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < paged->number_of_pages; i++)
+        {
+                page = paged->pages[i];
+                if (dxf_paged_entities_fault (paged, page) != EXIT_SUCCESS)
+                {
+                        return (EXIT_FAILURE);
+                }
+                offset = 0;
+                for (j = 0; j < page->number_of_records; j++)
+                {
+                        offset += dxf_paged_entities_decode (paged, page->data + offset, &entity);
+                        if (callback (&entity, data) != 0)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Replace a string member of a new entity by a copy of a string
+ * of a decoded entity.
+ */
+#define DXF_PAGED_ENTITIES_SET_STRING(member, string) \
+        { \
+                dxf_free (member); \
+                (member) = dxf_strdup (string); \
+        }
+
+
+/*!
+ * \brief Set the members common to all entity types of a new entity.
+ */
+#define DXF_PAGED_ENTITIES_SET_COMMON(new_entity, entity) \
+        { \
+                (new_entity)->id_code = (entity)->id_code; \
+                (new_entity)->color = (entity)->color; \
+                DXF_PAGED_ENTITIES_SET_STRING ((new_entity)->layer, (entity)->layer); \
+                DXF_PAGED_ENTITIES_SET_STRING ((new_entity)->linetype, (entity)->linetype); \
+        }
+
+
+/*!
+ * \brief Create a new entity from an entity of a paged storage.
+ *
+ * The new entity is independent of the paged storage, the caller frees
+ * it with \c dxf_entity_free ().
+ *
+ * \return a pointer to the new entity, or \c NULL when an error
+ * occurred.
+ */
+void *
+dxf_paged_entities_new_entity
+(
+        const DxfPagedEntity *entity
+                /*!< decoded entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLWPolyline *lwpolyline;
+        DxfVertex *vertex;
+        DxfVertex *last = NULL;
+        DxfText *text;
+        void *result;
+        uint32_t i;
+
+        /* Do some basic checks. */
+        if (entity == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        result = dxf_entity_init (dxf_entity_new (entity->type));
+        if (result == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the entity.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        switch (entity->type)
+        {
+                case POINT:
+                        ((DxfPoint *) result)->x0 = entity->value[0];
+                        ((DxfPoint *) result)->y0 = entity->value[1];
+                        ((DxfPoint *) result)->z0 = entity->value[2];
+                        DXF_PAGED_ENTITIES_SET_COMMON ((DxfPoint *) result, entity);
+                        break;
+                case LINE:
+                        ((DxfLine *) result)->p0->x0 = entity->value[0];
+                        ((DxfLine *) result)->p0->y0 = entity->value[1];
+                        ((DxfLine *) result)->p0->z0 = entity->value[2];
+                        ((DxfLine *) result)->p1->x0 = entity->value[3];
+                        ((DxfLine *) result)->p1->y0 = entity->value[4];
+                        ((DxfLine *) result)->p1->z0 = entity->value[5];
+                        DXF_PAGED_ENTITIES_SET_COMMON ((DxfLine *) result, entity);
+                        break;
+                case CIRCLE:
+                        ((DxfCircle *) result)->p0->x0 = entity->value[0];
+                        ((DxfCircle *) result)->p0->y0 = entity->value[1];
+                        ((DxfCircle *) result)->p0->z0 = entity->value[2];
+                        ((DxfCircle *) result)->radius = entity->value[3];
+                        DXF_PAGED_ENTITIES_SET_COMMON ((DxfCircle *) result, entity);
+                        break;
+                case ARC:
+                        ((DxfArc *) result)->p0->x0 = entity->value[0];
+                        ((DxfArc *) result)->p0->y0 = entity->value[1];
+                        ((DxfArc *) result)->p0->z0 = entity->value[2];
+                        ((DxfArc *) result)->radius = entity->value[3];
+                        ((DxfArc *) result)->start_angle = entity->value[4];
+                        ((DxfArc *) result)->end_angle = entity->value[5];
+                        DXF_PAGED_ENTITIES_SET_COMMON ((DxfArc *) result, entity);
+                        break;
+                case LWPOLYLINE:
+                        lwpolyline = result;
+                        if (lwpolyline->vertices != NULL)
+                        {
+                                dxf_vertex_free_chain ((DxfVertex *) lwpolyline->vertices);
+                                lwpolyline->vertices = NULL;
+                        }
+                        lwpolyline->flag = entity->flag;
+                        lwpolyline->elevation = entity->value[0];
+                        lwpolyline->thickness = entity->value[1];
+                        lwpolyline->constant_width = entity->value[2];
+                        for (i = 0; i < entity->number_of_vertices; i++)
+                        {
+                                vertex = dxf_vertex_init (dxf_vertex_new ());
+                                if (vertex == NULL)
+                                {
+                                        dxf_entity_free (result);
+                                        return (NULL);
+                                }
+                                vertex->x0 = entity->vertices[3 * i];
+                                vertex->y0 = entity->vertices[3 * i + 1];
+                                vertex->bulge = entity->vertices[3 * i + 2];
+                                vertex->start_width = entity->value[2];
+                                vertex->end_width = entity->value[2];
+                                if (last == NULL)
+                                {
+                                        lwpolyline->vertices = (struct DxfVertex *) vertex;
+                                }
+                                else
+                                {
+                                        last->next = (struct DxfVertex *) vertex;
+                                }
+                                last = vertex;
+                                lwpolyline->number_vertices++;
+                        }
+                        DXF_PAGED_ENTITIES_SET_COMMON (lwpolyline, entity);
+                        break;
+                case TEXT:
+                        text = result;
+                        text->x0 = entity->value[0];
+                        text->y0 = entity->value[1];
+                        text->z0 = entity->value[2];
+                        text->height = entity->value[3];
+                        text->rel_x_scale = entity->value[4];
+                        text->rot_angle = entity->value[5];
+                        DXF_PAGED_ENTITIES_SET_STRING (text->text_value, entity->text_value);
+                        DXF_PAGED_ENTITIES_SET_STRING (text->text_style, entity->text_style);
+                        DXF_PAGED_ENTITIES_SET_COMMON (text, entity);
+                        break;
+                default:
+                        break;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Prototype entities reused while writing a paged storage.
+ *
+ * The string members of the prototypes point to the string buffers of
+ * the writer.
+ */
+typedef struct
+dxf_paged_entities_writer_struct
+{
+        DxfFile *fp;
+        DxfEntities *entities;
+                /*!< Entities kept in memory, or \c NULL. */
+        size_t number_written;
+                /*!< Number of entities kept in memory written so far. */
+        DxfPoint *point;
+        DxfLine *line;
+        DxfCircle *circle;
+        DxfArc *arc;
+        DxfLWPolyline *lwpolyline;
+        DxfText *text;
+        DxfVertex **vertices;
+                /*!< Vertices of \c lwpolyline, linked when written. */
+        uint32_t number_of_vertices;
+                /*!< Number of allocated \c vertices. */
+        char *layer;
+        char *linetype;
+        char *text_value;
+        char *text_style;
+        int result;
+} DxfPagedEntitiesWriter;
+
+
+/*!
+ * \brief Copy a string into a buffer of \c DXF_MAX_STRING_LENGTH bytes
+ * owned by a writer.
+ */
+static void
+dxf_paged_entities_copy_string
+(
+        char *buffer,
+                /*!< destination buffer. */
+        const char *string
+                /*!< source string. */
+)
+{
+        strncpy (buffer, string, DXF_MAX_STRING_LENGTH - 1);
+        buffer[DXF_MAX_STRING_LENGTH - 1] = '\0';
+}
+
+
+/*!
+ * \brief Point a string member of a prototype back to the buffer of the
+ * writer, the \c *_write () functions replace an empty string by a
+ * default.
+ */
+#define DXF_PAGED_ENTITIES_RESTORE_STRING(member, buffer) \
+        if ((member) != (buffer)) \
+        { \
+                dxf_free (member); \
+                (member) = (buffer); \
+        }
+
+
+/*!
+ * \brief Give a prototype entity the layer and linetype buffers of a
+ * writer.
+ */
+#define DXF_PAGED_ENTITIES_SET_BUFFERS(writer, prototype) \
+        { \
+                dxf_free ((prototype)->layer); \
+                dxf_free ((prototype)->linetype); \
+                (prototype)->layer = (writer)->layer; \
+                (prototype)->linetype = (writer)->linetype; \
+        }
+
+
+/*!
+ * \brief Take the layer and linetype buffers of a writer from a
+ * prototype entity before it is freed.
+ */
+#define DXF_PAGED_ENTITIES_CLEAR_BUFFERS(writer, prototype) \
+        { \
+                DXF_PAGED_ENTITIES_RESTORE_STRING ((prototype)->layer, (writer)->layer); \
+                DXF_PAGED_ENTITIES_RESTORE_STRING ((prototype)->linetype, (writer)->linetype); \
+                (prototype)->layer = NULL; \
+                (prototype)->linetype = NULL; \
+        }
+
+
+/*!
+ * \brief Link the first \c number_of_vertices vertices of a writer to
+ * its \c LWPOLYLINE prototype, more vertices are allocated when needed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_paged_entities_link_vertices
+(
+        DxfPagedEntitiesWriter *writer,
+                /*!< the writer. */
+        uint32_t number_of_vertices
+                /*!< number of vertices. */
+)
+{
+        DxfVertex **vertices;
+        uint32_t i;
+
+        if (number_of_vertices > writer->number_of_vertices)
+        {
+                vertices = dxf_realloc (writer->vertices, number_of_vertices * sizeof (DxfVertex *));
+                if (vertices == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                writer->vertices = vertices;
+                for (i = writer->number_of_vertices; i < number_of_vertices; i++)
+                {
+                        writer->vertices[i] = dxf_vertex_init (dxf_vertex_new ());
+                        if (writer->vertices[i] == NULL)
+                        {
+                                writer->number_of_vertices = i;
+                                return (EXIT_FAILURE);
+                        }
+                }
+                writer->number_of_vertices = number_of_vertices;
+        }
+        for (i = 0; i < writer->number_of_vertices; i++)
+        {
+                writer->vertices[i]->next = (i + 1 < number_of_vertices)
+                  ? (struct DxfVertex *) writer->vertices[i + 1]
+                  : NULL;
+        }
+        writer->lwpolyline->vertices = (number_of_vertices > 0)
+          ? (struct DxfVertex *) writer->vertices[0]
+          : NULL;
+        writer->lwpolyline->number_vertices = (int) number_of_vertices;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write the entities kept in memory which precede a sequence in
+ * file order.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when one or more
+ * entities could not be written.
+ */
+static int
+dxf_paged_entities_write_resident
+(
+        DxfPagedEntitiesWriter *writer,
+                /*!< the writer. */
+        uint64_t sequence
+                /*!< sequence of the next entity of the paged storage. */
+)
+{
+        size_t last;
+        int result;
+
+        if (writer->entities == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        last = dxf_entities_get_number_of_entities (writer->entities);
+        if (sequence < (uint64_t) last)
+        {
+                last = (size_t) sequence;
+        }
+        if (last <= writer->number_written)
+        {
+                return (EXIT_SUCCESS);
+        }
+        result = dxf_entities_write_range (writer->fp, writer->entities,
+          writer->number_written, last);
+        writer->number_written = last;
+        return (result);
+}
+
+
+/*!
+ * \brief Write one entity from a paged storage through the prototype
+ * entities of a writer, after the entities kept in memory which
+ * precede it.
+ *
+ * \return 0 to continue the iteration, 1 to stop it.
+ */
+static int
+dxf_paged_entities_write_entity
+(
+        const DxfPagedEntity *entity,
+                /*!< decoded entity. */
+        void *data
+                /*!< the \c DxfPagedEntitiesWriter. */
+)
+{
+        DxfPagedEntitiesWriter *writer = data;
+        uint32_t i;
+
+        if (dxf_paged_entities_write_resident (writer, entity->sequence) != EXIT_SUCCESS)
+        {
+                writer->result = EXIT_FAILURE;
+                return (1);
+        }
+        dxf_paged_entities_copy_string (writer->layer, entity->layer);
+        dxf_paged_entities_copy_string (writer->linetype, entity->linetype);
+        switch (entity->type)
+        {
+                case POINT:
+                        writer->point->id_code = entity->id_code;
+                        writer->point->color = entity->color;
+                        writer->point->x0 = entity->value[0];
+                        writer->point->y0 = entity->value[1];
+                        writer->point->z0 = entity->value[2];
+                        writer->result = dxf_point_write (writer->fp, writer->point);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->point->layer, writer->layer);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->point->linetype, writer->linetype);
+                        break;
+                case LINE:
+                        writer->line->id_code = entity->id_code;
+                        writer->line->color = entity->color;
+                        writer->line->p0->x0 = entity->value[0];
+                        writer->line->p0->y0 = entity->value[1];
+                        writer->line->p0->z0 = entity->value[2];
+                        writer->line->p1->x0 = entity->value[3];
+                        writer->line->p1->y0 = entity->value[4];
+                        writer->line->p1->z0 = entity->value[5];
+                        writer->result = dxf_line_write (writer->fp, writer->line);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->line->layer, writer->layer);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->line->linetype, writer->linetype);
+                        break;
+                case CIRCLE:
+                        writer->circle->id_code = entity->id_code;
+                        writer->circle->color = entity->color;
+                        writer->circle->p0->x0 = entity->value[0];
+                        writer->circle->p0->y0 = entity->value[1];
+                        writer->circle->p0->z0 = entity->value[2];
+                        writer->circle->radius = entity->value[3];
+                        writer->result = dxf_circle_write (writer->fp, writer->circle);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->circle->layer, writer->layer);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->circle->linetype, writer->linetype);
+                        break;
+                case ARC:
+                        writer->arc->id_code = entity->id_code;
+                        writer->arc->color = entity->color;
+                        writer->arc->p0->x0 = entity->value[0];
+                        writer->arc->p0->y0 = entity->value[1];
+                        writer->arc->p0->z0 = entity->value[2];
+                        writer->arc->radius = entity->value[3];
+                        writer->arc->start_angle = entity->value[4];
+                        writer->arc->end_angle = entity->value[5];
+                        writer->result = dxf_arc_write (writer->fp, writer->arc);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->arc->layer, writer->layer);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->arc->linetype, writer->linetype);
+                        break;
+                case LWPOLYLINE:
+                        if (dxf_paged_entities_link_vertices (writer, entity->number_of_vertices) != EXIT_SUCCESS)
+                        {
+                                dxf_diagnostic (writer->fp, DXF_DIAGNOSTIC_ERROR,
+                                  (_("Error in %s () could not allocate memory for the vertices.\n")),
+                                  __FUNCTION__);
+                                writer->result = EXIT_FAILURE;
+                                break;
+                        }
+                        writer->lwpolyline->id_code = entity->id_code;
+                        writer->lwpolyline->color = entity->color;
+                        writer->lwpolyline->flag = entity->flag;
+                        writer->lwpolyline->elevation = entity->value[0];
+                        writer->lwpolyline->thickness = entity->value[1];
+                        writer->lwpolyline->constant_width = entity->value[2];
+                        for (i = 0; i < entity->number_of_vertices; i++)
+                        {
+                                writer->vertices[i]->x0 = entity->vertices[3 * i];
+                                writer->vertices[i]->y0 = entity->vertices[3 * i + 1];
+                                writer->vertices[i]->bulge = entity->vertices[3 * i + 2];
+                                writer->vertices[i]->start_width = entity->value[2];
+                                writer->vertices[i]->end_width = entity->value[2];
+                        }
+                        writer->result = dxf_lwpolyline_write (writer->fp, writer->lwpolyline);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->lwpolyline->layer, writer->layer);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->lwpolyline->linetype, writer->linetype);
+                        break;
+                case TEXT:
+                        dxf_paged_entities_copy_string (writer->text_value, entity->text_value);
+                        dxf_paged_entities_copy_string (writer->text_style, entity->text_style);
+                        writer->text->id_code = entity->id_code;
+                        writer->text->color = entity->color;
+                        writer->text->x0 = entity->value[0];
+                        writer->text->y0 = entity->value[1];
+                        writer->text->z0 = entity->value[2];
+                        writer->text->height = entity->value[3];
+                        writer->text->rel_x_scale = entity->value[4];
+                        writer->text->rot_angle = entity->value[5];
+                        writer->result = dxf_text_write (writer->fp, writer->text);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->text->layer, writer->layer);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->text->linetype, writer->linetype);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->text->text_value, writer->text_value);
+                        DXF_PAGED_ENTITIES_RESTORE_STRING (writer->text->text_style, writer->text_style);
+                        break;
+                default:
+                        writer->result = EXIT_FAILURE;
+                        break;
+        }
+        return ((writer->result == EXIT_SUCCESS) ? 0 : 1);
+}
+
+
+/*!
+ * \brief Write DXF output for all entities in a paged storage, merged
+ * in file order with the entities kept in memory.
+ *
+ * Every entity of the paged storage is written after the entities kept
+ * in memory which precede it (see \c DxfPagedEntity), the entities kept
+ * in memory are written by \c dxf_entities_write_range ().\n
+ * Only one prototype entity per type is kept in memory, the pages are
+ * streamed through in order.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_paged_entities_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        DxfEntities *entities
+                /*!< entities kept in memory, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPagedEntitiesWriter writer;
+        uint32_t i;
+        int result;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (paged == NULL))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (&writer, 0, sizeof (DxfPagedEntitiesWriter));
+        writer.fp = fp;
+        writer.entities = entities;
+        /* The prototypes share string buffers which can hold any
+         * name. */
+        writer.layer = dxf_malloc (DXF_MAX_STRING_LENGTH);
+        writer.linetype = dxf_malloc (DXF_MAX_STRING_LENGTH);
+        writer.text_value = dxf_malloc (DXF_MAX_STRING_LENGTH);
+        writer.text_style = dxf_malloc (DXF_MAX_STRING_LENGTH);
+        writer.point = dxf_point_init (dxf_point_new ());
+        writer.line = dxf_line_init (dxf_line_new ());
+        writer.circle = dxf_circle_init (dxf_circle_new ());
+        writer.arc = dxf_arc_init (dxf_arc_new ());
+        writer.lwpolyline = dxf_lwpolyline_init (dxf_lwpolyline_new ());
+        writer.text = dxf_text_init (dxf_text_new ());
+        result = EXIT_FAILURE;
+        if ((writer.layer != NULL)
+          && (writer.linetype != NULL)
+          && (writer.text_value != NULL)
+          && (writer.text_style != NULL)
+          && (writer.point != NULL)
+          && (writer.line != NULL)
+          && (writer.circle != NULL)
+          && (writer.arc != NULL)
+          && (writer.lwpolyline != NULL)
+          && (writer.text != NULL))
+        {
+                DXF_PAGED_ENTITIES_SET_BUFFERS (&writer, writer.point);
+                DXF_PAGED_ENTITIES_SET_BUFFERS (&writer, writer.line);
+                DXF_PAGED_ENTITIES_SET_BUFFERS (&writer, writer.circle);
+                DXF_PAGED_ENTITIES_SET_BUFFERS (&writer, writer.arc);
+                DXF_PAGED_ENTITIES_SET_BUFFERS (&writer, writer.lwpolyline);
+                DXF_PAGED_ENTITIES_SET_BUFFERS (&writer, writer.text);
+                dxf_free (writer.text->text_value);
+                dxf_free (writer.text->text_style);
+                writer.text->text_value = writer.text_value;
+                writer.text->text_style = writer.text_style;
+                if (writer.lwpolyline->vertices != NULL)
+                {
+                        dxf_vertex_free_chain ((DxfVertex *) writer.lwpolyline->vertices);
+                        writer.lwpolyline->vertices = NULL;
+                }
+                if (writer.line->p1 == NULL)
+                {
+                        writer.line->p1 = dxf_point_init (dxf_point_new ());
+                }
+                if ((writer.line->p0 != NULL)
+                  && (writer.line->p1 != NULL)
+                  && (writer.circle->p0 != NULL)
+                  && (writer.arc->p0 != NULL))
+                {
+                        result = dxf_paged_entities_foreach (paged, dxf_paged_entities_write_entity, &writer);
+                        /* The entities kept in memory which follow the
+                         * last entity of the paged storage. */
+                        result |= dxf_paged_entities_write_resident (&writer, DXF_PAGED_ENTITIES_AFTER_RESIDENT);
+                }
+                else
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for the prototype entities.\n")),
+                          __FUNCTION__);
+                }
+                DXF_PAGED_ENTITIES_CLEAR_BUFFERS (&writer, writer.point);
+                DXF_PAGED_ENTITIES_CLEAR_BUFFERS (&writer, writer.line);
+                DXF_PAGED_ENTITIES_CLEAR_BUFFERS (&writer, writer.circle);
+                DXF_PAGED_ENTITIES_CLEAR_BUFFERS (&writer, writer.arc);
+                DXF_PAGED_ENTITIES_CLEAR_BUFFERS (&writer, writer.lwpolyline);
+                DXF_PAGED_ENTITIES_CLEAR_BUFFERS (&writer, writer.text);
+                DXF_PAGED_ENTITIES_RESTORE_STRING (writer.text->text_value, writer.text_value);
+                DXF_PAGED_ENTITIES_RESTORE_STRING (writer.text->text_style, writer.text_style);
+                writer.text->text_value = NULL;
+                writer.text->text_style = NULL;
+                writer.lwpolyline->vertices = NULL;
+        }
+        else
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the prototype entities.\n")),
+                  __FUNCTION__);
+        }
+        /* Free the prototypes allocated so far. */
+        if (writer.point != NULL)
+        {
+                dxf_point_free (writer.point);
+        }
+        if (writer.line != NULL)
+        {
+                dxf_line_free (writer.line);
+        }
+        if (writer.circle != NULL)
+        {
+                dxf_circle_free (writer.circle);
+        }
+        if (writer.arc != NULL)
+        {
+                dxf_arc_free (writer.arc);
+        }
+        if (writer.lwpolyline != NULL)
+        {
+                dxf_lwpolyline_free (writer.lwpolyline);
+        }
+        if (writer.text != NULL)
+        {
+                dxf_text_free (writer.text);
+        }
+        for (i = 0; i < writer.number_of_vertices; i++)
+        {
+                writer.vertices[i]->next = NULL;
+                dxf_vertex_free (writer.vertices[i]);
+        }
+        dxf_free (writer.vertices);
+        dxf_free (writer.layer);
+        dxf_free (writer.linetype);
+        dxf_free (writer.text_value);
+        dxf_free (writer.text_style);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Get the sequence given to the entities appended next.
+ *
+ * \return the sequence.
+ */
+uint64_t
+dxf_paged_entities_get_sequence
+(
+        DxfPagedEntities *paged
+                /*!< paged storage. */
+)
+{
+        /* Do some basic checks. */
+        if (paged == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (paged->sequence);
+}
+
+
+/*!
+ * \brief Set the sequence given to the entities appended next by the
+ * \c dxf_paged_entities_append_* () functions.
+ *
+ * The sequence is the number of entities kept in memory which precede
+ * the entities in file order, \c dxf_file_load () sets it to the number
+ * of entities of the drawing.\n
+ * A new paged storage has \c DXF_PAGED_ENTITIES_AFTER_RESIDENT, its
+ * entities are written after all entities kept in memory.\n
+ * The entities of a paged storage are always written in the order they
+ * were appended, an entity with a smaller sequence than the entity
+ * before it follows that entity.
+ *
+ * \return a pointer to the paged storage when OK, \c NULL when an
+ * error occurred.
+ */
+DxfPagedEntities *
+dxf_paged_entities_set_sequence
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        uint64_t sequence
+                /*!< sequence of the entities appended next. */
+)
+{
+        /* Do some basic checks. */
+        if (paged == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        paged->sequence = sequence;
+        return (paged);
+}
+
+
+/*!
+ * \brief Get the number of entities in a paged storage.
+ *
+ * \return the number of entities.
+ */
+uint64_t
+dxf_paged_entities_get_number_of_entities
+(
+        DxfPagedEntities *paged
+                /*!< paged storage. */
+)
+{
+        /* Do some basic checks. */
+        if (paged == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (paged->number_of_records);
+}
+
+
+/*!
+ * \brief Get the number of bytes in resident pages of a paged storage.
+ *
+ * \return the resident size in bytes.
+ */
+size_t
+dxf_paged_entities_get_resident_size
+(
+        DxfPagedEntities *paged
+                /*!< paged storage. */
+)
+{
+        /* Do some basic checks. */
+        if (paged == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (paged->resident_size);
+}
+
+
+/*!
+ * \brief Get the memory budget of a paged storage.
+ *
+ * \return the memory budget in bytes.
+ */
+size_t
+dxf_paged_entities_get_memory_budget
+(
+        DxfPagedEntities *paged
+                /*!< paged storage. */
+)
+{
+        /* Do some basic checks. */
+        if (paged == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (paged->memory_budget);
+}
+
+
+/*!
+ * \brief Set the memory budget of a paged storage.
+ *
+ * Resident pages are evicted immediately when the new budget is
+ * smaller.
+ *
+ * \return a pointer to the paged storage when OK, \c NULL when an
+ * error occurred.
+ */
+DxfPagedEntities *
+dxf_paged_entities_set_memory_budget
+(
+        DxfPagedEntities *paged,
+                /*!< paged storage. */
+        size_t memory_budget
+                /*!< maximum number of bytes in resident pages. */
+)
+{
+        /* Do some basic checks. */
+        if (paged == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        paged->memory_budget = (memory_budget < 2 * paged->page_size) ? 2 * paged->page_size : memory_budget;
+        if (dxf_paged_entities_evict (paged, NULL, 0) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+        return (paged);
+}
+
+
+/* EOF */
@@ -0,0 +1,253 @@
+/*!
+ * \file paged_entities.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for out-of-core (paged) storage of DXF entities.
+ *
+ * Entities are encoded in a compact binary record format and grouped
+ * into fixed-size pages.\n
+ * Pages are spilled to a scratch file when the resident pages exceed a
+ * configurable memory budget, and are faulted back in (least recently
+ * used pages are evicted first) when accessed.\n
+ * This allows for iterating, querying and writing drawings which are
+ * much larger than the available memory.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_PAGED_ENTITIES_H
+#define LIBDXF_SRC_PAGED_ENTITIES_H
+
+
+#include "global.h"
+#include "arc.h"
+#include "circle.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "point.h"
+#include "text.h"
+#include "entities.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_PAGED_ENTITIES_DEFAULT_PAGE_SIZE 65536
+        /*!< \brief Default size of a page in bytes. */
+
+#define DXF_PAGED_ENTITIES_MIN_PAGE_SIZE 16384
+        /*!< \brief Minimum size of a page in bytes.
+         *
+         * A page has to hold at least one record with four strings of
+         * the maximum string length. */
+
+#define DXF_PAGED_ENTITIES_MAX_VALUES 6
+        /*!< \brief The maximum number of geometry values in a record,
+         * not counting the vertices. */
+
+#define DXF_PAGED_ENTITIES_AFTER_RESIDENT UINT64_MAX
+        /*!< \brief Sequence of an entity which follows all entities kept
+         * in memory, see \c dxf_paged_entities_set_sequence (). */
+
+
+/*!
+ * \brief Decoded view of an entity record in paged storage.
+ *
+ * The \c layer, \c linetype, \c text_value and \c text_style members
+ * point into a resident page and the \c vertices member into the
+ * paged storage, they are only valid until the next call on the paged
+ * storage.
+ */
+typedef struct
+dxf_paged_entity_struct
+{
+        DxfEntityType type;
+                /*!< Entity type, one of \c POINT, \c LINE, \c CIRCLE,
+                 * \c ARC, \c LWPOLYLINE or \c TEXT. */
+        uint64_t sequence;
+                /*!< Position of the entity in file order: the number of
+                 * entities kept in memory which precede it, or
+                 * \c DXF_PAGED_ENTITIES_AFTER_RESIDENT. */
+        int id_code;
+                /*!< Identification number for the entity.\n
+                 * Group code = 5. */
+        int color;
+                /*!< Color of the entity.\n
+                 * Group code = 62. */
+        const char *layer;
+                /*!< Layer on which the entity is drawn.\n
+                 * Group code = 8. */
+        const char *linetype;
+                /*!< The linetype of the entity.\n
+                 * Group code = 6. */
+        const char *text_value;
+                /*!< \c TEXT: the text, \c NULL for other types.\n
+                 * Group code = 1. */
+        const char *text_style;
+                /*!< \c TEXT: the text style, \c NULL for other types.\n
+                 * Group code = 7. */
+        int flag;
+                /*!< \c LWPOLYLINE: the polyline flag, 0 for other types.\n
+                 * Group code = 70. */
+        double value[DXF_PAGED_ENTITIES_MAX_VALUES];
+                /*!< Geometry values:\n
+                 * \c POINT: x0, y0, z0.\n
+                 * \c LINE: x0, y0, z0, x1, y1, z1.\n
+                 * \c CIRCLE: x0, y0, z0, radius.\n
+                 * \c ARC: x0, y0, z0, radius, start angle, end angle.\n
+                 * \c LWPOLYLINE: elevation, thickness, constant width.\n
+                 * \c TEXT: x0, y0, z0, height, relative X-scale,
+                 * rotation angle. */
+        uint32_t number_of_vertices;
+                /*!< \c LWPOLYLINE: number of vertices, 0 for other
+                 * types. */
+        const double *vertices;
+                /*!< \c LWPOLYLINE: x, y and bulge of every vertex. */
+} DxfPagedEntity;
+
+
+/*!
+ * \brief A page of encoded entity records.
+ */
+typedef struct
+dxf_page_struct
+{
+        uint32_t index;
+                /*!< Index of the page, the page is spilled at offset
+                 * \c index * \c page_size in the scratch file. */
+        uint64_t first_record;
+                /*!< Index of the first record in the page. */
+        uint32_t number_of_records;
+                /*!< Number of records in the page. */
+        uint32_t size;
+                /*!< Number of bytes used in the page. */
+        unsigned char *data;
+                /*!< Page contents, \c NULL when the page is not
+                 * resident. */
+        int spilled;
+                /*!< \c TRUE when an up to date copy of the page lives
+                 * in the scratch file. */
+        struct DxfPage *lru_prev;
+                /*!< Previous (more recently used) resident page. */
+        struct DxfPage *lru_next;
+                /*!< Next (less recently used) resident page. */
+} DxfPage;
+
+
+/*!
+ * \brief Out-of-core storage for DXF entities.
+ */
+typedef struct
+dxf_paged_entities_struct
+{
+        FILE *scratch;
+                /*!< Scratch file holding spilled pages. */
+        size_t page_size;
+                /*!< Size of a page in bytes. */
+        size_t memory_budget;
+                /*!< Maximum number of bytes in resident pages. */
+        size_t resident_size;
+                /*!< Number of bytes in resident pages. */
+        DxfPage **pages;
+                /*!< Array of pointers to page descriptors. */
+        uint32_t number_of_pages;
+                /*!< Number of pages in use. */
+        uint32_t capacity;
+                /*!< Number of allocated page descriptors. */
+        struct DxfPage *lru_head;
+                /*!< Most recently used resident page. */
+        struct DxfPage *lru_tail;
+                /*!< Least recently used resident page. */
+        uint64_t number_of_records;
+                /*!< Number of stored entities. */
+        uint64_t page_faults;
+                /*!< Number of pages read back from the scratch file. */
+        uint64_t page_evictions;
+                /*!< Number of pages evicted from memory. */
+        uint64_t sequence;
+                /*!< Sequence of the entities appended next, see
+                 * \c dxf_paged_entities_set_sequence (). */
+        double *vertices;
+                /*!< Decoded vertices of the last \c LWPOLYLINE. */
+        size_t vertices_capacity;
+                /*!< Number of values \c vertices can hold. */
+        DxfPoint *point;
+                /*!< New \c POINT compared with by
+                 * \c dxf_paged_entities_append_entity (), or \c NULL. */
+        DxfLine *line;
+                /*!< New \c LINE compared with by
+                 * \c dxf_paged_entities_append_entity (), or \c NULL. */
+        DxfCircle *circle;
+                /*!< New \c CIRCLE compared with by
+                 * \c dxf_paged_entities_append_entity (), or \c NULL. */
+        DxfArc *arc;
+                /*!< New \c ARC compared with by
+                 * \c dxf_paged_entities_append_entity (), or \c NULL. */
+        DxfLWPolyline *lwpolyline;
+                /*!< New \c LWPOLYLINE compared with by
+                 * \c dxf_paged_entities_append_entity (), or \c NULL. */
+        DxfText *text;
+                /*!< New \c TEXT compared with by
+                 * \c dxf_paged_entities_append_entity (), or \c NULL. */
+} DxfPagedEntities;
+
+
+DxfPagedEntities *dxf_paged_entities_new (const char *scratch_directory, size_t page_size, size_t memory_budget);
+int dxf_paged_entities_free (DxfPagedEntities *paged);
+int dxf_paged_entities_append (DxfPagedEntities *paged, const DxfPagedEntity *entity);
+int dxf_paged_entities_append_point (DxfPagedEntities *paged, DxfPoint *point);
+int dxf_paged_entities_append_line (DxfPagedEntities *paged, DxfLine *line);
+int dxf_paged_entities_append_circle (DxfPagedEntities *paged, DxfCircle *circle);
+int dxf_paged_entities_append_arc (DxfPagedEntities *paged, DxfArc *arc);
+int dxf_paged_entities_append_lwpolyline (DxfPagedEntities *paged, DxfLWPolyline *lwpolyline);
+int dxf_paged_entities_append_text (DxfPagedEntities *paged, DxfText *text);
+int dxf_paged_entities_is_plain (void *entity, void *prototype);
+int dxf_paged_entities_append_entity (DxfPagedEntities *paged, void *entity);
+int dxf_paged_entities_get (DxfPagedEntities *paged, uint64_t index, DxfPagedEntity *entity);
+void *dxf_paged_entities_new_entity (const DxfPagedEntity *entity);
+int dxf_paged_entities_foreach (DxfPagedEntities *paged, int (*callback) (const DxfPagedEntity *entity, void *data), void *data);
+int dxf_paged_entities_write (DxfFile *fp, DxfPagedEntities *paged, DxfEntities *entities);
+uint64_t dxf_paged_entities_get_number_of_entities (DxfPagedEntities *paged);
+size_t dxf_paged_entities_get_resident_size (DxfPagedEntities *paged);
+size_t dxf_paged_entities_get_memory_budget (DxfPagedEntities *paged);
+DxfPagedEntities *dxf_paged_entities_set_memory_budget (DxfPagedEntities *paged, size_t memory_budget);
+uint64_t dxf_paged_entities_get_sequence (DxfPagedEntities *paged);
+DxfPagedEntities *dxf_paged_entities_set_sequence (DxfPagedEntities *paged, uint64_t sequence);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_PAGED_ENTITIES_H */
+
+
+/* EOF */
@@ -54,6 +54,8 @@
 
 
 #include "point.h"
+#include "pool.h"
+#include "util.h"
 
 
 /*!
@@ -71,11 +73,9 @@ dxf_point_new ()
         size_t size;
 
         size = sizeof (DxfPoint);
-        /* avoid malloc of 0 bytes */
-        if (size == 0) size = 1;
-        if ((point = malloc (size)) == NULL)
+        if ((point = dxf_pool_alloc (DXF_POOL_POINT)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                   __FUNCTION__);
                 point = NULL;
@@ -83,6 +83,8 @@ dxf_point_new ()
         else
         {
                 memset (point, 0, size);
+                point->header.type = POINT;
+                DXF_TRACING_COUNT (POINT, DXF_TRACING_ALLOCATIONS, 1);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -110,21 +112,21 @@ dxf_point_init
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 point = dxf_point_new ();
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->id_code = 0;
-        point->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        point->layer = strdup (DXF_DEFAULT_LAYER);
+        point->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        point->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         point->x0 = 0.0;
         point->y0 = 0.0;
         point->z0 = 0.0;
@@ -138,8 +140,8 @@ dxf_point_init
         point->extr_x0 = 0.0;
         point->extr_y0 = 0.0;
         point->extr_z0 = 0.0;
-        point->dictionary_owner_soft = strdup ("");
-        point->dictionary_owner_hard = strdup ("");
+        point->dictionary_owner_soft = dxf_strdup ("");
+        point->dictionary_owner_hard = dxf_strdup ("");
         point->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -148,6 +150,56 @@ dxf_point_init
 }
 
 
+/*!
+ * \brief Reset a DXF \c POINT entity to the values set by
+ * \c dxf_point_init (), reusing its allocated members.
+ *
+ * The coordinates are reset and the strings are overwritten in place,
+ * they are only grown when a longer value is read.\n
+ * The link to the next entity is kept.
+ *
+ * \return a pointer to the DXF \c POINT entity, or a newly allocated
+ * and initialized one when \c NULL was passed.
+ */
+DxfPoint *
+dxf_point_reset
+(
+        DxfPoint *point
+                /*!< a pointer to the DXF \c POINT entity, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (point == NULL)
+        {
+                return (dxf_point_init (dxf_point_new ()));
+        }
+        point->id_code = 0;
+        dxf_string_assign (&point->linetype, DXF_DEFAULT_LINETYPE);
+        dxf_string_assign (&point->layer, DXF_DEFAULT_LAYER);
+        point->elevation = 0.0;
+        point->thickness = 0.0;
+        point->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
+        point->visibility = DXF_DEFAULT_VISIBILITY;
+        point->color = DXF_COLOR_BYLAYER;
+        point->paperspace = DXF_MODELSPACE;
+        point->x0 = 0.0;
+        point->y0 = 0.0;
+        point->z0 = 0.0;
+        point->angle_to_X = 0.0;
+        point->extr_x0 = 0.0;
+        point->extr_y0 = 0.0;
+        point->extr_z0 = 0.0;
+        dxf_string_assign (&point->dictionary_owner_soft, "");
+        dxf_string_assign (&point->dictionary_owner_hard, "");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (point);
+}
+
+
 /*!
  * \brief Read data from a DXF file into a \c POINT entity.
  *
@@ -172,38 +224,36 @@ dxf_point_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 point = dxf_point_new ();
                 point = dxf_point_init (point);
         }
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (POINT, fp);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -218,13 +268,13 @@ dxf_point_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", point->linetype);
+                        dxf_read_string (fp, &point->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", point->layer);
+                        dxf_read_string (fp, &point->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -308,7 +358,7 @@ dxf_point_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbPoint") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -339,14 +389,14 @@ dxf_point_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", point->dictionary_owner_soft);
+                        dxf_read_string (fp, &point->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", point->dictionary_owner_hard);
+                        dxf_read_string (fp, &point->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -357,22 +407,27 @@ dxf_point_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (point->linetype, "") == 0)
         {
-                point->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_string_assign (&point->linetype, DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (point->layer, "") == 0)
         {
-                point->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_string_assign (&point->layer, DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
+        DXF_TRACING_ENTITY_END (POINT, fp, trace_offset);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -398,47 +453,47 @@ dxf_point_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("POINT");
+        char *dxf_entity_name = dxf_strdup ("POINT");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (point->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, point->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                point->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                point->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (point->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name,
                         point->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                point->layer = strdup (DXF_DEFAULT_LAYER);
+                point->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -487,7 +542,7 @@ dxf_point_write
           && DXF_FLATLAND
           && (point->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", point->elevation);
+                dxf_write_real (fp, 38, point->elevation);
         }
         if (point->color != DXF_COLOR_BYLAYER)
         {
@@ -495,7 +550,7 @@ dxf_point_write
         }
         if (point->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", point->linetype_scale);
+                dxf_write_real (fp, 48, point->linetype_scale);
         }
         if (point->visibility != 0)
         {
@@ -505,25 +560,25 @@ dxf_point_write
         {
                 fprintf (fp->fp, "100\nAcDbPoint\n");
         }
-        fprintf (fp->fp, " 10\n%f\n", point->x0);
-        fprintf (fp->fp, " 20\n%f\n", point->y0);
-        fprintf (fp->fp, " 30\n%f\n", point->z0);
+        dxf_write_real (fp, 10, point->x0);
+        dxf_write_real (fp, 20, point->y0);
+        dxf_write_real (fp, 30, point->z0);
         if (point->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", point->thickness);
+                dxf_write_real (fp, 39, point->thickness);
         }
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (point->extr_x0 != 0.0)
                 && (point->extr_y0 != 0.0)
                 && (point->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", point->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", point->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", point->extr_z0);
+                dxf_write_real (fp, 210, point->extr_x0);
+                dxf_write_real (fp, 220, point->extr_y0);
+                dxf_write_real (fp, 230, point->extr_z0);
         }
-        fprintf (fp->fp, " 50\n%f\n", point->angle_to_X);
+        dxf_write_real (fp, 50, point->angle_to_X);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -549,18 +604,22 @@ dxf_point_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfAllocator *allocator;
+
         if (point->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfPoint was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (point->linetype);
-        free (point->layer);
-        free (point->dictionary_owner_soft);
-        free (point->dictionary_owner_hard);
-        free (point);
+        allocator = dxf_pool_activate_owner (point);
+        dxf_free (point->linetype);
+        dxf_free (point->layer);
+        dxf_free (point->dictionary_owner_soft);
+        dxf_free (point->dictionary_owner_hard);
+        dxf_pool_release (DXF_POOL_POINT, point);
+        dxf_allocator_activate (allocator);
         point = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -580,18 +639,19 @@ dxf_point_free_chain
                 /*!< a pointer to the chain of DXF \c POINT entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (points == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (points != NULL)
         {
                 struct DxfPoint *iter = points->next;
+                points->next = NULL;
                 dxf_point_free (points);
                 points = (DxfPoint *) iter;
         }
@@ -621,14 +681,14 @@ dxf_point_get_id_code
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -664,14 +724,14 @@ dxf_point_set_id_code
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -704,19 +764,19 @@ dxf_point_get_linetype
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (point->linetype);
+        result = dxf_strdup (point->linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -745,19 +805,20 @@ dxf_point_set_linetype
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        point->linetype = strdup (linetype);
+        point->linetype = dxf_strdup (linetype);
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -785,19 +846,19 @@ dxf_point_get_layer
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (point->layer);
+        result = dxf_strdup (point->layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -826,19 +887,20 @@ dxf_point_set_layer
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        point->layer = strdup (layer);
+        point->layer = dxf_strdup (layer);
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -866,7 +928,7 @@ dxf_point_get_elevation
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -900,12 +962,13 @@ dxf_point_set_elevation
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->elevation = elevation;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -933,14 +996,14 @@ dxf_point_get_thickness
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -974,19 +1037,20 @@ dxf_point_set_thickness
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->thickness = thickness;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1014,14 +1078,14 @@ dxf_point_get_linetype_scale
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1055,19 +1119,20 @@ dxf_point_set_linetype_scale
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative linetype scale value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->linetype_scale = linetype_scale;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1095,21 +1160,21 @@ dxf_point_get_visibility
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1143,26 +1208,27 @@ dxf_point_set_visibility
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->visibility = visibility;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1190,14 +1256,14 @@ dxf_point_get_color
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1230,20 +1296,21 @@ dxf_point_set_color
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         point->color = color;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1271,20 +1338,20 @@ dxf_point_get_paperspace
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (point->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1317,26 +1384,27 @@ dxf_point_set_paperspace
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->paperspace = paperspace;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1365,20 +1433,20 @@ dxf_point_get_graphics_data_size
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
         if (point->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
@@ -1412,26 +1480,27 @@ dxf_point_set_graphics_data_size
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->graphics_data_size = graphics_data_size;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1460,21 +1529,21 @@ dxf_point_get_shadow_mode
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (point->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1508,26 +1577,27 @@ dxf_point_set_shadow_mode
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->shadow_mode = shadow_mode;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1559,14 +1629,14 @@ dxf_point_get_binary_graphics_data
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1602,19 +1672,20 @@ dxf_point_set_binary_graphics_data
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->binary_graphics_data = (DxfBinaryGraphicsData *) data;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1645,19 +1716,19 @@ dxf_point_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (point->dictionary_owner_soft);
+        result = dxf_strdup (point->dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1688,19 +1759,20 @@ dxf_point_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        point->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        point->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1731,19 +1803,19 @@ dxf_point_get_material
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the material member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (point->material);
+        result = dxf_strdup (point->material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1773,19 +1845,20 @@ dxf_point_set_material
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        point->material = strdup (material);
+        point->material = dxf_strdup (material);
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1816,19 +1889,19 @@ dxf_point_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (point->dictionary_owner_hard);
+        result = dxf_strdup (point->dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1859,19 +1932,20 @@ dxf_point_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        point->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        point->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1900,7 +1974,7 @@ dxf_point_get_lineweight
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1934,12 +2008,13 @@ dxf_point_set_lineweight
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->lineweight = lineweight;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1968,19 +2043,19 @@ dxf_point_get_plot_style_name
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (point->plot_style_name);
+        result = dxf_strdup (point->plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2010,19 +2085,20 @@ dxf_point_set_plot_style_name
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        point->plot_style_name = strdup (plot_style_name);
+        point->plot_style_name = dxf_strdup (plot_style_name);
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2051,7 +2127,7 @@ dxf_point_get_color_value
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2085,12 +2161,13 @@ dxf_point_set_color_value
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->color_value = color_value;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2119,19 +2196,19 @@ dxf_point_get_color_name
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        result = strdup (point->color_name);
+        result = dxf_strdup (point->color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2161,19 +2238,20 @@ dxf_point_set_color_name
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        point->color_name = strdup (color_name);
+        point->color_name = dxf_strdup (color_name);
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2202,7 +2280,7 @@ dxf_point_get_transparency
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2236,12 +2314,13 @@ dxf_point_set_transparency
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->transparency = transparency;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2269,7 +2348,7 @@ dxf_point_get_x0
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2304,12 +2383,13 @@ dxf_point_set_x0
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->x0 = x0;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2337,7 +2417,7 @@ dxf_point_get_y0
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2372,12 +2452,13 @@ dxf_point_set_y0
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->y0 = y0;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2405,7 +2486,7 @@ dxf_point_get_z0
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2440,12 +2521,13 @@ dxf_point_set_z0
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->z0 = z0;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2473,7 +2555,7 @@ dxf_point_get_angle_to_X
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2507,12 +2589,13 @@ dxf_point_set_angle_to_X
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         point->angle_to_X = angle_to_X;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2535,7 +2618,7 @@ dxf_point_get_extrusion_vector_as_point
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         DxfPoint *result = NULL;
@@ -2543,7 +2626,7 @@ dxf_point_get_extrusion_vector_as_point
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2551,7 +2634,7 @@ dxf_point_get_extrusion_vector_as_point
         result = dxf_point_init (result);
         if (result == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfPoint struct.\n")),
                 __FUNCTION__);
               return (NULL);
@@ -2591,7 +2674,7 @@ dxf_point_set_extrusion_vector
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2599,6 +2682,7 @@ dxf_point_set_extrusion_vector
         point->extr_x0 = extr_x0;
         point->extr_y0 = extr_y0;
         point->extr_z0 = extr_z0;
+        point->header.fingerprint = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2629,14 +2713,14 @@ dxf_point_get_next
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (point->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2671,14 +2755,14 @@ dxf_point_set_next
         /* Do some basic checks. */
         if (point == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
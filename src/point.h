@@ -68,6 +68,9 @@ extern "C" {
 typedef struct
 dxf_point_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< group code = 5\n
@@ -208,6 +211,11 @@ dxf_point_init
         DxfPoint *point
 );
 DxfPoint *
+dxf_point_reset
+(
+        DxfPoint *point
+);
+DxfPoint *
 dxf_point_read
 (
         DxfFile *fp,
@@ -40,6 +40,8 @@
 
 
 #include "polyline.h"
+#include "seqend.h"
+#include "util.h"
 
 
 /*!
@@ -59,9 +61,9 @@ dxf_polyline_new ()
         size = sizeof (DxfPolyline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((polyline = malloc (size)) == NULL)
+        if ((polyline = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfArc struct.\n")),
                   __FUNCTION__);
                 polyline = NULL;
@@ -69,6 +71,8 @@ dxf_polyline_new ()
         else
         {
                 memset (polyline, 0, size);
+                polyline->header.type = POLYLINE;
+                DXF_TRACING_COUNT (POLYLINE, DXF_TRACING_ALLOCATIONS, 1);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -96,21 +100,21 @@ dxf_polyline_init
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 polyline = dxf_polyline_new ();
         }
         if (polyline == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfPolyline struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         dxf_polyline_set_id_code (polyline, 0);
-        dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
-        dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
+        dxf_polyline_set_linetype (polyline, DXF_DEFAULT_LINETYPE);
+        dxf_polyline_set_layer (polyline, DXF_DEFAULT_LAYER);
         dxf_polyline_set_elevation (polyline, 0.0);
         dxf_polyline_set_thickness (polyline, 0.0);
         dxf_polyline_set_linetype_scale (polyline, DXF_DEFAULT_LINETYPE_SCALE);
@@ -120,13 +124,13 @@ dxf_polyline_init
         dxf_polyline_set_graphics_data_size (polyline, 0);
         dxf_polyline_set_shadow_mode (polyline, 0);
         dxf_polyline_set_binary_graphics_data (polyline, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
-        dxf_polyline_set_dictionary_owner_soft (polyline, strdup (""));
-        dxf_polyline_set_material (polyline, strdup (""));
-        dxf_polyline_set_dictionary_owner_hard (polyline, strdup (""));
+        dxf_polyline_set_dictionary_owner_soft (polyline, "");
+        dxf_polyline_set_material (polyline, "");
+        dxf_polyline_set_dictionary_owner_hard (polyline, "");
         dxf_polyline_set_lineweight (polyline, 0);
-        dxf_polyline_set_plot_style_name (polyline, strdup (""));
+        dxf_polyline_set_plot_style_name (polyline, "");
         dxf_polyline_set_color_value (polyline, 0);
-        dxf_polyline_set_color_name (polyline, strdup (""));
+        dxf_polyline_set_color_name (polyline, "");
         dxf_polyline_set_transparency (polyline, 0);
         dxf_polyline_set_p0 (polyline, (DxfPoint *) dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_polyline_get_p0 (polyline));
@@ -155,6 +159,171 @@ dxf_polyline_init
 }
 
 
+/*!
+ * \brief Reset a DXF \c POLYLINE entity to the values set by
+ * \c dxf_polyline_init (), reusing its allocated members.
+ *
+ * The elevation point \c p0 and the first vertex stay allocated, the
+ * other vertices are freed, \c dxf_polyline_read () replaces them with
+ * the \c VERTEX entities following the \c POLYLINE.\n
+ * The link to the next entity is kept.
+ *
+ * \return a pointer to the DXF \c POLYLINE entity, or a newly allocated
+ * and initialized one when \c NULL was passed.
+ */
+DxfPolyline *
+dxf_polyline_reset
+(
+        DxfPolyline *polyline
+                /*!< a pointer to the DXF \c POLYLINE entity, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (polyline == NULL)
+        {
+                return (dxf_polyline_init (dxf_polyline_new ()));
+        }
+        polyline->id_code = 0;
+        dxf_string_assign (&polyline->linetype, DXF_DEFAULT_LINETYPE);
+        dxf_string_assign (&polyline->layer, DXF_DEFAULT_LAYER);
+        polyline->elevation = 0.0;
+        polyline->thickness = 0.0;
+        polyline->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
+        polyline->visibility = DXF_DEFAULT_VISIBILITY;
+        polyline->color = DXF_COLOR_BYLAYER;
+        polyline->paperspace = DXF_MODELSPACE;
+        polyline->graphics_data_size = 0;
+        polyline->shadow_mode = 0;
+        if (polyline->binary_graphics_data == NULL)
+        {
+                polyline->binary_graphics_data = dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+        }
+        else
+        {
+                dxf_binary_graphics_data_reset (polyline->binary_graphics_data);
+        }
+        dxf_string_assign (&polyline->dictionary_owner_soft, "");
+        dxf_string_assign (&polyline->material, "");
+        dxf_string_assign (&polyline->dictionary_owner_hard, "");
+        polyline->lineweight = 0;
+        dxf_string_assign (&polyline->plot_style_name, "");
+        polyline->color_value = 0;
+        dxf_string_assign (&polyline->color_name, "");
+        polyline->transparency = 0;
+        polyline->p0 = dxf_point_reset (polyline->p0);
+        polyline->start_width = 0.0;
+        polyline->end_width = 0.0;
+        polyline->vertices_follow = 1;
+        polyline->flag = 0;
+        polyline->polygon_mesh_M_vertex_count = 0;
+        polyline->polygon_mesh_N_vertex_count = 0;
+        polyline->smooth_M_surface_density = 0;
+        polyline->smooth_N_surface_density = 0;
+        polyline->surface_type = 0;
+        polyline->extr_x0 = 0.0;
+        polyline->extr_y0 = 0.0;
+        polyline->extr_z0 = 0.0;
+        if (polyline->vertices != NULL)
+        {
+                if (polyline->vertices->next != NULL)
+                {
+                        dxf_vertex_free_chain ((DxfVertex *) polyline->vertices->next);
+                        polyline->vertices->next = NULL;
+                }
+        }
+        polyline->vertices = dxf_vertex_reset (polyline->vertices);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (polyline);
+}
+
+
+
+/*!
+ * \brief Read the \c VERTEX entities and the \c SEQEND entity
+ * following a DXF \c POLYLINE entity.
+ *
+ * The last line read from file contained the "  0" group code ending
+ * the \c POLYLINE.\n
+ * Every \c VERTEX is appended to the vertices of \c polyline, the
+ * vertex set by \c dxf_polyline_init () is replaced by the first one.\n
+ * The file is left at the "  0" group code ending the \c SEQEND, or at
+ * the "  0" group code ending the \c POLYLINE when neither a \c VERTEX
+ * nor a \c SEQEND follows.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred, the file is then closed.
+ */
+static int
+dxf_polyline_read_vertices
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfPolyline *polyline
+                /*!< a pointer to the DXF polyline entity. */
+)
+{
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        DxfVertex *vertex = NULL;
+        DxfVertex *last = NULL;
+        DxfSeqend *seqend = NULL;
+        off_t offset;
+
+        for (;;)
+        {
+                /* Look at the name of the next entity, a stream which
+                 * can not be positioned back is left alone. */
+                offset = ftello (fp->fp);
+                if ((offset < 0)
+                  || (fscanf (fp->fp, " %[^\n]", temp_string) != 1))
+                {
+                        break;
+                }
+                if (strcmp (temp_string, "VERTEX") == 0)
+                {
+                        (fp->line_number)++;
+                        vertex = dxf_vertex_read (fp, NULL);
+                        if (vertex == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        if (last == NULL)
+                        {
+                                if (polyline->vertices != NULL)
+                                {
+                                        dxf_vertex_free_chain (polyline->vertices);
+                                }
+                                polyline->vertices = vertex;
+                        }
+                        else
+                        {
+                                last->next = (struct DxfVertex *) vertex;
+                        }
+                        last = vertex;
+                }
+                else if (strcmp (temp_string, "SEQEND") == 0)
+                {
+                        (fp->line_number)++;
+                        seqend = dxf_seqend_read (fp, NULL);
+                        if (seqend == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        dxf_seqend_free (seqend);
+                        break;
+                }
+                else
+                {
+                        fseeko (fp->fp, offset, SEEK_SET);
+                        break;
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
 
 /*!
  * \brief Read data from a DXF file into an \c POLYLINE entity.
@@ -164,6 +333,8 @@ dxf_polyline_init
  * "  0" string announcing the following entity, or the end of the
  * \c ENTITY section marker \c ENDSEC. \n
  * While parsing the DXF file store data in \c polyline. \n
+ * The \c VERTEX entities and the \c SEQEND entity following the
+ * \c POLYLINE are read as well. \n
  *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
@@ -180,38 +351,36 @@ dxf_polyline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 polyline = dxf_polyline_new ();
                 polyline = dxf_polyline_init (polyline);
         }
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (POLYLINE, fp);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -226,13 +395,13 @@ dxf_polyline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", polyline->linetype);
+                        dxf_read_string (fp, &polyline->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", polyline->layer);
+                        dxf_read_string (fp, &polyline->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -396,14 +565,14 @@ dxf_polyline_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", polyline->dictionary_owner_soft);
+                        dxf_read_string (fp, &polyline->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", polyline->dictionary_owner_hard);
+                        dxf_read_string (fp, &polyline->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -414,22 +583,36 @@ dxf_polyline_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
-        if (strcmp (dxf_polyline_get_linetype (polyline), "") == 0)
+        if (strcmp (polyline->linetype, "") == 0)
         {
-                dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_string_assign (&polyline->linetype, DXF_DEFAULT_LINETYPE);
         }
-        if (strcmp (dxf_polyline_get_layer (polyline), "") == 0)
+        if (strcmp (polyline->layer, "") == 0)
         {
-                dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
+                dxf_string_assign (&polyline->layer, DXF_DEFAULT_LAYER);
+        }
+        DXF_TRACING_ENTITY_END (POLYLINE, fp, trace_offset);
+        /* The vertices follow the polyline as separate entities. */
+        if ((polyline->vertices_follow)
+          && (dxf_polyline_read_vertices (fp, polyline) != EXIT_SUCCESS))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not read the vertices of the polyline with id-code: %x.\n")),
+                  __FUNCTION__, polyline->id_code);
+                return (NULL);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -440,6 +623,9 @@ dxf_polyline_read
 /*!
  * \brief Write DXF output to fp for a polyline entity.
  *
+ * The vertices are written as \c VERTEX entities, followed by a
+ * \c SEQEND entity.
+ *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
  */
@@ -455,74 +641,75 @@ dxf_polyline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("POLYLINE");
+        char *dxf_entity_name = dxf_strdup ("POLYLINE");
         DxfVertex *iter = NULL;
+        DxfSeqend *seqend = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_polyline_get_x0 (polyline) != 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point has an invalid X-value for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_polyline_get_y0 (polyline) != 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point has an invalid Y-value for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (dxf_polyline_get_vertices_follow (polyline) != 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () vertices follow flag has an invalid value for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (dxf_polyline_get_linetype (polyline), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                dxf_polyline_set_linetype (polyline, strdup (DXF_DEFAULT_LINETYPE));
+                dxf_polyline_set_linetype (polyline, dxf_strdup (DXF_DEFAULT_LINETYPE));
         }
         if (strcmp (dxf_polyline_get_layer (polyline), "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, dxf_polyline_get_id_code (polyline));
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
+                dxf_polyline_set_layer (polyline, dxf_strdup (DXF_DEFAULT_LAYER));
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -571,7 +758,7 @@ dxf_polyline_write
           && DXF_FLATLAND
           && (dxf_polyline_get_elevation (polyline) != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", dxf_polyline_get_elevation (polyline));
+                dxf_write_real (fp, 38, dxf_polyline_get_elevation (polyline));
         }
         if (dxf_polyline_get_color (polyline) != DXF_COLOR_BYLAYER)
         {
@@ -579,7 +766,7 @@ dxf_polyline_write
         }
         if (dxf_polyline_get_linetype_scale (polyline) != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", dxf_polyline_get_linetype_scale (polyline));
+                dxf_write_real (fp, 48, dxf_polyline_get_linetype_scale (polyline));
         }
         if (dxf_polyline_get_visibility (polyline) != 0)
         {
@@ -593,21 +780,21 @@ dxf_polyline_write
         {
                 fprintf (fp->fp, " 66\n%d\n", dxf_polyline_get_vertices_follow (polyline));
         }
-        fprintf (fp->fp, " 10\n%f\n", dxf_polyline_get_x0 (polyline));
-        fprintf (fp->fp, " 20\n%f\n", dxf_polyline_get_y0 (polyline));
-        fprintf (fp->fp, " 30\n%f\n", dxf_polyline_get_z0 (polyline));
+        dxf_write_real (fp, 10, dxf_polyline_get_x0 (polyline));
+        dxf_write_real (fp, 20, dxf_polyline_get_y0 (polyline));
+        dxf_write_real (fp, 30, dxf_polyline_get_z0 (polyline));
         if (dxf_polyline_get_thickness (polyline) != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", dxf_polyline_get_thickness (polyline));
+                dxf_write_real (fp, 39, dxf_polyline_get_thickness (polyline));
         }
         fprintf (fp->fp, " 70\n%d\n", dxf_polyline_get_flag (polyline));
         if (dxf_polyline_get_start_width (polyline) != 0.0)
         {
-                fprintf (fp->fp, " 40\n%f\n", dxf_polyline_get_start_width (polyline));
+                dxf_write_real (fp, 40, dxf_polyline_get_start_width (polyline));
         }
         if (dxf_polyline_get_end_width (polyline) != 0.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", dxf_polyline_get_end_width (polyline));
+                dxf_write_real (fp, 41, dxf_polyline_get_end_width (polyline));
         }
         fprintf (fp->fp, " 71\n%d\n", dxf_polyline_get_polygon_mesh_M_vertex_count (polyline));
         fprintf (fp->fp, " 72\n%d\n", dxf_polyline_get_polygon_mesh_N_vertex_count (polyline));
@@ -619,9 +806,9 @@ dxf_polyline_write
                 && (dxf_polyline_get_extr_y0 (polyline) != 0.0)
                 && (dxf_polyline_get_extr_z0 (polyline) != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", dxf_polyline_get_extr_x0 (polyline));
-                fprintf (fp->fp, "220\n%f\n", dxf_polyline_get_extr_y0 (polyline));
-                fprintf (fp->fp, "230\n%f\n", dxf_polyline_get_extr_z0 (polyline));
+                dxf_write_real (fp, 210, dxf_polyline_get_extr_x0 (polyline));
+                dxf_write_real (fp, 220, dxf_polyline_get_extr_y0 (polyline));
+                dxf_write_real (fp, 230, dxf_polyline_get_extr_z0 (polyline));
         }
         /* Start of writing (multiple) vertices. */
         iter = (DxfVertex *) dxf_polyline_get_vertices (polyline);
@@ -630,9 +817,23 @@ dxf_polyline_write
                 dxf_vertex_write (fp, iter);
                 iter = (DxfVertex *) iter->next;
         }
-        dxf_vertex_free (iter);
+        /* End the sequence of vertices. */
+        if (dxf_polyline_get_vertices (polyline) != NULL)
+        {
+                seqend = dxf_seqend_init (dxf_seqend_new ());
+                if (seqend == NULL)
+                {
+                        /* Clean up. */
+                        dxf_free (dxf_entity_name);
+                        return (EXIT_FAILURE);
+                }
+                seqend->id_code = -1;
+                dxf_string_assign (&seqend->layer, polyline->layer);
+                dxf_seqend_write (fp, seqend);
+                dxf_seqend_free (seqend);
+        }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -660,22 +861,22 @@ dxf_polyline_free
 #endif
         if (polyline->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfPolyline was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (dxf_polyline_get_linetype (polyline));
-        free (dxf_polyline_get_layer (polyline));
+        dxf_free (polyline->linetype);
+        dxf_free (polyline->layer);
         dxf_binary_graphics_data_free_chain (dxf_polyline_get_binary_graphics_data (polyline));
-        free (dxf_polyline_get_dictionary_owner_soft (polyline));
-        free (dxf_polyline_get_material (polyline));
-        free (dxf_polyline_get_dictionary_owner_hard (polyline));
-        free (dxf_polyline_get_plot_style_name (polyline));
-        free (dxf_polyline_get_color_name (polyline));
+        dxf_free (polyline->dictionary_owner_soft);
+        dxf_free (polyline->material);
+        dxf_free (polyline->dictionary_owner_hard);
+        dxf_free (polyline->plot_style_name);
+        dxf_free (polyline->color_name);
         dxf_point_free (dxf_polyline_get_p0 (polyline));
         dxf_vertex_free_chain (dxf_polyline_get_vertices (polyline));
-        free (polyline);
+        dxf_free (polyline);
         polyline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -695,18 +896,19 @@ dxf_polyline_free_chain
                 /*!< a pointer to the chain of DXF \c POLYLINE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (polylines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (polylines != NULL)
         {
                 struct DxfPolyline *iter = polylines->next;
+                polylines->next = NULL;
                 dxf_polyline_free (polylines);
                 polylines = (DxfPolyline *) iter;
         }
@@ -734,14 +936,14 @@ dxf_polyline_get_id_code
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the id-code member.\n")),
                   __FUNCTION__);
         }
@@ -775,14 +977,14 @@ dxf_polyline_set_id_code
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
         }
@@ -813,14 +1015,14 @@ dxf_polyline_get_linetype
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -828,7 +1030,7 @@ dxf_polyline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->linetype));
+        return (dxf_strdup (polyline->linetype));
 }
 
 
@@ -856,19 +1058,19 @@ dxf_polyline_set_linetype
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->linetype = strdup (linetype);
+        polyline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -895,14 +1097,14 @@ dxf_polyline_get_layer
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -910,7 +1112,7 @@ dxf_polyline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->layer));
+        return (dxf_strdup (polyline->layer));
 }
 
 
@@ -937,19 +1139,19 @@ dxf_polyline_set_layer
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->layer = strdup (layer);
+        polyline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -975,7 +1177,7 @@ dxf_polyline_get_elevation
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1008,7 +1210,7 @@ dxf_polyline_set_elevation
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1039,14 +1241,14 @@ dxf_polyline_get_thickness
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
         }
@@ -1078,14 +1280,14 @@ dxf_polyline_set_thickness
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1115,14 +1317,14 @@ dxf_polyline_get_linetype_scale
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the linetype_scale member.\n")),
                   __FUNCTION__);
         }
@@ -1154,14 +1356,14 @@ dxf_polyline_set_linetype_scale
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative linetype_scale value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1191,21 +1393,21 @@ dxf_polyline_get_visibility
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1238,21 +1440,21 @@ dxf_polyline_set_visibility
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1283,14 +1485,14 @@ dxf_polyline_get_color
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1322,17 +1524,17 @@ dxf_polyline_set_color
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         polyline->color = color;
@@ -1362,20 +1564,20 @@ dxf_polyline_get_paperspace
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (polyline->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1407,21 +1609,21 @@ dxf_polyline_set_paperspace
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1454,20 +1656,20 @@ dxf_polyline_get_graphics_data_size
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
         if (polyline->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
@@ -1501,21 +1703,21 @@ dxf_polyline_set_graphics_data_size
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1546,21 +1748,21 @@ dxf_polyline_get_shadow_mode
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1593,21 +1795,21 @@ dxf_polyline_set_shadow_mode
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1641,14 +1843,14 @@ dxf_polyline_get_binary_graphics_data
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1680,14 +1882,14 @@ dxf_polyline_set_binary_graphics_data
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1721,14 +1923,14 @@ dxf_polyline_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1736,7 +1938,7 @@ dxf_polyline_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->dictionary_owner_soft));
+        return (dxf_strdup (polyline->dictionary_owner_soft));
 }
 
 
@@ -1760,19 +1962,19 @@ dxf_polyline_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        polyline->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1802,14 +2004,14 @@ dxf_polyline_get_material
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the material member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1817,7 +2019,7 @@ dxf_polyline_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->material));
+        return (dxf_strdup (polyline->material));
 }
 
 
@@ -1844,19 +2046,19 @@ dxf_polyline_set_material
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->material = strdup (material);
+        polyline->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1885,14 +2087,14 @@ dxf_polyline_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1900,7 +2102,7 @@ dxf_polyline_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->dictionary_owner_hard));
+        return (dxf_strdup (polyline->dictionary_owner_hard));
 }
 
 
@@ -1927,19 +2129,19 @@ dxf_polyline_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        polyline->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1966,7 +2168,7 @@ dxf_polyline_get_lineweight
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1999,7 +2201,7 @@ dxf_polyline_set_lineweight
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2031,14 +2233,14 @@ dxf_polyline_get_plot_style_name
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2046,7 +2248,7 @@ dxf_polyline_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->plot_style_name));
+        return (dxf_strdup (polyline->plot_style_name));
 }
 
 
@@ -2072,19 +2274,19 @@ dxf_polyline_set_plot_style_name
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->plot_style_name = strdup (plot_style_name);
+        polyline->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2111,7 +2313,7 @@ dxf_polyline_get_color_value
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2144,7 +2346,7 @@ dxf_polyline_set_color_value
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2176,14 +2378,14 @@ dxf_polyline_get_color_name
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2191,7 +2393,7 @@ dxf_polyline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (polyline->color_name));
+        return (dxf_strdup (polyline->color_name));
 }
 
 
@@ -2217,19 +2419,19 @@ dxf_polyline_set_color_name
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        polyline->color_name = strdup (color_name);
+        polyline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2256,7 +2458,7 @@ dxf_polyline_get_transparency
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2289,7 +2491,7 @@ dxf_polyline_set_transparency
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2314,20 +2516,20 @@ dxf_polyline_get_p0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2354,20 +2556,20 @@ dxf_polyline_set_p0
                 /*!< a pointer to a DXF \c POINT entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2393,21 +2595,21 @@ dxf_polyline_get_x0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2436,20 +2638,20 @@ dxf_polyline_set_x0
                  * DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2475,21 +2677,21 @@ dxf_polyline_get_y0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2518,20 +2720,20 @@ dxf_polyline_set_y0
                  * DXF \c polyline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2557,21 +2759,21 @@ dxf_polyline_get_z0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2600,20 +2802,20 @@ dxf_polyline_set_z0
                  * DXF \c polyline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2638,21 +2840,21 @@ dxf_polyline_get_start_width
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->start_width < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a start width smaller than 0.0 was found.\n")),
                   __FUNCTION__);
         }
@@ -2678,20 +2880,20 @@ dxf_polyline_set_start_width
                 /*!< the \c start_width of a DXF \c polyline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (start_width < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a start_width smaller than 0.0 was passed.\n")),
                   __FUNCTION__);
         }
@@ -2715,21 +2917,21 @@ dxf_polyline_get_end_width
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->end_width < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a end width smaller than 0.0 was found.\n")),
                   __FUNCTION__);
         }
@@ -2755,20 +2957,20 @@ dxf_polyline_set_end_width
                 /*!< the \c end_width of a DXF \c polyline entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (end_width < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an end_width smaller than 0.0 was passed.\n")),
                   __FUNCTION__);
         }
@@ -2798,14 +3000,14 @@ dxf_polyline_get_vertices_follow
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->vertices_follow < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the vertices_follow member.\n")),
                   __FUNCTION__);
         }
@@ -2837,14 +3039,14 @@ dxf_polyline_set_vertices_follow
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (vertices_follow < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative vertices_follow value was passed.\n")),
                   __FUNCTION__);
         }
@@ -2874,20 +3076,20 @@ dxf_polyline_get_flag
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the flag member.\n")),
                   __FUNCTION__);
         }
         if (polyline->flag > 255)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the flag member.\n")),
                   __FUNCTION__);
         }
@@ -2919,20 +3121,20 @@ dxf_polyline_set_flag
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (flag < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
         if (flag > 255)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
@@ -2962,14 +3164,14 @@ dxf_polyline_get_polygon_mesh_M_vertex_count
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->polygon_mesh_M_vertex_count < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the polygon_mesh_M_vertex_count member.\n")),
                   __FUNCTION__);
         }
@@ -3002,14 +3204,14 @@ dxf_polyline_set_polygon_mesh_M_vertex_count
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polygon_mesh_M_vertex_count < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -3039,14 +3241,14 @@ dxf_polyline_get_polygon_mesh_N_vertex_count
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->polygon_mesh_N_vertex_count < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the polygon_mesh_N_vertex_count member.\n")),
                   __FUNCTION__);
         }
@@ -3079,14 +3281,14 @@ dxf_polyline_set_polygon_mesh_N_vertex_count
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polygon_mesh_N_vertex_count < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -3116,14 +3318,14 @@ dxf_polyline_get_smooth_M_surface_density
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->smooth_M_surface_density < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the smooth_M_surface_density member.\n")),
                   __FUNCTION__);
         }
@@ -3156,14 +3358,14 @@ dxf_polyline_set_smooth_M_surface_density
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (smooth_M_surface_density < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -3194,14 +3396,14 @@ dxf_polyline_get_smooth_N_surface_density
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->smooth_N_surface_density < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the smooth_N_surface_density member.\n")),
                   __FUNCTION__);
         }
@@ -3234,14 +3436,14 @@ dxf_polyline_set_smooth_N_surface_density
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (smooth_N_surface_density < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -3271,14 +3473,14 @@ dxf_polyline_get_surface_type
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (polyline->surface_type < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the surface_type member.\n")),
                   __FUNCTION__);
         }
@@ -3310,14 +3512,14 @@ dxf_polyline_set_surface_type
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (surface_type < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
@@ -3342,14 +3544,14 @@ dxf_polyline_get_extr_x0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3378,13 +3580,13 @@ dxf_polyline_set_extr_x0
                  * \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3410,14 +3612,14 @@ dxf_polyline_get_extr_y0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3446,13 +3648,13 @@ dxf_polyline_set_extr_y0
                  * \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3478,14 +3680,14 @@ dxf_polyline_get_extr_z0
                 /*!< a pointer to a DXF \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
 
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -3514,13 +3716,13 @@ dxf_polyline_set_extr_z0
                  * \c POLYLINE entity. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3554,14 +3756,14 @@ dxf_polyline_get_vertices
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->vertices == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the vertices member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3593,14 +3795,14 @@ dxf_polyline_set_vertices
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (vertices == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3634,14 +3836,14 @@ dxf_polyline_get_next
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3672,14 +3874,14 @@ dxf_polyline_set_next
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -3713,14 +3915,14 @@ dxf_polyline_get_last
         /* Do some basic checks. */
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (polyline->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 return ((DxfPolyline *) polyline);
@@ -103,6 +103,9 @@ extern "C" {
 typedef struct
 dxf_polyline_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -315,6 +318,11 @@ dxf_polyline_init
         DxfPolyline *polyline
 );
 DxfPolyline *
+dxf_polyline_reset
+(
+        DxfPolyline *polyline
+);
+DxfPolyline *
 dxf_polyline_read
 (
         DxfFile *fp,
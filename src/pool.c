@@ -0,0 +1,1011 @@
+/*!
+ * \file pool.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF slab pools of frequently allocated
+ * structs.
+ *
+ * The \c DxfPoint, \c DxfLine, \c DxfVertex and
+ * \c DxfHatchBoundaryPathPolylineVertex structs are allocated from
+ * slabs: pages of equally sized slots with a free list, by
+ * \c dxf_point_new () and friends, and returned to the free list by
+ * \c dxf_point_free () and friends.\n
+ * Every slot starts with a pointer to the pool owning it.\n
+ * \n
+ * Without an active pool the slots come from a default pool of the
+ * calling thread, its pages are allocated with the process wide
+ * allocator and are kept for reuse (see \c dxf_pool_trim ()).\n
+ * Slots of a default pool may be freed by any thread, they are handed
+ * back to the owning thread through a lock free list.\n
+ * When an allocator is activated in the calling thread with
+ * \c dxf_allocator_activate () the structs are allocated with that
+ * allocator instead, so the memory accounting of a job is not
+ * bypassed.\n
+ * \n
+ * A pool created with \c dxf_pool_new () and activated with
+ * \c dxf_pool_activate () serves the slabs and, through an arena, all
+ * other memory libDXF allocates in the calling thread, for example the
+ * strings of the entities.\n
+ * A batch of entities, for example a chain of vertices built and
+ * thrown away in an editing session, is then released at once with
+ * \c dxf_pool_free () or \c dxf_pool_clear (), in a time proportional
+ * to the number of pages instead of the number of entities.\n
+ * Entities of such a pool can still be freed one at a time with their
+ * \c dxf_<type>_free () function, also on other threads as the slabs
+ * and the arena of the pool are locked, memory of the arena is only
+ * reclaimed when the pool is cleared or freed.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "pool.h"
+#include "point.h"
+#include "line.h"
+#include "vertex.h"
+#include "hatch.h"
+
+
+#define DXF_POOL_ALIGN 16
+        /*!< \brief Alignment of pages and arena blocks. */
+
+#define DXF_POOL_ROUND(size) \
+        (((size) + DXF_POOL_ALIGN - 1) & ~((size_t) DXF_POOL_ALIGN - 1))
+        /*!< \brief Round \c size up to the alignment. */
+
+#define DXF_POOL_PAGE_HEADER DXF_POOL_ROUND (sizeof (DxfPoolPage))
+        /*!< \brief Size of a page header including padding. */
+
+#define DXF_POOL_BLOCK_HEADER DXF_POOL_ROUND (sizeof (size_t))
+        /*!< \brief Size of the header of an arena block, holding the
+         * size of the block. */
+
+
+/*!
+ * \brief Header of a slot, followed by the struct.
+ *
+ * A struct allocated with the active allocator instead of a pool has
+ * two headers, the first holds the allocator.
+ */
+typedef union
+dxf_pool_slot_struct
+{
+        DxfPool *owner;
+                /*!< Pool owning the slot, or \c NULL when the struct
+                 * was allocated with the active allocator. */
+        DxfAllocator *allocator;
+                /*!< Allocator of a struct allocated without a pool. */
+        double align;
+                /*!< Alignment of the struct. */
+} DxfPoolSlot;
+
+
+/*! \brief Size of the structs per type. */
+static const size_t dxf_pool_object_size[DXF_POOL_NUMBER_OF_TYPES] =
+{
+        sizeof (DxfPoint),
+        sizeof (DxfLine),
+        sizeof (DxfVertex),
+        sizeof (DxfHatchBoundaryPathPolylineVertex)
+};
+
+/*! \brief The pool activated in the calling thread, or \c NULL. */
+static __thread DxfPool *dxf_pool_active = NULL;
+
+/*! \brief The default pool of the calling thread, or \c NULL. */
+static __thread DxfPool *dxf_pool_default = NULL;
+
+/*! \brief The default pools of all threads, they outlive their
+ * thread as their slots may still be in use. */
+static DxfPool *dxf_pool_defaults = NULL;
+
+
+/*!
+ * \brief Link of a free slot, stored after the slot header.
+ */
+#define DXF_POOL_SLOT_NEXT(slot) (*(DxfPoolSlot **) ((DxfPoolSlot *) (slot) + 1))
+
+
+static void *dxf_pool_arena_malloc (void *context, size_t size);
+static void *dxf_pool_arena_realloc (void *context, void *ptr, size_t size);
+static void dxf_pool_arena_free (void *context, void *ptr);
+static size_t dxf_pool_arena_usable_size (void *context, void *ptr);
+
+
+/*!
+ * \brief Initialize the members of a pool.
+ */
+static void
+dxf_pool_init_members
+(
+        DxfPool *pool,
+                /*!< a pointer to the pool. */
+        size_t page_size,
+                /*!< size of a page in bytes. */
+        int has_arena,
+                /*!< serve other allocations from an arena. */
+        const DxfAllocator *page_allocator
+                /*!< allocator for the pages. */
+)
+{
+        int i;
+
+        memset (pool, 0, sizeof (DxfPool));
+        for (i = 0; i < DXF_POOL_NUMBER_OF_TYPES; i++)
+        {
+                pool->slabs[i].slot_size = sizeof (DxfPoolSlot)
+                  + ((dxf_pool_object_size[i] + sizeof (DxfPoolSlot) - 1)
+                  / sizeof (DxfPoolSlot)) * sizeof (DxfPoolSlot);
+        }
+        pool->page_size = page_size;
+        pool->has_arena = has_arena;
+        pool->page_allocator = page_allocator;
+        pool->allocator.malloc = dxf_pool_arena_malloc;
+        pool->allocator.realloc = dxf_pool_arena_realloc;
+        pool->allocator.free = dxf_pool_arena_free;
+        pool->allocator.strdup = NULL;
+        pool->allocator.context = pool;
+        pool->allocator.usable_size = dxf_pool_arena_usable_size;
+        if (has_arena)
+        {
+                pthread_mutex_init (&pool->lock, NULL);
+        }
+}
+
+
+/*!
+ * \brief Allocate a page and prepend it to a list of pages.
+ *
+ * \return a pointer to the page, or \c NULL when no memory could be
+ * allocated.
+ */
+static DxfPoolPage *
+dxf_pool_page_new
+(
+        DxfPool *pool,
+                /*!< a pointer to the pool. */
+        DxfPoolPage **pages,
+                /*!< a pointer to the list of pages. */
+        size_t size
+                /*!< size of the page in bytes. */
+)
+{
+        DxfPoolPage *page;
+
+        page = pool->page_allocator->malloc (pool->page_allocator->context, size);
+        if (page == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a pool page.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        page->size = size;
+        page->next = (struct DxfPoolPage *) *pages;
+        *pages = page;
+        pool->number_of_pages++;
+        return (page);
+}
+
+
+/*!
+ * \brief Free a list of pages.
+ */
+static void
+dxf_pool_pages_free
+(
+        DxfPool *pool,
+                /*!< a pointer to the pool. */
+        DxfPoolPage *pages
+                /*!< a pointer to the list of pages. */
+)
+{
+        while (pages != NULL)
+        {
+                DxfPoolPage *iter = (DxfPoolPage *) pages->next;
+
+                pool->page_allocator->free (pool->page_allocator->context, pages);
+                pool->number_of_pages--;
+                pages = iter;
+        }
+}
+
+
+/*!
+ * \brief Take over the slots freed by other threads.
+ */
+static void
+dxf_pool_slab_drain
+(
+        DxfPoolSlab *slab
+                /*!< a pointer to the slab. */
+)
+{
+        DxfPoolSlot *slots;
+        DxfPoolSlot *last = NULL;
+        DxfPoolSlot *iter;
+
+        slots = __atomic_exchange_n (&slab->remote_free_list, NULL, __ATOMIC_ACQUIRE);
+        for (iter = slots; iter != NULL; iter = DXF_POOL_SLOT_NEXT (iter))
+        {
+                slab->number_of_objects--;
+                last = iter;
+        }
+        if (last != NULL)
+        {
+                DXF_POOL_SLOT_NEXT (last) = slab->free_list;
+                slab->free_list = slots;
+        }
+}
+
+
+/*!
+ * \brief Allocate a slot from a slab of a pool.
+ *
+ * \return a pointer to the struct in the slot, or \c NULL when no
+ * memory could be allocated.
+ */
+static void *
+dxf_pool_slab_alloc
+(
+        DxfPool *pool,
+                /*!< a pointer to the pool. */
+        DxfPoolType type
+                /*!< type of struct. */
+)
+{
+        DxfPoolSlab *slab = &pool->slabs[type];
+        DxfPoolSlot *slot = NULL;
+
+        if (pool->has_arena)
+        {
+                pthread_mutex_lock (&pool->lock);
+        }
+        if ((slab->free_list == NULL)
+          && (__atomic_load_n (&slab->remote_free_list, __ATOMIC_RELAXED) != NULL))
+        {
+                dxf_pool_slab_drain (slab);
+        }
+        if (slab->free_list != NULL)
+        {
+                slot = slab->free_list;
+                slab->free_list = DXF_POOL_SLOT_NEXT (slot);
+        }
+        else
+        {
+                if ((slab->cursor == NULL)
+                  || (slab->cursor + slab->slot_size > slab->end))
+                {
+                        DxfPoolPage *page;
+
+                        page = dxf_pool_page_new (pool, &slab->pages, pool->page_size);
+                        if (page != NULL)
+                        {
+                                slab->cursor = (unsigned char *) page + DXF_POOL_PAGE_HEADER;
+                                slab->end = (unsigned char *) page + pool->page_size;
+                        }
+                }
+                if ((slab->cursor != NULL)
+                  && (slab->cursor + slab->slot_size <= slab->end))
+                {
+                        slot = (DxfPoolSlot *) slab->cursor;
+                        slab->cursor += slab->slot_size;
+                }
+        }
+        if (slot != NULL)
+        {
+                slot->owner = pool;
+                slab->number_of_objects++;
+        }
+        if (pool->has_arena)
+        {
+                pthread_mutex_unlock (&pool->lock);
+        }
+        return ((slot != NULL) ? slot + 1 : NULL);
+}
+
+
+/*!
+ * \brief Allocate memory from the arena of a pool, with the lock of
+ * the pool held.
+ *
+ * \return a pointer to the memory, or \c NULL.
+ */
+static void *
+dxf_pool_arena_malloc_locked
+(
+        DxfPool *pool,
+                /*!< a pointer to the pool. */
+        size_t size
+                /*!< number of bytes. */
+)
+{
+        size_t block_size = DXF_POOL_BLOCK_HEADER + DXF_POOL_ROUND (size);
+        unsigned char *block;
+
+        if (block_size > pool->page_size - DXF_POOL_PAGE_HEADER)
+        {
+                /* A page of its own, the newest page stays in use. */
+                DxfPoolPage *page;
+                DxfPoolPage *newest = pool->arena_pages;
+
+                page = dxf_pool_page_new (pool, &pool->arena_pages,
+                  DXF_POOL_PAGE_HEADER + block_size);
+                if (page == NULL)
+                {
+                        return (NULL);
+                }
+                if (newest != NULL)
+                {
+                        pool->arena_pages = newest;
+                        page->next = newest->next;
+                        newest->next = (struct DxfPoolPage *) page;
+                }
+                block = (unsigned char *) page + DXF_POOL_PAGE_HEADER;
+                *(size_t *) block = DXF_POOL_ROUND (size);
+                return (block + DXF_POOL_BLOCK_HEADER);
+        }
+        if ((pool->arena_cursor == NULL)
+          || (pool->arena_cursor + block_size > pool->arena_end))
+        {
+                DxfPoolPage *page;
+
+                page = dxf_pool_page_new (pool, &pool->arena_pages, pool->page_size);
+                if (page == NULL)
+                {
+                        return (NULL);
+                }
+                pool->arena_cursor = (unsigned char *) page + DXF_POOL_PAGE_HEADER;
+                pool->arena_end = (unsigned char *) page + pool->page_size;
+        }
+        block = pool->arena_cursor;
+        pool->arena_cursor += block_size;
+        *(size_t *) block = DXF_POOL_ROUND (size);
+        pool->arena_last = block + DXF_POOL_BLOCK_HEADER;
+        return (pool->arena_last);
+}
+
+
+/*!
+ * \brief Allocate memory from the arena of a pool.
+ *
+ * \return a pointer to the memory, or \c NULL.
+ */
+static void *
+dxf_pool_arena_malloc
+(
+        void *context,
+                /*!< a pointer to the pool. */
+        size_t size
+                /*!< number of bytes. */
+)
+{
+        DxfPool *pool = (DxfPool *) context;
+        void *ptr;
+
+        pthread_mutex_lock (&pool->lock);
+        ptr = dxf_pool_arena_malloc_locked (pool, size);
+        pthread_mutex_unlock (&pool->lock);
+        return (ptr);
+}
+
+
+/*!
+ * \brief Resize memory from the arena of a pool.
+ *
+ * The last allocated block is resized in place when it fits.
+ *
+ * \return a pointer to the memory, or \c NULL.
+ */
+static void *
+dxf_pool_arena_realloc
+(
+        void *context,
+                /*!< a pointer to the pool. */
+        void *ptr,
+                /*!< a pointer to the memory, or \c NULL. */
+        size_t size
+                /*!< number of bytes. */
+)
+{
+        DxfPool *pool = (DxfPool *) context;
+        unsigned char *block;
+        size_t old_size;
+        void *new_ptr;
+
+        if (ptr == NULL)
+        {
+                return (dxf_pool_arena_malloc (context, size));
+        }
+        block = (unsigned char *) ptr - DXF_POOL_BLOCK_HEADER;
+        old_size = *(size_t *) block;
+        if (size <= old_size)
+        {
+                return (ptr);
+        }
+        pthread_mutex_lock (&pool->lock);
+        if ((ptr == pool->arena_last)
+          && ((unsigned char *) ptr + DXF_POOL_ROUND (size) <= pool->arena_end))
+        {
+                *(size_t *) block = DXF_POOL_ROUND (size);
+                pool->arena_cursor = (unsigned char *) ptr + DXF_POOL_ROUND (size);
+                new_ptr = ptr;
+        }
+        else
+        {
+                new_ptr = dxf_pool_arena_malloc_locked (pool, size);
+                if (new_ptr != NULL)
+                {
+                        memcpy (new_ptr, ptr, old_size);
+                }
+        }
+        pthread_mutex_unlock (&pool->lock);
+        return (new_ptr);
+}
+
+
+/*!
+ * \brief Free memory from the arena of a pool.
+ *
+ * Only the last allocated block is reclaimed, all other memory is
+ * reclaimed when the pool is cleared or freed.
+ */
+static void
+dxf_pool_arena_free
+(
+        void *context,
+                /*!< a pointer to the pool. */
+        void *ptr
+                /*!< a pointer to the memory. */
+)
+{
+        DxfPool *pool = (DxfPool *) context;
+
+        pthread_mutex_lock (&pool->lock);
+        if ((ptr != NULL) && (ptr == pool->arena_last))
+        {
+                pool->arena_cursor = (unsigned char *) ptr - DXF_POOL_BLOCK_HEADER;
+                pool->arena_last = NULL;
+        }
+        pthread_mutex_unlock (&pool->lock);
+}
+
+
+/*!
+ * \brief Get the number of usable bytes of memory from the arena of a
+ * pool.
+ *
+ * \return the number of bytes.
+ */
+static size_t
+dxf_pool_arena_usable_size
+(
+        void *context,
+                /*!< a pointer to the pool. */
+        void *ptr
+                /*!< a pointer to the memory. */
+)
+{
+        (void) context;
+        return (*(size_t *) ((unsigned char *) ptr - DXF_POOL_BLOCK_HEADER));
+}
+
+
+/*!
+ * \brief Get the default pool of the calling thread, create it when
+ * needed.
+ *
+ * \return a pointer to the pool, or \c NULL when no memory could be
+ * allocated.
+ */
+static DxfPool *
+dxf_pool_get_default ()
+{
+        DxfPool *pool;
+        DxfPool *head;
+
+        if (dxf_pool_default != NULL)
+        {
+                return (dxf_pool_default);
+        }
+        /* The pool outlives its thread, it is not allocated with the
+         * allocator of libDXF, which would count it as in use. */
+        pool = malloc (sizeof (DxfPool));
+        if (pool == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfPool struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_pool_init_members (pool, DXF_POOL_DEFAULT_PAGE_SIZE, FALSE, dxf_get_allocator ());
+        /* Lock free prepend to the list of default pools. */
+        head = __atomic_load_n (&dxf_pool_defaults, __ATOMIC_ACQUIRE);
+        do
+        {
+                pool->next = (struct DxfPool *) head;
+        }
+        while (!__atomic_compare_exchange_n (&dxf_pool_defaults, &head,
+          pool, 1, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+        dxf_pool_default = pool;
+        return (pool);
+}
+
+
+/*!
+ * \brief Allocate and initialize a pool.
+ *
+ * The pages of the pool are allocated with the allocator in use by the
+ * calling thread.
+ *
+ * \return a pointer to the pool, or \c NULL when an error occurred.
+ */
+DxfPool *
+dxf_pool_new
+(
+        size_t page_size
+                /*!< size of a page in bytes, or 0 for
+                 * \c DXF_POOL_DEFAULT_PAGE_SIZE. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPool *pool = NULL;
+        const DxfAllocator *allocator;
+
+        if (page_size == 0)
+        {
+                page_size = DXF_POOL_DEFAULT_PAGE_SIZE;
+        }
+        if (page_size < 1024)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a page size of less than 1024 bytes was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        allocator = dxf_allocator_get_active ();
+        if (allocator == NULL)
+        {
+                allocator = dxf_get_allocator ();
+        }
+        if ((pool = allocator->malloc (allocator->context, sizeof (DxfPool))) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfPool struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_pool_init_members (pool, page_size, TRUE, allocator);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (pool);
+}
+
+
+/*!
+ * \brief Free a pool and everything allocated from it.
+ *
+ * The pool is deactivated first when it is active.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_pool_free
+(
+        DxfPool *pool
+                /*!< a pointer to the pool. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfAllocator *allocator;
+
+        /* Do some basic checks. */
+        if (pool == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!pool->has_arena)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the default pool of a thread can not be freed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_pool_active == pool)
+        {
+                dxf_pool_activate (NULL);
+        }
+        dxf_pool_clear (pool);
+        pthread_mutex_destroy (&pool->lock);
+        allocator = pool->page_allocator;
+        allocator->free (allocator->context, pool);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Release everything allocated from a pool, the pool stays
+ * usable.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_pool_clear
+(
+        DxfPool *pool
+                /*!< a pointer to the pool. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if ((pool == NULL) || (!pool->has_arena))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer or a default pool was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        pthread_mutex_lock (&pool->lock);
+        for (i = 0; i < DXF_POOL_NUMBER_OF_TYPES; i++)
+        {
+                DxfPoolSlab *slab = &pool->slabs[i];
+
+                dxf_pool_pages_free (pool, slab->pages);
+                slab->pages = NULL;
+                slab->free_list = NULL;
+                slab->remote_free_list = NULL;
+                slab->cursor = NULL;
+                slab->end = NULL;
+                slab->number_of_objects = 0;
+        }
+        dxf_pool_pages_free (pool, pool->arena_pages);
+        pool->arena_pages = NULL;
+        pool->arena_cursor = NULL;
+        pool->arena_end = NULL;
+        pool->arena_last = NULL;
+        pthread_mutex_unlock (&pool->lock);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Activate a pool in the calling thread.
+ *
+ * While a pool is active the structs of the slabs are allocated from
+ * its slabs and all other memory from its arena.
+ *
+ * \return the previously activated pool, to be activated again when
+ * done, or \c NULL.
+ */
+DxfPool *
+dxf_pool_activate
+(
+        DxfPool *pool
+                /*!< a pointer to the pool, or \c NULL to deactivate
+                 * the active pool. */
+)
+{
+        DxfPool *previous = dxf_pool_active;
+
+        if ((pool != NULL) && (!pool->has_arena))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the default pool of a thread can not be activated.\n")),
+                  __FUNCTION__);
+                return (previous);
+        }
+        if (previous != NULL)
+        {
+                dxf_allocator_activate (previous->previous_allocator);
+        }
+        if (pool != NULL)
+        {
+                pool->previous_allocator = dxf_allocator_activate (&pool->allocator);
+        }
+        dxf_pool_active = pool;
+        return (previous);
+}
+
+
+/*!
+ * \brief Get the pool activated in the calling thread.
+ *
+ * \return a pointer to the pool, or \c NULL.
+ */
+DxfPool *
+dxf_pool_get_active ()
+{
+        return (dxf_pool_active);
+}
+
+
+/*!
+ * \brief Get the number of structs of a type in use.
+ *
+ * \return the number of structs.
+ */
+uint64_t
+dxf_pool_get_number_of_objects
+(
+        DxfPool *pool,
+                /*!< a pointer to the pool, or \c NULL for the default
+                 * pool of the calling thread. */
+        DxfPoolType type
+                /*!< type of struct. */
+)
+{
+        uint64_t number_of_objects;
+
+        if (pool == NULL)
+        {
+                pool = dxf_pool_default;
+        }
+        if ((pool == NULL) || (type < 0) || (type >= DXF_POOL_NUMBER_OF_TYPES))
+        {
+                return (0);
+        }
+        if (pool->has_arena)
+        {
+                pthread_mutex_lock (&pool->lock);
+                number_of_objects = pool->slabs[type].number_of_objects;
+                pthread_mutex_unlock (&pool->lock);
+                return (number_of_objects);
+        }
+        dxf_pool_slab_drain (&pool->slabs[type]);
+        return (pool->slabs[type].number_of_objects);
+}
+
+
+/*!
+ * \brief Get the number of pages allocated by a pool.
+ *
+ * \return the number of pages.
+ */
+int
+dxf_pool_get_number_of_pages
+(
+        DxfPool *pool
+                /*!< a pointer to the pool, or \c NULL for the default
+                 * pool of the calling thread. */
+)
+{
+        if (pool == NULL)
+        {
+                pool = dxf_pool_default;
+        }
+        if (pool == NULL)
+        {
+                return (0);
+        }
+        return (pool->number_of_pages);
+}
+
+
+/*!
+ * \brief Free the pages of the default pool of the calling thread for
+ * the types of which no structs are in use.
+ *
+ * \return \c EXIT_SUCCESS when done.
+ */
+int
+dxf_pool_trim ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPool *pool = dxf_pool_default;
+        int i;
+
+        if (pool == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        for (i = 0; i < DXF_POOL_NUMBER_OF_TYPES; i++)
+        {
+                DxfPoolSlab *slab = &pool->slabs[i];
+
+                dxf_pool_slab_drain (slab);
+                if (slab->number_of_objects == 0)
+                {
+                        dxf_pool_pages_free (pool, slab->pages);
+                        slab->pages = NULL;
+                        slab->free_list = NULL;
+                        slab->cursor = NULL;
+                        slab->end = NULL;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate a struct.
+ *
+ * The struct is taken from the active pool, or else from the default
+ * pool of the calling thread, or else, when an allocator is active,
+ * allocated with \c dxf_malloc ().
+ *
+ * \return a pointer to the uninitialized struct, or \c NULL when no
+ * memory could be allocated.
+ */
+void *
+dxf_pool_alloc
+(
+        DxfPoolType type
+                /*!< type of struct. */
+)
+{
+        DxfPool *pool = dxf_pool_active;
+        DxfAllocator *allocator;
+        DxfPoolSlot *slot;
+
+        if (pool == NULL)
+        {
+                allocator = dxf_allocator_get_active ();
+                if (allocator != NULL)
+                {
+                        /* The allocator is recorded, to free the struct
+                         * and its members with it. */
+                        slot = allocator->malloc (allocator->context,
+                          2 * sizeof (DxfPoolSlot) + dxf_pool_object_size[type]);
+                        if (slot == NULL)
+                        {
+                                return (NULL);
+                        }
+                        slot[0].allocator = allocator;
+                        slot[1].owner = NULL;
+                        return (slot + 2);
+                }
+                if ((pool = dxf_pool_get_default ()) == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        return (dxf_pool_slab_alloc (pool, type));
+}
+
+
+/*!
+ * \brief Release a struct allocated with \c dxf_pool_alloc ().
+ *
+ * The slot is put on the free list of the pool owning it.
+ */
+void
+dxf_pool_release
+(
+        DxfPoolType type,
+                /*!< type of struct. */
+        void *object
+                /*!< a pointer to the struct, or \c NULL. */
+)
+{
+        DxfPoolSlot *slot;
+        DxfPool *owner;
+        DxfPoolSlab *slab;
+
+        if (object == NULL)
+        {
+                return;
+        }
+        slot = (DxfPoolSlot *) object - 1;
+        owner = slot->owner;
+        if (owner == NULL)
+        {
+                slot--;
+                slot->allocator->free (slot->allocator->context, slot);
+                return;
+        }
+        slab = &owner->slabs[type];
+        if (owner->has_arena)
+        {
+                pthread_mutex_lock (&owner->lock);
+                DXF_POOL_SLOT_NEXT (slot) = slab->free_list;
+                slab->free_list = slot;
+                slab->number_of_objects--;
+                pthread_mutex_unlock (&owner->lock);
+        }
+        else if (owner == dxf_pool_default)
+        {
+                DXF_POOL_SLOT_NEXT (slot) = slab->free_list;
+                slab->free_list = slot;
+                slab->number_of_objects--;
+        }
+        else
+        {
+                /* Lock free hand back to the owning thread. */
+                DxfPoolSlot *head;
+
+                head = __atomic_load_n ((DxfPoolSlot **) &slab->remote_free_list, __ATOMIC_RELAXED);
+                do
+                {
+                        DXF_POOL_SLOT_NEXT (slot) = head;
+                }
+                while (!__atomic_compare_exchange_n ((DxfPoolSlot **) &slab->remote_free_list,
+                  &head, slot, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+        }
+}
+
+
+/*!
+ * \brief Activate the allocator owning the members of a struct
+ * allocated with \c dxf_pool_alloc ().
+ *
+ * To be called before the members of the struct are freed, the
+ * returned allocator is to be activated again afterwards.
+ *
+ * \return the previously activated allocator, or \c NULL.
+ */
+DxfAllocator *
+dxf_pool_activate_owner
+(
+        void *object
+                /*!< a pointer to the struct. */
+)
+{
+        DxfPoolSlot *slot = (DxfPoolSlot *) object - 1;
+        DxfPool *owner = slot->owner;
+
+        if (owner == NULL)
+        {
+                /* Allocated with the allocator recorded before the
+                 * slot. */
+                return (dxf_allocator_activate ((slot - 1)->allocator));
+        }
+        if (owner->has_arena)
+        {
+                return (dxf_allocator_activate (&owner->allocator));
+        }
+        /* The pages of a default pool and the members of its structs
+         * are allocated with the process wide allocator. */
+        return (dxf_allocator_activate ((DxfAllocator *) owner->page_allocator));
+}
+
+
+/* EOF */
@@ -0,0 +1,174 @@
+/*!
+ * \file pool.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF slab pools of frequently allocated
+ * structs.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_POOL_H
+#define LIBDXF_SRC_POOL_H
+
+
+#include "global.h"
+#include <pthread.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_POOL_DEFAULT_PAGE_SIZE 65536
+        /*!< \brief Default size in bytes of a pool page. */
+
+
+/*!
+ * \brief Types of structs allocated from the slabs of a pool.
+ */
+typedef enum
+dxf_pool_type
+{
+        DXF_POOL_POINT,
+        DXF_POOL_LINE,
+        DXF_POOL_VERTEX,
+        DXF_POOL_HATCH_BOUNDARY_PATH_POLYLINE_VERTEX,
+        DXF_POOL_NUMBER_OF_TYPES
+} DxfPoolType;
+
+
+/*!
+ * \brief A page of memory of a pool, the memory follows the page
+ * header.
+ */
+typedef struct
+dxf_pool_page_struct
+{
+        struct DxfPoolPage *next;
+                /*!< Pointer to the next page. */
+        size_t size;
+                /*!< Size of the page in bytes, including the page
+                 * header. */
+} DxfPoolPage;
+
+
+/*!
+ * \brief Slab of equally sized slots for one type of struct.
+ */
+typedef struct
+dxf_pool_slab_struct
+{
+        size_t slot_size;
+                /*!< Size of a slot in bytes, including the slot
+                 * header. */
+        DxfPoolPage *pages;
+                /*!< Pages of this slab. */
+        void *free_list;
+                /*!< Freed slots, linked through their first bytes. */
+        unsigned char *cursor;
+                /*!< Next never used slot in the newest page. */
+        unsigned char *end;
+                /*!< End of the newest page. */
+        void *remote_free_list;
+                /*!< Slots freed by other threads, taken over when
+                 * \c free_list runs empty. */
+        uint64_t number_of_objects;
+                /*!< Number of objects in use. */
+} DxfPoolSlab;
+
+
+/*!
+ * \brief Pool of slabs for the frequently allocated structs, and an
+ * arena for all other memory allocated while the pool is active.
+ *
+ * Everything allocated from a pool is released at once, in a time
+ * proportional to the number of pages, with \c dxf_pool_free ().\n
+ * A pool is active in one thread at a time, its structs may be freed
+ * on any thread.
+ */
+typedef struct
+dxf_pool_struct
+{
+        DxfPoolSlab slabs[DXF_POOL_NUMBER_OF_TYPES];
+                /*!< Slabs per type. */
+        size_t page_size;
+                /*!< Size of a page in bytes. */
+        int number_of_pages;
+                /*!< Number of pages of the slabs and the arena. */
+        int has_arena;
+                /*!< Allocations other than slab objects are served
+                 * from \c arena_pages when the pool is active. */
+        DxfPoolPage *arena_pages;
+                /*!< Pages of the arena. */
+        unsigned char *arena_cursor;
+                /*!< Next free byte in the newest arena page. */
+        unsigned char *arena_end;
+                /*!< End of the newest arena page. */
+        unsigned char *arena_last;
+                /*!< Last block allocated from the arena, it can be
+                 * resized and freed in place. */
+        const DxfAllocator *page_allocator;
+                /*!< Allocator for the pages. */
+        DxfAllocator allocator;
+                /*!< Allocator serving from the arena. */
+        DxfAllocator *previous_allocator;
+                /*!< Allocator that was active before the pool was
+                 * activated. */
+        struct DxfPool *next;
+                /*!< Pointer to the next default pool of a thread. */
+        pthread_mutex_t lock;
+                /*!< Lock of the slabs and the arena of a pool with an
+                 * arena, its structs and arena memory may be freed on
+                 * other threads. */
+} DxfPool;
+
+
+DxfPool *dxf_pool_new (size_t page_size);
+int dxf_pool_free (DxfPool *pool);
+int dxf_pool_clear (DxfPool *pool);
+DxfPool *dxf_pool_activate (DxfPool *pool);
+DxfPool *dxf_pool_get_active ();
+uint64_t dxf_pool_get_number_of_objects (DxfPool *pool, DxfPoolType type);
+int dxf_pool_get_number_of_pages (DxfPool *pool);
+int dxf_pool_trim ();
+void *dxf_pool_alloc (DxfPoolType type);
+void dxf_pool_release (DxfPoolType type, void *object);
+DxfAllocator *dxf_pool_activate_owner (void *object);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_POOL_H */
+
+
+/* EOF */
@@ -33,6 +33,7 @@
 
 
 #include "proprietary_data.h"
+#include "util.h"
 
 
 /*!
@@ -52,9 +53,9 @@ dxf_proprietary_data_new ()
         size = sizeof (DxfProprietaryData);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
+        if ((data = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfProprietaryData struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -90,19 +91,19 @@ dxf_proprietary_data_init
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 data = dxf_proprietary_data_new ();
         }
         if (data == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfProprietaryData struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        data->line = strdup ("");
+        data->line = dxf_strdup ("");
         data->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -132,13 +133,13 @@ dxf_proprietary_data_free
         /* Do some basic checks. */
         if (data->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfProprietaryData was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (data->line);
-        free (data);
+        dxf_free (data->line);
+        dxf_free (data);
         data = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -159,18 +160,19 @@ dxf_proprietary_data_free_chain
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (datas == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (datas != NULL)
         {
                 struct DxfProprietaryData *iter = datas->next;
+                datas->next = NULL;
                 dxf_proprietary_data_free (datas);
                 datas = (DxfProprietaryData *) iter;
         }
@@ -199,14 +201,14 @@ dxf_proprietary_data_get_order
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->order < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the order member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -237,14 +239,14 @@ dxf_proprietary_data_set_order
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (order < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative order value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -275,14 +277,14 @@ dxf_proprietary_data_get_line
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data->line ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the line member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -290,7 +292,7 @@ dxf_proprietary_data_get_line
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (data->line));
+        return (dxf_strdup (data->line));
 }
 
 
@@ -315,19 +317,19 @@ dxf_proprietary_data_set_line
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        data->line = strdup (line);
+        data->line = dxf_strdup (line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -354,21 +356,21 @@ dxf_proprietary_data_get_length
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the length member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->length == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a zero value was found in the length member.\n")),
                   __FUNCTION__);
         }
@@ -398,14 +400,14 @@ dxf_proprietary_data_set_length
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative length value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -439,14 +441,14 @@ dxf_proprietary_data_get_next
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data->next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the next member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -481,14 +483,14 @@ dxf_proprietary_data_set_next
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (next == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -527,28 +529,28 @@ dxf_proprietary_data_test_length
         /* Do some basic checks. */
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the line member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->length == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a value of 0 was found in the length member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (data->length < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the length member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -561,7 +563,7 @@ dxf_proprietary_data_test_length
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () the value found in the length member did not match the actual string length.\n")),
                           __FUNCTION__);
                         return (EXIT_FAILURE);
@@ -574,4 +576,521 @@ dxf_proprietary_data_test_length
 }
 
 
+/*!
+ * \brief Read the value of a proprietary data group from a file into
+ * a chain of DXF \c DxfProprietaryData objects.
+ *
+ * The value is stored in \c data when it is the unused link created by
+ * \c dxf_proprietary_data_init (), otherwise a new link is appended
+ * after \c data.
+ *
+ * \return a pointer to the link holding the value, which is the new
+ * last link of the chain, or \c NULL when an error occurred.
+ */
+DxfProprietaryData *
+dxf_proprietary_data_read_line
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfProprietaryData *data,
+                /*!< a pointer to the last link of the chain. */
+        int order
+                /*!< the incremental counter of the group. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfProprietaryData *link = NULL;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (data == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                dxf_read_string (fp, NULL);
+                return (NULL);
+        }
+        if ((data->order == 0)
+          && ((data->line == NULL) || (data->line[0] == '\0')))
+        {
+                link = data;
+        }
+        else
+        {
+                link = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+                if (link == NULL)
+                {
+                        dxf_read_string (fp, NULL);
+                        return (NULL);
+                }
+                data->next = (struct DxfProprietaryData *) link;
+        }
+        if (dxf_read_string (fp, &link->line) == EXIT_FAILURE)
+        {
+                return (NULL);
+        }
+        link->length = strlen (link->line);
+        link->order = order;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (link);
+}
+
+
+/*!
+ * \brief Write the proprietary data (group code 1) and additional
+ * proprietary data (group code 3) of an entity to a file.
+ *
+ * The links of both chains are merged in the order of their
+ * incremental counter, unused links are not written.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_proprietary_data_write_chains
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfProprietaryData *data,
+                /*!< a pointer to the chain of proprietary data. */
+        DxfProprietaryData *additional_data
+                /*!< a pointer to the chain of additional proprietary
+                 * data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        while ((data != NULL) || (additional_data != NULL))
+        {
+                if ((data != NULL)
+                  && ((additional_data == NULL)
+                  || (data->order <= additional_data->order)))
+                {
+                        if ((data->line != NULL)
+                          && ((data->order > 0) || (data->line[0] != '\0')))
+                        {
+                                fprintf (fp->fp, "  1\n%s\n", data->line);
+                        }
+                        data = (DxfProprietaryData *) data->next;
+                }
+                else
+                {
+                        if ((additional_data->line != NULL)
+                          && ((additional_data->order > 0) || (additional_data->line[0] != '\0')))
+                        {
+                                fprintf (fp->fp, "  3\n%s\n", additional_data->line);
+                        }
+                        additional_data = (DxfProprietaryData *) additional_data->next;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Skip the remainder of a line.
+ *
+ * \return the number of characters skipped, or -1 when nothing could be
+ * read.
+ */
+static off_t
+dxf_proprietary_data_skip_line
+(
+        FILE *fp
+                /*!< the input file. */
+)
+{
+        char buffer[DXF_MAX_STRING_LENGTH];
+        size_t length;
+        off_t skipped = 0;
+
+        do
+        {
+                if (fgets (buffer, sizeof (buffer), fp) == NULL)
+                {
+                        return ((skipped > 0) ? skipped : -1);
+                }
+                length = strlen (buffer);
+                skipped += length;
+        }
+        while ((length > 0) && (buffer[length - 1] != '\n'));
+        return (skipped);
+}
+
+
+/*!
+ * \brief Skip the value of a proprietary data group in a file and add
+ * the group to the recorded location of the proprietary data.
+ *
+ * The last line read from file contained the group code (1 or 3), the
+ * range is allocated at the first group of an entity.\n
+ * Nothing is allocated for the value itself, it is loaded by
+ * \c dxf_proprietary_data_range_load () when needed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_proprietary_data_range_skip
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfProprietaryDataRange **range,
+                /*!< a pointer to the range of the entity, \c NULL
+                 * before the first group. */
+        int group_code
+                /*!< the group code which was read, 1 or 3. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        off_t offset;
+        off_t skipped;
+        off_t value;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (range == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* The position following the group code, the end of the
+         * previous group of the range lies before the group code line
+         * and can not stand in for it. */
+        offset = ftello (fp->fp);
+        if (*range == NULL)
+        {
+                if ((offset < 0) || (fp->filename == NULL))
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () the position in: %s could not be recorded.\n")),
+                          __FUNCTION__, fp->filename);
+                        return (EXIT_FAILURE);
+                }
+                if ((*range = dxf_malloc (sizeof (DxfProprietaryDataRange))) == NULL)
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for a DxfProprietaryDataRange struct.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                memset (*range, 0, sizeof (DxfProprietaryDataRange));
+                (*range)->filename = dxf_strdup (fp->filename);
+                (*range)->offset = offset;
+                (*range)->first_group_code = group_code;
+                (*range)->line_number = fp->line_number;
+        }
+        /* Skip the remainder of the group code line and the value. */
+        if (((skipped = dxf_proprietary_data_skip_line (fp->fp)) < 0)
+          || ((value = dxf_proprietary_data_skip_line (fp->fp)) < 0))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (EXIT_FAILURE);
+        }
+        if (offset < 0)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the position in: %s could not be recorded.\n")),
+                  __FUNCTION__, fp->filename);
+                return (EXIT_FAILURE);
+        }
+        (*range)->end = offset + skipped + value;
+        (*range)->end_line_number = fp->line_number;
+        (*range)->number_of_groups++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Undo a failed \c dxf_proprietary_data_range_load () on a
+ * chain of proprietary data.
+ *
+ * The links appended after \c last are freed, \c last is reset when
+ * it was the unused link created by \c dxf_proprietary_data_init (),
+ * and a chain allocated by the load is freed.
+ */
+static void
+dxf_proprietary_data_range_unload
+(
+        DxfProprietaryData **data,
+                /*!< a pointer to the chain of proprietary data. */
+        DxfProprietaryData *last,
+                /*!< the last link of the chain before the load, or
+                 * \c NULL when the load did not get to it. */
+        int unused,
+                /*!< \c last was the unused link before the load. */
+        int new_data
+                /*!< the chain was allocated by the load. */
+)
+{
+        if (*data == NULL)
+        {
+                return;
+        }
+        if (new_data)
+        {
+                dxf_proprietary_data_free_chain (*data);
+                *data = NULL;
+                return;
+        }
+        if (last == NULL)
+        {
+                return;
+        }
+        if (last->next != NULL)
+        {
+                dxf_proprietary_data_free_chain ((DxfProprietaryData *) last->next);
+                last->next = NULL;
+        }
+        if (unused)
+        {
+                dxf_string_assign (&last->line, "");
+                last->length = 0;
+                last->order = 0;
+        }
+}
+
+
+/*!
+ * \brief Load the proprietary data of an entity from the file it was
+ * read from.
+ *
+ * The file is opened on its own, so it does not matter whether the
+ * \c DxfFile the entity was read from is still open.\n
+ * Groups with other group codes inside the range are skipped, the
+ * values are appended to the chains (which are allocated when
+ * \c NULL) after their last link.\n
+ * When the data could not be loaded the chains are left as they were
+ * passed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the file
+ * could not be read.
+ */
+int
+dxf_proprietary_data_range_load
+(
+        DxfProprietaryDataRange *range,
+                /*!< a pointer to the recorded location. */
+        DxfProprietaryData **data,
+                /*!< a pointer to the chain of proprietary data. */
+        DxfProprietaryData **additional_data
+                /*!< a pointer to the chain of additional proprietary
+                 * data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile source;
+        DxfProprietaryData *last = NULL;
+        DxfProprietaryData *additional_last = NULL;
+        DxfProprietaryData *first_last = NULL;
+        DxfProprietaryData *first_additional_last = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int first_unused;
+        int first_additional_unused;
+        int new_data = FALSE;
+        int new_additional_data = FALSE;
+        int group_code;
+        int order = 0;
+        int number_of_groups = 0;
+        int status = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((range == NULL) || (data == NULL) || (additional_data == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (*data == NULL)
+        {
+                *data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+                new_data = TRUE;
+        }
+        if (*additional_data == NULL)
+        {
+                *additional_data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+                new_additional_data = TRUE;
+        }
+        if ((*data == NULL) || (*additional_data == NULL))
+        {
+                dxf_proprietary_data_range_unload (data, NULL, FALSE, new_data);
+                dxf_proprietary_data_range_unload (additional_data, NULL, FALSE, new_additional_data);
+                return (EXIT_FAILURE);
+        }
+        /* Continue after the last links and their counters. */
+        for (last = *data; last->next != NULL; last = (DxfProprietaryData *) last->next)
+        {
+                order = (last->order > order) ? last->order : order;
+        }
+        order = (last->order > order) ? last->order : order;
+        for (additional_last = *additional_data; additional_last->next != NULL;
+          additional_last = (DxfProprietaryData *) additional_last->next)
+        {
+                order = (additional_last->order > order) ? additional_last->order : order;
+        }
+        order = (additional_last->order > order) ? additional_last->order : order;
+        first_last = last;
+        first_additional_last = additional_last;
+        first_unused = (last->order == 0)
+          && ((last->line == NULL) || (last->line[0] == '\0'));
+        first_additional_unused = (additional_last->order == 0)
+          && ((additional_last->line == NULL) || (additional_last->line[0] == '\0'));
+        memset (&source, 0, sizeof (DxfFile));
+        source.filename = range->filename;
+        source.line_number = range->line_number - 1;
+        source.fp = fopen (range->filename, "r");
+        if (source.fp == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not open file: %s for reading.\n")),
+                  __FUNCTION__, range->filename);
+                dxf_proprietary_data_range_unload (data, first_last, first_unused, new_data);
+                dxf_proprietary_data_range_unload (additional_data, first_additional_last, first_additional_unused, new_additional_data);
+                return (EXIT_FAILURE);
+        }
+        if (fseeko (source.fp, range->offset, SEEK_SET) != 0)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not find the proprietary data in: %s.\n")),
+                  __FUNCTION__, range->filename);
+                fclose (source.fp);
+                dxf_proprietary_data_range_unload (data, first_last, first_unused, new_data);
+                dxf_proprietary_data_range_unload (additional_data, first_additional_last, first_additional_unused, new_additional_data);
+                return (EXIT_FAILURE);
+        }
+        group_code = range->first_group_code;
+        while (status == EXIT_SUCCESS)
+        {
+                source.line_number++;
+                if (group_code == 1)
+                {
+                        last = dxf_proprietary_data_read_line (&source, last, ++order);
+                        number_of_groups++;
+                        status = (last == NULL) ? EXIT_FAILURE : EXIT_SUCCESS;
+                }
+                else if (group_code == 3)
+                {
+                        additional_last = dxf_proprietary_data_read_line (&source, additional_last, ++order);
+                        number_of_groups++;
+                        status = (additional_last == NULL) ? EXIT_FAILURE : EXIT_SUCCESS;
+                }
+                else
+                {
+                        status = dxf_read_string (&source, NULL);
+                }
+                if ((status == EXIT_FAILURE)
+                  || (number_of_groups >= range->number_of_groups))
+                {
+                        break;
+                }
+                /* Read the next group code. */
+                source.line_number++;
+                if (fscanf (source.fp, " %[^\n]", temp_string) != 1)
+                {
+                        status = EXIT_FAILURE;
+                        break;
+                }
+                group_code = atoi (temp_string);
+        }
+        /* The last group has to end where it ended while reading,
+         * otherwise the file was changed in between. */
+        if ((status == EXIT_SUCCESS)
+          && (ftello (source.fp) != range->end))
+        {
+                status = EXIT_FAILURE;
+        }
+        fclose (source.fp);
+        if ((status == EXIT_FAILURE)
+          || (number_of_groups != range->number_of_groups))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () found %d of %d proprietary data groups in: %s in line: %d, the file may have changed.\n")),
+                  __FUNCTION__, number_of_groups, range->number_of_groups,
+                  range->filename, source.line_number);
+                dxf_proprietary_data_range_unload (data, first_last, first_unused, new_data);
+                dxf_proprietary_data_range_unload (additional_data, first_additional_last, first_additional_unused, new_additional_data);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for the recorded location of
+ * proprietary data.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_proprietary_data_range_free
+(
+        DxfProprietaryDataRange *range
+                /*!< a pointer to the recorded location. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (range == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (range->filename);
+        dxf_free (range);
+        range = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /* EOF */
@@ -66,6 +66,34 @@ dxf_proprietary_data_struct
 } DxfProprietaryData;
 
 
+/*!
+ * \brief Location of the proprietary data (group codes 1 and 3) of an
+ * entity in the file it was read from.
+ *
+ * Recorded in place of the data when the \c lazy_proprietary_data
+ * member of the \c DxfFile is set, the data is loaded from the file on
+ * first access.
+ */
+typedef struct
+dxf_proprietary_data_range_struct
+{
+        char *filename;
+                /*!< Name of the file the entity was read from. */
+        off_t offset;
+                /*!< File offset following the first group code. */
+        off_t end;
+                /*!< File offset following the value of the last group. */
+        int first_group_code;
+                /*!< Group code of the first group, 1 or 3. */
+        int line_number;
+                /*!< Line number of the value of the first group. */
+        int number_of_groups;
+                /*!< Number of groups in the range. */
+        int end_line_number;
+                /*!< Line number of the value of the last group. */
+} DxfProprietaryDataRange;
+
+
 DxfProprietaryData *
 dxf_proprietary_data_new ();
 DxfProprietaryData *
@@ -132,6 +160,39 @@ dxf_proprietary_data_test_length
 (
         DxfProprietaryData *data
 );
+DxfProprietaryData *
+dxf_proprietary_data_read_line
+(
+        DxfFile *fp,
+        DxfProprietaryData *data,
+        int order
+);
+int
+dxf_proprietary_data_write_chains
+(
+        DxfFile *fp,
+        DxfProprietaryData *data,
+        DxfProprietaryData *additional_data
+);
+int
+dxf_proprietary_data_range_skip
+(
+        DxfFile *fp,
+        DxfProprietaryDataRange **range,
+        int group_code
+);
+int
+dxf_proprietary_data_range_load
+(
+        DxfProprietaryDataRange *range,
+        DxfProprietaryData **data,
+        DxfProprietaryData **additional_data
+);
+int
+dxf_proprietary_data_range_free
+(
+        DxfProprietaryDataRange *range
+);
 
 
 #ifdef __cplusplus
@@ -35,6 +35,7 @@
 
 
 #include "rastervariables.h"
+#include "util.h"
 
 
 /*!
@@ -60,9 +61,9 @@ dxf_rastervariables_new ()
         size = sizeof (DxfRasterVariables);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((rastervariables = malloc (size)) == NULL)
+        if ((rastervariables = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfRasterVariables struct.\n")),
                   __FUNCTION__);
                 rastervariables = NULL;
@@ -104,21 +105,21 @@ dxf_rastervariables_init
         /* Do some basic checks. */
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 rastervariables = dxf_rastervariables_new ();
         }
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfRasterVariables struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         rastervariables->id_code = 0;
-        rastervariables->dictionary_owner_soft = strdup ("");
-        rastervariables->dictionary_owner_hard = strdup ("");
+        rastervariables->dictionary_owner_soft = dxf_strdup ("");
+        rastervariables->dictionary_owner_hard = dxf_strdup ("");
         rastervariables->display_image_frame = 0;
         rastervariables->display_quality = 0;
         rastervariables->units = 0;
@@ -160,28 +161,26 @@ dxf_rastervariables_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 rastervariables = dxf_rastervariables_new ();
@@ -189,16 +188,15 @@ dxf_rastervariables_read
         }
         i = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -209,21 +207,21 @@ dxf_rastervariables_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", &rastervariables->id_code);
                 }
-                if (strcmp (temp_string, "70") == 0)
+                else if (strcmp (temp_string, "70") == 0)
                 {
                         /* Now follows a string containing a display
                          * image frame flag value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &rastervariables->display_image_frame);
                 }
-                if (strcmp (temp_string, "71") == 0)
+                else if (strcmp (temp_string, "71") == 0)
                 {
                         /* Now follows a string containing a display
                          * quality flag value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &rastervariables->display_quality);
                 }
-                if (strcmp (temp_string, "72") == 0)
+                else if (strcmp (temp_string, "72") == 0)
                 {
                         /* Now follows a string containing a units
                          * value. */
@@ -246,7 +244,7 @@ dxf_rastervariables_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbIdBuffer") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -256,7 +254,7 @@ dxf_rastervariables_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", rastervariables->dictionary_owner_soft);
+                        dxf_read_string (fp, &rastervariables->dictionary_owner_soft);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
@@ -264,7 +262,7 @@ dxf_rastervariables_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", rastervariables->dictionary_owner_hard);
+                        dxf_read_string (fp, &rastervariables->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -275,13 +273,17 @@ dxf_rastervariables_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -313,30 +315,30 @@ dxf_rastervariables_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("RASTERVARIABLES");
+        char *dxf_entity_name = dxf_strdup ("RASTERVARIABLES");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, rastervariables->id_code);
         }
@@ -379,7 +381,7 @@ dxf_rastervariables_write
         fprintf (fp->fp, " 71\n%d\n", rastervariables->display_quality);
         fprintf (fp->fp, " 72\n%d\n", rastervariables->units);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -414,14 +416,14 @@ dxf_rastervariables_free
         /* Do some basic checks. */
         if (rastervariables->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfRasterVariables was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (rastervariables->dictionary_owner_soft);
-        free (rastervariables->dictionary_owner_hard);
-        free (rastervariables);
+        dxf_free (rastervariables->dictionary_owner_soft);
+        dxf_free (rastervariables->dictionary_owner_hard);
+        dxf_free (rastervariables);
         rastervariables = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -448,18 +450,19 @@ dxf_rastervariables_free_chain
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (rastervariables != NULL)
         {
                 struct DxfRasterVariables *iter = rastervariables->next;
+                rastervariables->next = NULL;
                 dxf_rastervariables_free (rastervariables);
                 rastervariables = (DxfRasterVariables *) iter;
         }
@@ -0,0 +1,807 @@
+/*!
+ * \file raw_data.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF pass-through of DXF data which is not
+ * modeled, as byte ranges of the file it was read from.
+ *
+ * Entities of types libDXF does not model (\c MESH, \c MLEADER,
+ * \c SURFACE, \c WIPEOUT, \c UNDERLAY, ...) and sections which are
+ * not parsed are not converted while reading, only the location of
+ * their groups in the file is recorded.\n
+ * When the data is written the file is mapped into memory and the
+ * bytes are copied from the mapping as they were read, without
+ * formatting them again.\n
+ * The file has to stay unchanged until the data is written, this is
+ * checked against the size and modification time of the file, a file
+ * has never to be overwritten by output containing data read from it.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "raw_data.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+/*!
+ * \brief Get the raw data source of the file which is being read.
+ *
+ * The source is created on first use, the \c DxfFile holds a
+ * reference which is released by \c dxf_read_close ().\n
+ * Only regular files can be a source.
+ *
+ * \return a pointer to the source, the reference of the \c DxfFile is
+ * not passed on, or \c NULL when an error occurred.
+ */
+DxfRawSource *
+dxf_raw_source_get
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRawSource *source;
+        struct stat status;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (fp->fp == NULL) || (fp->filename == NULL))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (fp->raw_source != NULL)
+        {
+                return ((DxfRawSource *) fp->raw_source);
+        }
+        if ((fstat (fileno (fp->fp), &status) != 0)
+          || (!S_ISREG (status.st_mode)))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () %s is not a regular file, its data can not be passed through.\n")),
+                  __FUNCTION__, fp->filename);
+                return (NULL);
+        }
+        source = dxf_malloc (sizeof (DxfRawSource));
+        if (source == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfRawSource struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (source, 0, sizeof (DxfRawSource));
+        source->filename = dxf_strdup (fp->filename);
+        source->size = status.st_size;
+        source->modification_time = status.st_mtime;
+        source->reference_count = 1;
+        pthread_mutex_init (&source->mutex, NULL);
+        fp->raw_source = (struct DxfRawSource *) source;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (source);
+}
+
+
+/*!
+ * \brief Add a reference to a raw data source.
+ *
+ * \return a pointer to the source.
+ */
+DxfRawSource *
+dxf_raw_source_ref
+(
+        DxfRawSource *source
+                /*!< a pointer to the source. */
+)
+{
+        if (source != NULL)
+        {
+                __sync_fetch_and_add (&source->reference_count, 1);
+        }
+        return (source);
+}
+
+
+/*!
+ * \brief Release a reference to a raw data source, the source is freed
+ * with the last reference.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_raw_source_unref
+(
+        DxfRawSource *source
+                /*!< a pointer to the source. */
+)
+{
+        if (source == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (__sync_sub_and_fetch (&source->reference_count, 1) > 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (source->map != NULL)
+        {
+                munmap (source->map, source->map_size);
+        }
+        pthread_mutex_destroy (&source->mutex);
+        dxf_free (source->filename);
+        dxf_free (source);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Map a raw data source into memory, once.
+ *
+ * \return a pointer to the mapping, or \c NULL when the file could not
+ * be mapped or was changed after it was read.
+ */
+static const char *
+dxf_raw_source_map
+(
+        DxfRawSource *source
+                /*!< a pointer to the source. */
+)
+{
+        struct stat status;
+        void *map;
+        int fd;
+
+        pthread_mutex_lock (&source->mutex);
+        if (source->map == NULL)
+        {
+                fd = open (source->filename, O_RDONLY);
+                if ((fd < 0) || (fstat (fd, &status) != 0))
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not open file: %s for reading.\n")),
+                          __FUNCTION__, source->filename);
+                }
+                else if ((status.st_size != source->size)
+                  || (status.st_mtime != source->modification_time)
+                  || (status.st_size == 0))
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () %s was changed after it was read.\n")),
+                          __FUNCTION__, source->filename);
+                }
+                else
+                {
+                        map = mmap (NULL, (size_t) status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                        if (map == MAP_FAILED)
+                        {
+                                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                                  (_("Error in %s () could not map file: %s into memory.\n")),
+                                  __FUNCTION__, source->filename);
+                        }
+                        else
+                        {
+                                source->map = (char *) map;
+                                source->map_size = (size_t) status.st_size;
+                        }
+                }
+                if (fd >= 0)
+                {
+                        close (fd);
+                }
+        }
+        pthread_mutex_unlock (&source->mutex);
+        return (source->map);
+}
+
+
+/*!
+ * \brief Read a line from a DXF file, counting the bytes consumed.
+ *
+ * The line number of \c fp is incremented, the line is stored without
+ * its line end and truncated to \c DXF_MAX_STRING_LENGTH - 1
+ * characters.
+ *
+ * \return the number of bytes consumed, including the line end, or -1
+ * at the end of the file.
+ */
+off_t
+dxf_raw_read_line
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        char *line
+                /*!< the line, at least \c DXF_MAX_STRING_LENGTH
+                 * characters. */
+)
+{
+        char rest[DXF_MAX_STRING_LENGTH];
+        size_t length;
+        off_t consumed;
+
+        if (fgets (line, DXF_MAX_STRING_LENGTH, fp->fp) == NULL)
+        {
+                return (-1);
+        }
+        fp->line_number++;
+        length = strlen (line);
+        consumed = (off_t) length;
+        /* Skip what does not fit. */
+        while ((length > 0) && (line[length - 1] != '\n')
+          && (fgets (rest, sizeof (rest), fp->fp) != NULL))
+        {
+                consumed += (off_t) strlen (rest);
+                if (rest[strlen (rest) - 1] == '\n')
+                {
+                        break;
+                }
+        }
+        while ((length > 0)
+          && ((line[length - 1] == '\n') || (line[length - 1] == '\r')))
+        {
+                line[--length] = '\0';
+        }
+        return (consumed);
+}
+
+
+/*!
+ * \brief Start recording a range at the current position of a DXF
+ * file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_raw_range_begin
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfRawRange *range
+                /*!< the range, its \c end is the \c offset until
+                 * bytes are added. */
+)
+{
+        DxfRawSource *source;
+        int c;
+
+        if (range == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((source = dxf_raw_source_get (fp)) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        /* The readers of values leave the line end behind. */
+        c = getc (fp->fp);
+        if ((c != '\n') && (c != EOF))
+        {
+                ungetc (c, fp->fp);
+        }
+        range->offset = ftello (fp->fp);
+        if (range->offset < 0)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the position in: %s could not be recorded.\n")),
+                  __FUNCTION__, fp->filename);
+                return (EXIT_FAILURE);
+        }
+        range->source = dxf_raw_source_ref (source);
+        range->end = range->offset;
+        range->line_number = fp->line_number + 1;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Copy a range, the copy holds its own reference to the source.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_raw_range_copy
+(
+        DxfRawRange *range,
+                /*!< the range. */
+        DxfRawRange *copy
+                /*!< the copy. */
+)
+{
+        if ((range == NULL) || (copy == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        *copy = *range;
+        dxf_raw_source_ref (copy->source);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the bytes of a range, as they were read.
+ *
+ * The source of the range is mapped into memory when needed.
+ *
+ * \return a pointer to the first byte of the range in the mapping, or
+ * \c NULL when an error occurred.
+ */
+const char *
+dxf_raw_range_get_data
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device), used
+                 * for diagnostics. */
+        DxfRawRange *range
+                /*!< the range. */
+)
+{
+        const char *map;
+
+        /* Do some basic checks. */
+        if (range == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((range->source == NULL)
+          || ((map = dxf_raw_source_map (range->source)) == NULL))
+        {
+                return (NULL);
+        }
+        if ((range->offset < 0)
+          || (range->end < range->offset)
+          || ((size_t) range->end > range->source->map_size))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the range is outside of: %s.\n")),
+                  __FUNCTION__, range->source->filename);
+                return (NULL);
+        }
+        return (map + range->offset);
+}
+
+
+/*!
+ * \brief Write the bytes of a range, as they were read.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_raw_range_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfRawRange *range
+                /*!< the range. */
+)
+{
+        const char *data;
+        size_t length;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (range == NULL))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (range->end == range->offset)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if ((data = dxf_raw_range_get_data (fp, range)) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        length = (size_t) (range->end - range->offset);
+        if (fwrite (data, 1, length, fp->fp) != length)
+        {
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Release the reference of a range to its source.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_raw_range_release
+(
+        DxfRawRange *range
+                /*!< the range. */
+)
+{
+        if (range == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (range->source != NULL)
+        {
+                dxf_raw_source_unref (range->source);
+                range->source = NULL;
+        }
+        range->end = range->offset;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a \c DxfRawSection.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfRawSection *
+dxf_raw_section_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRawSection *section = NULL;
+        size_t size;
+
+        size = sizeof (DxfRawSection);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((section = dxf_malloc (size)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfRawSection struct.\n")),
+                  __FUNCTION__);
+                section = NULL;
+        }
+        else
+        {
+                memset (section, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (section);
+}
+
+
+/*!
+ * \brief Record a section as it is in the file.
+ *
+ * The \c SECTION marker and the name of the section (group code 2)
+ * have been read by the caller, the groups are skipped up to and
+ * including the \c ENDSEC marker.\n
+ * Of a \c HEADER section the values of \c $ACADVER and \c $HANDSEED
+ * are kept, \c $HANDSEED is updated by
+ * \c dxf_raw_section_write_header ().
+ *
+ * \return a pointer to the section, or \c NULL when an error occurred.
+ */
+DxfRawSection *
+dxf_raw_section_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        const char *section_name
+                /*!< name of the section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRawSection *section;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        char **variable = NULL;
+        off_t code_length;
+        off_t value_length;
+        int is_header;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (section_name == NULL))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((section = dxf_raw_section_new ()) == NULL)
+        {
+                return (NULL);
+        }
+        if (dxf_raw_range_begin (fp, &section->range) != EXIT_SUCCESS)
+        {
+                dxf_free (section);
+                return (NULL);
+        }
+        section->section_name = dxf_strdup (section_name);
+        section->acad_version_number = fp->acad_version_number;
+        is_header = (strcmp (section_name, "HEADER") == 0);
+        for (;;)
+        {
+                if (((code_length = dxf_raw_read_line (fp, code)) < 0)
+                  || ((value_length = dxf_raw_read_line (fp, value)) < 0))
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () unexpected end of file: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        dxf_raw_section_free (section);
+                        return (NULL);
+                }
+                if (variable != NULL)
+                {
+                        if (variable == &section->hand_seed)
+                        {
+                                section->hand_seed_offset = section->range.end + code_length;
+                        }
+                        dxf_free (*variable);
+                        *variable = dxf_strdup (value);
+                        variable = NULL;
+                }
+                else if ((is_header) && (atoi (code) == 9))
+                {
+                        if (strcmp (value, "$ACADVER") == 0)
+                        {
+                                variable = &section->acad_version;
+                        }
+                        else if (strcmp (value, "$HANDSEED") == 0)
+                        {
+                                variable = &section->hand_seed;
+                        }
+                }
+                section->range.end += code_length + value_length;
+                if ((atoi (code) == 0)
+                  && (strcmp (value, "ENDSEC") == 0))
+                {
+                        break;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (section);
+}
+
+
+/*!
+ * \brief Write a section as it was read.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_raw_section_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfRawSection *section
+                /*!< a pointer to the section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (section == NULL))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp->fp, "  0\nSECTION\n  2\n%s\n", section->section_name);
+        result = dxf_raw_range_write (fp, &section->range);
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not copy the %s section.\n")),
+                  __FUNCTION__, section->section_name);
+                /* Keep the file readable. */
+                fprintf (fp->fp, "  0\nENDSEC\n");
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Write a \c HEADER section as it was read, with \c next_handle
+ * as the value of \c $HANDSEED.
+ *
+ * The other header variables are copied byte for byte, when
+ * \c $HANDSEED already has the value \c next_handle, or the section has
+ * no \c $HANDSEED, the whole section is.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_raw_section_write_header
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfRawSection *section,
+                /*!< a pointer to the section. */
+        int next_handle
+                /*!< the next free handle. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *data;
+        size_t before;
+        size_t after;
+        size_t length;
+        int result = EXIT_FAILURE;
+
+        /* Do some basic checks. */
+        if ((fp == NULL) || (section == NULL))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((section->hand_seed == NULL)
+          || (strtol (section->hand_seed, NULL, 16) == next_handle))
+        {
+                return (dxf_raw_section_write (fp, section));
+        }
+        fprintf (fp->fp, "  0\nSECTION\n  2\n%s\n", section->section_name);
+        data = dxf_raw_range_get_data (fp, &section->range);
+        if (data != NULL)
+        {
+                before = (size_t) (section->hand_seed_offset - section->range.offset);
+                after = before + strlen (section->hand_seed);
+                length = (size_t) (section->range.end - section->range.offset);
+                if ((fwrite (data, 1, before, fp->fp) == before)
+                  && (fprintf (fp->fp, "%X", next_handle) > 0)
+                  && (fwrite (data + after, 1, length - after, fp->fp) == length - after))
+                {
+                        result = EXIT_SUCCESS;
+                }
+        }
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not copy the %s section.\n")),
+                  __FUNCTION__, section->section_name);
+                /* Keep the file readable. */
+                fprintf (fp->fp, "  0\nENDSEC\n");
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a \c DxfRawSection.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_raw_section_free
+(
+        DxfRawSection *section
+                /*!< a pointer to the section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (section == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (section->next != NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () pointer to next DxfRawSection was not NULL.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_raw_range_release (&section->range);
+        dxf_free (section->section_name);
+        dxf_free (section->acad_version);
+        dxf_free (section->hand_seed);
+        dxf_free (section);
+        section = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a chain of \c DxfRawSection.
+ */
+void
+dxf_raw_section_free_chain
+(
+        DxfRawSection *sections
+                /*!< a pointer to the chain of sections. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRawSection *next;
+
+        while (sections != NULL)
+        {
+                next = (DxfRawSection *) sections->next;
+                sections->next = NULL;
+                dxf_raw_section_free (sections);
+                sections = next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+}
+
+
+/* EOF */
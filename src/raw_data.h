@@ -0,0 +1,149 @@
+/*!
+ * \file raw_data.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF pass-through of DXF data which is not
+ * modeled, as byte ranges of the file it was read from.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_RAW_DATA_H
+#define LIBDXF_SRC_RAW_DATA_H
+
+
+#include "global.h"
+#include <pthread.h>
+#include <sys/types.h>
+#include <time.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief A DXF file raw data was read from.
+ *
+ * Shared by all raw data read from the file, the file is mapped into
+ * memory when the raw data is written for the first time and stays
+ * mapped until the last reference is released.
+ */
+typedef struct
+dxf_raw_source_struct
+{
+        char *filename;
+                /*!< Name of the file. */
+        off_t size;
+                /*!< Size of the file while it was read. */
+        time_t modification_time;
+                /*!< Modification time of the file while it was read. */
+        int reference_count;
+                /*!< Number of references to the source. */
+        char *map;
+                /*!< Memory mapping of the file, or \c NULL when not
+                 * mapped yet. */
+        size_t map_size;
+                /*!< Size of \c map in bytes. */
+        pthread_mutex_t mutex;
+                /*!< Serializes the mapping of the file. */
+} DxfRawSource;
+
+
+/*!
+ * \brief A range of bytes in a DXF file.
+ */
+typedef struct
+dxf_raw_range_struct
+{
+        DxfRawSource *source;
+                /*!< The file, a reference is held by the range. */
+        off_t offset;
+                /*!< File offset of the first byte. */
+        off_t end;
+                /*!< File offset following the last byte. */
+        int line_number;
+                /*!< Line number of the first line. */
+} DxfRawRange;
+
+
+/*!
+ * \brief A section kept as it was read.
+ */
+typedef struct
+dxf_raw_section_struct
+{
+        char *section_name;
+                /*!< Name of the section (group code 2). */
+        DxfRawRange range;
+                /*!< The groups of the section following its name, up to
+                 * and including the \c ENDSEC marker. */
+        int acad_version_number;
+                /*!< AutoCAD version of the file the section was read
+                 * from. */
+        char *acad_version;
+                /*!< Value of the \c $ACADVER variable of a \c HEADER
+                 * section, or \c NULL. */
+        char *hand_seed;
+                /*!< Value of the \c $HANDSEED variable of a \c HEADER
+                 * section, or \c NULL. */
+        off_t hand_seed_offset;
+                /*!< File offset of the value of \c hand_seed. */
+        struct DxfRawSection *next;
+                /*!< Pointer to the next DxfRawSection.\n
+                 * \c NULL if the last DxfRawSection. */
+} DxfRawSection;
+
+
+DxfRawSource *dxf_raw_source_get (DxfFile *fp);
+DxfRawSource *dxf_raw_source_ref (DxfRawSource *source);
+int dxf_raw_source_unref (DxfRawSource *source);
+off_t dxf_raw_read_line (DxfFile *fp, char *line);
+int dxf_raw_range_begin (DxfFile *fp, DxfRawRange *range);
+int dxf_raw_range_copy (DxfRawRange *range, DxfRawRange *copy);
+const char *dxf_raw_range_get_data (DxfFile *fp, DxfRawRange *range);
+int dxf_raw_range_write (DxfFile *fp, DxfRawRange *range);
+int dxf_raw_range_release (DxfRawRange *range);
+DxfRawSection *dxf_raw_section_new ();
+DxfRawSection *dxf_raw_section_read (DxfFile *fp, const char *section_name);
+int dxf_raw_section_write (DxfFile *fp, DxfRawSection *section);
+int dxf_raw_section_write_header (DxfFile *fp, DxfRawSection *section, int next_handle);
+int dxf_raw_section_free (DxfRawSection *section);
+void dxf_raw_section_free_chain (DxfRawSection *sections);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_RAW_DATA_H */
+
+
+/* EOF */
@@ -0,0 +1,584 @@
+/*!
+ * \file raw_entity.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a libDXF entity of a type which is not modeled,
+ * passed through as it was read.
+ *
+ * Reading an entity of a type without a module of its own into a
+ * \c DxfRawEntity keeps it in the drawing, instead of dropping it.\n
+ * \c dxf_file_load () reads the entities of unknown types this way,
+ * usage in a read loop, after the name of the entity was read:
+ * <pre>
+ * raw_entity = dxf_raw_entity_init (dxf_raw_entity_new ());
+ * dxf_raw_entity_set_entity_name (raw_entity, name);
+ * dxf_raw_entity_read (fp, raw_entity);
+ * dxf_entities_append (entities, raw_entity);
+ * </pre>
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "raw_entity.h"
+
+
+/*!
+ * \brief Allocate memory for a \c DxfRawEntity.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfRawEntity *
+dxf_raw_entity_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRawEntity *raw_entity = NULL;
+        size_t size;
+
+        size = sizeof (DxfRawEntity);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((raw_entity = dxf_malloc (size)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfRawEntity struct.\n")),
+                  __FUNCTION__);
+                raw_entity = NULL;
+        }
+        else
+        {
+                memset (raw_entity, 0, size);
+                raw_entity->header.type = UNKNOWN_ENTITY;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (raw_entity);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a
+ * \c DxfRawEntity.
+ * 
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when succesful.
+ */
+DxfRawEntity *
+dxf_raw_entity_init
+(
+        DxfRawEntity *raw_entity
+                /*!< a pointer to the DXF raw entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (raw_entity == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                raw_entity = dxf_raw_entity_new ();
+        }
+        if (raw_entity == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfRawEntity struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        raw_entity->entity_name = dxf_strdup ("");
+        raw_entity->id_code = 0;
+        raw_entity->layer = dxf_strdup (DXF_DEFAULT_LAYER);
+        raw_entity->color = DXF_COLOR_BYLAYER;
+        raw_entity->id_code_offset = -1;
+        raw_entity->layer_offset = -1;
+        raw_entity->next = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (raw_entity);
+}
+
+
+/*!
+ * \brief Read data from a DXF file into a DXF raw entity.
+ *
+ * The name of the entity has been read by the caller, the location of
+ * the groups following it is recorded up to the next \c 0 group, which
+ * is consumed as by the readers of the other entities.\n
+ * The handle (group code 5), layer (group code 8) and color (group
+ * code 62) are decoded.
+ *
+ * \return a pointer to \c raw_entity, or \c NULL when an error
+ * occurred.
+ */
+DxfRawEntity *
+dxf_raw_entity_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfRawEntity *raw_entity
+                /*!< a pointer to the DXF raw entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        off_t code_length;
+        off_t value_length;
+        char *end;
+        long group_code;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (raw_entity == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                raw_entity = dxf_raw_entity_init (dxf_raw_entity_new ());
+                if (raw_entity == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        if (dxf_raw_range_begin (fp, &raw_entity->range) != EXIT_SUCCESS)
+        {
+                return (NULL);
+        }
+        raw_entity->id_code_offset = -1;
+        raw_entity->layer_offset = -1;
+        for (;;)
+        {
+                if ((code_length = dxf_raw_read_line (fp, code)) < 0)
+                {
+                        break;
+                }
+                group_code = strtol (code, &end, 10);
+                if ((group_code == 0) && (end != code))
+                {
+                        /* Leave the line end of the 0 group for the
+                         * reader of the name of the next entity. */
+                        ungetc ('\n', fp->fp);
+                        break;
+                }
+                if ((value_length = dxf_raw_read_line (fp, value)) < 0)
+                {
+                        break;
+                }
+                if (group_code == 5)
+                {
+                        sscanf (value, "%x", &raw_entity->id_code);
+                        raw_entity->id_code_offset = raw_entity->range.end + code_length;
+                        raw_entity->id_code_length = strlen (value);
+                }
+                else if (group_code == 8)
+                {
+                        dxf_free (raw_entity->layer);
+                        raw_entity->layer = dxf_strdup (value);
+                        raw_entity->layer_offset = raw_entity->range.end + code_length;
+                        raw_entity->layer_length = strlen (value);
+                }
+                else if (group_code == 62)
+                {
+                        raw_entity->color = atoi (value);
+                }
+                raw_entity->range.end += code_length + value_length;
+        }
+        if (ferror (fp->fp) || feof (fp->fp))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (raw_entity);
+}
+
+
+/*!
+ * \brief Write the groups of a DXF raw entity, with the values of the
+ * handle (group code 5) and the layer (group code 8) taken from the
+ * \c id_code and \c layer members.
+ *
+ * A value which was not changed is copied as it was read.
+ * A handle or a layer which was set on an entity read without the
+ * group is written in front of the other groups.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_raw_entity_write_groups
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfRawEntity *raw_entity
+                /*!< a pointer to the DXF raw entity. */
+)
+{
+        const char *data;
+        const char *layer;
+        char id_code[DXF_MAX_STRING_LENGTH];
+        off_t offset[2];
+        size_t length[2];
+        const char *value[2];
+        off_t position;
+        size_t i;
+        size_t number_of_values = 0;
+
+        layer = (raw_entity->layer == NULL) ? "" : raw_entity->layer;
+        snprintf (id_code, sizeof (id_code), "%x", raw_entity->id_code);
+        if ((raw_entity->id_code_offset < 0) && (raw_entity->id_code != 0))
+        {
+                fprintf (fp->fp, "  5\n%s\n", id_code);
+        }
+        if ((raw_entity->layer_offset < 0)
+          && (strcmp (layer, DXF_DEFAULT_LAYER) != 0))
+        {
+                fprintf (fp->fp, "  8\n%s\n", layer);
+        }
+        if ((raw_entity->id_code_offset < 0)
+          && (raw_entity->layer_offset < 0))
+        {
+                return (dxf_raw_range_write (fp, &raw_entity->range));
+        }
+        if ((data = dxf_raw_range_get_data (fp, &raw_entity->range)) == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        /* Collect the values to replace in file order. */
+        if ((raw_entity->id_code_offset >= 0)
+          && (strtol (data + (raw_entity->id_code_offset - raw_entity->range.offset), NULL, 16)
+            != raw_entity->id_code))
+        {
+                offset[number_of_values] = raw_entity->id_code_offset;
+                length[number_of_values] = raw_entity->id_code_length;
+                value[number_of_values] = id_code;
+                number_of_values++;
+        }
+        if ((raw_entity->layer_offset >= 0)
+          && ((strlen (layer) != raw_entity->layer_length)
+            || (memcmp (data + (raw_entity->layer_offset - raw_entity->range.offset),
+              layer, raw_entity->layer_length) != 0)))
+        {
+                offset[number_of_values] = raw_entity->layer_offset;
+                length[number_of_values] = raw_entity->layer_length;
+                value[number_of_values] = layer;
+                if ((number_of_values == 1) && (offset[0] > offset[1]))
+                {
+                        offset[1] = offset[0];
+                        length[1] = length[0];
+                        value[1] = value[0];
+                        offset[0] = raw_entity->layer_offset;
+                        length[0] = raw_entity->layer_length;
+                        value[0] = layer;
+                }
+                number_of_values++;
+        }
+        position = raw_entity->range.offset;
+        for (i = 0; i < number_of_values; i++)
+        {
+                fwrite (data + (position - raw_entity->range.offset), 1,
+                  (size_t) (offset[i] - position), fp->fp);
+                fputs (value[i], fp->fp);
+                position = offset[i] + (off_t) length[i];
+        }
+        if (fwrite (data + (position - raw_entity->range.offset), 1,
+          (size_t) (raw_entity->range.end - position), fp->fp)
+          != (size_t) (raw_entity->range.end - position))
+        {
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write DXF output for a DXF raw entity, as it was read.
+ *
+ * A changed handle or layer is written from the \c id_code and
+ * \c layer members, see \c dxf_raw_entity_write_groups ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_raw_entity_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfRawEntity *raw_entity
+                /*!< a pointer to the DXF raw entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (raw_entity == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((raw_entity->entity_name == NULL)
+          || (strcmp (raw_entity->entity_name, "") == 0))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the raw entity with id-code: %x has no name.\n")),
+                  __FUNCTION__, raw_entity->id_code);
+                return (EXIT_FAILURE);
+        }
+        fprintf (fp->fp, "  0\n%s\n", raw_entity->entity_name);
+        if (dxf_raw_entity_write_groups (fp, raw_entity) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not copy the %s entity with id-code: %x.\n")),
+                  __FUNCTION__, raw_entity->entity_name, raw_entity->id_code);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF raw entity and all it's
+ * data fields.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_raw_entity_free
+(
+        DxfRawEntity *raw_entity
+                /*!< a pointer to the DXF raw entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (raw_entity == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (raw_entity->next != NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () pointer to next DxfRawEntity was not NULL.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_raw_range_release (&raw_entity->range);
+        dxf_free (raw_entity->entity_name);
+        dxf_free (raw_entity->layer);
+        dxf_free (raw_entity);
+        raw_entity = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a chain of DXF raw entities and
+ * all their data fields.
+ */
+void
+dxf_raw_entity_free_chain
+(
+        DxfRawEntity *raw_entities
+                /*!< a pointer to the chain of DXF raw entities. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRawEntity *next;
+
+        while (raw_entities != NULL)
+        {
+                next = (DxfRawEntity *) raw_entities->next;
+                raw_entities->next = NULL;
+                dxf_raw_entity_free (raw_entities);
+                raw_entities = next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+}
+
+
+/*!
+ * \brief Make a copy of a DXF raw entity, without the entities
+ * following it, the copy refers to the same bytes of the same file.
+ *
+ * \return a pointer to the copy, or \c NULL when an error occurred.
+ */
+DxfRawEntity *
+dxf_raw_entity_clone
+(
+        DxfRawEntity *raw_entity
+                /*!< a pointer to the DXF raw entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRawEntity *clone;
+
+        /* Do some basic checks. */
+        if (raw_entity == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((clone = dxf_raw_entity_new ()) == NULL)
+        {
+                return (NULL);
+        }
+        *clone = *raw_entity;
+        clone->entity_name = dxf_strdup (raw_entity->entity_name);
+        clone->layer = dxf_strdup (raw_entity->layer);
+        clone->next = NULL;
+        dxf_raw_range_copy (&raw_entity->range, &clone->range);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (clone);
+}
+
+
+/*!
+ * \brief Get the name of the entity type of a DXF raw entity.
+ *
+ * \return a pointer to the name, owned by the raw entity, or \c NULL
+ * when an error occurred.
+ */
+char *
+dxf_raw_entity_get_entity_name
+(
+        DxfRawEntity *raw_entity
+                /*!< a pointer to the DXF raw entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (raw_entity == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (raw_entity->entity_name == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (raw_entity->entity_name);
+}
+
+
+/*!
+ * \brief Set the name of the entity type of a DXF raw entity.
+ *
+ * \return a pointer to \c raw_entity when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfRawEntity *
+dxf_raw_entity_set_entity_name
+(
+        DxfRawEntity *raw_entity,
+                /*!< a pointer to the DXF raw entity. */
+        char *entity_name
+                /*!< the name of the entity type. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((raw_entity == NULL) || (entity_name == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_free (raw_entity->entity_name);
+        raw_entity->entity_name = dxf_strdup (entity_name);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (raw_entity);
+}
+
+
+/* EOF */
@@ -0,0 +1,116 @@
+/*!
+ * \file raw_entity.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for a libDXF entity of a type which is not
+ * modeled, passed through as it was read.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_RAW_ENTITY_H
+#define LIBDXF_SRC_RAW_ENTITY_H
+
+
+#include "global.h"
+#include "entity.h"
+#include "raw_data.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief DXF definition of an entity of a type which is not modeled.
+ *
+ * The type of its header is \c UNKNOWN_ENTITY.\n
+ * Only the handle, layer and color are decoded while reading, the
+ * groups of the entity are written as they were read, changes to the
+ * members are not written.
+ */
+typedef struct
+dxf_raw_entity_struct
+{
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity. */
+        char *entity_name;
+                /*!< Name of the entity type, as in the \c 0 group of
+                 * the entity. */
+        int id_code;
+                /*!< Identification number for the entity.\n
+                 * This is to be an unique (sequential) number in the DXF
+                 * file.\n
+                 * Group code = 5. */
+        char *layer;
+                /*!< Layer on which the entity is drawn.\n
+                 * Group code = 8. */
+        int color;
+                /*!< Color of the entity.\n
+                 * Group code = 62. */
+        DxfRawRange range;
+                /*!< The groups of the entity following its name. */
+        off_t id_code_offset;
+                /*!< File offset of the value of the handle group, -1
+                 * when the entity was read without a handle. */
+        size_t id_code_length;
+                /*!< Length of the value of the handle group, without
+                 * its line end. */
+        off_t layer_offset;
+                /*!< File offset of the value of the layer group, -1
+                 * when the entity was read without a layer. */
+        size_t layer_length;
+                /*!< Length of the value of the layer group, without its
+                 * line end. */
+        struct DxfRawEntity *next;
+                /*!< Pointer to the next DxfRawEntity.\n
+                 * \c NULL in the last DxfRawEntity. */
+} DxfRawEntity;
+
+
+DxfRawEntity *dxf_raw_entity_new ();
+DxfRawEntity *dxf_raw_entity_init (DxfRawEntity *raw_entity);
+DxfRawEntity *dxf_raw_entity_read (DxfFile *fp, DxfRawEntity *raw_entity);
+int dxf_raw_entity_write (DxfFile *fp, DxfRawEntity *raw_entity);
+int dxf_raw_entity_free (DxfRawEntity *raw_entity);
+void dxf_raw_entity_free_chain (DxfRawEntity *raw_entities);
+DxfRawEntity *dxf_raw_entity_clone (DxfRawEntity *raw_entity);
+char *dxf_raw_entity_get_entity_name (DxfRawEntity *raw_entity);
+DxfRawEntity *dxf_raw_entity_set_entity_name (DxfRawEntity *raw_entity, char *entity_name);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_RAW_ENTITY_H */
+
+
+/* EOF */
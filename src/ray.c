@@ -35,6 +35,7 @@
 
 
 #include "ray.h"
+#include "util.h"
 
 
 /*!
@@ -63,9 +64,9 @@ dxf_ray_new ()
         size = sizeof (DxfRay);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ray = malloc (size)) == NULL)
+        if ((ray = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfRay struct.\n")),
                   __FUNCTION__);
                 ray = NULL;
@@ -73,6 +74,7 @@ dxf_ray_new ()
         else
         {
                 memset (ray, 0, size);
+                ray->header.type = RAY;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -106,21 +108,21 @@ dxf_ray_init
         /* Do some basic checks. */
         if (ray == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ray = dxf_ray_new ();
         }
         if (ray == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfRay struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         ray->id_code = 0;
-        ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        ray->layer = strdup (DXF_DEFAULT_LAYER);
+        ray->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        ray->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         ray->x0 = 0.0;
         ray->y0 = 0.0;
         ray->z0 = 0.0;
@@ -133,8 +135,8 @@ dxf_ray_init
         ray->visibility = DXF_DEFAULT_VISIBILITY;
         ray->color = DXF_COLOR_BYLAYER;
         ray->paperspace = DXF_MODELSPACE;
-        ray->dictionary_owner_soft = strdup ("");
-        ray->dictionary_owner_hard = strdup ("");
+        ray->dictionary_owner_soft = dxf_strdup ("");
+        ray->dictionary_owner_hard = dxf_strdup ("");
         ray->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -173,38 +175,34 @@ dxf_ray_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ray == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ray = dxf_ray_new ();
                 ray = dxf_ray_init (ray);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -219,13 +217,13 @@ dxf_ray_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ray->linetype);
+                        dxf_read_string (fp, &ray->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ray->layer);
+                        dxf_read_string (fp, &ray->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -323,7 +321,7 @@ dxf_ray_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbRay") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -333,14 +331,14 @@ dxf_ray_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ray->dictionary_owner_soft);
+                        dxf_read_string (fp, &ray->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ray->dictionary_owner_hard);
+                        dxf_read_string (fp, &ray->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -351,22 +349,26 @@ dxf_ray_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ray->linetype, "") == 0)
         {
-                ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ray->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ray->layer, "") == 0)
         {
-                ray->layer = strdup (DXF_DEFAULT_LAYER);
+                ray->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -398,64 +400,64 @@ dxf_ray_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("RAY");
+        char *dxf_entity_name = dxf_strdup ("RAY");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ray == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((ray->x0 == ray->x1)
                 && (ray->y0 == ray->y1)
                 && (ray->z0 == ray->z1))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ray->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (ray->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ray->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                ray->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                ray->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (ray->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ray->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                ray->layer = strdup (DXF_DEFAULT_LAYER);
+                ray->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -504,7 +506,7 @@ dxf_ray_write
           && DXF_FLATLAND
           && (ray->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", ray->elevation);
+                dxf_write_real (fp, 38, ray->elevation);
         }
         if (ray->color != DXF_COLOR_BYLAYER)
         {
@@ -512,7 +514,7 @@ dxf_ray_write
         }
         if (ray->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", ray->linetype_scale);
+                dxf_write_real (fp, 48, ray->linetype_scale);
         }
         if (ray->visibility != 0)
         {
@@ -524,16 +526,16 @@ dxf_ray_write
         }
         if (ray->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", ray->thickness);
+                dxf_write_real (fp, 39, ray->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", ray->x0);
-        fprintf (fp->fp, " 20\n%f\n", ray->y0);
-        fprintf (fp->fp, " 30\n%f\n", ray->z0);
-        fprintf (fp->fp, " 11\n%f\n", ray->x1);
-        fprintf (fp->fp, " 21\n%f\n", ray->y1);
-        fprintf (fp->fp, " 31\n%f\n", ray->z1);
+        dxf_write_real (fp, 10, ray->x0);
+        dxf_write_real (fp, 20, ray->y0);
+        dxf_write_real (fp, 30, ray->z0);
+        dxf_write_real (fp, 11, ray->x1);
+        dxf_write_real (fp, 21, ray->y1);
+        dxf_write_real (fp, 31, ray->z1);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -567,16 +569,16 @@ dxf_ray_free
 #endif
         if (ray->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfRay was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ray->linetype);
-        free (ray->layer);
-        free (ray->dictionary_owner_soft);
-        free (ray->dictionary_owner_hard);
-        free (ray);
+        dxf_free (ray->linetype);
+        dxf_free (ray->layer);
+        dxf_free (ray->dictionary_owner_soft);
+        dxf_free (ray->dictionary_owner_hard);
+        dxf_free (ray);
         ray = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -602,18 +604,19 @@ dxf_ray_free_chain
                 /*!< a pointer to the chain of DXF \c RAY entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (rays == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (rays != NULL)
         {
                 struct DxfRay *iter = rays->next;
+                rays->next = NULL;
                 dxf_ray_free (rays);
                 rays = (DxfRay *) iter;
         }
@@ -33,6 +33,7 @@
 
 
 #include "region.h"
+#include "util.h"
 
 
 /*!
@@ -58,9 +59,9 @@ dxf_region_new ()
         size = sizeof (DxfRegion);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((region = malloc (size)) == NULL)
+        if ((region = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfRegion struct.\n")),
                   __FUNCTION__);
                 region = NULL;
@@ -68,6 +69,7 @@ dxf_region_new ()
         else
         {
                 memset (region, 0, size);
+                region->header.type = REGION;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -99,27 +101,25 @@ dxf_region_init
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (region == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 region = dxf_region_new ();
         }
         if (region == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfRegion struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         region->modeler_format_version_number = 0;
         region->id_code = 0;
-        region->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        region->layer = strdup (DXF_DEFAULT_LAYER);
+        region->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        region->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         region->elevation = 0.0;
         region->thickness = 0.0;
         region->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
@@ -127,13 +127,10 @@ dxf_region_init
         region->color = DXF_COLOR_BYLAYER;
         region->paperspace = DXF_MODELSPACE;
         region->modeler_format_version_number = 1;
-        for (i = 0; i < DXF_MAX_PARAM; i++)
-        {
-                region->proprietary_data[i] = strdup ("");
-                region->additional_proprietary_data[i] = strdup ("");
-        }
-        region->dictionary_owner_soft = strdup ("");
-        region->dictionary_owner_hard = strdup ("");
+        region->proprietary_data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+        region->additional_proprietary_data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+        region->dictionary_owner_soft = dxf_strdup ("");
+        region->dictionary_owner_hard = dxf_strdup ("");
         region->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -172,61 +169,83 @@ dxf_region_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
+        DxfProprietaryData *proprietary_data = NULL;
+        DxfProprietaryData *additional_proprietary_data = NULL;
         int i;
-        int j;
 
-        i = 0;
-        j = 0;
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (region == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 region = dxf_region_new ();
                 region = dxf_region_init (region);
         }
+        if (region->proprietary_data == NULL)
+        {
+                region->proprietary_data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+        }
+        if (region->additional_proprietary_data == NULL)
+        {
+                region->additional_proprietary_data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+        }
+        proprietary_data = region->proprietary_data;
+        additional_proprietary_data = region->additional_proprietary_data;
+        i = 1;
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (REGION, fp);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
+                else if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing proprietary
                          * data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", region->proprietary_data[i]);
-                        i++;
+                        if (fp->lazy_proprietary_data)
+                        {
+                                dxf_proprietary_data_range_skip (fp, &region->proprietary_data_range, 1);
+                        }
+                        else
+                        {
+                                proprietary_data = dxf_proprietary_data_read_line (fp, proprietary_data, i);
+                                i++;
+                        }
                 }
-                else if (strcmp (temp_string, "  3") == 0)
+                else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing additional
                          * proprietary data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", region->additional_proprietary_data[j]);
-                        i++;
+                        if (fp->lazy_proprietary_data)
+                        {
+                                dxf_proprietary_data_range_skip (fp, &region->proprietary_data_range, 3);
+                        }
+                        else
+                        {
+                                additional_proprietary_data = dxf_proprietary_data_read_line (fp, additional_proprietary_data, i);
+                                i++;
+                        }
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -238,13 +257,13 @@ dxf_region_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", region->linetype);
+                        dxf_read_string (fp, &region->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", region->layer);
+                        dxf_read_string (fp, &region->layer);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
@@ -307,7 +326,7 @@ dxf_region_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
                         {
-                                fprintf (stderr, "Error in dxf_region_read () found a bad subclass marker in: %s in line: %d.\n",
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR, "Error in dxf_region_read () found a bad subclass marker in: %s in line: %d.\n",
                                         fp->filename, fp->line_number);
                         }
                 }
@@ -316,14 +335,14 @@ dxf_region_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", region->dictionary_owner_soft);
+                        dxf_read_string (fp, &region->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", region->dictionary_owner_hard);
+                        dxf_read_string (fp, &region->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -334,22 +353,27 @@ dxf_region_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (region->linetype, "") == 0)
         {
-                region->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_string_assign (&region->linetype, DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (region->layer, "") == 0)
         {
-                region->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_string_assign (&region->layer, DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
+        DXF_TRACING_ENTITY_END (REGION, fp, trace_offset);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -381,53 +405,52 @@ dxf_region_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("REGION");
-        int i;
+        char *dxf_entity_name = dxf_strdup ("REGION");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (region == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, region->id_code);
         }
         if (strcmp (region->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, region->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                region->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                region->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (region->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, region->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                region->layer = strdup (DXF_DEFAULT_LAYER);
+                region->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -476,7 +499,7 @@ dxf_region_write
           && DXF_FLATLAND
           && (region->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", region->elevation);
+                dxf_write_real (fp, 38, region->elevation);
         }
         if (region->color != DXF_COLOR_BYLAYER)
         {
@@ -484,7 +507,7 @@ dxf_region_write
         }
         if (region->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", region->linetype_scale);
+                dxf_write_real (fp, 48, region->linetype_scale);
         }
         if (region->visibility != 0)
         {
@@ -496,26 +519,17 @@ dxf_region_write
         }
         if (region->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", region->thickness);
+                dxf_write_real (fp, 39, region->thickness);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, " 70\n%d\n", region->modeler_format_version_number);
         }
-        i = 0;
-        while (strlen (region->proprietary_data[i]) > 0)
-        {
-                fprintf (fp->fp, "  1\n%s\n", region->proprietary_data[i]);
-                i++;
-        }
-        i = 0;
-        while (strlen (region->additional_proprietary_data[i]) > 0)
-        {
-                fprintf (fp->fp, "  3\n%s\n", region->additional_proprietary_data[i]);
-                i++;
-        }
+        dxf_proprietary_data_write_chains (fp,
+          dxf_region_get_proprietary_data (region),
+          dxf_region_get_additional_proprietary_data (region));
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -547,25 +561,24 @@ dxf_region_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         if (region->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfRegion was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (region->linetype);
-        free (region->layer);
-        for (i = 0; i < DXF_MAX_PARAM; i++)
+        dxf_free (region->linetype);
+        dxf_free (region->layer);
+        dxf_proprietary_data_free_chain (region->proprietary_data);
+        dxf_proprietary_data_free_chain (region->additional_proprietary_data);
+        if (region->proprietary_data_range != NULL)
         {
-                free (region->proprietary_data[i]);
-                free (region->additional_proprietary_data[i]);
+                dxf_proprietary_data_range_free (region->proprietary_data_range);
         }
-        free (region->dictionary_owner_soft);
-        free (region->dictionary_owner_hard);
-        free (region);
+        dxf_free (region->dictionary_owner_soft);
+        dxf_free (region->dictionary_owner_hard);
+        dxf_free (region);
         region = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -591,18 +604,19 @@ dxf_region_free_chain
                 /*!< a pointer to the chain of DXF \c REGION entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (regions == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (regions != NULL)
         {
                 struct DxfRegion *iter = regions->next;
+                regions->next = NULL;
                 dxf_region_free (regions);
                 regions = (DxfRegion *) iter;
         }
@@ -612,4 +626,203 @@ dxf_region_free_chain
 }
 
 
+/*!
+ * \brief Load the proprietary data of a DXF \c REGION entity from the
+ * file it was read from, when only its location was recorded.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_region_load_proprietary_data
+(
+        DxfRegion *region
+                /*!< a pointer to a DXF \c REGION entity. */
+)
+{
+        int status;
+
+        status = dxf_proprietary_data_range_load (region->proprietary_data_range,
+          &region->proprietary_data, &region->additional_proprietary_data);
+        dxf_proprietary_data_range_free (region->proprietary_data_range);
+        region->proprietary_data_range = NULL;
+        return (status);
+}
+
+
+/*!
+ * \brief Get the pointer to the \c proprietary_data from a DXF
+ * \c REGION entity.
+ *
+ * \return pointer to the \c proprietary_data.
+ *
+ * \warning No checks are performed on the returned pointer.
+ */
+DxfProprietaryData *
+dxf_region_get_proprietary_data
+(
+        DxfRegion *region
+                /*!< a pointer to a DXF \c REGION entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (region == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (region->proprietary_data_range != NULL)
+        {
+                dxf_region_load_proprietary_data (region);
+        }
+        if (region->proprietary_data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was found in the proprietary_data member.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfProprietaryData *) region->proprietary_data);
+}
+
+
+/*!
+ * \brief Set the proprietary data for a DXF \c REGION entity.
+ */
+DxfRegion *
+dxf_region_set_proprietary_data
+(
+        DxfRegion *region,
+                /*!< a pointer to a DXF \c REGION entity. */
+        DxfProprietaryData *proprietary_data
+                /*!< a pointer to a linked list containing the
+                 * \c proprietary_data for the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (region == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (proprietary_data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (region->proprietary_data_range != NULL)
+        {
+                dxf_region_load_proprietary_data (region);
+        }
+        region->proprietary_data = proprietary_data;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (region);
+}
+
+
+/*!
+ * \brief Get the pointer to the \c additional_proprietary_data from a
+ * DXF \c REGION entity.
+ *
+ * \return pointer to the \c additional_proprietary_data.
+ *
+ * \warning No checks are performed on the returned pointer.
+ */
+DxfProprietaryData *
+dxf_region_get_additional_proprietary_data
+(
+        DxfRegion *region
+                /*!< a pointer to a DXF \c REGION entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (region == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (region->proprietary_data_range != NULL)
+        {
+                dxf_region_load_proprietary_data (region);
+        }
+        if (region->additional_proprietary_data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was found in the additional_proprietary_data member.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfProprietaryData *) region->additional_proprietary_data);
+}
+
+
+/*!
+ * \brief Set the additional proprietary data for a DXF \c REGION
+ * entity.
+ */
+DxfRegion *
+dxf_region_set_additional_proprietary_data
+(
+        DxfRegion *region,
+                /*!< a pointer to a DXF \c REGION entity. */
+        DxfProprietaryData *additional_proprietary_data
+                /*!< a pointer to a linked list containing the
+                 * \c additional_proprietary_data for the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (region == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (additional_proprietary_data == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (region->proprietary_data_range != NULL)
+        {
+                dxf_region_load_proprietary_data (region);
+        }
+        region->additional_proprietary_data = additional_proprietary_data;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (region);
+}
+
+
 /* EOF */
@@ -37,6 +37,7 @@
 
 
 #include "global.h"
+#include "proprietary_data.h"
 
 
 #ifdef __cplusplus
@@ -56,6 +57,9 @@ extern "C" {
 typedef struct
 dxf_region
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -108,15 +112,19 @@ dxf_region
                 /*!< Hard owner ID/handle to owner dictionary (optional).\n
                  * Group code = 360. */
         /* Specific members for a DXF region. */
-        char *proprietary_data[DXF_MAX_PARAM];
+        DxfProprietaryData *proprietary_data;
                 /*!< Proprietary data (multiple lines < 255 characters
                  * each).\n
                  * Group code = 1. */
-        char *additional_proprietary_data[DXF_MAX_PARAM];
+        DxfProprietaryData *additional_proprietary_data;
                 /*!< Additional lines of proprietary data if previous
                  * group 1 string is greater than 255 characters
                  * (optional).\n
                  * Group code = 3. */
+        DxfProprietaryDataRange *proprietary_data_range;
+                /*!< Location of the proprietary data in the file it was
+                 * read from, when only the location was recorded.\n
+                 * \c NULL when the proprietary data is loaded. */
         int modeler_format_version_number;
                 /*!< Modeler format version number (currently = 1).\n
                  * Group code = 70. */
@@ -155,6 +163,28 @@ dxf_region_free_chain
 (
         DxfRegion *regions
 );
+DxfProprietaryData *
+dxf_region_get_proprietary_data
+(
+        DxfRegion *region
+);
+DxfRegion *
+dxf_region_set_proprietary_data
+(
+        DxfRegion *region,
+        DxfProprietaryData *proprietary_data
+);
+DxfProprietaryData *
+dxf_region_get_additional_proprietary_data
+(
+        DxfRegion *region
+);
+DxfRegion *
+dxf_region_set_additional_proprietary_data
+(
+        DxfRegion *region,
+        DxfProprietaryData *additional_proprietary_data
+);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,656 @@
+/*!
+ * \file sat.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF conversion between the proprietary data
+ * of \c 3DSOLID, \c BODY and \c REGION entities and ACIS SAT text.
+ *
+ * Up to DXF R2010 the ACIS data of these entities is stored as SAT text
+ * with every character \c c replaced by 159 - \c c, spaces are kept.\n
+ * A line of SAT text is stored in a proprietary data group (group code
+ * 1), the remainder of lines longer than 255 characters is stored in
+ * additional proprietary data groups (group code 3).\n
+ * The replacement is its own inverse, so decoding and encoding are the
+ * same operation.\n
+ * When the compiler targets SSE2 the text is converted 16 characters at
+ * a time, the remainder and other targets are converted one character
+ * at a time.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "sat.h"
+
+#if defined (__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+/*!
+ * \brief Replace every character \c c by 159 - \c c, keeping spaces.
+ *
+ * \c text and \c result may be the same array.
+ */
+static void
+dxf_sat_transform
+(
+        const char *text,
+                /*!< the characters to replace. */
+        size_t length,
+                /*!< number of characters in \c text. */
+        char *result
+                /*!< the replaced characters. */
+)
+{
+        size_t i = 0;
+
+#if defined (__SSE2__)
+        for (; i + 16 <= length; i += 16)
+        {
+                __m128i characters;
+                __m128i is_space;
+
+                characters = _mm_loadu_si128 ((const __m128i *) (text + i));
+                is_space = _mm_cmpeq_epi8 (characters, _mm_set1_epi8 (' '));
+                _mm_storeu_si128 ((__m128i *) (result + i),
+                  _mm_or_si128 (_mm_and_si128 (is_space, characters),
+                  _mm_andnot_si128 (is_space,
+                  _mm_sub_epi8 (_mm_set1_epi8 ((char) 159), characters))));
+        }
+#endif
+        for (; i < length; i++)
+        {
+                result[i] = (text[i] == ' ')
+                  ? ' '
+                  : (char) (159 - (unsigned char) text[i]);
+        }
+}
+
+
+/*!
+ * \brief Get the next link of the proprietary data and additional
+ * proprietary data of an entity, in the order of their incremental
+ * counter.
+ *
+ * Unused links (an empty line with a zero counter) are skipped.
+ *
+ * \return the next link, or \c NULL when both chains are exhausted.
+ */
+static DxfProprietaryData *
+dxf_sat_next_link
+(
+        DxfProprietaryData **data,
+                /*!< the remainder of the proprietary data chain. */
+        DxfProprietaryData **additional_data,
+                /*!< the remainder of the additional proprietary data
+                 * chain. */
+        int *group_code
+                /*!< the group code of the returned link, 1 or 3. */
+)
+{
+        DxfProprietaryData *link;
+
+        while ((*data != NULL)
+          && ((*data)->order == 0)
+          && (((*data)->line == NULL) || ((*data)->line[0] == '\0')))
+        {
+                *data = (DxfProprietaryData *) (*data)->next;
+        }
+        while ((*additional_data != NULL)
+          && ((*additional_data)->order == 0)
+          && (((*additional_data)->line == NULL) || ((*additional_data)->line[0] == '\0')))
+        {
+                *additional_data = (DxfProprietaryData *) (*additional_data)->next;
+        }
+        if ((*data != NULL)
+          && ((*additional_data == NULL)
+          || ((*data)->order <= (*additional_data)->order)))
+        {
+                link = *data;
+                *data = (DxfProprietaryData *) link->next;
+                *group_code = 1;
+        }
+        else if (*additional_data != NULL)
+        {
+                link = *additional_data;
+                *additional_data = (DxfProprietaryData *) link->next;
+                *group_code = 3;
+        }
+        else
+        {
+                link = NULL;
+        }
+        return (link);
+}
+
+
+/*!
+ * \brief Decode the text of proprietary data groups into SAT text.
+ *
+ * \c text is not required to be terminated, \c sat has to hold
+ * \c length characters and is not terminated.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_sat_decode
+(
+        const char *text,
+                /*!< the text of proprietary data groups. */
+        size_t length,
+                /*!< number of characters in \c text. */
+        char *sat
+                /*!< the decoded SAT text, may be \c text. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((length > 0) && ((text == NULL) || (sat == NULL)))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_sat_transform (text, length, sat);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Encode SAT text into the text of proprietary data groups.
+ *
+ * \c sat is not required to be terminated, \c text has to hold
+ * \c length characters and is not terminated.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_sat_encode
+(
+        const char *sat,
+                /*!< the SAT text. */
+        size_t length,
+                /*!< number of characters in \c sat. */
+        char *text
+                /*!< the encoded text, may be \c sat. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((length > 0) && ((sat == NULL) || (text == NULL)))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_sat_transform (sat, length, text);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Decode the proprietary data of an entity into SAT text in one
+ * contiguous, terminated buffer.
+ *
+ * Every line of SAT text is followed by a newline.\n
+ * The buffer is allocated in one go after the size is counted, free it
+ * with \c dxf_free ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_sat_decode_chains
+(
+        DxfProprietaryData *data,
+                /*!< a pointer to the chain of proprietary data. */
+        DxfProprietaryData *additional_data,
+                /*!< a pointer to the chain of additional proprietary
+                 * data. */
+        char **sat,
+                /*!< the SAT text. */
+        size_t *length
+                /*!< number of characters in \c sat, without the
+                 * terminating zero. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfProprietaryData *iter;
+        DxfProprietaryData *additional_iter;
+        DxfProprietaryData *link;
+        size_t size = 0;
+        size_t line_length;
+        int group_code;
+
+        /* Do some basic checks. */
+        if ((sat == NULL) || (length == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Count the characters. */
+        iter = data;
+        additional_iter = additional_data;
+        while ((link = dxf_sat_next_link (&iter, &additional_iter, &group_code)) != NULL)
+        {
+                if ((group_code == 1) && (size > 0))
+                {
+                        size++;
+                }
+                size += (link->line == NULL) ? 0 : strlen (link->line);
+        }
+        if (size > 0)
+        {
+                size++;
+        }
+        if ((*sat = dxf_malloc (size + 1)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Decode the lines. */
+        *length = 0;
+        iter = data;
+        additional_iter = additional_data;
+        while ((link = dxf_sat_next_link (&iter, &additional_iter, &group_code)) != NULL)
+        {
+                if ((group_code == 1) && (*length > 0))
+                {
+                        (*sat)[(*length)++] = '\n';
+                }
+                line_length = (link->line == NULL) ? 0 : strlen (link->line);
+                dxf_sat_transform (link->line, line_length, *sat + *length);
+                *length += line_length;
+        }
+        if (*length > 0)
+        {
+                (*sat)[(*length)++] = '\n';
+        }
+        (*sat)[*length] = '\0';
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Decode the proprietary data of an entity into SAT text and pass
+ * it to a function.
+ *
+ * The text is decoded into a buffer of \c DXF_SAT_BUFFER_SIZE
+ * characters which is passed to \c callback every time it is full, so
+ * the memory used does not depend on the size of the data.\n
+ * Every line of SAT text is followed by a newline.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred or \c callback returned \c EXIT_FAILURE.
+ */
+int
+dxf_sat_write_chains
+(
+        DxfProprietaryData *data,
+                /*!< a pointer to the chain of proprietary data. */
+        DxfProprietaryData *additional_data,
+                /*!< a pointer to the chain of additional proprietary
+                 * data. */
+        DxfSatWriteCallback callback,
+                /*!< the function receiving the SAT text. */
+        void *callback_data
+                /*!< passed on to \c callback. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfProprietaryData *link;
+        char *buffer;
+        const char *line;
+        size_t used = 0;
+        size_t remaining;
+        size_t part;
+        int group_code;
+        int lines = 0;
+        int status = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (callback == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((buffer = dxf_malloc (DXF_SAT_BUFFER_SIZE)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        while ((status == EXIT_SUCCESS)
+          && ((link = dxf_sat_next_link (&data, &additional_data, &group_code)) != NULL))
+        {
+                /* Terminate the previous line, leaving room for it in
+                 * the buffer. */
+                if ((group_code == 1) && (lines > 0))
+                {
+                        if (used == DXF_SAT_BUFFER_SIZE)
+                        {
+                                status = callback (buffer, used, callback_data);
+                                used = 0;
+                        }
+                        buffer[used++] = '\n';
+                }
+                lines++;
+                line = (link->line == NULL) ? "" : link->line;
+                remaining = strlen (line);
+                while ((status == EXIT_SUCCESS) && (remaining > 0))
+                {
+                        if (used == DXF_SAT_BUFFER_SIZE)
+                        {
+                                status = callback (buffer, used, callback_data);
+                                used = 0;
+                        }
+                        part = DXF_SAT_BUFFER_SIZE - used;
+                        part = (remaining < part) ? remaining : part;
+                        dxf_sat_transform (line, part, buffer + used);
+                        used += part;
+                        line += part;
+                        remaining -= part;
+                }
+        }
+        if ((status == EXIT_SUCCESS) && (lines > 0))
+        {
+                if (used == DXF_SAT_BUFFER_SIZE)
+                {
+                        status = callback (buffer, used, callback_data);
+                        used = 0;
+                }
+                buffer[used++] = '\n';
+        }
+        if ((status == EXIT_SUCCESS) && (used > 0))
+        {
+                status = callback (buffer, used, callback_data);
+        }
+        dxf_free (buffer);
+        if (status != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the SAT text could not be written.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write SAT text to a file, the \c DxfSatWriteCallback used by
+ * \c dxf_sat_write_file ().
+ */
+static int
+dxf_sat_write_file_callback
+(
+        const char *text,
+                /*!< the SAT text. */
+        size_t length,
+                /*!< number of characters in \c text. */
+        void *data
+                /*!< the output file. */
+)
+{
+        return ((fwrite (text, 1, length, (FILE *) data) == length)
+          ? EXIT_SUCCESS
+          : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Decode the proprietary data of an entity into a SAT file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_sat_write_file
+(
+        DxfProprietaryData *data,
+                /*!< a pointer to the chain of proprietary data. */
+        DxfProprietaryData *additional_data,
+                /*!< a pointer to the chain of additional proprietary
+                 * data. */
+        FILE *file
+                /*!< the output file, opened for writing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (file == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_sat_write_chains (data, additional_data,
+          dxf_sat_write_file_callback, file));
+}
+
+
+/*!
+ * \brief Append a link with encoded SAT text to a chain.
+ *
+ * The unused first link of a new chain is filled instead.
+ *
+ * \return the appended link, or \c NULL when no memory was allocated.
+ */
+static DxfProprietaryData *
+dxf_sat_append_link
+(
+        DxfProprietaryData *last,
+                /*!< the last link of the chain. */
+        const char *sat,
+                /*!< the SAT text of the link. */
+        size_t length,
+                /*!< number of characters in \c sat. */
+        int order
+                /*!< the incremental counter of the link. */
+)
+{
+        DxfProprietaryData *link;
+
+        if ((last->order == 0)
+          && ((last->line == NULL) || (last->line[0] == '\0')))
+        {
+                link = last;
+        }
+        else
+        {
+                if ((link = dxf_proprietary_data_init (dxf_proprietary_data_new ())) == NULL)
+                {
+                        return (NULL);
+                }
+                last->next = (struct DxfProprietaryData *) link;
+        }
+        dxf_free (link->line);
+        if ((link->line = dxf_malloc (length + 1)) == NULL)
+        {
+                return (NULL);
+        }
+        dxf_sat_transform (sat, length, link->line);
+        link->line[length] = '\0';
+        link->length = (int) length;
+        link->order = order;
+        return (link);
+}
+
+
+/*!
+ * \brief Encode SAT text into new chains of proprietary data and
+ * additional proprietary data.
+ *
+ * Every line is stored in a proprietary data group, the remainder of
+ * lines longer than \c DXF_SAT_MAX_GROUP_LENGTH characters in additional
+ * proprietary data groups.\n
+ * Line ends may be a newline or a carriage return and a newline.\n
+ * The chains replace \c *data and \c *additional_data, free them with
+ * \c dxf_proprietary_data_free_chain () when they are not used by an
+ * entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_sat_encode_chains
+(
+        const char *sat,
+                /*!< the SAT text. */
+        size_t length,
+                /*!< number of characters in \c sat. */
+        DxfProprietaryData **data,
+                /*!< the new chain of proprietary data. */
+        DxfProprietaryData **additional_data
+                /*!< the new chain of additional proprietary data. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfProprietaryData *last;
+        DxfProprietaryData *additional_last;
+        const char *end;
+        const char *line_end;
+        size_t line_length;
+        size_t part;
+        int order = 1;
+
+        /* Do some basic checks. */
+        if (((length > 0) && (sat == NULL))
+          || (data == NULL)
+          || (additional_data == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        *data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+        *additional_data = dxf_proprietary_data_init (dxf_proprietary_data_new ());
+        if ((*data == NULL) || (*additional_data == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        last = *data;
+        additional_last = *additional_data;
+        end = sat + length;
+        while ((sat != NULL) && (sat < end))
+        {
+                line_end = memchr (sat, '\n', end - sat);
+                if (line_end == NULL)
+                {
+                        line_end = end;
+                }
+                line_length = line_end - sat;
+                if ((line_length > 0) && (sat[line_length - 1] == '\r'))
+                {
+                        line_length--;
+                }
+                part = (line_length > DXF_SAT_MAX_GROUP_LENGTH)
+                  ? DXF_SAT_MAX_GROUP_LENGTH
+                  : line_length;
+                if ((last = dxf_sat_append_link (last, sat, part, order++)) == NULL)
+                {
+                        break;
+                }
+                for (; part < line_length; part += DXF_SAT_MAX_GROUP_LENGTH)
+                {
+                        additional_last = dxf_sat_append_link (additional_last,
+                          sat + part,
+                          (line_length - part > DXF_SAT_MAX_GROUP_LENGTH)
+                          ? DXF_SAT_MAX_GROUP_LENGTH
+                          : line_length - part,
+                          order++);
+                        if (additional_last == NULL)
+                        {
+                                break;
+                        }
+                }
+                if (additional_last == NULL)
+                {
+                        last = NULL;
+                        break;
+                }
+                sat = (line_end < end) ? line_end + 1 : end;
+        }
+        if (last == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
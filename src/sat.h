@@ -0,0 +1,83 @@
+/*!
+ * \file sat.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF conversion between the proprietary data
+ * of \c 3DSOLID, \c BODY and \c REGION entities and ACIS SAT text.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_SAT_H
+#define LIBDXF_SRC_SAT_H
+
+
+#include "global.h"
+#include "proprietary_data.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_SAT_MAX_GROUP_LENGTH 255
+        /*!< \brief Maximum number of characters in the value of a
+         * proprietary data group, longer lines are continued in
+         * additional proprietary data groups (group code 3). */
+
+#define DXF_SAT_BUFFER_SIZE 65536
+        /*!< \brief Number of characters passed to a
+         * \c DxfSatWriteCallback at a time. */
+
+
+/*!
+ * \brief Function receiving SAT text from \c dxf_sat_write_chains ().
+ *
+ * \return \c EXIT_SUCCESS to continue, or \c EXIT_FAILURE to stop.
+ */
+typedef int (*DxfSatWriteCallback) (const char *text, size_t length, void *data);
+
+
+int dxf_sat_decode (const char *text, size_t length, char *sat);
+int dxf_sat_encode (const char *sat, size_t length, char *text);
+int dxf_sat_decode_chains (DxfProprietaryData *data, DxfProprietaryData *additional_data, char **sat, size_t *length);
+int dxf_sat_write_chains (DxfProprietaryData *data, DxfProprietaryData *additional_data, DxfSatWriteCallback callback, void *callback_data);
+int dxf_sat_write_file (DxfProprietaryData *data, DxfProprietaryData *additional_data, FILE *file);
+int dxf_sat_encode_chains (const char *sat, size_t length, DxfProprietaryData **data, DxfProprietaryData **additional_data);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_SAT_H */
+
+
+/* EOF */
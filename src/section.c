@@ -48,7 +48,7 @@ dxf_section_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfHeader dxf_header;
         DxfBlock dxf_block;
         char *dxf_entities_list = NULL;
@@ -56,11 +56,9 @@ dxf_section_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (EXIT_FAILURE);
         }
         dxf_read_line (temp_string, fp);
@@ -72,7 +70,9 @@ dxf_section_read
                         if (strcmp (temp_string, "HEADER") == 0)
                         {
                                 /* We have found the begin of the HEADER section. */
+                                DXF_TRACING_PHASE_BEGIN (DXF_TRACING_PHASE_HEADER);
                                 dxf_header_read (fp, &dxf_header);
+                                DXF_TRACING_PHASE_END (DXF_TRACING_PHASE_HEADER);
                         }
                         else if (strcmp (temp_string, "CLASSES") == 0)
                         {
@@ -99,11 +99,14 @@ dxf_section_read
                         else if (strcmp (temp_string, "ENTITIES") == 0)
                         {
                                 /* We have found the begin of the ENTITIES sction. */
+                                DXF_TRACING_PHASE_BEGIN (DXF_TRACING_PHASE_ENTITIES);
                                 dxf_entities_read_table (fp->filename,
                                                    fp->fp,
                                                    fp->line_number,
                                                    dxf_entities_list,
-                                                   dxf_header._AcadVer);                        }
+                                                   dxf_header._AcadVer);
+                                DXF_TRACING_PHASE_END (DXF_TRACING_PHASE_ENTITIES);
+                        }
                         else if (strcmp (temp_string, "OBJECTS") == 0)
                         {
                                 /* We have found the begin of the OBJECTS sction. */
@@ -118,12 +121,10 @@ dxf_section_read
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () unexpected string encountered while reading line %d from: %s.\n")),
                   __FUNCTION__, fp->line_number, fp->filename);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -147,14 +148,14 @@ dxf_section_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (section_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -33,6 +33,7 @@
 
 
 #include "seqend.h"
+#include "util.h"
 
 
 /*!
@@ -61,9 +62,9 @@ dxf_seqend_new ()
         size = sizeof (DxfSeqend);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((seqend = malloc (size)) == NULL)
+        if ((seqend = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSeqend struct.\n")),
                   __FUNCTION__);
                 seqend = NULL;
@@ -105,30 +106,30 @@ dxf_seqend_init
         /* Do some basic checks. */
         if (seqend == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 seqend = dxf_seqend_new ();
         }
         if (seqend == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfSeqend struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        seqend->app_name = strdup ("");
+        seqend->app_name = dxf_strdup ("");
         seqend->id_code = 0;
-        seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        seqend->layer = strdup (DXF_DEFAULT_LAYER);
+        seqend->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        seqend->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         seqend->elevation = 0.0;
         seqend->thickness = 0.0;
         seqend->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
         seqend->visibility = DXF_DEFAULT_VISIBILITY;
         seqend->color = DXF_COLOR_BYLAYER;
         seqend->paperspace = DXF_MODELSPACE;
-        seqend->dictionary_owner_soft = strdup ("");
-        seqend->dictionary_owner_hard = strdup ("");
+        seqend->dictionary_owner_soft = dxf_strdup ("");
+        seqend->dictionary_owner_hard = dxf_strdup ("");
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -165,38 +166,34 @@ dxf_seqend_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (seqend == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 seqend = dxf_seqend_new ();
                 seqend = dxf_seqend_init (seqend);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -211,13 +208,13 @@ dxf_seqend_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", seqend->linetype);
+                        dxf_read_string (fp, &seqend->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", seqend->layer);
+                        dxf_read_string (fp, &seqend->layer);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
@@ -272,7 +269,7 @@ dxf_seqend_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbEntity") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -282,14 +279,14 @@ dxf_seqend_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", seqend->dictionary_owner_soft);
+                        dxf_read_string (fp, &seqend->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", seqend->dictionary_owner_hard);
+                        dxf_read_string (fp, &seqend->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -300,22 +297,26 @@ dxf_seqend_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (seqend->linetype, "") == 0)
         {
-                seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                seqend->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (seqend->layer, "") == 0)
         {
-                seqend->layer = strdup (DXF_DEFAULT_LAYER);
+                seqend->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -355,43 +356,43 @@ dxf_seqend_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SEQEND");
+        char *dxf_entity_name = dxf_strdup ("SEQEND");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (seqend == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (seqend->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, seqend->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                seqend->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                seqend->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (seqend->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, seqend->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
                 seqend->layer = DXF_DEFAULT_LAYER;
@@ -440,7 +441,7 @@ dxf_seqend_write
           && DXF_FLATLAND
           && (seqend->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", seqend->elevation);
+                dxf_write_real (fp, 38, seqend->elevation);
         }
         if (strcmp (seqend->linetype, DXF_DEFAULT_LINETYPE) != 0)
         {
@@ -452,14 +453,14 @@ dxf_seqend_write
         }
         if (seqend->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", seqend->linetype_scale);
+                dxf_write_real (fp, 48, seqend->linetype_scale);
         }
         if (seqend->visibility != 0)
         {
                 fprintf (fp->fp, " 60\n%d\n", seqend->visibility);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -491,11 +492,11 @@ dxf_seqend_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        free (seqend->linetype);
-        free (seqend->layer);
-        free (seqend->dictionary_owner_soft);
-        free (seqend->dictionary_owner_hard);
-        free (seqend);
+        dxf_free (seqend->linetype);
+        dxf_free (seqend->layer);
+        dxf_free (seqend->dictionary_owner_soft);
+        dxf_free (seqend->dictionary_owner_hard);
+        dxf_free (seqend);
         seqend = NULL;
 #if DEBUG
         DXF_DEBUG_END
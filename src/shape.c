@@ -33,6 +33,7 @@
 
 
 #include "shape.h"
+#include "util.h"
 
 
 /*!
@@ -61,9 +62,9 @@ dxf_shape_new ()
         size = sizeof (DxfShape);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((shape = malloc (size)) == NULL)
+        if ((shape = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfShape struct.\n")),
                   __FUNCTION__);
                 shape = NULL;
@@ -71,6 +72,7 @@ dxf_shape_new ()
         else
         {
                 memset (shape, 0, size);
+                shape->header.type = SHAPE;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -105,30 +107,30 @@ dxf_shape_init
         /* Do some basic checks. */
         if (shape == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 shape = dxf_shape_new ();
         }
         if (shape == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfShape struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         shape->id_code = 0;
-        shape->shape_name = strdup ("");
-        shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        shape->layer = strdup (DXF_DEFAULT_LAYER);
+        shape->shape_name = dxf_strdup ("");
+        shape->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        shape->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         shape->elevation = 0.0;
         shape->thickness = 0.0;
         shape->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
         shape->visibility = DXF_DEFAULT_VISIBILITY;
         shape->color = DXF_COLOR_BYLAYER;
         shape->paperspace = DXF_MODELSPACE;
-        shape->dictionary_owner_soft = strdup ("");
-        shape->dictionary_owner_hard = strdup ("");
+        shape->dictionary_owner_soft = dxf_strdup ("");
+        shape->dictionary_owner_hard = dxf_strdup ("");
         shape->x0 = 0.0;
         shape->y0 = 0.0;
         shape->z0 = 0.0;
@@ -175,39 +177,35 @@ dxf_shape_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        char *dxf_entity_name = strdup ("SHAPE");
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        char *dxf_entity_name = dxf_strdup ("SHAPE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (shape == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 shape = dxf_shape_new ();
                 shape = dxf_shape_init (shape);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -215,7 +213,7 @@ dxf_shape_read
                         /* Now follows a string containing a shape
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", shape->shape_name);
+                        dxf_read_string (fp, &shape->shape_name);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -229,13 +227,13 @@ dxf_shape_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", shape->linetype);
+                        dxf_read_string (fp, &shape->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", shape->layer);
+                        dxf_read_string (fp, &shape->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -340,7 +338,7 @@ dxf_shape_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbShape") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -371,14 +369,14 @@ dxf_shape_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", shape->dictionary_owner_soft);
+                        dxf_read_string (fp, &shape->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", shape->dictionary_owner_hard);
+                        dxf_read_string (fp, &shape->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -389,29 +387,33 @@ dxf_shape_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (shape->shape_name, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
                 return (NULL);
         }
         if (strcmp (shape->linetype, "") == 0)
         {
-                shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                shape->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (shape->layer, "") == 0)
         {
-                shape->layer = strdup (DXF_DEFAULT_LAYER);
+                shape->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -444,65 +446,65 @@ dxf_shape_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SHAPE");
+        char *dxf_entity_name = dxf_strdup ("SHAPE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (shape == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (shape->shape_name, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (shape->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                shape->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                shape->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (shape->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                shape->layer = strdup (DXF_DEFAULT_LAYER);
+                shape->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (shape->size == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () size has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
         }
         if (shape->rel_x_scale == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning: in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, shape->id_code);
         }
@@ -553,7 +555,7 @@ dxf_shape_write
           && DXF_FLATLAND
           && (shape->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", shape->elevation);
+                dxf_write_real (fp, 38, shape->elevation);
         }
         if (shape->color != DXF_COLOR_BYLAYER)
         {
@@ -561,7 +563,7 @@ dxf_shape_write
         }
         if (shape->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", shape->linetype_scale);
+                dxf_write_real (fp, 48, shape->linetype_scale);
         }
         if (shape->visibility != 0)
         {
@@ -573,36 +575,36 @@ dxf_shape_write
         }
         if (shape->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", shape->thickness);
+                dxf_write_real (fp, 39, shape->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", shape->x0);
-        fprintf (fp->fp, " 20\n%f\n", shape->y0);
-        fprintf (fp->fp, " 30\n%f\n", shape->z0);
-        fprintf (fp->fp, " 40\n%f\n", shape->size);
+        dxf_write_real (fp, 10, shape->x0);
+        dxf_write_real (fp, 20, shape->y0);
+        dxf_write_real (fp, 30, shape->z0);
+        dxf_write_real (fp, 40, shape->size);
         fprintf (fp->fp, "  2\n%s\n", shape->shape_name);
         if (shape->rot_angle != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", shape->rot_angle);
+                dxf_write_real (fp, 50, shape->rot_angle);
         }
         if (shape->rel_x_scale != 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", shape->rel_x_scale);
+                dxf_write_real (fp, 41, shape->rel_x_scale);
         }
         if (shape->obl_angle != 0.0)
         {
-                fprintf (fp->fp, " 51\n%f\n", shape->obl_angle);
+                dxf_write_real (fp, 51, shape->obl_angle);
         }
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (shape->extr_x0 != 0.0)
                 && (shape->extr_y0 != 0.0)
                 && (shape->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", shape->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", shape->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", shape->extr_z0);
+                dxf_write_real (fp, 210, shape->extr_x0);
+                dxf_write_real (fp, 220, shape->extr_y0);
+                dxf_write_real (fp, 230, shape->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -636,17 +638,17 @@ dxf_shape_free
 #endif
         if (shape->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfShape was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (shape->shape_name);
-        free (shape->linetype);
-        free (shape->layer);
-        free (shape->dictionary_owner_soft);
-        free (shape->dictionary_owner_hard);
-        free (shape);
+        dxf_free (shape->shape_name);
+        dxf_free (shape->linetype);
+        dxf_free (shape->layer);
+        dxf_free (shape->dictionary_owner_soft);
+        dxf_free (shape->dictionary_owner_hard);
+        dxf_free (shape);
         shape = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -672,18 +674,19 @@ dxf_shape_free_chain
                 /*!< a pointer to the chain of DXF \c SHAPE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (shapes == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (shapes != NULL)
         {
                 struct DxfShape *iter = shapes->next;
+                shapes->next = NULL;
                 dxf_shape_free (shapes);
                 shapes = (DxfShape *) iter;
         }
@@ -40,6 +40,7 @@
 
 
 #include "solid.h"
+#include "util.h"
 
 
 /*!
@@ -65,9 +66,9 @@ dxf_solid_new ()
         size = sizeof (DxfSolid);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((solid = malloc (size)) == NULL)
+        if ((solid = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSolid struct.\n")),
                   __FUNCTION__);
                 solid = NULL;
@@ -75,6 +76,7 @@ dxf_solid_new ()
         else
         {
                 memset (solid, 0, size);
+                solid->header.type = SOLID;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -108,21 +110,21 @@ dxf_solid_init
         /* Do some basic checks. */
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 solid = dxf_solid_new ();
         }
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSolid struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         solid->id_code = 0;
-        solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        solid->layer = strdup (DXF_DEFAULT_LAYER);
+        solid->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        solid->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         solid->x0 = 0.0;
         solid->y0 = 0.0;
         solid->z0 = 0.0;
@@ -144,8 +146,8 @@ dxf_solid_init
         solid->visibility = DXF_DEFAULT_VISIBILITY;
         solid->color = DXF_COLOR_BYLAYER;
         solid->paperspace = DXF_MODELSPACE;
-        solid->dictionary_owner_soft = strdup ("");
-        solid->dictionary_owner_hard = strdup ("");
+        solid->dictionary_owner_soft = dxf_strdup ("");
+        solid->dictionary_owner_hard = dxf_strdup ("");
         solid->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -183,38 +185,34 @@ dxf_solid_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 solid = dxf_solid_new ();
                 solid = dxf_solid_init (solid);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -229,13 +227,13 @@ dxf_solid_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->linetype);
+                        dxf_read_string (fp, &solid->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->layer);
+                        dxf_read_string (fp, &solid->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -402,14 +400,14 @@ dxf_solid_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->dictionary_owner_soft);
+                        dxf_read_string (fp, &solid->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", solid->dictionary_owner_hard);
+                        dxf_read_string (fp, &solid->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -420,22 +418,26 @@ dxf_solid_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (solid->linetype, "") == 0)
         {
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                solid->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (solid->layer, "") == 0)
         {
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                solid->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -467,46 +469,46 @@ dxf_solid_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SOLID");
+        char *dxf_entity_name = dxf_strdup ("SOLID");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (solid->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, solid->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                solid->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                solid->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (solid->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, solid->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                solid->layer = strdup (DXF_DEFAULT_LAYER);
+                solid->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -555,7 +557,7 @@ dxf_solid_write
           && DXF_FLATLAND
           && (solid->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", solid->elevation);
+                dxf_write_real (fp, 38, solid->elevation);
         }
         if (solid->color != DXF_COLOR_BYLAYER)
         {
@@ -563,7 +565,7 @@ dxf_solid_write
         }
         if (solid->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", solid->linetype_scale);
+                dxf_write_real (fp, 48, solid->linetype_scale);
         }
         if (solid->visibility != 0)
         {
@@ -573,33 +575,33 @@ dxf_solid_write
         {
                 fprintf (fp->fp, "100\nAcDbTrace\n");
         }
-        fprintf (fp->fp, " 10\n%f\n", solid->x0);
-        fprintf (fp->fp, " 20\n%f\n", solid->y0);
-        fprintf (fp->fp, " 30\n%f\n", solid->z0);
-        fprintf (fp->fp, " 11\n%f\n", solid->x1);
-        fprintf (fp->fp, " 21\n%f\n", solid->y1);
-        fprintf (fp->fp, " 31\n%f\n", solid->z1);
-        fprintf (fp->fp, " 12\n%f\n", solid->x2);
-        fprintf (fp->fp, " 22\n%f\n", solid->y2);
-        fprintf (fp->fp, " 32\n%f\n", solid->z2);
-        fprintf (fp->fp, " 13\n%f\n", solid->x3);
-        fprintf (fp->fp, " 23\n%f\n", solid->y3);
-        fprintf (fp->fp, " 33\n%f\n", solid->z3);
+        dxf_write_real (fp, 10, solid->x0);
+        dxf_write_real (fp, 20, solid->y0);
+        dxf_write_real (fp, 30, solid->z0);
+        dxf_write_real (fp, 11, solid->x1);
+        dxf_write_real (fp, 21, solid->y1);
+        dxf_write_real (fp, 31, solid->z1);
+        dxf_write_real (fp, 12, solid->x2);
+        dxf_write_real (fp, 22, solid->y2);
+        dxf_write_real (fp, 32, solid->z2);
+        dxf_write_real (fp, 13, solid->x3);
+        dxf_write_real (fp, 23, solid->y3);
+        dxf_write_real (fp, 33, solid->z3);
         if (solid->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", solid->thickness);
+                dxf_write_real (fp, 39, solid->thickness);
         }
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (solid->extr_x0 != 0.0)
                 && (solid->extr_y0 != 0.0)
                 && (solid->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", solid->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", solid->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", solid->extr_z0);
+                dxf_write_real (fp, 210, solid->extr_x0);
+                dxf_write_real (fp, 220, solid->extr_y0);
+                dxf_write_real (fp, 230, solid->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -633,16 +635,16 @@ dxf_solid_free
 #endif
         if (solid->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfSolid was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (solid->linetype);
-        free (solid->layer);
-        free (solid->dictionary_owner_soft);
-        free (solid->dictionary_owner_hard);
-        free (solid);
+        dxf_free (solid->linetype);
+        dxf_free (solid->layer);
+        dxf_free (solid->dictionary_owner_soft);
+        dxf_free (solid->dictionary_owner_hard);
+        dxf_free (solid);
         solid = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -668,18 +670,19 @@ dxf_solid_free_chain
                 /*!< pointer to the chain of DXF \c SOLID entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (solids == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (solids != NULL)
         {
                 struct DxfSolid *iter = solids->next;
+                solids->next = NULL;
                 dxf_solid_free (solids);
                 solids = (DxfSolid *) iter;
         }
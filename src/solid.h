@@ -66,6 +66,9 @@ extern "C" {
 typedef struct
 dxf_solid
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< group code = 5\n
@@ -35,6 +35,7 @@
 
 
 #include "sortentstable.h"
+#include "util.h"
 
 
 /*!
@@ -60,9 +61,9 @@ dxf_sortentstable_new ()
         size = sizeof (DxfSortentsTable);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((sortentstable = malloc (size)) == NULL)
+        if ((sortentstable = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSortentsTable struct.\n")),
                   __FUNCTION__);
                 sortentstable = NULL;
@@ -106,25 +107,25 @@ dxf_sortentstable_init
         /* Do some basic checks. */
         if (sortentstable == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 sortentstable = dxf_sortentstable_new ();
         }
         if (sortentstable == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSortentsTable struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         sortentstable->id_code = 0;
-        sortentstable->dictionary_owner_soft = strdup ("");
-        sortentstable->dictionary_owner_hard = strdup ("");
-        sortentstable->block_owner = strdup ("");
+        sortentstable->dictionary_owner_soft = dxf_strdup ("");
+        sortentstable->dictionary_owner_hard = dxf_strdup ("");
+        sortentstable->block_owner = dxf_strdup ("");
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                sortentstable->entity_owner[i] = strdup ("");
+                sortentstable->entity_owner[i] = dxf_strdup ("");
                 sortentstable->sort_handle[i] = 0;
         }
         sortentstable->next = NULL;
@@ -164,7 +165,7 @@ dxf_sortentstable_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
         int j;
         int k;
@@ -172,22 +173,20 @@ dxf_sortentstable_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (sortentstable == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 sortentstable = dxf_sortentstable_new ();
@@ -197,16 +196,15 @@ dxf_sortentstable_read
         j = 0;
         k = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -235,7 +233,7 @@ dxf_sortentstable_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbSortentsTable") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -246,7 +244,7 @@ dxf_sortentstable_read
                         /* Now follows a string containing a soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", sortentstable->dictionary_owner_soft);
+                        dxf_read_string (fp, &sortentstable->dictionary_owner_soft);
                         j++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -256,7 +254,7 @@ dxf_sortentstable_read
                          * ID/handle to owner (currently only the
                          * *MODEL_SPACE or *PAPER_SPACE blocks). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", sortentstable->block_owner);
+                        dxf_read_string (fp, &sortentstable->block_owner);
                         j++;
                         /*! \todo Check for overrun of array index. */
                 }
@@ -266,7 +264,7 @@ dxf_sortentstable_read
                          * ID/handle to an entity (zero or more entries
                          * may exist). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", sortentstable->entity_owner[k]);
+                        dxf_read_string (fp, &sortentstable->entity_owner[k]);
                         k++;
                         /*! \todo Check for overrun of array index. */
                 }
@@ -275,7 +273,7 @@ dxf_sortentstable_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", sortentstable->dictionary_owner_hard);
+                        dxf_read_string (fp, &sortentstable->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -286,13 +284,17 @@ dxf_sortentstable_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -324,31 +326,31 @@ dxf_sortentstable_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SORTENTSTABLE");
+        char *dxf_entity_name = dxf_strdup ("SORTENTSTABLE");
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (sortentstable == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, sortentstable->id_code);
         }
@@ -404,7 +406,7 @@ dxf_sortentstable_write
                  * lead to inflated DXF files and structures. */
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -441,19 +443,19 @@ dxf_sortentstable_free
         /* Do some basic checks. */
         if (sortentstable->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfSortentsTable was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (sortentstable->dictionary_owner_soft);
-        free (sortentstable->dictionary_owner_hard);
-        free (sortentstable->block_owner);
+        dxf_free (sortentstable->dictionary_owner_soft);
+        dxf_free (sortentstable->dictionary_owner_hard);
+        dxf_free (sortentstable->block_owner);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (sortentstable->entity_owner[i]);
+                dxf_free (sortentstable->entity_owner[i]);
         }
-        free (sortentstable);
+        dxf_free (sortentstable);
         sortentstable = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -480,18 +482,19 @@ dxf_sortentstable_free_chain
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (sortentstables == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (sortentstables != NULL)
         {
                 struct DxfSortentsTable *iter = sortentstables->next;
+                sortentstables->next = NULL;
                 dxf_sortentstable_free (sortentstables);
                 sortentstables = (DxfSortentsTable *) iter;
         }
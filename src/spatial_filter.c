@@ -35,6 +35,7 @@
 
 
 #include "spatial_filter.h"
+#include "util.h"
 
 
 /*!
@@ -60,9 +61,9 @@ dxf_spatial_filter_new ()
         size = sizeof (DxfSpatialFilter);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spatial_filter = malloc (size)) == NULL)
+        if ((spatial_filter = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSpatialFilter struct.\n")),
                   __FUNCTION__);
                 spatial_filter = NULL;
@@ -106,21 +107,21 @@ dxf_spatial_filter_init
         /* Do some basic checks. */
         if (spatial_filter == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spatial_filter = dxf_spatial_filter_new ();
         }
         if (spatial_filter == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSpatialFilter struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         spatial_filter->id_code = 0;
-        spatial_filter->dictionary_owner_soft = strdup ("");
-        spatial_filter->dictionary_owner_hard = strdup ("");
+        spatial_filter->dictionary_owner_soft = dxf_strdup ("");
+        spatial_filter->dictionary_owner_hard = dxf_strdup ("");
         spatial_filter->x1 = 0.0;
         spatial_filter->y1 = 0.0;
         spatial_filter->z1 = 0.0;
@@ -180,7 +181,7 @@ dxf_spatial_filter_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
         int j;
         int k;
@@ -188,22 +189,20 @@ dxf_spatial_filter_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (spatial_filter == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spatial_filter = dxf_spatial_filter_new ();
@@ -213,16 +212,15 @@ dxf_spatial_filter_read
         j = 0;
         k = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -349,7 +347,7 @@ dxf_spatial_filter_read
                         if ((strcmp (temp_string, "AcDbFilter") != 0)
                           && (strcmp (temp_string, "AcDbSpatialFilter") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -383,7 +381,7 @@ dxf_spatial_filter_read
                          * of the normal to the plane containing the
                          * clip boundary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spatial_filter->dictionary_owner_soft);
+                        dxf_read_string (fp, &spatial_filter->dictionary_owner_soft);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
@@ -391,7 +389,7 @@ dxf_spatial_filter_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spatial_filter->dictionary_owner_hard);
+                        dxf_read_string (fp, &spatial_filter->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -402,13 +400,17 @@ dxf_spatial_filter_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -440,43 +442,43 @@ dxf_spatial_filter_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SPATIAL_FILTER");
+        char *dxf_entity_name = dxf_strdup ("SPATIAL_FILTER");
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spatial_filter == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spatial_filter->number_of_points < 2)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () number of the clip boundary definition points is too small.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\tThe %s object with id-code %x is dropped from output.\n")),
                   dxf_entity_name, spatial_filter->id_code);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, spatial_filter->id_code);
         }
@@ -518,8 +520,8 @@ dxf_spatial_filter_write
         fprintf (fp->fp, " 70\n%d\n", spatial_filter->number_of_points);
         for (i = 0; i < spatial_filter->number_of_points; i++)
         {
-                fprintf (fp->fp, " 10\n%f\n", spatial_filter->x0[i]);
-                fprintf (fp->fp, " 20\n%f\n", spatial_filter->y0[i]);
+                dxf_write_real (fp, 10, spatial_filter->x0[i]);
+                dxf_write_real (fp, 20, spatial_filter->y0[i]);
                 /*! \warning We do rely on a correct number of clip
                  * boundary definition points in the instnce of the
                  * DxfSpatialFilter struct.\n
@@ -531,31 +533,31 @@ dxf_spatial_filter_write
                 && (spatial_filter->extr_y0 != 0.0)
                 && (spatial_filter->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", spatial_filter->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", spatial_filter->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", spatial_filter->extr_z0);
+                dxf_write_real (fp, 210, spatial_filter->extr_x0);
+                dxf_write_real (fp, 220, spatial_filter->extr_y0);
+                dxf_write_real (fp, 230, spatial_filter->extr_z0);
         }
         fprintf (fp->fp, " 71\n%d\n", spatial_filter->clip_boundary_display_flag);
         fprintf (fp->fp, " 72\n%d\n", spatial_filter->front_clipping_plane_flag);
         if (spatial_filter->front_clipping_plane_flag)
         {
-                fprintf (fp->fp, " 40\n%f\n", spatial_filter->front_clipping_plane_distance);
+                dxf_write_real (fp, 40, spatial_filter->front_clipping_plane_distance);
         }
         fprintf (fp->fp, " 73\n%d\n", spatial_filter->back_clipping_plane_flag);
         if (spatial_filter->back_clipping_plane_flag)
         {
-                fprintf (fp->fp, " 41\n%f\n", spatial_filter->back_clipping_plane_distance);
+                dxf_write_real (fp, 41, spatial_filter->back_clipping_plane_distance);
         }
         for (i = 0; i < 12; i++)
         {
-                fprintf (fp->fp, " 40\n%f\n", spatial_filter->inverse_block_transformation[i]);
+                dxf_write_real (fp, 40, spatial_filter->inverse_block_transformation[i]);
         }
         for (i = 0; i < 12; i++)
         {
-                fprintf (fp->fp, " 40\n%f\n", spatial_filter->block_transformation[i]);
+                dxf_write_real (fp, 40, spatial_filter->block_transformation[i]);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -590,14 +592,14 @@ dxf_spatial_filter_free
         /* Do some basic checks. */
         if (spatial_filter->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfSpatialFilter was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (spatial_filter->dictionary_owner_soft);
-        free (spatial_filter->dictionary_owner_hard);
-        free (spatial_filter);
+        dxf_free (spatial_filter->dictionary_owner_soft);
+        dxf_free (spatial_filter->dictionary_owner_hard);
+        dxf_free (spatial_filter);
         spatial_filter = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -623,18 +625,19 @@ dxf_spatial_filter_free_chain
                 /*!< a pointer to the chain of DXF \c SPATIAL_FILTER objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (spatial_filters == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (spatial_filters != NULL)
         {
                 struct DxfSpatialFilter *iter = spatial_filters->next;
+                spatial_filters->next = NULL;
                 dxf_spatial_filter_free (spatial_filters);
                 spatial_filters = (DxfSpatialFilter *) iter;
         }
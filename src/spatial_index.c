@@ -35,6 +35,7 @@
 
 
 #include "spatial_index.h"
+#include "util.h"
 
 
 /*!
@@ -60,9 +61,9 @@ dxf_spatial_index_new ()
         size = sizeof (DxfSpatialIndex);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spatial_index = malloc (size)) == NULL)
+        if ((spatial_index = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSpatialIndex struct.\n")),
                   __FUNCTION__);
                 spatial_index = NULL;
@@ -108,21 +109,21 @@ dxf_spatial_index_init
         /* Do some basic checks. */
         if (spatial_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spatial_index = dxf_spatial_index_new ();
         }
         if (spatial_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSpatialIndex struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         spatial_index->id_code = 0;
-        spatial_index->dictionary_owner_soft = strdup ("");
-        spatial_index->dictionary_owner_hard = strdup ("");
+        spatial_index->dictionary_owner_soft = dxf_strdup ("");
+        spatial_index->dictionary_owner_hard = dxf_strdup ("");
         if (time (&now) != (time_t)(-1))
         {
                 struct tm *current_time = localtime (&now);
@@ -171,28 +172,26 @@ dxf_spatial_index_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (spatial_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spatial_index = dxf_spatial_index_new ();
@@ -200,16 +199,15 @@ dxf_spatial_index_read
         }
         i = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -220,7 +218,7 @@ dxf_spatial_index_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", &spatial_index->id_code);
                 }
-                if (strcmp (temp_string, "40") == 0)
+                else if (strcmp (temp_string, "40") == 0)
                 {
                         /* Now follows a string containing a timestamp
                          * (Julian date). */
@@ -237,7 +235,7 @@ dxf_spatial_index_read
                         if ((strcmp (temp_string, "AcDbIndex") != 0)
                           && (strcmp (temp_string, "AcDbSpatialIndex") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -247,7 +245,7 @@ dxf_spatial_index_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spatial_index->dictionary_owner_soft);
+                        dxf_read_string (fp, &spatial_index->dictionary_owner_soft);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
@@ -255,7 +253,7 @@ dxf_spatial_index_read
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spatial_index->dictionary_owner_hard);
+                        dxf_read_string (fp, &spatial_index->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -266,13 +264,17 @@ dxf_spatial_index_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -307,30 +309,30 @@ dxf_spatial_index_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SPATIAL_INDEX");
+        char *dxf_entity_name = dxf_strdup ("SPATIAL_INDEX");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spatial_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, spatial_index->id_code);
         }
@@ -368,13 +370,13 @@ dxf_spatial_index_write
         {
                 fprintf (fp->fp, "100\nAcDbIndex\n");
         }
-        fprintf (fp->fp, " 40\n%f\n", spatial_index->time_stamp);
+        dxf_write_real (fp, 40, spatial_index->time_stamp);
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbSpatialIndex\n");
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -409,14 +411,14 @@ dxf_spatial_index_free
         /* Do some basic checks. */
         if (spatial_index->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfSpatialIndex was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (spatial_index->dictionary_owner_soft);
-        free (spatial_index->dictionary_owner_hard);
-        free (spatial_index);
+        dxf_free (spatial_index->dictionary_owner_soft);
+        dxf_free (spatial_index->dictionary_owner_hard);
+        dxf_free (spatial_index);
         spatial_index = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -443,18 +445,19 @@ dxf_spatial_index_free_chain
                  * objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (spatial_indices == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (spatial_indices != NULL)
         {
                 struct DxfSpatialIndex *iter = spatial_indices->next;
+                spatial_indices->next = NULL;
                 dxf_spatial_index_free (spatial_indices);
                 spatial_indices = (DxfSpatialIndex *) iter;
         }
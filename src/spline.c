@@ -230,6 +230,7 @@
 
 
 #include "spline.h"
+#include "util.h"
 
 
 /*!
@@ -252,9 +253,9 @@ dxf_spline_new ()
         size = sizeof (DxfSpline);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((spline = malloc (size)) == NULL)
+        if ((spline = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSpline struct.\n")),
                   __FUNCTION__);
                 spline = NULL;
@@ -262,6 +263,7 @@ dxf_spline_new ()
         else
         {
                 memset (spline, 0, size);
+                spline->header.type = SPLINE;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -292,21 +294,21 @@ dxf_spline_init
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spline = dxf_spline_new ();
         }
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfSpline struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         spline->id_code = 0;
-        spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        spline->layer = strdup (DXF_DEFAULT_LAYER);
+        spline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        spline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         spline->elevation = 0.0;
         spline->thickness = 0.0;
         spline->linetype_scale = 1.0;
@@ -315,24 +317,24 @@ dxf_spline_init
         spline->paperspace = DXF_MODELSPACE;
         spline->graphics_data_size = 0;
         spline->shadow_mode = 0;
-        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) spline->binary_graphics_data);
-        spline->dictionary_owner_soft = strdup ("");
-        spline->material = strdup ("");
-        spline->dictionary_owner_hard = strdup ("");
+        spline->binary_graphics_data = dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+        spline->dictionary_owner_soft = dxf_strdup ("");
+        spline->material = dxf_strdup ("");
+        spline->dictionary_owner_hard = dxf_strdup ("");
         spline->lineweight = 0;
-        spline->plot_style_name = strdup ("");
+        spline->plot_style_name = dxf_strdup ("");
         spline->color_value = 0;
-        spline->color_name = strdup ("");
+        spline->color_name = dxf_strdup ("");
         spline->transparency = 0;
-        spline->p0 = dxf_point_init (spline->p0);
-        spline->p1 = dxf_point_init (spline->p1);
+        spline->p0 = dxf_point_init (dxf_point_new ());
+        spline->p1 = dxf_point_init (dxf_point_new ());
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
                 spline->knot_value[i] = 0.0;
                 spline->weight_value[i] = 0.0;
         }
-        spline->p2 = dxf_point_init (spline->p2);
-        spline->p3 = dxf_point_init (spline->p3);
+        spline->p2 = dxf_point_init (dxf_point_new ());
+        spline->p3 = dxf_point_init (dxf_point_new ());
         spline->extr_x0 = 0.0;
         spline->extr_y0 = 0.0;
         spline->extr_z0 = 0.0;
@@ -375,9 +377,13 @@ dxf_spline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i_knot_value;
         int i_weight_value;
+        int i_control_point;
+        int i_fit_point;
+        int i_binary_graphics_data;
+        char *subclass_marker = NULL;
         DxfBinaryGraphicsData *binary_graphics_data = NULL;
         DxfPoint *p0 = NULL;
         DxfPoint *p1 = NULL;
@@ -387,16 +393,14 @@ dxf_spline_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spline = dxf_spline_new ();
@@ -404,23 +408,26 @@ dxf_spline_read
         }
         i_knot_value = 0;
         i_weight_value = 0;
+        i_control_point = 0;
+        i_fit_point = 0;
+        i_binary_graphics_data = 0;
         binary_graphics_data = (DxfBinaryGraphicsData *) spline->binary_graphics_data;
         p0 = (DxfPoint *) spline->p0;
         p1 = (DxfPoint *) spline->p1;
         p2 = (DxfPoint *) spline->p2;
         p3 = (DxfPoint *) spline->p3;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
+                        dxf_free (subclass_marker);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -435,19 +442,26 @@ dxf_spline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->linetype);
+                        dxf_read_string (fp, &spline->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->layer);
+                        dxf_read_string (fp, &spline->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
                         /* Now follows a string containing the
                          * X-value of the control point coordinate
-                         * (multiple entries). */
+                         * (multiple entries), every next control
+                         * point gets a new point in the list. */
+                        if (i_control_point > 0)
+                        {
+                                p0->next = (struct DxfPoint *) dxf_point_init (dxf_point_new ());
+                                p0 = (DxfPoint *) p0->next;
+                        }
+                        i_control_point++;
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &p0->x0);
                 }
@@ -466,14 +480,19 @@ dxf_spline_read
                          * (multiple entries). */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &p0->z0);
-                        dxf_point_init ((DxfPoint *) p0->next);
-                        p0 = (DxfPoint *) p0->next;
                 }
                 else if (strcmp (temp_string, "11") == 0)
                 {
                         /* Now follows a string containing the
                          * X-coordinate of the fit point coordinate
-                         * (multiple entries). */
+                         * (multiple entries), every next fit point
+                         * gets a new point in the list. */
+                        if (i_fit_point > 0)
+                        {
+                                p1->next = (struct DxfPoint *) dxf_point_init (dxf_point_new ());
+                                p1 = (DxfPoint *) p1->next;
+                        }
+                        i_fit_point++;
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &p1->x0);
                 }
@@ -492,8 +511,6 @@ dxf_spline_read
                          * (multiple entries). */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &p1->z0);
-                        dxf_point_init ((DxfPoint *) p1->next);
-                        p1 = (DxfPoint *) p1->next;
                 }
                 else if (strcmp (temp_string, "12") == 0)
                 {
@@ -557,21 +574,34 @@ dxf_spline_read
                         /* Now follows a thickness value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &spline->thickness);
-                        i_knot_value++;
                 }
                 else if (strcmp (temp_string, "40") == 0)
                 {
                         /* Now follows a knot value (one entry per knot, multiple entries). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->knot_value[i_knot_value]);
-                        i_knot_value++;
+                        if (i_knot_value < DXF_MAX_PARAM)
+                        {
+                                fscanf (fp->fp, "%lf\n", &spline->knot_value[i_knot_value]);
+                                i_knot_value++;
+                        }
+                        else
+                        {
+                                dxf_read_string (fp, NULL);
+                        }
                 }
                 else if (strcmp (temp_string, "41") == 0)
                 {
                         /* Now follows a weight value (one entry per knot, multiple entries). */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &spline->weight_value[i_weight_value]);
-                        i_weight_value++;
+                        if (i_weight_value < DXF_MAX_PARAM)
+                        {
+                                fscanf (fp->fp, "%lf\n", &spline->weight_value[i_weight_value]);
+                                i_weight_value++;
+                        }
+                        else
+                        {
+                                dxf_read_string (fp, NULL);
+                        }
                 }
                 else if (strcmp (temp_string, "42") == 0)
                 {
@@ -596,7 +626,6 @@ dxf_spline_read
                         /* Now follows a linetype scale value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &spline->linetype_scale);
-                        i_knot_value++;
                 }
                 else if (strcmp (temp_string, "60") == 0)
                 {
@@ -656,6 +685,21 @@ dxf_spline_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &spline->graphics_data_size);
                 }
+                else if (strcmp (temp_string, "100") == 0)
+                {
+                        /* Now follows a string containing the
+                         * subclass marker value. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, &subclass_marker);
+                        if ((strcmp (subclass_marker, "AcDbEntity") != 0)
+                          && (strcmp (subclass_marker, "AcDbSpline") != 0))
+                        {
+                                /* The groups of a following subclass
+                                 * belong to the entity embedding the
+                                 * spline (like a HELIX). */
+                                break;
+                        }
+                }
                 else if (strcmp (temp_string, "284") == 0)
                 {
                         /* Now follows a string containing the shadow
@@ -666,32 +710,37 @@ dxf_spline_read
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
-                         * graphics data. */
+                         * graphics data, every next line gets a new
+                         * link in the list. */
+                        if (i_binary_graphics_data > 0)
+                        {
+                                binary_graphics_data->next = (struct DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (dxf_binary_graphics_data_new ());
+                                binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
+                        }
+                        i_binary_graphics_data++;
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) binary_graphics_data->next);
-                        binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
+                        dxf_read_string (fp, &binary_graphics_data->data_line);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing a
                          * soft-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->dictionary_owner_soft);
+                        dxf_read_string (fp, &spline->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->material);
+                        dxf_read_string (fp, &spline->material);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->dictionary_owner_hard);
+                        dxf_read_string (fp, &spline->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -705,7 +754,7 @@ dxf_spline_read
                         /* Now follows a string containing a plot style
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->plot_style_name);
+                        dxf_read_string (fp, &spline->plot_style_name);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -718,7 +767,7 @@ dxf_spline_read
                         /* Now follows a string containing a color
                          * name value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", spline->color_name);
+                        dxf_read_string (fp, &spline->color_name);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -736,22 +785,40 @@ dxf_spline_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (spline->linetype, "") == 0)
         {
-                spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_string_assign (&spline->linetype, DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (spline->layer, "") == 0)
         {
-                spline->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_string_assign (&spline->layer, DXF_DEFAULT_LAYER);
+        }
+        if (spline->number_of_knots < i_knot_value)
+        {
+                spline->number_of_knots = i_knot_value;
+        }
+        if (spline->number_of_control_points < i_control_point)
+        {
+                spline->number_of_control_points = i_control_point;
+        }
+        if (spline->number_of_fit_points < i_fit_point)
+        {
+                spline->number_of_fit_points = i_fit_point;
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (subclass_marker);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -777,7 +844,7 @@ dxf_spline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("SPLINE");
+        char *dxf_entity_name = dxf_strdup ("SPLINE");
         int i;
         DxfBinaryGraphicsData *binary_graphics_data = NULL;
         DxfPoint *p0 = NULL;
@@ -788,44 +855,44 @@ dxf_spline_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (strcmp (spline->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, spline->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                spline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                spline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (spline->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, spline->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
                 spline->layer = DXF_DEFAULT_LAYER;
@@ -882,7 +949,7 @@ dxf_spline_write
           && DXF_FLATLAND
           && (spline->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", spline->elevation);
+                dxf_write_real (fp, 38, spline->elevation);
         }
         if ((fp->acad_version_number >= AutoCAD_2007)
           && (strcmp (spline->material, "") != 0))
@@ -895,10 +962,10 @@ dxf_spline_write
         }
         if (spline->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", spline->thickness);
+                dxf_write_real (fp, 39, spline->thickness);
         }
         fprintf (fp->fp, "370\n%d\n", spline->lineweight);
-        fprintf (fp->fp, " 48\n%f\n", spline->linetype_scale);
+        dxf_write_real (fp, 48, spline->linetype_scale);
         if (spline->visibility != 0)
         {
                 fprintf (fp->fp, " 60\n%d\n", spline->visibility);
@@ -910,7 +977,7 @@ dxf_spline_write
         while (binary_graphics_data != NULL)
         {
                 fprintf (fp->fp, "310\n%s\n", binary_graphics_data->data_line);
-                binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (binary_graphics_data);
+                binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
         }
         fprintf (fp->fp, "420\n%ld\n", spline->color_value);
         fprintf (fp->fp, "430\n%s\n", spline->color_name);
@@ -923,50 +990,59 @@ dxf_spline_write
                 && (spline->extr_y0 != 0.0)
                 && (spline->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", spline->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", spline->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", spline->extr_z0);
+                dxf_write_real (fp, 210, spline->extr_x0);
+                dxf_write_real (fp, 220, spline->extr_y0);
+                dxf_write_real (fp, 230, spline->extr_z0);
         }
         fprintf (fp->fp, " 70\n%d\n", spline->flag);
         fprintf (fp->fp, " 71\n%d\n", spline->degree);
         fprintf (fp->fp, " 72\n%d\n", spline->number_of_knots);
         fprintf (fp->fp, " 73\n%d\n", spline->number_of_control_points);
         fprintf (fp->fp, " 74\n%d\n", spline->number_of_fit_points);
-        fprintf (fp->fp, " 42\n%f\n", spline->knot_tolerance);
-        fprintf (fp->fp, " 43\n%f\n", spline->control_point_tolerance);
-        fprintf (fp->fp, " 12\n%f\n", p2->x0);
-        fprintf (fp->fp, " 22\n%f\n", p2->y0);
-        fprintf (fp->fp, " 32\n%f\n", p2->z0);
-        fprintf (fp->fp, " 13\n%f\n", p3->x0);
-        fprintf (fp->fp, " 23\n%f\n", p3->y0);
-        fprintf (fp->fp, " 33\n%f\n", p3->z0);
-        for (i = 0; i < spline->number_of_knots; i++)
-        {
-                fprintf (fp->fp, " 40\n%f\n", spline->knot_value[i]);
-        }
-        if (spline->number_of_fit_points != 0)
-        {
-        for (i = 0; i < spline->number_of_fit_points; i++)
+        dxf_write_real (fp, 42, spline->knot_tolerance);
+        dxf_write_real (fp, 43, spline->control_point_tolerance);
+        dxf_write_real (fp, 12, p2->x0);
+        dxf_write_real (fp, 22, p2->y0);
+        dxf_write_real (fp, 32, p2->z0);
+        dxf_write_real (fp, 13, p3->x0);
+        dxf_write_real (fp, 23, p3->y0);
+        dxf_write_real (fp, 33, p3->z0);
+        for (i = 0; (i < spline->number_of_knots) && (i < DXF_MAX_PARAM); i++)
+        {
+                dxf_write_real (fp, 40, spline->knot_value[i]);
+        }
+        /* Weights are only present for a rational spline, one weight
+         * for every control point. */
+        if (spline->flag & 4)
+        {
+                for (i = 0; (i < spline->number_of_control_points) && (i < DXF_MAX_PARAM); i++)
                 {
-                        fprintf (fp->fp, " 41\n%f\n", spline->weight_value[i]);
+                        dxf_write_real (fp, 41, spline->weight_value[i]);
                 }
         }
-        while (spline->p0 != NULL)
+        /* The list of control points (and of fit points) starts with
+         * the point allocated by dxf_spline_init (), only as many
+         * points as the spline counts are written. */
+        i = 0;
+        while ((p0 != NULL) && (i < spline->number_of_control_points))
         {
-                fprintf (fp->fp, " 10\n%f\n", p0->x0);
-                fprintf (fp->fp, " 20\n%f\n", p0->y0);
-                fprintf (fp->fp, " 30\n%f\n", p0->z0);
-                p0 = (DxfPoint *) dxf_point_get_next (p0);
+                dxf_write_real (fp, 10, p0->x0);
+                dxf_write_real (fp, 20, p0->y0);
+                dxf_write_real (fp, 30, p0->z0);
+                p0 = (DxfPoint *) p0->next;
+                i++;
         }
-        while (spline->p1 != NULL)
+        i = 0;
+        while ((p1 != NULL) && (i < spline->number_of_fit_points))
         {
-                fprintf (fp->fp, " 11\n%f\n", p1->x0);
-                fprintf (fp->fp, " 21\n%f\n", p1->y0);
-                fprintf (fp->fp, " 31\n%f\n", p1->z0);
-                p1 = (DxfPoint *) dxf_point_get_next (p1);
+                dxf_write_real (fp, 11, p1->x0);
+                dxf_write_real (fp, 21, p1->y0);
+                dxf_write_real (fp, 31, p1->z0);
+                p1 = (DxfPoint *) p1->next;
+                i++;
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -994,20 +1070,36 @@ dxf_spline_free
 #endif
         if (spline->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfSpline was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (spline->linetype);
-        free (spline->layer);
-        free (spline->dictionary_owner_soft);
-        free (spline->material);
-        free (spline->dictionary_owner_hard);
-        free (spline->plot_style_name);
-        free (spline->color_name);
+        dxf_free (spline->linetype);
+        dxf_free (spline->layer);
+        dxf_free (spline->dictionary_owner_soft);
+        dxf_free (spline->material);
+        dxf_free (spline->dictionary_owner_hard);
+        dxf_free (spline->plot_style_name);
+        dxf_free (spline->color_name);
         dxf_binary_graphics_data_free_chain (spline->binary_graphics_data);
-        free (spline);
+        if (spline->p0 != NULL)
+        {
+                dxf_point_free_chain (spline->p0);
+        }
+        if (spline->p1 != NULL)
+        {
+                dxf_point_free_chain (spline->p1);
+        }
+        if (spline->p2 != NULL)
+        {
+                dxf_point_free (spline->p2);
+        }
+        if (spline->p3 != NULL)
+        {
+                dxf_point_free (spline->p3);
+        }
+        dxf_free (spline);
         spline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1027,18 +1119,19 @@ dxf_spline_free_chain
                 /*!< a pointer to the chain of DXF \c SPLINE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (splines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (splines != NULL)
         {
                 struct DxfSpline *iter = splines->next;
+                splines->next = NULL;
                 dxf_spline_free (splines);
                 splines = (DxfSpline *) iter;
         }
@@ -1067,14 +1160,14 @@ dxf_spline_get_id_code
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the id_code member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1108,14 +1201,14 @@ dxf_spline_set_id_code
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (id_code < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative id-code value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1146,14 +1239,14 @@ dxf_spline_get_linetype
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->linetype ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the linetype member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1161,7 +1254,7 @@ dxf_spline_get_linetype
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->linetype));
+        return (dxf_strdup (spline->linetype));
 }
 
 
@@ -1186,19 +1279,19 @@ dxf_spline_set_linetype
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->linetype = strdup (linetype);
+        spline->linetype = dxf_strdup (linetype);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1224,14 +1317,14 @@ dxf_spline_get_layer
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->layer ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the layer member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1239,7 +1332,7 @@ dxf_spline_get_layer
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->layer));
+        return (dxf_strdup (spline->layer));
 }
 
 
@@ -1264,19 +1357,19 @@ dxf_spline_set_layer
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (layer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->layer = strdup (layer);
+        spline->layer = dxf_strdup (layer);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1303,7 +1396,7 @@ dxf_spline_get_elevation
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1336,7 +1429,7 @@ dxf_spline_set_elevation
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1368,14 +1461,14 @@ dxf_spline_get_thickness
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the thickness member.\n")),
                   __FUNCTION__);
         }
@@ -1407,14 +1500,14 @@ dxf_spline_set_thickness
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (thickness < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative thickness value was passed.\n")),
                   __FUNCTION__);
         }
@@ -1445,14 +1538,14 @@ dxf_spline_get_linetype_scale
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the linetype scale member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1485,14 +1578,14 @@ dxf_spline_set_linetype_scale
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (linetype_scale < 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative linetype scale value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1524,21 +1617,21 @@ dxf_spline_get_visibility
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the visibility member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1571,21 +1664,21 @@ dxf_spline_set_visibility
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (visibility > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range visibility value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1617,14 +1710,14 @@ dxf_spline_get_color
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the color member.\n")),
                   __FUNCTION__);
         }
@@ -1656,17 +1749,17 @@ dxf_spline_set_color
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative color value was passed.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_INFO,
                   (_("\teffectively turning this entity it's visibility off.\n")));
         }
         spline->color = color;
@@ -1696,20 +1789,20 @@ dxf_spline_get_paperspace
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
         if (spline->paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () an out of range value was found in the paperspace member.\n")),
                   __FUNCTION__);
         }
@@ -1742,21 +1835,21 @@ dxf_spline_set_paperspace
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (paperspace > 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range paperspace value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1788,20 +1881,20 @@ dxf_spline_get_graphics_data_size
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a negative value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
         if (spline->graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a zero value was found in the graphics_data_size member.\n")),
                   __FUNCTION__);
         }
@@ -1834,21 +1927,21 @@ dxf_spline_set_graphics_data_size
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (graphics_data_size == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a zero graphics_data_size value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1880,21 +1973,21 @@ dxf_spline_get_shadow_mode
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (spline->shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range value was found in the shadow_mode member.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -1927,21 +2020,21 @@ dxf_spline_set_shadow_mode
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode < 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a negative shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (shadow_mode > 3)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () an out of range shadow_mode value was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -1976,14 +2069,14 @@ dxf_spline_get_binary_graphics_data
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->binary_graphics_data ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the binary_graphics_data member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2018,14 +2111,14 @@ dxf_spline_set_binary_graphics_data
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2060,14 +2153,14 @@ dxf_spline_get_dictionary_owner_soft
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->dictionary_owner_soft ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_soft member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2075,7 +2168,7 @@ dxf_spline_get_dictionary_owner_soft
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->dictionary_owner_soft));
+        return (dxf_strdup (spline->dictionary_owner_soft));
 }
 
 
@@ -2102,19 +2195,19 @@ dxf_spline_set_dictionary_owner_soft
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_soft == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->dictionary_owner_soft = strdup (dictionary_owner_soft);
+        spline->dictionary_owner_soft = dxf_strdup (dictionary_owner_soft);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2143,14 +2236,14 @@ dxf_spline_get_material
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->material ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the material member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2158,7 +2251,7 @@ dxf_spline_get_material
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->material));
+        return (dxf_strdup (spline->material));
 }
 
 
@@ -2184,19 +2277,19 @@ dxf_spline_set_material
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (material == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->material = strdup (material);
+        spline->material = dxf_strdup (material);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2226,14 +2319,14 @@ dxf_spline_get_dictionary_owner_hard
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->dictionary_owner_hard ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the dictionary_owner_hard member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2241,7 +2334,7 @@ dxf_spline_get_dictionary_owner_hard
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->dictionary_owner_hard));
+        return (dxf_strdup (spline->dictionary_owner_hard));
 }
 
 
@@ -2268,19 +2361,19 @@ dxf_spline_set_dictionary_owner_hard
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (dictionary_owner_hard == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->dictionary_owner_hard = strdup (dictionary_owner_hard);
+        spline->dictionary_owner_hard = dxf_strdup (dictionary_owner_hard);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2307,7 +2400,7 @@ dxf_spline_get_lineweight
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2340,7 +2433,7 @@ dxf_spline_set_lineweight
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2372,14 +2465,14 @@ dxf_spline_get_plot_style_name
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->plot_style_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the plot_style_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2387,7 +2480,7 @@ dxf_spline_get_plot_style_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->plot_style_name));
+        return (dxf_strdup (spline->plot_style_name));
 }
 
 
@@ -2413,19 +2506,19 @@ dxf_spline_set_plot_style_name
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (plot_style_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->plot_style_name = strdup (plot_style_name);
+        spline->plot_style_name = dxf_strdup (plot_style_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2452,7 +2545,7 @@ dxf_spline_get_color_value
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2485,7 +2578,7 @@ dxf_spline_set_color_value
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2517,14 +2610,14 @@ dxf_spline_get_color_name
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->color_name ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the color_name member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2532,7 +2625,7 @@ dxf_spline_get_color_name
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (spline->color_name));
+        return (dxf_strdup (spline->color_name));
 }
 
 
@@ -2558,19 +2651,19 @@ dxf_spline_set_color_name
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (color_name == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        spline->color_name = strdup (color_name);
+        spline->color_name = dxf_strdup (color_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2597,7 +2690,7 @@ dxf_spline_get_transparency
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -2630,7 +2723,7 @@ dxf_spline_set_transparency
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2664,14 +2757,14 @@ dxf_spline_get_p0
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->p0 ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the p0 member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2707,14 +2800,14 @@ dxf_spline_set_p0
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2748,14 +2841,14 @@ dxf_spline_get_p1
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (spline->p1 ==  NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was found in the p1 member.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -2791,14 +2884,14 @@ dxf_spline_set_p1
         /* Do some basic checks. */
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         if (p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
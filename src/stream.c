@@ -0,0 +1,756 @@
+/*!
+ * \file stream.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF streaming output of drawings with an
+ * unlimited number of entities.
+ *
+ * A stream writes the sections of a drawing preceding the \c ENTITIES
+ * section when it is opened, the entities are then written one at a
+ * time as they are produced, without being kept in memory.\n
+ * The header variables depending on the entities, \c $EXTMIN,
+ * \c $EXTMAX and \c $HANDSEED, are written as fixed width fields when
+ * the stream is opened and overwritten in place when the stream is
+ * closed, the output file has to be seekable.\n
+ * \n
+ * Usage:
+ * <pre>
+ * stream = dxf_stream_open ("out.dxf", drawing, AutoCAD_2000);
+ * while (...)
+ * {
+ *         dxf_stream_write_line (stream, line);
+ * }
+ * dxf_stream_close (stream);
+ * </pre>
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "stream.h"
+#include "endsec.h"
+#include "entity_vtable.h"
+#include "section.h"
+#include "tracing.h"
+
+
+/*!
+ * \brief Copy the \c HEADER section to the stream, reserving fixed width
+ * fields for the values of a header variable.
+ *
+ * The text of \c buffer from \c *position up to and including the
+ * group codes of the values of \c variable is written, every value is
+ * replaced by \c width characters which are overwritten when the
+ * stream is closed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * variable was not found.
+ */
+static int
+dxf_stream_reserve
+(
+        DxfStream *stream,
+                /*!< the stream. */
+        const char *buffer,
+                /*!< the text of the \c HEADER section, terminated. */
+        size_t *position,
+                /*!< position in \c buffer of the text not yet written,
+                 * updated. */
+        const char *variable,
+                /*!< name of the header variable, with a leading \c $. */
+        int number_of_values,
+                /*!< number of values of the variable. */
+        off_t *offsets,
+                /*!< offsets of the reserved fields in the output file,
+                 * set on success. */
+        int width
+                /*!< width of the reserved fields. */
+)
+{
+        char key[DXF_MAX_STRING_LENGTH];
+        const char *start;
+        const char *end;
+        int i;
+
+        snprintf (key, sizeof (key), "\n%s\n", variable);
+        start = strstr (buffer + *position, key);
+        if (start == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        end = start + strlen (key);
+        for (i = 0; i < number_of_values; i++)
+        {
+                /* Write up to and including the group code. */
+                end = strchr (end, '\n');
+                if (end == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                end++;
+                fwrite (buffer + *position, 1, end - (buffer + *position), stream->file.fp);
+                offsets[i] = ftello (stream->file.fp);
+                fprintf (stream->file.fp, "%*s\n", width, "0");
+                /* Skip the value. */
+                end = strchr (end, '\n');
+                if (end == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                end++;
+                *position = end - buffer;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write the \c HEADER section of the drawing to the stream,
+ * reserving the fields of \c $EXTMIN, \c $EXTMAX and \c $HANDSEED.
+ *
+ * The section is formatted by \c dxf_header_write () into memory first.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_stream_write_header
+(
+        DxfStream *stream
+                /*!< the stream. */
+)
+{
+        DxfFile header_file;
+        char *buffer = NULL;
+        size_t size = 0;
+        size_t position = 0;
+        int result;
+
+        header_file = stream->file;
+        header_file.fp = open_memstream (&buffer, &size);
+        if (header_file.fp == NULL)
+        {
+                dxf_diagnostic (&stream->file, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the header.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        result = dxf_header_write (&header_file, (DxfHeader *) stream->drawing->header);
+        /* Terminates the buffer as well. */
+        fclose (header_file.fp);
+        if (result == EXIT_SUCCESS)
+        {
+                /* The variables are written in this order. */
+                if ((dxf_stream_reserve (stream, buffer, &position, "$EXTMIN", 3,
+                  stream->extmin_offsets, DXF_STREAM_REAL_WIDTH) != EXIT_SUCCESS)
+                  || (dxf_stream_reserve (stream, buffer, &position, "$EXTMAX", 3,
+                  stream->extmax_offsets, DXF_STREAM_REAL_WIDTH) != EXIT_SUCCESS)
+                  || (dxf_stream_reserve (stream, buffer, &position, "$HANDSEED", 1,
+                  &stream->handseed_offset, DXF_STREAM_HANDLE_WIDTH) != EXIT_SUCCESS))
+                {
+                        dxf_diagnostic (&stream->file, DXF_DIAGNOSTIC_WARNING,
+                          (_("Warning in %s () the extents and the handle seed could not all be reserved in the header.\n")),
+                          __FUNCTION__);
+                }
+                fwrite (buffer + position, 1, size - position, stream->file.fp);
+        }
+        /* The memory stream allocated its buffer with malloc (). */
+        free (buffer);
+        return (result);
+}
+
+
+/*!
+ * \brief Test if entities of the type of \c entity can be written to a
+ * stream, only types with extents can as the extents of the drawing are
+ * written in the \c HEADER section.
+ *
+ * \return \c EXIT_SUCCESS when they can, or \c EXIT_FAILURE when not.
+ */
+static int
+dxf_stream_check_type
+(
+        DxfFile *fp,
+                /*!< the output file, for diagnostics. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+        const DxfEntityVtable *vtable;
+
+        vtable = dxf_entity_get_vtable (DXF_ENTITY_HEADER (entity)->type);
+        if ((vtable == NULL) || (vtable->extents == NULL))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the extents of a %s entity are not known, it can not be streamed.\n")),
+                  __FUNCTION__,
+                  dxf_tracing_entity_name (DXF_ENTITY_HEADER (entity)->type));
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test if a handle set by the caller can be written to a stream.
+ *
+ * Handles below the handle seed of the drawing belong to the drawing,
+ * other handles must not have been written to the stream before.
+ *
+ * \return \c EXIT_SUCCESS when it can, or \c EXIT_FAILURE when not.
+ */
+static int
+dxf_stream_check_handle
+(
+        DxfStream *stream,
+                /*!< the stream. */
+        int id_code
+                /*!< the handle. */
+)
+{
+        size_t index;
+
+        if (id_code < 0)
+        {
+                dxf_diagnostic (&stream->file, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the handle %d is not valid.\n")),
+                  __FUNCTION__, id_code);
+                return (EXIT_FAILURE);
+        }
+        if (id_code < stream->first_handle)
+        {
+                /* The handles of the entities of the drawing are
+                 * validated when the stream is opened. */
+                if (!stream->is_open)
+                {
+                        return (EXIT_SUCCESS);
+                }
+                dxf_diagnostic (&stream->file, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the handle %X is below the handle seed %X of the drawing.\n")),
+                  __FUNCTION__, id_code, stream->first_handle);
+                return (EXIT_FAILURE);
+        }
+        index = (size_t) (id_code - stream->first_handle);
+        if ((index / 8 < stream->handles_size)
+          && (stream->handles[index / 8] & (1 << (index % 8))))
+        {
+                dxf_diagnostic (&stream->file, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () the handle %X was already written.\n")),
+                  __FUNCTION__, id_code);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Record a handle written to a stream.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_stream_add_handle
+(
+        DxfStream *stream,
+                /*!< the stream. */
+        int id_code
+                /*!< the handle. */
+)
+{
+        unsigned char *handles;
+        size_t index;
+        size_t size;
+
+        if (id_code < stream->first_handle)
+        {
+                return (EXIT_SUCCESS);
+        }
+        index = (size_t) (id_code - stream->first_handle);
+        if (index / 8 >= stream->handles_size)
+        {
+                size = (stream->handles_size > 0) ? stream->handles_size : DXF_STREAM_HANDLES_SIZE;
+                while (index / 8 >= size)
+                {
+                        size *= 2;
+                }
+                handles = dxf_realloc (stream->handles, size);
+                if (handles == NULL)
+                {
+                        dxf_diagnostic (&stream->file, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory for the handle %X.\n")),
+                          __FUNCTION__, id_code);
+                        return (EXIT_FAILURE);
+                }
+                memset (handles + stream->handles_size, 0, size - stream->handles_size);
+                stream->handles = handles;
+                stream->handles_size = size;
+        }
+        stream->handles[index / 8] |= (1 << (index % 8));
+        if (id_code >= stream->next_handle)
+        {
+                stream->next_handle = id_code + 1;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Open a new DXF file for streaming output.
+ *
+ * The handles of the drawing are validated, then the \c HEADER,
+ * \c CLASSES, \c TABLES and \c BLOCKS sections of the drawing are
+ * written and the \c ENTITIES section is started.\n
+ * Entities in the entities container of the drawing are written
+ * first, the entities passed to \c dxf_stream_write_entity () follow
+ * them.\n
+ * A drawing holding entities of a type without extents, see
+ * \c dxf_entity_get_extents (), can not be streamed.\n
+ * The drawing has to stay valid until \c dxf_stream_close () returns,
+ * its \c OBJECTS and \c THUMBNAILIMAGE sections are written when the
+ * stream is closed.
+ *
+ * \return a pointer to the stream, or \c NULL when an error occurred.
+ */
+DxfStream *
+dxf_stream_open
+(
+        const char *filename,
+                /*!< filename of the output file. */
+        DxfDrawing *drawing,
+                /*!< a pointer to the drawing. */
+        int acad_version_number
+                /*!< AutoCAD version number of the output file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfStream *stream;
+        DxfEntities *entities;
+        size_t i;
+        int i_coordinate;
+
+        /* Do some basic checks. */
+        if ((filename == NULL) || (strcmp (filename, "") == 0))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () no filename was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((drawing == NULL) || (drawing->header == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        stream = dxf_malloc (sizeof (DxfStream));
+        if (stream == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (stream, 0, sizeof (DxfStream));
+        stream->drawing = drawing;
+        stream->result = EXIT_SUCCESS;
+        stream->handseed_offset = -1;
+        for (i_coordinate = 0; i_coordinate < 3; i_coordinate++)
+        {
+                stream->extmin_offsets[i_coordinate] = -1;
+                stream->extmax_offsets[i_coordinate] = -1;
+        }
+        dxf_extents_init (&stream->extents);
+        stream->file.acad_version_number = acad_version_number;
+        stream->file.filename = dxf_strdup (filename);
+        if (dxf_file_validate_handles (&stream->file, drawing, &stream->next_handle) != EXIT_SUCCESS)
+        {
+                dxf_free (stream->file.filename);
+                dxf_free (stream);
+                return (NULL);
+        }
+        stream->first_handle = stream->next_handle;
+        entities = (DxfEntities *) drawing->entities_list;
+        if (entities != NULL)
+        {
+                for (i = 0; i < entities->number_of_entities; i++)
+                {
+                        if ((!(DXF_ENTITY_HEADER (entities->entities[i])->flags & DXF_ENTITY_FLAG_ERASED))
+                          && (dxf_stream_check_type (&stream->file, entities->entities[i]) != EXIT_SUCCESS))
+                        {
+                                dxf_free (stream->file.filename);
+                                dxf_free (stream);
+                                return (NULL);
+                        }
+                }
+        }
+        stream->file.fp = fopen (filename, "w");
+        if (stream->file.fp == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not open file: %s for writing.\n")),
+                  __FUNCTION__, filename);
+                dxf_free (stream->file.filename);
+                dxf_free (stream);
+                return (NULL);
+        }
+        setvbuf (stream->file.fp, NULL, _IOFBF, DXF_FILE_WRITE_BUFFER_SIZE);
+        stream->result |= dxf_stream_write_header (stream);
+        /* The default symbol table entries take the handles following
+         * the handles of the drawing. */
+        stream->file.last_id_code = stream->next_handle - 1;
+        stream->result |= dxf_file_write_before_entities (&stream->file, drawing);
+        stream->next_handle = stream->file.last_id_code + 1;
+        stream->first_handle = stream->next_handle;
+        dxf_section_write (&stream->file, "ENTITIES");
+        if (entities != NULL)
+        {
+                for (i = 0; i < entities->number_of_entities; i++)
+                {
+                        if (DXF_ENTITY_HEADER (entities->entities[i])->flags & DXF_ENTITY_FLAG_ERASED)
+                        {
+                                continue;
+                        }
+                        if (dxf_stream_write_entity (stream, entities->entities[i]) != EXIT_SUCCESS)
+                        {
+                                stream->result = EXIT_FAILURE;
+                        }
+                }
+        }
+        stream->is_open = TRUE;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (stream);
+}
+
+
+/*!
+ * \brief Write an entity of any type to a stream.
+ *
+ * An entity without a handle (an \c id_code of 0) is given the next
+ * free handle, an entity with an \c id_code of -1 is written without a
+ * handle.\n
+ * An entity with a handle below the handle seed of the drawing, or with
+ * a handle written before, is refused, as are entities of a type
+ * without extents.\n
+ * The entity is not kept by the stream, it can be freed or reused for
+ * the next entity as soon as this function returns.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_stream_write_entity
+(
+        DxfStream *stream,
+                /*!< a pointer to the stream. */
+        void *entity
+                /*!< a pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfExtents extents;
+        int id_code;
+
+        /* Do some basic checks. */
+        if ((stream == NULL) || (entity == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_stream_check_type (&stream->file, entity) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        id_code = dxf_entity_get_id_code (entity);
+        if (id_code == 0)
+        {
+                id_code = stream->next_handle;
+                dxf_entity_set_id_code (entity, id_code);
+        }
+        else if ((id_code != -1)
+          && (dxf_stream_check_handle (stream, id_code) != EXIT_SUCCESS))
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((id_code != -1)
+          && (dxf_stream_add_handle (stream, id_code) != EXIT_SUCCESS))
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_entity_write (&stream->file, entity) != EXIT_SUCCESS)
+        {
+                stream->result = EXIT_FAILURE;
+                return (EXIT_FAILURE);
+        }
+        if (dxf_entity_get_extents (entity, &extents) == EXIT_SUCCESS)
+        {
+                dxf_extents_add_extents (&stream->extents, &extents);
+        }
+        stream->number_of_entities++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Define a function writing an entity of one type to a stream,
+ * see \c dxf_stream_write_entity ().
+ */
+#define DXF_STREAM_WRITE_FUNCTION(name, type) \
+int \
+dxf_stream_write_##name (DxfStream *stream, type *entity) \
+{ \
+        return (dxf_stream_write_entity (stream, entity)); \
+}
+
+
+DXF_STREAM_WRITE_FUNCTION (arc, DxfArc)
+DXF_STREAM_WRITE_FUNCTION (attdef, DxfAttdef)
+DXF_STREAM_WRITE_FUNCTION (attrib, DxfAttrib)
+DXF_STREAM_WRITE_FUNCTION (circle, DxfCircle)
+DXF_STREAM_WRITE_FUNCTION (dimension, DxfDimension)
+DXF_STREAM_WRITE_FUNCTION (ellipse, DxfEllipse)
+DXF_STREAM_WRITE_FUNCTION (hatch, DxfHatch)
+DXF_STREAM_WRITE_FUNCTION (helix, DxfHelix)
+DXF_STREAM_WRITE_FUNCTION (image, DxfImage)
+DXF_STREAM_WRITE_FUNCTION (insert, DxfInsert)
+DXF_STREAM_WRITE_FUNCTION (leader, DxfLeader)
+DXF_STREAM_WRITE_FUNCTION (line, DxfLine)
+DXF_STREAM_WRITE_FUNCTION (lwpolyline, DxfLWPolyline)
+DXF_STREAM_WRITE_FUNCTION (mline, DxfMline)
+DXF_STREAM_WRITE_FUNCTION (mtext, DxfMtext)
+DXF_STREAM_WRITE_FUNCTION (ole2frame, DxfOle2Frame)
+DXF_STREAM_WRITE_FUNCTION (point, DxfPoint)
+DXF_STREAM_WRITE_FUNCTION (polyline, DxfPolyline)
+DXF_STREAM_WRITE_FUNCTION (ray, DxfRay)
+DXF_STREAM_WRITE_FUNCTION (shape, DxfShape)
+DXF_STREAM_WRITE_FUNCTION (solid, DxfSolid)
+DXF_STREAM_WRITE_FUNCTION (spline, DxfSpline)
+DXF_STREAM_WRITE_FUNCTION (table, DxfTable)
+DXF_STREAM_WRITE_FUNCTION (text, DxfText)
+DXF_STREAM_WRITE_FUNCTION (tolerance, DxfTolerance)
+DXF_STREAM_WRITE_FUNCTION (trace, DxfTrace)
+DXF_STREAM_WRITE_FUNCTION (viewport, DxfViewport)
+DXF_STREAM_WRITE_FUNCTION (xline, DxfXLine)
+
+
+/*!
+ * \brief Get the number of entities written to a stream so far.
+ *
+ * \return the number of entities.
+ */
+size_t
+dxf_stream_get_number_of_entities
+(
+        DxfStream *stream
+                /*!< a pointer to the stream. */
+)
+{
+        if (stream == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        return (stream->number_of_entities);
+}
+
+
+/*!
+ * \brief Get the extents of the entities written to a stream so far.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when none of
+ * the entities has extents.
+ */
+int
+dxf_stream_get_extents
+(
+        DxfStream *stream,
+                /*!< a pointer to the stream. */
+        DxfExtents *extents
+                /*!< a pointer to the extents, set on success. */
+)
+{
+        if ((stream == NULL) || (extents == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_extents_is_empty (&stream->extents))
+        {
+                return (EXIT_FAILURE);
+        }
+        *extents = stream->extents;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Overwrite a reserved field of the \c HEADER section.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * output file is not seekable.
+ */
+static int
+dxf_stream_patch
+(
+        DxfStream *stream,
+                /*!< the stream. */
+        off_t offset,
+                /*!< offset of the field, -1 when it was not reserved. */
+        const char *value
+                /*!< the value, exactly as wide as the field. */
+)
+{
+        if (offset < 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (fseeko (stream->file.fp, offset, SEEK_SET) != 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        fputs (value, stream->file.fp);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Complete a stream and close its file.
+ *
+ * The \c ENTITIES section is ended, the \c OBJECTS and
+ * \c THUMBNAILIMAGE sections of the drawing and the End Of File marker
+ * are written, then \c $EXTMIN, \c $EXTMAX and \c $HANDSEED are
+ * updated in the \c HEADER section of the file and in the header of the
+ * drawing.\n
+ * Without entities with extents \c $EXTMIN is set to 1E+20 and
+ * \c $EXTMAX to -1E+20, as AutoCAD does for an empty drawing.\n
+ * The stream is freed, the drawing is not.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred while streaming or closing.
+ */
+int
+dxf_stream_close
+(
+        DxfStream *stream
+                /*!< a pointer to the stream. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHeader *header;
+        double minimum[3];
+        double maximum[3];
+        char value[DXF_MAX_STRING_LENGTH];
+        int result;
+        int i;
+
+        /* Do some basic checks. */
+        if (stream == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_endsec_write (&stream->file);
+        result = stream->result;
+        result |= dxf_file_write_after_entities (&stream->file, stream->drawing);
+        if (dxf_extents_is_empty (&stream->extents))
+        {
+                for (i = 0; i < 3; i++)
+                {
+                        minimum[i] = 1.0E+20;
+                        maximum[i] = -1.0E+20;
+                }
+        }
+        else
+        {
+                minimum[0] = stream->extents.min_x;
+                minimum[1] = stream->extents.min_y;
+                minimum[2] = stream->extents.min_z;
+                maximum[0] = stream->extents.max_x;
+                maximum[1] = stream->extents.max_y;
+                maximum[2] = stream->extents.max_z;
+        }
+        header = (DxfHeader *) stream->drawing->header;
+        header->ExtMin.x0 = minimum[0];
+        header->ExtMin.y0 = minimum[1];
+        header->ExtMin.z0 = minimum[2];
+        header->ExtMax.x0 = maximum[0];
+        header->ExtMax.y0 = maximum[1];
+        header->ExtMax.z0 = maximum[2];
+        snprintf (value, sizeof (value), "%X", stream->next_handle);
+        dxf_free (header->HandSeed);
+        header->HandSeed = dxf_strdup (value);
+        fflush (stream->file.fp);
+        for (i = 0; i < 3; i++)
+        {
+                snprintf (value, sizeof (value), "%*.16E", DXF_STREAM_REAL_WIDTH, minimum[i]);
+                result |= dxf_stream_patch (stream, stream->extmin_offsets[i], value);
+                snprintf (value, sizeof (value), "%*.16E", DXF_STREAM_REAL_WIDTH, maximum[i]);
+                result |= dxf_stream_patch (stream, stream->extmax_offsets[i], value);
+        }
+        snprintf (value, sizeof (value), "%0*X", DXF_STREAM_HANDLE_WIDTH, stream->next_handle);
+        result |= dxf_stream_patch (stream, stream->handseed_offset, value);
+        if (fclose (stream->file.fp) != 0)
+        {
+                result = EXIT_FAILURE;
+        }
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not complete %s.\n")),
+                  __FUNCTION__, stream->file.filename);
+        }
+        dxf_free (stream->handles);
+        dxf_free (stream->file.filename);
+        dxf_free (stream);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((result == EXIT_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/* EOF */
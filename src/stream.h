@@ -0,0 +1,182 @@
+/*!
+ * \file stream.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF streaming output of drawings with an
+ * unlimited number of entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_STREAM_H
+#define LIBDXF_SRC_STREAM_H
+
+
+#include "global.h"
+#include "drawing.h"
+#include "entity.h"
+#include "arc.h"
+#include "attdef.h"
+#include "attrib.h"
+#include "circle.h"
+#include "dimension.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "helix.h"
+#include "image.h"
+#include "insert.h"
+#include "leader.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "mline.h"
+#include "mtext.h"
+#include "ole2frame.h"
+#include "point.h"
+#include "polyline.h"
+#include "ray.h"
+#include "shape.h"
+#include "solid.h"
+#include "spline.h"
+#include "table.h"
+#include "text.h"
+#include "tolerance.h"
+#include "trace.h"
+#include "viewport.h"
+#include "xline.h"
+#include <sys/types.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_STREAM_REAL_WIDTH 24
+        /*!< \brief Number of characters reserved for a coordinate of
+         * \c $EXTMIN and \c $EXTMAX in the \c HEADER section. */
+
+#define DXF_STREAM_HANDLE_WIDTH 8
+        /*!< \brief Number of hexadecimal digits reserved for
+         * \c $HANDSEED in the \c HEADER section. */
+
+#define DXF_STREAM_HANDLES_SIZE 4096
+        /*!< \brief Number of bytes first allocated for the bit set of
+         * the handles written to a stream. */
+
+
+/*!
+ * \brief DXF output stream, writing the entities of a drawing one at a
+ * time.
+ *
+ * Only the running totals and one bit for every handle from the
+ * handle seed of the drawing up to the highest handle written are kept,
+ * the entities themselves are not.
+ */
+typedef struct
+dxf_stream_struct
+{
+        DxfFile file;
+                /*!< The output file. */
+        DxfDrawing *drawing;
+                /*!< The drawing providing the sections around the
+                 * entities, owned by the caller. */
+        off_t extmin_offsets[3];
+                /*!< Offsets of the reserved values of \c $EXTMIN, or
+                 * -1 when not reserved. */
+        off_t extmax_offsets[3];
+                /*!< Offsets of the reserved values of \c $EXTMAX, or
+                 * -1 when not reserved. */
+        off_t handseed_offset;
+                /*!< Offset of the reserved value of \c $HANDSEED, or -1
+                 * when not reserved. */
+        DxfExtents extents;
+                /*!< Extents of the entities written so far. */
+        int next_handle;
+                /*!< Handle assigned to the next entity without one. */
+        int first_handle;
+                /*!< Handle seed of the drawing when the stream was
+                 * opened, lower handles belong to the drawing. */
+        unsigned char *handles;
+                /*!< Bit set of the handles from \c first_handle written
+                 * so far. */
+        size_t handles_size;
+                /*!< Number of bytes allocated for \c handles. */
+        int is_open;
+                /*!< \c TRUE once the entities of the drawing are
+                 * written. */
+        size_t number_of_entities;
+                /*!< Number of entities written so far. */
+        int result;
+                /*!< \c EXIT_FAILURE when an error occurred so far. */
+} DxfStream;
+
+
+DxfStream *dxf_stream_open (const char *filename, DxfDrawing *drawing, int acad_version_number);
+int dxf_stream_write_entity (DxfStream *stream, void *entity);
+int dxf_stream_write_arc (DxfStream *stream, DxfArc *entity);
+int dxf_stream_write_attdef (DxfStream *stream, DxfAttdef *entity);
+int dxf_stream_write_attrib (DxfStream *stream, DxfAttrib *entity);
+int dxf_stream_write_circle (DxfStream *stream, DxfCircle *entity);
+int dxf_stream_write_dimension (DxfStream *stream, DxfDimension *entity);
+int dxf_stream_write_ellipse (DxfStream *stream, DxfEllipse *entity);
+int dxf_stream_write_hatch (DxfStream *stream, DxfHatch *entity);
+int dxf_stream_write_helix (DxfStream *stream, DxfHelix *entity);
+int dxf_stream_write_image (DxfStream *stream, DxfImage *entity);
+int dxf_stream_write_insert (DxfStream *stream, DxfInsert *entity);
+int dxf_stream_write_leader (DxfStream *stream, DxfLeader *entity);
+int dxf_stream_write_line (DxfStream *stream, DxfLine *entity);
+int dxf_stream_write_lwpolyline (DxfStream *stream, DxfLWPolyline *entity);
+int dxf_stream_write_mline (DxfStream *stream, DxfMline *entity);
+int dxf_stream_write_mtext (DxfStream *stream, DxfMtext *entity);
+int dxf_stream_write_ole2frame (DxfStream *stream, DxfOle2Frame *entity);
+int dxf_stream_write_point (DxfStream *stream, DxfPoint *entity);
+int dxf_stream_write_polyline (DxfStream *stream, DxfPolyline *entity);
+int dxf_stream_write_ray (DxfStream *stream, DxfRay *entity);
+int dxf_stream_write_shape (DxfStream *stream, DxfShape *entity);
+int dxf_stream_write_solid (DxfStream *stream, DxfSolid *entity);
+int dxf_stream_write_spline (DxfStream *stream, DxfSpline *entity);
+int dxf_stream_write_table (DxfStream *stream, DxfTable *entity);
+int dxf_stream_write_text (DxfStream *stream, DxfText *entity);
+int dxf_stream_write_tolerance (DxfStream *stream, DxfTolerance *entity);
+int dxf_stream_write_trace (DxfStream *stream, DxfTrace *entity);
+int dxf_stream_write_viewport (DxfStream *stream, DxfViewport *entity);
+int dxf_stream_write_xline (DxfStream *stream, DxfXLine *entity);
+size_t dxf_stream_get_number_of_entities (DxfStream *stream);
+int dxf_stream_get_extents (DxfStream *stream, DxfExtents *extents);
+int dxf_stream_close (DxfStream *stream);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_STREAM_H */
+
+
+/* EOF */
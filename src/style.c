@@ -33,6 +33,7 @@
 
 
 #include "style.h"
+#include "util.h"
 
 
 /*!
@@ -61,9 +62,9 @@ dxf_style_new ()
         size = sizeof (DxfStyle);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((style = malloc (size)) == NULL)
+        if ((style = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfStyle struct.\n")),
                   __FUNCTION__);
                 style = NULL;
@@ -105,28 +106,30 @@ dxf_style_init
         /* Do some basic checks. */
         if (style == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 style = dxf_style_new ();
         }
         if (style == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfStyle struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         style->id_code = 0;
-        style->style_name = strdup ("");
-        style->primary_font_filename = strdup ("");
-        style->big_font_filename = strdup ("");
+        style->style_name = dxf_strdup ("");
+        style->primary_font_filename = dxf_strdup ("");
+        style->big_font_filename = dxf_strdup ("");
         style->height = 0.0;
         style->width = 0.0;
         style->last_height = 0.0;
         style->oblique_angle = 0.0;
         style->flag = 0;
         style->text_generation_flag = 0;
+        style->dictionary_owner_soft = dxf_strdup ("");
+        style->dictionary_owner_hard = dxf_strdup ("");
         style->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -164,38 +167,34 @@ dxf_style_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (style == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 style = dxf_style_new ();
                 style = dxf_style_init (style);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -209,21 +208,21 @@ dxf_style_read
                 {
                         /* Now follows a string containing a style name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", style->style_name);
+                        dxf_read_string (fp, &style->style_name);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a primary
                          * font filename. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", style->primary_font_filename);
+                        dxf_read_string (fp, &style->primary_font_filename);
                 }
                 else if (strcmp (temp_string, "4") == 0)
                 {
                         /* Now follows a string containing a big font
                          * filename. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", style->big_font_filename);
+                        dxf_read_string (fp, &style->big_font_filename);
                 }
                 else if (strcmp (temp_string, "40") == 0)
                 {
@@ -277,7 +276,7 @@ dxf_style_read
                         if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
                         && ((strcmp (temp_string, "AcDbTextStyleTableRecord") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -287,14 +286,14 @@ dxf_style_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", style->dictionary_owner_soft);
+                        dxf_read_string (fp, &style->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", style->dictionary_owner_hard);
+                        dxf_read_string (fp, &style->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -305,29 +304,35 @@ dxf_style_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (style->style_name, "") == 0)
         {
-                sprintf (style->style_name, "%i", style->id_code);
-                fprintf (stderr,
+                snprintf (temp_string, DXF_MAX_STRING_LENGTH, "%i", style->id_code);
+                dxf_string_assign (&style->style_name, temp_string);
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal style name value found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
         }
         if ((strcmp (style->primary_font_filename, "") == 0)
           && (style->flag == 1))
         {
-                sprintf (style->primary_font_filename, "%i", style->id_code);
-                fprintf (stderr,
+                snprintf (temp_string, DXF_MAX_STRING_LENGTH, "%i", style->id_code);
+                dxf_string_assign (&style->primary_font_filename, temp_string);
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal primary font filename value found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -359,25 +364,25 @@ dxf_style_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("STYLE");
+        char *dxf_entity_name = dxf_strdup ("STYLE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (style == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -417,15 +422,15 @@ dxf_style_write
         }
         fprintf (fp->fp, "  2\n%s\n", style->style_name);
         fprintf (fp->fp, " 70\n%d\n", style->flag);
-        fprintf (fp->fp, " 40\n%f\n", style->height);
-        fprintf (fp->fp, " 41\n%f\n", style->width);
-        fprintf (fp->fp, " 50\n%f\n", style->oblique_angle);
+        dxf_write_real (fp, 40, style->height);
+        dxf_write_real (fp, 41, style->width);
+        dxf_write_real (fp, 50, style->oblique_angle);
         fprintf (fp->fp, " 71\n%d\n", style->text_generation_flag);
-        fprintf (fp->fp, " 42\n%f\n", style->last_height);
+        dxf_write_real (fp, 42, style->last_height);
         fprintf (fp->fp, "  3\n%s\n", style->primary_font_filename);
         fprintf (fp->fp, "  4\n%s\n", style->big_font_filename);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -459,15 +464,17 @@ dxf_style_free
 #endif
         if (style->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfStyle was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (style->style_name);
-        free (style->primary_font_filename);
-        free (style->big_font_filename);
-        free (style);
+        dxf_free (style->style_name);
+        dxf_free (style->primary_font_filename);
+        dxf_free (style->big_font_filename);
+        dxf_free (style->dictionary_owner_soft);
+        dxf_free (style->dictionary_owner_hard);
+        dxf_free (style);
         style = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -494,18 +501,19 @@ dxf_style_free_chain
                  * entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (styles == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (styles != NULL)
         {
                 struct DxfStyle *iter = styles->next;
+                styles->next = NULL;
                 dxf_style_free (styles);
                 styles = (DxfStyle *) iter;
         }
@@ -542,7 +550,7 @@ dxf_style_is_shape_file
         /* Do some basic checks. */
         if (style == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -583,7 +591,7 @@ dxf_style_is_text_vertical
         /* Do some basic checks. */
         if (style == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -624,7 +632,7 @@ dxf_style_is_xreferenced
         /* Do some basic checks. */
         if (style == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -667,7 +675,7 @@ dxf_style_is_xresolved
         /* Do some basic checks. */
         if (style == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
@@ -709,7 +717,7 @@ dxf_style_is_referenced
         /* Do some basic checks. */
         if (style == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (-1);
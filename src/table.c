@@ -35,6 +35,7 @@
 
 
 #include "table.h"
+#include "util.h"
 
 
 /*!
@@ -64,9 +65,9 @@ dxf_table_cell_new ()
         size = sizeof (DxfTableCell);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((cell = malloc (size)) == NULL)
+        if ((cell = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTableCell struct.\n")),
                   __FUNCTION__);
                 cell = NULL;
@@ -109,9 +110,9 @@ dxf_table_new ()
         size = sizeof (DxfTable);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((table = malloc (size)) == NULL)
+        if ((table = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTable struct.\n")),
                   __FUNCTION__);
                 table = NULL;
@@ -119,6 +120,7 @@ dxf_table_new ()
         else
         {
                 memset (table, 0, size);
+                table->header.type = TABLE;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -156,25 +158,25 @@ dxf_table_cell_init
         /* Do some basic checks. */
         if (cell == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 cell = dxf_table_cell_new ();
         }
         if (cell == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTableCell struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        cell->text_string = strdup ("");
+        cell->text_string = dxf_strdup ("");
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                cell->optional_text_string[i] = strdup ("");
-                cell->attdef_soft_pointer[i] = strdup ("");
+                cell->optional_text_string[i] = dxf_strdup ("");
+                cell->attdef_soft_pointer[i] = dxf_strdup ("");
         }
-        cell->text_style_name = strdup (DXF_DEFAULT_TEXTSTYLE);
+        cell->text_style_name = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);
         cell->color_bg = 0;
         cell->color_fg = DXF_COLOR_BYLAYER;
         cell->border_color_right = DXF_COLOR_BYLAYER;
@@ -203,9 +205,9 @@ dxf_table_cell_init
         cell->border_visibility_override_bottom = 0;
         cell->border_visibility_override_left = 0;
         cell->border_visibility_override_top = 0;
-        cell->attdef_text_string = strdup ("");
-        cell->block_table_record_hard_pointer = strdup ("");
-        cell->field_object_pointer = strdup ("");
+        cell->attdef_text_string = dxf_strdup ("");
+        cell->block_table_record_hard_pointer = dxf_strdup ("");
+        cell->field_object_pointer = dxf_strdup ("");
         cell->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -243,21 +245,21 @@ dxf_table_init
         /* Do some basic checks. */
         if (table == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 table = dxf_table_new ();
         }
         if (table == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTable struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         table->id_code = 0;
-        table->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        table->layer = strdup (DXF_DEFAULT_LAYER);
+        table->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        table->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         table->elevation = 0.0;
         table->thickness = 0.0;
         table->visibility = 0;
@@ -266,14 +268,14 @@ dxf_table_init
         table->graphics_data_size = 0;
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                table->binary_graphics_data[i] = strdup ("");
+                table->binary_graphics_data[i] = dxf_strdup ("");
                 table->row_height[i] = 0.0;
                 table->column_height[i] = 0.0;
         }
-        table->dictionary_owner_soft = strdup ("");
-        table->dictionary_owner_hard = strdup ("");
-        table->block_name = strdup ("");
-        table->table_text_style_name = strdup ("");
+        table->dictionary_owner_soft = dxf_strdup ("");
+        table->dictionary_owner_hard = dxf_strdup ("");
+        table->block_name = dxf_strdup ("");
+        table->table_text_style_name = dxf_strdup ("");
         table->x0 = 0.0;
         table->y0 = 0.0;
         table->z0 = 0.0;
@@ -302,8 +304,8 @@ dxf_table_init
         table->suppress_table_title = 0;
         table->suppress_header_row = 0;
         table->table_cell_color_fill_override = 0;
-        table->tablestyle_object_pointer = strdup ("");
-        table->owning_block_pointer = strdup ("");
+        table->tablestyle_object_pointer = dxf_strdup ("");
+        table->owning_block_pointer = dxf_strdup ("");
         table->cells = NULL;
         table->next = NULL;
 #if DEBUG
@@ -343,7 +345,7 @@ dxf_table_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
         int j;
         int k;
@@ -352,16 +354,14 @@ dxf_table_read
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (table == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 table = dxf_table_new ();
@@ -372,24 +372,22 @@ dxf_table_read
         k = 0;
         l = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a block name;
                          * an anonymous block begins with a *T value. */
-                        fscanf (fp->fp, "%s\n", table->block_name);
+                        dxf_read_string (fp, &table->block_name);
                 }
                 if (strcmp (temp_string, "5") == 0)
                 {
@@ -513,7 +511,7 @@ dxf_table_read
                         && ((strcmp (temp_string, "AcDbBlockReference") != 0))
                         && ((strcmp (temp_string, "AcDbBlockTable") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -539,7 +537,7 @@ dxf_table_read
                         /* Now follows a string containing binary
                          * graphics data. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->binary_graphics_data[j]);
+                        dxf_read_string (fp, &table->binary_graphics_data[j]);
                         j++;
                 }
                 else if (strcmp (temp_string, "330") == 0)
@@ -547,28 +545,28 @@ dxf_table_read
                         /* Now follows a string containing a soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->dictionary_owner_soft);
+                        dxf_read_string (fp, &table->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "342") == 0)
                 {
                         /* Now follows a string containing a hard pointer
                          * ID of the TABLESTYLE object. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->tablestyle_object_pointer);
+                        dxf_read_string (fp, &table->tablestyle_object_pointer);
                 }
                 else if (strcmp (temp_string, "343") == 0)
                 {
                         /* Now follows a string containing a hard pointer
                          * ID of the owning BLOCK record. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->owning_block_pointer);
+                        dxf_read_string (fp, &table->owning_block_pointer);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->dictionary_owner_hard);
+                        dxf_read_string (fp, &table->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -579,13 +577,17 @@ dxf_table_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -623,14 +625,14 @@ dxf_table_cell_write
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (cell == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
@@ -666,13 +668,13 @@ dxf_table_cell_write
         }
         if (cell->number_of_block_attdefs < (i + 1))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () more attdefs encountered than expected.\n")),
                   __FUNCTION__);
         }
         else if (cell->number_of_block_attdefs > (i + 1))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () less attdefs encountered than expected.\n")),
                   __FUNCTION__);
         }
@@ -709,26 +711,26 @@ dxf_table_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("ACAD_TABLE");
+        char *dxf_entity_name = dxf_strdup ("ACAD_TABLE");
         int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (table == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -754,9 +756,9 @@ dxf_table_write
                 fprintf (fp->fp, "100\nAcDbBlockReference\n");
         }
         fprintf (fp->fp, "  2\n%s\n", table->block_name);
-        fprintf (fp->fp, " 10\n%f\n", table->x0);
-        fprintf (fp->fp, " 20\n%f\n", table->y0);
-        fprintf (fp->fp, " 30\n%f\n", table->z0);
+        dxf_write_real (fp, 10, table->x0);
+        dxf_write_real (fp, 20, table->y0);
+        dxf_write_real (fp, 30, table->z0);
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbTable\n");
@@ -764,9 +766,9 @@ dxf_table_write
         fprintf (fp->fp, "280\n%d\n", table->table_data_version);
         fprintf (fp->fp, "342\n%s\n", table->tablestyle_object_pointer);
         fprintf (fp->fp, "343\n%s\n", table->owning_block_pointer);
-        fprintf (fp->fp, " 11\n%f\n", table->x1);
-        fprintf (fp->fp, " 21\n%f\n", table->y1);
-        fprintf (fp->fp, " 31\n%f\n", table->z1);
+        dxf_write_real (fp, 11, table->x1);
+        dxf_write_real (fp, 21, table->y1);
+        dxf_write_real (fp, 31, table->z1);
         fprintf (fp->fp, " 90\n%d\n", table->table_value_flag);
         fprintf (fp->fp, " 91\n%d\n", table->number_of_rows);
         fprintf (fp->fp, " 92\n%d\n", table->number_of_columns);
@@ -776,15 +778,15 @@ dxf_table_write
         fprintf (fp->fp, " 96\n%d\n", table->border_visibility_override_flag);
         for (i = 0; i < table->number_of_rows; i++)
         {
-                fprintf (fp->fp, "141\n%f\n", table->row_height[i]);
+                dxf_write_real (fp, 141, table->row_height[i]);
         }
         for (i = 0; i < table->number_of_columns; i++)
         {
-                fprintf (fp->fp, "142\n%f\n", table->column_height[i]);
+                dxf_write_real (fp, 142, table->column_height[i]);
         }
 
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -821,29 +823,29 @@ dxf_table_cell_free
         /* Do some basic checks. */
         if (cell == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (cell->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfTableCell was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (cell->text_string);
+        dxf_free (cell->text_string);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (cell->optional_text_string[i]);
-                free (cell->attdef_soft_pointer[i]);
+                dxf_free (cell->optional_text_string[i]);
+                dxf_free (cell->attdef_soft_pointer[i]);
         }
-        free (cell->text_style_name);
-        free (cell->attdef_text_string);
-        free (cell->block_table_record_hard_pointer);
-        free (cell->field_object_pointer);
-        free (cell);
+        dxf_free (cell->text_style_name);
+        dxf_free (cell->attdef_text_string);
+        dxf_free (cell->block_table_record_hard_pointer);
+        dxf_free (cell->field_object_pointer);
+        dxf_free (cell);
         cell = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -881,32 +883,32 @@ dxf_table_free
         /* Do some basic checks. */
         if (table == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
         if (table->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfTable was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (table->linetype);
-        free (table->layer);
+        dxf_free (table->linetype);
+        dxf_free (table->layer);
         for (i = 0; i < DXF_MAX_PARAM; i++)
         {
-                free (table->binary_graphics_data[i]);
+                dxf_free (table->binary_graphics_data[i]);
         }
-        free (table->dictionary_owner_soft);
-        free (table->dictionary_owner_hard);
-        free (table->block_name);
-        free (table->table_text_style_name);
-        free (table->tablestyle_object_pointer);
-        free (table->owning_block_pointer);
+        dxf_free (table->dictionary_owner_soft);
+        dxf_free (table->dictionary_owner_hard);
+        dxf_free (table->block_name);
+        dxf_free (table->table_text_style_name);
+        dxf_free (table->tablestyle_object_pointer);
+        dxf_free (table->owning_block_pointer);
 //        dxf_table_cells_free_chain (table->cells);
-        free (table);
+        dxf_free (table);
         table = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -933,19 +935,20 @@ dxf_table_cell_free_chain
                 /*!< pointer to the chain of DXF \c TABLE cells. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (cells == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (cells != NULL)
         {
                 struct DxfTableCell *iter = cells->next;
+                cells->next = NULL;
                 dxf_table_cell_free (cells);
                 cells = (DxfTableCell *) iter;
         }
@@ -973,19 +976,20 @@ dxf_table_free_chain
                 /*!< pointer to the chain of DXF \c TABLE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
         if (tables == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (tables != NULL)
         {
                 struct DxfTable *iter = tables->next;
+                tables->next = NULL;
                 dxf_table_free (tables);
                 tables = (DxfTable *) iter;
         }
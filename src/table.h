@@ -259,6 +259,9 @@ dxf_table_cell
 typedef struct
 dxf_table
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         int id_code;
                 /*!< Identification number for the entity.\n
                  * This is to be an unique (sequential) number in the DXF
@@ -34,6 +34,70 @@
 
 #include "tables.h"
 #include "section.h"
+#include "endsec.h"
+#include "endtab.h"
+#include "appid.h"
+#include "block_record.h"
+#include "dimstyle.h"
+#include "layer.h"
+#include "ltype.h"
+#include "style.h"
+#include "ucs.h"
+#include "view.h"
+#include "vport.h"
+
+
+/*!
+ * \brief Write all entries of one symbol table list, preceded by the
+ * \c TABLE header and followed by an \c ENDTAB.
+ *
+ * Nothing is written for an empty list, entries which could not be
+ * written are counted in \c failures.
+ */
+#define DXF_TABLES_WRITE_TABLE(fp, table_name, type, first, write, failures) \
+        { \
+                type *entry; \
+                int number_of_entries = 0; \
+                for (entry = (type *) (first); entry != NULL; entry = (type *) entry->next) \
+                { \
+                        number_of_entries++; \
+                } \
+                if (number_of_entries > 0) \
+                { \
+                        dxf_tables_write_table_begin (fp, table_name, number_of_entries); \
+                        for (entry = (type *) (first); entry != NULL; entry = (type *) entry->next) \
+                        { \
+                                if (write (fp, entry) != EXIT_SUCCESS) \
+                                { \
+                                        failures++; \
+                                } \
+                        } \
+                        dxf_endtab_write (fp); \
+                } \
+        }
+
+
+/*!
+ * \brief Write the \c TABLE header of a symbol table.
+ */
+static void
+dxf_tables_write_table_begin
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        const char *table_name,
+                /*!< name of the symbol table. */
+        int number_of_entries
+                /*!< number of entries following the header. */
+)
+{
+        fprintf (fp->fp, "  0\nTABLE\n  2\n%s\n", table_name);
+        if (fp->acad_version_number >= AutoCAD_13)
+        {
+                fprintf (fp->fp, "100\nAcDbSymbolTable\n");
+        }
+        fprintf (fp->fp, " 70\n%d\n", number_of_entries);
+}
 
 
 /*!
@@ -56,9 +120,9 @@ dxf_tables_new ()
         size = sizeof (DxfTables);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((tables = malloc (size)) == NULL)
+        if ((tables = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTables struct.\n")),
                   __FUNCTION__);
                 tables = NULL;
@@ -94,14 +158,14 @@ dxf_tables_init
         /* Do some basic checks. */
         if (tables == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 tables = dxf_tables_new ();
         }
         if (tables == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTables struct.\n")),
                   __FUNCTION__);
                 return (NULL);
@@ -141,21 +205,46 @@ dxf_tables_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_section_name = strdup ("TABLES");
+        int failures = 0;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (dxf_section_name);
                 return (EXIT_FAILURE);
         }
-        dxf_section_write (fp, dxf_section_name);
-        /*! \todo Add code here */
+        if (tables == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_section_write (fp, "TABLES");
+        /* Symbol tables in the order AutoCAD writes them. */
+        DXF_TABLES_WRITE_TABLE (fp, "VPORT", DxfVPort, tables->vports, dxf_vport_write, failures);
+        DXF_TABLES_WRITE_TABLE (fp, "LTYPE", DxfLType, tables->ltypes, dxf_ltype_write, failures);
+        DXF_TABLES_WRITE_TABLE (fp, "LAYER", DxfLayer, tables->layers, dxf_layer_write, failures);
+        DXF_TABLES_WRITE_TABLE (fp, "STYLE", DxfStyle, tables->styles, dxf_style_write, failures);
+        DXF_TABLES_WRITE_TABLE (fp, "VIEW", DxfView, tables->views, dxf_view_write, failures);
+        DXF_TABLES_WRITE_TABLE (fp, "UCS", DxfUcs, tables->ucss, dxf_ucs_write, failures);
+        DXF_TABLES_WRITE_TABLE (fp, "APPID", DxfAppid, tables->appids, dxf_appid_write, failures);
+        DXF_TABLES_WRITE_TABLE (fp, "DIMSTYLE", DxfDimStyle, tables->dimstyles, dxf_dimstyle_write, failures);
+        /* Block records were introduced in AutoCAD R13. */
+        if (fp->acad_version_number >= AutoCAD_13)
+        {
+                DXF_TABLES_WRITE_TABLE (fp, "BLOCK_RECORD", DxfBlockRecord, tables->block_records, dxf_block_record_write, failures);
+        }
         dxf_endsec_write (fp);
+        if (failures > 0)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () %d symbol table entries could not be written.\n")),
+                  __FUNCTION__, failures);
+                return (EXIT_FAILURE);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -182,20 +271,21 @@ dxf_tables_free
 #endif
         if (tables == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (tables->appids);
-        free (tables->block_records);
-        free (tables->dimstyles);
-        free (tables->layers);
-        free (tables->ltypes);
-        free (tables->styles);
-        free (tables->ucss);
-        free (tables->views);
-        free (tables->vports);
+        if (tables->appids != NULL) dxf_appid_free_chain ((DxfAppid *) tables->appids);
+        if (tables->block_records != NULL) dxf_block_record_free_chain ((DxfBlockRecord *) tables->block_records);
+        if (tables->dimstyles != NULL) dxf_dimstyle_free_chain ((DxfDimStyle *) tables->dimstyles);
+        if (tables->layers != NULL) dxf_layer_free_chain ((DxfLayer *) tables->layers);
+        if (tables->ltypes != NULL) dxf_ltype_free_chain ((DxfLType *) tables->ltypes);
+        if (tables->styles != NULL) dxf_style_free_chain ((DxfStyle *) tables->styles);
+        if (tables->ucss != NULL) dxf_ucs_free_chain ((DxfUcs *) tables->ucss);
+        if (tables->views != NULL) dxf_view_free_chain ((DxfView *) tables->views);
+        if (tables->vports != NULL) dxf_vport_free_chain ((DxfVPort *) tables->vports);
+        dxf_free (tables);
         tables = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -0,0 +1,1221 @@
+/*!
+ * \file tessellation.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF tessellation of curved entities into
+ * polylines.
+ *
+ * The \c ARC, \c CIRCLE, \c ELLIPSE, \c LWPOLYLINE, \c POLYLINE (with
+ * bulged segments) and \c HELIX entities are flattened into polylines
+ * whose segments stay within a chord error (the maximum distance
+ * between the curve and a segment) and a maximum angle.\n
+ * \n
+ * The points on a curve are evaluated in batches: the cosines and sines
+ * of the equally spaced angles are computed by rotating a few lanes of
+ * unit vectors with a fixed rotation, without a call to \c sin () or
+ * \c cos () per point, and the curve is then mapped from the unit
+ * circle in a separate loop, both written to be vectorized by the
+ * compiler.\n
+ * When the compiler targets SSE2 the lanes are rotated two at a time in
+ * SSE2 registers, other targets rotate them one at a time.\n
+ * \n
+ * \c dxf_tessellation_add_entities () first counts the vertices of
+ * every entity, allocates all vertices at once and then evaluates the
+ * entities on several threads, each writing its own range of the vertex
+ * array, so the result is the same for any number of threads.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "tessellation.h"
+#include "entity_vtable.h"
+#include "arc.h"
+#include "circle.h"
+#include "ellipse.h"
+#include "helix.h"
+#include "lwpolyline.h"
+#include "polyline.h"
+#include "vertex.h"
+#include <pthread.h>
+
+#if defined (__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+#define DXF_TESSELLATION_LANES 4
+        /*!< \brief Number of unit vectors rotated side by side, a
+         * multiple of 2 for the SSE2 registers. */
+
+#define DXF_TESSELLATION_MAX_THREADS 64
+        /*!< \brief Maximum number of threads of
+         * \c dxf_tessellation_add_entities (). */
+
+
+/*!
+ * \brief Range of polylines evaluated by a thread.
+ */
+typedef struct
+dxf_tessellation_job_struct
+{
+        DxfTessellation *tessellation;
+                /*!< The tessellation, with the polylines and vertices
+                 * already allocated. */
+        size_t first;
+                /*!< Index of the first polyline. */
+        size_t last;
+                /*!< Index after the last polyline. */
+} DxfTessellationJob;
+
+
+static size_t dxf_tessellation_entity (DxfTessellation *tessellation, void *entity, double *out);
+
+
+/*!
+ * \brief Allocate memory for a tessellation and set its tolerances.
+ *
+ * \return a pointer to the tessellation, or \c NULL when an error
+ * occurred.
+ */
+DxfTessellation *
+dxf_tessellation_new
+(
+        double chord_error,
+                /*!< maximum distance between a curve and its polyline,
+                 * or 0.0 to not use this tolerance. */
+        double max_angle
+                /*!< maximum angle in radians of an arc segment, or 0.0
+                 * to not use this tolerance. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTessellation *tessellation = NULL;
+        size_t size;
+
+        if ((chord_error < 0.0) || (max_angle < 0.0))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a negative tolerance was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        size = sizeof (DxfTessellation);
+        if ((tessellation = dxf_malloc (size)) == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for a DxfTessellation struct.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (tessellation, 0, size);
+        tessellation->chord_error = chord_error;
+        tessellation->max_angle = max_angle;
+        tessellation->max_segments = DXF_TESSELLATION_DEFAULT_MAX_SEGMENTS;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tessellation);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a tessellation and its
+ * polylines.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_free
+(
+        DxfTessellation *tessellation
+                /*!< a pointer to the tessellation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (tessellation == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_free (tessellation->vertices);
+        dxf_free (tessellation->polylines);
+        dxf_free (tessellation->sources);
+        dxf_free (tessellation);
+        tessellation = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all polylines from a tessellation, the memory is kept
+ * for reuse.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_clear
+(
+        DxfTessellation *tessellation
+                /*!< a pointer to the tessellation. */
+)
+{
+        if (tessellation == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        tessellation->number_of_vertices = 0;
+        tessellation->number_of_polylines = 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make room for more vertices and polylines.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_tessellation_reserve
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        size_t number_of_vertices,
+                /*!< number of vertices to be added. */
+        size_t number_of_polylines
+                /*!< number of polylines to be added. */
+)
+{
+        size_t capacity;
+        double *vertices;
+        size_t *polylines;
+        void **sources;
+
+        if (tessellation->number_of_vertices + number_of_vertices > tessellation->capacity)
+        {
+                capacity = (tessellation->capacity == 0) ? 1024 : 2 * tessellation->capacity;
+                if (capacity < tessellation->number_of_vertices + number_of_vertices)
+                {
+                        capacity = tessellation->number_of_vertices + number_of_vertices;
+                }
+                vertices = dxf_realloc (tessellation->vertices, 3 * capacity * sizeof (double));
+                if (vertices == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                tessellation->vertices = vertices;
+                tessellation->capacity = capacity;
+        }
+        if (tessellation->number_of_polylines + number_of_polylines > tessellation->polylines_capacity)
+        {
+                capacity = (tessellation->polylines_capacity == 0) ? 64 : 2 * tessellation->polylines_capacity;
+                if (capacity < tessellation->number_of_polylines + number_of_polylines)
+                {
+                        capacity = tessellation->number_of_polylines + number_of_polylines;
+                }
+                polylines = dxf_realloc (tessellation->polylines, capacity * sizeof (size_t));
+                if (polylines == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                tessellation->polylines = polylines;
+                sources = dxf_realloc (tessellation->sources, capacity * sizeof (void *));
+                if (sources == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                tessellation->sources = sources;
+                tessellation->polylines_capacity = capacity;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of segments for an arc within the tolerances of
+ * a tessellation.
+ *
+ * \return the number of segments, at least 1.
+ */
+int
+dxf_tessellation_get_number_of_segments
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        double radius,
+                /*!< radius of the arc. */
+        double sweep
+                /*!< included angle of the arc in radians. */
+)
+{
+        double step = M_PI / 2.0;
+        double angle;
+        double number_of_segments;
+
+        radius = fabs (radius);
+        sweep = fabs (sweep);
+        if ((tessellation->max_angle > 0.0)
+          && (tessellation->max_angle < step))
+        {
+                step = tessellation->max_angle;
+        }
+        if ((tessellation->chord_error > 0.0)
+          && (radius > tessellation->chord_error))
+        {
+                /* The chord error of a segment spanning angle a is
+                 * radius * (1 - cos (a / 2)). */
+                angle = 2.0 * acos (1.0 - tessellation->chord_error / radius);
+                if (angle < step)
+                {
+                        step = angle;
+                }
+        }
+        number_of_segments = ceil (sweep / step - 1e-9);
+        if (number_of_segments < 1.0)
+        {
+                return (1);
+        }
+        if (number_of_segments > tessellation->max_segments)
+        {
+                return (tessellation->max_segments);
+        }
+        return ((int) number_of_segments);
+}
+
+
+/*!
+ * \brief Write the cosines and sines of equally spaced angles to the X
+ * and Y members of a vertex array.
+ *
+ * \c DXF_TESSELLATION_LANES unit vectors are rotated side by side by
+ * \c DXF_TESSELLATION_LANES steps at a time.
+ */
+static void
+dxf_tessellation_unit_circle
+(
+        double *out,
+                /*!< vertex array, 3 values per vertex. */
+        double start,
+                /*!< first angle in radians. */
+        double step,
+                /*!< angle between the points in radians. */
+        size_t number_of_points
+                /*!< number of points. */
+)
+{
+        double c[DXF_TESSELLATION_LANES];
+        double s[DXF_TESSELLATION_LANES];
+        double rotation_cos;
+        double rotation_sin;
+#if defined (__SSE2__)
+        __m128d c_lanes[DXF_TESSELLATION_LANES / 2];
+        __m128d s_lanes[DXF_TESSELLATION_LANES / 2];
+        __m128d rotation_cos_lanes;
+        __m128d rotation_sin_lanes;
+        __m128d t_lanes;
+#else
+        double t;
+#endif
+        size_t i;
+        size_t j;
+
+        for (j = 0; j < DXF_TESSELLATION_LANES; j++)
+        {
+                c[j] = cos (start + j * step);
+                s[j] = sin (start + j * step);
+        }
+        rotation_cos = cos (DXF_TESSELLATION_LANES * step);
+        rotation_sin = sin (DXF_TESSELLATION_LANES * step);
+#if defined (__SSE2__)
+        /* The same products and sums as the loop below, two lanes per
+         * register, so both give the same points. */
+        rotation_cos_lanes = _mm_set1_pd (rotation_cos);
+        rotation_sin_lanes = _mm_set1_pd (rotation_sin);
+        for (j = 0; j < DXF_TESSELLATION_LANES / 2; j++)
+        {
+                c_lanes[j] = _mm_loadu_pd (c + 2 * j);
+                s_lanes[j] = _mm_loadu_pd (s + 2 * j);
+        }
+        for (i = 0; i + DXF_TESSELLATION_LANES <= number_of_points; i += DXF_TESSELLATION_LANES)
+        {
+                for (j = 0; j < DXF_TESSELLATION_LANES / 2; j++)
+                {
+                        _mm_storel_pd (out + 3 * (i + 2 * j), c_lanes[j]);
+                        _mm_storel_pd (out + 3 * (i + 2 * j) + 1, s_lanes[j]);
+                        _mm_storeh_pd (out + 3 * (i + 2 * j + 1), c_lanes[j]);
+                        _mm_storeh_pd (out + 3 * (i + 2 * j + 1) + 1, s_lanes[j]);
+                        t_lanes = _mm_sub_pd (_mm_mul_pd (c_lanes[j], rotation_cos_lanes),
+                          _mm_mul_pd (s_lanes[j], rotation_sin_lanes));
+                        s_lanes[j] = _mm_add_pd (_mm_mul_pd (c_lanes[j], rotation_sin_lanes),
+                          _mm_mul_pd (s_lanes[j], rotation_cos_lanes));
+                        c_lanes[j] = t_lanes;
+                }
+        }
+        for (j = 0; j < DXF_TESSELLATION_LANES / 2; j++)
+        {
+                _mm_storeu_pd (c + 2 * j, c_lanes[j]);
+                _mm_storeu_pd (s + 2 * j, s_lanes[j]);
+        }
+#else
+        for (i = 0; i + DXF_TESSELLATION_LANES <= number_of_points; i += DXF_TESSELLATION_LANES)
+        {
+                for (j = 0; j < DXF_TESSELLATION_LANES; j++)
+                {
+                        out[3 * (i + j)] = c[j];
+                        out[3 * (i + j) + 1] = s[j];
+                }
+                for (j = 0; j < DXF_TESSELLATION_LANES; j++)
+                {
+                        t = c[j] * rotation_cos - s[j] * rotation_sin;
+                        s[j] = c[j] * rotation_sin + s[j] * rotation_cos;
+                        c[j] = t;
+                }
+        }
+#endif
+        for (j = 0; i + j < number_of_points; j++)
+        {
+                out[3 * (i + j)] = c[j];
+                out[3 * (i + j) + 1] = s[j];
+        }
+}
+
+
+/*!
+ * \brief Transform vertices from an object coordinate system to the
+ * world coordinate system with the arbitrary axis algorithm.
+ */
+static void
+dxf_tessellation_ocs_to_wcs
+(
+        double *out,
+                /*!< vertex array, 3 values per vertex. */
+        size_t number_of_vertices,
+                /*!< number of vertices. */
+        double extr_x0,
+                /*!< X-value of the extrusion direction. */
+        double extr_y0,
+                /*!< Y-value of the extrusion direction. */
+        double extr_z0
+                /*!< Z-value of the extrusion direction. */
+)
+{
+        double length;
+        double nx, ny, nz;
+        double ax, ay, az;
+        double bx, by, bz;
+        double x, y, z;
+        size_t i;
+
+        length = sqrt (extr_x0 * extr_x0 + extr_y0 * extr_y0 + extr_z0 * extr_z0);
+        if ((length == 0.0)
+          || ((extr_x0 == 0.0) && (extr_y0 == 0.0) && (extr_z0 > 0.0)))
+        {
+                return;
+        }
+        nx = extr_x0 / length;
+        ny = extr_y0 / length;
+        nz = extr_z0 / length;
+        if ((fabs (nx) < 1.0 / 64.0) && (fabs (ny) < 1.0 / 64.0))
+        {
+                /* World Y-axis cross extrusion direction. */
+                ax = nz;
+                ay = 0.0;
+                az = -nx;
+        }
+        else
+        {
+                /* World Z-axis cross extrusion direction. */
+                ax = -ny;
+                ay = nx;
+                az = 0.0;
+        }
+        length = sqrt (ax * ax + ay * ay + az * az);
+        ax /= length;
+        ay /= length;
+        az /= length;
+        bx = ny * az - nz * ay;
+        by = nz * ax - nx * az;
+        bz = nx * ay - ny * ax;
+        for (i = 0; i < number_of_vertices; i++)
+        {
+                x = out[3 * i];
+                y = out[3 * i + 1];
+                z = out[3 * i + 2];
+                out[3 * i] = x * ax + y * bx + z * nx;
+                out[3 * i + 1] = x * ay + y * by + z * ny;
+                out[3 * i + 2] = x * az + y * bz + z * nz;
+        }
+}
+
+
+/*!
+ * \brief Evaluate a circular arc in a plane parallel to the XY plane.
+ *
+ * \return the number of vertices.
+ */
+static size_t
+dxf_tessellation_arc
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        double x0,
+                /*!< X-value of the center point. */
+        double y0,
+                /*!< Y-value of the center point. */
+        double z0,
+                /*!< Z-value of the arc. */
+        double radius,
+                /*!< radius of the arc. */
+        double start,
+                /*!< start angle in radians. */
+        double sweep,
+                /*!< included angle in radians, negative for clockwise
+                 * arcs. */
+        int skip_first,
+                /*!< \c TRUE to leave out the start point. */
+        double *out
+                /*!< vertex array, or \c NULL to only count the
+                 * vertices. */
+)
+{
+        int number_of_segments;
+        size_t count;
+        double step;
+        size_t i;
+
+        number_of_segments = dxf_tessellation_get_number_of_segments (tessellation, radius, sweep);
+        count = number_of_segments + 1 - (skip_first ? 1 : 0);
+        if (out == NULL)
+        {
+                return (count);
+        }
+        step = sweep / number_of_segments;
+        dxf_tessellation_unit_circle (out, start + (skip_first ? step : 0.0), step, count);
+        for (i = 0; i < count; i++)
+        {
+                out[3 * i] = x0 + radius * out[3 * i];
+                out[3 * i + 1] = y0 + radius * out[3 * i + 1];
+                out[3 * i + 2] = z0;
+        }
+        out[3 * (count - 1)] = x0 + radius * cos (start + sweep);
+        out[3 * (count - 1) + 1] = y0 + radius * sin (start + sweep);
+        return (count);
+}
+
+
+/*!
+ * \brief Evaluate a segment of a polyline, without its start point.
+ *
+ * \return the number of vertices.
+ */
+static size_t
+dxf_tessellation_segment
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        DxfVertex *start,
+                /*!< start vertex of the segment. */
+        DxfVertex *end,
+                /*!< end vertex of the segment. */
+        int is_3d,
+                /*!< \c TRUE for the vertices of a 3D polyline, their
+                 * bulges are ignored. */
+        double elevation,
+                /*!< Z-value of the vertices of a 2D polyline. */
+        double *out
+                /*!< vertex array, or \c NULL to only count the
+                 * vertices. */
+)
+{
+        double bulge = start->bulge;
+        double dx = end->x0 - start->x0;
+        double dy = end->y0 - start->y0;
+        double distance;
+        double radius;
+        double offset;
+        double x0;
+        double y0;
+        size_t count;
+
+        distance = sqrt (dx * dx + dy * dy);
+        if (is_3d || (bulge == 0.0) || (distance == 0.0))
+        {
+                if (out != NULL)
+                {
+                        out[0] = end->x0;
+                        out[1] = end->y0;
+                        out[2] = is_3d ? end->z0 : elevation;
+                }
+                return (1);
+        }
+        /* The bulge is the tangent of a quarter of the included angle,
+         * positive for counter clockwise arcs. */
+        radius = distance * (1.0 + bulge * bulge) / (4.0 * fabs (bulge));
+        offset = distance * (1.0 - bulge * bulge) / (4.0 * bulge);
+        x0 = 0.5 * (start->x0 + end->x0) - dy / distance * offset;
+        y0 = 0.5 * (start->y0 + end->y0) + dx / distance * offset;
+        count = dxf_tessellation_arc (tessellation, x0, y0, elevation,
+          radius, atan2 (start->y0 - y0, start->x0 - x0),
+          4.0 * atan (bulge), TRUE, out);
+        if (out != NULL)
+        {
+                out[3 * (count - 1)] = end->x0;
+                out[3 * (count - 1) + 1] = end->y0;
+        }
+        return (count);
+}
+
+
+/*!
+ * \brief Evaluate a chain of polyline vertices.
+ *
+ * \return the number of vertices.
+ */
+static size_t
+dxf_tessellation_vertices
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        DxfVertex *vertices,
+                /*!< a pointer to the first vertex. */
+        int closed,
+                /*!< \c TRUE for a closed polyline. */
+        int is_3d,
+                /*!< \c TRUE for a 3D polyline. */
+        double elevation,
+                /*!< Z-value of the vertices of a 2D polyline. */
+        double *out
+                /*!< vertex array, or \c NULL to only count the
+                 * vertices. */
+)
+{
+        DxfVertex *vertex;
+        DxfVertex *next;
+        size_t count = 1;
+
+        if (vertices == NULL)
+        {
+                return (0);
+        }
+        if (out != NULL)
+        {
+                out[0] = vertices->x0;
+                out[1] = vertices->y0;
+                out[2] = is_3d ? vertices->z0 : elevation;
+        }
+        for (vertex = vertices; vertex != NULL; vertex = (DxfVertex *) vertex->next)
+        {
+                next = (DxfVertex *) vertex->next;
+                if (next == NULL)
+                {
+                        if ((!closed) || (vertex == vertices))
+                        {
+                                break;
+                        }
+                        next = vertices;
+                }
+                count += dxf_tessellation_segment (tessellation, vertex, next,
+                  is_3d, elevation, (out != NULL) ? out + 3 * count : NULL);
+        }
+        return (count);
+}
+
+
+/*!
+ * \brief Evaluate an \c ELLIPSE entity.
+ *
+ * \return the number of vertices.
+ */
+static size_t
+dxf_tessellation_ellipse
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        DxfEllipse *ellipse,
+                /*!< a pointer to the ellipse. */
+        double *out
+                /*!< vertex array, or \c NULL to only count the
+                 * vertices. */
+)
+{
+        double nx = ellipse->extr_x0;
+        double ny = ellipse->extr_y0;
+        double nz = ellipse->extr_z0;
+        double major;
+        double length;
+        double minor_x, minor_y, minor_z;
+        double sweep;
+        double step;
+        double c;
+        double s;
+        int number_of_segments;
+        size_t i;
+
+        major = sqrt (ellipse->x1 * ellipse->x1
+          + ellipse->y1 * ellipse->y1
+          + ellipse->z1 * ellipse->z1);
+        if ((major == 0.0) || (ellipse->ratio <= 0.0))
+        {
+                return (0);
+        }
+        sweep = fmod (ellipse->end_angle - ellipse->start_angle, 2.0 * M_PI);
+        if (sweep <= 0.0)
+        {
+                sweep += 2.0 * M_PI;
+        }
+        /* The ellipse is an affine image of the circle with the major
+         * radius which does not lengthen any distance, so its chord
+         * error is within the chord error of that circle. */
+        number_of_segments = dxf_tessellation_get_number_of_segments (tessellation, major, sweep);
+        if (out == NULL)
+        {
+                return (number_of_segments + 1);
+        }
+        length = sqrt (nx * nx + ny * ny + nz * nz);
+        if (length == 0.0)
+        {
+                nx = 0.0;
+                ny = 0.0;
+                nz = 1.0;
+                length = 1.0;
+        }
+        /* Minor axis = ratio * (extrusion direction cross major axis). */
+        minor_x = ellipse->ratio * (ny * ellipse->z1 - nz * ellipse->y1) / length;
+        minor_y = ellipse->ratio * (nz * ellipse->x1 - nx * ellipse->z1) / length;
+        minor_z = ellipse->ratio * (nx * ellipse->y1 - ny * ellipse->x1) / length;
+        step = sweep / number_of_segments;
+        dxf_tessellation_unit_circle (out, ellipse->start_angle, step, number_of_segments + 1);
+        for (i = 0; i <= (size_t) number_of_segments; i++)
+        {
+                c = out[3 * i];
+                s = out[3 * i + 1];
+                out[3 * i] = ellipse->x0 + ellipse->x1 * c + minor_x * s;
+                out[3 * i + 1] = ellipse->y0 + ellipse->y1 * c + minor_y * s;
+                out[3 * i + 2] = ellipse->z0 + ellipse->z1 * c + minor_z * s;
+        }
+        return (number_of_segments + 1);
+}
+
+
+/*!
+ * \brief Evaluate a \c HELIX entity.
+ *
+ * \return the number of vertices.
+ */
+static size_t
+dxf_tessellation_helix
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        DxfHelix *helix,
+                /*!< a pointer to the helix. */
+        double *out
+                /*!< vertex array, or \c NULL to only count the
+                 * vertices. */
+)
+{
+        double wx, wy, wz;
+        double ux, uy, uz;
+        double vx, vy, vz;
+        double length;
+        double axial;
+        double radius;
+        double height;
+        double step;
+        double c;
+        double s;
+        double number_of_segments;
+        size_t count;
+        size_t i;
+
+        if ((helix->p0 == NULL) || (helix->p1 == NULL) || (helix->p2 == NULL)
+          || (helix->number_of_turns <= 0.0))
+        {
+                return (0);
+        }
+        wx = helix->p2->x0;
+        wy = helix->p2->y0;
+        wz = helix->p2->z0;
+        length = sqrt (wx * wx + wy * wy + wz * wz);
+        if (length == 0.0)
+        {
+                return (0);
+        }
+        wx /= length;
+        wy /= length;
+        wz /= length;
+        /* Split the start point in an axial and a radial part. */
+        ux = helix->p1->x0 - helix->p0->x0;
+        uy = helix->p1->y0 - helix->p0->y0;
+        uz = helix->p1->z0 - helix->p0->z0;
+        axial = ux * wx + uy * wy + uz * wz;
+        ux -= axial * wx;
+        uy -= axial * wy;
+        uz -= axial * wz;
+        radius = sqrt (ux * ux + uy * uy + uz * uz);
+        if (radius == 0.0)
+        {
+                return (0);
+        }
+        number_of_segments = ceil (helix->number_of_turns
+          * dxf_tessellation_get_number_of_segments (tessellation, radius, 2.0 * M_PI));
+        count = (size_t) number_of_segments + 1;
+        if (out == NULL)
+        {
+                return (count);
+        }
+        /* v = w cross u, turning counter clockwise about the axis for a
+         * right handed helix. */
+        vx = wy * uz - wz * uy;
+        vy = wz * ux - wx * uz;
+        vz = wx * uy - wy * ux;
+        if (helix->handedness == 0)
+        {
+                vx = -vx;
+                vy = -vy;
+                vz = -vz;
+        }
+        step = 2.0 * M_PI * helix->number_of_turns / number_of_segments;
+        height = helix->turn_height * helix->number_of_turns / number_of_segments;
+        dxf_tessellation_unit_circle (out, 0.0, step, count);
+        for (i = 0; i < count; i++)
+        {
+                c = out[3 * i];
+                s = out[3 * i + 1];
+                out[3 * i] = helix->p0->x0 + (axial + height * i) * wx + ux * c + vx * s;
+                out[3 * i + 1] = helix->p0->y0 + (axial + height * i) * wy + uy * c + vy * s;
+                out[3 * i + 2] = helix->p0->z0 + (axial + height * i) * wz + uz * c + vz * s;
+        }
+        return (count);
+}
+
+
+/*!
+ * \brief Evaluate an entity.
+ *
+ * \return the number of vertices, or 0 when the entity can not be
+ * tessellated.
+ */
+static size_t
+dxf_tessellation_entity
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        void *entity,
+                /*!< a pointer to the entity. */
+        double *out
+                /*!< vertex array, or \c NULL to only count the
+                 * vertices. */
+)
+{
+        DxfArc *arc;
+        DxfCircle *circle;
+        DxfLWPolyline *lwpolyline;
+        DxfPolyline *polyline;
+        double sweep;
+        size_t count = 0;
+
+        switch (DXF_ENTITY_HEADER (entity)->type)
+        {
+                case ARC:
+                        arc = (DxfArc *) entity;
+                        if ((arc->p0 == NULL) || (arc->radius <= 0.0))
+                        {
+                                break;
+                        }
+                        sweep = fmod (arc->end_angle - arc->start_angle, 360.0);
+                        if (sweep <= 0.0)
+                        {
+                                sweep += 360.0;
+                        }
+                        count = dxf_tessellation_arc (tessellation,
+                          arc->p0->x0, arc->p0->y0, arc->p0->z0, arc->radius,
+                          arc->start_angle * M_PI / 180.0, sweep * M_PI / 180.0,
+                          FALSE, out);
+                        if (out != NULL)
+                        {
+                                dxf_tessellation_ocs_to_wcs (out, count,
+                                  arc->extr_x0, arc->extr_y0, arc->extr_z0);
+                        }
+                        break;
+                case CIRCLE:
+                        circle = (DxfCircle *) entity;
+                        if ((circle->p0 == NULL) || (circle->radius <= 0.0))
+                        {
+                                break;
+                        }
+                        count = dxf_tessellation_arc (tessellation,
+                          circle->p0->x0, circle->p0->y0, circle->p0->z0,
+                          circle->radius, 0.0, 2.0 * M_PI, FALSE, out);
+                        if (out != NULL)
+                        {
+                                out[3 * (count - 1)] = out[0];
+                                out[3 * (count - 1) + 1] = out[1];
+                                dxf_tessellation_ocs_to_wcs (out, count,
+                                  circle->extr_x0, circle->extr_y0, circle->extr_z0);
+                        }
+                        break;
+                case ELLIPSE:
+                        count = dxf_tessellation_ellipse (tessellation,
+                          (DxfEllipse *) entity, out);
+                        break;
+                case LWPOLYLINE:
+                        lwpolyline = (DxfLWPolyline *) entity;
+                        count = dxf_tessellation_vertices (tessellation,
+                          (DxfVertex *) lwpolyline->vertices,
+                          lwpolyline->flag & 1, FALSE,
+                          lwpolyline->elevation, out);
+                        if (out != NULL)
+                        {
+                                dxf_tessellation_ocs_to_wcs (out, count,
+                                  lwpolyline->extr_x0, lwpolyline->extr_y0, lwpolyline->extr_z0);
+                        }
+                        break;
+                case POLYLINE:
+                        polyline = (DxfPolyline *) entity;
+                        /* Polygon and polyface meshes are no curves. */
+                        if (polyline->flag & (16 | 64))
+                        {
+                                break;
+                        }
+                        count = dxf_tessellation_vertices (tessellation,
+                          polyline->vertices,
+                          polyline->flag & 1, polyline->flag & 8,
+                          (polyline->p0 != NULL) ? polyline->p0->z0 : polyline->elevation,
+                          out);
+                        if ((out != NULL) && !(polyline->flag & 8))
+                        {
+                                dxf_tessellation_ocs_to_wcs (out, count,
+                                  polyline->extr_x0, polyline->extr_y0, polyline->extr_z0);
+                        }
+                        break;
+                case HELIX:
+                        count = dxf_tessellation_helix (tessellation,
+                          (DxfHelix *) entity, out);
+                        break;
+                default:
+                        break;
+        }
+        return (count);
+}
+
+
+/*!
+ * \brief Tessellate an entity of any type and add it as a polyline.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the entity
+ * can not be tessellated or when an error occurred.
+ */
+int
+dxf_tessellation_add_entity
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        void *entity
+                /*!< a pointer to an \c ARC, \c CIRCLE, \c ELLIPSE,
+                 * \c LWPOLYLINE, \c POLYLINE or \c HELIX entity. */
+)
+{
+        size_t count;
+
+        if ((tessellation == NULL) || (entity == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((count = dxf_tessellation_entity (tessellation, entity, NULL)) == 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (dxf_tessellation_reserve (tessellation, count, 1) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the vertices.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        tessellation->polylines[tessellation->number_of_polylines] = tessellation->number_of_vertices;
+        tessellation->sources[tessellation->number_of_polylines] = entity;
+        tessellation->number_of_polylines++;
+        dxf_tessellation_entity (tessellation, entity,
+          tessellation->vertices + 3 * tessellation->number_of_vertices);
+        tessellation->number_of_vertices += count;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Evaluate a range of polylines whose vertices are allocated.
+ */
+static void *
+dxf_tessellation_run_job
+(
+        void *data
+                /*!< a pointer to the \c DxfTessellationJob. */
+)
+{
+        DxfTessellationJob *job = (DxfTessellationJob *) data;
+        DxfTessellation *tessellation = job->tessellation;
+        size_t i;
+
+        for (i = job->first; i < job->last; i++)
+        {
+                dxf_tessellation_entity (tessellation,
+                  tessellation->sources[i],
+                  tessellation->vertices + 3 * tessellation->polylines[i]);
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Tessellate all entities of a DXF entities container, in file
+ * order, on one or more threads.
+ *
+ * Entities which can not be tessellated, and entities with
+ * \c DXF_ENTITY_FLAG_ERASED set are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_entities
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        DxfEntities *entities,
+                /*!< a pointer to the DXF entities container. */
+        int number_of_threads
+                /*!< number of threads, or 0 for the number of online
+                 * processors. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTessellationJob jobs[DXF_TESSELLATION_MAX_THREADS];
+        pthread_t threads[DXF_TESSELLATION_MAX_THREADS];
+        int started[DXF_TESSELLATION_MAX_THREADS];
+        size_t first_polyline;
+        size_t number_of_vertices;
+        size_t count;
+        size_t target;
+        size_t i;
+        size_t j;
+        void *entity;
+        int k;
+
+        if ((tessellation == NULL) || (entities == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_of_threads <= 0)
+        {
+                number_of_threads = (int) sysconf (_SC_NPROCESSORS_ONLN);
+        }
+        if (number_of_threads < 1)
+        {
+                number_of_threads = 1;
+        }
+        if (number_of_threads > DXF_TESSELLATION_MAX_THREADS)
+        {
+                number_of_threads = DXF_TESSELLATION_MAX_THREADS;
+        }
+        /* Count the vertices of every polyline. */
+        if (dxf_tessellation_reserve (tessellation, 0, entities->number_of_entities) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the polylines.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        first_polyline = tessellation->number_of_polylines;
+        number_of_vertices = tessellation->number_of_vertices;
+        for (i = 0; i < entities->number_of_entities; i++)
+        {
+                entity = entities->entities[i];
+                if (DXF_ENTITY_HEADER (entity)->flags & DXF_ENTITY_FLAG_ERASED)
+                {
+                        continue;
+                }
+                if ((count = dxf_tessellation_entity (tessellation, entity, NULL)) == 0)
+                {
+                        continue;
+                }
+                tessellation->polylines[tessellation->number_of_polylines] = number_of_vertices;
+                tessellation->sources[tessellation->number_of_polylines] = entity;
+                tessellation->number_of_polylines++;
+                number_of_vertices += count;
+        }
+        if (dxf_tessellation_reserve (tessellation, number_of_vertices - tessellation->number_of_vertices, 0) != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the vertices.\n")),
+                  __FUNCTION__);
+                tessellation->number_of_polylines = first_polyline;
+                return (EXIT_FAILURE);
+        }
+        /* Split the polylines in ranges of about the same number of
+         * vertices. */
+        i = first_polyline;
+        for (k = 0; k < number_of_threads; k++)
+        {
+                target = tessellation->number_of_vertices
+                  + (number_of_vertices - tessellation->number_of_vertices) * (k + 1) / number_of_threads;
+                for (j = i; (j < tessellation->number_of_polylines)
+                  && ((k == number_of_threads - 1) || (tessellation->polylines[j] < target)); j++);
+                jobs[k].tessellation = tessellation;
+                jobs[k].first = i;
+                jobs[k].last = j;
+                i = j;
+        }
+        for (k = 1; k < number_of_threads; k++)
+        {
+                started[k] = (jobs[k].first < jobs[k].last)
+                  && (pthread_create (&threads[k], NULL, dxf_tessellation_run_job, &jobs[k]) == 0);
+        }
+        dxf_tessellation_run_job (&jobs[0]);
+        for (k = 1; k < number_of_threads; k++)
+        {
+                if (started[k])
+                {
+                        pthread_join (threads[k], NULL);
+                }
+                else
+                {
+                        dxf_tessellation_run_job (&jobs[k]);
+                }
+        }
+        tessellation->number_of_vertices = number_of_vertices;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of polylines of a tessellation.
+ *
+ * \return the number of polylines.
+ */
+size_t
+dxf_tessellation_get_number_of_polylines
+(
+        DxfTessellation *tessellation
+                /*!< a pointer to the tessellation. */
+)
+{
+        if (tessellation == NULL)
+        {
+                return (0);
+        }
+        return (tessellation->number_of_polylines);
+}
+
+
+/*!
+ * \brief Get the vertices of a polyline of a tessellation.
+ *
+ * \return a pointer to the coordinates of the first vertex, 3 per
+ * vertex, or \c NULL when the index is out of range.
+ */
+const double *
+dxf_tessellation_get_polyline
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        size_t index,
+                /*!< index of the polyline. */
+        size_t *number_of_vertices
+                /*!< set to the number of vertices of the polyline. */
+)
+{
+        size_t end;
+
+        if ((tessellation == NULL)
+          || (index >= tessellation->number_of_polylines))
+        {
+                return (NULL);
+        }
+        end = (index + 1 < tessellation->number_of_polylines)
+          ? tessellation->polylines[index + 1]
+          : tessellation->number_of_vertices;
+        if (number_of_vertices != NULL)
+        {
+                *number_of_vertices = end - tessellation->polylines[index];
+        }
+        return (tessellation->vertices + 3 * tessellation->polylines[index]);
+}
+
+
+/*!
+ * \brief Get the entity a polyline of a tessellation was tessellated
+ * from.
+ *
+ * \return a pointer to the entity, or \c NULL when the index is out of
+ * range.
+ */
+void *
+dxf_tessellation_get_source
+(
+        DxfTessellation *tessellation,
+                /*!< a pointer to the tessellation. */
+        size_t index
+                /*!< index of the polyline. */
+)
+{
+        if ((tessellation == NULL)
+          || (index >= tessellation->number_of_polylines))
+        {
+                return (NULL);
+        }
+        return (tessellation->sources[index]);
+}
+
+
+/* EOF */
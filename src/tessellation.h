@@ -0,0 +1,113 @@
+/*!
+ * \file tessellation.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF tessellation of curved entities into
+ * polylines.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_TESSELLATION_H
+#define LIBDXF_SRC_TESSELLATION_H
+
+
+#include "global.h"
+#include "entities.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_TESSELLATION_DEFAULT_CHORD_ERROR 0.01
+        /*!< \brief Default maximum distance between a curve and its
+         * polyline, in drawing units. */
+
+#define DXF_TESSELLATION_DEFAULT_MAX_SEGMENTS 4096
+        /*!< \brief Default maximum number of segments for a curve, for a
+         * \c HELIX per turn. */
+
+
+/*!
+ * \brief Polylines tessellated from entities.
+ *
+ * The vertices of all polylines are stored in one flat array of
+ * x, y, z triples in world coordinates.\n
+ * Closed curves repeat their first vertex as their last vertex.
+ */
+typedef struct
+dxf_tessellation_struct
+{
+        double chord_error;
+                /*!< Maximum distance between a curve and its polyline,
+                 * or 0.0 to not use this tolerance. */
+        double max_angle;
+                /*!< Maximum angle in radians of an arc segment, or 0.0
+                 * to not use this tolerance.\n
+                 * Segments never exceed a quarter turn. */
+        int max_segments;
+                /*!< Maximum number of segments of a curve. */
+        double *vertices;
+                /*!< Coordinates of the vertices, 3 per vertex. */
+        size_t number_of_vertices;
+                /*!< Number of vertices. */
+        size_t capacity;
+                /*!< Number of vertices allocated. */
+        size_t *polylines;
+                /*!< Index of the first vertex of each polyline. */
+        void **sources;
+                /*!< Entity each polyline was tessellated from. */
+        size_t number_of_polylines;
+                /*!< Number of polylines. */
+        size_t polylines_capacity;
+                /*!< Number of polylines allocated. */
+} DxfTessellation;
+
+
+DxfTessellation *dxf_tessellation_new (double chord_error, double max_angle);
+int dxf_tessellation_free (DxfTessellation *tessellation);
+int dxf_tessellation_clear (DxfTessellation *tessellation);
+int dxf_tessellation_get_number_of_segments (DxfTessellation *tessellation, double radius, double sweep);
+int dxf_tessellation_add_entity (DxfTessellation *tessellation, void *entity);
+int dxf_tessellation_add_entities (DxfTessellation *tessellation, DxfEntities *entities, int number_of_threads);
+size_t dxf_tessellation_get_number_of_polylines (DxfTessellation *tessellation);
+const double *dxf_tessellation_get_polyline (DxfTessellation *tessellation, size_t index, size_t *number_of_vertices);
+void *dxf_tessellation_get_source (DxfTessellation *tessellation, size_t index);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_TESSELLATION_H */
+
+
+/* EOF */
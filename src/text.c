@@ -33,6 +33,7 @@
 
 
 #include "text.h"
+#include "util.h"
 
 
 /*!
@@ -58,9 +59,9 @@ dxf_text_new ()
         size = sizeof (DxfText);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((text = malloc (size)) == NULL)
+        if ((text = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfText struct.\n")),
                   __FUNCTION__);
                 text = NULL;
@@ -68,6 +69,7 @@ dxf_text_new ()
         else
         {
                 memset (text, 0, size);
+                text->header.type = TEXT;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -101,23 +103,23 @@ dxf_text_init
         /* Do some basic checks. */
         if (text == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 text = dxf_text_new ();
         }
         if (text == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfText struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         text->id_code = 0;
-        text->text_value = strdup ("");
-        text->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        text->text_style = strdup ("");
-        text->layer = strdup (DXF_DEFAULT_LAYER);
+        text->text_value = dxf_strdup ("");
+        text->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        text->text_style = dxf_strdup ("");
+        text->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         text->x0 = 0.0;
         text->y0 = 0.0;
         text->z0 = 0.0;
@@ -128,7 +130,8 @@ dxf_text_init
         text->thickness = 0.0;
         text->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
         text->height = 0.0;
-        text->rel_x_scale = 0.0;
+        /* The default of the optional group 41, it is not written. */
+        text->rel_x_scale = 1.0;
         text->rot_angle = 0.0;
         text->obl_angle = 0.0;
         text->visibility = DXF_DEFAULT_VISIBILITY;
@@ -140,8 +143,8 @@ dxf_text_init
         text->extr_x0 = 0.0;
         text->extr_y0 = 0.0;
         text->extr_z0 = 0.0;
-        text->dictionary_owner_soft = strdup ("");
-        text->dictionary_owner_hard = strdup ("");
+        text->dictionary_owner_soft = dxf_strdup ("");
+        text->dictionary_owner_hard = dxf_strdup ("");
         text->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -180,46 +183,46 @@ dxf_text_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TEXT");
-        char *temp_string = NULL;
+        char *dxf_entity_name = dxf_strdup ("TEXT");
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (temp_string);
+                dxf_free (dxf_entity_name);
                 return (NULL);
         }
         if (text == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 text = dxf_text_new ();
                 text = dxf_text_init (text);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
                         /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
+                dxf_free (dxf_entity_name);
+                return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a text value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->text_value);
+                        dxf_read_string (fp, &text->text_value);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -233,20 +236,20 @@ dxf_text_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->linetype);
+                        dxf_read_string (fp, &text->linetype);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
                         /* Now follows a string containing a text style
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->text_style);
+                        dxf_read_string (fp, &text->text_style);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->layer);
+                        dxf_read_string (fp, &text->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -372,7 +375,7 @@ dxf_text_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbText") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -403,14 +406,14 @@ dxf_text_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->dictionary_owner_soft);
+                        dxf_read_string (fp, &text->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", text->dictionary_owner_hard);
+                        dxf_read_string (fp, &text->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -421,30 +424,38 @@ dxf_text_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (text->text_value, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
                 dxf_entity_skip (dxf_entity_name);
+                /* Clean up. */
+                dxf_free (dxf_entity_name);
                 return (NULL);
         }
         if (strcmp (text->linetype, "") == 0)
         {
-                text->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_string_assign (&text->linetype, DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (text->layer, "") == 0)
         {
-                text->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_string_assign (&text->layer, DXF_DEFAULT_LAYER);
         }
         /* Clean up. */
-        free (temp_string);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -473,62 +484,62 @@ dxf_text_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TEXT");
+        char *dxf_entity_name = dxf_strdup ("TEXT");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (text == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (text->text_value, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () text value string is empty for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (text->text_style, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () text style string is empty for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
-                text->text_style = strdup (DXF_DEFAULT_TEXTSTYLE);        }
+                text->text_style = dxf_strdup (DXF_DEFAULT_TEXTSTYLE);        }
         if (strcmp (text->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                text->layer = strdup (DXF_DEFAULT_LAYER);
+                text->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         if (text->height == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () height has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
         }
         if (text->rel_x_scale == 0.0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () relative X-scale factor has a value of 0.0 for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, text->id_code);
         }
@@ -579,7 +590,7 @@ dxf_text_write
           && DXF_FLATLAND
           && (text->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", text->elevation);
+                dxf_write_real (fp, 38, text->elevation);
         }
         if (text->color != DXF_COLOR_BYLAYER)
         {
@@ -587,7 +598,7 @@ dxf_text_write
         }
         if (text->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", text->linetype_scale);
+                dxf_write_real (fp, 48, text->linetype_scale);
         }
         if (text->visibility != 0)
         {
@@ -599,24 +610,24 @@ dxf_text_write
         }
         if (text->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", text->thickness);
+                dxf_write_real (fp, 39, text->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", text->x0);
-        fprintf (fp->fp, " 20\n%f\n", text->y0);
-        fprintf (fp->fp, " 30\n%f\n", text->z0);
-        fprintf (fp->fp, " 40\n%f\n", text->height);
+        dxf_write_real (fp, 10, text->x0);
+        dxf_write_real (fp, 20, text->y0);
+        dxf_write_real (fp, 30, text->z0);
+        dxf_write_real (fp, 40, text->height);
         fprintf (fp->fp, "  1\n%s\n", text->text_value);
         if (text->rot_angle != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", text->rot_angle);
+                dxf_write_real (fp, 50, text->rot_angle);
         }
         if (text->rel_x_scale != 1.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", text->rel_x_scale);
+                dxf_write_real (fp, 41, text->rel_x_scale);
         }
         if (text->obl_angle != 0.0)
         {
-                fprintf (fp->fp, " 51\n%f\n", text->obl_angle);
+                dxf_write_real (fp, 51, text->obl_angle);
         }
         if (strcmp (text->text_style, DXF_DEFAULT_TEXTSTYLE) != 0)
         {
@@ -634,10 +645,10 @@ dxf_text_write
         {
                 if ((text->x0 == text->x1) && (text->y0 == text->y1) && (text->z0 == text->z1))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () insertion point and alignment point are identical for the %s entity with id-code: %x\n")),
                           __FUNCTION__, dxf_entity_name, text->id_code);
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                           (_("\tdefault justification applied to %s entity\n")),
                           dxf_entity_name);
                         text->hor_align = 0;
@@ -645,9 +656,9 @@ dxf_text_write
                 }
                 else
                 {
-                        fprintf (fp->fp, " 11\n%f\n", text->x1);
-                        fprintf (fp->fp, " 21\n%f\n", text->y1);
-                        fprintf (fp->fp, " 31\n%f\n", text->z1);
+                        dxf_write_real (fp, 11, text->x1);
+                        dxf_write_real (fp, 21, text->y1);
+                        dxf_write_real (fp, 31, text->z1);
                 }
         }
         if ((fp->acad_version_number >= AutoCAD_12)
@@ -655,9 +666,9 @@ dxf_text_write
                 && (text->extr_y0 != 0.0)
                 && (text->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", text->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", text->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", text->extr_z0);
+                dxf_write_real (fp, 210, text->extr_x0);
+                dxf_write_real (fp, 220, text->extr_y0);
+                dxf_write_real (fp, 230, text->extr_z0);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -668,7 +679,7 @@ dxf_text_write
                 fprintf (fp->fp, " 73\n%d\n", text->vert_align);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -702,18 +713,18 @@ dxf_text_free
 #endif
         if (text == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (text->linetype);
-        free (text->layer);
-        free (text->text_value);
-        free (text->text_style);
-        free (text->dictionary_owner_soft);
-        free (text->dictionary_owner_hard);
-        free (text);
+        dxf_free (text->linetype);
+        dxf_free (text->layer);
+        dxf_free (text->text_value);
+        dxf_free (text->text_style);
+        dxf_free (text->dictionary_owner_soft);
+        dxf_free (text->dictionary_owner_hard);
+        dxf_free (text);
         text = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -739,18 +750,19 @@ dxf_text_free_chain
                 /*!< a pointer to the chain of DXF \c TEXT entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (texts == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (texts != NULL)
         {
                 struct DxfText *iter = texts->next;
+                texts->next = NULL;
                 dxf_text_free (texts);
                 texts = (DxfText *) iter;
         }
@@ -33,6 +33,9 @@
 
 
 #include "thumbnail.h"
+#include "util.h"
+#include "section.h"
+#include "endsec.h"
 
 
 /*!
@@ -74,9 +77,9 @@ dxf_thumbnail_new ()
         size = sizeof (DxfThumbnail);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((thumbnail = malloc (size)) == NULL)
+        if ((thumbnail = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfThumbnail struct.\n")),
                   __FUNCTION__);
                 thumbnail = NULL;
@@ -128,27 +131,29 @@ dxf_thumbnail_init
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
         /* Do some basic checks. */
         if (thumbnail == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 thumbnail = dxf_thumbnail_new ();
         }
         if (thumbnail == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfThumbnail struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         thumbnail->number_of_bytes = 0;
-        for (i = 0; i < DXF_MAX_PARAM; i++)
+        thumbnail->preview_image_data = dxf_binary_data_new ();
+        if (thumbnail->preview_image_data == NULL)
         {
-                thumbnail->preview_image_data[i] = strdup ("");
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory for the preview image data.\n")),
+                  __FUNCTION__);
+                return (NULL);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -199,50 +204,48 @@ dxf_thumbnail_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        int i;
-        int preview_data_length = 0;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (thumbnail == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 thumbnail = dxf_thumbnail_new ();
                 thumbnail = dxf_thumbnail_init (thumbnail);
         }
+        if (thumbnail->preview_image_data == NULL)
+        {
+                thumbnail->preview_image_data = dxf_binary_data_new ();
+        }
+        dxf_binary_data_clear (thumbnail->preview_image_data);
         if (fp->acad_version_number < AutoCAD_2000)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        i = 0;
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "90") == 0)
+                if (strcmp (temp_string, "90") == 0)
                 {
                         /* Now follows a string containing the
                          * number of bytes value. */
@@ -251,12 +254,10 @@ dxf_thumbnail_read
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
+                        /* Now follows a string containing a chunk of
+                         * the preview image, decode it. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", thumbnail->preview_image_data[i]);
-                        preview_data_length = preview_data_length + strlen (thumbnail->preview_image_data[i]);
-                        i++;
+                        dxf_binary_data_read (fp, thumbnail->preview_image_data);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -267,21 +268,26 @@ dxf_thumbnail_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
-        if (preview_data_length != thumbnail->number_of_bytes)
+        if (dxf_binary_data_get_number_of_bytes (thumbnail->preview_image_data) != (size_t) thumbnail->number_of_bytes)
         {
-                        fprintf (stderr,
-                          (_("Warning in %s () read %d preview data bytes from %s while %d were expected.\n")),
-                          __FUNCTION__, preview_data_length,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
+                          (_("Warning in %s () read %lu preview data bytes from %s while %d were expected.\n")),
+                          __FUNCTION__,
+                          (unsigned long) dxf_binary_data_get_number_of_bytes (thumbnail->preview_image_data),
                           fp->filename, thumbnail->number_of_bytes);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -292,6 +298,8 @@ dxf_thumbnail_read
 /*!
  * \brief Write a thumbnail to a DXF file.
  *
+ * Writes the complete \c THUMBNAILIMAGE section.
+ *
  * \version According to DXF R10 (backward compatibility).
  * \version According to DXF R11 (backward compatibility).
  * \version According to DXF R12 (backward compatibility).
@@ -323,54 +331,52 @@ dxf_thumbnail_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("THUMBNAILIMAGE");
-        int i;
+        char *dxf_entity_name = dxf_strdup ("THUMBNAILIMAGE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (thumbnail == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (thumbnail->number_of_bytes < 1)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () number of bytes was 0 or less.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_2000)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
+        dxf_section_write (fp, dxf_entity_name);
         fprintf (fp->fp, " 90\n%d\n", thumbnail->number_of_bytes);
-        i = 0;
-        while (strlen (thumbnail->preview_image_data[i]) > 0)
+        if (thumbnail->preview_image_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", thumbnail->preview_image_data[i]);
-                i++;
+                dxf_binary_data_write (fp, thumbnail->preview_image_data);
         }
+        dxf_endsec_write (fp);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -415,13 +421,11 @@ dxf_thumbnail_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int i;
-
-        for (i = 0; i < DXF_MAX_PARAM; i++)
+        if (thumbnail->preview_image_data != NULL)
         {
-                free (thumbnail->preview_image_data[i]);
+                dxf_binary_data_free (thumbnail->preview_image_data);
         }
-        free (thumbnail);
+        dxf_free (thumbnail);
         thumbnail = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -37,6 +37,7 @@
 
 
 #include "global.h"
+#include "binary_data.h"
 
 
 #ifdef __cplusplus
@@ -73,9 +74,10 @@ dxf_thumbnail
                 /*!< group code = 90\n
                  * The number of bytes in the image (and subsequent binary
                  * chunk records). */
-        char *preview_image_data[DXF_MAX_PARAM];
+        DxfBinaryData *preview_image_data;
                 /*!< group code = 310\n
-                 * multiple lines (256 characters maximum per line). */
+                 * The image, decoded from multiple lines (256
+                 * characters maximum per line). */
 } DxfThumbnail;
 
 
@@ -33,6 +33,7 @@
 
 
 #include "tolerance.h"
+#include "util.h"
 
 
 /*!
@@ -61,9 +62,9 @@ dxf_tolerance_new ()
         size = sizeof (DxfTolerance);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((tolerance = malloc (size)) == NULL)
+        if ((tolerance = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTolerance struct.\n")),
                   __FUNCTION__);
                 tolerance = NULL;
@@ -71,6 +72,7 @@ dxf_tolerance_new ()
         else
         {
                 memset (tolerance, 0, size);
+                tolerance->header.type = TOLERANCE;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -105,22 +107,22 @@ dxf_tolerance_init
         /* Do some basic checks. */
         if (tolerance == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 tolerance = dxf_tolerance_new ();
         }
         if (tolerance == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTolerance struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        tolerance->dimstyle_name = strdup ("");
+        tolerance->dimstyle_name = dxf_strdup ("");
         tolerance->id_code = 0;
-        tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        tolerance->layer = strdup (DXF_DEFAULT_LAYER);
+        tolerance->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        tolerance->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         tolerance->x0 = 0.0;
         tolerance->y0 = 0.0;
         tolerance->z0 = 0.0;
@@ -136,8 +138,8 @@ dxf_tolerance_init
         tolerance->visibility = DXF_DEFAULT_VISIBILITY;
         tolerance->color = DXF_COLOR_BYLAYER;
         tolerance->paperspace = DXF_MODELSPACE;
-        tolerance->dictionary_owner_soft = strdup ("");
-        tolerance->dictionary_owner_hard = strdup ("");
+        tolerance->dictionary_owner_soft = dxf_strdup ("");
+        tolerance->dictionary_owner_hard = dxf_strdup ("");
         tolerance->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -175,38 +177,34 @@ dxf_tolerance_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (tolerance == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 tolerance = dxf_tolerance_new ();
                 tolerance = dxf_tolerance_init (tolerance);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "3") == 0)
@@ -214,9 +212,9 @@ dxf_tolerance_read
                         /* Now follows a string containing the dimension
                          * style name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", tolerance->dimstyle_name);
+                        dxf_read_string (fp, &tolerance->dimstyle_name);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -228,13 +226,13 @@ dxf_tolerance_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", tolerance->linetype);
+                        dxf_read_string (fp, &tolerance->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", tolerance->layer);
+                        dxf_read_string (fp, &tolerance->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -331,7 +329,7 @@ dxf_tolerance_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbFcf") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -362,14 +360,14 @@ dxf_tolerance_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", tolerance->dictionary_owner_soft);
+                        dxf_read_string (fp, &tolerance->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", tolerance->dictionary_owner_hard);
+                        dxf_read_string (fp, &tolerance->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -380,10 +378,16 @@ dxf_tolerance_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (tolerance->dimstyle_name, "") == 0)
@@ -392,14 +396,12 @@ dxf_tolerance_read
         }
         if (strcmp (tolerance->linetype, "") == 0)
         {
-                tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                tolerance->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (tolerance->layer, "") == 0)
         {
-                tolerance->layer = strdup (DXF_DEFAULT_LAYER);
+                tolerance->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -431,53 +433,53 @@ dxf_tolerance_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TOLERANCE");
+        char *dxf_entity_name = dxf_strdup ("TOLERANCE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (tolerance == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (tolerance->dimstyle_name, "") == 0)
         {
-                fprintf (stderr, "Error in dxf_tolerance_write () empty dimstyle name for the %s entity with id-code: %x.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR, "Error in dxf_tolerance_write () empty dimstyle name for the %s entity with id-code: %x.\n",
                         dxf_entity_name, tolerance->id_code);
-                fprintf (stderr, "\tskipping %s entity.\n",
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO, "\tskipping %s entity.\n",
                         dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (tolerance->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, tolerance->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                tolerance->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                tolerance->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (tolerance->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, tolerance->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
                 tolerance->layer = DXF_DEFAULT_LAYER;
@@ -529,7 +531,7 @@ dxf_tolerance_write
           && DXF_FLATLAND
           && (tolerance->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", tolerance->elevation);
+                dxf_write_real (fp, 38, tolerance->elevation);
         }
         if (tolerance->color != DXF_COLOR_BYLAYER)
         {
@@ -537,7 +539,7 @@ dxf_tolerance_write
         }
         if (tolerance->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", tolerance->linetype_scale);
+                dxf_write_real (fp, 48, tolerance->linetype_scale);
         }
         if (tolerance->visibility != 0)
         {
@@ -549,26 +551,26 @@ dxf_tolerance_write
         }
         if (tolerance->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", tolerance->thickness);
+                dxf_write_real (fp, 39, tolerance->thickness);
         }
         fprintf (fp->fp, "  3\n%s\n", tolerance->dimstyle_name);
-        fprintf (fp->fp, " 10\n%f\n", tolerance->x0);
-        fprintf (fp->fp, " 20\n%f\n", tolerance->y0);
-        fprintf (fp->fp, " 30\n%f\n", tolerance->z0);
+        dxf_write_real (fp, 10, tolerance->x0);
+        dxf_write_real (fp, 20, tolerance->y0);
+        dxf_write_real (fp, 30, tolerance->z0);
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (tolerance->extr_x0 != 0.0)
                 && (tolerance->extr_y0 != 0.0)
                 && (tolerance->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", tolerance->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", tolerance->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", tolerance->extr_z0);
+                dxf_write_real (fp, 210, tolerance->extr_x0);
+                dxf_write_real (fp, 220, tolerance->extr_y0);
+                dxf_write_real (fp, 230, tolerance->extr_z0);
         }
-        fprintf (fp->fp, " 11\n%f\n", tolerance->x1);
-        fprintf (fp->fp, " 21\n%f\n", tolerance->y1);
-        fprintf (fp->fp, " 31\n%f\n", tolerance->z1);
+        dxf_write_real (fp, 11, tolerance->x1);
+        dxf_write_real (fp, 21, tolerance->y1);
+        dxf_write_real (fp, 31, tolerance->z1);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -602,17 +604,17 @@ dxf_tolerance_free
 #endif
         if (tolerance->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfTolerance was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (tolerance->dimstyle_name);
-        free (tolerance->linetype);
-        free (tolerance->layer);
-        free (tolerance->dictionary_owner_soft);
-        free (tolerance->dictionary_owner_hard);
-        free (tolerance);
+        dxf_free (tolerance->dimstyle_name);
+        dxf_free (tolerance->linetype);
+        dxf_free (tolerance->layer);
+        dxf_free (tolerance->dictionary_owner_soft);
+        dxf_free (tolerance->dictionary_owner_hard);
+        dxf_free (tolerance);
         tolerance = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -639,18 +641,19 @@ dxf_tolerance_free_chain
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (tolerances == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (tolerances != NULL)
         {
                 struct DxfTolerance *iter = tolerances->next;
+                tolerances->next = NULL;
                 dxf_tolerance_free (tolerances);
                 tolerances = (DxfTolerance *) iter;
         }
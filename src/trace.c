@@ -33,6 +33,7 @@
 
 
 #include "trace.h"
+#include "util.h"
 
 
 /*!
@@ -61,9 +62,9 @@ dxf_trace_new ()
         size = sizeof (DxfTrace);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((trace = malloc (size)) == NULL)
+        if ((trace = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTrace struct.\n")),
                   __FUNCTION__);
                 trace = NULL;
@@ -71,6 +72,7 @@ dxf_trace_new ()
         else
         {
                 memset (trace, 0, size);
+                trace->header.type = TRACE;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -105,21 +107,21 @@ dxf_trace_init
         /* Do some basic checks. */
         if (trace == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 trace = dxf_trace_new ();
         }
         if (trace == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfTrace struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         trace->id_code = 0;
-        trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        trace->layer = strdup (DXF_DEFAULT_LAYER);
+        trace->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        trace->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         trace->x0 = 0.0;
         trace->y0 = 0.0;
         trace->z0 = 0.0;
@@ -141,8 +143,8 @@ dxf_trace_init
         trace->extr_x0 = 0.0;
         trace->extr_y0 = 0.0;
         trace->extr_z0 = 0.0;
-        trace->dictionary_owner_soft = strdup ("");
-        trace->dictionary_owner_hard = strdup ("");
+        trace->dictionary_owner_soft = dxf_strdup ("");
+        trace->dictionary_owner_hard = dxf_strdup ("");
         trace->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -178,38 +180,34 @@ dxf_trace_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (trace == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 trace = dxf_trace_new ();
                 trace = dxf_trace_init (trace);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -224,13 +222,13 @@ dxf_trace_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", trace->linetype);
+                        dxf_read_string (fp, &trace->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", trace->layer);
+                        dxf_read_string (fp, &trace->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -370,7 +368,7 @@ dxf_trace_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbTrace") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -401,14 +399,14 @@ dxf_trace_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", trace->dictionary_owner_soft);
+                        dxf_read_string (fp, &trace->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", trace->dictionary_owner_hard);
+                        dxf_read_string (fp, &trace->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -419,22 +417,26 @@ dxf_trace_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (trace->linetype, "") == 0)
         {
-                trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                trace->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (trace->layer, "") == 0)
         {
-                trace->layer = strdup (DXF_DEFAULT_LAYER);
+                trace->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -466,46 +468,46 @@ dxf_trace_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("TRACE");
+        char *dxf_entity_name = dxf_strdup ("TRACE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (trace == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (trace->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, trace->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                trace->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                trace->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (trace->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, trace->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to layer 0")),
                   dxf_entity_name);
-                trace->layer = strdup (DXF_DEFAULT_LAYER);
+                trace->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -554,7 +556,7 @@ dxf_trace_write
           && DXF_FLATLAND
           && (trace->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", trace->elevation);
+                dxf_write_real (fp, 38, trace->elevation);
         }
         if (trace->color != DXF_COLOR_BYLAYER)
         {
@@ -562,7 +564,7 @@ dxf_trace_write
         }
         if (trace->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", trace->linetype_scale);
+                dxf_write_real (fp, 48, trace->linetype_scale);
         }
         if (trace->visibility != 0)
         {
@@ -572,33 +574,33 @@ dxf_trace_write
         {
                 fprintf (fp->fp, "100\nAcDbTrace\n");
         }
-        fprintf (fp->fp, " 10\n%f\n", trace->x0);
-        fprintf (fp->fp, " 20\n%f\n", trace->y0);
-        fprintf (fp->fp, " 30\n%f\n", trace->z0);
-        fprintf (fp->fp, " 11\n%f\n", trace->x1);
-        fprintf (fp->fp, " 21\n%f\n", trace->y1);
-        fprintf (fp->fp, " 31\n%f\n", trace->z1);
-        fprintf (fp->fp, " 12\n%f\n", trace->x2);
-        fprintf (fp->fp, " 22\n%f\n", trace->y2);
-        fprintf (fp->fp, " 32\n%f\n", trace->z2);
-        fprintf (fp->fp, " 13\n%f\n", trace->x3);
-        fprintf (fp->fp, " 23\n%f\n", trace->y3);
-        fprintf (fp->fp, " 33\n%f\n", trace->z3);
+        dxf_write_real (fp, 10, trace->x0);
+        dxf_write_real (fp, 20, trace->y0);
+        dxf_write_real (fp, 30, trace->z0);
+        dxf_write_real (fp, 11, trace->x1);
+        dxf_write_real (fp, 21, trace->y1);
+        dxf_write_real (fp, 31, trace->z1);
+        dxf_write_real (fp, 12, trace->x2);
+        dxf_write_real (fp, 22, trace->y2);
+        dxf_write_real (fp, 32, trace->z2);
+        dxf_write_real (fp, 13, trace->x3);
+        dxf_write_real (fp, 23, trace->y3);
+        dxf_write_real (fp, 33, trace->z3);
         if (trace->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", trace->thickness);
+                dxf_write_real (fp, 39, trace->thickness);
         }
         if ((fp->acad_version_number >= AutoCAD_12)
                 && (trace->extr_x0 != 0.0)
                 && (trace->extr_y0 != 0.0)
                 && (trace->extr_z0 != 1.0))
         {
-                fprintf (fp->fp, "210\n%f\n", trace->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", trace->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", trace->extr_z0);
+                dxf_write_real (fp, 210, trace->extr_x0);
+                dxf_write_real (fp, 220, trace->extr_y0);
+                dxf_write_real (fp, 230, trace->extr_z0);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -632,16 +634,16 @@ dxf_trace_free
 #endif
         if (trace->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfTrace was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (trace->linetype);
-        free (trace->layer);
-        free (trace->dictionary_owner_soft);
-        free (trace->dictionary_owner_hard);
-        free (trace);
+        dxf_free (trace->linetype);
+        dxf_free (trace->layer);
+        dxf_free (trace->dictionary_owner_soft);
+        dxf_free (trace->dictionary_owner_hard);
+        dxf_free (trace);
         trace = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -667,18 +669,19 @@ dxf_trace_free_chain
                 /*!< a pointer to the chain of DXF \c TRACE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (traces == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (traces != NULL)
         {
                 struct DxfTrace *iter = traces->next;
+                traces->next = NULL;
                 dxf_trace_free (traces);
                 traces = (DxfTrace *) iter;
         }
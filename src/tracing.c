@@ -0,0 +1,937 @@
+/*!
+ * \file tracing.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF tracing and phase timing instrumentation.
+ *
+ * The instrumentation consists of:
+ * <ul>
+ * <li>per phase timers (\c DXF_TRACING_TIMERS),</li>
+ * <li>per entity type counters for parsed entities, skipped entities,
+ * consumed bytes and heap allocations (\c DXF_TRACING_COUNTERS),</li>
+ * <li>a ring buffer of events per thread, which can be dumped in the
+ * Chrome trace event format (\c DXF_TRACING_EVENTS).</li>
+ * </ul>
+ * All instrumentation is off by default, the instrumentation points in
+ * the library then cost a load and a branch.\n
+ * Every thread records into its own state, so no locks are taken.
+ * The summaries and dumps are exact when the instrumented threads are
+ * idle.\n
+ * \n
+ * The functions in this file do not use \c DXF_DEBUG_BEGIN and
+ * \c DXF_DEBUG_END as these are implemented on top of them.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "tracing.h"
+
+
+int dxf_tracing_flags = 0;
+
+/*! \brief Number of events in newly allocated ring buffers. */
+static uint64_t dxf_tracing_ring_size = DXF_TRACING_DEFAULT_RING_SIZE;
+
+/*! \brief Time stamp all Chrome trace time stamps are relative to. */
+static uint64_t dxf_tracing_epoch = 0;
+
+/*! \brief List of the states of all threads that recorded anything. */
+static DxfTracingThread *dxf_tracing_threads = NULL;
+
+/*! \brief Last thread sequence number handed out. */
+static uint32_t dxf_tracing_last_tid = 0;
+
+/*! \brief State of the calling thread. */
+static __thread DxfTracingThread *dxf_tracing_self = NULL;
+
+
+/*!
+ * \brief Names of the entity types, indexed by \c DxfEntityType.
+ */
+static const char *dxf_tracing_entity_names[DXF_NUMBER_OF_ENTITY_TYPES] =
+{
+        "UNKNOWN",
+        "3DFACE",
+        "3DSOLID",
+        "ACAD_PROXY_ENTITY",
+        "ARC",
+        "ATTDEF",
+        "ATTRIB",
+        "BODY",
+        "CIRCLE",
+        "DIMENSION",
+        "ELLIPSE",
+        "HATCH",
+        "HELIX",
+        "IMAGE",
+        "INSERT",
+        "LEADER",
+        "LIGHT",
+        "LINE",
+        "LWPOLYLINE",
+        "MESH",
+        "MULTILEADER",
+        "MLEADERSTYLE",
+        "MTEXT",
+        "OLEFRAME",
+        "OLE2FRAME",
+        "POINT",
+        "POLYLINE",
+        "RAY",
+        "REGION",
+        "SECTION",
+        "SHAPE",
+        "SOLID",
+        "SPLINE",
+        "SUN",
+        "SURFACE",
+        "ACAD_TABLE",
+        "TEXT",
+        "TOLERANCE",
+        "TRACE",
+        "UNDERLAY",
+        "VERTEX",
+        "VIEWPORT",
+        "WIPEOUT",
+        "XLINE",
+        "MLINE"
+};
+
+
+/*!
+ * \brief Names of the phases, indexed by \c DxfTracingPhase.
+ */
+static const char *dxf_tracing_phase_names[DXF_TRACING_NUMBER_OF_PHASES] =
+{
+        "FILE",
+        "HEADER",
+        "CLASSES",
+        "TABLES",
+        "BLOCKS",
+        "ENTITIES",
+        "OBJECTS",
+        "THUMBNAIL"
+};
+
+
+/*!
+ * \brief Names of the counters, indexed by \c DxfTracingCounter.
+ */
+static const char *dxf_tracing_counter_names[DXF_TRACING_NUMBER_OF_COUNTERS] =
+{
+        "parsed",
+        "skipped",
+        "bytes",
+        "allocations"
+};
+
+
+/*!
+ * \brief Add to a counter owned by the calling thread.
+ *
+ * Only the owning thread writes a counter, a relaxed load and store
+ * suffices and lets other threads read the counter without tearing.
+ */
+#define DXF_TRACING_ADD(counter, n) \
+        __atomic_store_n (&(counter), \
+          __atomic_load_n (&(counter), __ATOMIC_RELAXED) + (n), \
+          __ATOMIC_RELAXED)
+
+
+/*!
+ * \brief Get the state of the calling thread, create it on first use.
+ *
+ * \return a pointer to the state, or \c NULL when no memory could be
+ * allocated.
+ */
+static DxfTracingThread *
+dxf_tracing_get_self ()
+{
+        DxfTracingThread *self = dxf_tracing_self;
+        DxfTracingThread *head;
+
+        if (self != NULL)
+        {
+                return (self);
+        }
+        self = calloc (1, sizeof (DxfTracingThread));
+        if (self == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        self->tid = __atomic_add_fetch (&dxf_tracing_last_tid, 1, __ATOMIC_RELAXED);
+        self->current_type = UNKNOWN_ENTITY;
+        /* Lock free prepend to the list of thread states. */
+        head = __atomic_load_n (&dxf_tracing_threads, __ATOMIC_ACQUIRE);
+        do
+        {
+                self->next = (struct DxfTracingThread *) head;
+        }
+        while (!__atomic_compare_exchange_n (&dxf_tracing_threads, &head,
+          self, 1, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+        dxf_tracing_self = self;
+        return (self);
+}
+
+
+/*!
+ * \brief Record an event in the ring buffer of the calling thread.
+ *
+ * When the ring buffer is full the oldest event is overwritten.
+ */
+static void
+dxf_tracing_record
+(
+        DxfTracingThread *self,
+                /*!< state of the calling thread. */
+        const char *name,
+                /*!< name of the event. */
+        char type,
+                /*!< Chrome trace event type. */
+        uint64_t timestamp,
+                /*!< time stamp in nanoseconds. */
+        uint64_t duration
+                /*!< duration in nanoseconds. */
+)
+{
+        DxfTracingEvent *event;
+        uint64_t head;
+
+        if (self->ring == NULL)
+        {
+                self->ring = malloc (dxf_tracing_ring_size * sizeof (DxfTracingEvent));
+                if (self->ring == NULL)
+                {
+                        return;
+                }
+                self->ring_mask = dxf_tracing_ring_size - 1;
+        }
+        head = self->ring_head;
+        event = &self->ring[head & self->ring_mask];
+        event->timestamp = timestamp;
+        event->duration = duration;
+        event->name = name;
+        event->type = type;
+        /* Publish the event to dumping threads. */
+        __atomic_store_n (&self->ring_head, head + 1, __ATOMIC_RELEASE);
+}
+
+
+/*!
+ * \brief Enable instrumentation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tracing_enable
+(
+        int flags,
+                /*!< a combination of \c DXF_TRACING_TIMERS,
+                 * \c DXF_TRACING_COUNTERS and \c DXF_TRACING_EVENTS. */
+        size_t ring_size
+                /*!< number of events in a per thread ring buffer,
+                 * rounded up to a power of 2, or 0 for the default.\n
+                 * Only applies to threads that did not record events
+                 * yet. */
+)
+{
+        uint64_t size = 1;
+
+        if ((flags & ~DXF_TRACING_ALL) != 0)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () invalid flags %d were passed.\n")),
+                  __FUNCTION__, flags);
+                return (EXIT_FAILURE);
+        }
+        if (ring_size == 0)
+        {
+                ring_size = DXF_TRACING_DEFAULT_RING_SIZE;
+        }
+        while (size < ring_size)
+        {
+                size <<= 1;
+        }
+        dxf_tracing_ring_size = size;
+        if (dxf_tracing_epoch == 0)
+        {
+                dxf_tracing_epoch = dxf_tracing_now ();
+        }
+        dxf_tracing_flags = flags;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Disable all instrumentation.
+ *
+ * The recorded counters, timers and events are kept.
+ *
+ * \return \c EXIT_SUCCESS.
+ */
+int
+dxf_tracing_disable ()
+{
+        dxf_tracing_flags = 0;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Clear all counters, timers and ring buffers.
+ *
+ * \warning Only call this function while no other thread is recording.
+ *
+ * \return \c EXIT_SUCCESS.
+ */
+int
+dxf_tracing_reset ()
+{
+        DxfTracingThread *iter;
+
+        for (iter = __atomic_load_n (&dxf_tracing_threads, __ATOMIC_ACQUIRE);
+          iter != NULL;
+          iter = (DxfTracingThread *) iter->next)
+        {
+                memset (iter->counter, 0, sizeof (iter->counter));
+                memset (iter->phase_time, 0, sizeof (iter->phase_time));
+                memset (iter->phase_count, 0, sizeof (iter->phase_count));
+                __atomic_store_n (&iter->ring_head, 0, __ATOMIC_RELEASE);
+        }
+        dxf_tracing_epoch = dxf_tracing_now ();
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get a monotonic time stamp.
+ *
+ * \return the time stamp in nanoseconds.
+ */
+uint64_t
+dxf_tracing_now ()
+{
+        struct timespec now;
+
+        clock_gettime (CLOCK_MONOTONIC, &now);
+        return ((uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec);
+}
+
+
+/*!
+ * \brief Get the DXF name of an entity type.
+ *
+ * \return the name, \c "UNKNOWN" for an unknown type.
+ */
+const char *
+dxf_tracing_entity_name
+(
+        DxfEntityType type
+                /*!< entity type. */
+)
+{
+        if ((type < 0) || (type >= DXF_NUMBER_OF_ENTITY_TYPES))
+        {
+                type = UNKNOWN_ENTITY;
+        }
+        return (dxf_tracing_entity_names[type]);
+}
+
+
+/*!
+ * \brief Get the entity type for a DXF entity name.
+ *
+ * \return the entity type, or \c UNKNOWN_ENTITY.
+ */
+DxfEntityType
+dxf_tracing_entity_type
+(
+        const char *name
+                /*!< DXF entity name, for example \c "LINE". */
+)
+{
+        int i;
+
+        if (name == NULL)
+        {
+                return (UNKNOWN_ENTITY);
+        }
+        for (i = 1; i < DXF_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                if (strcmp (dxf_tracing_entity_names[i], name) == 0)
+                {
+                        return ((DxfEntityType) i);
+                }
+        }
+        return (UNKNOWN_ENTITY);
+}
+
+
+/*!
+ * \brief Mark the start of a phase, use \c DXF_TRACING_PHASE_BEGIN.
+ */
+void
+dxf_tracing_phase_begin
+(
+        DxfTracingPhase phase
+                /*!< phase. */
+)
+{
+        DxfTracingThread *self = dxf_tracing_get_self ();
+
+        if ((self == NULL) || (phase >= DXF_TRACING_NUMBER_OF_PHASES))
+        {
+                return;
+        }
+        self->phase_start[phase] = dxf_tracing_now ();
+        DXF_TRACING_ADD (self->phase_count[phase], 1);
+}
+
+
+/*!
+ * \brief Mark the end of a phase, use \c DXF_TRACING_PHASE_END.
+ */
+void
+dxf_tracing_phase_end
+(
+        DxfTracingPhase phase
+                /*!< phase. */
+)
+{
+        DxfTracingThread *self = dxf_tracing_get_self ();
+        uint64_t duration;
+
+        if ((self == NULL) || (phase >= DXF_TRACING_NUMBER_OF_PHASES)
+          || (self->phase_start[phase] == 0))
+        {
+                return;
+        }
+        duration = dxf_tracing_now () - self->phase_start[phase];
+        if (dxf_tracing_flags & DXF_TRACING_TIMERS)
+        {
+                DXF_TRACING_ADD (self->phase_time[phase], duration);
+        }
+        if (dxf_tracing_flags & DXF_TRACING_EVENTS)
+        {
+                dxf_tracing_record (self, dxf_tracing_phase_names[phase], 'X',
+                  self->phase_start[phase], duration);
+        }
+        self->phase_start[phase] = 0;
+}
+
+
+/*!
+ * \brief Add to a counter of an entity type, use \c DXF_TRACING_COUNT.
+ */
+void
+dxf_tracing_count
+(
+        DxfEntityType type,
+                /*!< entity type. */
+        DxfTracingCounter counter,
+                /*!< counter. */
+        uint64_t n
+                /*!< value to add. */
+)
+{
+        DxfTracingThread *self = dxf_tracing_get_self ();
+
+        if ((self == NULL) || (counter >= DXF_TRACING_NUMBER_OF_COUNTERS))
+        {
+                return;
+        }
+        if ((type < 0) || (type >= DXF_NUMBER_OF_ENTITY_TYPES))
+        {
+                type = UNKNOWN_ENTITY;
+        }
+        DXF_TRACING_ADD (self->counter[type][counter], n);
+}
+
+
+/*!
+ * \brief Account a heap allocation to the entity being parsed by the
+ * calling thread, use \c DXF_TRACING_ALLOCATION.
+ */
+void
+dxf_tracing_count_allocation ()
+{
+        DxfTracingThread *self = dxf_tracing_get_self ();
+
+        if (self == NULL)
+        {
+                return;
+        }
+        DXF_TRACING_ADD (self->counter[self->current_type][DXF_TRACING_ALLOCATIONS], 1);
+}
+
+
+/*!
+ * \brief Mark the start of parsing an entity, use
+ * \c DXF_TRACING_ENTITY_BEGIN.
+ *
+ * \return the current offset in the input file, or 0 when not known.
+ */
+off_t
+dxf_tracing_entity_begin
+(
+        DxfEntityType type,
+                /*!< entity type. */
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+        DxfTracingThread *self = dxf_tracing_get_self ();
+        off_t offset = 0;
+
+        if (self == NULL)
+        {
+                return (0);
+        }
+        if ((type < 0) || (type >= DXF_NUMBER_OF_ENTITY_TYPES))
+        {
+                type = UNKNOWN_ENTITY;
+        }
+        self->current_type = type;
+        if ((dxf_tracing_flags & DXF_TRACING_COUNTERS)
+          && (fp != NULL) && (fp->fp != NULL))
+        {
+                offset = ftello (fp->fp);
+        }
+        if (dxf_tracing_flags & DXF_TRACING_EVENTS)
+        {
+                dxf_tracing_record (self, dxf_tracing_entity_names[type], 'B',
+                  dxf_tracing_now (), 0);
+        }
+        return ((offset < 0) ? 0 : offset);
+}
+
+
+/*!
+ * \brief Mark the end of parsing an entity, use
+ * \c DXF_TRACING_ENTITY_END.
+ */
+void
+dxf_tracing_entity_end
+(
+        DxfEntityType type,
+                /*!< entity type. */
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        off_t offset
+                /*!< offset returned by \c DXF_TRACING_ENTITY_BEGIN. */
+)
+{
+        DxfTracingThread *self = dxf_tracing_get_self ();
+        off_t end;
+
+        if (self == NULL)
+        {
+                return;
+        }
+        if ((type < 0) || (type >= DXF_NUMBER_OF_ENTITY_TYPES))
+        {
+                type = UNKNOWN_ENTITY;
+        }
+        if (dxf_tracing_flags & DXF_TRACING_COUNTERS)
+        {
+                DXF_TRACING_ADD (self->counter[type][DXF_TRACING_PARSED], 1);
+                if ((offset > 0) && (fp != NULL) && (fp->fp != NULL))
+                {
+                        end = ftello (fp->fp);
+                        if (end >= offset)
+                        {
+                                DXF_TRACING_ADD (self->counter[type][DXF_TRACING_BYTES],
+                                  (uint64_t) (end - offset));
+                        }
+                }
+        }
+        if (dxf_tracing_flags & DXF_TRACING_EVENTS)
+        {
+                dxf_tracing_record (self, dxf_tracing_entity_names[type], 'E',
+                  dxf_tracing_now (), 0);
+        }
+        self->current_type = UNKNOWN_ENTITY;
+}
+
+
+/*!
+ * \brief Record an event in the ring buffer of the calling thread.
+ */
+void
+dxf_tracing_event
+(
+        const char *name,
+                /*!< name of the event, has to be a string with static
+                 * storage duration. */
+        char type
+                /*!< Chrome trace event type: \c 'B', \c 'E' or
+                 * \c 'i'. */
+)
+{
+        DxfTracingThread *self;
+
+        if ((dxf_tracing_flags & DXF_TRACING_EVENTS) == 0)
+        {
+                return;
+        }
+        self = dxf_tracing_get_self ();
+        if (self == NULL)
+        {
+                return;
+        }
+        dxf_tracing_record (self, name, type, dxf_tracing_now (), 0);
+}
+
+
+/*!
+ * \brief Record the entry of a function, used by \c DXF_DEBUG_BEGIN.
+ */
+void
+dxf_tracing_function_begin
+(
+        const char *function
+                /*!< name of the function. */
+)
+{
+        dxf_tracing_event (function, 'B');
+}
+
+
+/*!
+ * \brief Record the exit of a function, used by \c DXF_DEBUG_END.
+ */
+void
+dxf_tracing_function_end
+(
+        const char *function
+                /*!< name of the function. */
+)
+{
+        dxf_tracing_event (function, 'E');
+}
+
+
+/*!
+ * \brief Get a counter of an entity type summed over all threads.
+ *
+ * \return the value of the counter.
+ */
+uint64_t
+dxf_tracing_get_counter
+(
+        DxfEntityType type,
+                /*!< entity type. */
+        DxfTracingCounter counter
+                /*!< counter. */
+)
+{
+        DxfTracingThread *iter;
+        uint64_t sum = 0;
+
+        if ((type < 0) || (type >= DXF_NUMBER_OF_ENTITY_TYPES)
+          || (counter >= DXF_TRACING_NUMBER_OF_COUNTERS))
+        {
+                return (0);
+        }
+        for (iter = __atomic_load_n (&dxf_tracing_threads, __ATOMIC_ACQUIRE);
+          iter != NULL;
+          iter = (DxfTracingThread *) iter->next)
+        {
+                sum += __atomic_load_n (&iter->counter[type][counter], __ATOMIC_RELAXED);
+        }
+        return (sum);
+}
+
+
+/*!
+ * \brief Get the time spent in a phase summed over all threads.
+ *
+ * \return the time in nanoseconds.
+ */
+uint64_t
+dxf_tracing_get_phase_time
+(
+        DxfTracingPhase phase
+                /*!< phase. */
+)
+{
+        DxfTracingThread *iter;
+        uint64_t sum = 0;
+
+        if (phase >= DXF_TRACING_NUMBER_OF_PHASES)
+        {
+                return (0);
+        }
+        for (iter = __atomic_load_n (&dxf_tracing_threads, __ATOMIC_ACQUIRE);
+          iter != NULL;
+          iter = (DxfTracingThread *) iter->next)
+        {
+                sum += __atomic_load_n (&iter->phase_time[phase], __ATOMIC_RELAXED);
+        }
+        return (sum);
+}
+
+
+/*!
+ * \brief Get the number of times a phase was entered summed over all
+ * threads.
+ *
+ * \return the number of times.
+ */
+uint64_t
+dxf_tracing_get_phase_count
+(
+        DxfTracingPhase phase
+                /*!< phase. */
+)
+{
+        DxfTracingThread *iter;
+        uint64_t sum = 0;
+
+        if (phase >= DXF_TRACING_NUMBER_OF_PHASES)
+        {
+                return (0);
+        }
+        for (iter = __atomic_load_n (&dxf_tracing_threads, __ATOMIC_ACQUIRE);
+          iter != NULL;
+          iter = (DxfTracingThread *) iter->next)
+        {
+                sum += __atomic_load_n (&iter->phase_count[phase], __ATOMIC_RELAXED);
+        }
+        return (sum);
+}
+
+
+/*!
+ * \brief Write a human readable summary of the timers and counters.
+ *
+ * Phases which were never entered and entity types without any counts
+ * are left out.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tracing_write_summary
+(
+        FILE *stream
+                /*!< stream to write to. */
+)
+{
+        uint64_t value[DXF_TRACING_NUMBER_OF_COUNTERS];
+        uint64_t count;
+        int i;
+        int j;
+        int any;
+
+        if (stream == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fprintf (stream, "%-18s %12s %14s\n", "phase", "count", "seconds");
+        for (i = 0; i < DXF_TRACING_NUMBER_OF_PHASES; i++)
+        {
+                count = dxf_tracing_get_phase_count (i);
+                if (count == 0)
+                {
+                        continue;
+                }
+                fprintf (stream, "%-18s %12" PRIu64 " %14.6f\n",
+                  dxf_tracing_phase_names[i], count,
+                  (double) dxf_tracing_get_phase_time (i) / 1e9);
+        }
+        fprintf (stream, "%-18s %12s %12s %14s %12s\n",
+          "entity", "parsed", "skipped", "bytes", "allocations");
+        for (i = 0; i < DXF_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                any = FALSE;
+                for (j = 0; j < DXF_TRACING_NUMBER_OF_COUNTERS; j++)
+                {
+                        value[j] = dxf_tracing_get_counter (i, j);
+                        if (value[j] != 0)
+                        {
+                                any = TRUE;
+                        }
+                }
+                if (!any)
+                {
+                        continue;
+                }
+                fprintf (stream, "%-18s %12" PRIu64 " %12" PRIu64 " %14" PRIu64 " %12" PRIu64 "\n",
+                  dxf_tracing_entity_names[i],
+                  value[DXF_TRACING_PARSED], value[DXF_TRACING_SKIPPED],
+                  value[DXF_TRACING_BYTES], value[DXF_TRACING_ALLOCATIONS]);
+        }
+        return (ferror (stream) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write a time stamp in microseconds, relative to the start of
+ * the trace, as used by the Chrome trace event format.
+ */
+static void
+dxf_tracing_write_timestamp
+(
+        FILE *stream,
+                /*!< stream to write to. */
+        uint64_t timestamp
+                /*!< time stamp in nanoseconds. */
+)
+{
+        timestamp = (timestamp > dxf_tracing_epoch) ? timestamp - dxf_tracing_epoch : 0;
+        fprintf (stream, "%" PRIu64 ".%03u",
+          timestamp / 1000, (unsigned int) (timestamp % 1000));
+}
+
+
+/*!
+ * \brief Dump the ring buffers of all threads in the Chrome trace event
+ * format (JSON), to be loaded in chrome://tracing or Perfetto.
+ *
+ * The per entity type counters are added as counter (\c 'C') events at
+ * the end of the trace.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tracing_write_chrome_json
+(
+        const char *filename
+                /*!< name of the file to write. */
+)
+{
+        FILE *stream;
+        DxfTracingThread *iter;
+        DxfTracingEvent *event;
+        uint64_t head;
+        uint64_t first;
+        uint64_t i;
+        uint64_t now;
+        int j;
+        const char *separator = "\n";
+        int result = EXIT_SUCCESS;
+
+        if (filename == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        stream = fopen (filename, "w");
+        if (stream == NULL)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () could not open file: %s for writing.\n")),
+                  __FUNCTION__, filename);
+                return (EXIT_FAILURE);
+        }
+        now = dxf_tracing_now ();
+        fprintf (stream, "{\"traceEvents\":[");
+        for (iter = __atomic_load_n (&dxf_tracing_threads, __ATOMIC_ACQUIRE);
+          iter != NULL;
+          iter = (DxfTracingThread *) iter->next)
+        {
+                fprintf (stream, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"libdxf %u\"}}",
+                  separator, iter->tid, iter->tid);
+                separator = ",\n";
+                if (iter->ring == NULL)
+                {
+                        continue;
+                }
+                head = __atomic_load_n (&iter->ring_head, __ATOMIC_ACQUIRE);
+                first = (head > iter->ring_mask + 1) ? head - iter->ring_mask - 1 : 0;
+                for (i = first; i < head; i++)
+                {
+                        event = &iter->ring[i & iter->ring_mask];
+                        fprintf (stream, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":1,\"tid\":%u,\"ts\":",
+                          event->name, event->type, iter->tid);
+                        dxf_tracing_write_timestamp (stream, event->timestamp);
+                        if (event->type == 'X')
+                        {
+                                fprintf (stream, ",\"dur\":%" PRIu64 ".%03u",
+                                  event->duration / 1000,
+                                  (unsigned int) (event->duration % 1000));
+                        }
+                        else if (event->type == 'i')
+                        {
+                                fprintf (stream, ",\"s\":\"t\"");
+                        }
+                        fprintf (stream, "}");
+                }
+        }
+        for (j = 0; j < DXF_NUMBER_OF_ENTITY_TYPES; j++)
+        {
+                if ((dxf_tracing_get_counter (j, DXF_TRACING_PARSED) == 0)
+                  && (dxf_tracing_get_counter (j, DXF_TRACING_SKIPPED) == 0))
+                {
+                        continue;
+                }
+                fprintf (stream, "%s{\"name\":\"%s\",\"ph\":\"C\",\"pid\":1,\"ts\":",
+                  separator, dxf_tracing_entity_names[j]);
+                separator = ",\n";
+                dxf_tracing_write_timestamp (stream, now);
+                fprintf (stream, ",\"args\":{\"%s\":%" PRIu64 ",\"%s\":%" PRIu64 ",\"%s\":%" PRIu64 ",\"%s\":%" PRIu64 "}}",
+                  dxf_tracing_counter_names[DXF_TRACING_PARSED],
+                  dxf_tracing_get_counter (j, DXF_TRACING_PARSED),
+                  dxf_tracing_counter_names[DXF_TRACING_SKIPPED],
+                  dxf_tracing_get_counter (j, DXF_TRACING_SKIPPED),
+                  dxf_tracing_counter_names[DXF_TRACING_BYTES],
+                  dxf_tracing_get_counter (j, DXF_TRACING_BYTES),
+                  dxf_tracing_counter_names[DXF_TRACING_ALLOCATIONS],
+                  dxf_tracing_get_counter (j, DXF_TRACING_ALLOCATIONS));
+        }
+        fprintf (stream, "\n],\"displayTimeUnit\":\"ns\"}\n");
+        if (ferror (stream))
+        {
+                result = EXIT_FAILURE;
+        }
+        if (fclose (stream) != 0)
+        {
+                result = EXIT_FAILURE;
+        }
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () while writing to: %s.\n")),
+                  __FUNCTION__, filename);
+        }
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,234 @@
+/*!
+ * \file tracing.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF tracing and phase timing
+ * instrumentation.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_TRACING_H
+#define LIBDXF_SRC_TRACING_H
+
+
+#include "global.h"
+#include "entity.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_TRACING_TIMERS 1
+        /*!< \brief Accumulate the time spent in each phase. */
+
+#define DXF_TRACING_COUNTERS 2
+        /*!< \brief Maintain the per entity type counters. */
+
+#define DXF_TRACING_EVENTS 4
+        /*!< \brief Record events in the per thread ring buffers. */
+
+#define DXF_TRACING_ALL (DXF_TRACING_TIMERS | DXF_TRACING_COUNTERS | DXF_TRACING_EVENTS)
+        /*!< \brief All instrumentation on. */
+
+#define DXF_TRACING_DEFAULT_RING_SIZE 65536
+        /*!< \brief Default number of events in a per thread ring
+         * buffer. */
+
+
+/*!
+ * \brief Phases timed by the instrumentation.
+ *
+ * The phases are used for reading as well as for writing.
+ */
+typedef enum
+dxf_tracing_phase
+{
+        DXF_TRACING_PHASE_FILE,
+        DXF_TRACING_PHASE_HEADER,
+        DXF_TRACING_PHASE_CLASSES,
+        DXF_TRACING_PHASE_TABLES,
+        DXF_TRACING_PHASE_BLOCKS,
+        DXF_TRACING_PHASE_ENTITIES,
+        DXF_TRACING_PHASE_OBJECTS,
+        DXF_TRACING_PHASE_THUMBNAIL,
+        DXF_TRACING_NUMBER_OF_PHASES
+} DxfTracingPhase;
+
+
+/*!
+ * \brief Counters maintained for each entity type.
+ */
+typedef enum
+dxf_tracing_counter
+{
+        DXF_TRACING_PARSED,
+                /*!< Number of entities parsed. */
+        DXF_TRACING_SKIPPED,
+                /*!< Number of entities skipped. */
+        DXF_TRACING_BYTES,
+                /*!< Number of bytes consumed while parsing. */
+        DXF_TRACING_ALLOCATIONS,
+                /*!< Number of heap allocations. */
+        DXF_TRACING_NUMBER_OF_COUNTERS
+} DxfTracingCounter;
+
+
+/*!
+ * \brief An event in a ring buffer.
+ */
+typedef struct
+dxf_tracing_event_struct
+{
+        uint64_t timestamp;
+                /*!< Time stamp in nanoseconds. */
+        uint64_t duration;
+                /*!< Duration in nanoseconds, only for complete
+                 * (\c 'X') events. */
+        const char *name;
+                /*!< Name of the event, has to be a string with static
+                 * storage duration. */
+        char type;
+                /*!< Chrome trace event type: \c 'B' (begin), \c 'E'
+                 * (end), \c 'X' (complete) or \c 'i' (instant). */
+} DxfTracingEvent;
+
+
+/*!
+ * \brief Instrumentation state of a thread.
+ *
+ * Every thread owns its state, so recording needs no locks and no
+ * atomic read-modify-write operations.\n
+ * The states are linked in a list which is only ever prepended to
+ * (lock free), they are kept until the process exits so the counters
+ * of finished threads remain available.
+ */
+typedef struct
+dxf_tracing_thread_struct
+{
+        uint32_t tid;
+                /*!< Sequence number of the thread, used as thread id
+                 * in the Chrome trace. */
+        uint64_t counter[DXF_NUMBER_OF_ENTITY_TYPES][DXF_TRACING_NUMBER_OF_COUNTERS];
+                /*!< Per entity type counters. */
+        uint64_t phase_time[DXF_TRACING_NUMBER_OF_PHASES];
+                /*!< Accumulated time per phase in nanoseconds. */
+        uint64_t phase_count[DXF_TRACING_NUMBER_OF_PHASES];
+                /*!< Number of times a phase was entered. */
+        uint64_t phase_start[DXF_TRACING_NUMBER_OF_PHASES];
+                /*!< Time stamp of the last start of a phase. */
+        DxfEntityType current_type;
+                /*!< Type of the entity being parsed, allocations are
+                 * accounted to this type. */
+        DxfTracingEvent *ring;
+                /*!< Ring buffer of events, \c NULL until the first
+                 * event is recorded. */
+        uint64_t ring_mask;
+                /*!< Number of events in the ring buffer minus 1, the
+                 * size is a power of 2. */
+        uint64_t ring_head;
+                /*!< Number of events ever recorded in the ring. */
+        struct DxfTracingThread *next;
+                /*!< Pointer to the state of the next thread. */
+} DxfTracingThread;
+
+
+extern int dxf_tracing_flags;
+        /*!< \brief Currently enabled instrumentation, a combination of
+         * \c DXF_TRACING_TIMERS, \c DXF_TRACING_COUNTERS and
+         * \c DXF_TRACING_EVENTS.
+         *
+         * Only read by the macros below, when 0 every instrumentation
+         * point costs a load and a branch. */
+
+
+#define DXF_TRACING_PHASE_BEGIN(phase) \
+        ((dxf_tracing_flags & (DXF_TRACING_TIMERS | DXF_TRACING_EVENTS)) \
+          ? dxf_tracing_phase_begin (phase) : (void) 0)
+        /*!< \brief Mark the start of a phase. */
+
+#define DXF_TRACING_PHASE_END(phase) \
+        ((dxf_tracing_flags & (DXF_TRACING_TIMERS | DXF_TRACING_EVENTS)) \
+          ? dxf_tracing_phase_end (phase) : (void) 0)
+        /*!< \brief Mark the end of a phase. */
+
+#define DXF_TRACING_COUNT(type, counter, n) \
+        ((dxf_tracing_flags & DXF_TRACING_COUNTERS) \
+          ? dxf_tracing_count ((type), (counter), (n)) : (void) 0)
+        /*!< \brief Add \c n to a counter of an entity type. */
+
+#define DXF_TRACING_ALLOCATION() \
+        ((dxf_tracing_flags & DXF_TRACING_COUNTERS) \
+          ? dxf_tracing_count_allocation () : (void) 0)
+        /*!< \brief Account an allocation to the entity being parsed. */
+
+#define DXF_TRACING_ENTITY_BEGIN(type, fp) \
+        ((dxf_tracing_flags & (DXF_TRACING_COUNTERS | DXF_TRACING_EVENTS)) \
+          ? dxf_tracing_entity_begin ((type), (fp)) : 0)
+        /*!< \brief Mark the start of parsing an entity, evaluates to
+         * the file offset to pass to \c DXF_TRACING_ENTITY_END. */
+
+#define DXF_TRACING_ENTITY_END(type, fp, offset) \
+        ((dxf_tracing_flags & (DXF_TRACING_COUNTERS | DXF_TRACING_EVENTS)) \
+          ? dxf_tracing_entity_end ((type), (fp), (offset)) : (void) 0)
+        /*!< \brief Mark the end of parsing an entity. */
+
+
+int dxf_tracing_enable (int flags, size_t ring_size);
+int dxf_tracing_disable ();
+int dxf_tracing_reset ();
+uint64_t dxf_tracing_now ();
+const char *dxf_tracing_entity_name (DxfEntityType type);
+DxfEntityType dxf_tracing_entity_type (const char *name);
+void dxf_tracing_phase_begin (DxfTracingPhase phase);
+void dxf_tracing_phase_end (DxfTracingPhase phase);
+void dxf_tracing_count (DxfEntityType type, DxfTracingCounter counter, uint64_t n);
+void dxf_tracing_count_allocation ();
+off_t dxf_tracing_entity_begin (DxfEntityType type, DxfFile *fp);
+void dxf_tracing_entity_end (DxfEntityType type, DxfFile *fp, off_t offset);
+void dxf_tracing_event (const char *name, char type);
+void dxf_tracing_function_begin (const char *function);
+void dxf_tracing_function_end (const char *function);
+uint64_t dxf_tracing_get_counter (DxfEntityType type, DxfTracingCounter counter);
+uint64_t dxf_tracing_get_phase_time (DxfTracingPhase phase);
+uint64_t dxf_tracing_get_phase_count (DxfTracingPhase phase);
+int dxf_tracing_write_summary (FILE *stream);
+int dxf_tracing_write_chrome_json (const char *filename);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_TRACING_H */
+
+
+/* EOF */
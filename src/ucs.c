@@ -33,6 +33,7 @@
 
 
 #include "ucs.h"
+#include "util.h"
 
 
 /*!
@@ -61,9 +62,9 @@ dxf_ucs_new ()
         size = sizeof (DxfUcs);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((ucs = malloc (size)) == NULL)
+        if ((ucs = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfUcs struct.\n")),
                   __FUNCTION__);
                 ucs = NULL;
@@ -105,20 +106,20 @@ dxf_ucs_init
         /* Do some basic checks. */
         if (ucs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ucs = dxf_ucs_new ();
         }
         if (ucs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfUcs struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         ucs->id_code = 0;
-        ucs->UCS_name = strdup ("");
+        ucs->UCS_name = dxf_strdup ("");
         ucs->x_origin = 0.0;
         ucs->y_origin = 0.0;
         ucs->z_origin = 0.0;
@@ -129,8 +130,8 @@ dxf_ucs_init
         ucs->y_Y_dir = 0.0;
         ucs->z_Y_dir = 0.0;
         ucs->flag = 0;
-        ucs->dictionary_owner_soft = strdup ("");
-        ucs->dictionary_owner_hard = strdup ("");
+        ucs->dictionary_owner_soft = dxf_strdup ("");
+        ucs->dictionary_owner_hard = dxf_strdup ("");
         ucs->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -168,38 +169,34 @@ dxf_ucs_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ucs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ucs = dxf_ucs_new ();
                 ucs = dxf_ucs_init (ucs);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -214,7 +211,7 @@ dxf_ucs_read
                         /* Now follows a string containing an UCS
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ucs->UCS_name);
+                        dxf_read_string (fp, &ucs->UCS_name);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -302,7 +299,7 @@ dxf_ucs_read
                         if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
                         && ((strcmp (temp_string, "AcDbUCSTableRecord") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -312,14 +309,14 @@ dxf_ucs_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ucs->dictionary_owner_soft);
+                        dxf_read_string (fp, &ucs->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", ucs->dictionary_owner_hard);
+                        dxf_read_string (fp, &ucs->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -330,13 +327,17 @@ dxf_ucs_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -368,38 +369,38 @@ dxf_ucs_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("UCS");
+        char *dxf_entity_name = dxf_strdup ("UCS");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (ucs == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((ucs->UCS_name == NULL)
           || (strcmp (ucs->UCS_name, "") == 0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty UCS name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, ucs->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -439,17 +440,17 @@ dxf_ucs_write
         }
         fprintf (fp->fp, "  2\n%s\n", ucs->UCS_name);
         fprintf (fp->fp, " 70\n%d\n", ucs->flag);
-        fprintf (fp->fp, " 10\n%f\n", ucs->x_origin);
-        fprintf (fp->fp, " 20\n%f\n", ucs->y_origin);
-        fprintf (fp->fp, " 30\n%f\n", ucs->z_origin);
-        fprintf (fp->fp, " 11\n%f\n", ucs->x_X_dir);
-        fprintf (fp->fp, " 21\n%f\n", ucs->y_X_dir);
-        fprintf (fp->fp, " 31\n%f\n", ucs->z_X_dir);
-        fprintf (fp->fp, " 12\n%f\n", ucs->x_Y_dir);
-        fprintf (fp->fp, " 22\n%f\n", ucs->y_Y_dir);
-        fprintf (fp->fp, " 32\n%f\n", ucs->z_Y_dir);
+        dxf_write_real (fp, 10, ucs->x_origin);
+        dxf_write_real (fp, 20, ucs->y_origin);
+        dxf_write_real (fp, 30, ucs->z_origin);
+        dxf_write_real (fp, 11, ucs->x_X_dir);
+        dxf_write_real (fp, 21, ucs->y_X_dir);
+        dxf_write_real (fp, 31, ucs->z_X_dir);
+        dxf_write_real (fp, 12, ucs->x_Y_dir);
+        dxf_write_real (fp, 22, ucs->y_Y_dir);
+        dxf_write_real (fp, 32, ucs->z_Y_dir);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -483,15 +484,15 @@ dxf_ucs_free
 #endif
         if (ucs->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfUcs was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (ucs->UCS_name);
-        free (ucs->dictionary_owner_soft);
-        free (ucs->dictionary_owner_hard);
-        free (ucs);
+        dxf_free (ucs->UCS_name);
+        dxf_free (ucs->dictionary_owner_soft);
+        dxf_free (ucs->dictionary_owner_hard);
+        dxf_free (ucs);
         ucs = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -518,18 +519,19 @@ dxf_ucs_free_chain
                  * entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (ucss == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (ucss != NULL)
         {
                 struct DxfUcs *iter = ucss->next;
+                ucss->next = NULL;
                 dxf_ucs_free (ucss);
                 ucss = (DxfUcs *) iter;
         }
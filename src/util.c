@@ -37,6 +37,8 @@
 
 #include <stdarg.h>
 #include "util.h"
+#include "raw_data.h"
+#include "fingerprint.h"
 
 
 /*!
@@ -56,9 +58,9 @@ dxf_char_new ()
         size = sizeof (DxfChar);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((c = malloc (size)) == NULL)
+        if ((c = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfChar struct.\n")),
                   __FUNCTION__);
                 c = NULL;
@@ -94,19 +96,19 @@ dxf_char_init
         /* Do some basic checks. */
         if (c == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 c = dxf_char_new ();
         }
         if (c == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfChar struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        c->value = strdup ("");
+        c->value = dxf_strdup ("");
         c->length = 0;
         c->next = NULL;
 #if DEBUG
@@ -201,28 +203,36 @@ dxf_read_init (const char *filename)
         FILE *fp;
         if (!filename)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error: filename is not initialised (NULL pointer).\n")));
                 return (NULL);
         }
         if (strcmp (filename, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error: filename contains an empty string.\n")));
                 return (NULL);
         }
         fp = fopen (filename, "r");
         if (!fp)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error: could not open file: %s for reading (NULL pointer).\n")),
                   filename);
                 return (NULL);
         }
-        file = malloc (sizeof(DxfFile));
+        file = dxf_malloc (sizeof(DxfFile));
         file->fp = fp;
-        file->filename = strdup(filename);
+        file->filename = dxf_strdup(filename);
         file->line_number = 0;
+        file->diagnostics = NULL;
+        file->keep_binary_text = FALSE;
+        file->lazy_proprietary_data = FALSE;
+        file->write_threads = 0;
+        file->raw_source = NULL;
+        file->fingerprint_entities = FALSE;
+        file->fingerprinter = NULL;
+        file->exact_reals = FALSE;
         /*! \todo FIXME: dxf header and blocks need initialized ?
         dxf_header_init (file->dxf_header);
         dxf_block_init (file->dxf_block);
@@ -243,14 +253,25 @@ dxf_read_close (DxfFile *file)
         /*! \todo FIXME: how to free other sub structures */
         if (file == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error: file is not initialised (NULL pointer).\n")));
         }
         else
         {
-                fclose (file->fp);
-                free (file->filename);
-                free (file);
+                /* A reader which failed closed the file already. */
+                if (file->fp != NULL)
+                {
+                        fclose (file->fp);
+                }
+                if (file->raw_source != NULL)
+                {
+                        /* Raw data read from the file keeps its own
+                         * reference. */
+                        dxf_raw_source_unref ((DxfRawSource *) file->raw_source);
+                }
+                dxf_file_free_fingerprinter (file);
+                dxf_free (file->filename);
+                dxf_free (file);
                 file = NULL;
         }
 #if DEBUG
@@ -276,7 +297,7 @@ dxf_read_line (char * temp_string, DxfFile *fp)
         ret = fscanf (fp->fp, "%[^\n]\n", temp_string);
         if (ferror (fp->fp))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error: while reading from: %s in line: %d.\n")),
                   fp->filename, fp->line_number);
                 return (EXIT_FAILURE);
@@ -310,7 +331,7 @@ dxf_read_scanf (DxfFile *fp, const char *template, ...)
         ret = vfscanf (fp->fp, template, lst);
         if (ferror (fp->fp))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error: while reading from: %s in line: %d.\n")),
                   fp->filename, fp->line_number);
                 return (EXIT_FAILURE);
@@ -338,4 +359,205 @@ dxf_read_scanf (DxfFile *fp, const char *template, ...)
 }
 
 
+/*!
+ * \brief Get the number of bytes a string buffer can hold.
+ *
+ * \return the usable size of the buffer when the allocator knows it,
+ * or else the length of the string including the terminating zero, or
+ * 0 for a \c NULL buffer.
+ */
+size_t
+dxf_string_capacity
+(
+        char *value
+                /*!< a pointer to the (allocated) string buffer, or
+                 * \c NULL. */
+)
+{
+        size_t capacity;
+
+        if (value == NULL)
+        {
+                return (0);
+        }
+        capacity = dxf_usable_size (value);
+        if (capacity == 0)
+        {
+                capacity = strlen (value) + 1;
+        }
+        return (capacity);
+}
+
+
+/*!
+ * \brief Copy a string into an (allocated) string buffer.
+ *
+ * The buffer is reused when the string fits, and else grown with
+ * realloc () (a \c NULL buffer is allocated).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_string_assign
+(
+        char **value,
+                /*!< a pointer to the (allocated) string buffer. */
+        const char *s
+                /*!< the string to copy. */
+)
+{
+        size_t size;
+        char *new_value;
+
+        /* Do some basic checks. */
+        if ((value == NULL) || (s == NULL))
+        {
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        size = strlen (s) + 1;
+        if (dxf_string_capacity (*value) < size)
+        {
+                new_value = (char *) dxf_realloc (*value, size);
+                if (new_value == NULL)
+                {
+                        dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                *value = new_value;
+                DXF_TRACING_ALLOCATION ();
+        }
+        memcpy (*value, s, size);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Reads the value of a string group from a file.
+ *
+ * Skips the remainder of the current (group code) line and reads the
+ * next line completely, an empty line results in an empty string and a
+ * trailing carriage return is stripped.\n
+ * The buffer pointed to by \c value is grown with realloc () when the
+ * value does not fit (a \c NULL buffer is allocated), the value is
+ * discarded when \c value is \c NULL.\n
+ * A buffer is never shrunk, so reading into the same buffer over and
+ * over again settles at zero allocations.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_read_string
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        char **value
+                /*!< a pointer to the (allocated) string buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char buffer[DXF_MAX_STRING_LENGTH];
+        char *new_value = NULL;
+        size_t length = 0;
+        int c;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Skip the remainder of the group code line. */
+        while (((c = getc (fp->fp)) != EOF) && (c != '\n'))
+        {
+        }
+        while (((c = getc (fp->fp)) != EOF) && (c != '\n'))
+        {
+                if (length < (DXF_MAX_STRING_LENGTH - 1))
+                {
+                        buffer[length++] = (char) c;
+                }
+        }
+        if (ferror (fp->fp))
+        {
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+                return (EXIT_FAILURE);
+        }
+        if ((length > 0) && (buffer[length - 1] == '\r'))
+        {
+                length--;
+        }
+        buffer[length] = '\0';
+        if (value == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (dxf_string_capacity (*value) < (length + 1))
+        {
+                new_value = (char *) dxf_realloc (*value, length + 1);
+                if (new_value == NULL)
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                *value = new_value;
+                DXF_TRACING_ALLOCATION ();
+        }
+        memcpy (*value, buffer, length + 1);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Write a group with a real value to a file.
+ *
+ * The value is written with six decimals, or with all its significant
+ * digits when \c exact_reals of \c fp is set, so the value read back
+ * equals the value written.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_write_real
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        int group_code,
+                /*!< group code of the group. */
+        double value
+                /*!< value of the group. */
+)
+{
+        int result;
+
+        if (fp->exact_reals)
+        {
+                result = fprintf (fp->fp, "%3d\n%.17g\n", group_code, value);
+        }
+        else
+        {
+                result = fprintf (fp->fp, "%3d\n%f\n", group_code, value);
+        }
+        return ((result < 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
 /* EOF */
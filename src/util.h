@@ -71,6 +71,10 @@ int dxf_read_is_int (int type);
 int dxf_read_is_string (int type);
 int dxf_read_line (char * temp_string, DxfFile *fp);
 int dxf_read_scanf (DxfFile *fp, const char *template, ...);
+int dxf_read_string (DxfFile *fp, char **value);
+size_t dxf_string_capacity (char *value);
+int dxf_string_assign (char **value, const char *s);
+int dxf_write_real (DxfFile *fp, int group_code, double value);
 DxfFile *dxf_read_init (const char *filename);
 void dxf_read_close (DxfFile *file);
 
@@ -33,6 +33,8 @@
 
 
 #include "vertex.h"
+#include "pool.h"
+#include "util.h"
 
 
 /*!
@@ -56,11 +58,9 @@ dxf_vertex_new ()
         size_t size;
 
         size = sizeof (DxfVertex);
-        /* avoid malloc of 0 bytes */
-        if (size == 0) size = 1;
-        if ((vertex = malloc (size)) == NULL)
+        if ((vertex = dxf_pool_alloc (DXF_POOL_VERTEX)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfVertex struct.\n")),
                   __FUNCTION__);
                 vertex = NULL;
@@ -68,6 +68,8 @@ dxf_vertex_new ()
         else
         {
                 memset (vertex, 0, size);
+                vertex->header.type = VERTEX;
+                DXF_TRACING_COUNT (VERTEX, DXF_TRACING_ALLOCATIONS, 1);
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -101,21 +103,21 @@ dxf_vertex_init
         /* Do some basic checks. */
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vertex = dxf_vertex_new ();
         }
         if (vertex == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfVertex struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         vertex->id_code = 0;
-        vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        vertex->layer = strdup (DXF_DEFAULT_LAYER);
+        vertex->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        vertex->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         vertex->x0 = 0.0;
         vertex->y0 = 0.0;
         vertex->z0 = 0.0;
@@ -130,8 +132,8 @@ dxf_vertex_init
         vertex->color = DXF_COLOR_BYLAYER;
         vertex->paperspace = DXF_MODELSPACE;
         vertex->flag = 0;
-        vertex->dictionary_owner_soft = strdup ("");
-        vertex->dictionary_owner_hard = strdup ("");
+        vertex->dictionary_owner_soft = dxf_strdup ("");
+        vertex->dictionary_owner_hard = dxf_strdup ("");
         vertex->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -140,6 +142,61 @@ dxf_vertex_init
 }
 
 
+/*!
+ * \brief Reset a DXF \c VERTEX entity to the values set by
+ * \c dxf_vertex_init (), reusing its allocated members.
+ *
+ * Also used by \c dxf_lwpolyline_reset () for the vertices of a
+ * \c LWPOLYLINE entity.\n
+ * The link to the next entity is kept.
+ *
+ * \return a pointer to the DXF \c VERTEX entity, or a newly allocated
+ * and initialized one when \c NULL was passed.
+ */
+DxfVertex *
+dxf_vertex_reset
+(
+        DxfVertex *vertex
+                /*!< a pointer to the DXF \c VERTEX entity, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (vertex == NULL)
+        {
+                return (dxf_vertex_init (dxf_vertex_new ()));
+        }
+        vertex->id_code = 0;
+        dxf_string_assign (&vertex->linetype, DXF_DEFAULT_LINETYPE);
+        dxf_string_assign (&vertex->layer, DXF_DEFAULT_LAYER);
+        vertex->elevation = 0.0;
+        vertex->thickness = 0.0;
+        vertex->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
+        vertex->visibility = DXF_DEFAULT_VISIBILITY;
+        vertex->color = DXF_COLOR_BYLAYER;
+        vertex->paperspace = DXF_MODELSPACE;
+        vertex->x0 = 0.0;
+        vertex->y0 = 0.0;
+        vertex->z0 = 0.0;
+        vertex->start_width = 0.0;
+        vertex->end_width = 0.0;
+        vertex->bulge = 0.0;
+        vertex->curve_fit_tangent_direction = 0.0;
+        vertex->flag = 0;
+        vertex->polyface_mesh_vertex_index_1 = 0;
+        vertex->polyface_mesh_vertex_index_2 = 0;
+        vertex->polyface_mesh_vertex_index_3 = 0;
+        vertex->polyface_mesh_vertex_index_4 = 0;
+        dxf_string_assign (&vertex->dictionary_owner_soft, "");
+        dxf_string_assign (&vertex->dictionary_owner_hard, "");
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (vertex);
+}
+
+
 /*!
  * \brief Read data from a DXF file into an \c VERTEX entity.
  *
@@ -169,38 +226,36 @@ dxf_vertex_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        off_t trace_offset;
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vertex = dxf_vertex_new ();
                 vertex = dxf_vertex_init (vertex);
         }
+        trace_offset = DXF_TRACING_ENTITY_BEGIN (VERTEX, fp);
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -215,13 +270,13 @@ dxf_vertex_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vertex->linetype);
+                        dxf_read_string (fp, &vertex->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vertex->layer);
+                        dxf_read_string (fp, &vertex->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -363,7 +418,7 @@ dxf_vertex_read
                         && (strcmp (temp_string, "AcDb2dVertex") != 0)
                         && (strcmp (temp_string, "AcDb3dPolylineVertex") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -373,14 +428,14 @@ dxf_vertex_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vertex->dictionary_owner_soft);
+                        dxf_read_string (fp, &vertex->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vertex->dictionary_owner_hard);
+                        dxf_read_string (fp, &vertex->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -391,22 +446,27 @@ dxf_vertex_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (vertex->linetype, "") == 0)
         {
-                vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                dxf_string_assign (&vertex->linetype, DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (vertex->layer, "") == 0)
         {
-                vertex->layer = strdup (DXF_DEFAULT_LAYER);
+                dxf_string_assign (&vertex->layer, DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
+        DXF_TRACING_ENTITY_END (VERTEX, fp, trace_offset);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -438,46 +498,46 @@ dxf_vertex_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VERTEX");
+        char *dxf_entity_name = dxf_strdup ("VERTEX");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (vertex->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, vertex->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("    %s entity is reset to default linetype")),
                   dxf_entity_name);
-                vertex->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                vertex->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (vertex->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, vertex->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("    %s entity is relocated to layer 0")),
                   dxf_entity_name);
-                vertex->layer = strdup (DXF_DEFAULT_LAYER);
+                vertex->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -526,7 +586,7 @@ dxf_vertex_write
           && DXF_FLATLAND
           && (vertex->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", vertex->elevation);
+                dxf_write_real (fp, 38, vertex->elevation);
         }
         if (vertex->color != DXF_COLOR_BYLAYER)
         {
@@ -534,7 +594,7 @@ dxf_vertex_write
         }
         if (vertex->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", vertex->linetype_scale);
+                dxf_write_real (fp, 48, vertex->linetype_scale);
         }
         if (vertex->visibility != 0)
         {
@@ -543,7 +603,7 @@ dxf_vertex_write
         /*! \todo Put \c thickness in the correct order. */ 
         if (vertex->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", vertex->thickness);
+                dxf_write_real (fp, 39, vertex->thickness);
         }
         fprintf (fp->fp, "100\nAcDbVertex\n");
         /*! \todo We use a \c 3dPolylineVertex for now,
@@ -551,25 +611,25 @@ dxf_vertex_write
         fprintf (fp->fp, "100\nAcDb2dVertex\n");
          */
         fprintf (fp->fp, "100\nAcDb3dPolylineVertex\n");
-        fprintf (fp->fp, " 10\n%f\n", vertex->x0);
-        fprintf (fp->fp, " 20\n%f\n", vertex->y0);
-        fprintf (fp->fp, " 30\n%f\n", vertex->z0);
+        dxf_write_real (fp, 10, vertex->x0);
+        dxf_write_real (fp, 20, vertex->y0);
+        dxf_write_real (fp, 30, vertex->z0);
         if (vertex->start_width != 0.0)
         {
-                fprintf (fp->fp, " 40\n%f\n", vertex->start_width);
+                dxf_write_real (fp, 40, vertex->start_width);
         }
         if (vertex->end_width != 0.0)
         {
-                fprintf (fp->fp, " 41\n%f\n", vertex->end_width);
+                dxf_write_real (fp, 41, vertex->end_width);
         }
         if (vertex->bulge != 0.0)
         {
-                fprintf (fp->fp, " 42\n%f\n", vertex->bulge);
+                dxf_write_real (fp, 42, vertex->bulge);
         }
         fprintf (fp->fp, " 70\n%d\n", vertex->flag);
         if (vertex->curve_fit_tangent_direction != 0.0)
         {
-                fprintf (fp->fp, " 50\n%f\n", vertex->curve_fit_tangent_direction);
+                dxf_write_real (fp, 50, vertex->curve_fit_tangent_direction);
         }
         if (vertex->polyface_mesh_vertex_index_1 != 0)
         {
@@ -588,7 +648,7 @@ dxf_vertex_write
                 fprintf (fp->fp, " 74\n%d\n", vertex->polyface_mesh_vertex_index_4);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -619,18 +679,22 @@ dxf_vertex_free
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfAllocator *allocator;
+
         if (vertex->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("ERROR in %s () pointer to next DxfVertex was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (vertex->linetype);
-        free (vertex->layer);
-        free (vertex->dictionary_owner_soft);
-        free (vertex->dictionary_owner_hard);
-        free (vertex);
+        allocator = dxf_pool_activate_owner (vertex);
+        dxf_free (vertex->linetype);
+        dxf_free (vertex->layer);
+        dxf_free (vertex->dictionary_owner_soft);
+        dxf_free (vertex->dictionary_owner_hard);
+        dxf_pool_release (DXF_POOL_VERTEX, vertex);
+        dxf_allocator_activate (allocator);
         vertex = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -656,18 +720,19 @@ dxf_vertex_free_chain
                 /*!< a pointer to the chain of DXF \c VERTEX entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (vertices == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (vertices != NULL)
         {
                 struct DxfVertex *iter = vertices->next;
+                vertices->next = NULL;
                 dxf_vertex_free (vertices);
                 vertices = (DxfVertex *) iter;
         }
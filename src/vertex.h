@@ -77,6 +77,9 @@ extern "C" {
 typedef struct
 dxf_vertex_struct
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
@@ -206,6 +209,11 @@ dxf_vertex_init
         DxfVertex *vertex
 );
 DxfVertex *
+dxf_vertex_reset
+(
+        DxfVertex *vertex
+);
+DxfVertex *
 dxf_vertex_read
 (
         DxfFile *fp,
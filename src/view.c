@@ -33,6 +33,7 @@
 
 
 #include "view.h"
+#include "util.h"
 
 
 /*!
@@ -61,9 +62,9 @@ dxf_view_new ()
         size = sizeof (DxfView);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((view = malloc (size)) == NULL)
+        if ((view = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfView struct.\n")),
                   __FUNCTION__);
                 view = NULL;
@@ -105,20 +106,20 @@ dxf_view_init
         /* Do some basic checks. */
         if (view == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 view = dxf_view_new ();
         }
         if (view == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfView struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         view->id_code = 0;
-        view->view_name = strdup ("");
+        view->view_name = dxf_strdup ("");
         view->x_view = 0.0;
         view->y_view = 0.0;
         view->x_direction = 0.0;
@@ -135,8 +136,8 @@ dxf_view_init
         view->view_twist_angle = 0.0;
         view->flag = 0;
         view->view_mode = 0;
-        view->dictionary_owner_soft = strdup ("");
-        view->dictionary_owner_hard = strdup ("");
+        view->dictionary_owner_soft = dxf_strdup ("");
+        view->dictionary_owner_hard = dxf_strdup ("");
         view->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -174,38 +175,34 @@ dxf_view_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (view == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 view = dxf_view_new ();
                 view = dxf_view_init (view);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -220,7 +217,7 @@ dxf_view_read
                         /* Now follows a string containing a view
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", view->view_name);
+                        dxf_read_string (fp, &view->view_name);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -347,7 +344,7 @@ dxf_view_read
                         if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
                         && ((strcmp (temp_string, "AcDbViewTableRecord") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -357,14 +354,14 @@ dxf_view_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", view->dictionary_owner_soft);
+                        dxf_read_string (fp, &view->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", view->dictionary_owner_hard);
+                        dxf_read_string (fp, &view->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -375,13 +372,17 @@ dxf_view_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -413,38 +414,38 @@ dxf_view_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VIEW");
+        char *dxf_entity_name = dxf_strdup ("VIEW");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (view == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((view->view_name == NULL)
           || (strcmp (view->view_name, "") == 0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty UCS name string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, view->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -483,24 +484,24 @@ dxf_view_write
                 fprintf (fp->fp, "100\nAcDbViewTableRecord\n");
         }
         fprintf (fp->fp, "  2\n%s\n", view->view_name);
-        fprintf (fp->fp, " 40\n%f\n", view->view_height);
+        dxf_write_real (fp, 40, view->view_height);
         fprintf (fp->fp, " 70\n%d\n", view->flag);
-        fprintf (fp->fp, " 10\n%f\n", view->x_view);
-        fprintf (fp->fp, " 20\n%f\n", view->y_view);
-        fprintf (fp->fp, " 41\n%f\n", view->view_width);
-        fprintf (fp->fp, " 11\n%f\n", view->x_direction);
-        fprintf (fp->fp, " 21\n%f\n", view->y_direction);
-        fprintf (fp->fp, " 31\n%f\n", view->z_direction);
-        fprintf (fp->fp, " 12\n%f\n", view->x_target);
-        fprintf (fp->fp, " 22\n%f\n", view->y_target);
-        fprintf (fp->fp, " 32\n%f\n", view->z_target);
-        fprintf (fp->fp, " 42\n%f\n", view->lens_length);
-        fprintf (fp->fp, " 43\n%f\n", view->front_plane_offset);
-        fprintf (fp->fp, " 44\n%f\n", view->back_plane_offset);
-        fprintf (fp->fp, " 50\n%f\n", view->view_twist_angle);
+        dxf_write_real (fp, 10, view->x_view);
+        dxf_write_real (fp, 20, view->y_view);
+        dxf_write_real (fp, 41, view->view_width);
+        dxf_write_real (fp, 11, view->x_direction);
+        dxf_write_real (fp, 21, view->y_direction);
+        dxf_write_real (fp, 31, view->z_direction);
+        dxf_write_real (fp, 12, view->x_target);
+        dxf_write_real (fp, 22, view->y_target);
+        dxf_write_real (fp, 32, view->z_target);
+        dxf_write_real (fp, 42, view->lens_length);
+        dxf_write_real (fp, 43, view->front_plane_offset);
+        dxf_write_real (fp, 44, view->back_plane_offset);
+        dxf_write_real (fp, 50, view->view_twist_angle);
         fprintf (fp->fp, " 71\n%d\n", view->view_mode);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -533,15 +534,15 @@ dxf_view_free
 #endif
         if (view->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfView was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (view->view_name);
-        free (view->dictionary_owner_soft);
-        free (view->dictionary_owner_hard);
-        free (view);
+        dxf_free (view->view_name);
+        dxf_free (view->dictionary_owner_soft);
+        dxf_free (view->dictionary_owner_hard);
+        dxf_free (view);
         view = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -568,18 +569,19 @@ dxf_view_free_chain
                  * entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (views == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (views != NULL)
         {
                 struct DxfView *iter = views->next;
+                views->next = NULL;
                 dxf_view_free (views);
                 views = (DxfView *) iter;
         }
@@ -33,6 +33,7 @@
 
 
 #include "viewport.h"
+#include "util.h"
 
 
 /*!
@@ -58,9 +59,9 @@ dxf_viewport_new ()
         size = sizeof (DxfViewport);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((viewport = malloc (size)) == NULL)
+        if ((viewport = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfViewport struct.\n")),
                   __FUNCTION__);
                 viewport = NULL;
@@ -68,6 +69,7 @@ dxf_viewport_new ()
         else
         {
                 memset (viewport, 0, size);
+                viewport->header.type = VIEWPORT;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -104,21 +106,21 @@ dxf_viewport_init
         /* Do some basic checks. */
         if (viewport == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 viewport = dxf_viewport_new ();
         }
         if (viewport == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfViewport struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         viewport->id_code = 0;
-        viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        viewport->layer = strdup (DXF_DEFAULT_LAYER);
+        viewport->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        viewport->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         viewport->x0 = 0.0;
         viewport->y0 = 0.0;
         viewport->z0 = 0.0;
@@ -132,9 +134,9 @@ dxf_viewport_init
         viewport->id = 1; /* Always 1. */
         viewport->color = DXF_COLOR_BYLAYER;
         viewport->paperspace = DXF_PAPERSPACE; /* Always on PAPERSPACE. */
-        viewport->app_name = strdup ("ACAD"); /* Always "ACAD". */
-        viewport->viewport_data = strdup ("MVIEW"); /* Always "MVIEW". */
-        viewport->window_descriptor_begin = strdup ("{"); /* Always "{". */
+        viewport->app_name = dxf_strdup ("ACAD"); /* Always "ACAD". */
+        viewport->viewport_data = dxf_strdup ("MVIEW"); /* Always "MVIEW". */
+        viewport->window_descriptor_begin = dxf_strdup ("{"); /* Always "{". */
         viewport->extended_entity_data_version = 16;
         viewport->x_target = 0.0;
         viewport->y_target = 0.0;
@@ -165,7 +167,7 @@ dxf_viewport_init
         viewport->x_grid_spacing = 0.0;
         viewport->y_grid_spacing = 0.0;
         viewport->plot_flag = 0;
-        viewport->frozen_layer_list_begin = strdup ("{"); /* Always "{". */
+        viewport->frozen_layer_list_begin = dxf_strdup ("{"); /* Always "{". */
         /*! \todo Implement the number of layers in a more efficient way.
          * A lot of memory is consumed by reserving for DXF_MAX_LAYERS
          * instead of the actual existing number of layers.
@@ -175,12 +177,12 @@ dxf_viewport_init
          * known during run time. */
         for (i = 0; i < DXF_MAX_LAYERS; i++)
         {
-                viewport->frozen_layers[i] = strdup ("");
+                viewport->frozen_layers[i] = dxf_strdup ("");
         }
-        viewport->frozen_layer_list_end = strdup ("}"); /* Always "}". */
-        viewport->window_descriptor_end = strdup ("}"); /* Always "}". */
-        viewport->dictionary_owner_soft = strdup ("");
-        viewport->dictionary_owner_hard = strdup ("");
+        viewport->frozen_layer_list_end = dxf_strdup ("}"); /* Always "}". */
+        viewport->window_descriptor_end = dxf_strdup ("}"); /* Always "}". */
+        viewport->dictionary_owner_soft = dxf_strdup ("");
+        viewport->dictionary_owner_hard = dxf_strdup ("");
         viewport->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -219,38 +221,34 @@ dxf_viewport_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (viewport == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 viewport = dxf_viewport_new ();
                 viewport = dxf_viewport_init (viewport);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -265,13 +263,13 @@ dxf_viewport_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->linetype);
+                        dxf_read_string (fp, &viewport->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->layer);
+                        dxf_read_string (fp, &viewport->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -373,7 +371,7 @@ dxf_viewport_read
                 {
                         /* Now follows a string containing a comment. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
+                        fscanf (fp->fp, " %[^\n]", temp_string);
                         fprintf (stdout, "DXF comment: %s\n", temp_string);
                 }
                 else if (strcmp (temp_string, "1001") == 0)
@@ -382,74 +380,74 @@ dxf_viewport_read
                         /* Now follows a string containing the appname,
                          * always "ACAD". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->app_name);
-                        if (strcmp (viewport->app_name, "ACAD") == 1)
+                        dxf_read_string (fp, &viewport->app_name);
+                        if (strcmp (viewport->app_name, "ACAD") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string followed after group code 1001.\n")));
                                 return (NULL);
                         }
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1000") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1000") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
                         /* Now follows a string containing the viewport
                          * data, always "MVIEW". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->viewport_data);
-                        if (strcmp (viewport->viewport_data, "MVIEW") == 1)
+                        dxf_read_string (fp, &viewport->viewport_data);
+                        if (strcmp (viewport->viewport_data, "MVIEW") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string.\n")));
                                 return (NULL);
                         }
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1002") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1002") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
                         /* Now follows a string containing the window
                          * begin descriptor, always "{". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->window_descriptor_begin);
-                        if (strcmp (viewport->window_descriptor_begin, "{") == 1)
+                        dxf_read_string (fp, &viewport->window_descriptor_begin);
+                        if (strcmp (viewport->window_descriptor_begin, "{") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr, "    unexpected content in string.\n");
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO, "    unexpected content in string.\n");
                                 return (NULL);
                         }
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1070") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -459,13 +457,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%d\n", &viewport->extended_entity_data_version);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1010") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1010") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -474,13 +472,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->x_target);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1020") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1020") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -489,13 +487,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->y_target);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1030") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1030") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -504,13 +502,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->z_target);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1010") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1010") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -519,13 +517,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->x_direction);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1020") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1020") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -534,13 +532,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->y_direction);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1030") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1030") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -549,13 +547,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->z_direction);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -565,13 +563,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->view_twist_angle);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -581,13 +579,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->view_height);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -597,13 +595,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->x_center);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -613,13 +611,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->y_center);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -629,13 +627,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->perspective_lens_length);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -645,13 +643,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->front_plane_offset);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -661,13 +659,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->back_plane_offset);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1070") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -676,13 +674,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%d\n", &viewport->view_mode);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1070") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -692,13 +690,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%d\n", &viewport->circle_zoom_percent);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1070") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -708,13 +706,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%d\n", &viewport->fast_zoom_setting);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1070") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -724,13 +722,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%d\n", &viewport->UCSICON_setting);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1070") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -740,13 +738,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%d\n", &viewport->snap_on);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1070") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -756,13 +754,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%d\n", &viewport->grid_on);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1070") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -772,13 +770,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%d\n", &viewport->snap_style);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1070") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -788,13 +786,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%d\n", &viewport->snap_isopair);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -804,13 +802,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->snap_rotation_angle);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -820,13 +818,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->x_snap_base);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -836,13 +834,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->y_snap_base);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -852,13 +850,13 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->x_snap_spacing);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1040") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -868,13 +866,45 @@ dxf_viewport_read
                         fscanf (fp->fp, "%lf\n", &viewport->y_snap_spacing);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1070") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
+                        {
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
+                                  (_("\tunexpected content in string sequence found.\n")));
+                                return (NULL);
+                        }
+                        /* Now follows a string containing the X grid
+                         * spacing. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &viewport->x_grid_spacing);
+                        /* Now follows a string containing a group code. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1040") != 0)
+                        {
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
+                                  (_("Error in %s () while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
+                                  (_("\tunexpected content in string sequence found.\n")));
+                                return (NULL);
+                        }
+                        /* Now follows a string containing the Y grid
+                         * spacing. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &viewport->y_grid_spacing);
+                        /* Now follows a string containing a group code. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1070") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
@@ -883,33 +913,33 @@ dxf_viewport_read
                         fscanf (fp->fp, "%d\n", &viewport->plot_flag);
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1002") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1002") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
                         /* Now follows a string containing the frozen
                          * layer list begin descriptor, always "{". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->frozen_layer_list_begin);
-                        if (strcmp (viewport->frozen_layer_list_begin, "{") == 1)
+                        dxf_read_string (fp, &viewport->frozen_layer_list_begin);
+                        if (strcmp (viewport->frozen_layer_list_begin, "{") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string.\n")));
                                 return (NULL);
                         }
                         /* Now follows a string containing a group code
                          * value of "1003". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
+                        fscanf (fp->fp, " %[^\n]", temp_string);
                         if (strcmp (temp_string, "1003") == 0)
                         {
                                 /* Start a loop reading all frozen layer
@@ -920,95 +950,99 @@ dxf_viewport_read
                                 do
                                 {
                                         (fp->line_number)++;
-                                        fscanf (fp->fp, "%s\n", viewport->frozen_layers[j]);
+                                        dxf_read_string (fp, &viewport->frozen_layers[j]);
                                         j++;
                                         /* Now follows a string containing a group code. */
                                         (fp->line_number)++;
-                                        fscanf (fp->fp, "%s\n", temp_string);
+                                        fscanf (fp->fp, " %[^\n]", temp_string);
                                 }
                                 while ((strcmp (temp_string, "1003") == 0)
-                                        || (j < DXF_MAX_LAYERS));
+                                        && (j < DXF_MAX_LAYERS));
                         }
-                        else
+                        else if (strcmp (temp_string, "1002") != 0)
                         {
-                                /* Either we found an empty list or we
-                                 * have found an exception. */
-                                fprintf (stderr,
+                                /* An empty list ends right away, anything
+                                 * else is an exception. */
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected end of frozen layer list found.\n")));
                                 return (NULL);
                         }
                         /* Now we are expecting temp_string to contain a
                          * group code value of "1002". */
-                        if (strcmp (temp_string, "1002") == 1)
+                        if (strcmp (temp_string, "1002") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
                         /* Now follows a string containing the frozen
                          * layer list end descriptor, always "}". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->frozen_layer_list_end);
-                        if (strcmp (viewport->frozen_layer_list_end, "}") == 1)
+                        dxf_read_string (fp, &viewport->frozen_layer_list_end);
+                        if (strcmp (viewport->frozen_layer_list_end, "}") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string.\n")));
                                 return (NULL);
                         }
                         /* Now follows a string containing a group code. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        if (strcmp (temp_string, "1002") == 1)
+                        fscanf (fp->fp, " %[^\n]", temp_string);
+                        if (strcmp (temp_string, "1002") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string sequence found.\n")));
                                 return (NULL);
                         }
                         /* Now follows a string containing the window
                          * end descriptor, always "}". */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", viewport->window_descriptor_end);
-                        if (strcmp (viewport->window_descriptor_end, "}") == 1)
+                        dxf_read_string (fp, &viewport->window_descriptor_end);
+                        if (strcmp (viewport->window_descriptor_end, "}") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                                   (_("Error in %s () while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                                   (_("\tunexpected content in string.\n")));
                                 return (NULL);
                         }
                 }
                 /* End of sequential ordered data fields. */
-                else 
+                else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (viewport->linetype, "") == 0)
         {
-                viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                viewport->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (viewport->layer, "") == 0)
         {
-                viewport->layer = strdup (DXF_DEFAULT_LAYER);
+                viewport->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1040,46 +1074,46 @@ dxf_viewport_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VIEWPORT");
+        char *dxf_entity_name = dxf_strdup ("VIEWPORT");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (viewport == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (viewport->linetype, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty linetype string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, viewport->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is reset to default linetype")),
                   dxf_entity_name);
-                viewport->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                viewport->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (viewport->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, viewport->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is relocated to default layer.\n")),
                   dxf_entity_name);
-                viewport->layer = strdup (DXF_DEFAULT_LAYER);
+                viewport->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -1128,7 +1162,7 @@ dxf_viewport_write
           && DXF_FLATLAND
           && (viewport->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", viewport->elevation);
+                dxf_write_real (fp, 38, viewport->elevation);
         }
         if (viewport->color != DXF_COLOR_BYLAYER)
         {
@@ -1136,7 +1170,7 @@ dxf_viewport_write
         }
         if (viewport->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", viewport->linetype_scale);
+                dxf_write_real (fp, 48, viewport->linetype_scale);
         }
         if (viewport->visibility != 0)
         {
@@ -1148,32 +1182,32 @@ dxf_viewport_write
         }
         if (viewport->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", viewport->thickness);
+                dxf_write_real (fp, 39, viewport->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", viewport->x0);
-        fprintf (fp->fp, " 20\n%f\n", viewport->y0);
-        fprintf (fp->fp, " 30\n%f\n", viewport->z0);
-        fprintf (fp->fp, " 40\n%f\n", viewport->width);
-        fprintf (fp->fp, " 41\n%f\n", viewport->height);
+        dxf_write_real (fp, 10, viewport->x0);
+        dxf_write_real (fp, 20, viewport->y0);
+        dxf_write_real (fp, 30, viewport->z0);
+        dxf_write_real (fp, 40, viewport->width);
+        dxf_write_real (fp, 41, viewport->height);
         fprintf (fp->fp, " 68\n%d\n", viewport->status);
         fprintf (fp->fp, " 69\n%d\n", viewport->id);
         fprintf (fp->fp, "1001\n%s\n", DXF_VIEWPORT_APP_NAME);
         fprintf (fp->fp, "1000\n%s\n", DXF_VIEWPORT_DATA);
         fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_WINDOW_BEGIN);
         fprintf (fp->fp, "1070\n%d\n", viewport->extended_entity_data_version);
-        fprintf (fp->fp, "1010\n%f\n", viewport->x_target);
-        fprintf (fp->fp, "1020\n%f\n", viewport->y_target);
-        fprintf (fp->fp, "1030\n%f\n", viewport->z_target);
-        fprintf (fp->fp, "1010\n%f\n", viewport->x_direction);
-        fprintf (fp->fp, "1020\n%f\n", viewport->y_direction);
-        fprintf (fp->fp, "1030\n%f\n", viewport->z_direction);
-        fprintf (fp->fp, "1040\n%f\n", viewport->view_twist_angle);
-        fprintf (fp->fp, "1040\n%f\n", viewport->view_height);
-        fprintf (fp->fp, "1040\n%f\n", viewport->x_center);
-        fprintf (fp->fp, "1040\n%f\n", viewport->y_center);
-        fprintf (fp->fp, "1040\n%f\n", viewport->perspective_lens_length);
-        fprintf (fp->fp, "1040\n%f\n", viewport->front_plane_offset);
-        fprintf (fp->fp, "1040\n%f\n", viewport->back_plane_offset);
+        dxf_write_real (fp, 1010, viewport->x_target);
+        dxf_write_real (fp, 1020, viewport->y_target);
+        dxf_write_real (fp, 1030, viewport->z_target);
+        dxf_write_real (fp, 1010, viewport->x_direction);
+        dxf_write_real (fp, 1020, viewport->y_direction);
+        dxf_write_real (fp, 1030, viewport->z_direction);
+        dxf_write_real (fp, 1040, viewport->view_twist_angle);
+        dxf_write_real (fp, 1040, viewport->view_height);
+        dxf_write_real (fp, 1040, viewport->x_center);
+        dxf_write_real (fp, 1040, viewport->y_center);
+        dxf_write_real (fp, 1040, viewport->perspective_lens_length);
+        dxf_write_real (fp, 1040, viewport->front_plane_offset);
+        dxf_write_real (fp, 1040, viewport->back_plane_offset);
         fprintf (fp->fp, "1070\n%d\n", viewport->view_mode);
         fprintf (fp->fp, "1070\n%d\n", viewport->circle_zoom_percent);
         fprintf (fp->fp, "1070\n%d\n", viewport->fast_zoom_setting);
@@ -1182,20 +1216,20 @@ dxf_viewport_write
         fprintf (fp->fp, "1070\n%d\n", viewport->grid_on);
         fprintf (fp->fp, "1070\n%d\n", viewport->snap_style);
         fprintf (fp->fp, "1070\n%d\n", viewport->snap_isopair);
-        fprintf (fp->fp, "1040\n%f\n", viewport->snap_rotation_angle);
-        fprintf (fp->fp, "1040\n%f\n", viewport->x_snap_base);
-        fprintf (fp->fp, "1040\n%f\n", viewport->y_snap_base);
-        fprintf (fp->fp, "1040\n%f\n", viewport->x_snap_spacing);
-        fprintf (fp->fp, "1040\n%f\n", viewport->y_snap_spacing);
-        fprintf (fp->fp, "1040\n%f\n", viewport->x_grid_spacing);
-        fprintf (fp->fp, "1040\n%f\n", viewport->y_grid_spacing);
+        dxf_write_real (fp, 1040, viewport->snap_rotation_angle);
+        dxf_write_real (fp, 1040, viewport->x_snap_base);
+        dxf_write_real (fp, 1040, viewport->y_snap_base);
+        dxf_write_real (fp, 1040, viewport->x_snap_spacing);
+        dxf_write_real (fp, 1040, viewport->y_snap_spacing);
+        dxf_write_real (fp, 1040, viewport->x_grid_spacing);
+        dxf_write_real (fp, 1040, viewport->y_grid_spacing);
         fprintf (fp->fp, "1070\n%d\n", viewport->plot_flag);
         fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_FROZEN_LAYER_LIST_BEGIN);
         /* Start a loop writing all frozen layer names. */
         int j = 0;
-        while ((!viewport->frozen_layers[j]) /* Do not allow NULL pointers. */
-                || (strcmp (viewport->frozen_layers[j], "") == 1) /* Do not allow empty strings. */
-                || (j < DXF_MAX_LAYERS)) /* Do not overrun the array size. */
+        while ((j < DXF_MAX_LAYERS) /* Do not overrun the array size. */
+                && (viewport->frozen_layers[j] != NULL) /* Do not allow NULL pointers. */
+                && (strcmp (viewport->frozen_layers[j], "") != 0)) /* Do not allow empty strings. */
         {
                 fprintf (fp->fp, "1003\n%s\n", viewport->frozen_layers[j]);
                 j++;
@@ -1203,7 +1237,7 @@ dxf_viewport_write
         fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_FROZEN_LAYER_LIST_END);
         fprintf (fp->fp, "1002\n%s\n", DXF_VIEWPORT_WINDOW_END);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1237,27 +1271,27 @@ dxf_viewport_free
 
         if (viewport->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfViewport was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (viewport->linetype);
-        free (viewport->layer);
-        free (viewport->app_name);
-        free (viewport->viewport_data);
-        free (viewport->window_descriptor_begin);
-        free (viewport->frozen_layer_list_begin);
+        dxf_free (viewport->linetype);
+        dxf_free (viewport->layer);
+        dxf_free (viewport->app_name);
+        dxf_free (viewport->viewport_data);
+        dxf_free (viewport->window_descriptor_begin);
+        dxf_free (viewport->frozen_layer_list_begin);
         for (i = 0; i < DXF_MAX_LAYERS; i++)
         {
                 if (strcmp (viewport->frozen_layers[i], "") != 0)
                 {
-                        free (viewport->frozen_layers[i]);
+                        dxf_free (viewport->frozen_layers[i]);
                 }
         }
-        free (viewport->frozen_layer_list_end);
-        free (viewport->window_descriptor_end);
-        free (viewport);
+        dxf_free (viewport->frozen_layer_list_end);
+        dxf_free (viewport->window_descriptor_end);
+        dxf_free (viewport);
         viewport = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -1284,18 +1318,19 @@ dxf_viewport_free_chain
                  * entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (viewports == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (viewports != NULL)
         {
                 struct DxfViewport *iter = viewports->next;
+                viewports->next = NULL;
                 dxf_viewport_free (viewports);
                 viewports = (DxfViewport *) iter;
         }
@@ -62,6 +62,9 @@ extern "C" {
 typedef struct
 dxf_viewport
 {
+        DxfEntityHeader header;
+                /*!< Type and flags of the entity, has to be the first
+                 * member. */
         /* Members common for all DXF drawable entities. */
         int id_code;
                 /*!< Identification number for the entity.\n
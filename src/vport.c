@@ -39,6 +39,7 @@
 
 
 #include "vport.h"
+#include "util.h"
 
 
 /*!
@@ -64,9 +65,9 @@ dxf_vport_new ()
         size = sizeof (DxfVPort);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((vport = malloc (size)) == NULL)
+        if ((vport = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfVPort struct.\n")),
                   __FUNCTION__);
                 vport = NULL;
@@ -108,20 +109,20 @@ dxf_vport_init
         /* Do some basic checks. */
         if (vport == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vport = dxf_vport_new ();
         }
         if (vport == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfVPort struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         vport->id_code = 0;
-        vport->viewport_name = strdup ("");
+        vport->viewport_name = dxf_strdup ("");
         vport->x_min = 0.0;
         vport->y_min = 0.0;
         vport->x_max = 0.0;
@@ -158,8 +159,8 @@ dxf_vport_init
         vport->grid_on = 0;
         vport->snap_style = 0;
         vport->snap_isopair = 0;
-        vport->dictionary_owner_soft = strdup ("");
-        vport->dictionary_owner_hard = strdup ("");
+        vport->dictionary_owner_soft = dxf_strdup ("");
+        vport->dictionary_owner_hard = dxf_strdup ("");
         vport->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -198,38 +199,34 @@ dxf_vport_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (vport == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vport = dxf_vport_new ();
                 vport = dxf_vport_init (vport);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -244,7 +241,7 @@ dxf_vport_read
                         /* Now follows a string containing a viewport
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vport->viewport_name);
+                        dxf_read_string (fp, &vport->viewport_name);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -503,14 +500,14 @@ dxf_vport_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vport->dictionary_owner_soft);
+                        dxf_read_string (fp, &vport->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", vport->dictionary_owner_hard);
+                        dxf_read_string (fp, &vport->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -519,19 +516,28 @@ dxf_vport_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         fprintf (stdout, "DXF comment: %s\n", temp_string);
                 }
-
+                else
+                {
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
+                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
+                }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if ((strcmp (vport->viewport_name, "") == 0)
           || (vport->viewport_name == NULL))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () empty string in viewport name found while reading from: %s in line: %d.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -561,38 +567,38 @@ dxf_vport_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("VPORT");
+        char *dxf_entity_name = dxf_strdup ("VPORT");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (vport == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((vport->viewport_name == NULL)
           || (strcmp (vport->viewport_name, "") == 0))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error: empty viewport name string for the %s entity with id-code: %x\n")),
                   dxf_entity_name, vport->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("\t%s entity is discarded from output.\n")),
                   dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
@@ -632,31 +638,31 @@ dxf_vport_write
         }
         fprintf (fp->fp, "  2\n%s\n", vport->viewport_name);
         fprintf (fp->fp, " 70\n%d\n", vport->standard_flag);
-        fprintf (fp->fp, " 10\n%f\n", vport->x_min);
-        fprintf (fp->fp, " 20\n%f\n", vport->y_min);
-        fprintf (fp->fp, " 11\n%f\n", vport->x_max);
-        fprintf (fp->fp, " 21\n%f\n", vport->y_max);
-        fprintf (fp->fp, " 12\n%f\n", vport->x_center);
-        fprintf (fp->fp, " 22\n%f\n", vport->y_center);
-        fprintf (fp->fp, " 13\n%f\n", vport->x_snap_base);
-        fprintf (fp->fp, " 23\n%f\n", vport->y_snap_base);
-        fprintf (fp->fp, " 14\n%f\n", vport->x_snap_spacing);
-        fprintf (fp->fp, " 24\n%f\n", vport->y_snap_spacing);
-        fprintf (fp->fp, " 15\n%f\n", vport->x_grid_spacing);
-        fprintf (fp->fp, " 25\n%f\n", vport->y_grid_spacing);
-        fprintf (fp->fp, " 16\n%f\n", vport->x_direction);
-        fprintf (fp->fp, " 26\n%f\n", vport->y_direction);
-        fprintf (fp->fp, " 36\n%f\n", vport->z_direction);
-        fprintf (fp->fp, " 17\n%f\n", vport->x_target);
-        fprintf (fp->fp, " 27\n%f\n", vport->y_target);
-        fprintf (fp->fp, " 37\n%f\n", vport->z_target);
-        fprintf (fp->fp, " 40\n%f\n", vport->view_height);
-        fprintf (fp->fp, " 41\n%f\n", vport->viewport_aspect_ratio);
-        fprintf (fp->fp, " 42\n%f\n", vport->lens_length);
-        fprintf (fp->fp, " 43\n%f\n", vport->front_plane_offset);
-        fprintf (fp->fp, " 44\n%f\n", vport->back_plane_offset);
-        fprintf (fp->fp, " 50\n%f\n", vport->snap_rotation_angle);
-        fprintf (fp->fp, " 51\n%f\n", vport->view_twist_angle);
+        dxf_write_real (fp, 10, vport->x_min);
+        dxf_write_real (fp, 20, vport->y_min);
+        dxf_write_real (fp, 11, vport->x_max);
+        dxf_write_real (fp, 21, vport->y_max);
+        dxf_write_real (fp, 12, vport->x_center);
+        dxf_write_real (fp, 22, vport->y_center);
+        dxf_write_real (fp, 13, vport->x_snap_base);
+        dxf_write_real (fp, 23, vport->y_snap_base);
+        dxf_write_real (fp, 14, vport->x_snap_spacing);
+        dxf_write_real (fp, 24, vport->y_snap_spacing);
+        dxf_write_real (fp, 15, vport->x_grid_spacing);
+        dxf_write_real (fp, 25, vport->y_grid_spacing);
+        dxf_write_real (fp, 16, vport->x_direction);
+        dxf_write_real (fp, 26, vport->y_direction);
+        dxf_write_real (fp, 36, vport->z_direction);
+        dxf_write_real (fp, 17, vport->x_target);
+        dxf_write_real (fp, 27, vport->y_target);
+        dxf_write_real (fp, 37, vport->z_target);
+        dxf_write_real (fp, 40, vport->view_height);
+        dxf_write_real (fp, 41, vport->viewport_aspect_ratio);
+        dxf_write_real (fp, 42, vport->lens_length);
+        dxf_write_real (fp, 43, vport->front_plane_offset);
+        dxf_write_real (fp, 44, vport->back_plane_offset);
+        dxf_write_real (fp, 50, vport->snap_rotation_angle);
+        dxf_write_real (fp, 51, vport->view_twist_angle);
 //        fprintf (fp->fp, " 68\n%d\n", vport->status_field);
 //        fprintf (fp->fp, " 69\n%d\n", vport->id);
         fprintf (fp->fp, " 71\n%d\n", vport->view_mode);
@@ -668,7 +674,7 @@ dxf_vport_write
         fprintf (fp->fp, " 77\n%d\n", vport->snap_style);
         fprintf (fp->fp, " 78\n%d\n", vport->snap_isopair);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -702,15 +708,15 @@ dxf_vport_free
 #endif
         if (vport->next != NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () pointer to next DxfVPort was not NULL.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (vport->viewport_name);
-        free (vport->dictionary_owner_soft);
-        free (vport->dictionary_owner_hard);
-        free (vport);
+        dxf_free (vport->viewport_name);
+        dxf_free (vport->dictionary_owner_soft);
+        dxf_free (vport->dictionary_owner_hard);
+        dxf_free (vport);
         vport = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -737,18 +743,19 @@ dxf_vport_free_chain
                  * entries. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (vports == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (vports != NULL)
         {
                 struct DxfVPort *iter = vports->next;
+                vports->next = NULL;
                 dxf_vport_free (vports);
                 vports = (DxfVPort *) iter;
         }
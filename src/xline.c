@@ -33,6 +33,7 @@
 
 
 #include "xline.h"
+#include "util.h"
 
 
 /*!
@@ -61,9 +62,9 @@ dxf_xline_new ()
         size = sizeof (DxfXLine);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((xline = malloc (size)) == NULL)
+        if ((xline = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfXLine struct.\n")),
                   __FUNCTION__);
                 xline = NULL;
@@ -71,6 +72,7 @@ dxf_xline_new ()
         else
         {
                 memset (xline, 0, size);
+                xline->header.type = XLINE;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -104,21 +106,21 @@ dxf_xline_init
         /* Do some basic checks. */
         if (xline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 xline = dxf_xline_new ();
         }
         if (xline == NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () could not allocate memory for a DxfXLine struct.\n")),
                 __FUNCTION__);
               return (NULL);
         }
         xline->id_code = 0;
-        xline->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        xline->layer = strdup (DXF_DEFAULT_LAYER);
+        xline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
+        xline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         xline->x0 = 0.0;
         xline->y0 = 0.0;
         xline->z0 = 0.0;
@@ -131,8 +133,8 @@ dxf_xline_init
         xline->visibility = DXF_DEFAULT_VISIBILITY;
         xline->color = DXF_COLOR_BYLAYER;
         xline->paperspace = DXF_MODELSPACE;
-        xline->dictionary_owner_soft = strdup ("");
-        xline->dictionary_owner_hard = strdup ("");
+        xline->dictionary_owner_soft = dxf_strdup ("");
+        xline->dictionary_owner_hard = dxf_strdup ("");
         xline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -170,38 +172,34 @@ dxf_xline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (xline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 xline = dxf_xline_new ();
                 xline = dxf_xline_init (xline);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -216,13 +214,13 @@ dxf_xline_read
                         /* Now follows a string containing a linetype
                          * name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", xline->linetype);
+                        dxf_read_string (fp, &xline->linetype);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", xline->layer);
+                        dxf_read_string (fp, &xline->layer);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -319,7 +317,7 @@ dxf_xline_read
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbXline") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -329,14 +327,14 @@ dxf_xline_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", xline->dictionary_owner_soft);
+                        dxf_read_string (fp, &xline->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", xline->dictionary_owner_hard);
+                        dxf_read_string (fp, &xline->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -347,22 +345,26 @@ dxf_xline_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (xline->linetype, "") == 0)
         {
-                xline->linetype = strdup (DXF_DEFAULT_LINETYPE);
+                xline->linetype = dxf_strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (xline->layer, "") == 0)
         {
-                xline->layer = strdup (DXF_DEFAULT_LAYER);
+                xline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -394,48 +396,48 @@ dxf_xline_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("XLINE");
+        char *dxf_entity_name = dxf_strdup ("XLINE");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (xline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if ((xline->x0 == xline->x1)
                 && (xline->y0 == xline->y1)
                 && (xline->z0 == xline->z1))
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () start point and end point are identical for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, xline->id_code);
                 dxf_entity_skip (dxf_entity_name);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (strcmp (xline->layer, "") == 0)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () empty layer string for the %s entity with id-code: %x\n")),
                   __FUNCTION__, dxf_entity_name, xline->id_code);
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_INFO,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
-                xline->layer = strdup (DXF_DEFAULT_LAYER);
+                xline->layer = dxf_strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
@@ -484,7 +486,7 @@ dxf_xline_write
           && DXF_FLATLAND
           && (xline->elevation != 0.0))
         {
-                fprintf (fp->fp, " 38\n%f\n", xline->elevation);
+                dxf_write_real (fp, 38, xline->elevation);
         }
         if (xline->color != DXF_COLOR_BYLAYER)
         {
@@ -492,7 +494,7 @@ dxf_xline_write
         }
         if (xline->linetype_scale != 1.0)
         {
-                fprintf (fp->fp, " 48\n%f\n", xline->linetype_scale);
+                dxf_write_real (fp, 48, xline->linetype_scale);
         }
         if (xline->visibility != 0)
         {
@@ -504,16 +506,16 @@ dxf_xline_write
         }
         if (xline->thickness != 0.0)
         {
-                fprintf (fp->fp, " 39\n%f\n", xline->thickness);
+                dxf_write_real (fp, 39, xline->thickness);
         }
-        fprintf (fp->fp, " 10\n%f\n", xline->x0);
-        fprintf (fp->fp, " 20\n%f\n", xline->y0);
-        fprintf (fp->fp, " 30\n%f\n", xline->z0);
-        fprintf (fp->fp, " 11\n%f\n", xline->x1);
-        fprintf (fp->fp, " 21\n%f\n", xline->y1);
-        fprintf (fp->fp, " 31\n%f\n", xline->z1);
+        dxf_write_real (fp, 10, xline->x0);
+        dxf_write_real (fp, 20, xline->y0);
+        dxf_write_real (fp, 30, xline->z0);
+        dxf_write_real (fp, 11, xline->x1);
+        dxf_write_real (fp, 21, xline->y1);
+        dxf_write_real (fp, 31, xline->z1);
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -547,16 +549,16 @@ dxf_xline_free
 #endif
         if (xline->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfXLine was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (xline->linetype);
-        free (xline->layer);
-        free (xline->dictionary_owner_soft);
-        free (xline->dictionary_owner_hard);
-        free (xline);
+        dxf_free (xline->linetype);
+        dxf_free (xline->layer);
+        dxf_free (xline->dictionary_owner_soft);
+        dxf_free (xline->dictionary_owner_hard);
+        dxf_free (xline);
         xline = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -582,18 +584,19 @@ dxf_xline_free_chain
                 /*!< a pointer to the chain of DXF \c XLINE entities. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (xlines == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (xlines != NULL)
         {
                 struct DxfXLine *iter = xlines->next;
+                xlines->next = NULL;
                 dxf_xline_free (xlines);
                 xlines = (DxfXLine *) iter;
         }
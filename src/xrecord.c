@@ -35,6 +35,7 @@
 
 
 #include "xrecord.h"
+#include "util.h"
 
 
 /*!
@@ -60,9 +61,9 @@ dxf_xrecord_new ()
         size = sizeof (DxfXrecord);
         /* avoid malloc of 0 bytes */
         if (size == 0) size = 1;
-        if ((xrecord = malloc (size)) == NULL)
+        if ((xrecord = dxf_malloc (size)) == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfXrecord struct.\n")),
                   __FUNCTION__);
                 xrecord = NULL;
@@ -104,21 +105,21 @@ dxf_xrecord_init
         /* Do some basic checks. */
         if (xrecord == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 xrecord = dxf_xrecord_new ();
         }
         if (xrecord == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () could not allocate memory for a DxfXrecord struct.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
         xrecord->id_code = 0;
-        xrecord->dictionary_owner_soft = strdup ("");
-        xrecord->dictionary_owner_hard = strdup ("");
+        xrecord->dictionary_owner_soft = dxf_strdup ("");
+        xrecord->dictionary_owner_hard = dxf_strdup ("");
         xrecord->I8 = 0;
         xrecord->I16 = 0;
         xrecord->I32 = 0;
@@ -161,43 +162,40 @@ dxf_xrecord_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (xrecord == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 xrecord = dxf_xrecord_new ();
                 xrecord = dxf_xrecord_init (xrecord);
         }
         (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        fscanf (fp->fp, " %[^\n]", temp_string);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -217,7 +215,7 @@ dxf_xrecord_read
                         fscanf (fp->fp, "%s\n", temp_string);
                         if (strcmp (temp_string, "AcDbXrecord") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -227,14 +225,14 @@ dxf_xrecord_read
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", xrecord->dictionary_owner_soft);
+                        dxf_read_string (fp, &xrecord->dictionary_owner_soft);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", xrecord->dictionary_owner_hard);
+                        dxf_read_string (fp, &xrecord->dictionary_owner_hard);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
@@ -254,7 +252,7 @@ dxf_xrecord_read
                         xrecord->group_code = scanf (temp_string, "%d");
                         /* Now follows a string value. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", xrecord->S);
+                        dxf_read_string (fp, &xrecord->S);
                 }
                 else if
                   (
@@ -309,13 +307,17 @@ dxf_xrecord_read
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the unknown group code. */
+                        (fp->line_number)++;
+                        dxf_read_string (fp, NULL);
                 }
+                /* Read the next group code. */
+                (fp->line_number)++;
+                fscanf (fp->fp, " %[^\n]", temp_string);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -347,30 +349,30 @@ dxf_xrecord_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("XRECORD");
+        char *dxf_entity_name = dxf_strdup ("XRECORD");
 
         /* Do some basic checks. */
         if (fp == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (xrecord == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_ERROR,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 /* Clean up. */
-                free (dxf_entity_name);
+                dxf_free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () illegal DXF version for this %s entity with id-code: %x.\n")),
                   __FUNCTION__, dxf_entity_name, xrecord->id_code);
         }
@@ -457,12 +459,12 @@ dxf_xrecord_write
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic (fp, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () unknown group code %d found in DxfXrecord struct with id-code: %x.\n")),
                   __FUNCTION__, xrecord->group_code, xrecord->id_code);
         }
         /* Clean up. */
-        free (dxf_entity_name);
+        dxf_free (dxf_entity_name);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -497,14 +499,14 @@ dxf_xrecord_free
         /* Do some basic checks. */
         if (xrecord->next != NULL)
         {
-              fprintf (stderr,
+              dxf_diagnostic (NULL, DXF_DIAGNOSTIC_ERROR,
                 (_("Error in %s () pointer to next DxfXrecord was not NULL.\n")),
                 __FUNCTION__);
               return (EXIT_FAILURE);
         }
-        free (xrecord->dictionary_owner_soft);
-        free (xrecord->dictionary_owner_hard);
-        free (xrecord);
+        dxf_free (xrecord->dictionary_owner_soft);
+        dxf_free (xrecord->dictionary_owner_hard);
+        dxf_free (xrecord);
         xrecord = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -530,18 +532,19 @@ dxf_xrecord_free_chain
                 /*!< a pointer to the chain of DXF \c XRECORD objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         if (xrecords == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic (NULL, DXF_DIAGNOSTIC_WARNING,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
         }
         while (xrecords != NULL)
         {
                 struct DxfXrecord *iter = xrecords->next;
+                xrecords->next = NULL;
                 dxf_xrecord_free (xrecords);
                 xrecords = (DxfXrecord *) iter;
         }
@@ -0,0 +1,812 @@
+/*!
+ * \file bench.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Reader and writer benchmarks for libDXF.
+ *
+ * A synthetic DXF file is generated (\c write phase), read back
+ * (\c read phase), read and written again (\c round_trip phase), and
+ * loaded into a drawing which is written as a whole by
+ * \c dxf_file_save () on a single thread (\c export phase) and on all
+ * online processors (\c export_parallel phase).\n
+ * A changed revision of the drawing is compared with the original and
+ * the differences are written as a patch (\c diff phase).\n
+ * The fingerprints of the entities are computed and rolled up per layer
+ * and per drawing (\c fingerprint phase).\n
+ * The round trip has to write the generated file again, the exports,
+ * patches and fingerprints are checked by the unit tests
+ * (\c test_export).\n
+ * The files are read with the readers of the library
+ * (\c dxf_file_read_entity () and \c dxf_file_load ()).\n
+ * For every phase the throughput in MB/s and entities/s, the peak
+ * resident set size and the number of allocations through the libDXF
+ * allocator are reported as a single line of JSON on \c stdout, so the
+ * output of several runs can be collected and compared between
+ * commits.\n
+ * \n
+ * Usage: <tt>bench [--version R12|R13|R14|R2000|R2004|R2007|R2010]
+ * [--entities N] [--size BYTES[K|M|G]] [--seed N] [--directory DIR]
+ * [--keep] [--trace FILE] [--diagnostics stderr|silent|collect]
+ * [--no-allocation-counting]</tt>\n
+ * \n
+ * Allocations are counted by a libDXF allocator, libDXF only spreads
+ * work over threads with the C library allocator, so the
+ * \c export_parallel phase runs on one thread unless
+ * \c --no-allocation-counting is given.\n
+ * \n
+ * With \c --diagnostics \c silent the libDXF diagnostics are only
+ * counted, with \c collect they are aggregated and summarized on
+ * \c stderr, the default prints every diagnostic to \c stderr.\n
+ * \n
+ * With \c --trace all libDXF instrumentation is enabled, a summary of
+ * the phase timers and entity counters is written to \c stderr and the
+ * events are dumped to \c FILE in the Chrome trace event format.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "bench.h"
+
+
+/*!
+ * \brief Read the entities of a (synthetic) DXF file.
+ *
+ * Every entity in the \c ENTITIES section is read by the library reader
+ * of its type (see \c dxf_file_read_entity ()).\n
+ * When \c out is not \c NULL every entity is written to \c out directly
+ * after it is read, every entity is freed after it is counted.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+bench_read
+(
+        const char *filename,
+                /*!< name of the file to read. */
+        int acad_version_number,
+                /*!< AutoCAD version number of the file. */
+        DxfFile *out,
+                /*!< output file for the round trip, or \c NULL. */
+        BenchCounters *counters
+                /*!< counters to update. */
+)
+{
+        DxfFile *fp = NULL;
+        BenchEntityType type;
+        char code[DXF_MAX_STRING_LENGTH];
+        char name[DXF_MAX_STRING_LENGTH];
+        void *entity;
+        int in_entities = FALSE;
+        int have_name = FALSE;
+        int result = EXIT_SUCCESS;
+
+        fp = dxf_read_init (filename);
+        if (fp == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fp->acad_version_number = acad_version_number;
+        DXF_TRACING_PHASE_BEGIN (DXF_TRACING_PHASE_FILE);
+        while (result == EXIT_SUCCESS)
+        {
+                /* An entity reader read the group code of the next
+                 * entity, only its name follows. */
+                if (!have_name)
+                {
+                        fp->line_number++;
+                        if (fscanf (fp->fp, " %[^\n]", code) != 1)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () unexpected end of file: %s in line: %d.\n")),
+                                  __FUNCTION__, filename, fp->line_number);
+                                result = EXIT_FAILURE;
+                                break;
+                        }
+                        if (strcmp (code, "0") != 0)
+                        {
+                                /* Skip groups outside of entities. */
+                                fp->line_number++;
+                                dxf_read_string (fp, NULL);
+                                continue;
+                        }
+                }
+                have_name = FALSE;
+                fp->line_number++;
+                if (fscanf (fp->fp, " %[^\n]%*[\n]", name) != 1)
+                {
+                        result = EXIT_FAILURE;
+                        break;
+                }
+                if (strcmp (name, "EOF") == 0)
+                {
+                        break;
+                }
+                if (strcmp (name, "SECTION") == 0)
+                {
+                        /* The name of the section follows. */
+                        fp->line_number += 2;
+                        in_entities = ((fscanf (fp->fp, " %[^\n]", code) == 1)
+                          && (fscanf (fp->fp, " %[^\n]%*[\n]", name) == 1)
+                          && (strcmp (name, "ENTITIES") == 0));
+                        continue;
+                }
+                if (strcmp (name, "ENDSEC") == 0)
+                {
+                        in_entities = FALSE;
+                        continue;
+                }
+                if (!in_entities)
+                {
+                        continue;
+                }
+                entity = dxf_file_read_entity (fp, name);
+                if (entity == NULL)
+                {
+                        result = EXIT_FAILURE;
+                        break;
+                }
+                have_name = TRUE;
+                if ((out != NULL)
+                  && (dxf_entity_write (out, entity) != EXIT_SUCCESS))
+                {
+                        result = EXIT_FAILURE;
+                }
+                type = bench_entity_type (entity);
+                if (type < BENCH_NUMBER_OF_TYPES)
+                {
+                        counters->entities[type]++;
+                }
+                dxf_entity_free (entity);
+        }
+        if (fp->fp != NULL)
+        {
+                counters->bytes += (uint64_t) ftello (fp->fp);
+        }
+        DXF_TRACING_PHASE_END (DXF_TRACING_PHASE_FILE);
+        /* Clean up. */
+        dxf_read_close (fp);
+        return (result);
+}
+
+
+/*!
+ * \brief Load a (synthetic) DXF file into a new drawing with
+ * \c dxf_file_load ().
+ *
+ * \return the drawing, or \c NULL when an error occurred.
+ */
+static DxfDrawing *
+bench_load
+(
+        const char *filename,
+                /*!< name of the file to read. */
+        int acad_version_number,
+                /*!< AutoCAD version number of the file. */
+        BenchCounters *counters
+                /*!< counters to update. */
+)
+{
+        DxfDrawing *drawing;
+        DxfEntities *entities;
+        BenchEntityType type;
+        struct stat status;
+        size_t i;
+
+        drawing = dxf_drawing_init (dxf_drawing_new (), acad_version_number);
+        if (drawing == NULL)
+        {
+                return (NULL);
+        }
+        if (dxf_file_load (filename, drawing) != EXIT_SUCCESS)
+        {
+                dxf_drawing_free (drawing);
+                return (NULL);
+        }
+        entities = dxf_drawing_get_entities_list (drawing);
+        for (i = 0; i < dxf_entities_get_number_of_entities (entities); i++)
+        {
+                type = bench_entity_type (dxf_entities_get_entity (entities, i));
+                if (type < BENCH_NUMBER_OF_TYPES)
+                {
+                        counters->entities[type]++;
+                }
+        }
+        if (stat (filename, &status) == 0)
+        {
+                counters->bytes += (uint64_t) status.st_size;
+        }
+        return (drawing);
+}
+
+
+/*!
+ * \brief Write a whole drawing with \c dxf_file_save ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+bench_save
+(
+        DxfDrawing *drawing,
+                /*!< the drawing to write. */
+        const char *filename,
+                /*!< name of the file to write. */
+        int acad_version_number,
+                /*!< AutoCAD version number of the file. */
+        int number_of_threads,
+                /*!< number of threads formatting the entities. */
+        BenchCounters *counters
+                /*!< counters to update. */
+)
+{
+        struct stat status;
+
+        if (dxf_file_save (filename, drawing, acad_version_number, number_of_threads) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "Could not export the drawing to: %s.\n",
+                  filename);
+                return (EXIT_FAILURE);
+        }
+        if (stat (filename, &status) == 0)
+        {
+                counters->bytes += (uint64_t) status.st_size;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compare the contents of two files.
+ *
+ * \return \c TRUE when the files are identical, \c FALSE otherwise.
+ */
+static int
+bench_compare_files
+(
+        const char *filename_1,
+        const char *filename_2
+)
+{
+        FILE *fp_1;
+        FILE *fp_2;
+        char buffer_1[65536];
+        char buffer_2[65536];
+        size_t n_1;
+        size_t n_2;
+        int identical = TRUE;
+
+        fp_1 = fopen (filename_1, "r");
+        fp_2 = fopen (filename_2, "r");
+        if ((fp_1 == NULL) || (fp_2 == NULL))
+        {
+                identical = FALSE;
+        }
+        while (identical)
+        {
+                n_1 = fread (buffer_1, 1, sizeof (buffer_1), fp_1);
+                n_2 = fread (buffer_2, 1, sizeof (buffer_2), fp_2);
+                if ((n_1 != n_2) || (memcmp (buffer_1, buffer_2, n_1) != 0))
+                {
+                        identical = FALSE;
+                }
+                if (n_1 == 0)
+                {
+                        break;
+                }
+        }
+        if (fp_1 != NULL)
+        {
+                fclose (fp_1);
+        }
+        if (fp_2 != NULL)
+        {
+                fclose (fp_2);
+        }
+        return (identical);
+}
+
+
+/*!
+ * \brief Change a drawing into a new revision, every 97th entity is
+ * moved, every 101st entity is erased and a copy of every 211th entity
+ * is added.
+ */
+static void
+bench_change
+(
+        DxfDrawing *drawing
+                /*!< the drawing to change. */
+)
+{
+        DxfEntities *entities;
+        DxfMatrix matrix;
+        void *entity;
+        void *copy;
+        size_t number_of_entities;
+        size_t i;
+        int id_code = 0;
+
+        entities = dxf_drawing_get_entities_list (drawing);
+        number_of_entities = dxf_entities_get_number_of_entities (entities);
+        for (i = 0; i < number_of_entities; i++)
+        {
+                entity = dxf_entities_get_entity (entities, i);
+                if (dxf_entity_get_id_code (entity) > id_code)
+                {
+                        id_code = dxf_entity_get_id_code (entity);
+                }
+        }
+        dxf_matrix_init (&matrix);
+        matrix.m[0][3] = 10.5;
+        matrix.m[1][3] = -2.25;
+        for (i = 0; i < number_of_entities; i++)
+        {
+                entity = dxf_entities_get_entity (entities, i);
+                if ((i % 97) == 0)
+                {
+                        dxf_entity_transform (entity, &matrix);
+                }
+                if ((i % 101) == 5)
+                {
+                        dxf_entity_set_flags (entity,
+                          dxf_entity_get_flags (entity) | DXF_ENTITY_FLAG_ERASED);
+                }
+                if (((i % 211) == 7)
+                  && ((copy = dxf_entity_clone (entity)) != NULL))
+                {
+                        dxf_entity_set_id_code (copy, ++id_code);
+                        dxf_entity_set_flags (copy, 0);
+                        dxf_entities_append (entities, copy);
+                }
+        }
+}
+
+
+/*!
+ * \brief Start the measurement of a benchmark phase.
+ */
+static void
+bench_start
+(
+        BenchResult *result,
+                /*!< result of the phase. */
+        const char *name,
+                /*!< name of the phase. */
+        BenchCounters *counters
+                /*!< counters of the phase. */
+)
+{
+        memset (result, 0, sizeof (BenchResult));
+        memset (counters, 0, sizeof (BenchCounters));
+        result->name = name;
+        bench_reset_peak_rss ();
+        bench_get_alloc_counters (&result->allocations, &result->allocated_bytes);
+        result->seconds = bench_time ();
+}
+
+
+/*!
+ * \brief Stop the measurement of a benchmark phase.
+ */
+static void
+bench_stop
+(
+        BenchResult *result,
+                /*!< result of the phase. */
+        BenchCounters *counters
+                /*!< counters of the phase. */
+)
+{
+        uint64_t allocations;
+        uint64_t allocated_bytes;
+        int i;
+
+        result->seconds = bench_time () - result->seconds;
+        bench_get_alloc_counters (&allocations, &allocated_bytes);
+        result->allocations = allocations - result->allocations;
+        result->allocated_bytes = allocated_bytes - result->allocated_bytes;
+        result->peak_rss = bench_get_peak_rss ();
+        result->bytes = counters->bytes;
+        for (i = 0; i < BENCH_NUMBER_OF_TYPES; i++)
+        {
+                result->entities += counters->entities[i];
+        }
+}
+
+
+/*!
+ * \brief Print the result of a benchmark phase as a JSON object.
+ */
+static void
+bench_print_result
+(
+        BenchResult *result
+                /*!< result of the phase. */
+)
+{
+        double seconds = (result->seconds > 0.0) ? result->seconds : 1e-9;
+
+        fprintf (stdout,
+          "{\"phase\":\"%s\",\"seconds\":%.6f,\"bytes\":%llu,"
+          "\"entities\":%llu,\"mb_per_s\":%.3f,\"entities_per_s\":%.1f,"
+          "\"peak_rss_kb\":%ld,",
+          result->name,
+          result->seconds,
+          (unsigned long long) result->bytes,
+          (unsigned long long) result->entities,
+          (double) result->bytes / (1024.0 * 1024.0) / seconds,
+          (double) result->entities / seconds,
+          result->peak_rss);
+        if (bench_alloc_counting ())
+        {
+                fprintf (stdout,
+                  "\"allocations\":%llu,\"allocated_bytes\":%llu}",
+                  (unsigned long long) result->allocations,
+                  (unsigned long long) result->allocated_bytes);
+        }
+        else
+        {
+                fprintf (stdout, "\"allocations\":null,\"allocated_bytes\":null}");
+        }
+}
+
+
+/*!
+ * \brief Parse a size with an optional K, M or G suffix.
+ *
+ * \return the size in bytes, or 0 for an invalid size.
+ */
+static uint64_t
+bench_parse_size
+(
+        const char *string
+                /*!< size as given on the command line. */
+)
+{
+        char *end = NULL;
+        uint64_t size;
+
+        size = strtoull (string, &end, 10);
+        switch (*end)
+        {
+                case 'G':
+                case 'g':
+                        size *= 1024;
+                        /* Fall through. */
+                case 'M':
+                case 'm':
+                        size *= 1024;
+                        /* Fall through. */
+                case 'K':
+                case 'k':
+                        size *= 1024;
+                        end++;
+                        break;
+                default:
+                        break;
+        }
+        return ((*end == '\0') ? size : 0);
+}
+
+
+static void
+bench_usage (const char *program)
+{
+        fprintf (stderr,
+          "Usage: %s [--version R12|R13|R14|R2000|R2004|R2007|R2010]\n"
+          "          [--entities N] [--size BYTES[K|M|G]] [--seed N]\n"
+          "          [--directory DIR] [--keep] [--trace FILE]\n"
+          "          [--diagnostics stderr|silent|collect]\n"
+          "          [--no-allocation-counting]\n",
+          program);
+}
+
+
+int
+main (int argc, char **argv)
+{
+        const char *version_name = "R2000";
+        const char *directory = ".";
+        const char *trace_filename = NULL;
+        const char *diagnostics_mode = NULL;
+        DxfDiagnostics *diagnostics = NULL;
+        uint64_t entities_per_type = 10000;
+        uint64_t target_size = 0;
+        uint32_t seed = 20170101;
+        int keep = FALSE;
+        int count_allocations = TRUE;
+        int acad_version_number;
+        char filename[1024];
+        char round_trip_filename[1024];
+        char export_filename[1024];
+        char parallel_filename[1024];
+        char patch_filename[1024];
+        BenchCounters counters;
+        BenchCounters load_counters;
+        BenchResult results[7];
+        DxfDrawing *drawing;
+        DxfDrawing *revision;
+        DxfDiff *diff;
+        DxfFingerprints *fingerprints;
+        FILE *patch;
+        DxfFile out;
+        int identical;
+        uint64_t rounds;
+        int i;
+
+        for (i = 1; i < argc; i++)
+        {
+                if ((strcmp (argv[i], "--version") == 0) && (i + 1 < argc))
+                {
+                        version_name = argv[++i];
+                }
+                else if ((strcmp (argv[i], "--entities") == 0) && (i + 1 < argc))
+                {
+                        entities_per_type = strtoull (argv[++i], NULL, 10);
+                }
+                else if ((strcmp (argv[i], "--size") == 0) && (i + 1 < argc))
+                {
+                        target_size = bench_parse_size (argv[++i]);
+                        if (target_size == 0)
+                        {
+                                bench_usage (argv[0]);
+                                return (EXIT_FAILURE);
+                        }
+                }
+                else if ((strcmp (argv[i], "--seed") == 0) && (i + 1 < argc))
+                {
+                        seed = (uint32_t) strtoul (argv[++i], NULL, 10);
+                }
+                else if ((strcmp (argv[i], "--directory") == 0) && (i + 1 < argc))
+                {
+                        directory = argv[++i];
+                }
+                else if (strcmp (argv[i], "--keep") == 0)
+                {
+                        keep = TRUE;
+                }
+                else if ((strcmp (argv[i], "--trace") == 0) && (i + 1 < argc))
+                {
+                        trace_filename = argv[++i];
+                }
+                else if ((strcmp (argv[i], "--diagnostics") == 0) && (i + 1 < argc))
+                {
+                        diagnostics_mode = argv[++i];
+                        if ((strcmp (diagnostics_mode, "silent") != 0)
+                          && (strcmp (diagnostics_mode, "collect") != 0)
+                          && (strcmp (diagnostics_mode, "stderr") != 0))
+                        {
+                                bench_usage (argv[0]);
+                                return (EXIT_FAILURE);
+                        }
+                }
+                else if (strcmp (argv[i], "--no-allocation-counting") == 0)
+                {
+                        count_allocations = FALSE;
+                }
+                else
+                {
+                        bench_usage (argv[0]);
+                        return (EXIT_FAILURE);
+                }
+        }
+        /* Count from the first allocation of libDXF on. */
+        if ((count_allocations)
+          && (bench_count_allocations () != EXIT_SUCCESS))
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((diagnostics_mode != NULL)
+          && (strcmp (diagnostics_mode, "stderr") != 0))
+        {
+                diagnostics = dxf_diagnostics_init (dxf_diagnostics_new ());
+                if (strcmp (diagnostics_mode, "silent") == 0)
+                {
+                        dxf_diagnostics_set_mode (diagnostics, DXF_DIAGNOSTICS_SILENT);
+                }
+                dxf_diagnostics_set_default (diagnostics);
+        }
+        acad_version_number = bench_version_from_name (version_name);
+        if (acad_version_number < 0)
+        {
+                fprintf (stderr, "Unsupported version: %s\n", version_name);
+                bench_usage (argv[0]);
+                return (EXIT_FAILURE);
+        }
+        if (trace_filename != NULL)
+        {
+                dxf_tracing_enable (DXF_TRACING_ALL, 0);
+        }
+        snprintf (filename, sizeof (filename), "%s/bench_%s.dxf",
+          directory, version_name);
+        snprintf (round_trip_filename, sizeof (round_trip_filename),
+          "%s/bench_%s_round_trip.dxf", directory, version_name);
+        snprintf (export_filename, sizeof (export_filename),
+          "%s/bench_%s_export.dxf", directory, version_name);
+        snprintf (parallel_filename, sizeof (parallel_filename),
+          "%s/bench_%s_parallel.dxf", directory, version_name);
+        snprintf (patch_filename, sizeof (patch_filename),
+          "%s/bench_%s.patch", directory, version_name);
+        /* Write phase: generate the synthetic file. */
+        bench_start (&results[0], "write", &counters);
+        if (bench_generate (filename, acad_version_number, entities_per_type,
+          target_size, seed, &counters) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        bench_stop (&results[0], &counters);
+        rounds = counters.entities[BENCH_POINT];
+        /* Read phase. */
+        bench_start (&results[1], "read", &counters);
+        if (bench_read (filename, acad_version_number, NULL, &counters) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        bench_stop (&results[1], &counters);
+        /* Round trip phase: read and write every entity again. */
+        bench_start (&results[2], "round_trip", &counters);
+        memset (&out, 0, sizeof (DxfFile));
+        out.filename = round_trip_filename;
+        out.acad_version_number = acad_version_number;
+        out.fp = fopen (round_trip_filename, "w");
+        if (out.fp == NULL)
+        {
+                fprintf (stderr, "Could not open file: %s for writing.\n",
+                  round_trip_filename);
+                return (EXIT_FAILURE);
+        }
+        bench_write_preamble (&out);
+        if (bench_read (filename, acad_version_number, &out, &counters) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        bench_write_postamble (&out);
+        counters.bytes += (uint64_t) ftello (out.fp);
+        fclose (out.fp);
+        bench_stop (&results[2], &counters);
+        identical = bench_compare_files (filename, round_trip_filename);
+        /* Export phase: write a whole drawing, loading it is not
+         * measured. */
+        memset (&load_counters, 0, sizeof (BenchCounters));
+        drawing = bench_load (filename, acad_version_number, &load_counters);
+        if (drawing == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        bench_start (&results[3], "export", &counters);
+        if (bench_save (drawing, export_filename, acad_version_number, 1, &counters) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        memcpy (counters.entities, load_counters.entities, sizeof (counters.entities));
+        bench_stop (&results[3], &counters);
+        bench_start (&results[4], "export_parallel", &counters);
+        if (bench_save (drawing, parallel_filename, acad_version_number, 0, &counters) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        memcpy (counters.entities, load_counters.entities, sizeof (counters.entities));
+        bench_stop (&results[4], &counters);
+        dxf_drawing_free (drawing);
+        /* Diff phase: compare the drawing with a changed revision and
+         * write the patch, loading them is not measured. */
+        memset (&load_counters, 0, sizeof (BenchCounters));
+        drawing = bench_load (filename, acad_version_number, &load_counters);
+        revision = bench_load (filename, acad_version_number, &load_counters);
+        if ((drawing == NULL) || (revision == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        bench_change (revision);
+        bench_start (&results[5], "diff", &counters);
+        diff = dxf_diff_drawings (drawing, revision, acad_version_number, 0);
+        patch = fopen (patch_filename, "w");
+        if ((diff == NULL)
+          || (patch == NULL)
+          || (dxf_diff_write (patch, diff) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "Could not write the patch to: %s.\n",
+                  patch_filename);
+                return (EXIT_FAILURE);
+        }
+        counters.bytes += (uint64_t) ftello (patch);
+        fclose (patch);
+        memcpy (counters.entities, load_counters.entities, sizeof (counters.entities));
+        bench_stop (&results[5], &counters);
+        dxf_diff_free (diff);
+        dxf_drawing_free (drawing);
+        dxf_drawing_free (revision);
+        /* Fingerprint phase: the entities read from the generated
+         * file, loading them is not measured. */
+        memset (&load_counters, 0, sizeof (BenchCounters));
+        drawing = bench_load (filename, acad_version_number, &load_counters);
+        if (drawing == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        bench_start (&results[6], "fingerprint", &counters);
+        fingerprints = dxf_fingerprints_drawing (drawing, 0);
+        memcpy (counters.entities, load_counters.entities, sizeof (counters.entities));
+        bench_stop (&results[6], &counters);
+        if (fingerprints == NULL)
+        {
+                fprintf (stderr, "Could not compute the fingerprints.\n");
+                return (EXIT_FAILURE);
+        }
+        dxf_fingerprints_free (fingerprints);
+        dxf_drawing_free (drawing);
+        /* Report. */
+        fprintf (stdout,
+          "{\"benchmark\":\"libdxf\",\"version\":\"%s\","
+          "\"acad_version_number\":%d,\"seed\":%u,\"file_size\":%llu,"
+          "\"entities_per_type\":%llu,\"results\":[",
+          version_name,
+          acad_version_number,
+          seed,
+          (unsigned long long) results[0].bytes,
+          (unsigned long long) rounds);
+        for (i = 0; i < 7; i++)
+        {
+                if (i > 0)
+                {
+                        fprintf (stdout, ",");
+                }
+                bench_print_result (&results[i]);
+        }
+        fprintf (stdout, "],\"round_trip_identical\":%s}\n",
+          identical ? "true" : "false");
+        if (diagnostics != NULL)
+        {
+                dxf_diagnostics_write_summary (diagnostics, stderr);
+                dxf_diagnostics_free (diagnostics);
+        }
+        if (trace_filename != NULL)
+        {
+                dxf_tracing_disable ();
+                dxf_tracing_write_summary (stderr);
+                dxf_tracing_write_chrome_json (trace_filename);
+        }
+        if (!keep)
+        {
+                remove (filename);
+                remove (round_trip_filename);
+                remove (export_filename);
+                remove (parallel_filename);
+                remove (patch_filename);
+        }
+        return (identical ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/* EOF */
@@ -0,0 +1,119 @@
+/*!
+ * \file bench.h
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for the libDXF reader and writer benchmarks.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_TESTS_BENCH_H
+#define LIBDXF_TESTS_BENCH_H
+
+
+#include <stdint.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Entity types produced by the synthetic generator.
+ */
+typedef enum
+bench_entity_type
+{
+        BENCH_POINT = 0,
+        BENCH_LINE,
+        BENCH_CIRCLE,
+        BENCH_ARC,
+        BENCH_TEXT,
+        BENCH_ELLIPSE,
+                /*!< Only generated for AutoCAD R13 and later. */
+        BENCH_NUMBER_OF_TYPES
+} BenchEntityType;
+
+
+/*!
+ * \brief Counters gathered during a benchmark run.
+ */
+typedef struct
+bench_counters_struct
+{
+        uint64_t entities[BENCH_NUMBER_OF_TYPES];
+                /*!< Number of entities of each type. */
+        uint64_t bytes;
+                /*!< Number of bytes read or written. */
+} BenchCounters;
+
+
+/*!
+ * \brief Measurements of a single benchmark phase.
+ */
+typedef struct
+bench_result_struct
+{
+        const char *name;
+                /*!< Name of the phase (\c "write", \c "read" or
+                 * \c "round_trip"). */
+        double seconds;
+                /*!< Wall clock time in seconds. */
+        uint64_t bytes;
+                /*!< Number of bytes processed. */
+        uint64_t entities;
+                /*!< Number of entities processed. */
+        long peak_rss;
+                /*!< Peak resident set size in kilobytes. */
+        uint64_t allocations;
+                /*!< Number of allocations through the libDXF allocator
+                 * (\c malloc and \c realloc hooks), only valid when
+                 * allocations are counted. */
+        uint64_t allocated_bytes;
+                /*!< Number of bytes requested through the libDXF
+                 * allocator. */
+} BenchResult;
+
+
+/* bench_util.c */
+double bench_time (void);
+void bench_reset_peak_rss (void);
+long bench_get_peak_rss (void);
+int bench_count_allocations (void);
+int bench_alloc_counting (void);
+BenchEntityType bench_entity_type (void *entity);
+void bench_get_alloc_counters (uint64_t *allocations, uint64_t *allocated_bytes);
+
+/* bench_generate.c */
+int bench_version_from_name (const char *name);
+int bench_write_preamble (DxfFile *fp);
+int bench_write_postamble (DxfFile *fp);
+int bench_generate (const char *filename, int acad_version_number, uint64_t entities_per_type, uint64_t target_size, uint32_t seed, BenchCounters *counters);
+
+
+#endif /* LIBDXF_TESTS_BENCH_H */
+
+
+/* EOF */
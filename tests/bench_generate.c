@@ -0,0 +1,464 @@
+/*!
+ * \file bench_generate.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Deterministic generator of synthetic DXF files for the libDXF
+ * benchmarks.
+ *
+ * The generator writes an \c ENTITIES section with an interleaved mix of
+ * \c POINT, \c LINE, \c CIRCLE and \c ARC entities with the libDXF
+ * writers.\n
+ * All values are derived from a pseudo random number generator with a
+ * fixed seed, so the same options always result in the same file.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+
+
+/*!
+ * \brief AutoCAD versions supported by the generator.
+ */
+static const struct
+{
+        const char *name;
+                /*!< Release name as given on the command line. */
+        const char *acad_version;
+                /*!< Value of the \c $ACADVER header variable. */
+        int acad_version_number;
+                /*!< AutoCAD version number. */
+} bench_versions[] =
+{
+        {"R12", "AC1009", AutoCAD_12},
+        {"R13", "AC1012", AutoCAD_13},
+        {"R14", "AC1014", AutoCAD_14},
+        {"R2000", "AC1015", AutoCAD_2000},
+        {"R2004", "AC1018", AutoCAD_2004},
+        {"R2007", "AC1021", AutoCAD_2007},
+        {"R2010", "AC1024", AutoCAD_2010},
+        {NULL, NULL, 0}
+};
+
+
+/*!
+ * \brief Layer names used by the generator.
+ */
+static char *bench_layers[] =
+{
+        "0",
+        "WALLS",
+        "DOORS",
+        "WINDOWS",
+        "DIMENSIONS",
+        "HATCHING",
+        "FURNITURE",
+        "ANNOTATIONS"
+};
+
+
+/*!
+ * \brief Linetype names used by the generator.
+ */
+static char *bench_linetypes[] =
+{
+        "BYLAYER",
+        "CONTINUOUS",
+        "DASHED",
+        "CENTER"
+};
+
+
+/*!
+ * \brief Text values used by the generator.
+ */
+static char *bench_texts[] =
+{
+        "Room 12",
+        "Kitchen",
+        "Do not scale this drawing",
+        "A"
+};
+
+
+/*!
+ * \brief Return the next value of a xorshift32 pseudo random number
+ * generator.
+ */
+static uint32_t
+bench_random
+(
+        uint32_t *state
+                /*!< state of the generator, never 0. */
+)
+{
+        uint32_t x = *state;
+
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        *state = x;
+        return (x);
+}
+
+
+/*!
+ * \brief Return a pseudo random coordinate in the range [0, 10000) with
+ * at most 3 decimals.
+ */
+static double
+bench_random_coordinate
+(
+        uint32_t *state
+                /*!< state of the generator, never 0. */
+)
+{
+        return ((double) (bench_random (state) % 10000000) / 1000.0);
+}
+
+
+/*!
+ * \brief Return the AutoCAD version number for a release name like
+ * \c "R2000".
+ *
+ * \return the AutoCAD version number, or -1 for an unsupported release.
+ */
+int
+bench_version_from_name
+(
+        const char *name
+                /*!< release name. */
+)
+{
+        int i;
+
+        for (i = 0; bench_versions[i].name != NULL; i++)
+        {
+                if (strcmp (bench_versions[i].name, name) == 0)
+                {
+                        return (bench_versions[i].acad_version_number);
+                }
+        }
+        return (-1);
+}
+
+
+/*!
+ * \brief Write a minimal \c HEADER section and open the \c ENTITIES
+ * section.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+bench_write_preamble
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an output file. */
+)
+{
+        int i;
+
+        for (i = 0; bench_versions[i].name != NULL; i++)
+        {
+                if (bench_versions[i].acad_version_number == fp->acad_version_number)
+                {
+                        break;
+                }
+        }
+        if (bench_versions[i].name == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () unsupported AutoCAD version number %d.\n")),
+                  __FUNCTION__, fp->acad_version_number);
+                return (EXIT_FAILURE);
+        }
+        dxf_section_write (fp, "HEADER");
+        fprintf (fp->fp, "  9\n$ACADVER\n  1\n%s\n", bench_versions[i].acad_version);
+        dxf_endsec_write (fp);
+        dxf_section_write (fp, "ENTITIES");
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Close the \c ENTITIES section and write the end of file marker.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+bench_write_postamble
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an output file. */
+)
+{
+        dxf_endsec_write (fp);
+        dxf_file_write_eof (fp);
+        return (ferror (fp->fp) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Generate a synthetic DXF file.
+ *
+ * Each round writes one entity of every type (no \c ELLIPSE before
+ * AutoCAD R13), rounds are written until
+ * \c entities_per_type entities of each type are written or, when
+ * \c target_size is not 0, until the file is at least \c target_size
+ * bytes long.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+bench_generate
+(
+        const char *filename,
+                /*!< name of the file to generate. */
+        int acad_version_number,
+                /*!< AutoCAD version number of the generated file. */
+        uint64_t entities_per_type,
+                /*!< number of entities of each type, ignored when
+                 * \c target_size is not 0. */
+        uint64_t target_size,
+                /*!< minimum size of the generated file in bytes, or 0. */
+        uint32_t seed,
+                /*!< seed of the pseudo random number generator. */
+        BenchCounters *counters
+                /*!< counters to update. */
+)
+{
+        DxfFile file;
+        DxfPoint *point = NULL;
+        DxfLine *line = NULL;
+        DxfCircle *circle = NULL;
+        DxfArc *arc = NULL;
+        DxfText *text = NULL;
+        DxfEllipse *ellipse = NULL;
+        char *point_layer;
+        char *point_linetype;
+        char *line_layer;
+        char *line_linetype;
+        char *circle_layer;
+        char *circle_linetype;
+        char *arc_layer;
+        char *arc_linetype;
+        char *text_layer;
+        char *text_linetype;
+        char *text_value;
+        char *ellipse_layer;
+        char *ellipse_linetype;
+        uint32_t state = (seed != 0) ? seed : 1;
+        uint64_t round;
+        int id_code = 0x100;
+        int result = EXIT_SUCCESS;
+
+        memset (&file, 0, sizeof (DxfFile));
+        file.filename = (char *) filename;
+        file.acad_version_number = acad_version_number;
+        file.fp = fopen (filename, "w");
+        if (file.fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not open file: %s for writing.\n")),
+                  __FUNCTION__, filename);
+                return (EXIT_FAILURE);
+        }
+        if (bench_write_preamble (&file) != EXIT_SUCCESS)
+        {
+                fclose (file.fp);
+                return (EXIT_FAILURE);
+        }
+        point = dxf_point_init (dxf_point_new ());
+        line = dxf_line_init (dxf_line_new ());
+        circle = dxf_circle_init (dxf_circle_new ());
+        arc = dxf_arc_init (dxf_arc_new ());
+        text = dxf_text_init (dxf_text_new ());
+        ellipse = dxf_ellipse_init (dxf_ellipse_new ());
+        /* The layer and linetype members are pointed to the static name
+         * tables while generating, keep the allocated strings. */
+        point_layer = point->layer;
+        point_linetype = point->linetype;
+        line_layer = line->layer;
+        line_linetype = line->linetype;
+        circle_layer = circle->layer;
+        circle_linetype = circle->linetype;
+        arc_layer = arc->layer;
+        arc_linetype = arc->linetype;
+        text_layer = text->layer;
+        text_linetype = text->linetype;
+        text_value = text->text_value;
+        ellipse_layer = ellipse->layer;
+        ellipse_linetype = ellipse->linetype;
+        for (round = 0;; round++)
+        {
+                if (target_size != 0)
+                {
+                        if ((uint64_t) ftello (file.fp) >= target_size)
+                        {
+                                break;
+                        }
+                }
+                else if (round >= entities_per_type)
+                {
+                        break;
+                }
+                point->id_code = id_code++;
+                point->layer = bench_layers[bench_random (&state) % 8];
+                point->linetype = bench_linetypes[bench_random (&state) % 4];
+                point->color = 1 + (bench_random (&state) % 255);
+                point->x0 = bench_random_coordinate (&state);
+                point->y0 = bench_random_coordinate (&state);
+                point->z0 = 0.0;
+                dxf_point_write (&file, point);
+                line->id_code = id_code++;
+                line->layer = bench_layers[bench_random (&state) % 8];
+                line->linetype = bench_linetypes[bench_random (&state) % 4];
+                line->color = 1 + (bench_random (&state) % 255);
+                line->p0->x0 = bench_random_coordinate (&state);
+                line->p0->y0 = bench_random_coordinate (&state);
+                line->p0->z0 = 0.0;
+                line->p1->x0 = bench_random_coordinate (&state);
+                line->p1->y0 = bench_random_coordinate (&state);
+                line->p1->z0 = 0.0;
+                dxf_line_write (&file, line);
+                circle->id_code = id_code++;
+                circle->layer = bench_layers[bench_random (&state) % 8];
+                circle->linetype = bench_linetypes[bench_random (&state) % 4];
+                circle->color = 1 + (bench_random (&state) % 255);
+                circle->p0->x0 = bench_random_coordinate (&state);
+                circle->p0->y0 = bench_random_coordinate (&state);
+                circle->p0->z0 = 0.0;
+                circle->radius = 0.001 + bench_random_coordinate (&state) / 10.0;
+                dxf_circle_write (&file, circle);
+                arc->id_code = id_code++;
+                arc->layer = bench_layers[bench_random (&state) % 8];
+                arc->linetype = bench_linetypes[bench_random (&state) % 4];
+                arc->color = 1 + (bench_random (&state) % 255);
+                arc->p0->x0 = bench_random_coordinate (&state);
+                arc->p0->y0 = bench_random_coordinate (&state);
+                arc->p0->z0 = 0.0;
+                arc->radius = 0.001 + bench_random_coordinate (&state) / 10.0;
+                arc->start_angle = (double) (bench_random (&state) % 360);
+                /* Start angle and end angle have to differ. */
+                arc->end_angle = (double) (((uint32_t) arc->start_angle
+                  + 1 + (bench_random (&state) % 359)) % 360);
+                dxf_arc_write (&file, arc);
+                text->id_code = id_code++;
+                text->layer = bench_layers[bench_random (&state) % 8];
+                text->linetype = bench_linetypes[bench_random (&state) % 4];
+                text->color = 1 + (bench_random (&state) % 255);
+                text->text_value = bench_texts[bench_random (&state) % 4];
+                text->x0 = bench_random_coordinate (&state);
+                text->y0 = bench_random_coordinate (&state);
+                text->z0 = 0.0;
+                text->height = 0.5 + (double) (bench_random (&state) % 40) / 4.0;
+                text->rot_angle = (double) (bench_random (&state) % 360);
+                text->rel_x_scale = 1.0;
+                dxf_text_write (&file, text);
+                if (acad_version_number >= AutoCAD_13)
+                {
+                        ellipse->id_code = id_code++;
+                        ellipse->layer = bench_layers[bench_random (&state) % 8];
+                        ellipse->linetype = bench_linetypes[bench_random (&state) % 4];
+                        ellipse->color = 1 + (bench_random (&state) % 255);
+                        ellipse->p0->x0 = bench_random_coordinate (&state);
+                        ellipse->p0->y0 = bench_random_coordinate (&state);
+                        ellipse->p0->z0 = 0.0;
+                        /* The end point of the major axis, relative to
+                         * the center. */
+                        ellipse->p1->x0 = 0.001 + bench_random_coordinate (&state) / 10.0;
+                        ellipse->p1->y0 = 0.0;
+                        ellipse->p1->z0 = 0.0;
+                        ellipse->ratio = (double) (1 + (bench_random (&state) % 1000)) / 1000.0;
+                        ellipse->start_angle = 0.0;
+                        ellipse->end_angle = (double) (1 + (bench_random (&state) % 6283)) / 1000.0;
+                        dxf_ellipse_write (&file, ellipse);
+                }
+                if (counters != NULL)
+                {
+                        counters->entities[BENCH_POINT]++;
+                        counters->entities[BENCH_LINE]++;
+                        counters->entities[BENCH_CIRCLE]++;
+                        counters->entities[BENCH_ARC]++;
+                        counters->entities[BENCH_TEXT]++;
+                        if (acad_version_number >= AutoCAD_13)
+                        {
+                                counters->entities[BENCH_ELLIPSE]++;
+                        }
+                }
+                if (ferror (file.fp))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () while writing to: %s.\n")),
+                          __FUNCTION__, filename);
+                        result = EXIT_FAILURE;
+                        break;
+                }
+        }
+        if (bench_write_postamble (&file) != EXIT_SUCCESS)
+        {
+                result = EXIT_FAILURE;
+        }
+        if (counters != NULL)
+        {
+                counters->bytes += (uint64_t) ftello (file.fp);
+        }
+        if (fclose (file.fp) != 0)
+        {
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        point->layer = point_layer;
+        point->linetype = point_linetype;
+        line->layer = line_layer;
+        line->linetype = line_linetype;
+        circle->layer = circle_layer;
+        circle->linetype = circle_linetype;
+        arc->layer = arc_layer;
+        arc->linetype = arc_linetype;
+        text->layer = text_layer;
+        text->linetype = text_linetype;
+        text->text_value = text_value;
+        ellipse->layer = ellipse_layer;
+        ellipse->linetype = ellipse_linetype;
+        dxf_point_free (point);
+        dxf_line_free (line);
+        dxf_circle_free (circle);
+        dxf_arc_free (arc);
+        dxf_text_free (text);
+        dxf_ellipse_free (ellipse);
+        return (result);
+}
+
+
+/* EOF */
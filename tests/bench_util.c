@@ -0,0 +1,270 @@
+/*!
+ * \file bench_util.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Timing, memory and allocation counters for the libDXF
+ * benchmarks.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <time.h>
+#include "bench.h"
+
+
+static uint64_t bench_allocations = 0;
+static uint64_t bench_allocated_bytes = 0;
+static int bench_counting = FALSE;
+
+
+/*!
+ * \brief Allocate memory for libDXF and count the allocation.
+ */
+static void *
+bench_count_malloc (void *context, size_t size)
+{
+        (void) context;
+        __sync_fetch_and_add (&bench_allocations, 1);
+        __sync_fetch_and_add (&bench_allocated_bytes, size);
+        return (malloc (size));
+}
+
+
+/*!
+ * \brief Resize memory for libDXF and count the allocation.
+ */
+static void *
+bench_count_realloc (void *context, void *ptr, size_t size)
+{
+        (void) context;
+        __sync_fetch_and_add (&bench_allocations, 1);
+        __sync_fetch_and_add (&bench_allocated_bytes, size);
+        return (realloc (ptr, size));
+}
+
+
+/*!
+ * \brief Free memory for libDXF.
+ */
+static void
+bench_count_free (void *context, void *ptr)
+{
+        (void) context;
+        free (ptr);
+}
+
+
+#ifdef __GLIBC__
+/*!
+ * \brief Number of usable bytes at \c ptr, as for the C library
+ * allocator.
+ */
+static size_t
+bench_count_usable_size (void *context, void *ptr)
+{
+        (void) context;
+        return (malloc_usable_size (ptr));
+}
+#else
+#define bench_count_usable_size NULL
+#endif
+
+
+/*!
+ * \brief The C library allocator, counting the allocations, strings are
+ * duplicated with the counted \c malloc hook.
+ */
+static const DxfAllocator bench_counting_allocator =
+{
+        bench_count_malloc,
+        bench_count_realloc,
+        bench_count_free,
+        NULL,
+        NULL,
+        bench_count_usable_size
+};
+
+
+/*!
+ * \brief Count the allocations of libDXF from now on.
+ *
+ * The counting allocator is set as the process wide allocator, call this
+ * before libDXF allocates any memory.\n
+ * Only the memory allocated through the allocator of libDXF is counted.
+ * As libDXF only spreads work over threads with the C library
+ * allocator, work is done on the calling thread only from now on.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+bench_count_allocations (void)
+{
+        if (dxf_set_allocator (&bench_counting_allocator) != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        bench_counting = TRUE;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Return a monotonic time stamp in seconds.
+ */
+double
+bench_time (void)
+{
+        struct timespec ts;
+
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+        return ((double) ts.tv_sec + (double) ts.tv_nsec * 1e-9);
+}
+
+
+/*!
+ * \brief Reset the peak resident set size of the process.
+ *
+ * Only supported on Linux (4.0 and later), elsewhere the peak resident
+ * set size is the peak of the whole process.
+ */
+void
+bench_reset_peak_rss (void)
+{
+        FILE *fp;
+
+        fp = fopen ("/proc/self/clear_refs", "w");
+        if (fp != NULL)
+        {
+                fputs ("5", fp);
+                fclose (fp);
+        }
+}
+
+
+/*!
+ * \brief Return the peak resident set size of the process in kilobytes.
+ */
+long
+bench_get_peak_rss (void)
+{
+        struct rusage usage;
+        FILE *fp;
+        char line[256];
+        long peak = -1;
+
+        fp = fopen ("/proc/self/status", "r");
+        if (fp != NULL)
+        {
+                while (fgets (line, sizeof (line), fp) != NULL)
+                {
+                        if (sscanf (line, "VmHWM: %ld", &peak) == 1)
+                        {
+                                break;
+                        }
+                }
+                fclose (fp);
+        }
+        if ((peak < 0) && (getrusage (RUSAGE_SELF, &usage) == 0))
+        {
+                peak = usage.ru_maxrss;
+        }
+        return (peak);
+}
+
+
+/*!
+ * \brief Return \c TRUE when allocations are counted.
+ */
+int
+bench_alloc_counting (void)
+{
+        return (bench_counting);
+}
+
+
+/*!
+ * \brief Get the number of allocations and the number of allocated
+ * bytes so far.
+ */
+void
+bench_get_alloc_counters
+(
+        uint64_t *allocations,
+                /*!< number of allocations. */
+        uint64_t *allocated_bytes
+                /*!< number of allocated bytes. */
+)
+{
+        *allocations = __sync_fetch_and_add (&bench_allocations, 0);
+        *allocated_bytes = __sync_fetch_and_add (&bench_allocated_bytes, 0);
+}
+
+
+/*!
+ * \brief Return the benchmark entity type of an entity.
+ *
+ * \return the type, or \c BENCH_NUMBER_OF_TYPES for an entity of a type
+ * which is not generated.
+ */
+BenchEntityType
+bench_entity_type
+(
+        void *entity
+                /*!< a pointer to a DXF entity. */
+)
+{
+        switch (dxf_entity_get_type (entity))
+        {
+                case POINT:
+                        return (BENCH_POINT);
+                case LINE:
+                        return (BENCH_LINE);
+                case CIRCLE:
+                        return (BENCH_CIRCLE);
+                case ARC:
+                        return (BENCH_ARC);
+                case TEXT:
+                        return (BENCH_TEXT);
+                case ELLIPSE:
+                        return (BENCH_ELLIPSE);
+                default:
+                        return (BENCH_NUMBER_OF_TYPES);
+        }
+}
+
+
+/* EOF */
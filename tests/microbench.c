@@ -0,0 +1,704 @@
+/*!
+ * \file microbench.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Per entity microbenchmarks for libDXF driven by the golden
+ * files.
+ *
+ * The entity in each golden file (\c tests/golden/<type>_<version>.dxf)
+ * is replicated a few thousand times in memory, the \c dxf_<type>_read
+ * and \c dxf_<type>_write functions are then timed in isolation.\n
+ * After a number of warmup runs every run is one sample (nanoseconds
+ * per entity), the median, the 99th percentile and the median absolute
+ * deviation (MAD) of the samples are reported as one line of JSON per
+ * golden file on \c stdout.\n
+ * For the types with a \c dxf_<type>_reset () function the read is
+ * also timed with every entity read into the same struct ("reread"),
+ * together with the number of libDXF allocations per entity.\n
+ * \n
+ * Usage: <tt>microbench [--count N] [--warmup N] [--samples N]
+ * [golden files]</tt>
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libgen.h>
+#include "bench.h"
+
+
+/*!
+ * \brief Read and write functions of an entity type.
+ *
+ * The read function is called with the \c 0 group and the entity name
+ * consumed and returns with the next \c 0 group consumed.
+ */
+typedef struct
+microbench_type_struct
+{
+        const char *name;
+                /*!< Entity name as used in the golden file names. */
+        void *(*read) (DxfFile *fp);
+                /*!< Allocate and read an entity. */
+        void *(*reread) (DxfFile *fp, void *entity);
+                /*!< Reset an entity and read the next one into it, or
+                 * \c NULL when not benchmarked. */
+        int (*write) (DxfFile *fp, void *entity);
+                /*!< Write an entity. */
+        void (*free) (void *entity);
+                /*!< Free an entity. */
+} MicrobenchType;
+
+
+static void *
+microbench_point_read (DxfFile *fp)
+{
+        return (dxf_point_read (fp, dxf_point_init (dxf_point_new ())));
+}
+
+
+static void *
+microbench_point_reread (DxfFile *fp, void *entity)
+{
+        return (dxf_point_read (fp, dxf_point_reset ((DxfPoint *) entity)));
+}
+
+
+static int
+microbench_point_write (DxfFile *fp, void *entity)
+{
+        return (dxf_point_write (fp, (DxfPoint *) entity));
+}
+
+
+static void
+microbench_point_free (void *entity)
+{
+        dxf_point_free ((DxfPoint *) entity);
+}
+
+
+static void *
+microbench_line_read (DxfFile *fp)
+{
+        return (dxf_line_read (fp, dxf_line_init (dxf_line_new ())));
+}
+
+
+static void *
+microbench_line_reread (DxfFile *fp, void *entity)
+{
+        return (dxf_line_read (fp, dxf_line_reset ((DxfLine *) entity)));
+}
+
+
+static int
+microbench_line_write (DxfFile *fp, void *entity)
+{
+        return (dxf_line_write (fp, (DxfLine *) entity));
+}
+
+
+static void
+microbench_line_free (void *entity)
+{
+        dxf_line_free ((DxfLine *) entity);
+}
+
+
+static void *
+microbench_circle_read (DxfFile *fp)
+{
+        return (dxf_circle_read (fp, dxf_circle_init (dxf_circle_new ())));
+}
+
+
+static void *
+microbench_circle_reread (DxfFile *fp, void *entity)
+{
+        return (dxf_circle_read (fp, dxf_circle_reset ((DxfCircle *) entity)));
+}
+
+
+static int
+microbench_circle_write (DxfFile *fp, void *entity)
+{
+        return (dxf_circle_write (fp, (DxfCircle *) entity));
+}
+
+
+static void
+microbench_circle_free (void *entity)
+{
+        dxf_circle_free ((DxfCircle *) entity);
+}
+
+
+static void *
+microbench_arc_read (DxfFile *fp)
+{
+        return (dxf_arc_read (fp, dxf_arc_init (dxf_arc_new ())));
+}
+
+
+static void *
+microbench_arc_reread (DxfFile *fp, void *entity)
+{
+        return (dxf_arc_read (fp, dxf_arc_reset ((DxfArc *) entity)));
+}
+
+
+static int
+microbench_arc_write (DxfFile *fp, void *entity)
+{
+        return (dxf_arc_write (fp, (DxfArc *) entity));
+}
+
+
+static void
+microbench_arc_free (void *entity)
+{
+        dxf_arc_free ((DxfArc *) entity);
+}
+
+
+static void *
+microbench_ellipse_read (DxfFile *fp)
+{
+        return (dxf_ellipse_read (fp, dxf_ellipse_init (dxf_ellipse_new ())));
+}
+
+
+static void *
+microbench_ellipse_reread (DxfFile *fp, void *entity)
+{
+        return (dxf_ellipse_read (fp, dxf_ellipse_reset ((DxfEllipse *) entity)));
+}
+
+
+static int
+microbench_ellipse_write (DxfFile *fp, void *entity)
+{
+        return (dxf_ellipse_write (fp, (DxfEllipse *) entity));
+}
+
+
+static void
+microbench_ellipse_free (void *entity)
+{
+        dxf_ellipse_free ((DxfEllipse *) entity);
+}
+
+
+static void *
+microbench_lwpolyline_read (DxfFile *fp)
+{
+        return (dxf_lwpolyline_read (fp, dxf_lwpolyline_init (dxf_lwpolyline_new ())));
+}
+
+
+static void *
+microbench_lwpolyline_reread (DxfFile *fp, void *entity)
+{
+        return (dxf_lwpolyline_read (fp, dxf_lwpolyline_reset ((DxfLWPolyline *) entity)));
+}
+
+
+static int
+microbench_lwpolyline_write (DxfFile *fp, void *entity)
+{
+        return (dxf_lwpolyline_write (fp, (DxfLWPolyline *) entity));
+}
+
+
+static void
+microbench_lwpolyline_free (void *entity)
+{
+        dxf_lwpolyline_free ((DxfLWPolyline *) entity);
+}
+
+
+/*!
+ * \brief Read a \c POLYLINE entity with the following \c VERTEX entities
+ * and the terminating \c SEQEND entity.
+ */
+static void *
+microbench_polyline_read (DxfFile *fp)
+{
+        DxfPolyline *polyline = NULL;
+        DxfVertex *vertex = NULL;
+        DxfVertex *last = NULL;
+        DxfSeqend *seqend = NULL;
+        char *name = NULL;
+
+        polyline = dxf_polyline_read (fp, dxf_polyline_init (dxf_polyline_new ()));
+        /* Replace the initial (empty) vertex by the vertices read. */
+        dxf_vertex_free_chain ((DxfVertex *) polyline->vertices);
+        polyline->vertices = NULL;
+        for (;;)
+        {
+                fp->line_number++;
+                dxf_read_string (fp, &name);
+                if (strcmp (name, "VERTEX") != 0)
+                {
+                        break;
+                }
+                vertex = dxf_vertex_read (fp, dxf_vertex_init (dxf_vertex_new ()));
+                if (last == NULL)
+                {
+                        polyline->vertices = vertex;
+                }
+                else
+                {
+                        last->next = (struct DxfVertex *) vertex;
+                }
+                last = vertex;
+        }
+        if (strcmp (name, "SEQEND") == 0)
+        {
+                seqend = dxf_seqend_read (fp, dxf_seqend_init (dxf_seqend_new ()));
+                dxf_seqend_free (seqend);
+        }
+        free (name);
+        return (polyline);
+}
+
+
+static int
+microbench_polyline_write (DxfFile *fp, void *entity)
+{
+        DxfSeqend seqend;
+
+        memset (&seqend, 0, sizeof (DxfSeqend));
+        seqend.id_code = -1;
+        seqend.layer = ((DxfPolyline *) entity)->layer;
+        seqend.linetype = ((DxfPolyline *) entity)->linetype;
+        seqend.dictionary_owner_soft = "";
+        seqend.dictionary_owner_hard = "";
+        dxf_polyline_write (fp, (DxfPolyline *) entity);
+        return (dxf_seqend_write (fp, &seqend));
+}
+
+
+static void
+microbench_polyline_free (void *entity)
+{
+        dxf_polyline_free ((DxfPolyline *) entity);
+}
+
+
+/*!
+ * \brief Entity types with a benchmarked reader and writer.
+ *
+ * \c HELIX is not listed, its embedded \c AcDbSpline subclass can not
+ * be read yet.
+ */
+static const MicrobenchType microbench_types[] =
+{
+        {"arc", microbench_arc_read, microbench_arc_reread, microbench_arc_write, microbench_arc_free},
+        {"circle", microbench_circle_read, microbench_circle_reread, microbench_circle_write, microbench_circle_free},
+        {"ellipse", microbench_ellipse_read, microbench_ellipse_reread, microbench_ellipse_write, microbench_ellipse_free},
+        {"line", microbench_line_read, microbench_line_reread, microbench_line_write, microbench_line_free},
+        {"lwpolyline", microbench_lwpolyline_read, microbench_lwpolyline_reread, microbench_lwpolyline_write, microbench_lwpolyline_free},
+        {"point", microbench_point_read, microbench_point_reread, microbench_point_write, microbench_point_free},
+        {"polyline", microbench_polyline_read, NULL, microbench_polyline_write, microbench_polyline_free},
+        {NULL, NULL, NULL, NULL, NULL}
+};
+
+
+/*!
+ * \brief Statistics of a series of samples.
+ */
+typedef struct
+microbench_statistics_struct
+{
+        double median;
+                /*!< Median of the samples. */
+        double p99;
+                /*!< 99th percentile of the samples (nearest rank). */
+        double mad;
+                /*!< Median absolute deviation of the samples. */
+} MicrobenchStatistics;
+
+
+static int
+microbench_compare_doubles (const void *a, const void *b)
+{
+        double x = *(const double *) a;
+        double y = *(const double *) b;
+
+        return ((x > y) - (x < y));
+}
+
+
+/*!
+ * \brief Return the median of sorted samples.
+ */
+static double
+microbench_median (const double *sorted, int n)
+{
+        return ((n % 2) ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]));
+}
+
+
+/*!
+ * \brief Compute median, p99 and MAD, \c samples is sorted in place.
+ */
+static void
+microbench_statistics
+(
+        double *samples,
+        int n,
+        MicrobenchStatistics *statistics
+)
+{
+        double *deviations;
+        int rank;
+        int i;
+
+        qsort (samples, n, sizeof (double), microbench_compare_doubles);
+        statistics->median = microbench_median (samples, n);
+        rank = (99 * n + 99) / 100;
+        statistics->p99 = samples[((rank > 0) ? rank : 1) - 1];
+        deviations = (double *) malloc (n * sizeof (double));
+        for (i = 0; i < n; i++)
+        {
+                deviations[i] = (samples[i] > statistics->median)
+                  ? samples[i] - statistics->median
+                  : statistics->median - samples[i];
+        }
+        qsort (deviations, n, sizeof (double), microbench_compare_doubles);
+        statistics->mad = microbench_median (deviations, n);
+        free (deviations);
+}
+
+
+/*!
+ * \brief Load a golden file and replicate its entity \c count times.
+ *
+ * Line endings are normalised to a single line feed and an end of file
+ * marker is appended.
+ *
+ * \return the replicated text, or \c NULL when an error occurred.
+ */
+static char *
+microbench_load
+(
+        const char *filename,
+        int count,
+        size_t *size
+)
+{
+        FILE *fp;
+        char *text;
+        char *buffer;
+        long length;
+        size_t n = 0;
+        long i;
+        int c;
+
+        fp = fopen (filename, "rb");
+        if (fp == NULL)
+        {
+                return (NULL);
+        }
+        fseek (fp, 0, SEEK_END);
+        length = ftell (fp);
+        rewind (fp);
+        text = (char *) malloc (length + 2);
+        for (i = 0; i < length; i++)
+        {
+                c = getc (fp);
+                if (c == EOF)
+                {
+                        break;
+                }
+                if (c != '\r')
+                {
+                        text[n++] = (char) c;
+                }
+        }
+        fclose (fp);
+        if ((n > 0) && (text[n - 1] != '\n'))
+        {
+                text[n++] = '\n';
+        }
+        buffer = (char *) malloc (n * count + sizeof ("  0\nEOF\n"));
+        for (i = 0; i < count; i++)
+        {
+                memcpy (buffer + i * n, text, n);
+        }
+        strcpy (buffer + n * count, "  0\nEOF\n");
+        *size = n * count + strlen ("  0\nEOF\n");
+        free (text);
+        return (buffer);
+}
+
+
+/*!
+ * \brief Benchmark one golden file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+microbench_run
+(
+        const char *filename,
+        int count,
+        int warmup,
+        int number_of_samples
+)
+{
+        const MicrobenchType *type = NULL;
+        MicrobenchStatistics read_statistics;
+        MicrobenchStatistics write_statistics;
+        DxfFile file;
+        DxfFile out;
+        char *path;
+        char *fixture;
+        char *version;
+        char *name = NULL;
+        char *text;
+        size_t size;
+        void **entities;
+        double *read_samples;
+        double *write_samples;
+        double start;
+        int acad_version_number;
+        int run;
+        int i;
+
+        /* Derive the entity type and the version from the file name. */
+        path = strdup (filename);
+        fixture = basename (path);
+        if (strrchr (fixture, '.') != NULL)
+        {
+                *strrchr (fixture, '.') = '\0';
+        }
+        version = strrchr (fixture, '_');
+        if (version == NULL)
+        {
+                free (path);
+                return (EXIT_FAILURE);
+        }
+        acad_version_number = bench_version_from_name (version + 1);
+        for (i = 0; microbench_types[i].name != NULL; i++)
+        {
+                if ((strncmp (fixture, microbench_types[i].name, strlen (microbench_types[i].name)) == 0)
+                  && ((fixture[strlen (microbench_types[i].name)] == '_')))
+                {
+                        type = &microbench_types[i];
+                        break;
+                }
+        }
+        if ((type == NULL) || (acad_version_number < 0))
+        {
+                fprintf (stdout, "{\"fixture\":\"%s\",\"skipped\":true}\n", fixture);
+                free (path);
+                return (EXIT_SUCCESS);
+        }
+        text = microbench_load (filename, count, &size);
+        if (text == NULL)
+        {
+                fprintf (stderr, "Could not read: %s\n", filename);
+                free (path);
+                return (EXIT_FAILURE);
+        }
+        entities = (void **) calloc (count, sizeof (void *));
+        read_samples = (double *) malloc (number_of_samples * sizeof (double));
+        write_samples = (double *) malloc (number_of_samples * sizeof (double));
+        memset (&file, 0, sizeof (DxfFile));
+        file.filename = fixture;
+        file.acad_version_number = acad_version_number;
+        memset (&out, 0, sizeof (DxfFile));
+        out.filename = "/dev/null";
+        out.acad_version_number = acad_version_number;
+        out.fp = fopen ("/dev/null", "w");
+        for (run = 0; run < warmup + number_of_samples; run++)
+        {
+                /* Read. */
+                file.fp = fmemopen (text, size, "r");
+                file.line_number = 1;
+                fscanf (file.fp, " %*[^\n]");
+                dxf_read_string (&file, &name);
+                start = bench_time ();
+                for (i = 0; i < count; i++)
+                {
+                        entities[i] = type->read (&file);
+                        /* The reader consumed the next 0 group. */
+                        file.line_number++;
+                        dxf_read_string (&file, &name);
+                }
+                if (run >= warmup)
+                {
+                        read_samples[run - warmup] = (bench_time () - start) * 1e9 / count;
+                }
+                fclose (file.fp);
+                /* Write. */
+                start = bench_time ();
+                for (i = 0; i < count; i++)
+                {
+                        type->write (&out, entities[i]);
+                }
+                fflush (out.fp);
+                if (run >= warmup)
+                {
+                        write_samples[run - warmup] = (bench_time () - start) * 1e9 / count;
+                }
+                for (i = 0; i < count; i++)
+                {
+                        type->free (entities[i]);
+                }
+        }
+        microbench_statistics (read_samples, number_of_samples, &read_statistics);
+        microbench_statistics (write_samples, number_of_samples, &write_statistics);
+        fprintf (stdout,
+          "{\"fixture\":\"%s\",\"type\":\"%s\",\"version\":\"%s\","
+          "\"count\":%d,\"samples\":%d,"
+          "\"read\":{\"median_ns\":%.1f,\"p99_ns\":%.1f,\"mad_ns\":%.1f},"
+          "\"write\":{\"median_ns\":%.1f,\"p99_ns\":%.1f,\"mad_ns\":%.1f}",
+          fixture, type->name, version + 1, count, number_of_samples,
+          read_statistics.median, read_statistics.p99, read_statistics.mad,
+          write_statistics.median, write_statistics.p99, write_statistics.mad);
+        if (type->reread != NULL)
+        {
+                /* Streaming read: every entity is read into the same
+                 * struct after a reset. */
+                void *entity = NULL;
+                uint64_t allocations = 0;
+                uint64_t allocations_before;
+                uint64_t allocations_after;
+                uint64_t allocated_bytes;
+
+                for (run = 0; run < warmup + number_of_samples; run++)
+                {
+                        file.fp = fmemopen (text, size, "r");
+                        file.line_number = 1;
+                        fscanf (file.fp, " %*[^\n]");
+                        dxf_read_string (&file, &name);
+                        bench_get_alloc_counters (&allocations_before, &allocated_bytes);
+                        start = bench_time ();
+                        for (i = 0; i < count; i++)
+                        {
+                                entity = type->reread (&file, entity);
+                                file.line_number++;
+                                dxf_read_string (&file, &name);
+                        }
+                        if (run >= warmup)
+                        {
+                                read_samples[run - warmup] = (bench_time () - start) * 1e9 / count;
+                                bench_get_alloc_counters (&allocations_after, &allocated_bytes);
+                                allocations += allocations_after - allocations_before;
+                        }
+                        fclose (file.fp);
+                }
+                type->free (entity);
+                microbench_statistics (read_samples, number_of_samples, &read_statistics);
+                fprintf (stdout,
+                  ",\"reread\":{\"median_ns\":%.1f,\"p99_ns\":%.1f,\"mad_ns\":%.1f",
+                  read_statistics.median, read_statistics.p99, read_statistics.mad);
+                if (bench_alloc_counting ())
+                {
+                        fprintf (stdout, ",\"allocations_per_entity\":%.3f",
+                          (double) allocations / ((double) count * number_of_samples));
+                }
+                fprintf (stdout, "}");
+        }
+        fprintf (stdout, "}\n");
+        fflush (stdout);
+        /* Clean up. */
+        fclose (out.fp);
+        free (read_samples);
+        free (write_samples);
+        free (entities);
+        free (text);
+        free (name);
+        free (path);
+        return (EXIT_SUCCESS);
+}
+
+
+int
+main (int argc, char **argv)
+{
+        int count = 2000;
+        int warmup = 3;
+        int number_of_samples = 25;
+        int result = EXIT_SUCCESS;
+        int i;
+
+        if (bench_count_allocations () != EXIT_SUCCESS)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (i = 1; i < argc; i++)
+        {
+                if ((strcmp (argv[i], "--count") == 0) && (i + 1 < argc))
+                {
+                        count = atoi (argv[++i]);
+                }
+                else if ((strcmp (argv[i], "--warmup") == 0) && (i + 1 < argc))
+                {
+                        warmup = atoi (argv[++i]);
+                }
+                else if ((strcmp (argv[i], "--samples") == 0) && (i + 1 < argc))
+                {
+                        number_of_samples = atoi (argv[++i]);
+                }
+                else if (strncmp (argv[i], "--", 2) == 0)
+                {
+                        fprintf (stderr,
+                          "Usage: %s [--count N] [--warmup N] [--samples N] [golden files]\n",
+                          argv[0]);
+                        return (EXIT_FAILURE);
+                }
+                else
+                {
+                        break;
+                }
+        }
+        if ((count < 1) || (warmup < 0) || (number_of_samples < 1))
+        {
+                fprintf (stderr, "Invalid count, warmup or number of samples.\n");
+                return (EXIT_FAILURE);
+        }
+        for (; i < argc; i++)
+        {
+                if (microbench_run (argv[i], count, warmup, number_of_samples) != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        return (result);
+}
+
+
+/* EOF */
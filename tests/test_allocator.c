@@ -0,0 +1,227 @@
+/*!
+ * \file test_allocator.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the work done on several threads with a
+ * process wide allocator which is not the C library allocator.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Number of entities, enough to use several threads with the
+ * C library allocator.
+ */
+#define TEST_ALLOCATOR_NUMBER_OF_ENTITIES 20000
+
+
+/*! \brief The thread which is allowed to allocate. */
+static pthread_t test_allocator_thread;
+
+/*! \brief Lock of the counters. */
+static pthread_mutex_t test_allocator_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*! \brief Number of calls of the allocator. */
+static long test_allocator_calls = 0;
+
+/*! \brief Number of calls of the allocator from other threads. */
+static long test_allocator_foreign_calls = 0;
+
+
+/*!
+ * \brief Count a call of the allocator.
+ */
+static void
+test_allocator_count (void)
+{
+        pthread_mutex_lock (&test_allocator_lock);
+        test_allocator_calls++;
+        if (!pthread_equal (pthread_self (), test_allocator_thread))
+        {
+                test_allocator_foreign_calls++;
+        }
+        pthread_mutex_unlock (&test_allocator_lock);
+}
+
+
+static void *
+test_allocator_malloc (void *context, size_t size)
+{
+        (void) context;
+        test_allocator_count ();
+        return (malloc (size));
+}
+
+
+static void *
+test_allocator_realloc (void *context, void *ptr, size_t size)
+{
+        (void) context;
+        test_allocator_count ();
+        return (realloc (ptr, size));
+}
+
+
+static void
+test_allocator_free (void *context, void *ptr)
+{
+        (void) context;
+        test_allocator_count ();
+        free (ptr);
+}
+
+
+/*!
+ * \brief Make a drawing with \c TEST_ALLOCATOR_NUMBER_OF_ENTITIES
+ * lines.
+ */
+static DxfDrawing *
+test_allocator_drawing (void)
+{
+        DxfDrawing *drawing;
+        DxfLine *line;
+        int i;
+
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        if (drawing == NULL)
+        {
+                return (NULL);
+        }
+        for (i = 0; i < TEST_ALLOCATOR_NUMBER_OF_ENTITIES; i++)
+        {
+                line = dxf_line_init (dxf_line_new ());
+                if (line == NULL)
+                {
+                        return (NULL);
+                }
+                dxf_line_set_id_code (line, 0x100 + i);
+                dxf_line_set_x1 (line, (double) (i + 1));
+                dxf_entities_append ((DxfEntities *) drawing->entities_list, line);
+        }
+        return (drawing);
+}
+
+
+int
+main (void)
+{
+        DxfAllocator allocator;
+        DxfDrawing *drawing = NULL;
+        DxfDrawing *revision = NULL;
+        DxfFingerprints *fingerprints = NULL;
+        DxfDiff *diff = NULL;
+        DxfFile fp;
+        char *text = NULL;
+        size_t size = 0;
+        int result = EXIT_SUCCESS;
+
+        memset (&allocator, 0, sizeof (DxfAllocator));
+        allocator.malloc = test_allocator_malloc;
+        allocator.realloc = test_allocator_realloc;
+        allocator.free = test_allocator_free;
+        test_allocator_thread = pthread_self ();
+        if ((dxf_set_allocator (&allocator) != EXIT_SUCCESS)
+          || (dxf_allocator_is_system ()))
+        {
+                fprintf (stderr, "test_allocator: could not set the allocator.\n");
+                return (EXIT_FAILURE);
+        }
+        drawing = test_allocator_drawing ();
+        revision = test_allocator_drawing ();
+        if ((drawing == NULL) || (revision == NULL))
+        {
+                fprintf (stderr, "test_allocator: could not create the drawings.\n");
+                return (EXIT_FAILURE);
+        }
+        dxf_line_set_x1 ((DxfLine *) ((DxfEntities *) revision->entities_list)->entities[7], -1.0);
+        /* The memory of the drawings would go to another allocator. */
+        if (dxf_set_allocator (NULL) != EXIT_FAILURE)
+        {
+                fprintf (stderr, "test_allocator: the allocator was replaced while in use.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Write the entities, asking for several threads. */
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.fp = open_memstream (&text, &size);
+        fp.filename = (char *) "test";
+        fp.acad_version_number = AutoCAD_2000;
+        if ((fp.fp == NULL)
+          || (dxf_entities_write_parallel (&fp, (DxfEntities *) drawing->entities_list, 4) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_allocator: could not write the entities.\n");
+                result = EXIT_FAILURE;
+        }
+        if (fp.fp != NULL)
+        {
+                fclose (fp.fp);
+        }
+        /* Fingerprint and diff the drawings, asking for several
+         * threads. */
+        fingerprints = dxf_fingerprints_drawing (drawing, 4);
+        if (fingerprints == NULL)
+        {
+                fprintf (stderr, "test_allocator: could not fingerprint the drawing.\n");
+                result = EXIT_FAILURE;
+        }
+        diff = dxf_diff_drawings (drawing, revision, AutoCAD_2000, 4);
+        if ((diff == NULL)
+          || (dxf_diff_get_number_of_changes (diff) != 1))
+        {
+                fprintf (stderr, "test_allocator: could not diff the drawings.\n");
+                result = EXIT_FAILURE;
+        }
+        if ((test_allocator_calls == 0)
+          || (test_allocator_foreign_calls != 0))
+        {
+                fprintf (stderr, "test_allocator: %ld of %ld allocator calls were made on other threads.\n",
+                  test_allocator_foreign_calls, test_allocator_calls);
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        if (fingerprints != NULL)
+        {
+                dxf_fingerprints_free (fingerprints);
+        }
+        if (diff != NULL)
+        {
+                dxf_diff_free (diff);
+        }
+        dxf_drawing_free (drawing);
+        dxf_drawing_free (revision);
+        free (text);
+        return (result);
+}
+
+
+/* EOF */
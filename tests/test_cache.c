@@ -0,0 +1,283 @@
+/*!
+ * \file test_cache.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for saving a drawing to a native binary cache
+ * and opening the cache as a drawing.
+ *
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#include "includes.h"
+
+
+/*!
+ * \brief A drawing with plain entities, which are stored column wise,
+ * and entities which are kept as DXF text in the cache.
+ */
+static const char *test_cache_text =
+  "  0\nSECTION\n"
+  "  2\nHEADER\n"
+  "  9\n$ACADVER\n"
+  "  1\nAC1015\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n"
+  "  2\nENTITIES\n"
+  "  0\nLINE\n"
+  "  5\n2A\n"
+  "100\nAcDbEntity\n"
+  "  8\nWALLS\n"
+  "100\nAcDbLine\n"
+  " 10\n1.0\n 20\n2.0\n 30\n0.0\n"
+  " 11\n4.0\n 21\n6.0\n 31\n0.0\n"
+  "  0\nTEXT\n"
+  "  5\n2B\n"
+  "100\nAcDbEntity\n"
+  "  8\nNOTES\n"
+  "100\nAcDbText\n"
+  " 10\n1.0\n 20\n1.0\n 30\n0.0\n"
+  " 40\n2.5\n"
+  "  1\nHello\n"
+  "100\nAcDbText\n"
+  "  0\nCIRCLE\n"
+  "  5\n2C\n"
+  "100\nAcDbEntity\n"
+  "  8\n0\n"
+  "100\nAcDbCircle\n"
+  " 39\n2.0\n"
+  " 10\n5.0\n 20\n5.0\n 30\n0.0\n"
+  " 40\n3.0\n"
+  "  0\nARC\n"
+  "  5\n2D\n"
+  "100\nAcDbEntity\n"
+  "  8\n0\n"
+  "100\nAcDbCircle\n"
+  " 10\n7.0\n 20\n8.0\n 30\n0.0\n"
+  " 40\n1.5\n"
+  "100\nAcDbArc\n"
+  " 50\n0.0\n 51\n90.0\n"
+  "  0\nWIPEOUT\n"
+  "  5\n2E\n"
+  "100\nAcDbEntity\n"
+  "  8\nMASKS\n"
+  "100\nAcDbWipeout\n"
+  " 10\n1.0\n 20\n2.0\n 30\n0.0\n"
+  "  0\nENDSEC\n"
+  "  0\nEOF\n";
+
+
+/*!
+ * \brief Write \c text to a file and set its modification time.
+ */
+static int
+test_cache_write_source
+(
+        const char *filename,
+        const char *text,
+        time_t mtime
+)
+{
+        struct timespec times[2];
+        FILE *file;
+
+        file = fopen (filename, "w");
+        if (file == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fputs (text, file);
+        fclose (file);
+        times[0].tv_sec = mtime;
+        times[0].tv_nsec = 0;
+        times[1] = times[0];
+        return ((utimensat (AT_FDCWD, filename, times, 0) == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Count the files in a directory.
+ */
+static int
+test_cache_count_files
+(
+        const char *directory
+)
+{
+        DIR *dir;
+        struct dirent *entry;
+        int count = 0;
+
+        dir = opendir (directory);
+        if (dir == NULL)
+        {
+                return (-1);
+        }
+        while ((entry = readdir (dir)) != NULL)
+        {
+                if (entry->d_name[0] != '.')
+                {
+                        count++;
+                }
+        }
+        closedir (dir);
+        return (count);
+}
+
+
+int
+main (void)
+{
+        char directory[] = "/tmp/test_cache_XXXXXX";
+        char filename[64];
+        char cache_filename[64];
+        char *changed_text;
+        DxfDrawing *drawing;
+        DxfDrawing *cached;
+        DxfEntities *entities;
+        DxfCache *cache;
+        DxfLine *line;
+        DxfText *text;
+        DxfCircle *circle;
+        DxfArc *arc;
+        DxfRawEntity *raw_entity;
+        int result = EXIT_SUCCESS;
+
+        if (mkdtemp (directory) == NULL)
+        {
+                fprintf (stderr, "test_cache: could not make a temporary directory.\n");
+                return (EXIT_FAILURE);
+        }
+        snprintf (filename, sizeof (filename), "%s/drawing.dxf", directory);
+        snprintf (cache_filename, sizeof (cache_filename), "%s/drawing.dxfc", directory);
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        if ((test_cache_write_source (filename, test_cache_text, 1000000000) != EXIT_SUCCESS)
+          || (drawing == NULL)
+          || (dxf_file_load (filename, drawing) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_cache: could not load the drawing.\n");
+                return (EXIT_FAILURE);
+        }
+        /* The cache replaces its file when complete, no temporary file
+         * is left behind. */
+        if ((dxf_drawing_save_cache (drawing, cache_filename, filename) != EXIT_SUCCESS)
+          || (dxf_drawing_save_cache (drawing, cache_filename, filename) != EXIT_SUCCESS)
+          || (test_cache_count_files (directory) != 2))
+        {
+                fprintf (stderr, "test_cache: could not save the cache.\n");
+                return (EXIT_FAILURE);
+        }
+        dxf_drawing_free (drawing);
+        /* The plain LINE and ARC are stored column wise, the other
+         * entities as DXF text. */
+        cache = dxf_cache_open (cache_filename, filename);
+        if ((cache == NULL)
+          || (dxf_cache_get_number_of_rows (cache, DXF_CACHE_TABLE_LINE) != 1)
+          || (dxf_cache_get_number_of_rows (cache, DXF_CACHE_TABLE_CIRCLE) != 0)
+          || (dxf_cache_get_number_of_rows (cache, DXF_CACHE_TABLE_ARC) != 1)
+          || (dxf_cache_get_number_of_rows (cache, DXF_CACHE_TABLE_OTHER) != 3)
+          || (dxf_cache_get_int_column (cache, DXF_CACHE_TABLE_ARC, DXF_CACHE_COLUMN_ORDER)[0] != 3))
+        {
+                fprintf (stderr, "test_cache: wrong tables in the cache.\n");
+                result = EXIT_FAILURE;
+        }
+        if (cache != NULL)
+        {
+                dxf_cache_close (cache);
+        }
+        /* All entities are read back, in order. */
+        cached = dxf_drawing_open_cache (cache_filename, filename);
+        if (cached == NULL)
+        {
+                fprintf (stderr, "test_cache: could not open the cache.\n");
+                return (EXIT_FAILURE);
+        }
+        entities = (DxfEntities *) cached->entities_list;
+        line = dxf_entities_get_entity (entities, 0);
+        text = dxf_entities_get_entity (entities, 1);
+        circle = dxf_entities_get_entity (entities, 2);
+        arc = dxf_entities_get_entity (entities, 3);
+        raw_entity = dxf_entities_get_entity (entities, 4);
+        if ((dxf_entities_get_number_of_entities (entities) != 5)
+          || (strcmp (((DxfHeader *) cached->header)->AcadVer, "AC1015") != 0)
+          || (dxf_entity_get_type (line) != LINE)
+          || (line->id_code != 0x2A)
+          || (strcmp (line->layer, "WALLS") != 0)
+          || (line->p1->x0 != 4.0)
+          || (line->p1->y0 != 6.0)
+          || (dxf_entity_get_type (text) != TEXT)
+          || (strcmp (text->text_value, "Hello") != 0)
+          || (text->height != 2.5)
+          || (dxf_entity_get_type (circle) != CIRCLE)
+          || (circle->thickness != 2.0)
+          || (circle->radius != 3.0)
+          || (dxf_entity_get_type (arc) != ARC)
+          || (arc->radius != 1.5)
+          || (arc->end_angle != 90.0)
+          || (dxf_entity_get_type (raw_entity) != UNKNOWN_ENTITY)
+          || (strcmp (raw_entity->entity_name, "WIPEOUT") != 0)
+          || (strcmp (raw_entity->layer, "MASKS") != 0))
+        {
+                fprintf (stderr, "test_cache: wrong entities read from the cache.\n");
+                result = EXIT_FAILURE;
+        }
+        dxf_drawing_free (cached);
+        /* A source with the same contents and another modification time
+         * still matches, a source with other contents does not. */
+        changed_text = strdup (test_cache_text);
+        if (changed_text == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        strstr (changed_text, "Hello")[0] = 'J';
+        if ((test_cache_write_source (filename, test_cache_text, 1000000010) != EXIT_SUCCESS)
+          || (!dxf_cache_is_valid (cache_filename, filename)))
+        {
+                fprintf (stderr, "test_cache: the cache of a touched source was rejected.\n");
+                result = EXIT_FAILURE;
+        }
+        if ((test_cache_write_source (filename, changed_text, 1000000020) != EXIT_SUCCESS)
+          || (dxf_cache_is_valid (cache_filename, filename)))
+        {
+                fprintf (stderr, "test_cache: the cache of a changed source was accepted.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        free (changed_text);
+        unlink (filename);
+        unlink (cache_filename);
+        rmdir (directory);
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,210 @@
+/*!
+ * \file test_diff.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the differences between the entities of
+ * two drawings, and patches applying them.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Make a drawing with a \c LINE and a \c CIRCLE.
+ */
+static DxfDrawing *
+test_diff_drawing (void)
+{
+        DxfDrawing *drawing;
+        DxfLine *line;
+        DxfCircle *circle;
+
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        line = dxf_line_init (dxf_line_new ());
+        circle = dxf_circle_init (dxf_circle_new ());
+        if ((drawing == NULL) || (line == NULL) || (circle == NULL))
+        {
+                return (NULL);
+        }
+        dxf_line_set_id_code (line, 0x2A);
+        dxf_line_set_x1 (line, 10.0);
+        dxf_line_set_y1 (line, 5.0);
+        dxf_circle_set_id_code (circle, 0x2B);
+        dxf_circle_set_radius (circle, 2.0);
+        dxf_entities_append ((DxfEntities *) drawing->entities_list, line);
+        dxf_entities_append ((DxfEntities *) drawing->entities_list, circle);
+        return (drawing);
+}
+
+
+/*!
+ * \brief Get the entity with handle \c id_code of a drawing.
+ */
+static void *
+test_diff_find
+(
+        DxfDrawing *drawing,
+        int id_code
+)
+{
+        DxfEntities *entities = (DxfEntities *) drawing->entities_list;
+        size_t i;
+
+        for (i = 0; i < entities->number_of_entities; i++)
+        {
+                if (dxf_entity_get_id_code (entities->entities[i]) == id_code)
+                {
+                        return (entities->entities[i]);
+                }
+        }
+        return (NULL);
+}
+
+
+int
+main (void)
+{
+        DxfDrawing *old_drawing = NULL;
+        DxfDrawing *new_drawing = NULL;
+        DxfDiff *diff = NULL;
+        DxfDiff *read_diff = NULL;
+        DxfDiffChange *change;
+        DxfLine *line;
+        DxfPolyline *polyline;
+        FILE *patch;
+        char *text = NULL;
+        size_t size = 0;
+        int result = EXIT_SUCCESS;
+
+        old_drawing = test_diff_drawing ();
+        new_drawing = test_diff_drawing ();
+        if ((old_drawing == NULL) || (new_drawing == NULL))
+        {
+                fprintf (stderr, "test_diff: could not create the drawings.\n");
+                return (EXIT_FAILURE);
+        }
+        /* Drawings with the same entities do not differ. */
+        diff = dxf_diff_drawings (old_drawing, new_drawing, AutoCAD_2000, 1);
+        if ((diff == NULL)
+          || (dxf_diff_get_number_of_changes (diff) != 0))
+        {
+                fprintf (stderr, "test_diff: equal drawings differ.\n");
+                result = EXIT_FAILURE;
+        }
+        if (diff != NULL)
+        {
+                dxf_diff_free (diff);
+        }
+        /* A change below the six decimals of a DXF file is found. */
+        line = (DxfLine *) test_diff_find (new_drawing, 0x2A);
+        dxf_line_set_x1 (line, 10.0 + 1e-9);
+        diff = dxf_diff_drawings (old_drawing, new_drawing, AutoCAD_2000, 1);
+        change = (diff != NULL) ? dxf_diff_get_change (diff, 0) : NULL;
+        if ((diff == NULL)
+          || (dxf_diff_get_number_of_changes (diff) != 1)
+          || (change == NULL)
+          || (change->id_code != 0x2A)
+          || (change->operation != DXF_DIFF_MODIFIED)
+          || (change->number_of_groups != 1)
+          || (change->groups[0].group_code != 11))
+        {
+                fprintf (stderr, "test_diff: a small change of a LINE is not found.\n");
+                result = EXIT_FAILURE;
+        }
+        /* The patch read back gives the exact value. */
+        patch = open_memstream (&text, &size);
+        if ((diff == NULL)
+          || (patch == NULL)
+          || (dxf_diff_write (patch, diff) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_diff: could not write the patch.\n");
+                result = EXIT_FAILURE;
+        }
+        if (patch != NULL)
+        {
+                fclose (patch);
+        }
+        if (text != NULL)
+        {
+                patch = fmemopen (text, size, "r");
+                read_diff = (patch != NULL) ? dxf_diff_read (patch) : NULL;
+                if (patch != NULL)
+                {
+                        fclose (patch);
+                }
+        }
+        if ((read_diff == NULL)
+          || (dxf_diff_apply (old_drawing, read_diff) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_diff: could not apply the patch.\n");
+                result = EXIT_FAILURE;
+        }
+        else
+        {
+                line = (DxfLine *) test_diff_find (old_drawing, 0x2A);
+                if ((line == NULL)
+                  || (dxf_line_get_x1 (line) != 10.0 + 1e-9)
+                  || (dxf_line_get_y1 (line) != 5.0))
+                {
+                        fprintf (stderr, "test_diff: the patched LINE does not have the exact values.\n");
+                        result = EXIT_FAILURE;
+                }
+        }
+        if (diff != NULL)
+        {
+                dxf_diff_free (diff);
+        }
+        if (read_diff != NULL)
+        {
+                dxf_diff_free (read_diff);
+        }
+        /* A POLYLINE is written with its vertices, adding one can not be
+         * read back from a patch. */
+        polyline = dxf_polyline_init (dxf_polyline_new ());
+        dxf_polyline_set_id_code (polyline, 0x2C);
+        dxf_entities_append ((DxfEntities *) new_drawing->entities_list, polyline);
+        diff = dxf_diff_drawings (old_drawing, new_drawing, AutoCAD_2000, 1);
+        if (diff != NULL)
+        {
+                fprintf (stderr, "test_diff: a diff adding a POLYLINE was computed.\n");
+                dxf_diff_free (diff);
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        free (text);
+        dxf_drawing_free (old_drawing);
+        dxf_drawing_free (new_drawing);
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,436 @@
+/*!
+ * \file test_export.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for exporting a whole drawing, on one and on
+ * several threads, and for the patches and the fingerprints of
+ * exported drawings.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Number of entities of every type, the entities of the drawing
+ * span several chunks of the parallel writer.
+ */
+#define TEST_EXPORT_NUMBER_OF_ENTITIES 5000
+
+
+/*!
+ * \brief Make a drawing with lines, circles, arcs and points on two
+ * layers.
+ *
+ * The coordinates are multiples of a quarter, they are written without
+ * rounding.
+ */
+static DxfDrawing *
+test_export_drawing (void)
+{
+        DxfDrawing *drawing;
+        DxfEntities *entities;
+        DxfLine *line;
+        DxfCircle *circle;
+        DxfArc *arc;
+        DxfPoint *point;
+        const char *layer;
+        int id_code = 0x100;
+        int i;
+
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        if (drawing == NULL)
+        {
+                return (NULL);
+        }
+        entities = (DxfEntities *) drawing->entities_list;
+        for (i = 0; i < TEST_EXPORT_NUMBER_OF_ENTITIES; i++)
+        {
+                layer = ((i % 3) == 0) ? "WALLS" : "0";
+                line = dxf_line_init (dxf_line_new ());
+                circle = dxf_circle_init (dxf_circle_new ());
+                arc = dxf_arc_init (dxf_arc_new ());
+                point = dxf_point_init (dxf_point_new ());
+                if ((line == NULL) || (circle == NULL)
+                  || (arc == NULL) || (point == NULL))
+                {
+                        return (NULL);
+                }
+                dxf_line_set_id_code (line, id_code++);
+                dxf_free (line->layer);
+                line->layer = dxf_strdup (layer);
+                dxf_line_set_x0 (line, i * 0.25);
+                dxf_line_set_x1 (line, i * 0.5);
+                dxf_line_set_y1 (line, 1.0);
+                dxf_entities_append (entities, line);
+                dxf_circle_set_id_code (circle, id_code++);
+                dxf_free (circle->layer);
+                circle->layer = dxf_strdup (layer);
+                dxf_circle_set_x0 (circle, i * 0.75);
+                dxf_circle_set_radius (circle, 1.0 + (i % 7));
+                dxf_entities_append (entities, circle);
+                dxf_arc_set_id_code (arc, id_code++);
+                dxf_free (arc->layer);
+                arc->layer = dxf_strdup (layer);
+                dxf_arc_set_y0 (arc, i * 0.25);
+                dxf_arc_set_radius (arc, 2.5);
+                dxf_arc_set_end_angle (arc, (double) (1 + (i % 359)));
+                dxf_entities_append (entities, arc);
+                dxf_point_set_id_code (point, id_code++);
+                dxf_free (point->layer);
+                point->layer = dxf_strdup (layer);
+                dxf_point_set_x0 (point, -i * 0.5);
+                dxf_entities_append (entities, point);
+        }
+        return (drawing);
+}
+
+
+/*!
+ * \brief Load the drawing written to \c filename.
+ */
+static DxfDrawing *
+test_export_load
+(
+        const char *filename
+)
+{
+        DxfDrawing *drawing;
+
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        if (drawing == NULL)
+        {
+                return (NULL);
+        }
+        if (dxf_file_load (filename, drawing) != EXIT_SUCCESS)
+        {
+                dxf_drawing_free (drawing);
+                return (NULL);
+        }
+        return (drawing);
+}
+
+
+/*!
+ * \brief Compare the contents of two files.
+ *
+ * \return \c TRUE when the files are identical, \c FALSE otherwise.
+ */
+static int
+test_export_compare_files
+(
+        const char *filename_1,
+        const char *filename_2
+)
+{
+        FILE *fp_1;
+        FILE *fp_2;
+        int c;
+        int identical = TRUE;
+
+        fp_1 = fopen (filename_1, "r");
+        fp_2 = fopen (filename_2, "r");
+        if ((fp_1 == NULL) || (fp_2 == NULL))
+        {
+                identical = FALSE;
+        }
+        while (identical)
+        {
+                c = fgetc (fp_1);
+                if (c != fgetc (fp_2))
+                {
+                        identical = FALSE;
+                }
+                else if (c == EOF)
+                {
+                        break;
+                }
+        }
+        if (fp_1 != NULL)
+        {
+                fclose (fp_1);
+        }
+        if (fp_2 != NULL)
+        {
+                fclose (fp_2);
+        }
+        return (identical);
+}
+
+
+/*!
+ * \brief Change a drawing into a new revision, every 97th entity is
+ * moved, every 101st entity is erased and a copy of every 211th entity
+ * is added.
+ */
+static void
+test_export_change
+(
+        DxfDrawing *drawing
+)
+{
+        DxfEntities *entities = (DxfEntities *) drawing->entities_list;
+        DxfMatrix matrix;
+        void *entity;
+        void *copy;
+        size_t number_of_entities = entities->number_of_entities;
+        size_t i;
+        int id_code = 0x100 + (int) number_of_entities;
+
+        dxf_matrix_init (&matrix);
+        matrix.m[0][3] = 10.5;
+        matrix.m[1][3] = -2.25;
+        for (i = 0; i < number_of_entities; i++)
+        {
+                entity = entities->entities[i];
+                if ((i % 97) == 0)
+                {
+                        dxf_entity_transform (entity, &matrix);
+                }
+                if ((i % 101) == 5)
+                {
+                        dxf_entity_set_flags (entity,
+                          dxf_entity_get_flags (entity) | DXF_ENTITY_FLAG_ERASED);
+                }
+                if (((i % 211) == 7)
+                  && ((copy = dxf_entity_clone (entity)) != NULL))
+                {
+                        dxf_entity_set_id_code (copy, id_code++);
+                        dxf_entity_set_flags (copy, 0);
+                        dxf_entities_append (entities, copy);
+                }
+        }
+}
+
+
+/*!
+ * \brief Check two drawings have the same fingerprints, per drawing and
+ * per layer.
+ *
+ * \return \c TRUE when the fingerprints are identical, \c FALSE
+ * otherwise.
+ */
+static int
+test_export_compare_fingerprints
+(
+        DxfDrawing *drawing_1,
+        DxfDrawing *drawing_2
+)
+{
+        DxfFingerprints *fingerprints_1;
+        DxfFingerprints *fingerprints_2;
+        size_t i;
+        int identical;
+
+        fingerprints_1 = dxf_fingerprints_drawing (drawing_1, 4);
+        fingerprints_2 = dxf_fingerprints_drawing (drawing_2, 4);
+        identical = (fingerprints_1 != NULL)
+          && (fingerprints_2 != NULL)
+          && (dxf_fingerprints_get_drawing (fingerprints_1)
+          == dxf_fingerprints_get_drawing (fingerprints_2))
+          && (fingerprints_1->number_of_layers == 2)
+          && (fingerprints_1->number_of_layers == fingerprints_2->number_of_layers);
+        for (i = 0; identical && (i < fingerprints_1->number_of_layers); i++)
+        {
+                identical = (fingerprints_1->layers[i].fingerprint
+                  == dxf_fingerprints_get_layer (fingerprints_2, fingerprints_1->layers[i].layer));
+        }
+        if (fingerprints_1 != NULL)
+        {
+                dxf_fingerprints_free (fingerprints_1);
+        }
+        if (fingerprints_2 != NULL)
+        {
+                dxf_fingerprints_free (fingerprints_2);
+        }
+        return (identical);
+}
+
+
+int
+main (void)
+{
+        char directory[] = "/tmp/test_export_XXXXXX";
+        char export_filename[64];
+        char parallel_filename[64];
+        char re_export_filename[64];
+        char revision_filename[64];
+        char patched_filename[64];
+        DxfDrawing *drawing = NULL;
+        DxfDrawing *exported = NULL;
+        DxfDrawing *revision = NULL;
+        DxfDiff *diff = NULL;
+        void *entity;
+        uint64_t fingerprint;
+        FILE *patch;
+        char *text = NULL;
+        size_t size = 0;
+        int result = EXIT_SUCCESS;
+
+        /* A drawing which does not terminate fails instead of hanging
+         * the test suite. */
+        alarm (60);
+        if (mkdtemp (directory) == NULL)
+        {
+                fprintf (stderr, "test_export: could not make a temporary directory.\n");
+                return (EXIT_FAILURE);
+        }
+        snprintf (export_filename, sizeof (export_filename), "%s/export.dxf", directory);
+        snprintf (parallel_filename, sizeof (parallel_filename), "%s/parallel.dxf", directory);
+        snprintf (re_export_filename, sizeof (re_export_filename), "%s/re_export.dxf", directory);
+        snprintf (revision_filename, sizeof (revision_filename), "%s/revision.dxf", directory);
+        snprintf (patched_filename, sizeof (patched_filename), "%s/patched.dxf", directory);
+        drawing = test_export_drawing ();
+        if (drawing == NULL)
+        {
+                fprintf (stderr, "test_export: could not create the drawing.\n");
+                return (EXIT_FAILURE);
+        }
+        /* The drawing written on several threads is identical to the
+         * drawing written on one thread. */
+        if ((dxf_file_save (export_filename, drawing, AutoCAD_2000, 1) != EXIT_SUCCESS)
+          || (dxf_file_save (parallel_filename, drawing, AutoCAD_2000, 4) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_export: could not export the drawing.\n");
+                return (EXIT_FAILURE);
+        }
+        if (!test_export_compare_files (export_filename, parallel_filename))
+        {
+                fprintf (stderr, "test_export: the drawing written on several threads differs.\n");
+                result = EXIT_FAILURE;
+        }
+        /* The export reads back into the same drawing. */
+        exported = test_export_load (export_filename);
+        if ((exported == NULL)
+          || (dxf_file_save (re_export_filename, exported, AutoCAD_2000, 1) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_export: could not load and export the drawing again.\n");
+                return (EXIT_FAILURE);
+        }
+        if (!test_export_compare_files (export_filename, re_export_filename))
+        {
+                fprintf (stderr, "test_export: the drawing read back does not export the same.\n");
+                result = EXIT_FAILURE;
+        }
+        /* The entities have the same fingerprints after reading them
+         * back. */
+        if (!test_export_compare_fingerprints (drawing, exported))
+        {
+                fprintf (stderr, "test_export: the drawing read back has other fingerprints.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Reassigning a handle keeps the fingerprint. */
+        entity = ((DxfEntities *) exported->entities_list)->entities[0];
+        fingerprint = dxf_entity_get_fingerprint (entity);
+        dxf_entity_set_id_code (entity, 0x7FFF);
+        dxf_entity_set_fingerprint (entity, 0);
+        if ((dxf_entities_update_fingerprints ((DxfEntities *) exported->entities_list, 1) != EXIT_SUCCESS)
+          || (fingerprint == 0)
+          || (dxf_entity_get_fingerprint (entity) != fingerprint))
+        {
+                fprintf (stderr, "test_export: reassigning a handle changed the fingerprint.\n");
+                result = EXIT_FAILURE;
+        }
+        dxf_entity_set_id_code (entity, 0x100);
+        /* Moving the start point of the line clears the fingerprint,
+         * the fingerprint computed again differs. */
+        dxf_line_set_x0 ((DxfLine *) entity, dxf_line_get_x0 ((DxfLine *) entity) + 1.0);
+        if ((dxf_entity_get_fingerprint (entity) != 0)
+          || (dxf_entities_update_fingerprints ((DxfEntities *) exported->entities_list, 1) != EXIT_SUCCESS)
+          || (dxf_entity_get_fingerprint (entity) == fingerprint))
+        {
+                fprintf (stderr, "test_export: changing a line kept the fingerprint.\n");
+                result = EXIT_FAILURE;
+        }
+        dxf_line_set_x0 ((DxfLine *) entity, dxf_line_get_x0 ((DxfLine *) entity) - 1.0);
+        dxf_entities_update_fingerprints ((DxfEntities *) exported->entities_list, 1);
+        dxf_drawing_free (drawing);
+        /* The patch between the export and a revision of it, written
+         * and read back, changes the export into the revision. */
+        revision = test_export_load (export_filename);
+        if (revision == NULL)
+        {
+                fprintf (stderr, "test_export: could not load the revision.\n");
+                return (EXIT_FAILURE);
+        }
+        test_export_change (revision);
+        diff = dxf_diff_drawings (exported, revision, AutoCAD_2000, 4);
+        patch = open_memstream (&text, &size);
+        if ((diff == NULL)
+          || (dxf_diff_get_number_of_changes (diff) == 0)
+          || (patch == NULL)
+          || (dxf_diff_write (patch, diff) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_export: could not write the patch.\n");
+                return (EXIT_FAILURE);
+        }
+        fclose (patch);
+        dxf_diff_free (diff);
+        patch = fmemopen (text, size, "r");
+        diff = (patch != NULL) ? dxf_diff_read (patch) : NULL;
+        if (patch != NULL)
+        {
+                fclose (patch);
+        }
+        if ((diff == NULL)
+          || (dxf_diff_apply (exported, diff) != EXIT_SUCCESS)
+          || (dxf_file_save (patched_filename, exported, AutoCAD_2000, 1) != EXIT_SUCCESS)
+          || (dxf_file_save (revision_filename, revision, AutoCAD_2000, 1) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_export: could not apply the patch.\n");
+                result = EXIT_FAILURE;
+        }
+        else if (!test_export_compare_files (revision_filename, patched_filename))
+        {
+                fprintf (stderr, "test_export: the patched drawing differs from the revision.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        if (diff != NULL)
+        {
+                dxf_diff_free (diff);
+        }
+        dxf_drawing_free (exported);
+        dxf_drawing_free (revision);
+        free (text);
+        unlink (export_filename);
+        unlink (parallel_filename);
+        unlink (re_export_filename);
+        unlink (revision_filename);
+        unlink (patched_filename);
+        rmdir (directory);
+        return (result);
+}
+
+
+/* EOF */
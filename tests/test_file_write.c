@@ -0,0 +1,642 @@
+/*!
+ * \file test_file_write.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for writing a complete drawing, holding an
+ * entity of every type with a reader, and reading the entities back.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "test_util.h"
+
+
+/*!
+ * \brief Handle of the entity of type \c type in the drawing.
+ */
+#define TEST_FILE_WRITE_HANDLE(type) (0x100 + (type))
+
+
+/*!
+ * \brief Give the members the writers require a value.
+ */
+static void
+test_file_write_fill
+(
+        DxfEntityType type,
+        void *entity
+)
+{
+        DxfHatch *hatch;
+        DxfHatchBoundaryPath *path;
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathPolylineVertex *vertices;
+
+        switch (type)
+        {
+                case ARC:
+                        dxf_arc_set_radius ((DxfArc *) entity, 2.5);
+                        dxf_arc_set_end_angle ((DxfArc *) entity, 90.0);
+                        break;
+                case ATTDEF:
+                        dxf_attdef_set_default_value ((DxfAttdef *) entity, dxf_strdup ("value"));
+                        dxf_attdef_set_tag_value ((DxfAttdef *) entity, dxf_strdup ("TAG"));
+                        break;
+                case ATTRIB:
+                        dxf_attrib_set_default_value ((DxfAttrib *) entity, dxf_strdup ("value"));
+                        dxf_attrib_set_tag_value ((DxfAttrib *) entity, dxf_strdup ("TAG"));
+                        break;
+                case ELLIPSE:
+                        dxf_ellipse_set_ratio ((DxfEllipse *) entity, 0.5);
+                        break;
+                case HATCH:
+                        /* A closed polyline boundary path of three
+                         * vertices. */
+                        hatch = (DxfHatch *) entity;
+                        path = dxf_hatch_boundary_path_init (dxf_hatch_boundary_path_new ());
+                        polyline = dxf_hatch_boundary_path_polyline_init (dxf_hatch_boundary_path_polyline_new ());
+                        dxf_hatch_boundary_path_polyline_allocate_vertices (polyline, 3);
+                        vertices = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                        vertices[1].x0 = 10.0;
+                        vertices[2].y0 = 10.0;
+                        polyline->number_of_vertices = 3;
+                        polyline->is_closed = 1;
+                        path->type_flag = 2;
+                        path->polylines = (struct DxfHatchBoundaryPathPolyline *) polyline;
+                        hatch->paths = (struct DxfHatchBoundaryPath *) path;
+                        hatch->number_of_boundary_paths = 1;
+                        break;
+                case HELIX:
+                        dxf_helix_set_radius ((DxfHelix *) entity, 3.0);
+                        break;
+                case LINE:
+                        dxf_line_set_x1 ((DxfLine *) entity, 4.0);
+                        break;
+                case RAY:
+                        ((DxfRay *) entity)->x1 = 1.0;
+                        break;
+                case SHAPE:
+                        dxf_free (((DxfShape *) entity)->shape_name);
+                        ((DxfShape *) entity)->shape_name = dxf_strdup ("SHAPE");
+                        break;
+                case TEXT:
+                        dxf_free (((DxfText *) entity)->text_value);
+                        ((DxfText *) entity)->text_value = dxf_strdup ("text");
+                        break;
+                case TOLERANCE:
+                        dxf_free (((DxfTolerance *) entity)->dimstyle_name);
+                        ((DxfTolerance *) entity)->dimstyle_name = dxf_strdup ("STANDARD");
+                        break;
+                case XLINE:
+                        ((DxfXLine *) entity)->x1 = 1.0;
+                        break;
+                default:
+                        break;
+        }
+}
+
+
+/*!
+ * \brief Read the entity written as \c text, and check it writes the
+ * same.
+ *
+ * \return \c EXIT_SUCCESS when the entity writes the same, or
+ * \c EXIT_FAILURE.
+ */
+static int
+test_file_write_read_back
+(
+        DxfEntityType type,
+        const char *text,
+        size_t length
+)
+{
+        DxfFile fp;
+        void *entity = NULL;
+        char *input = NULL;
+        char *output = NULL;
+        int result = EXIT_FAILURE;
+
+        /* Terminate the entity as the reader expects. */
+        input = malloc (length + 16);
+        if (input == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        memcpy (input, text, length);
+        strcpy (input + length, "  0\nEOF\n");
+        if (test_util_open (&fp, input) == EXIT_SUCCESS)
+        {
+                /* A reader closes the file when it fails. */
+                entity = dxf_entity_read (&fp, type, NULL);
+                if (entity != NULL)
+                {
+                        fclose (fp.fp);
+                        output = test_util_write (entity, FALSE);
+                        if ((output != NULL)
+                          && (strlen (output) == length)
+                          && (strncmp (output, text, length) == 0)
+                          && (dxf_entity_get_id_code (entity) == TEST_FILE_WRITE_HANDLE (type)))
+                        {
+                                result = EXIT_SUCCESS;
+                        }
+                        dxf_entity_free (entity);
+                }
+        }
+        free (output);
+        free (input);
+        return (result);
+}
+
+
+/*!
+ * \brief Symbol table entries and block definitions every drawing has,
+ * as table name, entry name and the first AutoCAD version with the
+ * entry.
+ */
+static const struct
+{
+        const char *table;
+        const char *name;
+        int acad_version_number;
+} test_file_write_required[] =
+{
+        {"VPORT", "*ACTIVE", 0},
+        {"LTYPE", "BYBLOCK", AutoCAD_13},
+        {"LTYPE", "BYLAYER", AutoCAD_13},
+        {"LTYPE", "CONTINUOUS", 0},
+        {"LAYER", "0", 0},
+        {"STYLE", "STANDARD", 0},
+        {"APPID", "ACAD", 0},
+        {"DIMSTYLE", "STANDARD", AutoCAD_13},
+        {"BLOCK_RECORD", "*Model_Space", AutoCAD_13},
+        {"BLOCK_RECORD", "*Paper_Space", AutoCAD_13},
+        {"BLOCK", "*Model_Space", AutoCAD_13},
+        {"BLOCK", "*Paper_Space", AutoCAD_13}
+};
+
+
+/*!
+ * \brief Check a written drawing the way a DXF reader sees it, group by
+ * group, without the readers of the library.
+ *
+ * Every group has a numeric group code, the sections and symbol tables
+ * are terminated, each symbol table has as many entries as its count
+ * (group code 70), no value is \c (null), every handle is unique and
+ * below \c $HANDSEED, and the drawing has the entries of
+ * \c test_file_write_required of its version once.
+ *
+ * \return \c EXIT_SUCCESS when the drawing is valid, or
+ * \c EXIT_FAILURE.
+ */
+static int
+test_file_write_check_groups
+(
+        const char *text,
+        int acad_version_number
+)
+{
+        const char *line;
+        const char *end;
+        char code_string[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        char previous_value[DXF_MAX_STRING_LENGTH] = "";
+        char table[DXF_MAX_STRING_LENGTH] = "";
+        char section[DXF_MAX_STRING_LENGTH] = "";
+        char entry[DXF_MAX_STRING_LENGTH] = "";
+        int found[sizeof (test_file_write_required) / sizeof (test_file_write_required[0])];
+        int handles[1024];
+        int number_of_handles = 0;
+        int table_count = -1;
+        int table_entries = 0;
+        int have_eof = FALSE;
+        int previous_code = -1;
+        int in_section = FALSE;
+        long hand_seed = 0;
+        long code;
+        size_t length;
+        size_t i;
+        size_t j;
+        char *tail;
+        int result = EXIT_SUCCESS;
+
+        memset (found, 0, sizeof (found));
+        line = text;
+        while ((*line != '\0') && (!have_eof))
+        {
+                /* The group code line. */
+                end = strchr (line, '\n');
+                length = (end == NULL) ? strlen (line) : (size_t) (end - line);
+                if ((end == NULL) || (length >= DXF_MAX_STRING_LENGTH))
+                {
+                        fprintf (stderr, "test_file_write: a group code line is not terminated.\n");
+                        return (EXIT_FAILURE);
+                }
+                memcpy (code_string, line, length);
+                code_string[length] = '\0';
+                code = strtol (code_string, &tail, 10);
+                if ((tail == code_string) || (*tail != '\0'))
+                {
+                        fprintf (stderr, "test_file_write: \"%s\" is not a group code.\n", code_string);
+                        return (EXIT_FAILURE);
+                }
+                /* The value line. */
+                line = end + 1;
+                end = strchr (line, '\n');
+                length = (end == NULL) ? strlen (line) : (size_t) (end - line);
+                if ((end == NULL) || (length >= DXF_MAX_STRING_LENGTH))
+                {
+                        fprintf (stderr, "test_file_write: the value of a %ld group is not terminated.\n", code);
+                        return (EXIT_FAILURE);
+                }
+                memcpy (value, line, length);
+                value[length] = '\0';
+                line = end + 1;
+                if (strcmp (value, "(null)") == 0)
+                {
+                        fprintf (stderr, "test_file_write: the %ld group following %s has no value.\n", code, previous_value);
+                        result = EXIT_FAILURE;
+                }
+                if ((previous_code == 9) && (strcmp (previous_value, "$HANDSEED") == 0))
+                {
+                        hand_seed = strtol (value, NULL, 16);
+                }
+                else if (((code == 5) || (code == 105))
+                  && (number_of_handles < 1024))
+                {
+                        handles[number_of_handles++] = (int) strtol (value, NULL, 16);
+                }
+                if (code == 0)
+                {
+                        if (strcmp (value, "SECTION") == 0)
+                        {
+                                if (in_section)
+                                {
+                                        fprintf (stderr, "test_file_write: the %s section is not terminated.\n", section);
+                                        result = EXIT_FAILURE;
+                                }
+                                in_section = TRUE;
+                                section[0] = '\0';
+                        }
+                        else if (strcmp (value, "ENDSEC") == 0)
+                        {
+                                if (!in_section)
+                                {
+                                        fprintf (stderr, "test_file_write: ENDSEC outside a section.\n");
+                                        result = EXIT_FAILURE;
+                                }
+                                in_section = FALSE;
+                        }
+                        else if (strcmp (value, "TABLE") == 0)
+                        {
+                                table[0] = '\0';
+                                table_count = -1;
+                                table_entries = 0;
+                        }
+                        else if (strcmp (value, "ENDTAB") == 0)
+                        {
+                                if (table_entries != table_count)
+                                {
+                                        fprintf (stderr, "test_file_write: the %s table has %d entries, not %d.\n",
+                                          table, table_entries, table_count);
+                                        result = EXIT_FAILURE;
+                                }
+                                table[0] = '\0';
+                        }
+                        else if (strcmp (value, "EOF") == 0)
+                        {
+                                have_eof = TRUE;
+                        }
+                        else if ((strcmp (section, "TABLES") == 0)
+                          && (strcmp (table, value) == 0))
+                        {
+                                table_entries++;
+                        }
+                        else if ((strcmp (section, "TABLES") == 0)
+                          && (table[0] != '\0'))
+                        {
+                                fprintf (stderr, "test_file_write: a %s in the %s table.\n", value, table);
+                                result = EXIT_FAILURE;
+                        }
+                        snprintf (entry, sizeof (entry), "%s", value);
+                }
+                else if ((code == 2)
+                  && (previous_code == 0)
+                  && (strcmp (previous_value, "SECTION") == 0))
+                {
+                        snprintf (section, sizeof (section), "%s", value);
+                }
+                else if ((code == 2)
+                  && (strcmp (entry, "TABLE") == 0)
+                  && (table[0] == '\0'))
+                {
+                        snprintf (table, sizeof (table), "%s", value);
+                }
+                else if ((code == 70)
+                  && (strcmp (entry, "TABLE") == 0)
+                  && (table_count < 0))
+                {
+                        table_count = atoi (value);
+                }
+                else if (code == 2)
+                {
+                        for (i = 0; i < sizeof (test_file_write_required) / sizeof (test_file_write_required[0]); i++)
+                        {
+                                if ((strcmp (test_file_write_required[i].table, entry) == 0)
+                                  && (strcmp (test_file_write_required[i].name, value) == 0))
+                                {
+                                        found[i]++;
+                                }
+                        }
+                }
+                previous_code = (int) code;
+                snprintf (previous_value, sizeof (previous_value), "%s", value);
+        }
+        if ((!have_eof) || (in_section) || (*line != '\0'))
+        {
+                fprintf (stderr, "test_file_write: the drawing does not end with EOF.\n");
+                result = EXIT_FAILURE;
+        }
+        for (i = 0; i < sizeof (test_file_write_required) / sizeof (test_file_write_required[0]); i++)
+        {
+                if ((acad_version_number >= test_file_write_required[i].acad_version_number)
+                  && (found[i] != 1))
+                {
+                        fprintf (stderr, "test_file_write: the %s %s is written %d times.\n",
+                          test_file_write_required[i].table, test_file_write_required[i].name, found[i]);
+                        result = EXIT_FAILURE;
+                }
+        }
+        for (i = 0; i < (size_t) number_of_handles; i++)
+        {
+                if (handles[i] >= hand_seed)
+                {
+                        fprintf (stderr, "test_file_write: the handle %X is not below $HANDSEED %lX.\n",
+                          handles[i], hand_seed);
+                        result = EXIT_FAILURE;
+                }
+                for (j = i + 1; j < (size_t) number_of_handles; j++)
+                {
+                        if (handles[i] == handles[j])
+                        {
+                                fprintf (stderr, "test_file_write: the handle %X is written twice.\n", handles[i]);
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+        return (result);
+}
+
+
+int
+main (void)
+{
+        const DxfEntityVtable *vtable;
+        DxfDrawing *drawing = NULL;
+        DxfHeader *header = NULL;
+        DxfBlock *block = NULL;
+        DxfFile fp;
+        DxfEntityType type;
+        void *entity;
+        char *text = NULL;
+        char *hand_seed = NULL;
+        const char *section;
+        const char *next;
+        char name[DXF_MAX_STRING_LENGTH];
+        int found[DXF_NUMBER_OF_ENTITY_TYPES];
+        int next_handle;
+        size_t size = 0;
+        size_t length;
+        int i;
+        int result = EXIT_SUCCESS;
+
+        /* A drawing which does not terminate fails instead of hanging
+         * the test suite. */
+        alarm (60);
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        if (drawing == NULL)
+        {
+                fprintf (stderr, "test_file_write: could not create a drawing.\n");
+                return (EXIT_FAILURE);
+        }
+        memset (found, 0, sizeof (found));
+        for (i = 1; i < DXF_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                vtable = dxf_entity_get_vtable ((DxfEntityType) i);
+                if ((vtable == NULL) || (vtable->read == NULL))
+                {
+                        continue;
+                }
+                entity = dxf_entity_init (dxf_entity_new ((DxfEntityType) i));
+                if (entity == NULL)
+                {
+                        fprintf (stderr, "test_file_write: could not create a %s.\n",
+                          dxf_tracing_entity_name ((DxfEntityType) i));
+                        return (EXIT_FAILURE);
+                }
+                test_file_write_fill ((DxfEntityType) i, entity);
+                dxf_entity_set_id_code (entity, TEST_FILE_WRITE_HANDLE (i));
+                dxf_entities_append ((DxfEntities *) drawing->entities_list, entity);
+                found[i] = -1;
+        }
+        /* A block definition, its end of block marker shares a handle
+         * with an entity. */
+        block = dxf_block_init (dxf_block_new ());
+        dxf_block_set_block_name (block, dxf_strdup ("TEST"));
+        dxf_block_set_id_code (block, 0x20);
+        ((DxfEndblk *) block->endblk)->id_code = TEST_FILE_WRITE_HANDLE (LINE);
+        block->next = drawing->block_list;
+        drawing->block_list = (struct DxfBlock *) block;
+        if (dxf_file_validate_handles (NULL, drawing, NULL) != EXIT_FAILURE)
+        {
+                fprintf (stderr, "test_file_write: the handle of an end of block marker was not validated.\n");
+                result = EXIT_FAILURE;
+        }
+        ((DxfEndblk *) block->endblk)->id_code = 0x21;
+        /* The handle seed is below the handles in use, validating and
+         * writing do not change it. */
+        header = (DxfHeader *) drawing->header;
+        dxf_free (header->HandSeed);
+        header->HandSeed = dxf_strdup ("22");
+        hand_seed = header->HandSeed;
+        if ((dxf_file_validate_handles (NULL, drawing, &next_handle) != EXIT_SUCCESS)
+          || (next_handle != TEST_FILE_WRITE_HANDLE (DXF_NUMBER_OF_ENTITY_TYPES - 1) + 1))
+        {
+                fprintf (stderr, "test_file_write: wrong next free handle.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Write the drawing. */
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.fp = open_memstream (&text, &size);
+        fp.filename = (char *) "test";
+        fp.acad_version_number = AutoCAD_2000;
+        if ((fp.fp == NULL)
+          || (dxf_file_write (&fp, drawing) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_file_write: could not write the drawing.\n");
+                result = EXIT_FAILURE;
+        }
+        if (fp.fp != NULL)
+        {
+                fclose (fp.fp);
+        }
+        if ((header->HandSeed != hand_seed)
+          || (strcmp (header->HandSeed, "22") != 0))
+        {
+                fprintf (stderr, "test_file_write: writing changed the handle seed of the drawing.\n");
+                result = EXIT_FAILURE;
+        }
+        if ((text == NULL)
+          || (size < 8)
+          || (strcmp (text + size - 8, "  0\nEOF\n") != 0))
+        {
+                fprintf (stderr, "test_file_write: the drawing was not written completely.\n");
+                dxf_drawing_free (drawing);
+                free (text);
+                return (EXIT_FAILURE);
+        }
+        /* Read every entity of the ENTITIES section back. */
+        section = strstr (text, "  0\nSECTION\n  2\nENTITIES\n");
+        if (section == NULL)
+        {
+                fprintf (stderr, "test_file_write: the ENTITIES section was not written.\n");
+                dxf_drawing_free (drawing);
+                free (text);
+                return (EXIT_FAILURE);
+        }
+        section = strstr (section + 1, "  0\n");
+        while ((section != NULL)
+          && (sscanf (section, "  0\n%[^\n]", name) == 1)
+          && (strcmp (name, "ENDSEC") != 0))
+        {
+                next = strstr (section + 1, "\n  0\n");
+                if (next == NULL)
+                {
+                        break;
+                }
+                next++;
+                type = dxf_tracing_entity_type (name);
+                /* The vertices of a polyline are read with it. */
+                while ((type == POLYLINE)
+                  && (next != NULL)
+                  && ((strncmp (next, "  0\nVERTEX\n", 11) == 0)
+                  || (strncmp (next, "  0\nSEQEND\n", 11) == 0)))
+                {
+                        next = strstr (next + 1, "\n  0\n");
+                        if (next != NULL)
+                        {
+                                next++;
+                        }
+                }
+                if (next == NULL)
+                {
+                        break;
+                }
+                length = (size_t) (next - section);
+                if ((type == UNKNOWN_ENTITY) || (found[type] == 0))
+                {
+                        fprintf (stderr, "test_file_write: an unexpected %s was written.\n", name);
+                        result = EXIT_FAILURE;
+                }
+                else if (test_file_write_read_back (type, section, length) != EXIT_SUCCESS)
+                {
+                        fprintf (stderr, "test_file_write: the %s does not write the same after reading it back.\n", name);
+                        result = EXIT_FAILURE;
+                }
+                else
+                {
+                        found[type] = 1;
+                }
+                section = next;
+        }
+        for (i = 1; i < DXF_NUMBER_OF_ENTITY_TYPES; i++)
+        {
+                if (found[i] < 0)
+                {
+                        fprintf (stderr, "test_file_write: the %s was not written.\n",
+                          dxf_tracing_entity_name ((DxfEntityType) i));
+                        result = EXIT_FAILURE;
+                }
+        }
+        if (test_file_write_check_groups (text, AutoCAD_2000) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_file_write: the drawing is not valid.\n");
+                result = EXIT_FAILURE;
+        }
+        dxf_drawing_free (drawing);
+        free (text);
+        text = NULL;
+        /* Empty drawings get the default symbol table entries, except
+         * the entries they have. */
+        for (i = 0; i < 3; i++)
+        {
+                static const int versions[3] = {AutoCAD_12, AutoCAD_14, AutoCAD_2010};
+                DxfLayer *layer;
+
+                drawing = dxf_drawing_init (dxf_drawing_new (), versions[i]);
+                if (i == 1)
+                {
+                        layer = dxf_layer_init (dxf_layer_new ());
+                        dxf_layer_set_layer_name (layer, (char *) DXF_DEFAULT_LAYER);
+                        dxf_layer_set_id_code (layer, 0x10);
+                        ((DxfTables *) drawing->tables_list)->layers = (struct DxfLayer *) layer;
+                }
+                memset (&fp, 0, sizeof (DxfFile));
+                fp.fp = open_memstream (&text, &size);
+                fp.filename = (char *) "test";
+                fp.acad_version_number = versions[i];
+                if ((fp.fp == NULL)
+                  || (dxf_file_write (&fp, drawing) != EXIT_SUCCESS))
+                {
+                        fprintf (stderr, "test_file_write: could not write an empty drawing.\n");
+                        result = EXIT_FAILURE;
+                }
+                if (fp.fp != NULL)
+                {
+                        fclose (fp.fp);
+                }
+                if ((text == NULL)
+                  || (test_file_write_check_groups (text, versions[i]) != EXIT_SUCCESS))
+                {
+                        fprintf (stderr, "test_file_write: the empty %s drawing is not valid.\n",
+                          dxf_header_acad_version_to_string (versions[i]));
+                        result = EXIT_FAILURE;
+                }
+                dxf_drawing_free (drawing);
+                free (text);
+                text = NULL;
+        }
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,240 @@
+/*!
+ * \file test_hatch.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for reading and writing the boundary paths of
+ * a DXF hatch entity (\c HATCH).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "test_util.h"
+
+
+/*!
+ * \brief A \c HATCH with a closed polyline boundary path with bulges,
+ * and an edge boundary path of a line, an arc, a line and a spline.
+ */
+static const char *test_hatch_text =
+  "  0\nHATCH\n"
+  "  5\n2B\n"
+  "100\nAcDbEntity\n"
+  "  8\nHATCHES\n"
+  "100\nAcDbHatch\n"
+  " 10\n0.0\n 20\n0.0\n 30\n0.0\n"
+  "210\n0.0\n220\n0.0\n230\n1.0\n"
+  "  2\nSOLID\n"
+  " 70\n1\n"
+  " 71\n0\n"
+  " 91\n2\n"
+  " 92\n3\n"
+  " 72\n1\n"
+  " 73\n1\n"
+  " 93\n4\n"
+  " 10\n0.0\n 20\n0.0\n 42\n0.0\n"
+  " 10\n10.0\n 20\n0.0\n 42\n0.5\n"
+  " 10\n10.0\n 20\n10.0\n 42\n0.0\n"
+  " 10\n0.0\n 20\n10.0\n 42\n0.0\n"
+  " 97\n0\n"
+  " 92\n16\n"
+  " 93\n4\n"
+  " 72\n1\n"
+  " 10\n20.0\n 20\n0.0\n 11\n30.0\n 21\n0.0\n"
+  " 72\n2\n"
+  " 10\n30.0\n 20\n5.0\n 40\n5.0\n 50\n270.0\n 51\n90.0\n 73\n1\n"
+  " 72\n1\n"
+  " 10\n30.0\n 20\n10.0\n 11\n20.0\n 21\n10.0\n"
+  " 72\n4\n"
+  " 94\n3\n 73\n0\n 74\n0\n 95\n8\n 96\n4\n"
+  " 40\n0.0\n 40\n0.0\n 40\n0.0\n 40\n0.0\n"
+  " 40\n1.0\n 40\n1.0\n 40\n1.0\n 40\n1.0\n"
+  " 10\n20.0\n 20\n10.0\n 10\n18.0\n 20\n7.0\n"
+  " 10\n18.0\n 20\n3.0\n 10\n20.0\n 20\n0.0\n"
+  " 97\n0\n"
+  " 75\n0\n"
+  " 76\n1\n"
+  " 78\n0\n"
+  " 47\n1.0\n"
+  " 98\n0\n"
+  "  0\nEOF\n";
+
+
+/*!
+ * \brief Check the edges of the edge boundary path keep the order of
+ * the file: a line, an arc, a line and a spline.
+ */
+static int
+test_hatch_check_edges
+(
+        DxfHatchBoundaryPath *path
+)
+{
+        DxfHatchBoundaryPathEdge *edge;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+
+        if ((path == NULL) || (path->edges == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        edge = (DxfHatchBoundaryPathEdge *) path->edges;
+        if ((edge->lines == NULL) || (edge->arcs != NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        edge = (DxfHatchBoundaryPathEdge *) edge->next;
+        if ((edge == NULL) || (edge->arcs == NULL) || (edge->lines != NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        edge = (DxfHatchBoundaryPathEdge *) edge->next;
+        if ((edge == NULL) || (edge->lines == NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        line = (DxfHatchBoundaryPathEdgeLine *) edge->lines;
+        if ((line->x0 != 30.0) || (line->x1 != 20.0))
+        {
+                return (EXIT_FAILURE);
+        }
+        edge = (DxfHatchBoundaryPathEdge *) edge->next;
+        if ((edge == NULL) || (edge->splines == NULL) || (edge->next != NULL))
+        {
+                return (EXIT_FAILURE);
+        }
+        spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines;
+        if ((spline->number_of_knots != 8)
+          || (spline->number_of_control_points != 4))
+        {
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+int
+main (void)
+{
+        DxfFile fp;
+        DxfHatch *hatch = NULL;
+        DxfHatch *hatch_2 = NULL;
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        char *text = NULL;
+        char *text_2 = NULL;
+        int result = EXIT_SUCCESS;
+
+        /* Read a HATCH. */
+        if (test_util_open (&fp, test_hatch_text) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_hatch: could not open the HATCH text.\n");
+                return (EXIT_FAILURE);
+        }
+        hatch = dxf_hatch_read (&fp, NULL);
+        if (hatch == NULL)
+        {
+                fprintf (stderr, "test_hatch: could not read the HATCH.\n");
+                return (EXIT_FAILURE);
+        }
+        fclose (fp.fp);
+        path = (DxfHatchBoundaryPath *) hatch->paths;
+        if ((hatch->number_of_boundary_paths != 2)
+          || (path == NULL)
+          || (path->polylines == NULL))
+        {
+                fprintf (stderr, "test_hatch: wrong boundary paths read from the HATCH.\n");
+                return (EXIT_FAILURE);
+        }
+        polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+        if ((polyline->number_of_vertices != 4)
+          || (polyline->is_closed != 1))
+        {
+                fprintf (stderr, "test_hatch: wrong polyline read from the HATCH.\n");
+                result = EXIT_FAILURE;
+        }
+        if (test_hatch_check_edges ((DxfHatchBoundaryPath *) path->next) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_hatch: the edges read from the HATCH are not in the order of the file.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Write it, the bulge flag is written once for the polyline
+         * and its first vertex is not repeated. */
+        text = test_util_write (hatch, TRUE);
+        if ((text == NULL)
+          || (test_util_count_groups (text, " 92") != 2)
+          || (test_util_count_groups (text, " 72") != 5)
+          || (test_util_count_groups (text, " 42") != 4)
+          || (test_util_count_groups (text, " 97") != 2)
+          || (test_util_count_groups (text, " 10") != 1 + 4 + 3 + 4))
+        {
+                fprintf (stderr, "test_hatch: wrong boundary path groups written for the HATCH.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Read what was written, and write it again. */
+        if ((text != NULL)
+          && (test_util_open (&fp, text) == EXIT_SUCCESS))
+        {
+                hatch_2 = dxf_hatch_read (&fp, NULL);
+                if (hatch_2 != NULL)
+                {
+                        fclose (fp.fp);
+                        path = (DxfHatchBoundaryPath *) hatch_2->paths;
+                        if ((path == NULL)
+                          || (test_hatch_check_edges ((DxfHatchBoundaryPath *) path->next) != EXIT_SUCCESS))
+                        {
+                                fprintf (stderr, "test_hatch: the edges written for the HATCH are not in the order read.\n");
+                                result = EXIT_FAILURE;
+                        }
+                        text_2 = test_util_write (hatch_2, TRUE);
+                }
+                if ((text_2 == NULL)
+                  || (strcmp (text, text_2) != 0))
+                {
+                        fprintf (stderr, "test_hatch: the HATCH does not write the same after reading it back.\n");
+                        result = EXIT_FAILURE;
+                }
+        }
+        else
+        {
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        free (text);
+        free (text_2);
+        dxf_hatch_free (hatch);
+        if (hatch_2 != NULL)
+        {
+                dxf_hatch_free (hatch_2);
+        }
+        return (result);
+}
+
+
+/* EOF */
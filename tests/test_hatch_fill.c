@@ -0,0 +1,206 @@
+/*!
+ * \file test_hatch_fill.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the point queries and the pattern fill
+ * of a hatch region: a square with a square hole.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Make a closed square boundary path polyline.
+ */
+static DxfHatchBoundaryPathPolyline *
+test_hatch_fill_square
+(
+        double x0,
+        double y0,
+        double size
+)
+{
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathPolylineVertex *vertices;
+
+        polyline = dxf_hatch_boundary_path_polyline_init (dxf_hatch_boundary_path_polyline_new ());
+        if ((polyline == NULL)
+          || (dxf_hatch_boundary_path_polyline_allocate_vertices (polyline, 4) != EXIT_SUCCESS))
+        {
+                return (NULL);
+        }
+        vertices = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+        vertices[0].x0 = x0;
+        vertices[0].y0 = y0;
+        vertices[1].x0 = x0 + size;
+        vertices[1].y0 = y0;
+        vertices[2].x0 = x0 + size;
+        vertices[2].y0 = y0 + size;
+        vertices[3].x0 = x0;
+        vertices[3].y0 = y0 + size;
+        polyline->number_of_vertices = 4;
+        polyline->is_closed = 1;
+        return (polyline);
+}
+
+
+/*!
+ * \brief Check the fill of horizontal lines at y = 0.5, 1.5 .. 9.5 of
+ * the square from (0, 0) to (10, 10) with a hole from (3, 3) to (7, 7):
+ * the lines crossing the hole are split in two.
+ */
+static int
+test_hatch_fill_check
+(
+        DxfHatchFill *fill,
+        DxfHatchRegion *region
+)
+{
+        const double *segments;
+        size_t number_of_segments;
+        double length = 0.0;
+        size_t i;
+
+        number_of_segments = dxf_hatch_fill_get_number_of_segments (fill);
+        segments = dxf_hatch_fill_get_segments (fill);
+        if (number_of_segments != 6 + 2 * 4)
+        {
+                fprintf (stderr, "test_hatch_fill: %d segments instead of 14.\n", (int) number_of_segments);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_of_segments; i++)
+        {
+                length += fabs (segments[4 * i + 2] - segments[4 * i]);
+                if ((segments[4 * i + 1] != segments[4 * i + 3])
+                  || (dxf_hatch_region_point_inside (region,
+                    0.5 * (segments[4 * i] + segments[4 * i + 2]),
+                    segments[4 * i + 1]) != INSIDE))
+                {
+                        fprintf (stderr, "test_hatch_fill: segment %d is not inside the region.\n", (int) i);
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (fabs (length - (6 * 10.0 + 4 * 6.0)) > 1e-9)
+        {
+                fprintf (stderr, "test_hatch_fill: the segments are %g long instead of 84.\n", length);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+int
+main (void)
+{
+        static const double points[2 * 4] =
+        {
+                1.0, 1.0,
+                5.0, 5.0,
+                8.0, 5.0,
+                11.0, 5.0
+        };
+        static const int expected[4] = {INSIDE, OUTSIDE, INSIDE, OUTSIDE};
+        DxfHatchBoundaryPathPolyline *outer;
+        DxfHatchBoundaryPathPolyline *hole;
+        DxfHatchPatternDefLine *def_line;
+        DxfHatchRegion *region;
+        DxfHatchFill *fill;
+        int results[4];
+        int number_of_threads;
+        int i;
+        int result = EXIT_SUCCESS;
+
+        outer = test_hatch_fill_square (0.0, 0.0, 10.0);
+        hole = test_hatch_fill_square (3.0, 3.0, 4.0);
+        def_line = dxf_hatch_pattern_def_line_init (dxf_hatch_pattern_def_line_new ());
+        region = dxf_hatch_region_new (DXF_HATCH_REGION_DEFAULT_TOLERANCE);
+        fill = dxf_hatch_fill_new ();
+        if ((outer == NULL)
+          || (hole == NULL)
+          || (def_line == NULL)
+          || (region == NULL)
+          || (fill == NULL)
+          || (dxf_hatch_region_add_polyline (region, outer) != EXIT_SUCCESS)
+          || (dxf_hatch_region_add_polyline (region, hole) != EXIT_SUCCESS)
+          || (dxf_hatch_region_build (region) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_hatch_fill: could not make the region.\n");
+                return (EXIT_FAILURE);
+        }
+        /* Points in the square, in the hole and outside. */
+        if (dxf_hatch_region_classify (region, points, 4, results) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_hatch_fill: could not classify the points.\n");
+                result = EXIT_FAILURE;
+        }
+        else
+        {
+                for (i = 0; i < 4; i++)
+                {
+                        if ((results[i] != expected[i])
+                          || (dxf_hatch_region_point_inside (region, points[2 * i], points[2 * i + 1]) != expected[i]))
+                        {
+                                fprintf (stderr, "test_hatch_fill: point %d is classified wrong.\n", i);
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+        /* Solid horizontal lines, 1 apart, on one and on more threads. */
+        def_line->angle = 0.0;
+        def_line->x0 = 0.0;
+        def_line->y0 = 0.5;
+        def_line->x1 = 0.0;
+        def_line->y1 = 1.0;
+        for (number_of_threads = 1; number_of_threads <= 4; number_of_threads += 3)
+        {
+                dxf_hatch_fill_clear (fill);
+                if (dxf_hatch_fill_generate (fill, region, def_line, number_of_threads) != EXIT_SUCCESS)
+                {
+                        fprintf (stderr, "test_hatch_fill: could not fill the region.\n");
+                        result = EXIT_FAILURE;
+                }
+                else if (test_hatch_fill_check (fill, region) != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        /* Clean up. */
+        dxf_hatch_fill_free (fill);
+        dxf_hatch_region_free (region);
+        dxf_hatch_pattern_def_line_free (def_line);
+        dxf_hatch_boundary_path_polyline_free (outer);
+        dxf_hatch_boundary_path_polyline_free (hole);
+        return (result);
+}
+
+
+/* EOF */
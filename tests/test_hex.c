@@ -0,0 +1,166 @@
+/*!
+ * \file test_hex.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the conversion between bytes and the
+ * hexadecimal text of binary chunk groups.
+ *
+ * The results are compared with a conversion one character at a time,
+ * for lengths and offsets which take the SSE2 path, the remainder and
+ * both, so the SSE2 and the scalar conversion give the same result.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+#define TEST_HEX_MAX_SIZE 80
+        /*!< \brief Largest number of bytes converted. */
+
+#define TEST_HEX_MAX_OFFSET 4
+        /*!< \brief Number of offsets of the buffers, to convert
+         * unaligned data as well. */
+
+
+/*!
+ * \brief Convert bytes into upper case hexadecimal text one character
+ * at a time.
+ */
+static void
+test_hex_encode
+(
+        const unsigned char *bytes,
+        size_t size,
+        char *text
+)
+{
+        static const char digits[] = "0123456789ABCDEF";
+        size_t i;
+
+        for (i = 0; i < size; i++)
+        {
+                text[2 * i] = digits[bytes[i] >> 4];
+                text[2 * i + 1] = digits[bytes[i] & 0x0F];
+        }
+}
+
+
+int
+main (void)
+{
+        /* Characters next to the ranges of the digits and letters. */
+        static const char invalid[] = {'/', ':', '@', 'G', '`', 'g', ' ', '\0', (char) 0x80, (char) 0xC6};
+        unsigned char bytes[TEST_HEX_MAX_SIZE + TEST_HEX_MAX_OFFSET];
+        unsigned char decoded[TEST_HEX_MAX_SIZE + TEST_HEX_MAX_OFFSET];
+        char text[2 * (TEST_HEX_MAX_SIZE + TEST_HEX_MAX_OFFSET)];
+        char expected[2 * TEST_HEX_MAX_SIZE];
+        size_t offset;
+        size_t size;
+        size_t i;
+        size_t j;
+        int result = EXIT_SUCCESS;
+
+        for (i = 0; i < sizeof (bytes); i++)
+        {
+                bytes[i] = (unsigned char) (i * 37 + 11);
+        }
+        /* All byte values, with a remainder. */
+        for (i = 0; i < 256; i++)
+        {
+                decoded[i % TEST_HEX_MAX_SIZE] = (unsigned char) i;
+                if ((i % TEST_HEX_MAX_SIZE) == TEST_HEX_MAX_SIZE - 1)
+                {
+                        test_hex_encode (decoded, TEST_HEX_MAX_SIZE, expected);
+                        if ((dxf_hex_encode (decoded, TEST_HEX_MAX_SIZE, text) != EXIT_SUCCESS)
+                          || (memcmp (text, expected, 2 * TEST_HEX_MAX_SIZE) != 0))
+                        {
+                                fprintf (stderr, "test_hex: wrong text for bytes up to %d.\n", (int) i);
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+        for (offset = 0; offset < TEST_HEX_MAX_OFFSET; offset++)
+        {
+                for (size = 0; size <= TEST_HEX_MAX_SIZE; size++)
+                {
+                        test_hex_encode (bytes + offset, size, expected);
+                        memset (text, 0, sizeof (text));
+                        if ((dxf_hex_encode (bytes + offset, size, text + offset) != EXIT_SUCCESS)
+                          || (memcmp (text + offset, expected, 2 * size) != 0))
+                        {
+                                fprintf (stderr, "test_hex: wrong text for %d bytes at offset %d.\n",
+                                  (int) size, (int) offset);
+                                result = EXIT_FAILURE;
+                        }
+                        /* Lower case digits are read as well. */
+                        for (i = 0; i < 2 * size; i += 3)
+                        {
+                                if ((text[offset + i] >= 'A') && (text[offset + i] <= 'F'))
+                                {
+                                        text[offset + i] += 'a' - 'A';
+                                }
+                        }
+                        memset (decoded, 0, sizeof (decoded));
+                        if ((dxf_hex_decode (text + offset, 2 * size, decoded + offset) != EXIT_SUCCESS)
+                          || (memcmp (decoded + offset, bytes + offset, size) != 0))
+                        {
+                                fprintf (stderr, "test_hex: wrong bytes for %d bytes at offset %d.\n",
+                                  (int) size, (int) offset);
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+        /* A character which is not a digit is found at any position. */
+        test_hex_encode (bytes, TEST_HEX_MAX_SIZE, text);
+        for (i = 0; i < 2 * TEST_HEX_MAX_SIZE; i++)
+        {
+                for (j = 0; j < sizeof (invalid); j++)
+                {
+                        memcpy (expected, text, 2 * TEST_HEX_MAX_SIZE);
+                        expected[i] = invalid[j];
+                        if (dxf_hex_decode (expected, 2 * TEST_HEX_MAX_SIZE, decoded) == EXIT_SUCCESS)
+                        {
+                                fprintf (stderr, "test_hex: character 0x%02X at position %d was decoded.\n",
+                                  (unsigned char) invalid[j], (int) i);
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+        if (dxf_hex_decode (text, 2 * TEST_HEX_MAX_SIZE - 1, decoded) == EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_hex: an odd number of digits was decoded.\n");
+                result = EXIT_FAILURE;
+        }
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,218 @@
+/*!
+ * \file test_nurbs.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the evaluation of NURBS curves against
+ * reference points, knot insertion and fit point interpolation.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include "includes.h"
+
+
+#define TEST_NURBS_NUMBER_OF_SAMPLES 101
+        /*!< \brief Number of parameters a curve is sampled at. */
+
+
+/*!
+ * \brief Check the points of a curve at parameters against reference
+ * points.
+ */
+static int
+test_nurbs_check_points
+(
+        DxfNurbs *nurbs,
+        const double *parameters,
+        const double *expected,
+        size_t number_of_points,
+        double tolerance,
+        const char *what
+)
+{
+        double points[3 * TEST_NURBS_NUMBER_OF_SAMPLES];
+        size_t i;
+
+        if (dxf_nurbs_evaluate (nurbs, parameters, number_of_points, points) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_nurbs: could not evaluate the %s.\n", what);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < 3 * number_of_points; i++)
+        {
+                if (fabs (points[i] - expected[i]) > tolerance)
+                {
+                        fprintf (stderr, "test_nurbs: point %d of the %s is %g instead of %g.\n",
+                          (int) (i / 3), what, points[i], expected[i]);
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+int
+main (void)
+{
+        /* A cubic Bezier curve, and its points at u = 0.25 and 0.5. */
+        static const double bezier[3 * 4] =
+        {
+                0.0, 0.0, 0.0,
+                1.0, 2.0, 0.0,
+                3.0, 2.0, 0.0,
+                4.0, 0.0, 0.0
+        };
+        static const double bezier_parameters[2] = {0.25, 0.5};
+        static const double bezier_points[3 * 2] =
+        {
+                0.90625, 1.125, 0.0,
+                2.0, 1.5, 0.0
+        };
+        /* A quarter of the unit circle as a rational quadratic curve. */
+        static const double quarter[3 * 3] =
+        {
+                1.0, 0.0, 0.0,
+                1.0, 1.0, 0.0,
+                0.0, 1.0, 0.0
+        };
+        const double quarter_weights[3] = {1.0, M_SQRT1_2, 1.0};
+        /* A rational cubic curve with two interior knots. */
+        static const double curve[3 * 6] =
+        {
+                0.0, 0.0, 0.0,
+                1.0, 3.0, 1.0,
+                3.0, 4.0, -1.0,
+                5.0, 1.0, 2.0,
+                7.0, 2.0, 0.0,
+                8.0, 5.0, 1.0
+        };
+        static const double curve_weights[6] = {1.0, 2.0, 0.5, 1.0, 3.0, 1.0};
+        static const double curve_knots[6 + 4] = {0.0, 0.0, 0.0, 0.0, 0.3, 0.6, 1.0, 1.0, 1.0, 1.0};
+        static const double fit_points[3 * 5] =
+        {
+                0.0, 0.0, 0.0,
+                1.0, 2.0, 0.5,
+                4.0, 2.5, 1.0,
+                6.0, -1.0, 0.0,
+                9.0, 0.0, 2.0
+        };
+        double parameters[TEST_NURBS_NUMBER_OF_SAMPLES];
+        double expected[3 * TEST_NURBS_NUMBER_OF_SAMPLES];
+        DxfNurbs *nurbs;
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        nurbs = dxf_nurbs_new ();
+        if (nurbs == NULL)
+        {
+                fprintf (stderr, "test_nurbs: could not make a NURBS curve.\n");
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < TEST_NURBS_NUMBER_OF_SAMPLES; i++)
+        {
+                parameters[i] = (double) i / (TEST_NURBS_NUMBER_OF_SAMPLES - 1);
+        }
+        /* Reference points of a Bezier curve. */
+        if ((dxf_nurbs_set (nurbs, 3, 4, bezier, NULL, NULL) != EXIT_SUCCESS)
+          || (test_nurbs_check_points (nurbs, bezier_parameters, bezier_points, 2, 1e-12, "Bezier curve") != EXIT_SUCCESS))
+        {
+                result = EXIT_FAILURE;
+        }
+        /* Every point of the rational quarter circle is on the unit
+         * circle, the middle one at 45 degrees. */
+        if (dxf_nurbs_set (nurbs, 2, 3, quarter, quarter_weights, NULL) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_nurbs: could not set the quarter circle.\n");
+                result = EXIT_FAILURE;
+        }
+        else
+        {
+                dxf_nurbs_evaluate (nurbs, parameters, TEST_NURBS_NUMBER_OF_SAMPLES, expected);
+                for (i = 0; i < TEST_NURBS_NUMBER_OF_SAMPLES; i++)
+                {
+                        if (fabs (hypot (expected[3 * i], expected[3 * i + 1]) - 1.0) > 1e-12)
+                        {
+                                fprintf (stderr, "test_nurbs: point %d of the quarter circle is not on the circle.\n", (int) i);
+                                result = EXIT_FAILURE;
+                                break;
+                        }
+                }
+                if ((fabs (expected[3 * 50] - M_SQRT1_2) > 1e-12)
+                  || (fabs (expected[3 * 50 + 1] - M_SQRT1_2) > 1e-12))
+                {
+                        fprintf (stderr, "test_nurbs: the middle of the quarter circle is not at 45 degrees.\n");
+                        result = EXIT_FAILURE;
+                }
+        }
+        /* Inserting knots adds control points, the shape is kept. */
+        if ((dxf_nurbs_set (nurbs, 3, 6, curve, curve_weights, curve_knots) != EXIT_SUCCESS)
+          || (dxf_nurbs_evaluate (nurbs, parameters, TEST_NURBS_NUMBER_OF_SAMPLES, expected) != EXIT_SUCCESS)
+          || (dxf_nurbs_insert_knot (nurbs, 0.45, 2) != EXIT_SUCCESS)
+          || (dxf_nurbs_insert_knot (nurbs, 0.3, 1) != EXIT_SUCCESS)
+          || (nurbs->number_of_control_points != 9))
+        {
+                fprintf (stderr, "test_nurbs: could not insert the knots.\n");
+                result = EXIT_FAILURE;
+        }
+        else if (test_nurbs_check_points (nurbs, parameters, expected, TEST_NURBS_NUMBER_OF_SAMPLES, 1e-12, "curve with inserted knots") != EXIT_SUCCESS)
+        {
+                result = EXIT_FAILURE;
+        }
+        /* A knot can not be inserted beyond the degree. */
+        if (dxf_nurbs_insert_knot (nurbs, 0.45, 2) == EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_nurbs: a knot was inserted more than the degree.\n");
+                result = EXIT_FAILURE;
+        }
+        /* The interpolating curve passes through fit point j at knot
+         * j + 3. */
+        if (dxf_nurbs_interpolate (nurbs, fit_points, 5, NULL, NULL) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_nurbs: could not interpolate the fit points.\n");
+                result = EXIT_FAILURE;
+        }
+        else
+        {
+                for (i = 0; i < 5; i++)
+                {
+                        parameters[i] = nurbs->knots[i + 3];
+                }
+                if (test_nurbs_check_points (nurbs, parameters, fit_points, 5, 1e-9, "interpolating curve") != EXIT_SUCCESS)
+                {
+                        result = EXIT_FAILURE;
+                }
+        }
+        /* Clean up. */
+        dxf_nurbs_free (nurbs);
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,286 @@
+/*!
+ * \file test_paged_entities.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for loading a DXF file into a drawing with
+ * out-of-core (paged) storage of its entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "includes.h"
+
+
+/*!
+ * \brief A drawing with six plain entities which can be paged, a
+ * \c LINE with a thickness and an entity of an unknown type which can
+ * not.
+ */
+static const char *test_paged_entities_text =
+  "  0\nSECTION\n"
+  "  2\nHEADER\n"
+  "  9\n$ACADVER\n"
+  "  1\nAC1015\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n"
+  "  2\nCLASSES\n"
+  "  0\nCLASS\n"
+  "  1\nACDBDICTIONARYWDFLT\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n"
+  "  2\nENTITIES\n"
+  "  0\nLINE\n"
+  "  5\n10\n"
+  "100\nAcDbEntity\n"
+  "  8\nWALLS\n"
+  "100\nAcDbLine\n"
+  " 10\n1.0\n 20\n2.0\n 30\n0.0\n"
+  " 11\n3.0\n 21\n4.0\n 31\n0.0\n"
+  "  0\nLINE\n"
+  "  5\n11\n"
+  "100\nAcDbEntity\n"
+  "  8\nWALLS\n"
+  "100\nAcDbLine\n"
+  " 39\n2.5\n"
+  " 10\n5.0\n 20\n6.0\n 30\n0.0\n"
+  " 11\n7.0\n 21\n8.0\n 31\n0.0\n"
+  "  0\nCIRCLE\n"
+  "  5\n12\n"
+  "100\nAcDbEntity\n"
+  "  8\n0\n"
+  "100\nAcDbCircle\n"
+  " 10\n1.0\n 20\n1.0\n 30\n0.0\n"
+  " 40\n0.5\n"
+  "  0\nFROBNICATOR\n"
+  "  5\n13\n"
+  "  8\n0\n"
+  "  0\nARC\n"
+  "  5\n14\n"
+  "100\nAcDbEntity\n"
+  "  8\n0\n"
+  "100\nAcDbCircle\n"
+  " 10\n2.0\n 20\n2.0\n 30\n0.0\n"
+  " 40\n1.5\n"
+  "100\nAcDbArc\n"
+  " 50\n0.0\n"
+  " 51\n90.0\n"
+  "  0\nTEXT\n"
+  "  5\n15\n"
+  "100\nAcDbEntity\n"
+  "  8\n0\n"
+  "100\nAcDbText\n"
+  " 10\n0.0\n 20\n0.0\n 30\n0.0\n"
+  " 40\n1.0\n"
+  "  1\nLABEL\n"
+  " 41\n1.0\n"
+  "  7\nSTANDARD\n"
+  "100\nAcDbText\n"
+  "  0\nPOINT\n"
+  "  5\n16\n"
+  "100\nAcDbEntity\n"
+  "  8\n0\n"
+  "100\nAcDbPoint\n"
+  " 10\n9.0\n 20\n9.0\n 30\n0.0\n"
+  "  0\nLWPOLYLINE\n"
+  "  5\n17\n"
+  "100\nAcDbEntity\n"
+  "  8\nWALLS\n"
+  "100\nAcDbPolyline\n"
+  " 90\n3\n"
+  " 70\n1\n"
+  " 10\n0.0\n 20\n0.0\n"
+  " 10\n4.0\n 20\n0.0\n"
+  " 42\n0.5\n"
+  " 10\n4.0\n 20\n3.0\n"
+  "  0\nENDSEC\n"
+  "  0\nEOF\n";
+
+
+/*!
+ * \brief Make an empty temporary file, \c filename is a \c mkstemp ()
+ * template.
+ */
+static int
+test_paged_entities_temporary_file
+(
+        char *filename
+)
+{
+        int fd;
+
+        fd = mkstemp (filename);
+        if (fd < 0)
+        {
+                return (EXIT_FAILURE);
+        }
+        close (fd);
+        return (EXIT_SUCCESS);
+}
+
+
+int
+main (void)
+{
+        char filename[] = "/tmp/test_paged_entities_XXXXXX";
+        char filename_2[] = "/tmp/test_paged_entities_XXXXXX";
+        DxfDrawing *drawing = NULL;
+        DxfDrawing *drawing_2 = NULL;
+        DxfPagedEntities *paged;
+        DxfEntities *entities;
+        DxfLine *line;
+        DxfText *text;
+        DxfLWPolyline *lwpolyline;
+        DxfVertex *vertex;
+        FILE *file;
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        if ((test_paged_entities_temporary_file (filename) != EXIT_SUCCESS)
+          || (test_paged_entities_temporary_file (filename_2) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_paged_entities: could not make a temporary file.\n");
+                return (EXIT_FAILURE);
+        }
+        file = fopen (filename, "w");
+        if (file == NULL)
+        {
+                fprintf (stderr, "test_paged_entities: could not write the drawing.\n");
+                return (EXIT_FAILURE);
+        }
+        fputs (test_paged_entities_text, file);
+        fclose (file);
+        /* Load the drawing with a paged storage, only the plain entities
+         * are paged. */
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_14);
+        paged = dxf_paged_entities_new (NULL, 0, 0);
+        if ((drawing == NULL) || (paged == NULL))
+        {
+                fprintf (stderr, "test_paged_entities: could not make a drawing.\n");
+                return (EXIT_FAILURE);
+        }
+        dxf_drawing_set_paged_entities (drawing, paged);
+        if (dxf_file_load (filename, drawing) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_paged_entities: could not load the drawing.\n");
+                result = EXIT_FAILURE;
+        }
+        entities = (DxfEntities *) drawing->entities_list;
+        if ((dxf_paged_entities_get_number_of_entities (paged) != 6)
+          || (dxf_entities_get_number_of_entities (entities) != 2))
+        {
+                fprintf (stderr, "test_paged_entities: wrong number of paged or in-memory entities.\n");
+                result = EXIT_FAILURE;
+        }
+        if (strcmp (((DxfHeader *) drawing->header)->AcadVer, "AC1015") != 0)
+        {
+                fprintf (stderr, "test_paged_entities: the version was not read from the header.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Save it and load it back without a paged storage. */
+        if (dxf_file_save (filename_2, drawing, AutoCAD_2000, 1) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_paged_entities: could not save the drawing.\n");
+                result = EXIT_FAILURE;
+        }
+        drawing_2 = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        if ((drawing_2 == NULL)
+          || (dxf_file_load (filename_2, drawing_2) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_paged_entities: could not load the saved drawing.\n");
+                return (EXIT_FAILURE);
+        }
+        entities = (DxfEntities *) drawing_2->entities_list;
+        if (dxf_entities_get_number_of_entities (entities) != 8)
+        {
+                fprintf (stderr, "test_paged_entities: wrong number of entities in the saved drawing.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Paged entities and entities kept in memory keep the order of
+         * the loaded file. */
+        for (i = 0; i < dxf_entities_get_number_of_entities (entities); i++)
+        {
+                if (dxf_entity_get_id_code (dxf_entities_get_entity (entities, i)) != 0x10 + (int) i)
+                {
+                        fprintf (stderr, "test_paged_entities: entity %d is out of order.\n", (int) i);
+                        result = EXIT_FAILURE;
+                }
+        }
+        line = (DxfLine *) dxf_entities_get_entity (entities, 0);
+        if ((line == NULL)
+          || (dxf_entity_get_type (line) != LINE)
+          || (strcmp (line->layer, "WALLS") != 0)
+          || (line->p1->y0 != 4.0))
+        {
+                fprintf (stderr, "test_paged_entities: the paged LINE was not saved.\n");
+                result = EXIT_FAILURE;
+        }
+        line = (DxfLine *) dxf_entities_get_entity (entities, 1);
+        if ((line == NULL)
+          || (dxf_entity_get_type (line) != LINE)
+          || (line->thickness != 2.5))
+        {
+                fprintf (stderr, "test_paged_entities: the LINE with a thickness was not saved.\n");
+                result = EXIT_FAILURE;
+        }
+        text = (DxfText *) dxf_entities_get_entity (entities, 5);
+        if ((text == NULL)
+          || (dxf_entity_get_type (text) != TEXT)
+          || (strcmp (text->text_value, "LABEL") != 0)
+          || (text->height != 1.0))
+        {
+                fprintf (stderr, "test_paged_entities: the paged TEXT was not saved.\n");
+                result = EXIT_FAILURE;
+        }
+        lwpolyline = (DxfLWPolyline *) dxf_entities_get_entity (entities, 7);
+        vertex = ((lwpolyline != NULL) && (dxf_entity_get_type (lwpolyline) == LWPOLYLINE))
+          ? (DxfVertex *) lwpolyline->vertices
+          : NULL;
+        if ((vertex == NULL)
+          || (lwpolyline->number_vertices != 3)
+          || (lwpolyline->flag != 1)
+          || (strcmp (lwpolyline->layer, "WALLS") != 0)
+          || (vertex->next == NULL)
+          || (((DxfVertex *) vertex->next)->x0 != 4.0)
+          || (((DxfVertex *) vertex->next)->bulge != 0.5))
+        {
+                fprintf (stderr, "test_paged_entities: the paged LWPOLYLINE was not saved.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        unlink (filename);
+        unlink (filename_2);
+        dxf_drawing_free (drawing);
+        dxf_drawing_free (drawing_2);
+        return (result);
+}
+
+
+/* EOF */
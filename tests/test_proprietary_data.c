@@ -0,0 +1,209 @@
+/*!
+ * \file test_proprietary_data.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for loading the proprietary data of a DXF
+ * 3D solid entity (\c 3DSOLID) on first access.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "includes.h"
+
+
+/*!
+ * \brief A \c 3DSOLID with several groups of proprietary data and
+ * additional proprietary data.
+ */
+static const char *test_proprietary_data_text =
+  "  0\n3DSOLID\n"
+  "  5\n2C\n"
+  "  8\nSOLIDS\n"
+  "100\nAcDbModelerGeometry\n"
+  " 70\n1\n"
+  "  1\nfirst line\n"
+  "  1\nsecond line\n"
+  "  3\nan additional line\n"
+  "  1\nthird line\n"
+  "  0\nEOF\n";
+
+
+/*!
+ * \brief Read the \c 3DSOLID from \c filename, with the proprietary
+ * data loaded on first access when \c lazy is set.
+ */
+static Dxf3dsolid *
+test_proprietary_data_read
+(
+        const char *filename,
+        int lazy
+)
+{
+        DxfFile fp;
+        Dxf3dsolid *solid = NULL;
+        char name[DXF_MAX_STRING_LENGTH];
+
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.fp = fopen (filename, "r");
+        fp.filename = (char *) filename;
+        fp.acad_version_number = AutoCAD_2000;
+        fp.lazy_proprietary_data = lazy;
+        if ((fp.fp == NULL)
+          || (fscanf (fp.fp, " %[^\n]", name) != 1)
+          || (fscanf (fp.fp, " %[^\n]", name) != 1))
+        {
+                return (NULL);
+        }
+        fp.line_number = 2;
+        /* A reader closes the file when it fails. */
+        solid = dxf_3dsolid_read (&fp, NULL);
+        if (solid != NULL)
+        {
+                fclose (fp.fp);
+        }
+        return (solid);
+}
+
+
+/*!
+ * \brief Check the lines of a chain of proprietary data.
+ */
+static int
+test_proprietary_data_check
+(
+        DxfProprietaryData *data,
+        const char **lines,
+        int number_of_lines
+)
+{
+        int i;
+
+        for (i = 0; i < number_of_lines; i++)
+        {
+                if ((data == NULL)
+                  || (data->line == NULL)
+                  || (strcmp (data->line, lines[i]) != 0))
+                {
+                        return (EXIT_FAILURE);
+                }
+                data = (DxfProprietaryData *) data->next;
+        }
+        return ((data == NULL) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+int
+main (void)
+{
+        const char *lines[] = {"first line", "second line", "third line"};
+        const char *additional_lines[] = {"an additional line"};
+        char filename[] = "test_proprietary_data_XXXXXX";
+        Dxf3dsolid *solid = NULL;
+        FILE *file = NULL;
+        int fd;
+        int result = EXIT_SUCCESS;
+
+        fd = mkstemp (filename);
+        if ((fd < 0) || ((file = fdopen (fd, "w")) == NULL))
+        {
+                fprintf (stderr, "test_proprietary_data: could not create a file.\n");
+                return (EXIT_FAILURE);
+        }
+        fputs (test_proprietary_data_text, file);
+        fclose (file);
+        /* Read the proprietary data as it is found. */
+        solid = test_proprietary_data_read (filename, FALSE);
+        if ((solid == NULL)
+          || (test_proprietary_data_check (solid->proprietary_data, lines, 3) != EXIT_SUCCESS)
+          || (test_proprietary_data_check (solid->additional_proprietary_data, additional_lines, 1) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_proprietary_data: wrong proprietary data read from the 3DSOLID.\n");
+                result = EXIT_FAILURE;
+        }
+        if (solid != NULL)
+        {
+                dxf_3dsolid_free (solid);
+        }
+        /* Record the location of the proprietary data, and load it on
+         * first access. */
+        solid = test_proprietary_data_read (filename, TRUE);
+        if ((solid == NULL)
+          || (solid->proprietary_data_range == NULL)
+          || (solid->proprietary_data_range->number_of_groups != 4))
+        {
+                fprintf (stderr, "test_proprietary_data: the location of the proprietary data of the 3DSOLID was not recorded.\n");
+                result = EXIT_FAILURE;
+        }
+        else if ((dxf_proprietary_data_range_load (solid->proprietary_data_range,
+          &solid->proprietary_data, &solid->additional_proprietary_data) != EXIT_SUCCESS)
+          || (test_proprietary_data_check (solid->proprietary_data, lines, 3) != EXIT_SUCCESS)
+          || (test_proprietary_data_check (solid->additional_proprietary_data, additional_lines, 1) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_proprietary_data: wrong proprietary data loaded for the 3DSOLID.\n");
+                result = EXIT_FAILURE;
+        }
+        if (solid != NULL)
+        {
+                dxf_3dsolid_free (solid);
+        }
+        /* A file which changed in between is not loaded, and leaves
+         * the chains as they were. */
+        solid = test_proprietary_data_read (filename, TRUE);
+        file = fopen (filename, "w");
+        if (file != NULL)
+        {
+                fputs ("  0\n3DSOLID\n  1\nfirst line\n  0\nEOF\n", file);
+                fclose (file);
+        }
+        if ((solid == NULL)
+          || (file == NULL)
+          || (dxf_proprietary_data_range_load (solid->proprietary_data_range,
+          &solid->proprietary_data, &solid->additional_proprietary_data) != EXIT_FAILURE)
+          || (solid->proprietary_data == NULL)
+          || (solid->proprietary_data->next != NULL)
+          || (strcmp (solid->proprietary_data->line, "") != 0)
+          || (solid->additional_proprietary_data->next != NULL))
+        {
+                fprintf (stderr, "test_proprietary_data: a failed load of the 3DSOLID changed its proprietary data.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        if (solid != NULL)
+        {
+                dxf_3dsolid_free (solid);
+        }
+        unlink (filename);
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,409 @@
+/*!
+ * \file test_raw_data.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for passing entities of unknown types and
+ * sections which are not modeled through a drawing (raw data).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "includes.h"
+
+
+/*!
+ * \brief A drawing with an entity of an unknown type, a section which
+ * is not part of a drawing and an \c OBJECTS section.
+ */
+static const char *test_raw_data_text =
+  "  0\nSECTION\n"
+  "  2\nHEADER\n"
+  "  9\n$ACADVER\n"
+  "  1\nAC1015\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n"
+  "  2\nENTITIES\n"
+  "  0\nWIPEOUT\n"
+  "  5\n2A\n"
+  "100\nAcDbEntity\n"
+  "  8\nMASKS\n"
+  "100\nAcDbWipeout\n"
+  " 10\n1.0\n 20\n2.0\n 30\n0.0\n"
+  "  0\nPOINT\n"
+  "  5\n2B\n"
+  "100\nAcDbEntity\n"
+  "  8\n0\n"
+  "100\nAcDbPoint\n"
+  " 10\n9.0\n 20\n9.0\n 30\n0.0\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n"
+  "  2\nOBJECTS\n"
+  "  0\nDICTIONARY\n"
+  "  5\nC\n"
+  "100\nAcDbDictionary\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n"
+  "  2\nACDSDATA\n"
+  " 70\n2\n"
+  "  0\nENDSEC\n"
+  "  0\nEOF\n";
+
+
+/*!
+ * \brief A drawing with header variables, symbol tables and a block
+ * definition which are not modeled, with a \c LINE as the library
+ * writes it.
+ */
+static const char *test_raw_data_drawing_text =
+  "  0\nSECTION\n"
+  "  2\nHEADER\n"
+  "  9\n$ACADVER\n"
+  "  1\nAC1015\n"
+  "  9\n$INSUNITS\n"
+  " 70\n4\n"
+  "  9\n$HANDSEED\n"
+  "  5\n30\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n"
+  "  2\nCLASSES\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n"
+  "  2\nTABLES\n"
+  "  0\nTABLE\n"
+  "  2\nLAYER\n"
+  "  5\n2\n"
+  "100\nAcDbSymbolTable\n"
+  " 70\n2\n"
+  "  0\nLAYER\n"
+  "  5\n10\n"
+  "100\nAcDbSymbolTableRecord\n"
+  "100\nAcDbLayerTableRecord\n"
+  "  2\n0\n"
+  " 70\n0\n"
+  " 62\n7\n"
+  "  6\nCONTINUOUS\n"
+  "  0\nLAYER\n"
+  "  5\n11\n"
+  "100\nAcDbSymbolTableRecord\n"
+  "100\nAcDbLayerTableRecord\n"
+  "  2\nWALLS\n"
+  " 70\n0\n"
+  " 62\n1\n"
+  "  6\nCONTINUOUS\n"
+  "  0\nENDTAB\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n"
+  "  2\nBLOCKS\n"
+  "  0\nBLOCK\n"
+  "  5\n20\n"
+  "100\nAcDbEntity\n"
+  "  8\n0\n"
+  "100\nAcDbBlockBegin\n"
+  "  2\nDOOR\n"
+  " 70\n0\n"
+  " 10\n0.0\n 20\n0.0\n 30\n0.0\n"
+  "  3\nDOOR\n"
+  "  1\n\n"
+  "  0\nENDBLK\n"
+  "  5\n21\n"
+  "100\nAcDbEntity\n"
+  "  8\n0\n"
+  "100\nAcDbBlockEnd\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n"
+  "  2\nENTITIES\n"
+  "  0\nLINE\n"
+  "  5\n2a\n"
+  "100\nAcDbEntity\n"
+  "  8\n0\n"
+  "100\nAcDbLine\n"
+  " 10\n1.000000\n 20\n2.000000\n 30\n0.000000\n"
+  " 11\n3.000000\n 21\n4.000000\n 31\n0.000000\n"
+  "  0\nENDSEC\n"
+  "  0\nSECTION\n"
+  "  2\nOBJECTS\n"
+  "  0\nDICTIONARY\n"
+  "  5\nC\n"
+  "100\nAcDbDictionary\n"
+  "  0\nENDSEC\n"
+  "  0\nEOF\n";
+
+
+/*!
+ * \brief Read a whole file, the caller frees the contents.
+ */
+static char *
+test_raw_data_contents
+(
+        const char *filename
+)
+{
+        FILE *file;
+        char *contents;
+        long size;
+
+        file = fopen (filename, "r");
+        if (file == NULL)
+        {
+                return (NULL);
+        }
+        fseek (file, 0, SEEK_END);
+        size = ftell (file);
+        rewind (file);
+        contents = malloc ((size_t) size + 1);
+        if ((contents != NULL)
+          && (fread (contents, 1, (size_t) size, file) != (size_t) size))
+        {
+                free (contents);
+                contents = NULL;
+        }
+        if (contents != NULL)
+        {
+                contents[size] = '\0';
+        }
+        fclose (file);
+        return (contents);
+}
+
+
+/*!
+ * \brief Write \c text to \c filename.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+test_raw_data_write
+(
+        const char *filename,
+                /*!< name of the file. */
+        const char *text
+                /*!< the contents of the file. */
+)
+{
+        FILE *file;
+
+        file = fopen (filename, "w");
+        if (file == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        fputs (text, file);
+        return ((fclose (file) == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Load \c test_raw_data_drawing_text, move its \c LINE to
+ * layer \c WALLS and save it again.
+ *
+ * The header variables, the symbol tables and the block definition are
+ * written byte for byte, the only difference with the loaded file is
+ * the layer of the \c LINE.
+ *
+ * \return \c EXIT_SUCCESS when the test passed, or \c EXIT_FAILURE.
+ */
+static int
+test_raw_data_round_trip
+(
+        const char *filename,
+                /*!< a temporary file for the loaded drawing. */
+        const char *filename_2
+                /*!< a temporary file for the saved drawing. */
+)
+{
+        DxfDrawing *drawing;
+        DxfEntities *entities;
+        DxfLine *line;
+        char *expected;
+        char *contents;
+        const char *layer;
+        size_t before;
+        int result = EXIT_SUCCESS;
+
+        if (test_raw_data_write (filename, test_raw_data_drawing_text) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_raw_data: could not write the drawing with symbol tables.\n");
+                return (EXIT_FAILURE);
+        }
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        if ((drawing == NULL)
+          || (dxf_file_load (filename, drawing) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_raw_data: could not load the drawing with symbol tables.\n");
+                return (EXIT_FAILURE);
+        }
+        entities = (DxfEntities *) drawing->entities_list;
+        line = (DxfLine *) dxf_entities_get_entity (entities, 0);
+        if ((dxf_entities_get_number_of_entities (entities) != 1)
+          || (line == NULL)
+          || (dxf_entity_get_type (line) != LINE))
+        {
+                fprintf (stderr, "test_raw_data: the LINE was not read.\n");
+                dxf_drawing_free (drawing);
+                return (EXIT_FAILURE);
+        }
+        dxf_line_set_layer (line, "WALLS");
+        if (dxf_file_save (filename_2, drawing, AutoCAD_2000, 1) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_raw_data: could not save the drawing with symbol tables.\n");
+                result = EXIT_FAILURE;
+        }
+        /* The expected file is the loaded file with the new layer. */
+        layer = strstr (test_raw_data_drawing_text, "100\nAcDbEntity\n  8\n0\n100\nAcDbLine\n");
+        before = (size_t) (layer - test_raw_data_drawing_text) + strlen ("100\nAcDbEntity\n  8\n");
+        expected = malloc (strlen (test_raw_data_drawing_text) + strlen ("WALLS") + 1);
+        if (expected != NULL)
+        {
+                memcpy (expected, test_raw_data_drawing_text, before);
+                strcpy (expected + before, "WALLS");
+                strcat (expected, test_raw_data_drawing_text + before + strlen ("0"));
+        }
+        contents = test_raw_data_contents (filename_2);
+        if ((expected == NULL)
+          || (contents == NULL)
+          || (strcmp (contents, expected) != 0))
+        {
+                fprintf (stderr, "test_raw_data: the saved drawing differs from the loaded drawing:\n%s\n",
+                  (contents != NULL) ? contents : "");
+                result = EXIT_FAILURE;
+        }
+        free (expected);
+        free (contents);
+        dxf_drawing_free (drawing);
+        return (result);
+}
+
+
+int
+main (void)
+{
+        char filename[] = "/tmp/test_raw_data_XXXXXX";
+        char filename_2[] = "/tmp/test_raw_data_XXXXXX";
+        DxfDrawing *drawing;
+        DxfEntities *entities;
+        DxfRawEntity *raw_entity;
+        DxfRawSection *raw_section;
+        char *contents;
+        int fd;
+        int fd_2;
+        int result = EXIT_SUCCESS;
+
+        fd = mkstemp (filename);
+        fd_2 = mkstemp (filename_2);
+        if ((fd < 0) || (fd_2 < 0))
+        {
+                fprintf (stderr, "test_raw_data: could not make a temporary file.\n");
+                return (EXIT_FAILURE);
+        }
+        close (fd);
+        close (fd_2);
+        if (test_raw_data_write (filename, test_raw_data_text) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_raw_data: could not write the drawing.\n");
+                return (EXIT_FAILURE);
+        }
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        if ((drawing == NULL)
+          || (dxf_file_load (filename, drawing) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_raw_data: could not load the drawing.\n");
+                return (EXIT_FAILURE);
+        }
+        /* The WIPEOUT is kept as a raw entity, the HEADER, OBJECTS and
+         * ACDSDATA sections as raw sections. */
+        entities = (DxfEntities *) drawing->entities_list;
+        raw_entity = (DxfRawEntity *) dxf_entities_get_entity (entities, 0);
+        if ((dxf_entities_get_number_of_entities (entities) != 2)
+          || (raw_entity == NULL)
+          || (dxf_entity_get_type (raw_entity) != UNKNOWN_ENTITY)
+          || (strcmp (raw_entity->entity_name, "WIPEOUT") != 0)
+          || (raw_entity->id_code != 0x2A)
+          || (strcmp (raw_entity->layer, "MASKS") != 0))
+        {
+                fprintf (stderr, "test_raw_data: the WIPEOUT was not kept as a raw entity.\n");
+                return (EXIT_FAILURE);
+        }
+        raw_section = (DxfRawSection *) drawing->raw_section_list;
+        if ((raw_section == NULL)
+          || (strcmp (raw_section->section_name, "HEADER") != 0)
+          || ((raw_section = (DxfRawSection *) raw_section->next) == NULL)
+          || (strcmp (raw_section->section_name, "OBJECTS") != 0)
+          || (raw_section->next == NULL)
+          || (strcmp (((DxfRawSection *) raw_section->next)->section_name, "ACDSDATA") != 0))
+        {
+                fprintf (stderr, "test_raw_data: the sections were not kept as raw sections.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Unchanged, the raw data is written as it was read. */
+        if (dxf_file_save (filename_2, drawing, AutoCAD_2000, 1) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_raw_data: could not save the drawing.\n");
+                result = EXIT_FAILURE;
+        }
+        contents = test_raw_data_contents (filename_2);
+        if ((contents == NULL)
+          || (strstr (contents, "  0\nWIPEOUT\n  5\n2A\n100\nAcDbEntity\n  8\nMASKS\n100\nAcDbWipeout\n") == NULL)
+          || (strstr (contents, "  2\nOBJECTS\n  0\nDICTIONARY\n  5\nC\n") == NULL)
+          || (strstr (contents, "  2\nACDSDATA\n 70\n2\n  0\nENDSEC\n") == NULL))
+        {
+                fprintf (stderr, "test_raw_data: the raw data was not written as it was read.\n");
+                result = EXIT_FAILURE;
+        }
+        free (contents);
+        /* A changed handle and layer are written from the members. */
+        dxf_entity_set_id_code (raw_entity, 0x3F0);
+        dxf_free (raw_entity->layer);
+        raw_entity->layer = dxf_strdup ("HIDDEN_MASKS");
+        if (dxf_file_save (filename_2, drawing, AutoCAD_2000, 1) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_raw_data: could not save the changed drawing.\n");
+                result = EXIT_FAILURE;
+        }
+        contents = test_raw_data_contents (filename_2);
+        if ((contents == NULL)
+          || (strstr (contents, "  0\nWIPEOUT\n  5\n3f0\n100\nAcDbEntity\n  8\nHIDDEN_MASKS\n100\nAcDbWipeout\n") == NULL))
+        {
+                fprintf (stderr, "test_raw_data: the changed handle and layer were not written.\n");
+                result = EXIT_FAILURE;
+        }
+        free (contents);
+        /* Sections which are not modeled survive a load and a save. */
+        result |= test_raw_data_round_trip (filename, filename_2);
+        /* Clean up. */
+        unlink (filename);
+        unlink (filename_2);
+        dxf_drawing_free (drawing);
+        return (result);
+}
+
+
+/* EOF */
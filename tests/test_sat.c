@@ -0,0 +1,195 @@
+/*!
+ * \file test_sat.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the conversion between ACIS SAT text and
+ * the proprietary data of \c 3DSOLID, \c BODY and \c REGION entities.
+ *
+ * Encoded text is compared with a conversion one character at a time
+ * and decoded again, for lengths and offsets which take the SSE2 path,
+ * the remainder and both.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "includes.h"
+
+
+#define TEST_SAT_MAX_SIZE 80
+        /*!< \brief Largest number of characters converted. */
+
+#define TEST_SAT_MAX_OFFSET 4
+        /*!< \brief Number of offsets of the buffers, to convert
+         * unaligned text as well. */
+
+
+/*!
+ * \brief Encode SAT text one character at a time.
+ */
+static void
+test_sat_encode
+(
+        const char *sat,
+        size_t length,
+        char *text
+)
+{
+        size_t i;
+
+        for (i = 0; i < length; i++)
+        {
+                text[i] = (sat[i] == ' ')
+                  ? ' '
+                  : (char) (159 - (unsigned char) sat[i]);
+        }
+}
+
+
+/*!
+ * \brief Encode SAT text into chains and decode the chains again.
+ *
+ * \return \c EXIT_SUCCESS when the decoded text is \c sat, or
+ * \c EXIT_FAILURE otherwise.
+ */
+static int
+test_sat_chains
+(
+        const char *sat,
+        size_t length
+)
+{
+        DxfProprietaryData *data = NULL;
+        DxfProprietaryData *additional_data = NULL;
+        char *decoded = NULL;
+        size_t decoded_length = 0;
+        int result = EXIT_SUCCESS;
+
+        if ((dxf_sat_encode_chains (sat, length, &data, &additional_data) != EXIT_SUCCESS)
+          || (dxf_sat_decode_chains (data, additional_data, &decoded, &decoded_length) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_sat: could not convert the chains.\n");
+                result = EXIT_FAILURE;
+        }
+        else if ((decoded_length != length)
+          || (memcmp (decoded, sat, length) != 0))
+        {
+                fprintf (stderr, "test_sat: the chains were decoded into %d characters, not %d.\n",
+                  (int) decoded_length, (int) length);
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        dxf_free (decoded);
+        dxf_proprietary_data_free_chain (data);
+        dxf_proprietary_data_free_chain (additional_data);
+        return (result);
+}
+
+
+int
+main (void)
+{
+        char sat[256 + TEST_SAT_MAX_OFFSET];
+        char text[256 + TEST_SAT_MAX_OFFSET];
+        char expected[256];
+        char decoded[256 + TEST_SAT_MAX_OFFSET];
+        char *lines;
+        size_t offset;
+        size_t length;
+        size_t i;
+        int result = EXIT_SUCCESS;
+
+        /* All character values, spaces among them. */
+        for (i = 0; i < sizeof (sat); i++)
+        {
+                sat[i] = (char) i;
+        }
+        test_sat_encode (sat, 256, expected);
+        if ((dxf_sat_encode (sat, 256, text) != EXIT_SUCCESS)
+          || (memcmp (text, expected, 256) != 0))
+        {
+                fprintf (stderr, "test_sat: wrong text for all characters.\n");
+                result = EXIT_FAILURE;
+        }
+        for (offset = 0; offset < TEST_SAT_MAX_OFFSET; offset++)
+        {
+                for (length = 0; length <= TEST_SAT_MAX_SIZE; length++)
+                {
+                        test_sat_encode (sat + offset, length, expected);
+                        memset (text, 0, sizeof (text));
+                        if ((dxf_sat_encode (sat + offset, length, text + offset) != EXIT_SUCCESS)
+                          || (memcmp (text + offset, expected, length) != 0))
+                        {
+                                fprintf (stderr, "test_sat: wrong text for %d characters at offset %d.\n",
+                                  (int) length, (int) offset);
+                                result = EXIT_FAILURE;
+                        }
+                        memset (decoded, 0, sizeof (decoded));
+                        if ((dxf_sat_decode (text + offset, length, decoded + offset) != EXIT_SUCCESS)
+                          || (memcmp (decoded + offset, sat + offset, length) != 0))
+                        {
+                                fprintf (stderr, "test_sat: wrong SAT text for %d characters at offset %d.\n",
+                                  (int) length, (int) offset);
+                                result = EXIT_FAILURE;
+                        }
+                        /* Decoding in place. */
+                        if ((dxf_sat_decode (text + offset, length, text + offset) != EXIT_SUCCESS)
+                          || (memcmp (text + offset, sat + offset, length) != 0))
+                        {
+                                fprintf (stderr, "test_sat: wrong SAT text in place for %d characters at offset %d.\n",
+                                  (int) length, (int) offset);
+                                result = EXIT_FAILURE;
+                        }
+                }
+        }
+        /* A line longer than a group is split over additional groups. */
+        if ((lines = dxf_malloc (1024)) == NULL)
+        {
+                fprintf (stderr, "test_sat: could not allocate memory.\n");
+                return (EXIT_FAILURE);
+        }
+        length = 0;
+        length += sprintf (lines + length, "400 0 1 0 \n");
+        for (i = 0; i < 2 * DXF_SAT_MAX_GROUP_LENGTH + 17; i++)
+        {
+                lines[length++] = "body $-1 0.5 #"[i % 14];
+        }
+        lines[length++] = '\n';
+        length += sprintf (lines + length, "End-of-ACIS-data \n");
+        if (test_sat_chains (lines, length) != EXIT_SUCCESS)
+        {
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        dxf_free (lines);
+        return (result);
+}
+
+
+/* EOF */
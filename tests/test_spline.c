@@ -0,0 +1,222 @@
+/*!
+ * \file test_spline.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for reading and writing a DXF spline entity
+ * (\c SPLINE) and the spline of a DXF helix entity (\c HELIX).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "test_util.h"
+
+
+/*!
+ * \brief A \c SPLINE with three control points, two fit points and
+ * seven knots.
+ */
+static const char *test_spline_text =
+  "  0\nSPLINE\n"
+  "  5\n2A\n"
+  "100\nAcDbEntity\n"
+  "  8\nCURVES\n"
+  "100\nAcDbSpline\n"
+  " 70\n8\n"
+  " 71\n3\n"
+  " 72\n7\n"
+  " 73\n3\n"
+  " 74\n2\n"
+  " 40\n0.0\n 40\n0.0\n 40\n0.0\n 40\n0.5\n 40\n1.0\n 40\n1.0\n 40\n1.0\n"
+  " 10\n1.0\n 20\n2.0\n 30\n0.0\n"
+  " 10\n3.0\n 20\n4.0\n 30\n0.0\n"
+  " 10\n5.0\n 20\n6.0\n 30\n0.0\n"
+  " 11\n1.5\n 21\n2.5\n 31\n0.0\n"
+  " 11\n4.5\n 21\n5.5\n 31\n0.0\n"
+  "  0\nEOF\n";
+
+
+/*!
+ * \brief A \c HELIX, the groups of its spline are followed by the
+ * groups of the helix.
+ */
+static const char *test_helix_text =
+  "  0\nHELIX\n"
+  "  5\n41C\n"
+  "100\nAcDbEntity\n"
+  "  8\n0\n"
+  "100\nAcDbSpline\n"
+  " 70\n0\n"
+  " 71\n3\n"
+  " 72\n6\n"
+  " 73\n2\n"
+  " 74\n0\n"
+  " 40\n0.0\n 40\n0.0\n 40\n0.0\n 40\n1.0\n 40\n1.0\n 40\n1.0\n"
+  " 10\n100.0\n 20\n75.0\n 30\n0.0\n"
+  " 10\n110.0\n 20\n80.0\n 30\n3.0\n"
+  "100\nAcDbHelix\n"
+  " 90\n29\n"
+  " 91\n65\n"
+  " 10\n100.0\n 20\n75.0\n 30\n0.0\n"
+  " 11\n125.0\n 21\n74.0\n 31\n0.0\n"
+  " 12\n0.0\n 22\n0.0\n 32\n1.0\n"
+  " 40\n15.0\n"
+  " 41\n3.0\n"
+  " 42\n16.0\n"
+  "290\n1\n"
+  "280\n1\n"
+  "  0\nEOF\n";
+
+
+/*!
+ * \brief Count the points in a list of points.
+ */
+static int
+test_spline_count_points
+(
+        DxfPoint *point
+)
+{
+        int count = 0;
+
+        while (point != NULL)
+        {
+                count++;
+                point = (DxfPoint *) point->next;
+        }
+        return (count);
+}
+
+
+int
+main (void)
+{
+        DxfFile fp;
+        DxfSpline *spline = NULL;
+        DxfSpline *spline_2 = NULL;
+        DxfHelix *helix = NULL;
+        DxfPoint *point = NULL;
+        char *text = NULL;
+        char *text_2 = NULL;
+        int result = EXIT_SUCCESS;
+
+        /* Read a SPLINE, every control and fit point is read once. */
+        if (test_util_open (&fp, test_spline_text) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_spline: could not open the SPLINE text.\n");
+                return (EXIT_FAILURE);
+        }
+        spline = dxf_spline_read (&fp, NULL);
+        if (spline == NULL)
+        {
+                fprintf (stderr, "test_spline: could not read the SPLINE.\n");
+                return (EXIT_FAILURE);
+        }
+        fclose (fp.fp);
+        if ((test_spline_count_points (spline->p0) != 3)
+          || (test_spline_count_points (spline->p1) != 2)
+          || (spline->number_of_knots != 7))
+        {
+                fprintf (stderr, "test_spline: wrong points or knots read from the SPLINE.\n");
+                return (EXIT_FAILURE);
+        }
+        point = (DxfPoint *) ((DxfPoint *) spline->p0->next)->next;
+        if ((point->x0 != 5.0) || (point->y0 != 6.0))
+        {
+                fprintf (stderr, "test_spline: wrong last control point read from the SPLINE.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Write it, no extra control or fit point is written. */
+        text = test_util_write (spline, TRUE);
+        if ((text == NULL)
+          || (test_util_count_groups (text, " 10") != 3)
+          || (test_util_count_groups (text, " 11") != 2)
+          || (test_util_count_groups (text, " 40") != 7))
+        {
+                fprintf (stderr, "test_spline: wrong number of points or knots written for the SPLINE.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Read what was written, and write it again. */
+        if ((text != NULL)
+          && (test_util_open (&fp, text) == EXIT_SUCCESS))
+        {
+                spline_2 = dxf_spline_read (&fp, NULL);
+                if (spline_2 != NULL)
+                {
+                        fclose (fp.fp);
+                        text_2 = test_util_write (spline_2, TRUE);
+                }
+                if ((text_2 == NULL)
+                  || (strcmp (text, text_2) != 0))
+                {
+                        fprintf (stderr, "test_spline: the SPLINE does not write the same after reading it back.\n");
+                        result = EXIT_FAILURE;
+                }
+        }
+        else
+        {
+                result = EXIT_FAILURE;
+        }
+        /* Read a HELIX, the spline ends at the AcDbHelix subclass. */
+        if (test_util_open (&fp, test_helix_text) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_spline: could not open the HELIX text.\n");
+                return (EXIT_FAILURE);
+        }
+        helix = dxf_helix_read (&fp, NULL);
+        if (helix != NULL)
+        {
+                fclose (fp.fp);
+        }
+        if ((helix == NULL)
+          || (test_spline_count_points (helix->spline->p0) != 2)
+          || (helix->spline->number_of_control_points != 2)
+          || (dxf_helix_get_x0 (helix) != 100.0)
+          || (dxf_helix_get_radius (helix) != 15.0))
+        {
+                fprintf (stderr, "test_spline: wrong spline or helix values read from the HELIX.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        free (text);
+        free (text_2);
+        dxf_spline_free (spline);
+        if (spline_2 != NULL)
+        {
+                dxf_spline_free (spline_2);
+        }
+        if (helix != NULL)
+        {
+                dxf_helix_free (helix);
+        }
+        return (result);
+}
+
+
+/* EOF */
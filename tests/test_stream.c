@@ -0,0 +1,220 @@
+/*!
+ * \file test_stream.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the extents and the handles of a DXF output
+ * stream.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Make a line from (\c x0, \c y0) to (\c x1, \c y1).
+ */
+static DxfLine *
+test_stream_line
+(
+        int id_code,
+        double x0,
+        double y0,
+        double x1,
+        double y1
+)
+{
+        DxfLine *line;
+
+        line = dxf_line_init (dxf_line_new ());
+        if (line == NULL)
+        {
+                return (NULL);
+        }
+        dxf_line_set_id_code (line, id_code);
+        dxf_line_set_x0 (line, x0);
+        dxf_line_set_y0 (line, y0);
+        dxf_line_set_x1 (line, x1);
+        dxf_line_set_y1 (line, y1);
+        return (line);
+}
+
+
+int
+main (void)
+{
+        char filename[] = "/tmp/test_stream_XXXXXX";
+        DxfDrawing *drawing;
+        DxfStream *stream;
+        DxfExtents extents;
+        DxfEllipse *ellipse;
+        DxfLWPolyline *lwpolyline;
+        DxfVertex *vertex;
+        DxfRay *ray;
+        DxfLine *line;
+        void *entity;
+        char hand_seed[DXF_MAX_STRING_LENGTH];
+        int first_handle;
+        int fd;
+        int result = EXIT_SUCCESS;
+
+        fd = mkstemp (filename);
+        if (fd < 0)
+        {
+                fprintf (stderr, "test_stream: could not make a temporary file.\n");
+                return (EXIT_FAILURE);
+        }
+        close (fd);
+        drawing = dxf_drawing_init (dxf_drawing_new (), AutoCAD_2000);
+        if (drawing == NULL)
+        {
+                fprintf (stderr, "test_stream: could not make a drawing.\n");
+                return (EXIT_FAILURE);
+        }
+        dxf_entities_append ((DxfEntities *) drawing->entities_list,
+          test_stream_line (0x100, 0.0, 0.0, 1.0, 1.0));
+        /* A drawing with an entity without extents is refused. */
+        entity = dxf_entity_init (dxf_entity_new (REGION));
+        dxf_entities_append ((DxfEntities *) drawing->entities_list, entity);
+        if (dxf_stream_open (filename, drawing, AutoCAD_2000) != NULL)
+        {
+                fprintf (stderr, "test_stream: a drawing with a REGION was streamed.\n");
+                result = EXIT_FAILURE;
+        }
+        DXF_ENTITY_HEADER (entity)->flags |= DXF_ENTITY_FLAG_ERASED;
+        stream = dxf_stream_open (filename, drawing, AutoCAD_2000);
+        if (stream == NULL)
+        {
+                fprintf (stderr, "test_stream: could not open the stream.\n");
+                return (EXIT_FAILURE);
+        }
+        first_handle = stream->next_handle;
+        if (first_handle <= 0x100)
+        {
+                fprintf (stderr, "test_stream: the handle seed is below the handles of the drawing.\n");
+                result = EXIT_FAILURE;
+        }
+        /* An ellipse with extents (-4, -2) to (4, 2). */
+        ellipse = dxf_ellipse_init (dxf_ellipse_new ());
+        ellipse->x1 = 4.0;
+        ellipse->ratio = 0.5;
+        /* A half circle below the chord from (10, 0) to (20, 0). */
+        lwpolyline = dxf_lwpolyline_init (dxf_lwpolyline_new ());
+        vertex = (DxfVertex *) lwpolyline->vertices;
+        vertex->x0 = 10.0;
+        vertex->bulge = 1.0;
+        vertex->next = (struct DxfVertex *) dxf_vertex_init (dxf_vertex_new ());
+        ((DxfVertex *) vertex->next)->x0 = 20.0;
+        lwpolyline->number_vertices = 2;
+        /* A ray does not add to the extents. */
+        ray = dxf_ray_init (dxf_ray_new ());
+        ray->x0 = 1000.0;
+        ray->y0 = 1000.0;
+        ray->x1 = 1.0;
+        if ((dxf_stream_write_ellipse (stream, ellipse) != EXIT_SUCCESS)
+          || (dxf_stream_write_lwpolyline (stream, lwpolyline) != EXIT_SUCCESS)
+          || (dxf_stream_write_ray (stream, ray) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_stream: could not write the entities.\n");
+                result = EXIT_FAILURE;
+        }
+        if (dxf_ellipse_get_id_code (ellipse) != first_handle)
+        {
+                fprintf (stderr, "test_stream: wrong handle given to the ellipse.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Entities without extents, handles of the drawing and handles
+         * written before are refused. */
+        entity = dxf_entity_init (dxf_entity_new (DSOLID));
+        line = test_stream_line (0x100, 0.0, 0.0, 100.0, 100.0);
+        if ((dxf_stream_write_entity (stream, entity) == EXIT_SUCCESS)
+          || (dxf_stream_write_line (stream, line) == EXIT_SUCCESS))
+        {
+                fprintf (stderr, "test_stream: a 3DSOLID or a handle of the drawing was streamed.\n");
+                result = EXIT_FAILURE;
+        }
+        dxf_entity_free (entity);
+        dxf_line_set_id_code (line, first_handle + 1);
+        if (dxf_stream_write_line (stream, line) == EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_stream: a handle was streamed twice.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Handles above the handles written before are accepted. */
+        dxf_line_set_id_code (line, first_handle + 100);
+        dxf_line_set_x1 (line, 2.0);
+        dxf_line_set_y1 (line, 2.0);
+        if (dxf_stream_write_line (stream, line) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_stream: could not write a line with a free handle.\n");
+                result = EXIT_FAILURE;
+        }
+        dxf_line_set_id_code (line, 0);
+        if ((dxf_stream_write_line (stream, line) != EXIT_SUCCESS)
+          || (dxf_line_get_id_code (line) != first_handle + 101))
+        {
+                fprintf (stderr, "test_stream: wrong handle given after a handle set by the caller.\n");
+                result = EXIT_FAILURE;
+        }
+        if ((dxf_stream_get_number_of_entities (stream) != 6)
+          || (dxf_stream_get_extents (stream, &extents) != EXIT_SUCCESS)
+          || (extents.min_x != -4.0)
+          || (extents.min_y != -5.0)
+          || (extents.max_x != 20.0)
+          || (extents.max_y != 2.0))
+        {
+                fprintf (stderr, "test_stream: wrong number of entities or extents.\n");
+                result = EXIT_FAILURE;
+        }
+        if (dxf_stream_close (stream) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "test_stream: could not close the stream.\n");
+                result = EXIT_FAILURE;
+        }
+        snprintf (hand_seed, sizeof (hand_seed), "%X", first_handle + 102);
+        if (strcmp (((DxfHeader *) drawing->header)->HandSeed, hand_seed) != 0)
+        {
+                fprintf (stderr, "test_stream: wrong handle seed written.\n");
+                result = EXIT_FAILURE;
+        }
+        /* Clean up. */
+        unlink (filename);
+        dxf_ellipse_free (ellipse);
+        dxf_lwpolyline_free (lwpolyline);
+        dxf_ray_free (ray);
+        dxf_line_free (line);
+        dxf_drawing_free (drawing);
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,154 @@
+/*!
+ * \file test_tessellation.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the tessellation of a circle within a
+ * chord error.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <math.h>
+#include <stdio.h>
+#include "includes.h"
+
+
+#define TEST_TESSELLATION_RADIUS 10.0
+        /*!< \brief Radius of the circle. */
+
+#define TEST_TESSELLATION_CHORD_ERROR 0.01
+        /*!< \brief Maximum distance between the circle and its polyline. */
+
+
+/*!
+ * \brief Check the polyline of a circle around (1, 2, 3): every vertex
+ * on the circle at equally spaced angles, no segment further than the
+ * chord error from the circle, and no more segments than needed.
+ */
+static int
+test_tessellation_check_circle
+(
+        DxfTessellation *tessellation
+)
+{
+        const double *vertices;
+        size_t number_of_vertices;
+        size_t number_of_segments;
+        double angle;
+        double mid_x;
+        double mid_y;
+        double error;
+        size_t i;
+
+        vertices = dxf_tessellation_get_polyline (tessellation, 0, &number_of_vertices);
+        if ((vertices == NULL) || (number_of_vertices < 4))
+        {
+                fprintf (stderr, "test_tessellation: no polyline for the circle.\n");
+                return (EXIT_FAILURE);
+        }
+        number_of_segments = number_of_vertices - 1;
+        /* A closed curve repeats its first vertex. */
+        if ((vertices[0] != vertices[3 * number_of_segments])
+          || (vertices[1] != vertices[3 * number_of_segments + 1]))
+        {
+                fprintf (stderr, "test_tessellation: the circle is not closed.\n");
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < number_of_vertices; i++)
+        {
+                angle = 2.0 * M_PI * i / number_of_segments;
+                if ((fabs (vertices[3 * i] - (1.0 + TEST_TESSELLATION_RADIUS * cos (angle))) > 1e-9)
+                  || (fabs (vertices[3 * i + 1] - (2.0 + TEST_TESSELLATION_RADIUS * sin (angle))) > 1e-9)
+                  || (vertices[3 * i + 2] != 3.0))
+                {
+                        fprintf (stderr, "test_tessellation: vertex %d is not on the circle.\n", (int) i);
+                        return (EXIT_FAILURE);
+                }
+        }
+        for (i = 0; i < number_of_segments; i++)
+        {
+                /* The middle of a chord is furthest from the circle. */
+                mid_x = 0.5 * (vertices[3 * i] + vertices[3 * (i + 1)]) - 1.0;
+                mid_y = 0.5 * (vertices[3 * i + 1] + vertices[3 * (i + 1) + 1]) - 2.0;
+                error = TEST_TESSELLATION_RADIUS - sqrt (mid_x * mid_x + mid_y * mid_y);
+                if (error > TEST_TESSELLATION_CHORD_ERROR + 1e-12)
+                {
+                        fprintf (stderr, "test_tessellation: segment %d is %g from the circle.\n",
+                          (int) i, error);
+                        return (EXIT_FAILURE);
+                }
+        }
+        /* One segment less would exceed the chord error. */
+        error = TEST_TESSELLATION_RADIUS * (1.0 - cos (M_PI / (number_of_segments - 1)));
+        if (error <= TEST_TESSELLATION_CHORD_ERROR)
+        {
+                fprintf (stderr, "test_tessellation: %d segments are more than needed.\n",
+                  (int) number_of_segments);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+int
+main (void)
+{
+        DxfTessellation *tessellation;
+        DxfCircle *circle;
+        int result = EXIT_SUCCESS;
+
+        tessellation = dxf_tessellation_new (TEST_TESSELLATION_CHORD_ERROR, 0.0);
+        circle = dxf_circle_init (dxf_circle_new ());
+        if ((tessellation == NULL) || (circle == NULL))
+        {
+                fprintf (stderr, "test_tessellation: could not make a tessellation.\n");
+                return (EXIT_FAILURE);
+        }
+        circle->p0->x0 = 1.0;
+        circle->p0->y0 = 2.0;
+        circle->p0->z0 = 3.0;
+        circle->radius = TEST_TESSELLATION_RADIUS;
+        if ((dxf_tessellation_add_entity (tessellation, circle) != EXIT_SUCCESS)
+          || (dxf_tessellation_get_number_of_polylines (tessellation) != 1)
+          || (dxf_tessellation_get_source (tessellation, 0) != circle))
+        {
+                fprintf (stderr, "test_tessellation: could not tessellate the circle.\n");
+                result = EXIT_FAILURE;
+        }
+        else
+        {
+                result = test_tessellation_check_circle (tessellation);
+        }
+        /* Clean up. */
+        dxf_tessellation_free (tessellation);
+        dxf_circle_free (circle);
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,142 @@
+/*!
+ * \file test_util.c
+ *
+ * \author Copyright (C) 2017 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Helpers shared by the libDXF unit tests: reading an entity
+ * from a string, and writing an entity to a string.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "test_util.h"
+
+
+/*!
+ * \brief Open \c text for reading, positioned after the entity name.
+ *
+ * A reader closes the file when it fails, only close it after a
+ * successful read.
+ */
+int
+test_util_open
+(
+        DxfFile *fp,
+        const char *text
+)
+{
+        char name[DXF_MAX_STRING_LENGTH];
+
+        memset (fp, 0, sizeof (DxfFile));
+        fp->fp = fmemopen ((void *) text, strlen (text), "r");
+        fp->filename = (char *) "test";
+        fp->acad_version_number = AutoCAD_2000;
+        if ((fp->fp == NULL)
+          || (fscanf (fp->fp, " %[^\n]", name) != 1)
+          || (fscanf (fp->fp, " %[^\n]", name) != 1))
+        {
+                return (EXIT_FAILURE);
+        }
+        fp->line_number = 2;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Count the lines of \c text holding group code \c code.
+ */
+int
+test_util_count_groups
+(
+        const char *text,
+        const char *code
+)
+{
+        const char *line = text;
+        size_t length;
+        int count = 0;
+        int is_code = 1;
+
+        while (*line != '\0')
+        {
+                length = strcspn (line, "\n");
+                if ((is_code)
+                  && (length == strlen (code))
+                  && (strncmp (line, code, length) == 0))
+                {
+                        count++;
+                }
+                is_code = !is_code;
+                line += length;
+                if (*line == '\n')
+                {
+                        line++;
+                }
+        }
+        return (count);
+}
+
+
+/*!
+ * \brief Write a single entity to a string as AutoCAD 2000, the caller
+ * frees the string.
+ *
+ * With \c end set the entity is followed by an \c EOF marker, to read
+ * it back with \c test_util_open ().
+ */
+char *
+test_util_write
+(
+        void *entity,
+        int end
+)
+{
+        DxfFile fp;
+        char *text = NULL;
+        size_t size = 0;
+
+        memset (&fp, 0, sizeof (DxfFile));
+        fp.fp = open_memstream (&text, &size);
+        fp.filename = (char *) "test";
+        fp.acad_version_number = AutoCAD_2000;
+        if (fp.fp == NULL)
+        {
+                return (NULL);
+        }
+        dxf_entity_write (&fp, entity);
+        if (end)
+        {
+                fprintf (fp.fp, "  0\nEOF\n");
+        }
+        fclose (fp.fp);
+        return (text);
+}
+
+
+/* EOF */